@@ -0,0 +1,625 @@
+// generated by chip8-aot from roms/15PUZZLE.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x00, 0xE0, 0x6C, 0x00, 0x4C, 0x00, 0x6E, 0x0F, 0xA2, 0x03, 0x60, 0x20,
+    0xF0, 0x55, 0x00, 0xE0, 0x22, 0xBE, 0x22, 0x76, 0x22, 0x8E, 0x22, 0x5E,
+    0x22, 0x46, 0x12, 0x10, 0x61, 0x00, 0x62, 0x17, 0x63, 0x04, 0x41, 0x10,
+    0x00, 0xEE, 0xA2, 0xE8, 0xF1, 0x1E, 0xF0, 0x65, 0x40, 0x00, 0x12, 0x34,
+    0xF0, 0x29, 0xD2, 0x35, 0x71, 0x01, 0x72, 0x05, 0x64, 0x03, 0x84, 0x12,
+    0x34, 0x00, 0x12, 0x22, 0x62, 0x17, 0x73, 0x06, 0x12, 0x22, 0x64, 0x03,
+    0x84, 0xE2, 0x65, 0x03, 0x85, 0xD2, 0x94, 0x50, 0x00, 0xEE, 0x44, 0x03,
+    0x00, 0xEE, 0x64, 0x01, 0x84, 0xE4, 0x22, 0xA6, 0x12, 0x46, 0x64, 0x03,
+    0x84, 0xE2, 0x65, 0x03, 0x85, 0xD2, 0x94, 0x50, 0x00, 0xEE, 0x44, 0x00,
+    0x00, 0xEE, 0x64, 0xFF, 0x84, 0xE4, 0x22, 0xA6, 0x12, 0x5E, 0x64, 0x0C,
+    0x84, 0xE2, 0x65, 0x0C, 0x85, 0xD2, 0x94, 0x50, 0x00, 0xEE, 0x44, 0x00,
+    0x00, 0xEE, 0x64, 0xFC, 0x84, 0xE4, 0x22, 0xA6, 0x12, 0x76, 0x64, 0x0C,
+    0x84, 0xE2, 0x65, 0x0C, 0x85, 0xD2, 0x94, 0x50, 0x00, 0xEE, 0x44, 0x0C,
+    0x00, 0xEE, 0x64, 0x04, 0x84, 0xE4, 0x22, 0xA6, 0x12, 0x8E, 0xA2, 0xE8,
+    0xF4, 0x1E, 0xF0, 0x65, 0xA2, 0xE8, 0xFE, 0x1E, 0xF0, 0x55, 0x60, 0x00,
+    0xA2, 0xE8, 0xF4, 0x1E, 0xF0, 0x55, 0x8E, 0x40, 0x00, 0xEE, 0x3C, 0x00,
+    0x12, 0xD2, 0x22, 0x1C, 0x22, 0xD8, 0x22, 0x1C, 0xA2, 0xF8, 0xFD, 0x1E,
+    0xF0, 0x65, 0x8D, 0x00, 0x00, 0xEE, 0x7C, 0xFF, 0xCD, 0x0F, 0x00, 0xEE,
+    0x7D, 0x01, 0x60, 0x0F, 0x8D, 0x02, 0xED, 0x9E, 0x12, 0xD8, 0xED, 0xA1,
+    0x12, 0xE2, 0x00, 0xEE, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08,
+    0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F, 0x00, 0x0D, 0x00, 0x01, 0x02,
+    0x04, 0x05, 0x06, 0x08, 0x09, 0x0A, 0x0C, 0x0E, 0x03, 0x07, 0x0B, 0x0F,
+};
+const size_t aot_rom_size = 264;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 00E0 CLS
+    STEP(0x200, 0x00E0);
+    c->pc = 0x200;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x202) goto dispatch;
+L202: // 6C00 LD VC, 0x00
+    STEP(0x202, 0x6C00);
+    V[12] = 0x00;
+L204: // 4C00 SNE VC, 0x00
+    STEP(0x204, 0x4C00);
+    if (V[12] != 0x00) goto L208;
+L206: // 6E0F LD VE, 0x0F
+    STEP(0x206, 0x6E0F);
+    V[14] = 0x0F;
+L208: // A203 LD I, 0x203
+    STEP(0x208, 0xA203);
+    c->I = 0x203;
+L20A: // 6020 LD V0, 0x20
+    STEP(0x20A, 0x6020);
+    V[0] = 0x20;
+L20C: // F055 LD [I], V0
+    STEP(0x20C, 0xF055);
+    c->pc = 0x20C;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x20E) goto dispatch;
+L20E: // 00E0 CLS
+    STEP(0x20E, 0x00E0);
+    c->pc = 0x20E;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x210) goto dispatch;
+L210: // 22BE CALL 0x2BE
+    STEP(0x210, 0x22BE);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x210;
+    goto L2BE;
+L212: // 2276 CALL 0x276
+    STEP(0x212, 0x2276);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x212;
+    goto L276;
+L214: // 228E CALL 0x28E
+    STEP(0x214, 0x228E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x214;
+    goto L28E;
+L216: // 225E CALL 0x25E
+    STEP(0x216, 0x225E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x216;
+    goto L25E;
+L218: // 2246 CALL 0x246
+    STEP(0x218, 0x2246);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x218;
+    goto L246;
+L21A: // 1210 JP 0x210
+    STEP(0x21A, 0x1210);
+    goto L210;
+L21C: // 6100 LD V1, 0x00
+    STEP(0x21C, 0x6100);
+    V[1] = 0x00;
+L21E: // 6217 LD V2, 0x17
+    STEP(0x21E, 0x6217);
+    V[2] = 0x17;
+L220: // 6304 LD V3, 0x04
+    STEP(0x220, 0x6304);
+    V[3] = 0x04;
+L222: // 4110 SNE V1, 0x10
+    STEP(0x222, 0x4110);
+    if (V[1] != 0x10) goto L226;
+L224: // 00EE RET
+    STEP(0x224, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L226: // A2E8 LD I, 0x2E8
+    STEP(0x226, 0xA2E8);
+    c->I = 0x2E8;
+L228: // F11E ADD I, V1
+    STEP(0x228, 0xF11E);
+    c->I += V[1];
+L22A: // F065 LD V0, [I]
+    STEP(0x22A, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L22C: // 4000 SNE V0, 0x00
+    STEP(0x22C, 0x4000);
+    if (V[0] != 0x00) goto L230;
+L22E: // 1234 JP 0x234
+    STEP(0x22E, 0x1234);
+    goto L234;
+L230: // F029 LD F, V0
+    STEP(0x230, 0xF029);
+    c->I = V[0] * 5;
+L232: // D235 DRW V2, V3, 5
+    STEP(0x232, 0xD235);
+    c->pc = 0x232;
+    predecode(0xD235, &in);
+    execute(c, &in);
+    if (c->pc != 0x234) goto dispatch;
+L234: // 7101 ADD V1, 0x01
+    STEP(0x234, 0x7101);
+    V[1] += 0x01;
+L236: // 7205 ADD V2, 0x05
+    STEP(0x236, 0x7205);
+    V[2] += 0x05;
+L238: // 6403 LD V4, 0x03
+    STEP(0x238, 0x6403);
+    V[4] = 0x03;
+L23A: // 8412 AND V4, V1
+    STEP(0x23A, 0x8412);
+    V[4] &= V[1];
+L23C: // 3400 SE V4, 0x00
+    STEP(0x23C, 0x3400);
+    if (V[4] == 0x00) goto L240;
+L23E: // 1222 JP 0x222
+    STEP(0x23E, 0x1222);
+    goto L222;
+L240: // 6217 LD V2, 0x17
+    STEP(0x240, 0x6217);
+    V[2] = 0x17;
+L242: // 7306 ADD V3, 0x06
+    STEP(0x242, 0x7306);
+    V[3] += 0x06;
+L244: // 1222 JP 0x222
+    STEP(0x244, 0x1222);
+    goto L222;
+L246: // 6403 LD V4, 0x03
+    STEP(0x246, 0x6403);
+    V[4] = 0x03;
+L248: // 84E2 AND V4, VE
+    STEP(0x248, 0x84E2);
+    V[4] &= V[14];
+L24A: // 6503 LD V5, 0x03
+    STEP(0x24A, 0x6503);
+    V[5] = 0x03;
+L24C: // 85D2 AND V5, VD
+    STEP(0x24C, 0x85D2);
+    V[5] &= V[13];
+L24E: // 9450 SNE V4, V5
+    STEP(0x24E, 0x9450);
+    if (V[4] != V[5]) goto L252;
+L250: // 00EE RET
+    STEP(0x250, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L252: // 4403 SNE V4, 0x03
+    STEP(0x252, 0x4403);
+    if (V[4] != 0x03) goto L256;
+L254: // 00EE RET
+    STEP(0x254, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L256: // 6401 LD V4, 0x01
+    STEP(0x256, 0x6401);
+    V[4] = 0x01;
+L258: // 84E4 ADD V4, VE
+    STEP(0x258, 0x84E4);
+    V[15] = V[4] + V[14] > 0xFF;
+    V[4] += V[14];
+L25A: // 22A6 CALL 0x2A6
+    STEP(0x25A, 0x22A6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x25A;
+    goto L2A6;
+L25C: // 1246 JP 0x246
+    STEP(0x25C, 0x1246);
+    goto L246;
+L25E: // 6403 LD V4, 0x03
+    STEP(0x25E, 0x6403);
+    V[4] = 0x03;
+L260: // 84E2 AND V4, VE
+    STEP(0x260, 0x84E2);
+    V[4] &= V[14];
+L262: // 6503 LD V5, 0x03
+    STEP(0x262, 0x6503);
+    V[5] = 0x03;
+L264: // 85D2 AND V5, VD
+    STEP(0x264, 0x85D2);
+    V[5] &= V[13];
+L266: // 9450 SNE V4, V5
+    STEP(0x266, 0x9450);
+    if (V[4] != V[5]) goto L26A;
+L268: // 00EE RET
+    STEP(0x268, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L26A: // 4400 SNE V4, 0x00
+    STEP(0x26A, 0x4400);
+    if (V[4] != 0x00) goto L26E;
+L26C: // 00EE RET
+    STEP(0x26C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L26E: // 64FF LD V4, 0xFF
+    STEP(0x26E, 0x64FF);
+    V[4] = 0xFF;
+L270: // 84E4 ADD V4, VE
+    STEP(0x270, 0x84E4);
+    V[15] = V[4] + V[14] > 0xFF;
+    V[4] += V[14];
+L272: // 22A6 CALL 0x2A6
+    STEP(0x272, 0x22A6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x272;
+    goto L2A6;
+L274: // 125E JP 0x25E
+    STEP(0x274, 0x125E);
+    goto L25E;
+L276: // 640C LD V4, 0x0C
+    STEP(0x276, 0x640C);
+    V[4] = 0x0C;
+L278: // 84E2 AND V4, VE
+    STEP(0x278, 0x84E2);
+    V[4] &= V[14];
+L27A: // 650C LD V5, 0x0C
+    STEP(0x27A, 0x650C);
+    V[5] = 0x0C;
+L27C: // 85D2 AND V5, VD
+    STEP(0x27C, 0x85D2);
+    V[5] &= V[13];
+L27E: // 9450 SNE V4, V5
+    STEP(0x27E, 0x9450);
+    if (V[4] != V[5]) goto L282;
+L280: // 00EE RET
+    STEP(0x280, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L282: // 4400 SNE V4, 0x00
+    STEP(0x282, 0x4400);
+    if (V[4] != 0x00) goto L286;
+L284: // 00EE RET
+    STEP(0x284, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L286: // 64FC LD V4, 0xFC
+    STEP(0x286, 0x64FC);
+    V[4] = 0xFC;
+L288: // 84E4 ADD V4, VE
+    STEP(0x288, 0x84E4);
+    V[15] = V[4] + V[14] > 0xFF;
+    V[4] += V[14];
+L28A: // 22A6 CALL 0x2A6
+    STEP(0x28A, 0x22A6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x28A;
+    goto L2A6;
+L28C: // 1276 JP 0x276
+    STEP(0x28C, 0x1276);
+    goto L276;
+L28E: // 640C LD V4, 0x0C
+    STEP(0x28E, 0x640C);
+    V[4] = 0x0C;
+L290: // 84E2 AND V4, VE
+    STEP(0x290, 0x84E2);
+    V[4] &= V[14];
+L292: // 650C LD V5, 0x0C
+    STEP(0x292, 0x650C);
+    V[5] = 0x0C;
+L294: // 85D2 AND V5, VD
+    STEP(0x294, 0x85D2);
+    V[5] &= V[13];
+L296: // 9450 SNE V4, V5
+    STEP(0x296, 0x9450);
+    if (V[4] != V[5]) goto L29A;
+L298: // 00EE RET
+    STEP(0x298, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L29A: // 440C SNE V4, 0x0C
+    STEP(0x29A, 0x440C);
+    if (V[4] != 0x0C) goto L29E;
+L29C: // 00EE RET
+    STEP(0x29C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L29E: // 6404 LD V4, 0x04
+    STEP(0x29E, 0x6404);
+    V[4] = 0x04;
+L2A0: // 84E4 ADD V4, VE
+    STEP(0x2A0, 0x84E4);
+    V[15] = V[4] + V[14] > 0xFF;
+    V[4] += V[14];
+L2A2: // 22A6 CALL 0x2A6
+    STEP(0x2A2, 0x22A6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2A2;
+    goto L2A6;
+L2A4: // 128E JP 0x28E
+    STEP(0x2A4, 0x128E);
+    goto L28E;
+L2A6: // A2E8 LD I, 0x2E8
+    STEP(0x2A6, 0xA2E8);
+    c->I = 0x2E8;
+L2A8: // F41E ADD I, V4
+    STEP(0x2A8, 0xF41E);
+    c->I += V[4];
+L2AA: // F065 LD V0, [I]
+    STEP(0x2AA, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2AC: // A2E8 LD I, 0x2E8
+    STEP(0x2AC, 0xA2E8);
+    c->I = 0x2E8;
+L2AE: // FE1E ADD I, VE
+    STEP(0x2AE, 0xFE1E);
+    c->I += V[14];
+L2B0: // F055 LD [I], V0
+    STEP(0x2B0, 0xF055);
+    c->pc = 0x2B0;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2B2) goto dispatch;
+L2B2: // 6000 LD V0, 0x00
+    STEP(0x2B2, 0x6000);
+    V[0] = 0x00;
+L2B4: // A2E8 LD I, 0x2E8
+    STEP(0x2B4, 0xA2E8);
+    c->I = 0x2E8;
+L2B6: // F41E ADD I, V4
+    STEP(0x2B6, 0xF41E);
+    c->I += V[4];
+L2B8: // F055 LD [I], V0
+    STEP(0x2B8, 0xF055);
+    c->pc = 0x2B8;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2BA) goto dispatch;
+L2BA: // 8E40 LD VE, V4
+    STEP(0x2BA, 0x8E40);
+    V[14] = V[4];
+L2BC: // 00EE RET
+    STEP(0x2BC, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2BE: // 3C00 SE VC, 0x00
+    STEP(0x2BE, 0x3C00);
+    if (V[12] == 0x00) goto L2C2;
+L2C0: // 12D2 JP 0x2D2
+    STEP(0x2C0, 0x12D2);
+    goto L2D2;
+L2C2: // 221C CALL 0x21C
+    STEP(0x2C2, 0x221C);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2C2;
+    goto L21C;
+L2C4: // 22D8 CALL 0x2D8
+    STEP(0x2C4, 0x22D8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2C4;
+    goto L2D8;
+L2C6: // 221C CALL 0x21C
+    STEP(0x2C6, 0x221C);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2C6;
+    goto L21C;
+L2C8: // A2F8 LD I, 0x2F8
+    STEP(0x2C8, 0xA2F8);
+    c->I = 0x2F8;
+L2CA: // FD1E ADD I, VD
+    STEP(0x2CA, 0xFD1E);
+    c->I += V[13];
+L2CC: // F065 LD V0, [I]
+    STEP(0x2CC, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2CE: // 8D00 LD VD, V0
+    STEP(0x2CE, 0x8D00);
+    V[13] = V[0];
+L2D0: // 00EE RET
+    STEP(0x2D0, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2D2: // 7CFF ADD VC, 0xFF
+    STEP(0x2D2, 0x7CFF);
+    V[12] += 0xFF;
+L2D4: // CD0F RND VD, 0x0F
+    STEP(0x2D4, 0xCD0F);
+    c->pc = 0x2D4;
+    predecode(0xCD0F, &in);
+    execute(c, &in);
+    if (c->pc != 0x2D6) goto dispatch;
+L2D6: // 00EE RET
+    STEP(0x2D6, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2D8: // 7D01 ADD VD, 0x01
+    STEP(0x2D8, 0x7D01);
+    V[13] += 0x01;
+L2DA: // 600F LD V0, 0x0F
+    STEP(0x2DA, 0x600F);
+    V[0] = 0x0F;
+L2DC: // 8D02 AND VD, V0
+    STEP(0x2DC, 0x8D02);
+    V[13] &= V[0];
+L2DE: // ED9E SKP VD
+    STEP(0x2DE, 0xED9E);
+    c->pc = 0x2DE;
+    predecode(0xED9E, &in);
+    execute(c, &in);
+    if (c->pc != 0x2E0) goto dispatch;
+L2E0: // 12D8 JP 0x2D8
+    STEP(0x2E0, 0x12D8);
+    goto L2D8;
+L2E2: // EDA1 SKNP VD
+    STEP(0x2E2, 0xEDA1);
+    c->pc = 0x2E2;
+    predecode(0xEDA1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2E4) goto dispatch;
+L2E4: // 12E2 JP 0x2E2
+    STEP(0x2E4, 0x12E2);
+    goto L2E2;
+L2E6: // 00EE RET
+    STEP(0x2E6, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,870 @@
+// generated by chip8-aot from roms/AIRPLANE.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x6A, 0x00, 0x6B, 0x04, 0x6C, 0x01, 0x6D, 0x00, 0x6E, 0x02, 0x23, 0x26,
+    0x23, 0x20, 0x60, 0x30, 0x61, 0x01, 0xF0, 0x15, 0xF0, 0x07, 0xF1, 0x18,
+    0x30, 0x00, 0x12, 0x14, 0x22, 0x42, 0x23, 0x20, 0x7D, 0x01, 0x23, 0x20,
+    0x60, 0x08, 0xE0, 0xA1, 0x23, 0x0A, 0x4A, 0x00, 0x12, 0x3E, 0xA3, 0x62,
+    0xD8, 0x91, 0x79, 0x01, 0xD8, 0x91, 0x4F, 0x01, 0x12, 0xF4, 0x49, 0x18,
+    0x12, 0xE4, 0x22, 0xB2, 0x12, 0x1E, 0x4C, 0x01, 0x22, 0x6C, 0x4C, 0x02,
+    0x22, 0x7A, 0x4C, 0x03, 0x22, 0x88, 0x4C, 0x04, 0x22, 0x96, 0x4C, 0x05,
+    0x22, 0xA4, 0xA3, 0x59, 0xD6, 0x72, 0x44, 0x00, 0x00, 0xEE, 0xA3, 0x57,
+    0xD4, 0x52, 0x42, 0x00, 0x00, 0xEE, 0xA3, 0x5B, 0xD2, 0x32, 0x00, 0xEE,
+    0x66, 0x28, 0x67, 0x09, 0x64, 0x00, 0x65, 0x00, 0x62, 0x00, 0x63, 0x00,
+    0x00, 0xEE, 0x66, 0x28, 0x67, 0x0E, 0x64, 0x28, 0x65, 0x14, 0x62, 0x00,
+    0x63, 0x00, 0x00, 0xEE, 0x66, 0x28, 0x67, 0x07, 0x64, 0x28, 0x65, 0x0C,
+    0x62, 0x16, 0x63, 0x11, 0x00, 0xEE, 0x66, 0x28, 0x67, 0x07, 0x64, 0x28,
+    0x65, 0x0E, 0x62, 0x16, 0x63, 0x14, 0x00, 0xEE, 0x66, 0x28, 0x67, 0x05,
+    0x64, 0x28, 0x65, 0x10, 0x62, 0x16, 0x63, 0x0B, 0x00, 0xEE, 0xA3, 0x59,
+    0xD6, 0x72, 0x76, 0xFE, 0xD6, 0x72, 0x44, 0x00, 0x00, 0xEE, 0xA3, 0x57,
+    0xD4, 0x52, 0x74, 0x02, 0x44, 0x44, 0x74, 0xC0, 0xD4, 0x52, 0x42, 0x00,
+    0x00, 0xEE, 0xA3, 0x5B, 0xD2, 0x32, 0x72, 0x02, 0x4C, 0x04, 0x72, 0x02,
+    0x4C, 0x05, 0x72, 0x02, 0x42, 0x44, 0x72, 0xC0, 0xD2, 0x32, 0x00, 0xEE,
+    0x7C, 0x01, 0x6D, 0x00, 0x6E, 0x02, 0x00, 0xE0, 0x4C, 0x06, 0x6C, 0x01,
+    0x6A, 0x00, 0x12, 0x0A, 0x60, 0x06, 0xF0, 0x18, 0x7B, 0xFF, 0x4B, 0x00,
+    0x13, 0x08, 0x6D, 0x00, 0x6E, 0x02, 0x00, 0xE0, 0x6A, 0x00, 0x12, 0x0A,
+    0x13, 0x08, 0x4A, 0x01, 0x00, 0xEE, 0x60, 0x02, 0xF0, 0x18, 0x6A, 0x01,
+    0x88, 0xD0, 0x78, 0x01, 0x89, 0xE0, 0x79, 0x01, 0xD8, 0x91, 0x00, 0xEE,
+    0xA3, 0x54, 0xDD, 0xE2, 0x00, 0xEE, 0x64, 0x19, 0x63, 0x00, 0xA3, 0x56,
+    0xD3, 0x41, 0x73, 0x08, 0x33, 0x40, 0x13, 0x2C, 0x63, 0x1E, 0x64, 0x1B,
+    0xFC, 0x29, 0xD3, 0x45, 0x4B, 0x04, 0xA3, 0x5F, 0x4B, 0x03, 0xA3, 0x60,
+    0x4B, 0x02, 0xA3, 0x61, 0x4B, 0x01, 0xA3, 0x62, 0x63, 0x01, 0x74, 0x02,
+    0xD3, 0x41, 0x00, 0xEE, 0x80, 0xF8, 0xFF, 0x80, 0xE0, 0x10, 0x70, 0x88,
+    0xEE, 0x11, 0x77, 0xAA, 0xA8, 0xA0, 0x80, 0x00,
+};
+const size_t aot_rom_size = 356;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000003F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+        case 0x2FE: goto L2FE;
+        case 0x300: goto L300;
+        case 0x302: goto L302;
+        case 0x304: goto L304;
+        case 0x306: goto L306;
+        case 0x308: goto L308;
+        case 0x30A: goto L30A;
+        case 0x30C: goto L30C;
+        case 0x30E: goto L30E;
+        case 0x310: goto L310;
+        case 0x312: goto L312;
+        case 0x314: goto L314;
+        case 0x316: goto L316;
+        case 0x318: goto L318;
+        case 0x31A: goto L31A;
+        case 0x31C: goto L31C;
+        case 0x31E: goto L31E;
+        case 0x320: goto L320;
+        case 0x322: goto L322;
+        case 0x324: goto L324;
+        case 0x326: goto L326;
+        case 0x328: goto L328;
+        case 0x32A: goto L32A;
+        case 0x32C: goto L32C;
+        case 0x32E: goto L32E;
+        case 0x330: goto L330;
+        case 0x332: goto L332;
+        case 0x334: goto L334;
+        case 0x336: goto L336;
+        case 0x338: goto L338;
+        case 0x33A: goto L33A;
+        case 0x33C: goto L33C;
+        case 0x33E: goto L33E;
+        case 0x340: goto L340;
+        case 0x342: goto L342;
+        case 0x344: goto L344;
+        case 0x346: goto L346;
+        case 0x348: goto L348;
+        case 0x34A: goto L34A;
+        case 0x34C: goto L34C;
+        case 0x34E: goto L34E;
+        case 0x350: goto L350;
+        case 0x352: goto L352;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 6A00 LD VA, 0x00
+    STEP(0x200, 0x6A00);
+    V[10] = 0x00;
+L202: // 6B04 LD VB, 0x04
+    STEP(0x202, 0x6B04);
+    V[11] = 0x04;
+L204: // 6C01 LD VC, 0x01
+    STEP(0x204, 0x6C01);
+    V[12] = 0x01;
+L206: // 6D00 LD VD, 0x00
+    STEP(0x206, 0x6D00);
+    V[13] = 0x00;
+L208: // 6E02 LD VE, 0x02
+    STEP(0x208, 0x6E02);
+    V[14] = 0x02;
+L20A: // 2326 CALL 0x326
+    STEP(0x20A, 0x2326);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x20A;
+    goto L326;
+L20C: // 2320 CALL 0x320
+    STEP(0x20C, 0x2320);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x20C;
+    goto L320;
+L20E: // 6030 LD V0, 0x30
+    STEP(0x20E, 0x6030);
+    V[0] = 0x30;
+L210: // 6101 LD V1, 0x01
+    STEP(0x210, 0x6101);
+    V[1] = 0x01;
+L212: // F015 LD DT, V0
+    STEP(0x212, 0xF015);
+    c->dt = V[0];
+L214: // F007 LD V0, DT
+    STEP(0x214, 0xF007);
+    V[0] = c->dt;
+L216: // F118 LD ST, V1
+    STEP(0x216, 0xF118);
+    c->st = V[1];
+L218: // 3000 SE V0, 0x00
+    STEP(0x218, 0x3000);
+    if (V[0] == 0x00) goto L21C;
+L21A: // 1214 JP 0x214
+    STEP(0x21A, 0x1214);
+    goto L214;
+L21C: // 2242 CALL 0x242
+    STEP(0x21C, 0x2242);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x21C;
+    goto L242;
+L21E: // 2320 CALL 0x320
+    STEP(0x21E, 0x2320);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x21E;
+    goto L320;
+L220: // 7D01 ADD VD, 0x01
+    STEP(0x220, 0x7D01);
+    V[13] += 0x01;
+L222: // 2320 CALL 0x320
+    STEP(0x222, 0x2320);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x222;
+    goto L320;
+L224: // 6008 LD V0, 0x08
+    STEP(0x224, 0x6008);
+    V[0] = 0x08;
+L226: // E0A1 SKNP V0
+    STEP(0x226, 0xE0A1);
+    c->pc = 0x226;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x228) goto dispatch;
+L228: // 230A CALL 0x30A
+    STEP(0x228, 0x230A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x228;
+    goto L30A;
+L22A: // 4A00 SNE VA, 0x00
+    STEP(0x22A, 0x4A00);
+    if (V[10] != 0x00) goto L22E;
+L22C: // 123E JP 0x23E
+    STEP(0x22C, 0x123E);
+    goto L23E;
+L22E: // A362 LD I, 0x362
+    STEP(0x22E, 0xA362);
+    c->I = 0x362;
+L230: // D891 DRW V8, V9, 1
+    STEP(0x230, 0xD891);
+    c->pc = 0x230;
+    predecode(0xD891, &in);
+    execute(c, &in);
+    if (c->pc != 0x232) goto dispatch;
+L232: // 7901 ADD V9, 0x01
+    STEP(0x232, 0x7901);
+    V[9] += 0x01;
+L234: // D891 DRW V8, V9, 1
+    STEP(0x234, 0xD891);
+    c->pc = 0x234;
+    predecode(0xD891, &in);
+    execute(c, &in);
+    if (c->pc != 0x236) goto dispatch;
+L236: // 4F01 SNE VF, 0x01
+    STEP(0x236, 0x4F01);
+    if (V[15] != 0x01) goto L23A;
+L238: // 12F4 JP 0x2F4
+    STEP(0x238, 0x12F4);
+    goto L2F4;
+L23A: // 4918 SNE V9, 0x18
+    STEP(0x23A, 0x4918);
+    if (V[9] != 0x18) goto L23E;
+L23C: // 12E4 JP 0x2E4
+    STEP(0x23C, 0x12E4);
+    goto L2E4;
+L23E: // 22B2 CALL 0x2B2
+    STEP(0x23E, 0x22B2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x23E;
+    goto L2B2;
+L240: // 121E JP 0x21E
+    STEP(0x240, 0x121E);
+    goto L21E;
+L242: // 4C01 SNE VC, 0x01
+    STEP(0x242, 0x4C01);
+    if (V[12] != 0x01) goto L246;
+L244: // 226C CALL 0x26C
+    STEP(0x244, 0x226C);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x244;
+    goto L26C;
+L246: // 4C02 SNE VC, 0x02
+    STEP(0x246, 0x4C02);
+    if (V[12] != 0x02) goto L24A;
+L248: // 227A CALL 0x27A
+    STEP(0x248, 0x227A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x248;
+    goto L27A;
+L24A: // 4C03 SNE VC, 0x03
+    STEP(0x24A, 0x4C03);
+    if (V[12] != 0x03) goto L24E;
+L24C: // 2288 CALL 0x288
+    STEP(0x24C, 0x2288);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x24C;
+    goto L288;
+L24E: // 4C04 SNE VC, 0x04
+    STEP(0x24E, 0x4C04);
+    if (V[12] != 0x04) goto L252;
+L250: // 2296 CALL 0x296
+    STEP(0x250, 0x2296);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x250;
+    goto L296;
+L252: // 4C05 SNE VC, 0x05
+    STEP(0x252, 0x4C05);
+    if (V[12] != 0x05) goto L256;
+L254: // 22A4 CALL 0x2A4
+    STEP(0x254, 0x22A4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x254;
+    goto L2A4;
+L256: // A359 LD I, 0x359
+    STEP(0x256, 0xA359);
+    c->I = 0x359;
+L258: // D672 DRW V6, V7, 2
+    STEP(0x258, 0xD672);
+    c->pc = 0x258;
+    predecode(0xD672, &in);
+    execute(c, &in);
+    if (c->pc != 0x25A) goto dispatch;
+L25A: // 4400 SNE V4, 0x00
+    STEP(0x25A, 0x4400);
+    if (V[4] != 0x00) goto L25E;
+L25C: // 00EE RET
+    STEP(0x25C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L25E: // A357 LD I, 0x357
+    STEP(0x25E, 0xA357);
+    c->I = 0x357;
+L260: // D452 DRW V4, V5, 2
+    STEP(0x260, 0xD452);
+    c->pc = 0x260;
+    predecode(0xD452, &in);
+    execute(c, &in);
+    if (c->pc != 0x262) goto dispatch;
+L262: // 4200 SNE V2, 0x00
+    STEP(0x262, 0x4200);
+    if (V[2] != 0x00) goto L266;
+L264: // 00EE RET
+    STEP(0x264, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L266: // A35B LD I, 0x35B
+    STEP(0x266, 0xA35B);
+    c->I = 0x35B;
+L268: // D232 DRW V2, V3, 2
+    STEP(0x268, 0xD232);
+    c->pc = 0x268;
+    predecode(0xD232, &in);
+    execute(c, &in);
+    if (c->pc != 0x26A) goto dispatch;
+L26A: // 00EE RET
+    STEP(0x26A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L26C: // 6628 LD V6, 0x28
+    STEP(0x26C, 0x6628);
+    V[6] = 0x28;
+L26E: // 6709 LD V7, 0x09
+    STEP(0x26E, 0x6709);
+    V[7] = 0x09;
+L270: // 6400 LD V4, 0x00
+    STEP(0x270, 0x6400);
+    V[4] = 0x00;
+L272: // 6500 LD V5, 0x00
+    STEP(0x272, 0x6500);
+    V[5] = 0x00;
+L274: // 6200 LD V2, 0x00
+    STEP(0x274, 0x6200);
+    V[2] = 0x00;
+L276: // 6300 LD V3, 0x00
+    STEP(0x276, 0x6300);
+    V[3] = 0x00;
+L278: // 00EE RET
+    STEP(0x278, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L27A: // 6628 LD V6, 0x28
+    STEP(0x27A, 0x6628);
+    V[6] = 0x28;
+L27C: // 670E LD V7, 0x0E
+    STEP(0x27C, 0x670E);
+    V[7] = 0x0E;
+L27E: // 6428 LD V4, 0x28
+    STEP(0x27E, 0x6428);
+    V[4] = 0x28;
+L280: // 6514 LD V5, 0x14
+    STEP(0x280, 0x6514);
+    V[5] = 0x14;
+L282: // 6200 LD V2, 0x00
+    STEP(0x282, 0x6200);
+    V[2] = 0x00;
+L284: // 6300 LD V3, 0x00
+    STEP(0x284, 0x6300);
+    V[3] = 0x00;
+L286: // 00EE RET
+    STEP(0x286, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L288: // 6628 LD V6, 0x28
+    STEP(0x288, 0x6628);
+    V[6] = 0x28;
+L28A: // 6707 LD V7, 0x07
+    STEP(0x28A, 0x6707);
+    V[7] = 0x07;
+L28C: // 6428 LD V4, 0x28
+    STEP(0x28C, 0x6428);
+    V[4] = 0x28;
+L28E: // 650C LD V5, 0x0C
+    STEP(0x28E, 0x650C);
+    V[5] = 0x0C;
+L290: // 6216 LD V2, 0x16
+    STEP(0x290, 0x6216);
+    V[2] = 0x16;
+L292: // 6311 LD V3, 0x11
+    STEP(0x292, 0x6311);
+    V[3] = 0x11;
+L294: // 00EE RET
+    STEP(0x294, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L296: // 6628 LD V6, 0x28
+    STEP(0x296, 0x6628);
+    V[6] = 0x28;
+L298: // 6707 LD V7, 0x07
+    STEP(0x298, 0x6707);
+    V[7] = 0x07;
+L29A: // 6428 LD V4, 0x28
+    STEP(0x29A, 0x6428);
+    V[4] = 0x28;
+L29C: // 650E LD V5, 0x0E
+    STEP(0x29C, 0x650E);
+    V[5] = 0x0E;
+L29E: // 6216 LD V2, 0x16
+    STEP(0x29E, 0x6216);
+    V[2] = 0x16;
+L2A0: // 6314 LD V3, 0x14
+    STEP(0x2A0, 0x6314);
+    V[3] = 0x14;
+L2A2: // 00EE RET
+    STEP(0x2A2, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2A4: // 6628 LD V6, 0x28
+    STEP(0x2A4, 0x6628);
+    V[6] = 0x28;
+L2A6: // 6705 LD V7, 0x05
+    STEP(0x2A6, 0x6705);
+    V[7] = 0x05;
+L2A8: // 6428 LD V4, 0x28
+    STEP(0x2A8, 0x6428);
+    V[4] = 0x28;
+L2AA: // 6510 LD V5, 0x10
+    STEP(0x2AA, 0x6510);
+    V[5] = 0x10;
+L2AC: // 6216 LD V2, 0x16
+    STEP(0x2AC, 0x6216);
+    V[2] = 0x16;
+L2AE: // 630B LD V3, 0x0B
+    STEP(0x2AE, 0x630B);
+    V[3] = 0x0B;
+L2B0: // 00EE RET
+    STEP(0x2B0, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2B2: // A359 LD I, 0x359
+    STEP(0x2B2, 0xA359);
+    c->I = 0x359;
+L2B4: // D672 DRW V6, V7, 2
+    STEP(0x2B4, 0xD672);
+    c->pc = 0x2B4;
+    predecode(0xD672, &in);
+    execute(c, &in);
+    if (c->pc != 0x2B6) goto dispatch;
+L2B6: // 76FE ADD V6, 0xFE
+    STEP(0x2B6, 0x76FE);
+    V[6] += 0xFE;
+L2B8: // D672 DRW V6, V7, 2
+    STEP(0x2B8, 0xD672);
+    c->pc = 0x2B8;
+    predecode(0xD672, &in);
+    execute(c, &in);
+    if (c->pc != 0x2BA) goto dispatch;
+L2BA: // 4400 SNE V4, 0x00
+    STEP(0x2BA, 0x4400);
+    if (V[4] != 0x00) goto L2BE;
+L2BC: // 00EE RET
+    STEP(0x2BC, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2BE: // A357 LD I, 0x357
+    STEP(0x2BE, 0xA357);
+    c->I = 0x357;
+L2C0: // D452 DRW V4, V5, 2
+    STEP(0x2C0, 0xD452);
+    c->pc = 0x2C0;
+    predecode(0xD452, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C2) goto dispatch;
+L2C2: // 7402 ADD V4, 0x02
+    STEP(0x2C2, 0x7402);
+    V[4] += 0x02;
+L2C4: // 4444 SNE V4, 0x44
+    STEP(0x2C4, 0x4444);
+    if (V[4] != 0x44) goto L2C8;
+L2C6: // 74C0 ADD V4, 0xC0
+    STEP(0x2C6, 0x74C0);
+    V[4] += 0xC0;
+L2C8: // D452 DRW V4, V5, 2
+    STEP(0x2C8, 0xD452);
+    c->pc = 0x2C8;
+    predecode(0xD452, &in);
+    execute(c, &in);
+    if (c->pc != 0x2CA) goto dispatch;
+L2CA: // 4200 SNE V2, 0x00
+    STEP(0x2CA, 0x4200);
+    if (V[2] != 0x00) goto L2CE;
+L2CC: // 00EE RET
+    STEP(0x2CC, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2CE: // A35B LD I, 0x35B
+    STEP(0x2CE, 0xA35B);
+    c->I = 0x35B;
+L2D0: // D232 DRW V2, V3, 2
+    STEP(0x2D0, 0xD232);
+    c->pc = 0x2D0;
+    predecode(0xD232, &in);
+    execute(c, &in);
+    if (c->pc != 0x2D2) goto dispatch;
+L2D2: // 7202 ADD V2, 0x02
+    STEP(0x2D2, 0x7202);
+    V[2] += 0x02;
+L2D4: // 4C04 SNE VC, 0x04
+    STEP(0x2D4, 0x4C04);
+    if (V[12] != 0x04) goto L2D8;
+L2D6: // 7202 ADD V2, 0x02
+    STEP(0x2D6, 0x7202);
+    V[2] += 0x02;
+L2D8: // 4C05 SNE VC, 0x05
+    STEP(0x2D8, 0x4C05);
+    if (V[12] != 0x05) goto L2DC;
+L2DA: // 7202 ADD V2, 0x02
+    STEP(0x2DA, 0x7202);
+    V[2] += 0x02;
+L2DC: // 4244 SNE V2, 0x44
+    STEP(0x2DC, 0x4244);
+    if (V[2] != 0x44) goto L2E0;
+L2DE: // 72C0 ADD V2, 0xC0
+    STEP(0x2DE, 0x72C0);
+    V[2] += 0xC0;
+L2E0: // D232 DRW V2, V3, 2
+    STEP(0x2E0, 0xD232);
+    c->pc = 0x2E0;
+    predecode(0xD232, &in);
+    execute(c, &in);
+    if (c->pc != 0x2E2) goto dispatch;
+L2E2: // 00EE RET
+    STEP(0x2E2, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2E4: // 7C01 ADD VC, 0x01
+    STEP(0x2E4, 0x7C01);
+    V[12] += 0x01;
+L2E6: // 6D00 LD VD, 0x00
+    STEP(0x2E6, 0x6D00);
+    V[13] = 0x00;
+L2E8: // 6E02 LD VE, 0x02
+    STEP(0x2E8, 0x6E02);
+    V[14] = 0x02;
+L2EA: // 00E0 CLS
+    STEP(0x2EA, 0x00E0);
+    c->pc = 0x2EA;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x2EC) goto dispatch;
+L2EC: // 4C06 SNE VC, 0x06
+    STEP(0x2EC, 0x4C06);
+    if (V[12] != 0x06) goto L2F0;
+L2EE: // 6C01 LD VC, 0x01
+    STEP(0x2EE, 0x6C01);
+    V[12] = 0x01;
+L2F0: // 6A00 LD VA, 0x00
+    STEP(0x2F0, 0x6A00);
+    V[10] = 0x00;
+L2F2: // 120A JP 0x20A
+    STEP(0x2F2, 0x120A);
+    goto L20A;
+L2F4: // 6006 LD V0, 0x06
+    STEP(0x2F4, 0x6006);
+    V[0] = 0x06;
+L2F6: // F018 LD ST, V0
+    STEP(0x2F6, 0xF018);
+    c->st = V[0];
+L2F8: // 7BFF ADD VB, 0xFF
+    STEP(0x2F8, 0x7BFF);
+    V[11] += 0xFF;
+L2FA: // 4B00 SNE VB, 0x00
+    STEP(0x2FA, 0x4B00);
+    if (V[11] != 0x00) goto L2FE;
+L2FC: // 1308 JP 0x308
+    STEP(0x2FC, 0x1308);
+    goto L308;
+L2FE: // 6D00 LD VD, 0x00
+    STEP(0x2FE, 0x6D00);
+    V[13] = 0x00;
+L300: // 6E02 LD VE, 0x02
+    STEP(0x300, 0x6E02);
+    V[14] = 0x02;
+L302: // 00E0 CLS
+    STEP(0x302, 0x00E0);
+    c->pc = 0x302;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x304) goto dispatch;
+L304: // 6A00 LD VA, 0x00
+    STEP(0x304, 0x6A00);
+    V[10] = 0x00;
+L306: // 120A JP 0x20A
+    STEP(0x306, 0x120A);
+    goto L20A;
+L308: // 1308 JP 0x308
+    STEP(0x308, 0x1308);
+    goto L308;
+L30A: // 4A01 SNE VA, 0x01
+    STEP(0x30A, 0x4A01);
+    if (V[10] != 0x01) goto L30E;
+L30C: // 00EE RET
+    STEP(0x30C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L30E: // 6002 LD V0, 0x02
+    STEP(0x30E, 0x6002);
+    V[0] = 0x02;
+L310: // F018 LD ST, V0
+    STEP(0x310, 0xF018);
+    c->st = V[0];
+L312: // 6A01 LD VA, 0x01
+    STEP(0x312, 0x6A01);
+    V[10] = 0x01;
+L314: // 88D0 LD V8, VD
+    STEP(0x314, 0x88D0);
+    V[8] = V[13];
+L316: // 7801 ADD V8, 0x01
+    STEP(0x316, 0x7801);
+    V[8] += 0x01;
+L318: // 89E0 LD V9, VE
+    STEP(0x318, 0x89E0);
+    V[9] = V[14];
+L31A: // 7901 ADD V9, 0x01
+    STEP(0x31A, 0x7901);
+    V[9] += 0x01;
+L31C: // D891 DRW V8, V9, 1
+    STEP(0x31C, 0xD891);
+    c->pc = 0x31C;
+    predecode(0xD891, &in);
+    execute(c, &in);
+    if (c->pc != 0x31E) goto dispatch;
+L31E: // 00EE RET
+    STEP(0x31E, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L320: // A354 LD I, 0x354
+    STEP(0x320, 0xA354);
+    c->I = 0x354;
+L322: // DDE2 DRW VD, VE, 2
+    STEP(0x322, 0xDDE2);
+    c->pc = 0x322;
+    predecode(0xDDE2, &in);
+    execute(c, &in);
+    if (c->pc != 0x324) goto dispatch;
+L324: // 00EE RET
+    STEP(0x324, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L326: // 6419 LD V4, 0x19
+    STEP(0x326, 0x6419);
+    V[4] = 0x19;
+L328: // 6300 LD V3, 0x00
+    STEP(0x328, 0x6300);
+    V[3] = 0x00;
+L32A: // A356 LD I, 0x356
+    STEP(0x32A, 0xA356);
+    c->I = 0x356;
+L32C: // D341 DRW V3, V4, 1
+    STEP(0x32C, 0xD341);
+    c->pc = 0x32C;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x32E) goto dispatch;
+L32E: // 7308 ADD V3, 0x08
+    STEP(0x32E, 0x7308);
+    V[3] += 0x08;
+L330: // 3340 SE V3, 0x40
+    STEP(0x330, 0x3340);
+    if (V[3] == 0x40) goto L334;
+L332: // 132C JP 0x32C
+    STEP(0x332, 0x132C);
+    goto L32C;
+L334: // 631E LD V3, 0x1E
+    STEP(0x334, 0x631E);
+    V[3] = 0x1E;
+L336: // 641B LD V4, 0x1B
+    STEP(0x336, 0x641B);
+    V[4] = 0x1B;
+L338: // FC29 LD F, VC
+    STEP(0x338, 0xFC29);
+    c->I = V[12] * 5;
+L33A: // D345 DRW V3, V4, 5
+    STEP(0x33A, 0xD345);
+    c->pc = 0x33A;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x33C) goto dispatch;
+L33C: // 4B04 SNE VB, 0x04
+    STEP(0x33C, 0x4B04);
+    if (V[11] != 0x04) goto L340;
+L33E: // A35F LD I, 0x35F
+    STEP(0x33E, 0xA35F);
+    c->I = 0x35F;
+L340: // 4B03 SNE VB, 0x03
+    STEP(0x340, 0x4B03);
+    if (V[11] != 0x03) goto L344;
+L342: // A360 LD I, 0x360
+    STEP(0x342, 0xA360);
+    c->I = 0x360;
+L344: // 4B02 SNE VB, 0x02
+    STEP(0x344, 0x4B02);
+    if (V[11] != 0x02) goto L348;
+L346: // A361 LD I, 0x361
+    STEP(0x346, 0xA361);
+    c->I = 0x361;
+L348: // 4B01 SNE VB, 0x01
+    STEP(0x348, 0x4B01);
+    if (V[11] != 0x01) goto L34C;
+L34A: // A362 LD I, 0x362
+    STEP(0x34A, 0xA362);
+    c->I = 0x362;
+L34C: // 6301 LD V3, 0x01
+    STEP(0x34C, 0x6301);
+    V[3] = 0x01;
+L34E: // 7402 ADD V4, 0x02
+    STEP(0x34E, 0x7402);
+    V[4] += 0x02;
+L350: // D341 DRW V3, V4, 1
+    STEP(0x350, 0xD341);
+    c->pc = 0x350;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x352) goto dispatch;
+L352: // 00EE RET
+    STEP(0x352, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,4113 @@
+// generated by chip8-aot from roms/BLINKY.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x12, 0x1A, 0x32, 0x2E, 0x30, 0x30, 0x20, 0x43, 0x2E, 0x20, 0x45, 0x67,
+    0x65, 0x62, 0x65, 0x72, 0x67, 0x20, 0x31, 0x38, 0x2F, 0x38, 0x2D, 0x27,
+    0x39, 0x31, 0x80, 0x03, 0x81, 0x13, 0xA8, 0xC8, 0xF1, 0x55, 0x60, 0x05,
+    0xA8, 0xCC, 0xF0, 0x55, 0x87, 0x73, 0x86, 0x63, 0x27, 0x72, 0x00, 0xE0,
+    0x27, 0x94, 0x6E, 0x40, 0x87, 0xE2, 0x6E, 0x27, 0x87, 0xE1, 0x68, 0x1A,
+    0x69, 0x0C, 0x6A, 0x38, 0x6B, 0x00, 0x6C, 0x02, 0x6D, 0x1A, 0x27, 0x50,
+    0xA8, 0xED, 0xDA, 0xB4, 0xDC, 0xD4, 0x23, 0xD0, 0x3E, 0x00, 0x12, 0x7C,
+    0xA8, 0xCC, 0xF0, 0x65, 0x85, 0x00, 0xC4, 0xFF, 0x84, 0x52, 0x24, 0xF6,
+    0xC4, 0xFF, 0x84, 0x52, 0x26, 0x1E, 0x60, 0x01, 0xE0, 0xA1, 0x27, 0xD6,
+    0x36, 0xF7, 0x12, 0x4E, 0x8E, 0x60, 0x28, 0x7A, 0x6E, 0x64, 0x28, 0x7A,
+    0x27, 0xD6, 0x12, 0x2A, 0xF0, 0x07, 0x40, 0x00, 0x13, 0x10, 0x80, 0x80,
+    0x80, 0x06, 0x81, 0xA0, 0x81, 0x06, 0x80, 0x15, 0x40, 0x00, 0x12, 0x9A,
+    0x40, 0x01, 0x12, 0x9A, 0x40, 0xFF, 0x12, 0x9A, 0x12, 0xC8, 0x80, 0x90,
+    0x80, 0x06, 0x81, 0xB0, 0x81, 0x06, 0x80, 0x15, 0x40, 0x00, 0x12, 0xB2,
+    0x40, 0x01, 0x12, 0xB2, 0x40, 0xFF, 0x12, 0xB2, 0x12, 0xC8, 0xA8, 0xED,
+    0xDA, 0xB4, 0x6A, 0x38, 0x6B, 0x00, 0xDA, 0xB4, 0x6E, 0xF3, 0x87, 0xE2,
+    0x6E, 0x04, 0x87, 0xE1, 0x6E, 0x32, 0x28, 0x7A, 0x80, 0x80, 0x80, 0x06,
+    0x81, 0xC0, 0x81, 0x06, 0x80, 0x15, 0x40, 0x00, 0x12, 0xE0, 0x40, 0x01,
+    0x12, 0xE0, 0x40, 0xFF, 0x12, 0xE0, 0x12, 0x54, 0x80, 0x90, 0x80, 0x06,
+    0x81, 0xD0, 0x81, 0x06, 0x80, 0x15, 0x40, 0x00, 0x12, 0xF8, 0x40, 0x01,
+    0x12, 0xF8, 0x40, 0xFF, 0x12, 0xF8, 0x12, 0x54, 0xA8, 0xED, 0xDC, 0xD4,
+    0x6C, 0x02, 0x6D, 0x1A, 0xDC, 0xD4, 0x6E, 0xCF, 0x87, 0xE2, 0x6E, 0x20,
+    0x87, 0xE1, 0x6E, 0x19, 0x28, 0x7A, 0x12, 0x54, 0x60, 0x3F, 0x28, 0xA8,
+    0x27, 0x50, 0xA8, 0xED, 0xDA, 0xB4, 0xDC, 0xD4, 0x6E, 0x40, 0x87, 0xE3,
+    0x80, 0x70, 0x80, 0xE2, 0x30, 0x00, 0x12, 0x32, 0x8E, 0x60, 0x28, 0x7A,
+    0x28, 0x8A, 0x00, 0xE0, 0x66, 0x11, 0x67, 0x0A, 0xA8, 0xCA, 0x27, 0xE6,
+    0x66, 0x11, 0x67, 0x10, 0xA8, 0xC8, 0x27, 0xE6, 0x64, 0x00, 0x65, 0x08,
+    0x66, 0x00, 0x67, 0x0F, 0xAB, 0x19, 0xD4, 0x69, 0xAB, 0x22, 0xD5, 0x69,
+    0x60, 0x03, 0x28, 0xA8, 0x3E, 0x00, 0x13, 0xC6, 0xAB, 0x19, 0xD4, 0x69,
+    0xAB, 0x22, 0xD5, 0x69, 0x74, 0x02, 0x75, 0x02, 0x34, 0x30, 0x13, 0x48,
+    0xAB, 0x19, 0xD4, 0x69, 0xAB, 0x22, 0xD5, 0x69, 0x60, 0x03, 0x28, 0xA8,
+    0x3E, 0x00, 0x13, 0xC6, 0xAB, 0x19, 0xD4, 0x69, 0xAB, 0x22, 0xD5, 0x69,
+    0x76, 0x02, 0x36, 0x16, 0x13, 0x68, 0xAB, 0x19, 0xD4, 0x69, 0xAB, 0x22,
+    0xD5, 0x69, 0x60, 0x03, 0x28, 0xA8, 0x3E, 0x00, 0x13, 0xC6, 0xAB, 0x19,
+    0xD4, 0x69, 0xAB, 0x22, 0xD5, 0x69, 0x74, 0xFE, 0x75, 0xFE, 0x34, 0x00,
+    0x13, 0x86, 0xAB, 0x19, 0xD4, 0x69, 0xAB, 0x22, 0xD5, 0x69, 0x60, 0x03,
+    0x28, 0xA8, 0x3E, 0x00, 0x13, 0xC6, 0xAB, 0x19, 0xD4, 0x69, 0xAB, 0x22,
+    0xD5, 0x69, 0x76, 0xFE, 0x36, 0x00, 0x13, 0xA6, 0x13, 0x48, 0xAB, 0x22,
+    0xD5, 0x69, 0xAB, 0x2B, 0xD5, 0x69, 0x12, 0x1A, 0x83, 0x70, 0x6E, 0x03,
+    0x83, 0xE2, 0x84, 0x80, 0x85, 0x90, 0x6E, 0x06, 0xEE, 0xA1, 0x14, 0x32,
+    0x6E, 0x03, 0xEE, 0xA1, 0x14, 0x4A, 0x6E, 0x08, 0xEE, 0xA1, 0x14, 0x62,
+    0x6E, 0x07, 0xEE, 0xA1, 0x14, 0x7A, 0x43, 0x03, 0x75, 0x02, 0x43, 0x00,
+    0x75, 0xFE, 0x43, 0x02, 0x74, 0x02, 0x43, 0x01, 0x74, 0xFE, 0x80, 0x40,
+    0x81, 0x50, 0x27, 0xBA, 0x82, 0x00, 0x6E, 0x08, 0x80, 0xE2, 0x30, 0x00,
+    0x14, 0x92, 0x6E, 0x07, 0x80, 0x20, 0x82, 0xE2, 0x42, 0x05, 0x14, 0x9A,
+    0x42, 0x06, 0x14, 0xB2, 0x42, 0x07, 0x14, 0xEC, 0x27, 0x50, 0x6E, 0xFC,
+    0x87, 0xE2, 0x87, 0x31, 0x88, 0x40, 0x89, 0x50, 0x17, 0x50, 0x80, 0x40,
+    0x81, 0x50, 0x71, 0x02, 0x27, 0xBA, 0x82, 0x00, 0x6E, 0x08, 0x80, 0xE2,
+    0x30, 0x00, 0x13, 0xF2, 0x63, 0x03, 0x75, 0x02, 0x14, 0x0E, 0x80, 0x40,
+    0x81, 0x50, 0x71, 0xFE, 0x27, 0xBA, 0x82, 0x00, 0x6E, 0x08, 0x80, 0xE2,
+    0x30, 0x00, 0x13, 0xF2, 0x63, 0x00, 0x75, 0xFE, 0x14, 0x0E, 0x80, 0x40,
+    0x81, 0x50, 0x70, 0x02, 0x27, 0xBA, 0x82, 0x00, 0x6E, 0x08, 0x80, 0xE2,
+    0x30, 0x00, 0x13, 0xF2, 0x63, 0x02, 0x74, 0x02, 0x14, 0x0E, 0x80, 0x40,
+    0x81, 0x50, 0x70, 0xFE, 0x27, 0xBA, 0x82, 0x00, 0x6E, 0x08, 0x80, 0xE2,
+    0x30, 0x00, 0x13, 0xF2, 0x63, 0x01, 0x74, 0xFE, 0x14, 0x0E, 0x27, 0x50,
+    0xD8, 0x94, 0x8E, 0xF0, 0x00, 0xEE, 0x6E, 0xF0, 0x80, 0xE2, 0x80, 0x31,
+    0xF0, 0x55, 0xA8, 0xF1, 0xD4, 0x54, 0x76, 0x01, 0x61, 0x05, 0xF0, 0x07,
+    0x40, 0x00, 0xF1, 0x18, 0x14, 0x24, 0x6E, 0xF0, 0x80, 0xE2, 0x80, 0x31,
+    0xF0, 0x55, 0xA8, 0xF5, 0xD4, 0x54, 0x76, 0x04, 0x80, 0xA0, 0x81, 0xB0,
+    0x27, 0xBA, 0x6E, 0xF0, 0x80, 0xE2, 0x30, 0x00, 0x14, 0xD2, 0x6E, 0x0C,
+    0x87, 0xE3, 0x80, 0xC0, 0x81, 0xD0, 0x27, 0xBA, 0x6E, 0xF0, 0x80, 0xE2,
+    0x30, 0x00, 0x14, 0xE4, 0x6E, 0x30, 0x87, 0xE3, 0x60, 0xFF, 0xF0, 0x18,
+    0xF0, 0x15, 0x14, 0x24, 0x43, 0x01, 0x64, 0x3A, 0x43, 0x02, 0x64, 0x00,
+    0x14, 0x24, 0x82, 0x70, 0x83, 0x70, 0x6E, 0x0C, 0x82, 0xE2, 0x80, 0xA0,
+    0x81, 0xB0, 0x27, 0xBA, 0xA8, 0xED, 0x6E, 0xF0, 0x80, 0xE2, 0x30, 0x00,
+    0x15, 0x24, 0xDA, 0xB4, 0x42, 0x0C, 0x7B, 0x02, 0x42, 0x00, 0x7B, 0xFE,
+    0x42, 0x08, 0x7A, 0x02, 0x42, 0x04, 0x7A, 0xFE, 0xDA, 0xB4, 0x00, 0xEE,
+    0x6E, 0x80, 0xF1, 0x07, 0x31, 0x00, 0x15, 0xD4, 0x34, 0x00, 0x15, 0xD4,
+    0x81, 0x00, 0x83, 0x0E, 0x3F, 0x00, 0x15, 0x56, 0x83, 0x90, 0x83, 0xB5,
+    0x4F, 0x00, 0x15, 0x8C, 0x33, 0x00, 0x15, 0x74, 0x87, 0xE3, 0x83, 0x80,
+    0x83, 0xA5, 0x4F, 0x00, 0x15, 0xBC, 0x33, 0x00, 0x15, 0xA4, 0x87, 0xE3,
+    0x15, 0xD4, 0x83, 0x80, 0x83, 0xA5, 0x4F, 0x00, 0x15, 0xBC, 0x33, 0x00,
+    0x15, 0xA4, 0x87, 0xE3, 0x83, 0x90, 0x83, 0xB5, 0x4F, 0x00, 0x15, 0x8C,
+    0x33, 0x00, 0x15, 0x74, 0x87, 0xE3, 0x15, 0xD4, 0x63, 0x40, 0x81, 0x32,
+    0x41, 0x00, 0x15, 0xD4, 0xDA, 0xB4, 0x7B, 0x02, 0xDA, 0xB4, 0x6E, 0xF3,
+    0x87, 0xE2, 0x62, 0x0C, 0x87, 0x21, 0x00, 0xEE, 0x63, 0x10, 0x81, 0x32,
+    0x41, 0x00, 0x15, 0xD4, 0xDA, 0xB4, 0x7B, 0xFE, 0xDA, 0xB4, 0x6E, 0xF3,
+    0x87, 0xE2, 0x62, 0x00, 0x87, 0x21, 0x00, 0xEE, 0x63, 0x20, 0x81, 0x32,
+    0x41, 0x00, 0x15, 0xD4, 0xDA, 0xB4, 0x7A, 0x02, 0xDA, 0xB4, 0x6E, 0xF3,
+    0x87, 0xE2, 0x62, 0x08, 0x87, 0x21, 0x00, 0xEE, 0x63, 0x80, 0x81, 0x32,
+    0x41, 0x00, 0x15, 0xD4, 0xDA, 0xB4, 0x7A, 0xFE, 0xDA, 0xB4, 0x6E, 0xF3,
+    0x87, 0xE2, 0x62, 0x04, 0x87, 0x21, 0x00, 0xEE, 0xC1, 0xF0, 0x80, 0x12,
+    0x30, 0x00, 0x15, 0xE4, 0x6E, 0x0C, 0x87, 0xE3, 0x82, 0xE3, 0x15, 0x0E,
+    0xDA, 0xB4, 0x80, 0x0E, 0x4F, 0x00, 0x15, 0xF2, 0x62, 0x04, 0x7A, 0xFE,
+    0x16, 0x14, 0x80, 0x0E, 0x4F, 0x00, 0x15, 0xFE, 0x62, 0x0C, 0x7B, 0x02,
+    0x16, 0x14, 0x80, 0x0E, 0x4F, 0x00, 0x16, 0x0A, 0x62, 0x08, 0x7A, 0x02,
+    0x16, 0x14, 0x80, 0x0E, 0x4F, 0x00, 0x15, 0xDC, 0x62, 0x00, 0x7B, 0xFE,
+    0xDA, 0xB4, 0x6E, 0xF3, 0x87, 0xE2, 0x87, 0x21, 0x00, 0xEE, 0x82, 0x70,
+    0x83, 0x70, 0x6E, 0x30, 0x82, 0xE2, 0x80, 0xC0, 0x81, 0xD0, 0x27, 0xBA,
+    0xA8, 0xED, 0x6E, 0xF0, 0x80, 0xE2, 0x30, 0x00, 0x16, 0x4C, 0xDC, 0xD4,
+    0x42, 0x30, 0x7D, 0x02, 0x42, 0x00, 0x7D, 0xFE, 0x42, 0x20, 0x7C, 0x02,
+    0x42, 0x10, 0x7C, 0xFE, 0xDC, 0xD4, 0x00, 0xEE, 0x6E, 0x80, 0xF1, 0x07,
+    0x31, 0x00, 0x17, 0x04, 0x34, 0x00, 0x17, 0x04, 0x81, 0x00, 0x83, 0x0E,
+    0x4F, 0x00, 0x16, 0x7E, 0x83, 0x90, 0x83, 0xD5, 0x4F, 0x00, 0x16, 0xB6,
+    0x33, 0x00, 0x16, 0x9C, 0x87, 0xE3, 0x83, 0x80, 0x83, 0xC5, 0x4F, 0x00,
+    0x16, 0xEA, 0x33, 0x00, 0x16, 0xD0, 0x87, 0xE3, 0x17, 0x04, 0x83, 0x80,
+    0x83, 0xC5, 0x4F, 0x00, 0x16, 0xEA, 0x33, 0x00, 0x16, 0xD0, 0x87, 0xE3,
+    0x83, 0x90, 0x83, 0xD5, 0x4F, 0x00, 0x16, 0xB6, 0x33, 0x00, 0x16, 0x9C,
+    0x87, 0xE3, 0x17, 0x04, 0x63, 0x40, 0x81, 0x32, 0x41, 0x00, 0x17, 0x04,
+    0xDC, 0xD4, 0x7D, 0x02, 0xDC, 0xD4, 0x87, 0xE3, 0x6E, 0xCF, 0x87, 0xE2,
+    0x62, 0x30, 0x87, 0x21, 0x00, 0xEE, 0x63, 0x10, 0x81, 0x32, 0x41, 0x00,
+    0x17, 0x04, 0xDC, 0xD4, 0x7D, 0xFE, 0xDC, 0xD4, 0x87, 0xE3, 0x6E, 0xCF,
+    0x87, 0xE2, 0x62, 0x00, 0x87, 0x21, 0x00, 0xEE, 0x63, 0x20, 0x81, 0x32,
+    0x41, 0x00, 0x17, 0x04, 0xDC, 0xD4, 0x7C, 0x02, 0xDC, 0xD4, 0x87, 0xE3,
+    0x6E, 0xCF, 0x87, 0xE2, 0x62, 0x20, 0x87, 0x21, 0x00, 0xEE, 0x63, 0x80,
+    0x81, 0x32, 0x41, 0x00, 0x17, 0x04, 0xDC, 0xD4, 0x7C, 0xFE, 0xDC, 0xD4,
+    0x87, 0xE3, 0x6E, 0xCF, 0x87, 0xE2, 0x62, 0x10, 0x87, 0x21, 0x00, 0xEE,
+    0xC1, 0xF0, 0x80, 0x12, 0x30, 0x00, 0x17, 0x16, 0x87, 0xE3, 0x6E, 0x30,
+    0x87, 0xE3, 0x82, 0xE3, 0x16, 0x36, 0xDC, 0xD4, 0x80, 0x0E, 0x4F, 0x00,
+    0x17, 0x24, 0x62, 0x90, 0x7C, 0xFE, 0x17, 0x46, 0x80, 0x0E, 0x4F, 0x00,
+    0x17, 0x30, 0x62, 0x30, 0x7D, 0x02, 0x17, 0x46, 0x80, 0x0E, 0x4F, 0x00,
+    0x17, 0x3C, 0x62, 0xA0, 0x7C, 0x02, 0x17, 0x46, 0x80, 0x0E, 0x4F, 0x00,
+    0x17, 0x0C, 0x62, 0x00, 0x7D, 0xFE, 0xDC, 0xD4, 0x6E, 0x4F, 0x87, 0xE2,
+    0x87, 0x21, 0x00, 0xEE, 0x80, 0x70, 0x6E, 0x03, 0x80, 0xE2, 0x80, 0x0E,
+    0x81, 0x80, 0x81, 0x94, 0x6E, 0x02, 0x81, 0xE2, 0x41, 0x00, 0x70, 0x01,
+    0x80, 0x0E, 0x80, 0x0E, 0xA8, 0xCD, 0xF0, 0x1E, 0xD8, 0x94, 0x8E, 0xF0,
+    0x00, 0xEE, 0x6E, 0x00, 0xA9, 0x19, 0xFE, 0x1E, 0xFE, 0x1E, 0xFE, 0x1E,
+    0xFE, 0x1E, 0xF3, 0x65, 0xAB, 0x34, 0xFE, 0x1E, 0xFE, 0x1E, 0xFE, 0x1E,
+    0xFE, 0x1E, 0xF3, 0x55, 0x7E, 0x01, 0x3E, 0x80, 0x17, 0x74, 0x00, 0xEE,
+    0x82, 0x23, 0x83, 0x33, 0x6E, 0x0F, 0x80, 0x20, 0x81, 0x30, 0x27, 0xBE,
+    0x80, 0xE2, 0x80, 0x0E, 0xA8, 0xF9, 0xF0, 0x1E, 0xD2, 0x32, 0x72, 0x02,
+    0x32, 0x40, 0x17, 0x9A, 0x82, 0x23, 0x73, 0x02, 0x43, 0x20, 0x00, 0xEE,
+    0x17, 0x9A, 0x70, 0x02, 0x71, 0x02, 0x80, 0x06, 0x81, 0x06, 0x81, 0x0E,
+    0x81, 0x0E, 0x81, 0x0E, 0x81, 0x0E, 0xAB, 0x34, 0xF1, 0x1E, 0xF1, 0x1E,
+    0xF0, 0x1E, 0xF0, 0x65, 0x00, 0xEE, 0xA8, 0xCC, 0xF0, 0x65, 0x80, 0x06,
+    0xF0, 0x55, 0x60, 0x01, 0xE0, 0xA1, 0x17, 0xE0, 0x00, 0xEE, 0xF1, 0x65,
+    0x6E, 0x01, 0x84, 0x43, 0x82, 0x00, 0x83, 0x10, 0x65, 0x10, 0x83, 0x55,
+    0x4F, 0x00, 0x82, 0xE5, 0x4F, 0x00, 0x18, 0x0C, 0x65, 0x27, 0x82, 0x55,
+    0x4F, 0x00, 0x18, 0x0C, 0x80, 0x20, 0x81, 0x30, 0x84, 0xE4, 0x17, 0xF0,
+    0xF4, 0x29, 0xD6, 0x75, 0x76, 0x06, 0x84, 0x43, 0x82, 0x00, 0x83, 0x10,
+    0x65, 0xE8, 0x83, 0x55, 0x4F, 0x00, 0x82, 0xE5, 0x4F, 0x00, 0x18, 0x34,
+    0x65, 0x03, 0x82, 0x55, 0x4F, 0x00, 0x18, 0x34, 0x80, 0x20, 0x81, 0x30,
+    0x84, 0xE4, 0x18, 0x18, 0xF4, 0x29, 0xD6, 0x75, 0x76, 0x06, 0x84, 0x43,
+    0x82, 0x00, 0x83, 0x10, 0x65, 0x64, 0x83, 0x55, 0x4F, 0x00, 0x82, 0xE5,
+    0x4F, 0x00, 0x18, 0x54, 0x80, 0x20, 0x81, 0x30, 0x84, 0xE4, 0x18, 0x40,
+    0xF4, 0x29, 0xD6, 0x75, 0x76, 0x06, 0x84, 0x43, 0x82, 0x00, 0x83, 0x10,
+    0x65, 0x0A, 0x83, 0x55, 0x4F, 0x00, 0x18, 0x6E, 0x81, 0x30, 0x84, 0xE4,
+    0x18, 0x60, 0xF4, 0x29, 0xD6, 0x75, 0x76, 0x06, 0xF1, 0x29, 0xD6, 0x75,
+    0x00, 0xEE, 0xA8, 0xC8, 0xF1, 0x65, 0x81, 0xE4, 0x3F, 0x00, 0x70, 0x01,
+    0xA8, 0xC8, 0xF1, 0x55, 0x00, 0xEE, 0xA8, 0xC8, 0xF3, 0x65, 0x8E, 0x00,
+    0x8E, 0x25, 0x4F, 0x00, 0x00, 0xEE, 0x3E, 0x00, 0x18, 0xA2, 0x8E, 0x10,
+    0x8E, 0x35, 0x4F, 0x00, 0x00, 0xEE, 0xA8, 0xCA, 0xF1, 0x55, 0x00, 0xEE,
+    0x8E, 0xE3, 0x62, 0x0F, 0x63, 0xFF, 0x61, 0x10, 0xE2, 0xA1, 0x18, 0xC4,
+    0x81, 0x34, 0x31, 0x00, 0x18, 0xB0, 0x61, 0x10, 0x80, 0x34, 0x30, 0x00,
+    0x18, 0xB0, 0x00, 0xEE, 0x6E, 0x01, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x00,
+    0x05, 0x00, 0x50, 0x70, 0x20, 0x00, 0x50, 0x70, 0x20, 0x00, 0x60, 0x30,
+    0x60, 0x00, 0x60, 0x30, 0x60, 0x00, 0x30, 0x60, 0x30, 0x00, 0x30, 0x60,
+    0x30, 0x00, 0x20, 0x70, 0x50, 0x00, 0x20, 0x70, 0x50, 0x00, 0x20, 0x70,
+    0x70, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xC0, 0x00, 0x00, 0x00, 0x80, 0x80, 0x00, 0x00, 0xC0, 0x80, 0x80,
+    0x80, 0xC0, 0x00, 0x80, 0x00, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0D, 0x0C, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x0D, 0x0A, 0x65, 0x05, 0x05, 0x05, 0x05, 0xE5, 0x05, 0x05, 0xE5, 0x05,
+    0x05, 0x05, 0x05, 0xC5, 0x0A, 0x0A, 0x65, 0x05, 0x05, 0x05, 0x05, 0xE5,
+    0x05, 0x05, 0xE5, 0x05, 0x05, 0x05, 0x05, 0xC5, 0x0A, 0x0A, 0x05, 0x0C,
+    0x08, 0x08, 0x0F, 0x05, 0x0C, 0x0D, 0x05, 0x08, 0x08, 0x08, 0x0D, 0x05,
+    0x0E, 0x0F, 0x05, 0x0C, 0x08, 0x08, 0x0F, 0x05, 0x0C, 0x0D, 0x05, 0x08,
+    0x08, 0x08, 0x0D, 0x05, 0x0A, 0x0A, 0x05, 0x0A, 0x65, 0x06, 0x05, 0x95,
+    0x0A, 0x0A, 0x35, 0x05, 0x05, 0xC5, 0x0A, 0x35, 0x05, 0x05, 0x95, 0x0A,
+    0x65, 0x05, 0x05, 0x95, 0x0A, 0x0A, 0x35, 0x05, 0x06, 0xC5, 0x0A, 0x05,
+    0x0A, 0x0A, 0x05, 0x0F, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0C, 0x08,
+    0x0F, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x05, 0x08, 0x08, 0x0C,
+    0x08, 0x08, 0x08, 0x08, 0x0F, 0x05, 0x0F, 0x05, 0x0A, 0x0A, 0x75, 0x05,
+    0xB5, 0x05, 0x05, 0x05, 0x05, 0xC5, 0x0A, 0x65, 0x05, 0xB5, 0x05, 0xE5,
+    0x05, 0x05, 0xE5, 0x05, 0xB5, 0x05, 0xC5, 0x0A, 0x65, 0x05, 0x05, 0x05,
+    0x05, 0xB5, 0x05, 0xD5, 0x0A, 0x0A, 0x05, 0x0C, 0x08, 0x08, 0x08, 0x08,
+    0x0D, 0x05, 0x0F, 0x05, 0x0C, 0x08, 0x0F, 0x05, 0x08, 0x0F, 0x05, 0x08,
+    0x08, 0x0D, 0x05, 0x0F, 0x05, 0x0C, 0x08, 0x08, 0x08, 0x08, 0x0D, 0x05,
+    0x0A, 0x0F, 0x05, 0x0F, 0x65, 0x05, 0x05, 0xC5, 0x0A, 0x35, 0xE5, 0x95,
+    0x0A, 0x65, 0x05, 0xB0, 0x05, 0x05, 0xB5, 0x05, 0xC5, 0x0A, 0x35, 0xE5,
+    0x95, 0x0A, 0x65, 0x05, 0x05, 0xC5, 0x0F, 0x05, 0x0F, 0x07, 0x74, 0x05,
+    0xD5, 0x08, 0x0F, 0x05, 0x0E, 0x0F, 0x05, 0x08, 0x0F, 0x05, 0x0C, 0x08,
+    0x08, 0x08, 0x08, 0x0D, 0x05, 0x08, 0x0F, 0x05, 0x08, 0x0F, 0x05, 0x08,
+    0x0F, 0x75, 0x05, 0xD4, 0x07, 0x0A, 0x05, 0x0A, 0x35, 0x05, 0x05, 0xF5,
+    0x05, 0x05, 0xB5, 0x05, 0x05, 0xD5, 0x08, 0x08, 0x0D, 0x0C, 0x08, 0x0F,
+    0x75, 0x05, 0x05, 0xB5, 0x05, 0x05, 0xF5, 0x05, 0x05, 0x95, 0x0A, 0x05,
+    0x0A, 0x0A, 0x05, 0x08, 0x08, 0x08, 0x0D, 0x05, 0x0C, 0x08, 0x08, 0x08,
+    0x0D, 0x35, 0x05, 0xC5, 0x0A, 0x0A, 0x65, 0x05, 0x95, 0x0C, 0x08, 0x08,
+    0x08, 0x0D, 0x05, 0x0C, 0x08, 0x08, 0x0F, 0x05, 0x0A, 0x0A, 0x75, 0x05,
+    0x06, 0xC5, 0x0A, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x05,
+    0x08, 0x0F, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x05, 0x0A,
+    0x65, 0x06, 0x05, 0xD5, 0x0A, 0x0A, 0x05, 0x0C, 0x0D, 0x05, 0x0A, 0x35,
+    0x05, 0x05, 0x05, 0x05, 0xE5, 0x05, 0x05, 0xF5, 0x05, 0x05, 0xF5, 0x05,
+    0x05, 0xE5, 0x05, 0x05, 0x05, 0x05, 0x95, 0x0A, 0x05, 0x0C, 0x0D, 0x05,
+    0x0A, 0x0A, 0x05, 0x08, 0x0F, 0x05, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0F,
+    0x05, 0x0C, 0x0D, 0x05, 0x08, 0x0F, 0x05, 0x0C, 0x0D, 0x05, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x0F, 0x05, 0x08, 0x0F, 0x05, 0x0A, 0x0A, 0x35, 0x05,
+    0x05, 0xB5, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05, 0x95, 0x0A, 0x0A, 0x35,
+    0x05, 0x05, 0x95, 0x0A, 0x0A, 0x35, 0x05, 0x05, 0x05, 0x05, 0x05, 0x05,
+    0xB5, 0x05, 0x05, 0x95, 0x0A, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x0F, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0F,
+    0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x0F, 0x3C, 0x42, 0x99, 0x99, 0x42, 0x3C, 0x01, 0x10, 0x0F, 0x78, 0x84,
+    0x32, 0x32, 0x84, 0x78, 0x00, 0x10, 0xE0, 0x78, 0xFC, 0xFE, 0xFE, 0x84,
+    0x78, 0x00, 0x10, 0xE0,
+};
+const size_t aot_rom_size = 2356;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000FFFFFFF00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+        case 0x2FE: goto L2FE;
+        case 0x300: goto L300;
+        case 0x302: goto L302;
+        case 0x304: goto L304;
+        case 0x306: goto L306;
+        case 0x308: goto L308;
+        case 0x30A: goto L30A;
+        case 0x30C: goto L30C;
+        case 0x30E: goto L30E;
+        case 0x310: goto L310;
+        case 0x312: goto L312;
+        case 0x314: goto L314;
+        case 0x316: goto L316;
+        case 0x318: goto L318;
+        case 0x31A: goto L31A;
+        case 0x31C: goto L31C;
+        case 0x31E: goto L31E;
+        case 0x320: goto L320;
+        case 0x322: goto L322;
+        case 0x324: goto L324;
+        case 0x326: goto L326;
+        case 0x328: goto L328;
+        case 0x32A: goto L32A;
+        case 0x32C: goto L32C;
+        case 0x32E: goto L32E;
+        case 0x330: goto L330;
+        case 0x332: goto L332;
+        case 0x334: goto L334;
+        case 0x336: goto L336;
+        case 0x338: goto L338;
+        case 0x33A: goto L33A;
+        case 0x33C: goto L33C;
+        case 0x33E: goto L33E;
+        case 0x340: goto L340;
+        case 0x342: goto L342;
+        case 0x344: goto L344;
+        case 0x346: goto L346;
+        case 0x348: goto L348;
+        case 0x34A: goto L34A;
+        case 0x34C: goto L34C;
+        case 0x34E: goto L34E;
+        case 0x350: goto L350;
+        case 0x352: goto L352;
+        case 0x354: goto L354;
+        case 0x356: goto L356;
+        case 0x358: goto L358;
+        case 0x35A: goto L35A;
+        case 0x35C: goto L35C;
+        case 0x35E: goto L35E;
+        case 0x360: goto L360;
+        case 0x362: goto L362;
+        case 0x364: goto L364;
+        case 0x366: goto L366;
+        case 0x368: goto L368;
+        case 0x36A: goto L36A;
+        case 0x36C: goto L36C;
+        case 0x36E: goto L36E;
+        case 0x370: goto L370;
+        case 0x372: goto L372;
+        case 0x374: goto L374;
+        case 0x376: goto L376;
+        case 0x378: goto L378;
+        case 0x37A: goto L37A;
+        case 0x37C: goto L37C;
+        case 0x37E: goto L37E;
+        case 0x380: goto L380;
+        case 0x382: goto L382;
+        case 0x384: goto L384;
+        case 0x386: goto L386;
+        case 0x388: goto L388;
+        case 0x38A: goto L38A;
+        case 0x38C: goto L38C;
+        case 0x38E: goto L38E;
+        case 0x390: goto L390;
+        case 0x392: goto L392;
+        case 0x394: goto L394;
+        case 0x396: goto L396;
+        case 0x398: goto L398;
+        case 0x39A: goto L39A;
+        case 0x39C: goto L39C;
+        case 0x39E: goto L39E;
+        case 0x3A0: goto L3A0;
+        case 0x3A2: goto L3A2;
+        case 0x3A4: goto L3A4;
+        case 0x3A6: goto L3A6;
+        case 0x3A8: goto L3A8;
+        case 0x3AA: goto L3AA;
+        case 0x3AC: goto L3AC;
+        case 0x3AE: goto L3AE;
+        case 0x3B0: goto L3B0;
+        case 0x3B2: goto L3B2;
+        case 0x3B4: goto L3B4;
+        case 0x3B6: goto L3B6;
+        case 0x3B8: goto L3B8;
+        case 0x3BA: goto L3BA;
+        case 0x3BC: goto L3BC;
+        case 0x3BE: goto L3BE;
+        case 0x3C0: goto L3C0;
+        case 0x3C2: goto L3C2;
+        case 0x3C4: goto L3C4;
+        case 0x3C6: goto L3C6;
+        case 0x3C8: goto L3C8;
+        case 0x3CA: goto L3CA;
+        case 0x3CC: goto L3CC;
+        case 0x3CE: goto L3CE;
+        case 0x3D0: goto L3D0;
+        case 0x3D2: goto L3D2;
+        case 0x3D4: goto L3D4;
+        case 0x3D6: goto L3D6;
+        case 0x3D8: goto L3D8;
+        case 0x3DA: goto L3DA;
+        case 0x3DC: goto L3DC;
+        case 0x3DE: goto L3DE;
+        case 0x3E0: goto L3E0;
+        case 0x3E2: goto L3E2;
+        case 0x3E4: goto L3E4;
+        case 0x3E6: goto L3E6;
+        case 0x3E8: goto L3E8;
+        case 0x3EA: goto L3EA;
+        case 0x3EC: goto L3EC;
+        case 0x3EE: goto L3EE;
+        case 0x3F0: goto L3F0;
+        case 0x3F2: goto L3F2;
+        case 0x3F4: goto L3F4;
+        case 0x3F6: goto L3F6;
+        case 0x3F8: goto L3F8;
+        case 0x3FA: goto L3FA;
+        case 0x3FC: goto L3FC;
+        case 0x3FE: goto L3FE;
+        case 0x400: goto L400;
+        case 0x402: goto L402;
+        case 0x404: goto L404;
+        case 0x406: goto L406;
+        case 0x408: goto L408;
+        case 0x40A: goto L40A;
+        case 0x40C: goto L40C;
+        case 0x40E: goto L40E;
+        case 0x410: goto L410;
+        case 0x412: goto L412;
+        case 0x414: goto L414;
+        case 0x416: goto L416;
+        case 0x418: goto L418;
+        case 0x41A: goto L41A;
+        case 0x41C: goto L41C;
+        case 0x41E: goto L41E;
+        case 0x420: goto L420;
+        case 0x422: goto L422;
+        case 0x424: goto L424;
+        case 0x426: goto L426;
+        case 0x428: goto L428;
+        case 0x42A: goto L42A;
+        case 0x42C: goto L42C;
+        case 0x42E: goto L42E;
+        case 0x430: goto L430;
+        case 0x432: goto L432;
+        case 0x434: goto L434;
+        case 0x436: goto L436;
+        case 0x438: goto L438;
+        case 0x43A: goto L43A;
+        case 0x43C: goto L43C;
+        case 0x43E: goto L43E;
+        case 0x440: goto L440;
+        case 0x442: goto L442;
+        case 0x444: goto L444;
+        case 0x446: goto L446;
+        case 0x448: goto L448;
+        case 0x44A: goto L44A;
+        case 0x44C: goto L44C;
+        case 0x44E: goto L44E;
+        case 0x450: goto L450;
+        case 0x452: goto L452;
+        case 0x454: goto L454;
+        case 0x456: goto L456;
+        case 0x458: goto L458;
+        case 0x45A: goto L45A;
+        case 0x45C: goto L45C;
+        case 0x45E: goto L45E;
+        case 0x460: goto L460;
+        case 0x462: goto L462;
+        case 0x464: goto L464;
+        case 0x466: goto L466;
+        case 0x468: goto L468;
+        case 0x46A: goto L46A;
+        case 0x46C: goto L46C;
+        case 0x46E: goto L46E;
+        case 0x470: goto L470;
+        case 0x472: goto L472;
+        case 0x474: goto L474;
+        case 0x476: goto L476;
+        case 0x478: goto L478;
+        case 0x47A: goto L47A;
+        case 0x47C: goto L47C;
+        case 0x47E: goto L47E;
+        case 0x480: goto L480;
+        case 0x482: goto L482;
+        case 0x484: goto L484;
+        case 0x486: goto L486;
+        case 0x488: goto L488;
+        case 0x48A: goto L48A;
+        case 0x48C: goto L48C;
+        case 0x48E: goto L48E;
+        case 0x490: goto L490;
+        case 0x492: goto L492;
+        case 0x494: goto L494;
+        case 0x496: goto L496;
+        case 0x498: goto L498;
+        case 0x49A: goto L49A;
+        case 0x49C: goto L49C;
+        case 0x49E: goto L49E;
+        case 0x4A0: goto L4A0;
+        case 0x4A2: goto L4A2;
+        case 0x4A4: goto L4A4;
+        case 0x4A6: goto L4A6;
+        case 0x4A8: goto L4A8;
+        case 0x4AA: goto L4AA;
+        case 0x4AC: goto L4AC;
+        case 0x4AE: goto L4AE;
+        case 0x4B0: goto L4B0;
+        case 0x4B2: goto L4B2;
+        case 0x4B4: goto L4B4;
+        case 0x4B6: goto L4B6;
+        case 0x4B8: goto L4B8;
+        case 0x4BA: goto L4BA;
+        case 0x4BC: goto L4BC;
+        case 0x4BE: goto L4BE;
+        case 0x4C0: goto L4C0;
+        case 0x4C2: goto L4C2;
+        case 0x4C4: goto L4C4;
+        case 0x4C6: goto L4C6;
+        case 0x4C8: goto L4C8;
+        case 0x4CA: goto L4CA;
+        case 0x4CC: goto L4CC;
+        case 0x4CE: goto L4CE;
+        case 0x4D0: goto L4D0;
+        case 0x4D2: goto L4D2;
+        case 0x4D4: goto L4D4;
+        case 0x4D6: goto L4D6;
+        case 0x4D8: goto L4D8;
+        case 0x4DA: goto L4DA;
+        case 0x4DC: goto L4DC;
+        case 0x4DE: goto L4DE;
+        case 0x4E0: goto L4E0;
+        case 0x4E2: goto L4E2;
+        case 0x4E4: goto L4E4;
+        case 0x4E6: goto L4E6;
+        case 0x4E8: goto L4E8;
+        case 0x4EA: goto L4EA;
+        case 0x4EC: goto L4EC;
+        case 0x4EE: goto L4EE;
+        case 0x4F0: goto L4F0;
+        case 0x4F2: goto L4F2;
+        case 0x4F4: goto L4F4;
+        case 0x4F6: goto L4F6;
+        case 0x4F8: goto L4F8;
+        case 0x4FA: goto L4FA;
+        case 0x4FC: goto L4FC;
+        case 0x4FE: goto L4FE;
+        case 0x500: goto L500;
+        case 0x502: goto L502;
+        case 0x504: goto L504;
+        case 0x506: goto L506;
+        case 0x508: goto L508;
+        case 0x50A: goto L50A;
+        case 0x50C: goto L50C;
+        case 0x50E: goto L50E;
+        case 0x510: goto L510;
+        case 0x512: goto L512;
+        case 0x514: goto L514;
+        case 0x516: goto L516;
+        case 0x518: goto L518;
+        case 0x51A: goto L51A;
+        case 0x51C: goto L51C;
+        case 0x51E: goto L51E;
+        case 0x520: goto L520;
+        case 0x522: goto L522;
+        case 0x524: goto L524;
+        case 0x526: goto L526;
+        case 0x528: goto L528;
+        case 0x52A: goto L52A;
+        case 0x52C: goto L52C;
+        case 0x52E: goto L52E;
+        case 0x530: goto L530;
+        case 0x532: goto L532;
+        case 0x534: goto L534;
+        case 0x536: goto L536;
+        case 0x538: goto L538;
+        case 0x53A: goto L53A;
+        case 0x53C: goto L53C;
+        case 0x53E: goto L53E;
+        case 0x540: goto L540;
+        case 0x542: goto L542;
+        case 0x544: goto L544;
+        case 0x546: goto L546;
+        case 0x548: goto L548;
+        case 0x54A: goto L54A;
+        case 0x54C: goto L54C;
+        case 0x54E: goto L54E;
+        case 0x550: goto L550;
+        case 0x552: goto L552;
+        case 0x554: goto L554;
+        case 0x556: goto L556;
+        case 0x558: goto L558;
+        case 0x55A: goto L55A;
+        case 0x55C: goto L55C;
+        case 0x55E: goto L55E;
+        case 0x560: goto L560;
+        case 0x562: goto L562;
+        case 0x564: goto L564;
+        case 0x566: goto L566;
+        case 0x568: goto L568;
+        case 0x56A: goto L56A;
+        case 0x56C: goto L56C;
+        case 0x56E: goto L56E;
+        case 0x570: goto L570;
+        case 0x572: goto L572;
+        case 0x574: goto L574;
+        case 0x576: goto L576;
+        case 0x578: goto L578;
+        case 0x57A: goto L57A;
+        case 0x57C: goto L57C;
+        case 0x57E: goto L57E;
+        case 0x580: goto L580;
+        case 0x582: goto L582;
+        case 0x584: goto L584;
+        case 0x586: goto L586;
+        case 0x588: goto L588;
+        case 0x58A: goto L58A;
+        case 0x58C: goto L58C;
+        case 0x58E: goto L58E;
+        case 0x590: goto L590;
+        case 0x592: goto L592;
+        case 0x594: goto L594;
+        case 0x596: goto L596;
+        case 0x598: goto L598;
+        case 0x59A: goto L59A;
+        case 0x59C: goto L59C;
+        case 0x59E: goto L59E;
+        case 0x5A0: goto L5A0;
+        case 0x5A2: goto L5A2;
+        case 0x5A4: goto L5A4;
+        case 0x5A6: goto L5A6;
+        case 0x5A8: goto L5A8;
+        case 0x5AA: goto L5AA;
+        case 0x5AC: goto L5AC;
+        case 0x5AE: goto L5AE;
+        case 0x5B0: goto L5B0;
+        case 0x5B2: goto L5B2;
+        case 0x5B4: goto L5B4;
+        case 0x5B6: goto L5B6;
+        case 0x5B8: goto L5B8;
+        case 0x5BA: goto L5BA;
+        case 0x5BC: goto L5BC;
+        case 0x5BE: goto L5BE;
+        case 0x5C0: goto L5C0;
+        case 0x5C2: goto L5C2;
+        case 0x5C4: goto L5C4;
+        case 0x5C6: goto L5C6;
+        case 0x5C8: goto L5C8;
+        case 0x5CA: goto L5CA;
+        case 0x5CC: goto L5CC;
+        case 0x5CE: goto L5CE;
+        case 0x5D0: goto L5D0;
+        case 0x5D2: goto L5D2;
+        case 0x5D4: goto L5D4;
+        case 0x5D6: goto L5D6;
+        case 0x5D8: goto L5D8;
+        case 0x5DA: goto L5DA;
+        case 0x5DC: goto L5DC;
+        case 0x5DE: goto L5DE;
+        case 0x5E0: goto L5E0;
+        case 0x5E2: goto L5E2;
+        case 0x5E4: goto L5E4;
+        case 0x5E6: goto L5E6;
+        case 0x5E8: goto L5E8;
+        case 0x5EA: goto L5EA;
+        case 0x5EC: goto L5EC;
+        case 0x5EE: goto L5EE;
+        case 0x5F0: goto L5F0;
+        case 0x5F2: goto L5F2;
+        case 0x5F4: goto L5F4;
+        case 0x5F6: goto L5F6;
+        case 0x5F8: goto L5F8;
+        case 0x5FA: goto L5FA;
+        case 0x5FC: goto L5FC;
+        case 0x5FE: goto L5FE;
+        case 0x600: goto L600;
+        case 0x602: goto L602;
+        case 0x604: goto L604;
+        case 0x606: goto L606;
+        case 0x608: goto L608;
+        case 0x60A: goto L60A;
+        case 0x60C: goto L60C;
+        case 0x60E: goto L60E;
+        case 0x610: goto L610;
+        case 0x612: goto L612;
+        case 0x614: goto L614;
+        case 0x616: goto L616;
+        case 0x618: goto L618;
+        case 0x61A: goto L61A;
+        case 0x61C: goto L61C;
+        case 0x61E: goto L61E;
+        case 0x620: goto L620;
+        case 0x622: goto L622;
+        case 0x624: goto L624;
+        case 0x626: goto L626;
+        case 0x628: goto L628;
+        case 0x62A: goto L62A;
+        case 0x62C: goto L62C;
+        case 0x62E: goto L62E;
+        case 0x630: goto L630;
+        case 0x632: goto L632;
+        case 0x634: goto L634;
+        case 0x636: goto L636;
+        case 0x638: goto L638;
+        case 0x63A: goto L63A;
+        case 0x63C: goto L63C;
+        case 0x63E: goto L63E;
+        case 0x640: goto L640;
+        case 0x642: goto L642;
+        case 0x644: goto L644;
+        case 0x646: goto L646;
+        case 0x648: goto L648;
+        case 0x64A: goto L64A;
+        case 0x64C: goto L64C;
+        case 0x64E: goto L64E;
+        case 0x650: goto L650;
+        case 0x652: goto L652;
+        case 0x654: goto L654;
+        case 0x656: goto L656;
+        case 0x658: goto L658;
+        case 0x65A: goto L65A;
+        case 0x65C: goto L65C;
+        case 0x65E: goto L65E;
+        case 0x660: goto L660;
+        case 0x662: goto L662;
+        case 0x664: goto L664;
+        case 0x666: goto L666;
+        case 0x668: goto L668;
+        case 0x66A: goto L66A;
+        case 0x66C: goto L66C;
+        case 0x66E: goto L66E;
+        case 0x670: goto L670;
+        case 0x672: goto L672;
+        case 0x674: goto L674;
+        case 0x676: goto L676;
+        case 0x678: goto L678;
+        case 0x67A: goto L67A;
+        case 0x67C: goto L67C;
+        case 0x67E: goto L67E;
+        case 0x680: goto L680;
+        case 0x682: goto L682;
+        case 0x684: goto L684;
+        case 0x686: goto L686;
+        case 0x688: goto L688;
+        case 0x68A: goto L68A;
+        case 0x68C: goto L68C;
+        case 0x68E: goto L68E;
+        case 0x690: goto L690;
+        case 0x692: goto L692;
+        case 0x694: goto L694;
+        case 0x696: goto L696;
+        case 0x698: goto L698;
+        case 0x69A: goto L69A;
+        case 0x69C: goto L69C;
+        case 0x69E: goto L69E;
+        case 0x6A0: goto L6A0;
+        case 0x6A2: goto L6A2;
+        case 0x6A4: goto L6A4;
+        case 0x6A6: goto L6A6;
+        case 0x6A8: goto L6A8;
+        case 0x6AA: goto L6AA;
+        case 0x6AC: goto L6AC;
+        case 0x6AE: goto L6AE;
+        case 0x6B0: goto L6B0;
+        case 0x6B2: goto L6B2;
+        case 0x6B4: goto L6B4;
+        case 0x6B6: goto L6B6;
+        case 0x6B8: goto L6B8;
+        case 0x6BA: goto L6BA;
+        case 0x6BC: goto L6BC;
+        case 0x6BE: goto L6BE;
+        case 0x6C0: goto L6C0;
+        case 0x6C2: goto L6C2;
+        case 0x6C4: goto L6C4;
+        case 0x6C6: goto L6C6;
+        case 0x6C8: goto L6C8;
+        case 0x6CA: goto L6CA;
+        case 0x6CC: goto L6CC;
+        case 0x6CE: goto L6CE;
+        case 0x6D0: goto L6D0;
+        case 0x6D2: goto L6D2;
+        case 0x6D4: goto L6D4;
+        case 0x6D6: goto L6D6;
+        case 0x6D8: goto L6D8;
+        case 0x6DA: goto L6DA;
+        case 0x6DC: goto L6DC;
+        case 0x6DE: goto L6DE;
+        case 0x6E0: goto L6E0;
+        case 0x6E2: goto L6E2;
+        case 0x6E4: goto L6E4;
+        case 0x6E6: goto L6E6;
+        case 0x6E8: goto L6E8;
+        case 0x6EA: goto L6EA;
+        case 0x6EC: goto L6EC;
+        case 0x6EE: goto L6EE;
+        case 0x6F0: goto L6F0;
+        case 0x6F2: goto L6F2;
+        case 0x6F4: goto L6F4;
+        case 0x6F6: goto L6F6;
+        case 0x6F8: goto L6F8;
+        case 0x6FA: goto L6FA;
+        case 0x6FC: goto L6FC;
+        case 0x6FE: goto L6FE;
+        case 0x700: goto L700;
+        case 0x702: goto L702;
+        case 0x704: goto L704;
+        case 0x706: goto L706;
+        case 0x708: goto L708;
+        case 0x70A: goto L70A;
+        case 0x70C: goto L70C;
+        case 0x70E: goto L70E;
+        case 0x710: goto L710;
+        case 0x712: goto L712;
+        case 0x714: goto L714;
+        case 0x716: goto L716;
+        case 0x718: goto L718;
+        case 0x71A: goto L71A;
+        case 0x71C: goto L71C;
+        case 0x71E: goto L71E;
+        case 0x720: goto L720;
+        case 0x722: goto L722;
+        case 0x724: goto L724;
+        case 0x726: goto L726;
+        case 0x728: goto L728;
+        case 0x72A: goto L72A;
+        case 0x72C: goto L72C;
+        case 0x72E: goto L72E;
+        case 0x730: goto L730;
+        case 0x732: goto L732;
+        case 0x734: goto L734;
+        case 0x736: goto L736;
+        case 0x738: goto L738;
+        case 0x73A: goto L73A;
+        case 0x73C: goto L73C;
+        case 0x73E: goto L73E;
+        case 0x740: goto L740;
+        case 0x742: goto L742;
+        case 0x744: goto L744;
+        case 0x746: goto L746;
+        case 0x748: goto L748;
+        case 0x74A: goto L74A;
+        case 0x74C: goto L74C;
+        case 0x74E: goto L74E;
+        case 0x750: goto L750;
+        case 0x752: goto L752;
+        case 0x754: goto L754;
+        case 0x756: goto L756;
+        case 0x758: goto L758;
+        case 0x75A: goto L75A;
+        case 0x75C: goto L75C;
+        case 0x75E: goto L75E;
+        case 0x760: goto L760;
+        case 0x762: goto L762;
+        case 0x764: goto L764;
+        case 0x766: goto L766;
+        case 0x768: goto L768;
+        case 0x76A: goto L76A;
+        case 0x76C: goto L76C;
+        case 0x76E: goto L76E;
+        case 0x770: goto L770;
+        case 0x772: goto L772;
+        case 0x774: goto L774;
+        case 0x776: goto L776;
+        case 0x778: goto L778;
+        case 0x77A: goto L77A;
+        case 0x77C: goto L77C;
+        case 0x77E: goto L77E;
+        case 0x780: goto L780;
+        case 0x782: goto L782;
+        case 0x784: goto L784;
+        case 0x786: goto L786;
+        case 0x788: goto L788;
+        case 0x78A: goto L78A;
+        case 0x78C: goto L78C;
+        case 0x78E: goto L78E;
+        case 0x790: goto L790;
+        case 0x792: goto L792;
+        case 0x794: goto L794;
+        case 0x796: goto L796;
+        case 0x798: goto L798;
+        case 0x79A: goto L79A;
+        case 0x79C: goto L79C;
+        case 0x79E: goto L79E;
+        case 0x7A0: goto L7A0;
+        case 0x7A2: goto L7A2;
+        case 0x7A4: goto L7A4;
+        case 0x7A6: goto L7A6;
+        case 0x7A8: goto L7A8;
+        case 0x7AA: goto L7AA;
+        case 0x7AC: goto L7AC;
+        case 0x7AE: goto L7AE;
+        case 0x7B0: goto L7B0;
+        case 0x7B2: goto L7B2;
+        case 0x7B4: goto L7B4;
+        case 0x7B6: goto L7B6;
+        case 0x7B8: goto L7B8;
+        case 0x7BA: goto L7BA;
+        case 0x7BC: goto L7BC;
+        case 0x7BE: goto L7BE;
+        case 0x7C0: goto L7C0;
+        case 0x7C2: goto L7C2;
+        case 0x7C4: goto L7C4;
+        case 0x7C6: goto L7C6;
+        case 0x7C8: goto L7C8;
+        case 0x7CA: goto L7CA;
+        case 0x7CC: goto L7CC;
+        case 0x7CE: goto L7CE;
+        case 0x7D0: goto L7D0;
+        case 0x7D2: goto L7D2;
+        case 0x7D4: goto L7D4;
+        case 0x7D6: goto L7D6;
+        case 0x7D8: goto L7D8;
+        case 0x7DA: goto L7DA;
+        case 0x7DC: goto L7DC;
+        case 0x7DE: goto L7DE;
+        case 0x7E0: goto L7E0;
+        case 0x7E2: goto L7E2;
+        case 0x7E4: goto L7E4;
+        case 0x7E6: goto L7E6;
+        case 0x7E8: goto L7E8;
+        case 0x7EA: goto L7EA;
+        case 0x7EC: goto L7EC;
+        case 0x7EE: goto L7EE;
+        case 0x7F0: goto L7F0;
+        case 0x7F2: goto L7F2;
+        case 0x7F4: goto L7F4;
+        case 0x7F6: goto L7F6;
+        case 0x7F8: goto L7F8;
+        case 0x7FA: goto L7FA;
+        case 0x7FC: goto L7FC;
+        case 0x7FE: goto L7FE;
+        case 0x800: goto L800;
+        case 0x802: goto L802;
+        case 0x804: goto L804;
+        case 0x806: goto L806;
+        case 0x808: goto L808;
+        case 0x80A: goto L80A;
+        case 0x80C: goto L80C;
+        case 0x80E: goto L80E;
+        case 0x810: goto L810;
+        case 0x812: goto L812;
+        case 0x814: goto L814;
+        case 0x816: goto L816;
+        case 0x818: goto L818;
+        case 0x81A: goto L81A;
+        case 0x81C: goto L81C;
+        case 0x81E: goto L81E;
+        case 0x820: goto L820;
+        case 0x822: goto L822;
+        case 0x824: goto L824;
+        case 0x826: goto L826;
+        case 0x828: goto L828;
+        case 0x82A: goto L82A;
+        case 0x82C: goto L82C;
+        case 0x82E: goto L82E;
+        case 0x830: goto L830;
+        case 0x832: goto L832;
+        case 0x834: goto L834;
+        case 0x836: goto L836;
+        case 0x838: goto L838;
+        case 0x83A: goto L83A;
+        case 0x83C: goto L83C;
+        case 0x83E: goto L83E;
+        case 0x840: goto L840;
+        case 0x842: goto L842;
+        case 0x844: goto L844;
+        case 0x846: goto L846;
+        case 0x848: goto L848;
+        case 0x84A: goto L84A;
+        case 0x84C: goto L84C;
+        case 0x84E: goto L84E;
+        case 0x850: goto L850;
+        case 0x852: goto L852;
+        case 0x854: goto L854;
+        case 0x856: goto L856;
+        case 0x858: goto L858;
+        case 0x85A: goto L85A;
+        case 0x85C: goto L85C;
+        case 0x85E: goto L85E;
+        case 0x860: goto L860;
+        case 0x862: goto L862;
+        case 0x864: goto L864;
+        case 0x866: goto L866;
+        case 0x868: goto L868;
+        case 0x86A: goto L86A;
+        case 0x86C: goto L86C;
+        case 0x86E: goto L86E;
+        case 0x870: goto L870;
+        case 0x872: goto L872;
+        case 0x874: goto L874;
+        case 0x876: goto L876;
+        case 0x878: goto L878;
+        case 0x87A: goto L87A;
+        case 0x87C: goto L87C;
+        case 0x87E: goto L87E;
+        case 0x880: goto L880;
+        case 0x882: goto L882;
+        case 0x884: goto L884;
+        case 0x886: goto L886;
+        case 0x888: goto L888;
+        case 0x88A: goto L88A;
+        case 0x88C: goto L88C;
+        case 0x88E: goto L88E;
+        case 0x890: goto L890;
+        case 0x892: goto L892;
+        case 0x894: goto L894;
+        case 0x896: goto L896;
+        case 0x898: goto L898;
+        case 0x89A: goto L89A;
+        case 0x89C: goto L89C;
+        case 0x89E: goto L89E;
+        case 0x8A0: goto L8A0;
+        case 0x8A2: goto L8A2;
+        case 0x8A4: goto L8A4;
+        case 0x8A6: goto L8A6;
+        case 0x8A8: goto L8A8;
+        case 0x8AA: goto L8AA;
+        case 0x8AC: goto L8AC;
+        case 0x8AE: goto L8AE;
+        case 0x8B0: goto L8B0;
+        case 0x8B2: goto L8B2;
+        case 0x8B4: goto L8B4;
+        case 0x8B6: goto L8B6;
+        case 0x8B8: goto L8B8;
+        case 0x8BA: goto L8BA;
+        case 0x8BC: goto L8BC;
+        case 0x8BE: goto L8BE;
+        case 0x8C0: goto L8C0;
+        case 0x8C2: goto L8C2;
+        case 0x8C4: goto L8C4;
+        case 0x8C6: goto L8C6;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 121A JP 0x21A
+    STEP(0x200, 0x121A);
+    goto L21A;
+L21A: // 8003 XOR V0, V0
+    STEP(0x21A, 0x8003);
+    V[0] ^= V[0];
+L21C: // 8113 XOR V1, V1
+    STEP(0x21C, 0x8113);
+    V[1] ^= V[1];
+L21E: // A8C8 LD I, 0x8C8
+    STEP(0x21E, 0xA8C8);
+    c->I = 0x8C8;
+L220: // F155 LD [I], V1
+    STEP(0x220, 0xF155);
+    c->pc = 0x220;
+    predecode(0xF155, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x222) goto dispatch;
+L222: // 6005 LD V0, 0x05
+    STEP(0x222, 0x6005);
+    V[0] = 0x05;
+L224: // A8CC LD I, 0x8CC
+    STEP(0x224, 0xA8CC);
+    c->I = 0x8CC;
+L226: // F055 LD [I], V0
+    STEP(0x226, 0xF055);
+    c->pc = 0x226;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x228) goto dispatch;
+L228: // 8773 XOR V7, V7
+    STEP(0x228, 0x8773);
+    V[7] ^= V[7];
+L22A: // 8663 XOR V6, V6
+    STEP(0x22A, 0x8663);
+    V[6] ^= V[6];
+L22C: // 2772 CALL 0x772
+    STEP(0x22C, 0x2772);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x22C;
+    goto L772;
+L22E: // 00E0 CLS
+    STEP(0x22E, 0x00E0);
+    c->pc = 0x22E;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x230) goto dispatch;
+L230: // 2794 CALL 0x794
+    STEP(0x230, 0x2794);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x230;
+    goto L794;
+L232: // 6E40 LD VE, 0x40
+    STEP(0x232, 0x6E40);
+    V[14] = 0x40;
+L234: // 87E2 AND V7, VE
+    STEP(0x234, 0x87E2);
+    V[7] &= V[14];
+L236: // 6E27 LD VE, 0x27
+    STEP(0x236, 0x6E27);
+    V[14] = 0x27;
+L238: // 87E1 OR V7, VE
+    STEP(0x238, 0x87E1);
+    V[7] |= V[14];
+L23A: // 681A LD V8, 0x1A
+    STEP(0x23A, 0x681A);
+    V[8] = 0x1A;
+L23C: // 690C LD V9, 0x0C
+    STEP(0x23C, 0x690C);
+    V[9] = 0x0C;
+L23E: // 6A38 LD VA, 0x38
+    STEP(0x23E, 0x6A38);
+    V[10] = 0x38;
+L240: // 6B00 LD VB, 0x00
+    STEP(0x240, 0x6B00);
+    V[11] = 0x00;
+L242: // 6C02 LD VC, 0x02
+    STEP(0x242, 0x6C02);
+    V[12] = 0x02;
+L244: // 6D1A LD VD, 0x1A
+    STEP(0x244, 0x6D1A);
+    V[13] = 0x1A;
+L246: // 2750 CALL 0x750
+    STEP(0x246, 0x2750);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x246;
+    goto L750;
+L248: // A8ED LD I, 0x8ED
+    STEP(0x248, 0xA8ED);
+    c->I = 0x8ED;
+L24A: // DAB4 DRW VA, VB, 4
+    STEP(0x24A, 0xDAB4);
+    c->pc = 0x24A;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x24C) goto dispatch;
+L24C: // DCD4 DRW VC, VD, 4
+    STEP(0x24C, 0xDCD4);
+    c->pc = 0x24C;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x24E) goto dispatch;
+L24E: // 23D0 CALL 0x3D0
+    STEP(0x24E, 0x23D0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x24E;
+    goto L3D0;
+L250: // 3E00 SE VE, 0x00
+    STEP(0x250, 0x3E00);
+    if (V[14] == 0x00) goto L254;
+L252: // 127C JP 0x27C
+    STEP(0x252, 0x127C);
+    goto L27C;
+L254: // A8CC LD I, 0x8CC
+    STEP(0x254, 0xA8CC);
+    c->I = 0x8CC;
+L256: // F065 LD V0, [I]
+    STEP(0x256, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L258: // 8500 LD V5, V0
+    STEP(0x258, 0x8500);
+    V[5] = V[0];
+L25A: // C4FF RND V4, 0xFF
+    STEP(0x25A, 0xC4FF);
+    c->pc = 0x25A;
+    predecode(0xC4FF, &in);
+    execute(c, &in);
+    if (c->pc != 0x25C) goto dispatch;
+L25C: // 8452 AND V4, V5
+    STEP(0x25C, 0x8452);
+    V[4] &= V[5];
+L25E: // 24F6 CALL 0x4F6
+    STEP(0x25E, 0x24F6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x25E;
+    goto L4F6;
+L260: // C4FF RND V4, 0xFF
+    STEP(0x260, 0xC4FF);
+    c->pc = 0x260;
+    predecode(0xC4FF, &in);
+    execute(c, &in);
+    if (c->pc != 0x262) goto dispatch;
+L262: // 8452 AND V4, V5
+    STEP(0x262, 0x8452);
+    V[4] &= V[5];
+L264: // 261E CALL 0x61E
+    STEP(0x264, 0x261E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x264;
+    goto L61E;
+L266: // 6001 LD V0, 0x01
+    STEP(0x266, 0x6001);
+    V[0] = 0x01;
+L268: // E0A1 SKNP V0
+    STEP(0x268, 0xE0A1);
+    c->pc = 0x268;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x26A) goto dispatch;
+L26A: // 27D6 CALL 0x7D6
+    STEP(0x26A, 0x27D6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x26A;
+    goto L7D6;
+L26C: // 36F7 SE V6, 0xF7
+    STEP(0x26C, 0x36F7);
+    if (V[6] == 0xF7) goto L270;
+L26E: // 124E JP 0x24E
+    STEP(0x26E, 0x124E);
+    goto L24E;
+L270: // 8E60 LD VE, V6
+    STEP(0x270, 0x8E60);
+    V[14] = V[6];
+L272: // 287A CALL 0x87A
+    STEP(0x272, 0x287A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x272;
+    goto L87A;
+L274: // 6E64 LD VE, 0x64
+    STEP(0x274, 0x6E64);
+    V[14] = 0x64;
+L276: // 287A CALL 0x87A
+    STEP(0x276, 0x287A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x276;
+    goto L87A;
+L278: // 27D6 CALL 0x7D6
+    STEP(0x278, 0x27D6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x278;
+    goto L7D6;
+L27A: // 122A JP 0x22A
+    STEP(0x27A, 0x122A);
+    goto L22A;
+L27C: // F007 LD V0, DT
+    STEP(0x27C, 0xF007);
+    V[0] = c->dt;
+L27E: // 4000 SNE V0, 0x00
+    STEP(0x27E, 0x4000);
+    if (V[0] != 0x00) goto L282;
+L280: // 1310 JP 0x310
+    STEP(0x280, 0x1310);
+    goto L310;
+L282: // 8080 LD V0, V8
+    STEP(0x282, 0x8080);
+    V[0] = V[8];
+L284: // 8006 SHR V0, V0
+    STEP(0x284, 0x8006);
+    V[15] = V[0] & 1;
+    V[0] >>= 1;
+L286: // 81A0 LD V1, VA
+    STEP(0x286, 0x81A0);
+    V[1] = V[10];
+L288: // 8106 SHR V1, V0
+    STEP(0x288, 0x8106);
+    V[15] = V[1] & 1;
+    V[1] >>= 1;
+L28A: // 8015 SUB V0, V1
+    STEP(0x28A, 0x8015);
+    V[15] = V[0] > V[1];
+    V[0] -= V[1];
+L28C: // 4000 SNE V0, 0x00
+    STEP(0x28C, 0x4000);
+    if (V[0] != 0x00) goto L290;
+L28E: // 129A JP 0x29A
+    STEP(0x28E, 0x129A);
+    goto L29A;
+L290: // 4001 SNE V0, 0x01
+    STEP(0x290, 0x4001);
+    if (V[0] != 0x01) goto L294;
+L292: // 129A JP 0x29A
+    STEP(0x292, 0x129A);
+    goto L29A;
+L294: // 40FF SNE V0, 0xFF
+    STEP(0x294, 0x40FF);
+    if (V[0] != 0xFF) goto L298;
+L296: // 129A JP 0x29A
+    STEP(0x296, 0x129A);
+    goto L29A;
+L298: // 12C8 JP 0x2C8
+    STEP(0x298, 0x12C8);
+    goto L2C8;
+L29A: // 8090 LD V0, V9
+    STEP(0x29A, 0x8090);
+    V[0] = V[9];
+L29C: // 8006 SHR V0, V0
+    STEP(0x29C, 0x8006);
+    V[15] = V[0] & 1;
+    V[0] >>= 1;
+L29E: // 81B0 LD V1, VB
+    STEP(0x29E, 0x81B0);
+    V[1] = V[11];
+L2A0: // 8106 SHR V1, V0
+    STEP(0x2A0, 0x8106);
+    V[15] = V[1] & 1;
+    V[1] >>= 1;
+L2A2: // 8015 SUB V0, V1
+    STEP(0x2A2, 0x8015);
+    V[15] = V[0] > V[1];
+    V[0] -= V[1];
+L2A4: // 4000 SNE V0, 0x00
+    STEP(0x2A4, 0x4000);
+    if (V[0] != 0x00) goto L2A8;
+L2A6: // 12B2 JP 0x2B2
+    STEP(0x2A6, 0x12B2);
+    goto L2B2;
+L2A8: // 4001 SNE V0, 0x01
+    STEP(0x2A8, 0x4001);
+    if (V[0] != 0x01) goto L2AC;
+L2AA: // 12B2 JP 0x2B2
+    STEP(0x2AA, 0x12B2);
+    goto L2B2;
+L2AC: // 40FF SNE V0, 0xFF
+    STEP(0x2AC, 0x40FF);
+    if (V[0] != 0xFF) goto L2B0;
+L2AE: // 12B2 JP 0x2B2
+    STEP(0x2AE, 0x12B2);
+    goto L2B2;
+L2B0: // 12C8 JP 0x2C8
+    STEP(0x2B0, 0x12C8);
+    goto L2C8;
+L2B2: // A8ED LD I, 0x8ED
+    STEP(0x2B2, 0xA8ED);
+    c->I = 0x8ED;
+L2B4: // DAB4 DRW VA, VB, 4
+    STEP(0x2B4, 0xDAB4);
+    c->pc = 0x2B4;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x2B6) goto dispatch;
+L2B6: // 6A38 LD VA, 0x38
+    STEP(0x2B6, 0x6A38);
+    V[10] = 0x38;
+L2B8: // 6B00 LD VB, 0x00
+    STEP(0x2B8, 0x6B00);
+    V[11] = 0x00;
+L2BA: // DAB4 DRW VA, VB, 4
+    STEP(0x2BA, 0xDAB4);
+    c->pc = 0x2BA;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x2BC) goto dispatch;
+L2BC: // 6EF3 LD VE, 0xF3
+    STEP(0x2BC, 0x6EF3);
+    V[14] = 0xF3;
+L2BE: // 87E2 AND V7, VE
+    STEP(0x2BE, 0x87E2);
+    V[7] &= V[14];
+L2C0: // 6E04 LD VE, 0x04
+    STEP(0x2C0, 0x6E04);
+    V[14] = 0x04;
+L2C2: // 87E1 OR V7, VE
+    STEP(0x2C2, 0x87E1);
+    V[7] |= V[14];
+L2C4: // 6E32 LD VE, 0x32
+    STEP(0x2C4, 0x6E32);
+    V[14] = 0x32;
+L2C6: // 287A CALL 0x87A
+    STEP(0x2C6, 0x287A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2C6;
+    goto L87A;
+L2C8: // 8080 LD V0, V8
+    STEP(0x2C8, 0x8080);
+    V[0] = V[8];
+L2CA: // 8006 SHR V0, V0
+    STEP(0x2CA, 0x8006);
+    V[15] = V[0] & 1;
+    V[0] >>= 1;
+L2CC: // 81C0 LD V1, VC
+    STEP(0x2CC, 0x81C0);
+    V[1] = V[12];
+L2CE: // 8106 SHR V1, V0
+    STEP(0x2CE, 0x8106);
+    V[15] = V[1] & 1;
+    V[1] >>= 1;
+L2D0: // 8015 SUB V0, V1
+    STEP(0x2D0, 0x8015);
+    V[15] = V[0] > V[1];
+    V[0] -= V[1];
+L2D2: // 4000 SNE V0, 0x00
+    STEP(0x2D2, 0x4000);
+    if (V[0] != 0x00) goto L2D6;
+L2D4: // 12E0 JP 0x2E0
+    STEP(0x2D4, 0x12E0);
+    goto L2E0;
+L2D6: // 4001 SNE V0, 0x01
+    STEP(0x2D6, 0x4001);
+    if (V[0] != 0x01) goto L2DA;
+L2D8: // 12E0 JP 0x2E0
+    STEP(0x2D8, 0x12E0);
+    goto L2E0;
+L2DA: // 40FF SNE V0, 0xFF
+    STEP(0x2DA, 0x40FF);
+    if (V[0] != 0xFF) goto L2DE;
+L2DC: // 12E0 JP 0x2E0
+    STEP(0x2DC, 0x12E0);
+    goto L2E0;
+L2DE: // 1254 JP 0x254
+    STEP(0x2DE, 0x1254);
+    goto L254;
+L2E0: // 8090 LD V0, V9
+    STEP(0x2E0, 0x8090);
+    V[0] = V[9];
+L2E2: // 8006 SHR V0, V0
+    STEP(0x2E2, 0x8006);
+    V[15] = V[0] & 1;
+    V[0] >>= 1;
+L2E4: // 81D0 LD V1, VD
+    STEP(0x2E4, 0x81D0);
+    V[1] = V[13];
+L2E6: // 8106 SHR V1, V0
+    STEP(0x2E6, 0x8106);
+    V[15] = V[1] & 1;
+    V[1] >>= 1;
+L2E8: // 8015 SUB V0, V1
+    STEP(0x2E8, 0x8015);
+    V[15] = V[0] > V[1];
+    V[0] -= V[1];
+L2EA: // 4000 SNE V0, 0x00
+    STEP(0x2EA, 0x4000);
+    if (V[0] != 0x00) goto L2EE;
+L2EC: // 12F8 JP 0x2F8
+    STEP(0x2EC, 0x12F8);
+    goto L2F8;
+L2EE: // 4001 SNE V0, 0x01
+    STEP(0x2EE, 0x4001);
+    if (V[0] != 0x01) goto L2F2;
+L2F0: // 12F8 JP 0x2F8
+    STEP(0x2F0, 0x12F8);
+    goto L2F8;
+L2F2: // 40FF SNE V0, 0xFF
+    STEP(0x2F2, 0x40FF);
+    if (V[0] != 0xFF) goto L2F6;
+L2F4: // 12F8 JP 0x2F8
+    STEP(0x2F4, 0x12F8);
+    goto L2F8;
+L2F6: // 1254 JP 0x254
+    STEP(0x2F6, 0x1254);
+    goto L254;
+L2F8: // A8ED LD I, 0x8ED
+    STEP(0x2F8, 0xA8ED);
+    c->I = 0x8ED;
+L2FA: // DCD4 DRW VC, VD, 4
+    STEP(0x2FA, 0xDCD4);
+    c->pc = 0x2FA;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x2FC) goto dispatch;
+L2FC: // 6C02 LD VC, 0x02
+    STEP(0x2FC, 0x6C02);
+    V[12] = 0x02;
+L2FE: // 6D1A LD VD, 0x1A
+    STEP(0x2FE, 0x6D1A);
+    V[13] = 0x1A;
+L300: // DCD4 DRW VC, VD, 4
+    STEP(0x300, 0xDCD4);
+    c->pc = 0x300;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x302) goto dispatch;
+L302: // 6ECF LD VE, 0xCF
+    STEP(0x302, 0x6ECF);
+    V[14] = 0xCF;
+L304: // 87E2 AND V7, VE
+    STEP(0x304, 0x87E2);
+    V[7] &= V[14];
+L306: // 6E20 LD VE, 0x20
+    STEP(0x306, 0x6E20);
+    V[14] = 0x20;
+L308: // 87E1 OR V7, VE
+    STEP(0x308, 0x87E1);
+    V[7] |= V[14];
+L30A: // 6E19 LD VE, 0x19
+    STEP(0x30A, 0x6E19);
+    V[14] = 0x19;
+L30C: // 287A CALL 0x87A
+    STEP(0x30C, 0x287A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x30C;
+    goto L87A;
+L30E: // 1254 JP 0x254
+    STEP(0x30E, 0x1254);
+    goto L254;
+L310: // 603F LD V0, 0x3F
+    STEP(0x310, 0x603F);
+    V[0] = 0x3F;
+L312: // 28A8 CALL 0x8A8
+    STEP(0x312, 0x28A8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x312;
+    goto L8A8;
+L314: // 2750 CALL 0x750
+    STEP(0x314, 0x2750);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x314;
+    goto L750;
+L316: // A8ED LD I, 0x8ED
+    STEP(0x316, 0xA8ED);
+    c->I = 0x8ED;
+L318: // DAB4 DRW VA, VB, 4
+    STEP(0x318, 0xDAB4);
+    c->pc = 0x318;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x31A) goto dispatch;
+L31A: // DCD4 DRW VC, VD, 4
+    STEP(0x31A, 0xDCD4);
+    c->pc = 0x31A;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x31C) goto dispatch;
+L31C: // 6E40 LD VE, 0x40
+    STEP(0x31C, 0x6E40);
+    V[14] = 0x40;
+L31E: // 87E3 XOR V7, VE
+    STEP(0x31E, 0x87E3);
+    V[7] ^= V[14];
+L320: // 8070 LD V0, V7
+    STEP(0x320, 0x8070);
+    V[0] = V[7];
+L322: // 80E2 AND V0, VE
+    STEP(0x322, 0x80E2);
+    V[0] &= V[14];
+L324: // 3000 SE V0, 0x00
+    STEP(0x324, 0x3000);
+    if (V[0] == 0x00) goto L328;
+L326: // 1232 JP 0x232
+    STEP(0x326, 0x1232);
+    goto L232;
+L328: // 8E60 LD VE, V6
+    STEP(0x328, 0x8E60);
+    V[14] = V[6];
+L32A: // 287A CALL 0x87A
+    STEP(0x32A, 0x287A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x32A;
+    goto L87A;
+L32C: // 288A CALL 0x88A
+    STEP(0x32C, 0x288A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x32C;
+    goto L88A;
+L32E: // 00E0 CLS
+    STEP(0x32E, 0x00E0);
+    c->pc = 0x32E;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x330) goto dispatch;
+L330: // 6611 LD V6, 0x11
+    STEP(0x330, 0x6611);
+    V[6] = 0x11;
+L332: // 670A LD V7, 0x0A
+    STEP(0x332, 0x670A);
+    V[7] = 0x0A;
+L334: // A8CA LD I, 0x8CA
+    STEP(0x334, 0xA8CA);
+    c->I = 0x8CA;
+L336: // 27E6 CALL 0x7E6
+    STEP(0x336, 0x27E6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x336;
+    goto L7E6;
+L338: // 6611 LD V6, 0x11
+    STEP(0x338, 0x6611);
+    V[6] = 0x11;
+L33A: // 6710 LD V7, 0x10
+    STEP(0x33A, 0x6710);
+    V[7] = 0x10;
+L33C: // A8C8 LD I, 0x8C8
+    STEP(0x33C, 0xA8C8);
+    c->I = 0x8C8;
+L33E: // 27E6 CALL 0x7E6
+    STEP(0x33E, 0x27E6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x33E;
+    goto L7E6;
+L340: // 6400 LD V4, 0x00
+    STEP(0x340, 0x6400);
+    V[4] = 0x00;
+L342: // 6508 LD V5, 0x08
+    STEP(0x342, 0x6508);
+    V[5] = 0x08;
+L344: // 6600 LD V6, 0x00
+    STEP(0x344, 0x6600);
+    V[6] = 0x00;
+L346: // 670F LD V7, 0x0F
+    STEP(0x346, 0x670F);
+    V[7] = 0x0F;
+L348: // AB19 LD I, 0xB19
+    STEP(0x348, 0xAB19);
+    c->I = 0xB19;
+L34A: // D469 DRW V4, V6, 9
+    STEP(0x34A, 0xD469);
+    c->pc = 0x34A;
+    predecode(0xD469, &in);
+    execute(c, &in);
+    if (c->pc != 0x34C) goto dispatch;
+L34C: // AB22 LD I, 0xB22
+    STEP(0x34C, 0xAB22);
+    c->I = 0xB22;
+L34E: // D569 DRW V5, V6, 9
+    STEP(0x34E, 0xD569);
+    c->pc = 0x34E;
+    predecode(0xD569, &in);
+    execute(c, &in);
+    if (c->pc != 0x350) goto dispatch;
+L350: // 6003 LD V0, 0x03
+    STEP(0x350, 0x6003);
+    V[0] = 0x03;
+L352: // 28A8 CALL 0x8A8
+    STEP(0x352, 0x28A8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x352;
+    goto L8A8;
+L354: // 3E00 SE VE, 0x00
+    STEP(0x354, 0x3E00);
+    if (V[14] == 0x00) goto L358;
+L356: // 13C6 JP 0x3C6
+    STEP(0x356, 0x13C6);
+    goto L3C6;
+L358: // AB19 LD I, 0xB19
+    STEP(0x358, 0xAB19);
+    c->I = 0xB19;
+L35A: // D469 DRW V4, V6, 9
+    STEP(0x35A, 0xD469);
+    c->pc = 0x35A;
+    predecode(0xD469, &in);
+    execute(c, &in);
+    if (c->pc != 0x35C) goto dispatch;
+L35C: // AB22 LD I, 0xB22
+    STEP(0x35C, 0xAB22);
+    c->I = 0xB22;
+L35E: // D569 DRW V5, V6, 9
+    STEP(0x35E, 0xD569);
+    c->pc = 0x35E;
+    predecode(0xD569, &in);
+    execute(c, &in);
+    if (c->pc != 0x360) goto dispatch;
+L360: // 7402 ADD V4, 0x02
+    STEP(0x360, 0x7402);
+    V[4] += 0x02;
+L362: // 7502 ADD V5, 0x02
+    STEP(0x362, 0x7502);
+    V[5] += 0x02;
+L364: // 3430 SE V4, 0x30
+    STEP(0x364, 0x3430);
+    if (V[4] == 0x30) goto L368;
+L366: // 1348 JP 0x348
+    STEP(0x366, 0x1348);
+    goto L348;
+L368: // AB19 LD I, 0xB19
+    STEP(0x368, 0xAB19);
+    c->I = 0xB19;
+L36A: // D469 DRW V4, V6, 9
+    STEP(0x36A, 0xD469);
+    c->pc = 0x36A;
+    predecode(0xD469, &in);
+    execute(c, &in);
+    if (c->pc != 0x36C) goto dispatch;
+L36C: // AB22 LD I, 0xB22
+    STEP(0x36C, 0xAB22);
+    c->I = 0xB22;
+L36E: // D569 DRW V5, V6, 9
+    STEP(0x36E, 0xD569);
+    c->pc = 0x36E;
+    predecode(0xD569, &in);
+    execute(c, &in);
+    if (c->pc != 0x370) goto dispatch;
+L370: // 6003 LD V0, 0x03
+    STEP(0x370, 0x6003);
+    V[0] = 0x03;
+L372: // 28A8 CALL 0x8A8
+    STEP(0x372, 0x28A8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x372;
+    goto L8A8;
+L374: // 3E00 SE VE, 0x00
+    STEP(0x374, 0x3E00);
+    if (V[14] == 0x00) goto L378;
+L376: // 13C6 JP 0x3C6
+    STEP(0x376, 0x13C6);
+    goto L3C6;
+L378: // AB19 LD I, 0xB19
+    STEP(0x378, 0xAB19);
+    c->I = 0xB19;
+L37A: // D469 DRW V4, V6, 9
+    STEP(0x37A, 0xD469);
+    c->pc = 0x37A;
+    predecode(0xD469, &in);
+    execute(c, &in);
+    if (c->pc != 0x37C) goto dispatch;
+L37C: // AB22 LD I, 0xB22
+    STEP(0x37C, 0xAB22);
+    c->I = 0xB22;
+L37E: // D569 DRW V5, V6, 9
+    STEP(0x37E, 0xD569);
+    c->pc = 0x37E;
+    predecode(0xD569, &in);
+    execute(c, &in);
+    if (c->pc != 0x380) goto dispatch;
+L380: // 7602 ADD V6, 0x02
+    STEP(0x380, 0x7602);
+    V[6] += 0x02;
+L382: // 3616 SE V6, 0x16
+    STEP(0x382, 0x3616);
+    if (V[6] == 0x16) goto L386;
+L384: // 1368 JP 0x368
+    STEP(0x384, 0x1368);
+    goto L368;
+L386: // AB19 LD I, 0xB19
+    STEP(0x386, 0xAB19);
+    c->I = 0xB19;
+L388: // D469 DRW V4, V6, 9
+    STEP(0x388, 0xD469);
+    c->pc = 0x388;
+    predecode(0xD469, &in);
+    execute(c, &in);
+    if (c->pc != 0x38A) goto dispatch;
+L38A: // AB22 LD I, 0xB22
+    STEP(0x38A, 0xAB22);
+    c->I = 0xB22;
+L38C: // D569 DRW V5, V6, 9
+    STEP(0x38C, 0xD569);
+    c->pc = 0x38C;
+    predecode(0xD569, &in);
+    execute(c, &in);
+    if (c->pc != 0x38E) goto dispatch;
+L38E: // 6003 LD V0, 0x03
+    STEP(0x38E, 0x6003);
+    V[0] = 0x03;
+L390: // 28A8 CALL 0x8A8
+    STEP(0x390, 0x28A8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x390;
+    goto L8A8;
+L392: // 3E00 SE VE, 0x00
+    STEP(0x392, 0x3E00);
+    if (V[14] == 0x00) goto L396;
+L394: // 13C6 JP 0x3C6
+    STEP(0x394, 0x13C6);
+    goto L3C6;
+L396: // AB19 LD I, 0xB19
+    STEP(0x396, 0xAB19);
+    c->I = 0xB19;
+L398: // D469 DRW V4, V6, 9
+    STEP(0x398, 0xD469);
+    c->pc = 0x398;
+    predecode(0xD469, &in);
+    execute(c, &in);
+    if (c->pc != 0x39A) goto dispatch;
+L39A: // AB22 LD I, 0xB22
+    STEP(0x39A, 0xAB22);
+    c->I = 0xB22;
+L39C: // D569 DRW V5, V6, 9
+    STEP(0x39C, 0xD569);
+    c->pc = 0x39C;
+    predecode(0xD569, &in);
+    execute(c, &in);
+    if (c->pc != 0x39E) goto dispatch;
+L39E: // 74FE ADD V4, 0xFE
+    STEP(0x39E, 0x74FE);
+    V[4] += 0xFE;
+L3A0: // 75FE ADD V5, 0xFE
+    STEP(0x3A0, 0x75FE);
+    V[5] += 0xFE;
+L3A2: // 3400 SE V4, 0x00
+    STEP(0x3A2, 0x3400);
+    if (V[4] == 0x00) goto L3A6;
+L3A4: // 1386 JP 0x386
+    STEP(0x3A4, 0x1386);
+    goto L386;
+L3A6: // AB19 LD I, 0xB19
+    STEP(0x3A6, 0xAB19);
+    c->I = 0xB19;
+L3A8: // D469 DRW V4, V6, 9
+    STEP(0x3A8, 0xD469);
+    c->pc = 0x3A8;
+    predecode(0xD469, &in);
+    execute(c, &in);
+    if (c->pc != 0x3AA) goto dispatch;
+L3AA: // AB22 LD I, 0xB22
+    STEP(0x3AA, 0xAB22);
+    c->I = 0xB22;
+L3AC: // D569 DRW V5, V6, 9
+    STEP(0x3AC, 0xD569);
+    c->pc = 0x3AC;
+    predecode(0xD569, &in);
+    execute(c, &in);
+    if (c->pc != 0x3AE) goto dispatch;
+L3AE: // 6003 LD V0, 0x03
+    STEP(0x3AE, 0x6003);
+    V[0] = 0x03;
+L3B0: // 28A8 CALL 0x8A8
+    STEP(0x3B0, 0x28A8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x3B0;
+    goto L8A8;
+L3B2: // 3E00 SE VE, 0x00
+    STEP(0x3B2, 0x3E00);
+    if (V[14] == 0x00) goto L3B6;
+L3B4: // 13C6 JP 0x3C6
+    STEP(0x3B4, 0x13C6);
+    goto L3C6;
+L3B6: // AB19 LD I, 0xB19
+    STEP(0x3B6, 0xAB19);
+    c->I = 0xB19;
+L3B8: // D469 DRW V4, V6, 9
+    STEP(0x3B8, 0xD469);
+    c->pc = 0x3B8;
+    predecode(0xD469, &in);
+    execute(c, &in);
+    if (c->pc != 0x3BA) goto dispatch;
+L3BA: // AB22 LD I, 0xB22
+    STEP(0x3BA, 0xAB22);
+    c->I = 0xB22;
+L3BC: // D569 DRW V5, V6, 9
+    STEP(0x3BC, 0xD569);
+    c->pc = 0x3BC;
+    predecode(0xD569, &in);
+    execute(c, &in);
+    if (c->pc != 0x3BE) goto dispatch;
+L3BE: // 76FE ADD V6, 0xFE
+    STEP(0x3BE, 0x76FE);
+    V[6] += 0xFE;
+L3C0: // 3600 SE V6, 0x00
+    STEP(0x3C0, 0x3600);
+    if (V[6] == 0x00) goto L3C4;
+L3C2: // 13A6 JP 0x3A6
+    STEP(0x3C2, 0x13A6);
+    goto L3A6;
+L3C4: // 1348 JP 0x348
+    STEP(0x3C4, 0x1348);
+    goto L348;
+L3C6: // AB22 LD I, 0xB22
+    STEP(0x3C6, 0xAB22);
+    c->I = 0xB22;
+L3C8: // D569 DRW V5, V6, 9
+    STEP(0x3C8, 0xD569);
+    c->pc = 0x3C8;
+    predecode(0xD569, &in);
+    execute(c, &in);
+    if (c->pc != 0x3CA) goto dispatch;
+L3CA: // AB2B LD I, 0xB2B
+    STEP(0x3CA, 0xAB2B);
+    c->I = 0xB2B;
+L3CC: // D569 DRW V5, V6, 9
+    STEP(0x3CC, 0xD569);
+    c->pc = 0x3CC;
+    predecode(0xD569, &in);
+    execute(c, &in);
+    if (c->pc != 0x3CE) goto dispatch;
+L3CE: // 121A JP 0x21A
+    STEP(0x3CE, 0x121A);
+    goto L21A;
+L3D0: // 8370 LD V3, V7
+    STEP(0x3D0, 0x8370);
+    V[3] = V[7];
+L3D2: // 6E03 LD VE, 0x03
+    STEP(0x3D2, 0x6E03);
+    V[14] = 0x03;
+L3D4: // 83E2 AND V3, VE
+    STEP(0x3D4, 0x83E2);
+    V[3] &= V[14];
+L3D6: // 8480 LD V4, V8
+    STEP(0x3D6, 0x8480);
+    V[4] = V[8];
+L3D8: // 8590 LD V5, V9
+    STEP(0x3D8, 0x8590);
+    V[5] = V[9];
+L3DA: // 6E06 LD VE, 0x06
+    STEP(0x3DA, 0x6E06);
+    V[14] = 0x06;
+L3DC: // EEA1 SKNP VE
+    STEP(0x3DC, 0xEEA1);
+    c->pc = 0x3DC;
+    predecode(0xEEA1, &in);
+    execute(c, &in);
+    if (c->pc != 0x3DE) goto dispatch;
+L3DE: // 1432 JP 0x432
+    STEP(0x3DE, 0x1432);
+    goto L432;
+L3E0: // 6E03 LD VE, 0x03
+    STEP(0x3E0, 0x6E03);
+    V[14] = 0x03;
+L3E2: // EEA1 SKNP VE
+    STEP(0x3E2, 0xEEA1);
+    c->pc = 0x3E2;
+    predecode(0xEEA1, &in);
+    execute(c, &in);
+    if (c->pc != 0x3E4) goto dispatch;
+L3E4: // 144A JP 0x44A
+    STEP(0x3E4, 0x144A);
+    goto L44A;
+L3E6: // 6E08 LD VE, 0x08
+    STEP(0x3E6, 0x6E08);
+    V[14] = 0x08;
+L3E8: // EEA1 SKNP VE
+    STEP(0x3E8, 0xEEA1);
+    c->pc = 0x3E8;
+    predecode(0xEEA1, &in);
+    execute(c, &in);
+    if (c->pc != 0x3EA) goto dispatch;
+L3EA: // 1462 JP 0x462
+    STEP(0x3EA, 0x1462);
+    goto L462;
+L3EC: // 6E07 LD VE, 0x07
+    STEP(0x3EC, 0x6E07);
+    V[14] = 0x07;
+L3EE: // EEA1 SKNP VE
+    STEP(0x3EE, 0xEEA1);
+    c->pc = 0x3EE;
+    predecode(0xEEA1, &in);
+    execute(c, &in);
+    if (c->pc != 0x3F0) goto dispatch;
+L3F0: // 147A JP 0x47A
+    STEP(0x3F0, 0x147A);
+    goto L47A;
+L3F2: // 4303 SNE V3, 0x03
+    STEP(0x3F2, 0x4303);
+    if (V[3] != 0x03) goto L3F6;
+L3F4: // 7502 ADD V5, 0x02
+    STEP(0x3F4, 0x7502);
+    V[5] += 0x02;
+L3F6: // 4300 SNE V3, 0x00
+    STEP(0x3F6, 0x4300);
+    if (V[3] != 0x00) goto L3FA;
+L3F8: // 75FE ADD V5, 0xFE
+    STEP(0x3F8, 0x75FE);
+    V[5] += 0xFE;
+L3FA: // 4302 SNE V3, 0x02
+    STEP(0x3FA, 0x4302);
+    if (V[3] != 0x02) goto L3FE;
+L3FC: // 7402 ADD V4, 0x02
+    STEP(0x3FC, 0x7402);
+    V[4] += 0x02;
+L3FE: // 4301 SNE V3, 0x01
+    STEP(0x3FE, 0x4301);
+    if (V[3] != 0x01) goto L402;
+L400: // 74FE ADD V4, 0xFE
+    STEP(0x400, 0x74FE);
+    V[4] += 0xFE;
+L402: // 8040 LD V0, V4
+    STEP(0x402, 0x8040);
+    V[0] = V[4];
+L404: // 8150 LD V1, V5
+    STEP(0x404, 0x8150);
+    V[1] = V[5];
+L406: // 27BA CALL 0x7BA
+    STEP(0x406, 0x27BA);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x406;
+    goto L7BA;
+L408: // 8200 LD V2, V0
+    STEP(0x408, 0x8200);
+    V[2] = V[0];
+L40A: // 6E08 LD VE, 0x08
+    STEP(0x40A, 0x6E08);
+    V[14] = 0x08;
+L40C: // 80E2 AND V0, VE
+    STEP(0x40C, 0x80E2);
+    V[0] &= V[14];
+L40E: // 3000 SE V0, 0x00
+    STEP(0x40E, 0x3000);
+    if (V[0] == 0x00) goto L412;
+L410: // 1492 JP 0x492
+    STEP(0x410, 0x1492);
+    goto L492;
+L412: // 6E07 LD VE, 0x07
+    STEP(0x412, 0x6E07);
+    V[14] = 0x07;
+L414: // 8020 LD V0, V2
+    STEP(0x414, 0x8020);
+    V[0] = V[2];
+L416: // 82E2 AND V2, VE
+    STEP(0x416, 0x82E2);
+    V[2] &= V[14];
+L418: // 4205 SNE V2, 0x05
+    STEP(0x418, 0x4205);
+    if (V[2] != 0x05) goto L41C;
+L41A: // 149A JP 0x49A
+    STEP(0x41A, 0x149A);
+    goto L49A;
+L41C: // 4206 SNE V2, 0x06
+    STEP(0x41C, 0x4206);
+    if (V[2] != 0x06) goto L420;
+L41E: // 14B2 JP 0x4B2
+    STEP(0x41E, 0x14B2);
+    goto L4B2;
+L420: // 4207 SNE V2, 0x07
+    STEP(0x420, 0x4207);
+    if (V[2] != 0x07) goto L424;
+L422: // 14EC JP 0x4EC
+    STEP(0x422, 0x14EC);
+    goto L4EC;
+L424: // 2750 CALL 0x750
+    STEP(0x424, 0x2750);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x424;
+    goto L750;
+L426: // 6EFC LD VE, 0xFC
+    STEP(0x426, 0x6EFC);
+    V[14] = 0xFC;
+L428: // 87E2 AND V7, VE
+    STEP(0x428, 0x87E2);
+    V[7] &= V[14];
+L42A: // 8731 OR V7, V3
+    STEP(0x42A, 0x8731);
+    V[7] |= V[3];
+L42C: // 8840 LD V8, V4
+    STEP(0x42C, 0x8840);
+    V[8] = V[4];
+L42E: // 8950 LD V9, V5
+    STEP(0x42E, 0x8950);
+    V[9] = V[5];
+L430: // 1750 JP 0x750
+    STEP(0x430, 0x1750);
+    goto L750;
+L432: // 8040 LD V0, V4
+    STEP(0x432, 0x8040);
+    V[0] = V[4];
+L434: // 8150 LD V1, V5
+    STEP(0x434, 0x8150);
+    V[1] = V[5];
+L436: // 7102 ADD V1, 0x02
+    STEP(0x436, 0x7102);
+    V[1] += 0x02;
+L438: // 27BA CALL 0x7BA
+    STEP(0x438, 0x27BA);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x438;
+    goto L7BA;
+L43A: // 8200 LD V2, V0
+    STEP(0x43A, 0x8200);
+    V[2] = V[0];
+L43C: // 6E08 LD VE, 0x08
+    STEP(0x43C, 0x6E08);
+    V[14] = 0x08;
+L43E: // 80E2 AND V0, VE
+    STEP(0x43E, 0x80E2);
+    V[0] &= V[14];
+L440: // 3000 SE V0, 0x00
+    STEP(0x440, 0x3000);
+    if (V[0] == 0x00) goto L444;
+L442: // 13F2 JP 0x3F2
+    STEP(0x442, 0x13F2);
+    goto L3F2;
+L444: // 6303 LD V3, 0x03
+    STEP(0x444, 0x6303);
+    V[3] = 0x03;
+L446: // 7502 ADD V5, 0x02
+    STEP(0x446, 0x7502);
+    V[5] += 0x02;
+L448: // 140E JP 0x40E
+    STEP(0x448, 0x140E);
+    goto L40E;
+L44A: // 8040 LD V0, V4
+    STEP(0x44A, 0x8040);
+    V[0] = V[4];
+L44C: // 8150 LD V1, V5
+    STEP(0x44C, 0x8150);
+    V[1] = V[5];
+L44E: // 71FE ADD V1, 0xFE
+    STEP(0x44E, 0x71FE);
+    V[1] += 0xFE;
+L450: // 27BA CALL 0x7BA
+    STEP(0x450, 0x27BA);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x450;
+    goto L7BA;
+L452: // 8200 LD V2, V0
+    STEP(0x452, 0x8200);
+    V[2] = V[0];
+L454: // 6E08 LD VE, 0x08
+    STEP(0x454, 0x6E08);
+    V[14] = 0x08;
+L456: // 80E2 AND V0, VE
+    STEP(0x456, 0x80E2);
+    V[0] &= V[14];
+L458: // 3000 SE V0, 0x00
+    STEP(0x458, 0x3000);
+    if (V[0] == 0x00) goto L45C;
+L45A: // 13F2 JP 0x3F2
+    STEP(0x45A, 0x13F2);
+    goto L3F2;
+L45C: // 6300 LD V3, 0x00
+    STEP(0x45C, 0x6300);
+    V[3] = 0x00;
+L45E: // 75FE ADD V5, 0xFE
+    STEP(0x45E, 0x75FE);
+    V[5] += 0xFE;
+L460: // 140E JP 0x40E
+    STEP(0x460, 0x140E);
+    goto L40E;
+L462: // 8040 LD V0, V4
+    STEP(0x462, 0x8040);
+    V[0] = V[4];
+L464: // 8150 LD V1, V5
+    STEP(0x464, 0x8150);
+    V[1] = V[5];
+L466: // 7002 ADD V0, 0x02
+    STEP(0x466, 0x7002);
+    V[0] += 0x02;
+L468: // 27BA CALL 0x7BA
+    STEP(0x468, 0x27BA);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x468;
+    goto L7BA;
+L46A: // 8200 LD V2, V0
+    STEP(0x46A, 0x8200);
+    V[2] = V[0];
+L46C: // 6E08 LD VE, 0x08
+    STEP(0x46C, 0x6E08);
+    V[14] = 0x08;
+L46E: // 80E2 AND V0, VE
+    STEP(0x46E, 0x80E2);
+    V[0] &= V[14];
+L470: // 3000 SE V0, 0x00
+    STEP(0x470, 0x3000);
+    if (V[0] == 0x00) goto L474;
+L472: // 13F2 JP 0x3F2
+    STEP(0x472, 0x13F2);
+    goto L3F2;
+L474: // 6302 LD V3, 0x02
+    STEP(0x474, 0x6302);
+    V[3] = 0x02;
+L476: // 7402 ADD V4, 0x02
+    STEP(0x476, 0x7402);
+    V[4] += 0x02;
+L478: // 140E JP 0x40E
+    STEP(0x478, 0x140E);
+    goto L40E;
+L47A: // 8040 LD V0, V4
+    STEP(0x47A, 0x8040);
+    V[0] = V[4];
+L47C: // 8150 LD V1, V5
+    STEP(0x47C, 0x8150);
+    V[1] = V[5];
+L47E: // 70FE ADD V0, 0xFE
+    STEP(0x47E, 0x70FE);
+    V[0] += 0xFE;
+L480: // 27BA CALL 0x7BA
+    STEP(0x480, 0x27BA);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x480;
+    goto L7BA;
+L482: // 8200 LD V2, V0
+    STEP(0x482, 0x8200);
+    V[2] = V[0];
+L484: // 6E08 LD VE, 0x08
+    STEP(0x484, 0x6E08);
+    V[14] = 0x08;
+L486: // 80E2 AND V0, VE
+    STEP(0x486, 0x80E2);
+    V[0] &= V[14];
+L488: // 3000 SE V0, 0x00
+    STEP(0x488, 0x3000);
+    if (V[0] == 0x00) goto L48C;
+L48A: // 13F2 JP 0x3F2
+    STEP(0x48A, 0x13F2);
+    goto L3F2;
+L48C: // 6301 LD V3, 0x01
+    STEP(0x48C, 0x6301);
+    V[3] = 0x01;
+L48E: // 74FE ADD V4, 0xFE
+    STEP(0x48E, 0x74FE);
+    V[4] += 0xFE;
+L490: // 140E JP 0x40E
+    STEP(0x490, 0x140E);
+    goto L40E;
+L492: // 2750 CALL 0x750
+    STEP(0x492, 0x2750);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x492;
+    goto L750;
+L494: // D894 DRW V8, V9, 4
+    STEP(0x494, 0xD894);
+    c->pc = 0x494;
+    predecode(0xD894, &in);
+    execute(c, &in);
+    if (c->pc != 0x496) goto dispatch;
+L496: // 8EF0 LD VE, VF
+    STEP(0x496, 0x8EF0);
+    V[14] = V[15];
+L498: // 00EE RET
+    STEP(0x498, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L49A: // 6EF0 LD VE, 0xF0
+    STEP(0x49A, 0x6EF0);
+    V[14] = 0xF0;
+L49C: // 80E2 AND V0, VE
+    STEP(0x49C, 0x80E2);
+    V[0] &= V[14];
+L49E: // 8031 OR V0, V3
+    STEP(0x49E, 0x8031);
+    V[0] |= V[3];
+L4A0: // F055 LD [I], V0
+    STEP(0x4A0, 0xF055);
+    c->pc = 0x4A0;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x4A2) goto dispatch;
+L4A2: // A8F1 LD I, 0x8F1
+    STEP(0x4A2, 0xA8F1);
+    c->I = 0x8F1;
+L4A4: // D454 DRW V4, V5, 4
+    STEP(0x4A4, 0xD454);
+    c->pc = 0x4A4;
+    predecode(0xD454, &in);
+    execute(c, &in);
+    if (c->pc != 0x4A6) goto dispatch;
+L4A6: // 7601 ADD V6, 0x01
+    STEP(0x4A6, 0x7601);
+    V[6] += 0x01;
+L4A8: // 6105 LD V1, 0x05
+    STEP(0x4A8, 0x6105);
+    V[1] = 0x05;
+L4AA: // F007 LD V0, DT
+    STEP(0x4AA, 0xF007);
+    V[0] = c->dt;
+L4AC: // 4000 SNE V0, 0x00
+    STEP(0x4AC, 0x4000);
+    if (V[0] != 0x00) goto L4B0;
+L4AE: // F118 LD ST, V1
+    STEP(0x4AE, 0xF118);
+    c->st = V[1];
+L4B0: // 1424 JP 0x424
+    STEP(0x4B0, 0x1424);
+    goto L424;
+L4B2: // 6EF0 LD VE, 0xF0
+    STEP(0x4B2, 0x6EF0);
+    V[14] = 0xF0;
+L4B4: // 80E2 AND V0, VE
+    STEP(0x4B4, 0x80E2);
+    V[0] &= V[14];
+L4B6: // 8031 OR V0, V3
+    STEP(0x4B6, 0x8031);
+    V[0] |= V[3];
+L4B8: // F055 LD [I], V0
+    STEP(0x4B8, 0xF055);
+    c->pc = 0x4B8;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x4BA) goto dispatch;
+L4BA: // A8F5 LD I, 0x8F5
+    STEP(0x4BA, 0xA8F5);
+    c->I = 0x8F5;
+L4BC: // D454 DRW V4, V5, 4
+    STEP(0x4BC, 0xD454);
+    c->pc = 0x4BC;
+    predecode(0xD454, &in);
+    execute(c, &in);
+    if (c->pc != 0x4BE) goto dispatch;
+L4BE: // 7604 ADD V6, 0x04
+    STEP(0x4BE, 0x7604);
+    V[6] += 0x04;
+L4C0: // 80A0 LD V0, VA
+    STEP(0x4C0, 0x80A0);
+    V[0] = V[10];
+L4C2: // 81B0 LD V1, VB
+    STEP(0x4C2, 0x81B0);
+    V[1] = V[11];
+L4C4: // 27BA CALL 0x7BA
+    STEP(0x4C4, 0x27BA);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x4C4;
+    goto L7BA;
+L4C6: // 6EF0 LD VE, 0xF0
+    STEP(0x4C6, 0x6EF0);
+    V[14] = 0xF0;
+L4C8: // 80E2 AND V0, VE
+    STEP(0x4C8, 0x80E2);
+    V[0] &= V[14];
+L4CA: // 3000 SE V0, 0x00
+    STEP(0x4CA, 0x3000);
+    if (V[0] == 0x00) goto L4CE;
+L4CC: // 14D2 JP 0x4D2
+    STEP(0x4CC, 0x14D2);
+    goto L4D2;
+L4CE: // 6E0C LD VE, 0x0C
+    STEP(0x4CE, 0x6E0C);
+    V[14] = 0x0C;
+L4D0: // 87E3 XOR V7, VE
+    STEP(0x4D0, 0x87E3);
+    V[7] ^= V[14];
+L4D2: // 80C0 LD V0, VC
+    STEP(0x4D2, 0x80C0);
+    V[0] = V[12];
+L4D4: // 81D0 LD V1, VD
+    STEP(0x4D4, 0x81D0);
+    V[1] = V[13];
+L4D6: // 27BA CALL 0x7BA
+    STEP(0x4D6, 0x27BA);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x4D6;
+    goto L7BA;
+L4D8: // 6EF0 LD VE, 0xF0
+    STEP(0x4D8, 0x6EF0);
+    V[14] = 0xF0;
+L4DA: // 80E2 AND V0, VE
+    STEP(0x4DA, 0x80E2);
+    V[0] &= V[14];
+L4DC: // 3000 SE V0, 0x00
+    STEP(0x4DC, 0x3000);
+    if (V[0] == 0x00) goto L4E0;
+L4DE: // 14E4 JP 0x4E4
+    STEP(0x4DE, 0x14E4);
+    goto L4E4;
+L4E0: // 6E30 LD VE, 0x30
+    STEP(0x4E0, 0x6E30);
+    V[14] = 0x30;
+L4E2: // 87E3 XOR V7, VE
+    STEP(0x4E2, 0x87E3);
+    V[7] ^= V[14];
+L4E4: // 60FF LD V0, 0xFF
+    STEP(0x4E4, 0x60FF);
+    V[0] = 0xFF;
+L4E6: // F018 LD ST, V0
+    STEP(0x4E6, 0xF018);
+    c->st = V[0];
+L4E8: // F015 LD DT, V0
+    STEP(0x4E8, 0xF015);
+    c->dt = V[0];
+L4EA: // 1424 JP 0x424
+    STEP(0x4EA, 0x1424);
+    goto L424;
+L4EC: // 4301 SNE V3, 0x01
+    STEP(0x4EC, 0x4301);
+    if (V[3] != 0x01) goto L4F0;
+L4EE: // 643A LD V4, 0x3A
+    STEP(0x4EE, 0x643A);
+    V[4] = 0x3A;
+L4F0: // 4302 SNE V3, 0x02
+    STEP(0x4F0, 0x4302);
+    if (V[3] != 0x02) goto L4F4;
+L4F2: // 6400 LD V4, 0x00
+    STEP(0x4F2, 0x6400);
+    V[4] = 0x00;
+L4F4: // 1424 JP 0x424
+    STEP(0x4F4, 0x1424);
+    goto L424;
+L4F6: // 8270 LD V2, V7
+    STEP(0x4F6, 0x8270);
+    V[2] = V[7];
+L4F8: // 8370 LD V3, V7
+    STEP(0x4F8, 0x8370);
+    V[3] = V[7];
+L4FA: // 6E0C LD VE, 0x0C
+    STEP(0x4FA, 0x6E0C);
+    V[14] = 0x0C;
+L4FC: // 82E2 AND V2, VE
+    STEP(0x4FC, 0x82E2);
+    V[2] &= V[14];
+L4FE: // 80A0 LD V0, VA
+    STEP(0x4FE, 0x80A0);
+    V[0] = V[10];
+L500: // 81B0 LD V1, VB
+    STEP(0x500, 0x81B0);
+    V[1] = V[11];
+L502: // 27BA CALL 0x7BA
+    STEP(0x502, 0x27BA);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x502;
+    goto L7BA;
+L504: // A8ED LD I, 0x8ED
+    STEP(0x504, 0xA8ED);
+    c->I = 0x8ED;
+L506: // 6EF0 LD VE, 0xF0
+    STEP(0x506, 0x6EF0);
+    V[14] = 0xF0;
+L508: // 80E2 AND V0, VE
+    STEP(0x508, 0x80E2);
+    V[0] &= V[14];
+L50A: // 3000 SE V0, 0x00
+    STEP(0x50A, 0x3000);
+    if (V[0] == 0x00) goto L50E;
+L50C: // 1524 JP 0x524
+    STEP(0x50C, 0x1524);
+    goto L524;
+L50E: // DAB4 DRW VA, VB, 4
+    STEP(0x50E, 0xDAB4);
+    c->pc = 0x50E;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x510) goto dispatch;
+L510: // 420C SNE V2, 0x0C
+    STEP(0x510, 0x420C);
+    if (V[2] != 0x0C) goto L514;
+L512: // 7B02 ADD VB, 0x02
+    STEP(0x512, 0x7B02);
+    V[11] += 0x02;
+L514: // 4200 SNE V2, 0x00
+    STEP(0x514, 0x4200);
+    if (V[2] != 0x00) goto L518;
+L516: // 7BFE ADD VB, 0xFE
+    STEP(0x516, 0x7BFE);
+    V[11] += 0xFE;
+L518: // 4208 SNE V2, 0x08
+    STEP(0x518, 0x4208);
+    if (V[2] != 0x08) goto L51C;
+L51A: // 7A02 ADD VA, 0x02
+    STEP(0x51A, 0x7A02);
+    V[10] += 0x02;
+L51C: // 4204 SNE V2, 0x04
+    STEP(0x51C, 0x4204);
+    if (V[2] != 0x04) goto L520;
+L51E: // 7AFE ADD VA, 0xFE
+    STEP(0x51E, 0x7AFE);
+    V[10] += 0xFE;
+L520: // DAB4 DRW VA, VB, 4
+    STEP(0x520, 0xDAB4);
+    c->pc = 0x520;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x522) goto dispatch;
+L522: // 00EE RET
+    STEP(0x522, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L524: // 6E80 LD VE, 0x80
+    STEP(0x524, 0x6E80);
+    V[14] = 0x80;
+L526: // F107 LD V1, DT
+    STEP(0x526, 0xF107);
+    V[1] = c->dt;
+L528: // 3100 SE V1, 0x00
+    STEP(0x528, 0x3100);
+    if (V[1] == 0x00) goto L52C;
+L52A: // 15D4 JP 0x5D4
+    STEP(0x52A, 0x15D4);
+    goto L5D4;
+L52C: // 3400 SE V4, 0x00
+    STEP(0x52C, 0x3400);
+    if (V[4] == 0x00) goto L530;
+L52E: // 15D4 JP 0x5D4
+    STEP(0x52E, 0x15D4);
+    goto L5D4;
+L530: // 8100 LD V1, V0
+    STEP(0x530, 0x8100);
+    V[1] = V[0];
+L532: // 830E SHL V3, V0
+    STEP(0x532, 0x830E);
+    V[15] = V[3] >> 7;
+    V[3] <<= 1;
+L534: // 3F00 SE VF, 0x00
+    STEP(0x534, 0x3F00);
+    if (V[15] == 0x00) goto L538;
+L536: // 1556 JP 0x556
+    STEP(0x536, 0x1556);
+    goto L556;
+L538: // 8390 LD V3, V9
+    STEP(0x538, 0x8390);
+    V[3] = V[9];
+L53A: // 83B5 SUB V3, VB
+    STEP(0x53A, 0x83B5);
+    V[15] = V[3] > V[11];
+    V[3] -= V[11];
+L53C: // 4F00 SNE VF, 0x00
+    STEP(0x53C, 0x4F00);
+    if (V[15] != 0x00) goto L540;
+L53E: // 158C JP 0x58C
+    STEP(0x53E, 0x158C);
+    goto L58C;
+L540: // 3300 SE V3, 0x00
+    STEP(0x540, 0x3300);
+    if (V[3] == 0x00) goto L544;
+L542: // 1574 JP 0x574
+    STEP(0x542, 0x1574);
+    goto L574;
+L544: // 87E3 XOR V7, VE
+    STEP(0x544, 0x87E3);
+    V[7] ^= V[14];
+L546: // 8380 LD V3, V8
+    STEP(0x546, 0x8380);
+    V[3] = V[8];
+L548: // 83A5 SUB V3, VA
+    STEP(0x548, 0x83A5);
+    V[15] = V[3] > V[10];
+    V[3] -= V[10];
+L54A: // 4F00 SNE VF, 0x00
+    STEP(0x54A, 0x4F00);
+    if (V[15] != 0x00) goto L54E;
+L54C: // 15BC JP 0x5BC
+    STEP(0x54C, 0x15BC);
+    goto L5BC;
+L54E: // 3300 SE V3, 0x00
+    STEP(0x54E, 0x3300);
+    if (V[3] == 0x00) goto L552;
+L550: // 15A4 JP 0x5A4
+    STEP(0x550, 0x15A4);
+    goto L5A4;
+L552: // 87E3 XOR V7, VE
+    STEP(0x552, 0x87E3);
+    V[7] ^= V[14];
+L554: // 15D4 JP 0x5D4
+    STEP(0x554, 0x15D4);
+    goto L5D4;
+L556: // 8380 LD V3, V8
+    STEP(0x556, 0x8380);
+    V[3] = V[8];
+L558: // 83A5 SUB V3, VA
+    STEP(0x558, 0x83A5);
+    V[15] = V[3] > V[10];
+    V[3] -= V[10];
+L55A: // 4F00 SNE VF, 0x00
+    STEP(0x55A, 0x4F00);
+    if (V[15] != 0x00) goto L55E;
+L55C: // 15BC JP 0x5BC
+    STEP(0x55C, 0x15BC);
+    goto L5BC;
+L55E: // 3300 SE V3, 0x00
+    STEP(0x55E, 0x3300);
+    if (V[3] == 0x00) goto L562;
+L560: // 15A4 JP 0x5A4
+    STEP(0x560, 0x15A4);
+    goto L5A4;
+L562: // 87E3 XOR V7, VE
+    STEP(0x562, 0x87E3);
+    V[7] ^= V[14];
+L564: // 8390 LD V3, V9
+    STEP(0x564, 0x8390);
+    V[3] = V[9];
+L566: // 83B5 SUB V3, VB
+    STEP(0x566, 0x83B5);
+    V[15] = V[3] > V[11];
+    V[3] -= V[11];
+L568: // 4F00 SNE VF, 0x00
+    STEP(0x568, 0x4F00);
+    if (V[15] != 0x00) goto L56C;
+L56A: // 158C JP 0x58C
+    STEP(0x56A, 0x158C);
+    goto L58C;
+L56C: // 3300 SE V3, 0x00
+    STEP(0x56C, 0x3300);
+    if (V[3] == 0x00) goto L570;
+L56E: // 1574 JP 0x574
+    STEP(0x56E, 0x1574);
+    goto L574;
+L570: // 87E3 XOR V7, VE
+    STEP(0x570, 0x87E3);
+    V[7] ^= V[14];
+L572: // 15D4 JP 0x5D4
+    STEP(0x572, 0x15D4);
+    goto L5D4;
+L574: // 6340 LD V3, 0x40
+    STEP(0x574, 0x6340);
+    V[3] = 0x40;
+L576: // 8132 AND V1, V3
+    STEP(0x576, 0x8132);
+    V[1] &= V[3];
+L578: // 4100 SNE V1, 0x00
+    STEP(0x578, 0x4100);
+    if (V[1] != 0x00) goto L57C;
+L57A: // 15D4 JP 0x5D4
+    STEP(0x57A, 0x15D4);
+    goto L5D4;
+L57C: // DAB4 DRW VA, VB, 4
+    STEP(0x57C, 0xDAB4);
+    c->pc = 0x57C;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x57E) goto dispatch;
+L57E: // 7B02 ADD VB, 0x02
+    STEP(0x57E, 0x7B02);
+    V[11] += 0x02;
+L580: // DAB4 DRW VA, VB, 4
+    STEP(0x580, 0xDAB4);
+    c->pc = 0x580;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x582) goto dispatch;
+L582: // 6EF3 LD VE, 0xF3
+    STEP(0x582, 0x6EF3);
+    V[14] = 0xF3;
+L584: // 87E2 AND V7, VE
+    STEP(0x584, 0x87E2);
+    V[7] &= V[14];
+L586: // 620C LD V2, 0x0C
+    STEP(0x586, 0x620C);
+    V[2] = 0x0C;
+L588: // 8721 OR V7, V2
+    STEP(0x588, 0x8721);
+    V[7] |= V[2];
+L58A: // 00EE RET
+    STEP(0x58A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L58C: // 6310 LD V3, 0x10
+    STEP(0x58C, 0x6310);
+    V[3] = 0x10;
+L58E: // 8132 AND V1, V3
+    STEP(0x58E, 0x8132);
+    V[1] &= V[3];
+L590: // 4100 SNE V1, 0x00
+    STEP(0x590, 0x4100);
+    if (V[1] != 0x00) goto L594;
+L592: // 15D4 JP 0x5D4
+    STEP(0x592, 0x15D4);
+    goto L5D4;
+L594: // DAB4 DRW VA, VB, 4
+    STEP(0x594, 0xDAB4);
+    c->pc = 0x594;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x596) goto dispatch;
+L596: // 7BFE ADD VB, 0xFE
+    STEP(0x596, 0x7BFE);
+    V[11] += 0xFE;
+L598: // DAB4 DRW VA, VB, 4
+    STEP(0x598, 0xDAB4);
+    c->pc = 0x598;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x59A) goto dispatch;
+L59A: // 6EF3 LD VE, 0xF3
+    STEP(0x59A, 0x6EF3);
+    V[14] = 0xF3;
+L59C: // 87E2 AND V7, VE
+    STEP(0x59C, 0x87E2);
+    V[7] &= V[14];
+L59E: // 6200 LD V2, 0x00
+    STEP(0x59E, 0x6200);
+    V[2] = 0x00;
+L5A0: // 8721 OR V7, V2
+    STEP(0x5A0, 0x8721);
+    V[7] |= V[2];
+L5A2: // 00EE RET
+    STEP(0x5A2, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L5A4: // 6320 LD V3, 0x20
+    STEP(0x5A4, 0x6320);
+    V[3] = 0x20;
+L5A6: // 8132 AND V1, V3
+    STEP(0x5A6, 0x8132);
+    V[1] &= V[3];
+L5A8: // 4100 SNE V1, 0x00
+    STEP(0x5A8, 0x4100);
+    if (V[1] != 0x00) goto L5AC;
+L5AA: // 15D4 JP 0x5D4
+    STEP(0x5AA, 0x15D4);
+    goto L5D4;
+L5AC: // DAB4 DRW VA, VB, 4
+    STEP(0x5AC, 0xDAB4);
+    c->pc = 0x5AC;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x5AE) goto dispatch;
+L5AE: // 7A02 ADD VA, 0x02
+    STEP(0x5AE, 0x7A02);
+    V[10] += 0x02;
+L5B0: // DAB4 DRW VA, VB, 4
+    STEP(0x5B0, 0xDAB4);
+    c->pc = 0x5B0;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x5B2) goto dispatch;
+L5B2: // 6EF3 LD VE, 0xF3
+    STEP(0x5B2, 0x6EF3);
+    V[14] = 0xF3;
+L5B4: // 87E2 AND V7, VE
+    STEP(0x5B4, 0x87E2);
+    V[7] &= V[14];
+L5B6: // 6208 LD V2, 0x08
+    STEP(0x5B6, 0x6208);
+    V[2] = 0x08;
+L5B8: // 8721 OR V7, V2
+    STEP(0x5B8, 0x8721);
+    V[7] |= V[2];
+L5BA: // 00EE RET
+    STEP(0x5BA, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L5BC: // 6380 LD V3, 0x80
+    STEP(0x5BC, 0x6380);
+    V[3] = 0x80;
+L5BE: // 8132 AND V1, V3
+    STEP(0x5BE, 0x8132);
+    V[1] &= V[3];
+L5C0: // 4100 SNE V1, 0x00
+    STEP(0x5C0, 0x4100);
+    if (V[1] != 0x00) goto L5C4;
+L5C2: // 15D4 JP 0x5D4
+    STEP(0x5C2, 0x15D4);
+    goto L5D4;
+L5C4: // DAB4 DRW VA, VB, 4
+    STEP(0x5C4, 0xDAB4);
+    c->pc = 0x5C4;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x5C6) goto dispatch;
+L5C6: // 7AFE ADD VA, 0xFE
+    STEP(0x5C6, 0x7AFE);
+    V[10] += 0xFE;
+L5C8: // DAB4 DRW VA, VB, 4
+    STEP(0x5C8, 0xDAB4);
+    c->pc = 0x5C8;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x5CA) goto dispatch;
+L5CA: // 6EF3 LD VE, 0xF3
+    STEP(0x5CA, 0x6EF3);
+    V[14] = 0xF3;
+L5CC: // 87E2 AND V7, VE
+    STEP(0x5CC, 0x87E2);
+    V[7] &= V[14];
+L5CE: // 6204 LD V2, 0x04
+    STEP(0x5CE, 0x6204);
+    V[2] = 0x04;
+L5D0: // 8721 OR V7, V2
+    STEP(0x5D0, 0x8721);
+    V[7] |= V[2];
+L5D2: // 00EE RET
+    STEP(0x5D2, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L5D4: // C1F0 RND V1, 0xF0
+    STEP(0x5D4, 0xC1F0);
+    c->pc = 0x5D4;
+    predecode(0xC1F0, &in);
+    execute(c, &in);
+    if (c->pc != 0x5D6) goto dispatch;
+L5D6: // 8012 AND V0, V1
+    STEP(0x5D6, 0x8012);
+    V[0] &= V[1];
+L5D8: // 3000 SE V0, 0x00
+    STEP(0x5D8, 0x3000);
+    if (V[0] == 0x00) goto L5DC;
+L5DA: // 15E4 JP 0x5E4
+    STEP(0x5DA, 0x15E4);
+    goto L5E4;
+L5DC: // 6E0C LD VE, 0x0C
+    STEP(0x5DC, 0x6E0C);
+    V[14] = 0x0C;
+L5DE: // 87E3 XOR V7, VE
+    STEP(0x5DE, 0x87E3);
+    V[7] ^= V[14];
+L5E0: // 82E3 XOR V2, VE
+    STEP(0x5E0, 0x82E3);
+    V[2] ^= V[14];
+L5E2: // 150E JP 0x50E
+    STEP(0x5E2, 0x150E);
+    goto L50E;
+L5E4: // DAB4 DRW VA, VB, 4
+    STEP(0x5E4, 0xDAB4);
+    c->pc = 0x5E4;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x5E6) goto dispatch;
+L5E6: // 800E SHL V0, V0
+    STEP(0x5E6, 0x800E);
+    V[15] = V[0] >> 7;
+    V[0] <<= 1;
+L5E8: // 4F00 SNE VF, 0x00
+    STEP(0x5E8, 0x4F00);
+    if (V[15] != 0x00) goto L5EC;
+L5EA: // 15F2 JP 0x5F2
+    STEP(0x5EA, 0x15F2);
+    goto L5F2;
+L5EC: // 6204 LD V2, 0x04
+    STEP(0x5EC, 0x6204);
+    V[2] = 0x04;
+L5EE: // 7AFE ADD VA, 0xFE
+    STEP(0x5EE, 0x7AFE);
+    V[10] += 0xFE;
+L5F0: // 1614 JP 0x614
+    STEP(0x5F0, 0x1614);
+    goto L614;
+L5F2: // 800E SHL V0, V0
+    STEP(0x5F2, 0x800E);
+    V[15] = V[0] >> 7;
+    V[0] <<= 1;
+L5F4: // 4F00 SNE VF, 0x00
+    STEP(0x5F4, 0x4F00);
+    if (V[15] != 0x00) goto L5F8;
+L5F6: // 15FE JP 0x5FE
+    STEP(0x5F6, 0x15FE);
+    goto L5FE;
+L5F8: // 620C LD V2, 0x0C
+    STEP(0x5F8, 0x620C);
+    V[2] = 0x0C;
+L5FA: // 7B02 ADD VB, 0x02
+    STEP(0x5FA, 0x7B02);
+    V[11] += 0x02;
+L5FC: // 1614 JP 0x614
+    STEP(0x5FC, 0x1614);
+    goto L614;
+L5FE: // 800E SHL V0, V0
+    STEP(0x5FE, 0x800E);
+    V[15] = V[0] >> 7;
+    V[0] <<= 1;
+L600: // 4F00 SNE VF, 0x00
+    STEP(0x600, 0x4F00);
+    if (V[15] != 0x00) goto L604;
+L602: // 160A JP 0x60A
+    STEP(0x602, 0x160A);
+    goto L60A;
+L604: // 6208 LD V2, 0x08
+    STEP(0x604, 0x6208);
+    V[2] = 0x08;
+L606: // 7A02 ADD VA, 0x02
+    STEP(0x606, 0x7A02);
+    V[10] += 0x02;
+L608: // 1614 JP 0x614
+    STEP(0x608, 0x1614);
+    goto L614;
+L60A: // 800E SHL V0, V0
+    STEP(0x60A, 0x800E);
+    V[15] = V[0] >> 7;
+    V[0] <<= 1;
+L60C: // 4F00 SNE VF, 0x00
+    STEP(0x60C, 0x4F00);
+    if (V[15] != 0x00) goto L610;
+L60E: // 15DC JP 0x5DC
+    STEP(0x60E, 0x15DC);
+    goto L5DC;
+L610: // 6200 LD V2, 0x00
+    STEP(0x610, 0x6200);
+    V[2] = 0x00;
+L612: // 7BFE ADD VB, 0xFE
+    STEP(0x612, 0x7BFE);
+    V[11] += 0xFE;
+L614: // DAB4 DRW VA, VB, 4
+    STEP(0x614, 0xDAB4);
+    c->pc = 0x614;
+    predecode(0xDAB4, &in);
+    execute(c, &in);
+    if (c->pc != 0x616) goto dispatch;
+L616: // 6EF3 LD VE, 0xF3
+    STEP(0x616, 0x6EF3);
+    V[14] = 0xF3;
+L618: // 87E2 AND V7, VE
+    STEP(0x618, 0x87E2);
+    V[7] &= V[14];
+L61A: // 8721 OR V7, V2
+    STEP(0x61A, 0x8721);
+    V[7] |= V[2];
+L61C: // 00EE RET
+    STEP(0x61C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L61E: // 8270 LD V2, V7
+    STEP(0x61E, 0x8270);
+    V[2] = V[7];
+L620: // 8370 LD V3, V7
+    STEP(0x620, 0x8370);
+    V[3] = V[7];
+L622: // 6E30 LD VE, 0x30
+    STEP(0x622, 0x6E30);
+    V[14] = 0x30;
+L624: // 82E2 AND V2, VE
+    STEP(0x624, 0x82E2);
+    V[2] &= V[14];
+L626: // 80C0 LD V0, VC
+    STEP(0x626, 0x80C0);
+    V[0] = V[12];
+L628: // 81D0 LD V1, VD
+    STEP(0x628, 0x81D0);
+    V[1] = V[13];
+L62A: // 27BA CALL 0x7BA
+    STEP(0x62A, 0x27BA);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x62A;
+    goto L7BA;
+L62C: // A8ED LD I, 0x8ED
+    STEP(0x62C, 0xA8ED);
+    c->I = 0x8ED;
+L62E: // 6EF0 LD VE, 0xF0
+    STEP(0x62E, 0x6EF0);
+    V[14] = 0xF0;
+L630: // 80E2 AND V0, VE
+    STEP(0x630, 0x80E2);
+    V[0] &= V[14];
+L632: // 3000 SE V0, 0x00
+    STEP(0x632, 0x3000);
+    if (V[0] == 0x00) goto L636;
+L634: // 164C JP 0x64C
+    STEP(0x634, 0x164C);
+    goto L64C;
+L636: // DCD4 DRW VC, VD, 4
+    STEP(0x636, 0xDCD4);
+    c->pc = 0x636;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x638) goto dispatch;
+L638: // 4230 SNE V2, 0x30
+    STEP(0x638, 0x4230);
+    if (V[2] != 0x30) goto L63C;
+L63A: // 7D02 ADD VD, 0x02
+    STEP(0x63A, 0x7D02);
+    V[13] += 0x02;
+L63C: // 4200 SNE V2, 0x00
+    STEP(0x63C, 0x4200);
+    if (V[2] != 0x00) goto L640;
+L63E: // 7DFE ADD VD, 0xFE
+    STEP(0x63E, 0x7DFE);
+    V[13] += 0xFE;
+L640: // 4220 SNE V2, 0x20
+    STEP(0x640, 0x4220);
+    if (V[2] != 0x20) goto L644;
+L642: // 7C02 ADD VC, 0x02
+    STEP(0x642, 0x7C02);
+    V[12] += 0x02;
+L644: // 4210 SNE V2, 0x10
+    STEP(0x644, 0x4210);
+    if (V[2] != 0x10) goto L648;
+L646: // 7CFE ADD VC, 0xFE
+    STEP(0x646, 0x7CFE);
+    V[12] += 0xFE;
+L648: // DCD4 DRW VC, VD, 4
+    STEP(0x648, 0xDCD4);
+    c->pc = 0x648;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x64A) goto dispatch;
+L64A: // 00EE RET
+    STEP(0x64A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L64C: // 6E80 LD VE, 0x80
+    STEP(0x64C, 0x6E80);
+    V[14] = 0x80;
+L64E: // F107 LD V1, DT
+    STEP(0x64E, 0xF107);
+    V[1] = c->dt;
+L650: // 3100 SE V1, 0x00
+    STEP(0x650, 0x3100);
+    if (V[1] == 0x00) goto L654;
+L652: // 1704 JP 0x704
+    STEP(0x652, 0x1704);
+    goto L704;
+L654: // 3400 SE V4, 0x00
+    STEP(0x654, 0x3400);
+    if (V[4] == 0x00) goto L658;
+L656: // 1704 JP 0x704
+    STEP(0x656, 0x1704);
+    goto L704;
+L658: // 8100 LD V1, V0
+    STEP(0x658, 0x8100);
+    V[1] = V[0];
+L65A: // 830E SHL V3, V0
+    STEP(0x65A, 0x830E);
+    V[15] = V[3] >> 7;
+    V[3] <<= 1;
+L65C: // 4F00 SNE VF, 0x00
+    STEP(0x65C, 0x4F00);
+    if (V[15] != 0x00) goto L660;
+L65E: // 167E JP 0x67E
+    STEP(0x65E, 0x167E);
+    goto L67E;
+L660: // 8390 LD V3, V9
+    STEP(0x660, 0x8390);
+    V[3] = V[9];
+L662: // 83D5 SUB V3, VD
+    STEP(0x662, 0x83D5);
+    V[15] = V[3] > V[13];
+    V[3] -= V[13];
+L664: // 4F00 SNE VF, 0x00
+    STEP(0x664, 0x4F00);
+    if (V[15] != 0x00) goto L668;
+L666: // 16B6 JP 0x6B6
+    STEP(0x666, 0x16B6);
+    goto L6B6;
+L668: // 3300 SE V3, 0x00
+    STEP(0x668, 0x3300);
+    if (V[3] == 0x00) goto L66C;
+L66A: // 169C JP 0x69C
+    STEP(0x66A, 0x169C);
+    goto L69C;
+L66C: // 87E3 XOR V7, VE
+    STEP(0x66C, 0x87E3);
+    V[7] ^= V[14];
+L66E: // 8380 LD V3, V8
+    STEP(0x66E, 0x8380);
+    V[3] = V[8];
+L670: // 83C5 SUB V3, VC
+    STEP(0x670, 0x83C5);
+    V[15] = V[3] > V[12];
+    V[3] -= V[12];
+L672: // 4F00 SNE VF, 0x00
+    STEP(0x672, 0x4F00);
+    if (V[15] != 0x00) goto L676;
+L674: // 16EA JP 0x6EA
+    STEP(0x674, 0x16EA);
+    goto L6EA;
+L676: // 3300 SE V3, 0x00
+    STEP(0x676, 0x3300);
+    if (V[3] == 0x00) goto L67A;
+L678: // 16D0 JP 0x6D0
+    STEP(0x678, 0x16D0);
+    goto L6D0;
+L67A: // 87E3 XOR V7, VE
+    STEP(0x67A, 0x87E3);
+    V[7] ^= V[14];
+L67C: // 1704 JP 0x704
+    STEP(0x67C, 0x1704);
+    goto L704;
+L67E: // 8380 LD V3, V8
+    STEP(0x67E, 0x8380);
+    V[3] = V[8];
+L680: // 83C5 SUB V3, VC
+    STEP(0x680, 0x83C5);
+    V[15] = V[3] > V[12];
+    V[3] -= V[12];
+L682: // 4F00 SNE VF, 0x00
+    STEP(0x682, 0x4F00);
+    if (V[15] != 0x00) goto L686;
+L684: // 16EA JP 0x6EA
+    STEP(0x684, 0x16EA);
+    goto L6EA;
+L686: // 3300 SE V3, 0x00
+    STEP(0x686, 0x3300);
+    if (V[3] == 0x00) goto L68A;
+L688: // 16D0 JP 0x6D0
+    STEP(0x688, 0x16D0);
+    goto L6D0;
+L68A: // 87E3 XOR V7, VE
+    STEP(0x68A, 0x87E3);
+    V[7] ^= V[14];
+L68C: // 8390 LD V3, V9
+    STEP(0x68C, 0x8390);
+    V[3] = V[9];
+L68E: // 83D5 SUB V3, VD
+    STEP(0x68E, 0x83D5);
+    V[15] = V[3] > V[13];
+    V[3] -= V[13];
+L690: // 4F00 SNE VF, 0x00
+    STEP(0x690, 0x4F00);
+    if (V[15] != 0x00) goto L694;
+L692: // 16B6 JP 0x6B6
+    STEP(0x692, 0x16B6);
+    goto L6B6;
+L694: // 3300 SE V3, 0x00
+    STEP(0x694, 0x3300);
+    if (V[3] == 0x00) goto L698;
+L696: // 169C JP 0x69C
+    STEP(0x696, 0x169C);
+    goto L69C;
+L698: // 87E3 XOR V7, VE
+    STEP(0x698, 0x87E3);
+    V[7] ^= V[14];
+L69A: // 1704 JP 0x704
+    STEP(0x69A, 0x1704);
+    goto L704;
+L69C: // 6340 LD V3, 0x40
+    STEP(0x69C, 0x6340);
+    V[3] = 0x40;
+L69E: // 8132 AND V1, V3
+    STEP(0x69E, 0x8132);
+    V[1] &= V[3];
+L6A0: // 4100 SNE V1, 0x00
+    STEP(0x6A0, 0x4100);
+    if (V[1] != 0x00) goto L6A4;
+L6A2: // 1704 JP 0x704
+    STEP(0x6A2, 0x1704);
+    goto L704;
+L6A4: // DCD4 DRW VC, VD, 4
+    STEP(0x6A4, 0xDCD4);
+    c->pc = 0x6A4;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x6A6) goto dispatch;
+L6A6: // 7D02 ADD VD, 0x02
+    STEP(0x6A6, 0x7D02);
+    V[13] += 0x02;
+L6A8: // DCD4 DRW VC, VD, 4
+    STEP(0x6A8, 0xDCD4);
+    c->pc = 0x6A8;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x6AA) goto dispatch;
+L6AA: // 87E3 XOR V7, VE
+    STEP(0x6AA, 0x87E3);
+    V[7] ^= V[14];
+L6AC: // 6ECF LD VE, 0xCF
+    STEP(0x6AC, 0x6ECF);
+    V[14] = 0xCF;
+L6AE: // 87E2 AND V7, VE
+    STEP(0x6AE, 0x87E2);
+    V[7] &= V[14];
+L6B0: // 6230 LD V2, 0x30
+    STEP(0x6B0, 0x6230);
+    V[2] = 0x30;
+L6B2: // 8721 OR V7, V2
+    STEP(0x6B2, 0x8721);
+    V[7] |= V[2];
+L6B4: // 00EE RET
+    STEP(0x6B4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L6B6: // 6310 LD V3, 0x10
+    STEP(0x6B6, 0x6310);
+    V[3] = 0x10;
+L6B8: // 8132 AND V1, V3
+    STEP(0x6B8, 0x8132);
+    V[1] &= V[3];
+L6BA: // 4100 SNE V1, 0x00
+    STEP(0x6BA, 0x4100);
+    if (V[1] != 0x00) goto L6BE;
+L6BC: // 1704 JP 0x704
+    STEP(0x6BC, 0x1704);
+    goto L704;
+L6BE: // DCD4 DRW VC, VD, 4
+    STEP(0x6BE, 0xDCD4);
+    c->pc = 0x6BE;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x6C0) goto dispatch;
+L6C0: // 7DFE ADD VD, 0xFE
+    STEP(0x6C0, 0x7DFE);
+    V[13] += 0xFE;
+L6C2: // DCD4 DRW VC, VD, 4
+    STEP(0x6C2, 0xDCD4);
+    c->pc = 0x6C2;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x6C4) goto dispatch;
+L6C4: // 87E3 XOR V7, VE
+    STEP(0x6C4, 0x87E3);
+    V[7] ^= V[14];
+L6C6: // 6ECF LD VE, 0xCF
+    STEP(0x6C6, 0x6ECF);
+    V[14] = 0xCF;
+L6C8: // 87E2 AND V7, VE
+    STEP(0x6C8, 0x87E2);
+    V[7] &= V[14];
+L6CA: // 6200 LD V2, 0x00
+    STEP(0x6CA, 0x6200);
+    V[2] = 0x00;
+L6CC: // 8721 OR V7, V2
+    STEP(0x6CC, 0x8721);
+    V[7] |= V[2];
+L6CE: // 00EE RET
+    STEP(0x6CE, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L6D0: // 6320 LD V3, 0x20
+    STEP(0x6D0, 0x6320);
+    V[3] = 0x20;
+L6D2: // 8132 AND V1, V3
+    STEP(0x6D2, 0x8132);
+    V[1] &= V[3];
+L6D4: // 4100 SNE V1, 0x00
+    STEP(0x6D4, 0x4100);
+    if (V[1] != 0x00) goto L6D8;
+L6D6: // 1704 JP 0x704
+    STEP(0x6D6, 0x1704);
+    goto L704;
+L6D8: // DCD4 DRW VC, VD, 4
+    STEP(0x6D8, 0xDCD4);
+    c->pc = 0x6D8;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x6DA) goto dispatch;
+L6DA: // 7C02 ADD VC, 0x02
+    STEP(0x6DA, 0x7C02);
+    V[12] += 0x02;
+L6DC: // DCD4 DRW VC, VD, 4
+    STEP(0x6DC, 0xDCD4);
+    c->pc = 0x6DC;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x6DE) goto dispatch;
+L6DE: // 87E3 XOR V7, VE
+    STEP(0x6DE, 0x87E3);
+    V[7] ^= V[14];
+L6E0: // 6ECF LD VE, 0xCF
+    STEP(0x6E0, 0x6ECF);
+    V[14] = 0xCF;
+L6E2: // 87E2 AND V7, VE
+    STEP(0x6E2, 0x87E2);
+    V[7] &= V[14];
+L6E4: // 6220 LD V2, 0x20
+    STEP(0x6E4, 0x6220);
+    V[2] = 0x20;
+L6E6: // 8721 OR V7, V2
+    STEP(0x6E6, 0x8721);
+    V[7] |= V[2];
+L6E8: // 00EE RET
+    STEP(0x6E8, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L6EA: // 6380 LD V3, 0x80
+    STEP(0x6EA, 0x6380);
+    V[3] = 0x80;
+L6EC: // 8132 AND V1, V3
+    STEP(0x6EC, 0x8132);
+    V[1] &= V[3];
+L6EE: // 4100 SNE V1, 0x00
+    STEP(0x6EE, 0x4100);
+    if (V[1] != 0x00) goto L6F2;
+L6F0: // 1704 JP 0x704
+    STEP(0x6F0, 0x1704);
+    goto L704;
+L6F2: // DCD4 DRW VC, VD, 4
+    STEP(0x6F2, 0xDCD4);
+    c->pc = 0x6F2;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x6F4) goto dispatch;
+L6F4: // 7CFE ADD VC, 0xFE
+    STEP(0x6F4, 0x7CFE);
+    V[12] += 0xFE;
+L6F6: // DCD4 DRW VC, VD, 4
+    STEP(0x6F6, 0xDCD4);
+    c->pc = 0x6F6;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x6F8) goto dispatch;
+L6F8: // 87E3 XOR V7, VE
+    STEP(0x6F8, 0x87E3);
+    V[7] ^= V[14];
+L6FA: // 6ECF LD VE, 0xCF
+    STEP(0x6FA, 0x6ECF);
+    V[14] = 0xCF;
+L6FC: // 87E2 AND V7, VE
+    STEP(0x6FC, 0x87E2);
+    V[7] &= V[14];
+L6FE: // 6210 LD V2, 0x10
+    STEP(0x6FE, 0x6210);
+    V[2] = 0x10;
+L700: // 8721 OR V7, V2
+    STEP(0x700, 0x8721);
+    V[7] |= V[2];
+L702: // 00EE RET
+    STEP(0x702, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L704: // C1F0 RND V1, 0xF0
+    STEP(0x704, 0xC1F0);
+    c->pc = 0x704;
+    predecode(0xC1F0, &in);
+    execute(c, &in);
+    if (c->pc != 0x706) goto dispatch;
+L706: // 8012 AND V0, V1
+    STEP(0x706, 0x8012);
+    V[0] &= V[1];
+L708: // 3000 SE V0, 0x00
+    STEP(0x708, 0x3000);
+    if (V[0] == 0x00) goto L70C;
+L70A: // 1716 JP 0x716
+    STEP(0x70A, 0x1716);
+    goto L716;
+L70C: // 87E3 XOR V7, VE
+    STEP(0x70C, 0x87E3);
+    V[7] ^= V[14];
+L70E: // 6E30 LD VE, 0x30
+    STEP(0x70E, 0x6E30);
+    V[14] = 0x30;
+L710: // 87E3 XOR V7, VE
+    STEP(0x710, 0x87E3);
+    V[7] ^= V[14];
+L712: // 82E3 XOR V2, VE
+    STEP(0x712, 0x82E3);
+    V[2] ^= V[14];
+L714: // 1636 JP 0x636
+    STEP(0x714, 0x1636);
+    goto L636;
+L716: // DCD4 DRW VC, VD, 4
+    STEP(0x716, 0xDCD4);
+    c->pc = 0x716;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x718) goto dispatch;
+L718: // 800E SHL V0, V0
+    STEP(0x718, 0x800E);
+    V[15] = V[0] >> 7;
+    V[0] <<= 1;
+L71A: // 4F00 SNE VF, 0x00
+    STEP(0x71A, 0x4F00);
+    if (V[15] != 0x00) goto L71E;
+L71C: // 1724 JP 0x724
+    STEP(0x71C, 0x1724);
+    goto L724;
+L71E: // 6290 LD V2, 0x90
+    STEP(0x71E, 0x6290);
+    V[2] = 0x90;
+L720: // 7CFE ADD VC, 0xFE
+    STEP(0x720, 0x7CFE);
+    V[12] += 0xFE;
+L722: // 1746 JP 0x746
+    STEP(0x722, 0x1746);
+    goto L746;
+L724: // 800E SHL V0, V0
+    STEP(0x724, 0x800E);
+    V[15] = V[0] >> 7;
+    V[0] <<= 1;
+L726: // 4F00 SNE VF, 0x00
+    STEP(0x726, 0x4F00);
+    if (V[15] != 0x00) goto L72A;
+L728: // 1730 JP 0x730
+    STEP(0x728, 0x1730);
+    goto L730;
+L72A: // 6230 LD V2, 0x30
+    STEP(0x72A, 0x6230);
+    V[2] = 0x30;
+L72C: // 7D02 ADD VD, 0x02
+    STEP(0x72C, 0x7D02);
+    V[13] += 0x02;
+L72E: // 1746 JP 0x746
+    STEP(0x72E, 0x1746);
+    goto L746;
+L730: // 800E SHL V0, V0
+    STEP(0x730, 0x800E);
+    V[15] = V[0] >> 7;
+    V[0] <<= 1;
+L732: // 4F00 SNE VF, 0x00
+    STEP(0x732, 0x4F00);
+    if (V[15] != 0x00) goto L736;
+L734: // 173C JP 0x73C
+    STEP(0x734, 0x173C);
+    goto L73C;
+L736: // 62A0 LD V2, 0xA0
+    STEP(0x736, 0x62A0);
+    V[2] = 0xA0;
+L738: // 7C02 ADD VC, 0x02
+    STEP(0x738, 0x7C02);
+    V[12] += 0x02;
+L73A: // 1746 JP 0x746
+    STEP(0x73A, 0x1746);
+    goto L746;
+L73C: // 800E SHL V0, V0
+    STEP(0x73C, 0x800E);
+    V[15] = V[0] >> 7;
+    V[0] <<= 1;
+L73E: // 4F00 SNE VF, 0x00
+    STEP(0x73E, 0x4F00);
+    if (V[15] != 0x00) goto L742;
+L740: // 170C JP 0x70C
+    STEP(0x740, 0x170C);
+    goto L70C;
+L742: // 6200 LD V2, 0x00
+    STEP(0x742, 0x6200);
+    V[2] = 0x00;
+L744: // 7DFE ADD VD, 0xFE
+    STEP(0x744, 0x7DFE);
+    V[13] += 0xFE;
+L746: // DCD4 DRW VC, VD, 4
+    STEP(0x746, 0xDCD4);
+    c->pc = 0x746;
+    predecode(0xDCD4, &in);
+    execute(c, &in);
+    if (c->pc != 0x748) goto dispatch;
+L748: // 6E4F LD VE, 0x4F
+    STEP(0x748, 0x6E4F);
+    V[14] = 0x4F;
+L74A: // 87E2 AND V7, VE
+    STEP(0x74A, 0x87E2);
+    V[7] &= V[14];
+L74C: // 8721 OR V7, V2
+    STEP(0x74C, 0x8721);
+    V[7] |= V[2];
+L74E: // 00EE RET
+    STEP(0x74E, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L750: // 8070 LD V0, V7
+    STEP(0x750, 0x8070);
+    V[0] = V[7];
+L752: // 6E03 LD VE, 0x03
+    STEP(0x752, 0x6E03);
+    V[14] = 0x03;
+L754: // 80E2 AND V0, VE
+    STEP(0x754, 0x80E2);
+    V[0] &= V[14];
+L756: // 800E SHL V0, V0
+    STEP(0x756, 0x800E);
+    V[15] = V[0] >> 7;
+    V[0] <<= 1;
+L758: // 8180 LD V1, V8
+    STEP(0x758, 0x8180);
+    V[1] = V[8];
+L75A: // 8194 ADD V1, V9
+    STEP(0x75A, 0x8194);
+    V[15] = V[1] + V[9] > 0xFF;
+    V[1] += V[9];
+L75C: // 6E02 LD VE, 0x02
+    STEP(0x75C, 0x6E02);
+    V[14] = 0x02;
+L75E: // 81E2 AND V1, VE
+    STEP(0x75E, 0x81E2);
+    V[1] &= V[14];
+L760: // 4100 SNE V1, 0x00
+    STEP(0x760, 0x4100);
+    if (V[1] != 0x00) goto L764;
+L762: // 7001 ADD V0, 0x01
+    STEP(0x762, 0x7001);
+    V[0] += 0x01;
+L764: // 800E SHL V0, V0
+    STEP(0x764, 0x800E);
+    V[15] = V[0] >> 7;
+    V[0] <<= 1;
+L766: // 800E SHL V0, V0
+    STEP(0x766, 0x800E);
+    V[15] = V[0] >> 7;
+    V[0] <<= 1;
+L768: // A8CD LD I, 0x8CD
+    STEP(0x768, 0xA8CD);
+    c->I = 0x8CD;
+L76A: // F01E ADD I, V0
+    STEP(0x76A, 0xF01E);
+    c->I += V[0];
+L76C: // D894 DRW V8, V9, 4
+    STEP(0x76C, 0xD894);
+    c->pc = 0x76C;
+    predecode(0xD894, &in);
+    execute(c, &in);
+    if (c->pc != 0x76E) goto dispatch;
+L76E: // 8EF0 LD VE, VF
+    STEP(0x76E, 0x8EF0);
+    V[14] = V[15];
+L770: // 00EE RET
+    STEP(0x770, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L772: // 6E00 LD VE, 0x00
+    STEP(0x772, 0x6E00);
+    V[14] = 0x00;
+L774: // A919 LD I, 0x919
+    STEP(0x774, 0xA919);
+    c->I = 0x919;
+L776: // FE1E ADD I, VE
+    STEP(0x776, 0xFE1E);
+    c->I += V[14];
+L778: // FE1E ADD I, VE
+    STEP(0x778, 0xFE1E);
+    c->I += V[14];
+L77A: // FE1E ADD I, VE
+    STEP(0x77A, 0xFE1E);
+    c->I += V[14];
+L77C: // FE1E ADD I, VE
+    STEP(0x77C, 0xFE1E);
+    c->I += V[14];
+L77E: // F365 LD V3, [I]
+    STEP(0x77E, 0xF365);
+    for (int i = 0; i <= 3; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L780: // AB34 LD I, 0xB34
+    STEP(0x780, 0xAB34);
+    c->I = 0xB34;
+L782: // FE1E ADD I, VE
+    STEP(0x782, 0xFE1E);
+    c->I += V[14];
+L784: // FE1E ADD I, VE
+    STEP(0x784, 0xFE1E);
+    c->I += V[14];
+L786: // FE1E ADD I, VE
+    STEP(0x786, 0xFE1E);
+    c->I += V[14];
+L788: // FE1E ADD I, VE
+    STEP(0x788, 0xFE1E);
+    c->I += V[14];
+L78A: // F355 LD [I], V3
+    STEP(0x78A, 0xF355);
+    c->pc = 0x78A;
+    predecode(0xF355, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x78C) goto dispatch;
+L78C: // 7E01 ADD VE, 0x01
+    STEP(0x78C, 0x7E01);
+    V[14] += 0x01;
+L78E: // 3E80 SE VE, 0x80
+    STEP(0x78E, 0x3E80);
+    if (V[14] == 0x80) goto L792;
+L790: // 1774 JP 0x774
+    STEP(0x790, 0x1774);
+    goto L774;
+L792: // 00EE RET
+    STEP(0x792, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L794: // 8223 XOR V2, V2
+    STEP(0x794, 0x8223);
+    V[2] ^= V[2];
+L796: // 8333 XOR V3, V3
+    STEP(0x796, 0x8333);
+    V[3] ^= V[3];
+L798: // 6E0F LD VE, 0x0F
+    STEP(0x798, 0x6E0F);
+    V[14] = 0x0F;
+L79A: // 8020 LD V0, V2
+    STEP(0x79A, 0x8020);
+    V[0] = V[2];
+L79C: // 8130 LD V1, V3
+    STEP(0x79C, 0x8130);
+    V[1] = V[3];
+L79E: // 27BE CALL 0x7BE
+    STEP(0x79E, 0x27BE);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x79E;
+    goto L7BE;
+L7A0: // 80E2 AND V0, VE
+    STEP(0x7A0, 0x80E2);
+    V[0] &= V[14];
+L7A2: // 800E SHL V0, V0
+    STEP(0x7A2, 0x800E);
+    V[15] = V[0] >> 7;
+    V[0] <<= 1;
+L7A4: // A8F9 LD I, 0x8F9
+    STEP(0x7A4, 0xA8F9);
+    c->I = 0x8F9;
+L7A6: // F01E ADD I, V0
+    STEP(0x7A6, 0xF01E);
+    c->I += V[0];
+L7A8: // D232 DRW V2, V3, 2
+    STEP(0x7A8, 0xD232);
+    c->pc = 0x7A8;
+    predecode(0xD232, &in);
+    execute(c, &in);
+    if (c->pc != 0x7AA) goto dispatch;
+L7AA: // 7202 ADD V2, 0x02
+    STEP(0x7AA, 0x7202);
+    V[2] += 0x02;
+L7AC: // 3240 SE V2, 0x40
+    STEP(0x7AC, 0x3240);
+    if (V[2] == 0x40) goto L7B0;
+L7AE: // 179A JP 0x79A
+    STEP(0x7AE, 0x179A);
+    goto L79A;
+L7B0: // 8223 XOR V2, V2
+    STEP(0x7B0, 0x8223);
+    V[2] ^= V[2];
+L7B2: // 7302 ADD V3, 0x02
+    STEP(0x7B2, 0x7302);
+    V[3] += 0x02;
+L7B4: // 4320 SNE V3, 0x20
+    STEP(0x7B4, 0x4320);
+    if (V[3] != 0x20) goto L7B8;
+L7B6: // 00EE RET
+    STEP(0x7B6, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L7B8: // 179A JP 0x79A
+    STEP(0x7B8, 0x179A);
+    goto L79A;
+L7BA: // 7002 ADD V0, 0x02
+    STEP(0x7BA, 0x7002);
+    V[0] += 0x02;
+L7BC: // 7102 ADD V1, 0x02
+    STEP(0x7BC, 0x7102);
+    V[1] += 0x02;
+L7BE: // 8006 SHR V0, V0
+    STEP(0x7BE, 0x8006);
+    V[15] = V[0] & 1;
+    V[0] >>= 1;
+L7C0: // 8106 SHR V1, V0
+    STEP(0x7C0, 0x8106);
+    V[15] = V[1] & 1;
+    V[1] >>= 1;
+L7C2: // 810E SHL V1, V0
+    STEP(0x7C2, 0x810E);
+    V[15] = V[1] >> 7;
+    V[1] <<= 1;
+L7C4: // 810E SHL V1, V0
+    STEP(0x7C4, 0x810E);
+    V[15] = V[1] >> 7;
+    V[1] <<= 1;
+L7C6: // 810E SHL V1, V0
+    STEP(0x7C6, 0x810E);
+    V[15] = V[1] >> 7;
+    V[1] <<= 1;
+L7C8: // 810E SHL V1, V0
+    STEP(0x7C8, 0x810E);
+    V[15] = V[1] >> 7;
+    V[1] <<= 1;
+L7CA: // AB34 LD I, 0xB34
+    STEP(0x7CA, 0xAB34);
+    c->I = 0xB34;
+L7CC: // F11E ADD I, V1
+    STEP(0x7CC, 0xF11E);
+    c->I += V[1];
+L7CE: // F11E ADD I, V1
+    STEP(0x7CE, 0xF11E);
+    c->I += V[1];
+L7D0: // F01E ADD I, V0
+    STEP(0x7D0, 0xF01E);
+    c->I += V[0];
+L7D2: // F065 LD V0, [I]
+    STEP(0x7D2, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L7D4: // 00EE RET
+    STEP(0x7D4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L7D6: // A8CC LD I, 0x8CC
+    STEP(0x7D6, 0xA8CC);
+    c->I = 0x8CC;
+L7D8: // F065 LD V0, [I]
+    STEP(0x7D8, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L7DA: // 8006 SHR V0, V0
+    STEP(0x7DA, 0x8006);
+    V[15] = V[0] & 1;
+    V[0] >>= 1;
+L7DC: // F055 LD [I], V0
+    STEP(0x7DC, 0xF055);
+    c->pc = 0x7DC;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x7DE) goto dispatch;
+L7DE: // 6001 LD V0, 0x01
+    STEP(0x7DE, 0x6001);
+    V[0] = 0x01;
+L7E0: // E0A1 SKNP V0
+    STEP(0x7E0, 0xE0A1);
+    c->pc = 0x7E0;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x7E2) goto dispatch;
+L7E2: // 17E0 JP 0x7E0
+    STEP(0x7E2, 0x17E0);
+    goto L7E0;
+L7E4: // 00EE RET
+    STEP(0x7E4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L7E6: // F165 LD V1, [I]
+    STEP(0x7E6, 0xF165);
+    for (int i = 0; i <= 1; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L7E8: // 6E01 LD VE, 0x01
+    STEP(0x7E8, 0x6E01);
+    V[14] = 0x01;
+L7EA: // 8443 XOR V4, V4
+    STEP(0x7EA, 0x8443);
+    V[4] ^= V[4];
+L7EC: // 8200 LD V2, V0
+    STEP(0x7EC, 0x8200);
+    V[2] = V[0];
+L7EE: // 8310 LD V3, V1
+    STEP(0x7EE, 0x8310);
+    V[3] = V[1];
+L7F0: // 6510 LD V5, 0x10
+    STEP(0x7F0, 0x6510);
+    V[5] = 0x10;
+L7F2: // 8355 SUB V3, V5
+    STEP(0x7F2, 0x8355);
+    V[15] = V[3] > V[5];
+    V[3] -= V[5];
+L7F4: // 4F00 SNE VF, 0x00
+    STEP(0x7F4, 0x4F00);
+    if (V[15] != 0x00) goto L7F8;
+L7F6: // 82E5 SUB V2, VE
+    STEP(0x7F6, 0x82E5);
+    V[15] = V[2] > V[14];
+    V[2] -= V[14];
+L7F8: // 4F00 SNE VF, 0x00
+    STEP(0x7F8, 0x4F00);
+    if (V[15] != 0x00) goto L7FC;
+L7FA: // 180C JP 0x80C
+    STEP(0x7FA, 0x180C);
+    goto L80C;
+L7FC: // 6527 LD V5, 0x27
+    STEP(0x7FC, 0x6527);
+    V[5] = 0x27;
+L7FE: // 8255 SUB V2, V5
+    STEP(0x7FE, 0x8255);
+    V[15] = V[2] > V[5];
+    V[2] -= V[5];
+L800: // 4F00 SNE VF, 0x00
+    STEP(0x800, 0x4F00);
+    if (V[15] != 0x00) goto L804;
+L802: // 180C JP 0x80C
+    STEP(0x802, 0x180C);
+    goto L80C;
+L804: // 8020 LD V0, V2
+    STEP(0x804, 0x8020);
+    V[0] = V[2];
+L806: // 8130 LD V1, V3
+    STEP(0x806, 0x8130);
+    V[1] = V[3];
+L808: // 84E4 ADD V4, VE
+    STEP(0x808, 0x84E4);
+    V[15] = V[4] + V[14] > 0xFF;
+    V[4] += V[14];
+L80A: // 17F0 JP 0x7F0
+    STEP(0x80A, 0x17F0);
+    goto L7F0;
+L80C: // F429 LD F, V4
+    STEP(0x80C, 0xF429);
+    c->I = V[4] * 5;
+L80E: // D675 DRW V6, V7, 5
+    STEP(0x80E, 0xD675);
+    c->pc = 0x80E;
+    predecode(0xD675, &in);
+    execute(c, &in);
+    if (c->pc != 0x810) goto dispatch;
+L810: // 7606 ADD V6, 0x06
+    STEP(0x810, 0x7606);
+    V[6] += 0x06;
+L812: // 8443 XOR V4, V4
+    STEP(0x812, 0x8443);
+    V[4] ^= V[4];
+L814: // 8200 LD V2, V0
+    STEP(0x814, 0x8200);
+    V[2] = V[0];
+L816: // 8310 LD V3, V1
+    STEP(0x816, 0x8310);
+    V[3] = V[1];
+L818: // 65E8 LD V5, 0xE8
+    STEP(0x818, 0x65E8);
+    V[5] = 0xE8;
+L81A: // 8355 SUB V3, V5
+    STEP(0x81A, 0x8355);
+    V[15] = V[3] > V[5];
+    V[3] -= V[5];
+L81C: // 4F00 SNE VF, 0x00
+    STEP(0x81C, 0x4F00);
+    if (V[15] != 0x00) goto L820;
+L81E: // 82E5 SUB V2, VE
+    STEP(0x81E, 0x82E5);
+    V[15] = V[2] > V[14];
+    V[2] -= V[14];
+L820: // 4F00 SNE VF, 0x00
+    STEP(0x820, 0x4F00);
+    if (V[15] != 0x00) goto L824;
+L822: // 1834 JP 0x834
+    STEP(0x822, 0x1834);
+    goto L834;
+L824: // 6503 LD V5, 0x03
+    STEP(0x824, 0x6503);
+    V[5] = 0x03;
+L826: // 8255 SUB V2, V5
+    STEP(0x826, 0x8255);
+    V[15] = V[2] > V[5];
+    V[2] -= V[5];
+L828: // 4F00 SNE VF, 0x00
+    STEP(0x828, 0x4F00);
+    if (V[15] != 0x00) goto L82C;
+L82A: // 1834 JP 0x834
+    STEP(0x82A, 0x1834);
+    goto L834;
+L82C: // 8020 LD V0, V2
+    STEP(0x82C, 0x8020);
+    V[0] = V[2];
+L82E: // 8130 LD V1, V3
+    STEP(0x82E, 0x8130);
+    V[1] = V[3];
+L830: // 84E4 ADD V4, VE
+    STEP(0x830, 0x84E4);
+    V[15] = V[4] + V[14] > 0xFF;
+    V[4] += V[14];
+L832: // 1818 JP 0x818
+    STEP(0x832, 0x1818);
+    goto L818;
+L834: // F429 LD F, V4
+    STEP(0x834, 0xF429);
+    c->I = V[4] * 5;
+L836: // D675 DRW V6, V7, 5
+    STEP(0x836, 0xD675);
+    c->pc = 0x836;
+    predecode(0xD675, &in);
+    execute(c, &in);
+    if (c->pc != 0x838) goto dispatch;
+L838: // 7606 ADD V6, 0x06
+    STEP(0x838, 0x7606);
+    V[6] += 0x06;
+L83A: // 8443 XOR V4, V4
+    STEP(0x83A, 0x8443);
+    V[4] ^= V[4];
+L83C: // 8200 LD V2, V0
+    STEP(0x83C, 0x8200);
+    V[2] = V[0];
+L83E: // 8310 LD V3, V1
+    STEP(0x83E, 0x8310);
+    V[3] = V[1];
+L840: // 6564 LD V5, 0x64
+    STEP(0x840, 0x6564);
+    V[5] = 0x64;
+L842: // 8355 SUB V3, V5
+    STEP(0x842, 0x8355);
+    V[15] = V[3] > V[5];
+    V[3] -= V[5];
+L844: // 4F00 SNE VF, 0x00
+    STEP(0x844, 0x4F00);
+    if (V[15] != 0x00) goto L848;
+L846: // 82E5 SUB V2, VE
+    STEP(0x846, 0x82E5);
+    V[15] = V[2] > V[14];
+    V[2] -= V[14];
+L848: // 4F00 SNE VF, 0x00
+    STEP(0x848, 0x4F00);
+    if (V[15] != 0x00) goto L84C;
+L84A: // 1854 JP 0x854
+    STEP(0x84A, 0x1854);
+    goto L854;
+L84C: // 8020 LD V0, V2
+    STEP(0x84C, 0x8020);
+    V[0] = V[2];
+L84E: // 8130 LD V1, V3
+    STEP(0x84E, 0x8130);
+    V[1] = V[3];
+L850: // 84E4 ADD V4, VE
+    STEP(0x850, 0x84E4);
+    V[15] = V[4] + V[14] > 0xFF;
+    V[4] += V[14];
+L852: // 1840 JP 0x840
+    STEP(0x852, 0x1840);
+    goto L840;
+L854: // F429 LD F, V4
+    STEP(0x854, 0xF429);
+    c->I = V[4] * 5;
+L856: // D675 DRW V6, V7, 5
+    STEP(0x856, 0xD675);
+    c->pc = 0x856;
+    predecode(0xD675, &in);
+    execute(c, &in);
+    if (c->pc != 0x858) goto dispatch;
+L858: // 7606 ADD V6, 0x06
+    STEP(0x858, 0x7606);
+    V[6] += 0x06;
+L85A: // 8443 XOR V4, V4
+    STEP(0x85A, 0x8443);
+    V[4] ^= V[4];
+L85C: // 8200 LD V2, V0
+    STEP(0x85C, 0x8200);
+    V[2] = V[0];
+L85E: // 8310 LD V3, V1
+    STEP(0x85E, 0x8310);
+    V[3] = V[1];
+L860: // 650A LD V5, 0x0A
+    STEP(0x860, 0x650A);
+    V[5] = 0x0A;
+L862: // 8355 SUB V3, V5
+    STEP(0x862, 0x8355);
+    V[15] = V[3] > V[5];
+    V[3] -= V[5];
+L864: // 4F00 SNE VF, 0x00
+    STEP(0x864, 0x4F00);
+    if (V[15] != 0x00) goto L868;
+L866: // 186E JP 0x86E
+    STEP(0x866, 0x186E);
+    goto L86E;
+L868: // 8130 LD V1, V3
+    STEP(0x868, 0x8130);
+    V[1] = V[3];
+L86A: // 84E4 ADD V4, VE
+    STEP(0x86A, 0x84E4);
+    V[15] = V[4] + V[14] > 0xFF;
+    V[4] += V[14];
+L86C: // 1860 JP 0x860
+    STEP(0x86C, 0x1860);
+    goto L860;
+L86E: // F429 LD F, V4
+    STEP(0x86E, 0xF429);
+    c->I = V[4] * 5;
+L870: // D675 DRW V6, V7, 5
+    STEP(0x870, 0xD675);
+    c->pc = 0x870;
+    predecode(0xD675, &in);
+    execute(c, &in);
+    if (c->pc != 0x872) goto dispatch;
+L872: // 7606 ADD V6, 0x06
+    STEP(0x872, 0x7606);
+    V[6] += 0x06;
+L874: // F129 LD F, V1
+    STEP(0x874, 0xF129);
+    c->I = V[1] * 5;
+L876: // D675 DRW V6, V7, 5
+    STEP(0x876, 0xD675);
+    c->pc = 0x876;
+    predecode(0xD675, &in);
+    execute(c, &in);
+    if (c->pc != 0x878) goto dispatch;
+L878: // 00EE RET
+    STEP(0x878, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L87A: // A8C8 LD I, 0x8C8
+    STEP(0x87A, 0xA8C8);
+    c->I = 0x8C8;
+L87C: // F165 LD V1, [I]
+    STEP(0x87C, 0xF165);
+    for (int i = 0; i <= 1; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L87E: // 81E4 ADD V1, VE
+    STEP(0x87E, 0x81E4);
+    V[15] = V[1] + V[14] > 0xFF;
+    V[1] += V[14];
+L880: // 3F00 SE VF, 0x00
+    STEP(0x880, 0x3F00);
+    if (V[15] == 0x00) goto L884;
+L882: // 7001 ADD V0, 0x01
+    STEP(0x882, 0x7001);
+    V[0] += 0x01;
+L884: // A8C8 LD I, 0x8C8
+    STEP(0x884, 0xA8C8);
+    c->I = 0x8C8;
+L886: // F155 LD [I], V1
+    STEP(0x886, 0xF155);
+    c->pc = 0x886;
+    predecode(0xF155, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x888) goto dispatch;
+L888: // 00EE RET
+    STEP(0x888, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L88A: // A8C8 LD I, 0x8C8
+    STEP(0x88A, 0xA8C8);
+    c->I = 0x8C8;
+L88C: // F365 LD V3, [I]
+    STEP(0x88C, 0xF365);
+    for (int i = 0; i <= 3; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L88E: // 8E00 LD VE, V0
+    STEP(0x88E, 0x8E00);
+    V[14] = V[0];
+L890: // 8E25 SUB VE, V2
+    STEP(0x890, 0x8E25);
+    V[15] = V[14] > V[2];
+    V[14] -= V[2];
+L892: // 4F00 SNE VF, 0x00
+    STEP(0x892, 0x4F00);
+    if (V[15] != 0x00) goto L896;
+L894: // 00EE RET
+    STEP(0x894, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L896: // 3E00 SE VE, 0x00
+    STEP(0x896, 0x3E00);
+    if (V[14] == 0x00) goto L89A;
+L898: // 18A2 JP 0x8A2
+    STEP(0x898, 0x18A2);
+    goto L8A2;
+L89A: // 8E10 LD VE, V1
+    STEP(0x89A, 0x8E10);
+    V[14] = V[1];
+L89C: // 8E35 SUB VE, V3
+    STEP(0x89C, 0x8E35);
+    V[15] = V[14] > V[3];
+    V[14] -= V[3];
+L89E: // 4F00 SNE VF, 0x00
+    STEP(0x89E, 0x4F00);
+    if (V[15] != 0x00) goto L8A2;
+L8A0: // 00EE RET
+    STEP(0x8A0, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L8A2: // A8CA LD I, 0x8CA
+    STEP(0x8A2, 0xA8CA);
+    c->I = 0x8CA;
+L8A4: // F155 LD [I], V1
+    STEP(0x8A4, 0xF155);
+    c->pc = 0x8A4;
+    predecode(0xF155, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x8A6) goto dispatch;
+L8A6: // 00EE RET
+    STEP(0x8A6, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L8A8: // 8EE3 XOR VE, VE
+    STEP(0x8A8, 0x8EE3);
+    V[14] ^= V[14];
+L8AA: // 620F LD V2, 0x0F
+    STEP(0x8AA, 0x620F);
+    V[2] = 0x0F;
+L8AC: // 63FF LD V3, 0xFF
+    STEP(0x8AC, 0x63FF);
+    V[3] = 0xFF;
+L8AE: // 6110 LD V1, 0x10
+    STEP(0x8AE, 0x6110);
+    V[1] = 0x10;
+L8B0: // E2A1 SKNP V2
+    STEP(0x8B0, 0xE2A1);
+    c->pc = 0x8B0;
+    predecode(0xE2A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x8B2) goto dispatch;
+L8B2: // 18C4 JP 0x8C4
+    STEP(0x8B2, 0x18C4);
+    goto L8C4;
+L8B4: // 8134 ADD V1, V3
+    STEP(0x8B4, 0x8134);
+    V[15] = V[1] + V[3] > 0xFF;
+    V[1] += V[3];
+L8B6: // 3100 SE V1, 0x00
+    STEP(0x8B6, 0x3100);
+    if (V[1] == 0x00) goto L8BA;
+L8B8: // 18B0 JP 0x8B0
+    STEP(0x8B8, 0x18B0);
+    goto L8B0;
+L8BA: // 6110 LD V1, 0x10
+    STEP(0x8BA, 0x6110);
+    V[1] = 0x10;
+L8BC: // 8034 ADD V0, V3
+    STEP(0x8BC, 0x8034);
+    V[15] = V[0] + V[3] > 0xFF;
+    V[0] += V[3];
+L8BE: // 3000 SE V0, 0x00
+    STEP(0x8BE, 0x3000);
+    if (V[0] == 0x00) goto L8C2;
+L8C0: // 18B0 JP 0x8B0
+    STEP(0x8C0, 0x18B0);
+    goto L8B0;
+L8C2: // 00EE RET
+    STEP(0x8C2, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L8C4: // 6E01 LD VE, 0x01
+    STEP(0x8C4, 0x6E01);
+    V[14] = 0x01;
+L8C6: // 00EE RET
+    STEP(0x8C6, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,643 @@
+// generated by chip8-aot from roms/BLITZ.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x12, 0x17, 0x42, 0x4C, 0x49, 0x54, 0x5A, 0x20, 0x42, 0x79, 0x20, 0x44,
+    0x61, 0x76, 0x69, 0x64, 0x20, 0x57, 0x49, 0x4E, 0x54, 0x45, 0x52, 0xA3,
+    0x41, 0x60, 0x04, 0x61, 0x09, 0x62, 0x0E, 0x67, 0x04, 0xD0, 0x1E, 0xF2,
+    0x1E, 0x70, 0x0C, 0x30, 0x40, 0x12, 0x21, 0xF0, 0x0A, 0x00, 0xE0, 0x22,
+    0xD9, 0xF0, 0x0A, 0x00, 0xE0, 0x8E, 0x70, 0xA3, 0x1E, 0x6B, 0x1F, 0xCC,
+    0x1F, 0x8C, 0xC4, 0xDC, 0xB2, 0x3F, 0x01, 0x12, 0x49, 0xDC, 0xB2, 0x12,
+    0x39, 0xCA, 0x07, 0x7A, 0x01, 0x7B, 0xFE, 0xDC, 0xB2, 0x7A, 0xFF, 0x3A,
+    0x00, 0x12, 0x4D, 0x7E, 0xFF, 0x3E, 0x00, 0x12, 0x39, 0x6B, 0x00, 0x8C,
+    0x70, 0x6D, 0x00, 0x6E, 0x00, 0xA3, 0x1B, 0xDD, 0xE3, 0x3F, 0x00, 0x12,
+    0xC1, 0x3B, 0x00, 0x12, 0x81, 0x60, 0x05, 0xE0, 0x9E, 0x12, 0x87, 0x6B,
+    0x01, 0x88, 0xD0, 0x78, 0x02, 0x89, 0xE0, 0x79, 0x03, 0xA3, 0x1E, 0xD8,
+    0x91, 0x81, 0xF0, 0x60, 0x05, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12,
+    0x8B, 0x3B, 0x01, 0x12, 0xAB, 0xA3, 0x1E, 0x31, 0x01, 0xD8, 0x91, 0x79,
+    0x01, 0x39, 0x20, 0x12, 0xAB, 0x6B, 0x00, 0x31, 0x00, 0x7C, 0xFF, 0x4C,
+    0x00, 0x12, 0xBB, 0xA3, 0x1B, 0xDD, 0xE3, 0x7D, 0x02, 0x3D, 0x40, 0x12,
+    0xB9, 0x6D, 0x00, 0x7E, 0x01, 0x12, 0x65, 0x00, 0xE0, 0x77, 0x02, 0x12,
+    0x2D, 0xA3, 0x1B, 0xDD, 0xE3, 0x60, 0x14, 0x61, 0x02, 0x62, 0x0B, 0xA3,
+    0x20, 0xD0, 0x1B, 0xF2, 0x1E, 0x70, 0x08, 0x30, 0x2C, 0x12, 0xCD, 0x12,
+    0xD7, 0x60, 0x0A, 0x61, 0x0D, 0x62, 0x05, 0xA3, 0x07, 0xD0, 0x15, 0xF2,
+    0x1E, 0x70, 0x08, 0x30, 0x2A, 0x12, 0xE1, 0x80, 0x70, 0x70, 0xFE, 0x80,
+    0x06, 0xA3, 0x87, 0xF0, 0x33, 0xF2, 0x65, 0x60, 0x2D, 0xF1, 0x29, 0x61,
+    0x0D, 0xD0, 0x15, 0x70, 0x05, 0xF2, 0x29, 0xD0, 0x15, 0x00, 0xEE, 0x83,
+    0x82, 0x83, 0x82, 0xFB, 0xE8, 0x08, 0x88, 0x05, 0xE2, 0xBE, 0xA0, 0xB8,
+    0x20, 0x3E, 0x80, 0x80, 0x80, 0x80, 0xF8, 0x80, 0xF8, 0xFC, 0xC0, 0xC0,
+    0xF9, 0x81, 0xDB, 0xCB, 0xFB, 0x00, 0xFA, 0x8A, 0x9A, 0x99, 0xF8, 0xEF,
+    0x2A, 0xE8, 0x29, 0x29, 0x00, 0x6F, 0x68, 0x2E, 0x4C, 0x8F, 0xBE, 0xA0,
+    0xB8, 0xB0, 0xBE, 0x00, 0xBE, 0x22, 0x3E, 0x34, 0xB2, 0xD8, 0xD8, 0x00,
+    0xC3, 0xC3, 0x00, 0xD8, 0xD8, 0x00, 0xC3, 0xC3, 0x00, 0xD8, 0xD8, 0xC0,
+    0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xC0, 0xC0, 0x00, 0xDB,
+    0xDB, 0xDB, 0xDB, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18,
+    0x00, 0xDB, 0xDB, 0xDB, 0xDB, 0x00, 0x18, 0x18, 0x00, 0x18, 0x18, 0x00,
+    0x18, 0x18, 0x00, 0x18, 0x18, 0xDB, 0xDB, 0x00, 0x03, 0x03, 0x00, 0x18,
+    0x18, 0x00, 0xC0, 0xC0, 0x00, 0xDB, 0xDB,
+};
+const size_t aot_rom_size = 391;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000001F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x217: goto L217;
+        case 0x219: goto L219;
+        case 0x21B: goto L21B;
+        case 0x21D: goto L21D;
+        case 0x21F: goto L21F;
+        case 0x221: goto L221;
+        case 0x223: goto L223;
+        case 0x225: goto L225;
+        case 0x227: goto L227;
+        case 0x229: goto L229;
+        case 0x22B: goto L22B;
+        case 0x22D: goto L22D;
+        case 0x22F: goto L22F;
+        case 0x231: goto L231;
+        case 0x233: goto L233;
+        case 0x235: goto L235;
+        case 0x237: goto L237;
+        case 0x239: goto L239;
+        case 0x23B: goto L23B;
+        case 0x23D: goto L23D;
+        case 0x23F: goto L23F;
+        case 0x241: goto L241;
+        case 0x243: goto L243;
+        case 0x245: goto L245;
+        case 0x247: goto L247;
+        case 0x249: goto L249;
+        case 0x24B: goto L24B;
+        case 0x24D: goto L24D;
+        case 0x24F: goto L24F;
+        case 0x251: goto L251;
+        case 0x253: goto L253;
+        case 0x255: goto L255;
+        case 0x257: goto L257;
+        case 0x259: goto L259;
+        case 0x25B: goto L25B;
+        case 0x25D: goto L25D;
+        case 0x25F: goto L25F;
+        case 0x261: goto L261;
+        case 0x263: goto L263;
+        case 0x265: goto L265;
+        case 0x267: goto L267;
+        case 0x269: goto L269;
+        case 0x26B: goto L26B;
+        case 0x26D: goto L26D;
+        case 0x26F: goto L26F;
+        case 0x271: goto L271;
+        case 0x273: goto L273;
+        case 0x275: goto L275;
+        case 0x277: goto L277;
+        case 0x279: goto L279;
+        case 0x27B: goto L27B;
+        case 0x27D: goto L27D;
+        case 0x27F: goto L27F;
+        case 0x281: goto L281;
+        case 0x283: goto L283;
+        case 0x285: goto L285;
+        case 0x287: goto L287;
+        case 0x289: goto L289;
+        case 0x28B: goto L28B;
+        case 0x28D: goto L28D;
+        case 0x28F: goto L28F;
+        case 0x291: goto L291;
+        case 0x293: goto L293;
+        case 0x295: goto L295;
+        case 0x297: goto L297;
+        case 0x299: goto L299;
+        case 0x29B: goto L29B;
+        case 0x29D: goto L29D;
+        case 0x29F: goto L29F;
+        case 0x2A1: goto L2A1;
+        case 0x2A3: goto L2A3;
+        case 0x2A5: goto L2A5;
+        case 0x2A7: goto L2A7;
+        case 0x2A9: goto L2A9;
+        case 0x2AB: goto L2AB;
+        case 0x2AD: goto L2AD;
+        case 0x2AF: goto L2AF;
+        case 0x2B1: goto L2B1;
+        case 0x2B3: goto L2B3;
+        case 0x2B5: goto L2B5;
+        case 0x2B7: goto L2B7;
+        case 0x2B9: goto L2B9;
+        case 0x2BB: goto L2BB;
+        case 0x2BD: goto L2BD;
+        case 0x2BF: goto L2BF;
+        case 0x2C1: goto L2C1;
+        case 0x2C3: goto L2C3;
+        case 0x2C5: goto L2C5;
+        case 0x2C7: goto L2C7;
+        case 0x2C9: goto L2C9;
+        case 0x2CB: goto L2CB;
+        case 0x2CD: goto L2CD;
+        case 0x2CF: goto L2CF;
+        case 0x2D1: goto L2D1;
+        case 0x2D3: goto L2D3;
+        case 0x2D5: goto L2D5;
+        case 0x2D7: goto L2D7;
+        case 0x2D9: goto L2D9;
+        case 0x2DB: goto L2DB;
+        case 0x2DD: goto L2DD;
+        case 0x2DF: goto L2DF;
+        case 0x2E1: goto L2E1;
+        case 0x2E3: goto L2E3;
+        case 0x2E5: goto L2E5;
+        case 0x2E7: goto L2E7;
+        case 0x2E9: goto L2E9;
+        case 0x2EB: goto L2EB;
+        case 0x2ED: goto L2ED;
+        case 0x2EF: goto L2EF;
+        case 0x2F1: goto L2F1;
+        case 0x2F3: goto L2F3;
+        case 0x2F5: goto L2F5;
+        case 0x2F7: goto L2F7;
+        case 0x2F9: goto L2F9;
+        case 0x2FB: goto L2FB;
+        case 0x2FD: goto L2FD;
+        case 0x2FF: goto L2FF;
+        case 0x301: goto L301;
+        case 0x303: goto L303;
+        case 0x305: goto L305;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 1217 JP 0x217
+    STEP(0x200, 0x1217);
+    goto L217;
+L217: // A341 LD I, 0x341
+    STEP(0x217, 0xA341);
+    c->I = 0x341;
+L219: // 6004 LD V0, 0x04
+    STEP(0x219, 0x6004);
+    V[0] = 0x04;
+L21B: // 6109 LD V1, 0x09
+    STEP(0x21B, 0x6109);
+    V[1] = 0x09;
+L21D: // 620E LD V2, 0x0E
+    STEP(0x21D, 0x620E);
+    V[2] = 0x0E;
+L21F: // 6704 LD V7, 0x04
+    STEP(0x21F, 0x6704);
+    V[7] = 0x04;
+L221: // D01E DRW V0, V1, 14
+    STEP(0x221, 0xD01E);
+    c->pc = 0x221;
+    predecode(0xD01E, &in);
+    execute(c, &in);
+    if (c->pc != 0x223) goto dispatch;
+L223: // F21E ADD I, V2
+    STEP(0x223, 0xF21E);
+    c->I += V[2];
+L225: // 700C ADD V0, 0x0C
+    STEP(0x225, 0x700C);
+    V[0] += 0x0C;
+L227: // 3040 SE V0, 0x40
+    STEP(0x227, 0x3040);
+    if (V[0] == 0x40) goto L22B;
+L229: // 1221 JP 0x221
+    STEP(0x229, 0x1221);
+    goto L221;
+L22B: // F00A LD V0, K
+    STEP(0x22B, 0xF00A);
+    if (c->keypad == 0) {
+        c->pc = 0x22B;
+        return cycles - left;
+    }
+    V[0] = __builtin_ctz(c->keypad);
+L22D: // 00E0 CLS
+    STEP(0x22D, 0x00E0);
+    c->pc = 0x22D;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x22F) goto dispatch;
+L22F: // 22D9 CALL 0x2D9
+    STEP(0x22F, 0x22D9);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x22F;
+    goto L2D9;
+L231: // F00A LD V0, K
+    STEP(0x231, 0xF00A);
+    if (c->keypad == 0) {
+        c->pc = 0x231;
+        return cycles - left;
+    }
+    V[0] = __builtin_ctz(c->keypad);
+L233: // 00E0 CLS
+    STEP(0x233, 0x00E0);
+    c->pc = 0x233;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x235) goto dispatch;
+L235: // 8E70 LD VE, V7
+    STEP(0x235, 0x8E70);
+    V[14] = V[7];
+L237: // A31E LD I, 0x31E
+    STEP(0x237, 0xA31E);
+    c->I = 0x31E;
+L239: // 6B1F LD VB, 0x1F
+    STEP(0x239, 0x6B1F);
+    V[11] = 0x1F;
+L23B: // CC1F RND VC, 0x1F
+    STEP(0x23B, 0xCC1F);
+    c->pc = 0x23B;
+    predecode(0xCC1F, &in);
+    execute(c, &in);
+    if (c->pc != 0x23D) goto dispatch;
+L23D: // 8CC4 ADD VC, VC
+    STEP(0x23D, 0x8CC4);
+    V[15] = V[12] + V[12] > 0xFF;
+    V[12] += V[12];
+L23F: // DCB2 DRW VC, VB, 2
+    STEP(0x23F, 0xDCB2);
+    c->pc = 0x23F;
+    predecode(0xDCB2, &in);
+    execute(c, &in);
+    if (c->pc != 0x241) goto dispatch;
+L241: // 3F01 SE VF, 0x01
+    STEP(0x241, 0x3F01);
+    if (V[15] == 0x01) goto L245;
+L243: // 1249 JP 0x249
+    STEP(0x243, 0x1249);
+    goto L249;
+L245: // DCB2 DRW VC, VB, 2
+    STEP(0x245, 0xDCB2);
+    c->pc = 0x245;
+    predecode(0xDCB2, &in);
+    execute(c, &in);
+    if (c->pc != 0x247) goto dispatch;
+L247: // 1239 JP 0x239
+    STEP(0x247, 0x1239);
+    goto L239;
+L249: // CA07 RND VA, 0x07
+    STEP(0x249, 0xCA07);
+    c->pc = 0x249;
+    predecode(0xCA07, &in);
+    execute(c, &in);
+    if (c->pc != 0x24B) goto dispatch;
+L24B: // 7A01 ADD VA, 0x01
+    STEP(0x24B, 0x7A01);
+    V[10] += 0x01;
+L24D: // 7BFE ADD VB, 0xFE
+    STEP(0x24D, 0x7BFE);
+    V[11] += 0xFE;
+L24F: // DCB2 DRW VC, VB, 2
+    STEP(0x24F, 0xDCB2);
+    c->pc = 0x24F;
+    predecode(0xDCB2, &in);
+    execute(c, &in);
+    if (c->pc != 0x251) goto dispatch;
+L251: // 7AFF ADD VA, 0xFF
+    STEP(0x251, 0x7AFF);
+    V[10] += 0xFF;
+L253: // 3A00 SE VA, 0x00
+    STEP(0x253, 0x3A00);
+    if (V[10] == 0x00) goto L257;
+L255: // 124D JP 0x24D
+    STEP(0x255, 0x124D);
+    goto L24D;
+L257: // 7EFF ADD VE, 0xFF
+    STEP(0x257, 0x7EFF);
+    V[14] += 0xFF;
+L259: // 3E00 SE VE, 0x00
+    STEP(0x259, 0x3E00);
+    if (V[14] == 0x00) goto L25D;
+L25B: // 1239 JP 0x239
+    STEP(0x25B, 0x1239);
+    goto L239;
+L25D: // 6B00 LD VB, 0x00
+    STEP(0x25D, 0x6B00);
+    V[11] = 0x00;
+L25F: // 8C70 LD VC, V7
+    STEP(0x25F, 0x8C70);
+    V[12] = V[7];
+L261: // 6D00 LD VD, 0x00
+    STEP(0x261, 0x6D00);
+    V[13] = 0x00;
+L263: // 6E00 LD VE, 0x00
+    STEP(0x263, 0x6E00);
+    V[14] = 0x00;
+L265: // A31B LD I, 0x31B
+    STEP(0x265, 0xA31B);
+    c->I = 0x31B;
+L267: // DDE3 DRW VD, VE, 3
+    STEP(0x267, 0xDDE3);
+    c->pc = 0x267;
+    predecode(0xDDE3, &in);
+    execute(c, &in);
+    if (c->pc != 0x269) goto dispatch;
+L269: // 3F00 SE VF, 0x00
+    STEP(0x269, 0x3F00);
+    if (V[15] == 0x00) goto L26D;
+L26B: // 12C1 JP 0x2C1
+    STEP(0x26B, 0x12C1);
+    goto L2C1;
+L26D: // 3B00 SE VB, 0x00
+    STEP(0x26D, 0x3B00);
+    if (V[11] == 0x00) goto L271;
+L26F: // 1281 JP 0x281
+    STEP(0x26F, 0x1281);
+    goto L281;
+L271: // 6005 LD V0, 0x05
+    STEP(0x271, 0x6005);
+    V[0] = 0x05;
+L273: // E09E SKP V0
+    STEP(0x273, 0xE09E);
+    c->pc = 0x273;
+    predecode(0xE09E, &in);
+    execute(c, &in);
+    if (c->pc != 0x275) goto dispatch;
+L275: // 1287 JP 0x287
+    STEP(0x275, 0x1287);
+    goto L287;
+L277: // 6B01 LD VB, 0x01
+    STEP(0x277, 0x6B01);
+    V[11] = 0x01;
+L279: // 88D0 LD V8, VD
+    STEP(0x279, 0x88D0);
+    V[8] = V[13];
+L27B: // 7802 ADD V8, 0x02
+    STEP(0x27B, 0x7802);
+    V[8] += 0x02;
+L27D: // 89E0 LD V9, VE
+    STEP(0x27D, 0x89E0);
+    V[9] = V[14];
+L27F: // 7903 ADD V9, 0x03
+    STEP(0x27F, 0x7903);
+    V[9] += 0x03;
+L281: // A31E LD I, 0x31E
+    STEP(0x281, 0xA31E);
+    c->I = 0x31E;
+L283: // D891 DRW V8, V9, 1
+    STEP(0x283, 0xD891);
+    c->pc = 0x283;
+    predecode(0xD891, &in);
+    execute(c, &in);
+    if (c->pc != 0x285) goto dispatch;
+L285: // 81F0 LD V1, VF
+    STEP(0x285, 0x81F0);
+    V[1] = V[15];
+L287: // 6005 LD V0, 0x05
+    STEP(0x287, 0x6005);
+    V[0] = 0x05;
+L289: // F015 LD DT, V0
+    STEP(0x289, 0xF015);
+    c->dt = V[0];
+L28B: // F007 LD V0, DT
+    STEP(0x28B, 0xF007);
+    V[0] = c->dt;
+L28D: // 3000 SE V0, 0x00
+    STEP(0x28D, 0x3000);
+    if (V[0] == 0x00) goto L291;
+L28F: // 128B JP 0x28B
+    STEP(0x28F, 0x128B);
+    goto L28B;
+L291: // 3B01 SE VB, 0x01
+    STEP(0x291, 0x3B01);
+    if (V[11] == 0x01) goto L295;
+L293: // 12AB JP 0x2AB
+    STEP(0x293, 0x12AB);
+    goto L2AB;
+L295: // A31E LD I, 0x31E
+    STEP(0x295, 0xA31E);
+    c->I = 0x31E;
+L297: // 3101 SE V1, 0x01
+    STEP(0x297, 0x3101);
+    if (V[1] == 0x01) goto L29B;
+L299: // D891 DRW V8, V9, 1
+    STEP(0x299, 0xD891);
+    c->pc = 0x299;
+    predecode(0xD891, &in);
+    execute(c, &in);
+    if (c->pc != 0x29B) goto dispatch;
+L29B: // 7901 ADD V9, 0x01
+    STEP(0x29B, 0x7901);
+    V[9] += 0x01;
+L29D: // 3920 SE V9, 0x20
+    STEP(0x29D, 0x3920);
+    if (V[9] == 0x20) goto L2A1;
+L29F: // 12AB JP 0x2AB
+    STEP(0x29F, 0x12AB);
+    goto L2AB;
+L2A1: // 6B00 LD VB, 0x00
+    STEP(0x2A1, 0x6B00);
+    V[11] = 0x00;
+L2A3: // 3100 SE V1, 0x00
+    STEP(0x2A3, 0x3100);
+    if (V[1] == 0x00) goto L2A7;
+L2A5: // 7CFF ADD VC, 0xFF
+    STEP(0x2A5, 0x7CFF);
+    V[12] += 0xFF;
+L2A7: // 4C00 SNE VC, 0x00
+    STEP(0x2A7, 0x4C00);
+    if (V[12] != 0x00) goto L2AB;
+L2A9: // 12BB JP 0x2BB
+    STEP(0x2A9, 0x12BB);
+    goto L2BB;
+L2AB: // A31B LD I, 0x31B
+    STEP(0x2AB, 0xA31B);
+    c->I = 0x31B;
+L2AD: // DDE3 DRW VD, VE, 3
+    STEP(0x2AD, 0xDDE3);
+    c->pc = 0x2AD;
+    predecode(0xDDE3, &in);
+    execute(c, &in);
+    if (c->pc != 0x2AF) goto dispatch;
+L2AF: // 7D02 ADD VD, 0x02
+    STEP(0x2AF, 0x7D02);
+    V[13] += 0x02;
+L2B1: // 3D40 SE VD, 0x40
+    STEP(0x2B1, 0x3D40);
+    if (V[13] == 0x40) goto L2B5;
+L2B3: // 12B9 JP 0x2B9
+    STEP(0x2B3, 0x12B9);
+    goto L2B9;
+L2B5: // 6D00 LD VD, 0x00
+    STEP(0x2B5, 0x6D00);
+    V[13] = 0x00;
+L2B7: // 7E01 ADD VE, 0x01
+    STEP(0x2B7, 0x7E01);
+    V[14] += 0x01;
+L2B9: // 1265 JP 0x265
+    STEP(0x2B9, 0x1265);
+    goto L265;
+L2BB: // 00E0 CLS
+    STEP(0x2BB, 0x00E0);
+    c->pc = 0x2BB;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x2BD) goto dispatch;
+L2BD: // 7702 ADD V7, 0x02
+    STEP(0x2BD, 0x7702);
+    V[7] += 0x02;
+L2BF: // 122D JP 0x22D
+    STEP(0x2BF, 0x122D);
+    goto L22D;
+L2C1: // A31B LD I, 0x31B
+    STEP(0x2C1, 0xA31B);
+    c->I = 0x31B;
+L2C3: // DDE3 DRW VD, VE, 3
+    STEP(0x2C3, 0xDDE3);
+    c->pc = 0x2C3;
+    predecode(0xDDE3, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C5) goto dispatch;
+L2C5: // 6014 LD V0, 0x14
+    STEP(0x2C5, 0x6014);
+    V[0] = 0x14;
+L2C7: // 6102 LD V1, 0x02
+    STEP(0x2C7, 0x6102);
+    V[1] = 0x02;
+L2C9: // 620B LD V2, 0x0B
+    STEP(0x2C9, 0x620B);
+    V[2] = 0x0B;
+L2CB: // A320 LD I, 0x320
+    STEP(0x2CB, 0xA320);
+    c->I = 0x320;
+L2CD: // D01B DRW V0, V1, 11
+    STEP(0x2CD, 0xD01B);
+    c->pc = 0x2CD;
+    predecode(0xD01B, &in);
+    execute(c, &in);
+    if (c->pc != 0x2CF) goto dispatch;
+L2CF: // F21E ADD I, V2
+    STEP(0x2CF, 0xF21E);
+    c->I += V[2];
+L2D1: // 7008 ADD V0, 0x08
+    STEP(0x2D1, 0x7008);
+    V[0] += 0x08;
+L2D3: // 302C SE V0, 0x2C
+    STEP(0x2D3, 0x302C);
+    if (V[0] == 0x2C) goto L2D7;
+L2D5: // 12CD JP 0x2CD
+    STEP(0x2D5, 0x12CD);
+    goto L2CD;
+L2D7: // 12D7 JP 0x2D7
+    STEP(0x2D7, 0x12D7);
+    goto L2D7;
+L2D9: // 600A LD V0, 0x0A
+    STEP(0x2D9, 0x600A);
+    V[0] = 0x0A;
+L2DB: // 610D LD V1, 0x0D
+    STEP(0x2DB, 0x610D);
+    V[1] = 0x0D;
+L2DD: // 6205 LD V2, 0x05
+    STEP(0x2DD, 0x6205);
+    V[2] = 0x05;
+L2DF: // A307 LD I, 0x307
+    STEP(0x2DF, 0xA307);
+    c->I = 0x307;
+L2E1: // D015 DRW V0, V1, 5
+    STEP(0x2E1, 0xD015);
+    c->pc = 0x2E1;
+    predecode(0xD015, &in);
+    execute(c, &in);
+    if (c->pc != 0x2E3) goto dispatch;
+L2E3: // F21E ADD I, V2
+    STEP(0x2E3, 0xF21E);
+    c->I += V[2];
+L2E5: // 7008 ADD V0, 0x08
+    STEP(0x2E5, 0x7008);
+    V[0] += 0x08;
+L2E7: // 302A SE V0, 0x2A
+    STEP(0x2E7, 0x302A);
+    if (V[0] == 0x2A) goto L2EB;
+L2E9: // 12E1 JP 0x2E1
+    STEP(0x2E9, 0x12E1);
+    goto L2E1;
+L2EB: // 8070 LD V0, V7
+    STEP(0x2EB, 0x8070);
+    V[0] = V[7];
+L2ED: // 70FE ADD V0, 0xFE
+    STEP(0x2ED, 0x70FE);
+    V[0] += 0xFE;
+L2EF: // 8006 SHR V0, V0
+    STEP(0x2EF, 0x8006);
+    V[15] = V[0] & 1;
+    V[0] >>= 1;
+L2F1: // A387 LD I, 0x387
+    STEP(0x2F1, 0xA387);
+    c->I = 0x387;
+L2F3: // F033 LD B, V0
+    STEP(0x2F3, 0xF033);
+    c->pc = 0x2F3;
+    predecode(0xF033, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2F5) goto dispatch;
+L2F5: // F265 LD V2, [I]
+    STEP(0x2F5, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2F7: // 602D LD V0, 0x2D
+    STEP(0x2F7, 0x602D);
+    V[0] = 0x2D;
+L2F9: // F129 LD F, V1
+    STEP(0x2F9, 0xF129);
+    c->I = V[1] * 5;
+L2FB: // 610D LD V1, 0x0D
+    STEP(0x2FB, 0x610D);
+    V[1] = 0x0D;
+L2FD: // D015 DRW V0, V1, 5
+    STEP(0x2FD, 0xD015);
+    c->pc = 0x2FD;
+    predecode(0xD015, &in);
+    execute(c, &in);
+    if (c->pc != 0x2FF) goto dispatch;
+L2FF: // 7005 ADD V0, 0x05
+    STEP(0x2FF, 0x7005);
+    V[0] += 0x05;
+L301: // F229 LD F, V2
+    STEP(0x301, 0xF229);
+    c->I = V[2] * 5;
+L303: // D015 DRW V0, V1, 5
+    STEP(0x303, 0xD015);
+    c->pc = 0x303;
+    predecode(0xD015, &in);
+    execute(c, &in);
+    if (c->pc != 0x305) goto dispatch;
+L305: // 00EE RET
+    STEP(0x305, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,679 @@
+// generated by chip8-aot from roms/BRIX.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x6E, 0x05, 0x65, 0x00, 0x6B, 0x06, 0x6A, 0x00, 0xA3, 0x0C, 0xDA, 0xB1,
+    0x7A, 0x04, 0x3A, 0x40, 0x12, 0x08, 0x7B, 0x02, 0x3B, 0x12, 0x12, 0x06,
+    0x6C, 0x20, 0x6D, 0x1F, 0xA3, 0x10, 0xDC, 0xD1, 0x22, 0xF6, 0x60, 0x00,
+    0x61, 0x00, 0xA3, 0x12, 0xD0, 0x11, 0x70, 0x08, 0xA3, 0x0E, 0xD0, 0x11,
+    0x60, 0x40, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x34, 0xC6, 0x0F,
+    0x67, 0x1E, 0x68, 0x01, 0x69, 0xFF, 0xA3, 0x0E, 0xD6, 0x71, 0xA3, 0x10,
+    0xDC, 0xD1, 0x60, 0x04, 0xE0, 0xA1, 0x7C, 0xFE, 0x60, 0x06, 0xE0, 0xA1,
+    0x7C, 0x02, 0x60, 0x3F, 0x8C, 0x02, 0xDC, 0xD1, 0xA3, 0x0E, 0xD6, 0x71,
+    0x86, 0x84, 0x87, 0x94, 0x60, 0x3F, 0x86, 0x02, 0x61, 0x1F, 0x87, 0x12,
+    0x47, 0x1F, 0x12, 0xAC, 0x46, 0x00, 0x68, 0x01, 0x46, 0x3F, 0x68, 0xFF,
+    0x47, 0x00, 0x69, 0x01, 0xD6, 0x71, 0x3F, 0x01, 0x12, 0xAA, 0x47, 0x1F,
+    0x12, 0xAA, 0x60, 0x05, 0x80, 0x75, 0x3F, 0x00, 0x12, 0xAA, 0x60, 0x01,
+    0xF0, 0x18, 0x80, 0x60, 0x61, 0xFC, 0x80, 0x12, 0xA3, 0x0C, 0xD0, 0x71,
+    0x60, 0xFE, 0x89, 0x03, 0x22, 0xF6, 0x75, 0x01, 0x22, 0xF6, 0x45, 0x60,
+    0x12, 0xDE, 0x12, 0x46, 0x69, 0xFF, 0x80, 0x60, 0x80, 0xC5, 0x3F, 0x01,
+    0x12, 0xCA, 0x61, 0x02, 0x80, 0x15, 0x3F, 0x01, 0x12, 0xE0, 0x80, 0x15,
+    0x3F, 0x01, 0x12, 0xEE, 0x80, 0x15, 0x3F, 0x01, 0x12, 0xE8, 0x60, 0x20,
+    0xF0, 0x18, 0xA3, 0x0E, 0x7E, 0xFF, 0x80, 0xE0, 0x80, 0x04, 0x61, 0x00,
+    0xD0, 0x11, 0x3E, 0x00, 0x12, 0x30, 0x12, 0xDE, 0x78, 0xFF, 0x48, 0xFE,
+    0x68, 0xFF, 0x12, 0xEE, 0x78, 0x01, 0x48, 0x02, 0x68, 0x01, 0x60, 0x04,
+    0xF0, 0x18, 0x69, 0xFF, 0x12, 0x70, 0xA3, 0x14, 0xF5, 0x33, 0xF2, 0x65,
+    0xF1, 0x29, 0x63, 0x37, 0x64, 0x00, 0xD3, 0x45, 0x73, 0x05, 0xF2, 0x29,
+    0xD3, 0x45, 0x00, 0xEE, 0xE0, 0x00, 0x80, 0x00, 0xFC, 0x00, 0xAA, 0x00,
+    0x00, 0x00, 0x00, 0x00,
+};
+const size_t aot_rom_size = 280;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000001F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+        case 0x2FE: goto L2FE;
+        case 0x300: goto L300;
+        case 0x302: goto L302;
+        case 0x304: goto L304;
+        case 0x306: goto L306;
+        case 0x308: goto L308;
+        case 0x30A: goto L30A;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 6E05 LD VE, 0x05
+    STEP(0x200, 0x6E05);
+    V[14] = 0x05;
+L202: // 6500 LD V5, 0x00
+    STEP(0x202, 0x6500);
+    V[5] = 0x00;
+L204: // 6B06 LD VB, 0x06
+    STEP(0x204, 0x6B06);
+    V[11] = 0x06;
+L206: // 6A00 LD VA, 0x00
+    STEP(0x206, 0x6A00);
+    V[10] = 0x00;
+L208: // A30C LD I, 0x30C
+    STEP(0x208, 0xA30C);
+    c->I = 0x30C;
+L20A: // DAB1 DRW VA, VB, 1
+    STEP(0x20A, 0xDAB1);
+    c->pc = 0x20A;
+    predecode(0xDAB1, &in);
+    execute(c, &in);
+    if (c->pc != 0x20C) goto dispatch;
+L20C: // 7A04 ADD VA, 0x04
+    STEP(0x20C, 0x7A04);
+    V[10] += 0x04;
+L20E: // 3A40 SE VA, 0x40
+    STEP(0x20E, 0x3A40);
+    if (V[10] == 0x40) goto L212;
+L210: // 1208 JP 0x208
+    STEP(0x210, 0x1208);
+    goto L208;
+L212: // 7B02 ADD VB, 0x02
+    STEP(0x212, 0x7B02);
+    V[11] += 0x02;
+L214: // 3B12 SE VB, 0x12
+    STEP(0x214, 0x3B12);
+    if (V[11] == 0x12) goto L218;
+L216: // 1206 JP 0x206
+    STEP(0x216, 0x1206);
+    goto L206;
+L218: // 6C20 LD VC, 0x20
+    STEP(0x218, 0x6C20);
+    V[12] = 0x20;
+L21A: // 6D1F LD VD, 0x1F
+    STEP(0x21A, 0x6D1F);
+    V[13] = 0x1F;
+L21C: // A310 LD I, 0x310
+    STEP(0x21C, 0xA310);
+    c->I = 0x310;
+L21E: // DCD1 DRW VC, VD, 1
+    STEP(0x21E, 0xDCD1);
+    c->pc = 0x21E;
+    predecode(0xDCD1, &in);
+    execute(c, &in);
+    if (c->pc != 0x220) goto dispatch;
+L220: // 22F6 CALL 0x2F6
+    STEP(0x220, 0x22F6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x220;
+    goto L2F6;
+L222: // 6000 LD V0, 0x00
+    STEP(0x222, 0x6000);
+    V[0] = 0x00;
+L224: // 6100 LD V1, 0x00
+    STEP(0x224, 0x6100);
+    V[1] = 0x00;
+L226: // A312 LD I, 0x312
+    STEP(0x226, 0xA312);
+    c->I = 0x312;
+L228: // D011 DRW V0, V1, 1
+    STEP(0x228, 0xD011);
+    c->pc = 0x228;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x22A) goto dispatch;
+L22A: // 7008 ADD V0, 0x08
+    STEP(0x22A, 0x7008);
+    V[0] += 0x08;
+L22C: // A30E LD I, 0x30E
+    STEP(0x22C, 0xA30E);
+    c->I = 0x30E;
+L22E: // D011 DRW V0, V1, 1
+    STEP(0x22E, 0xD011);
+    c->pc = 0x22E;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x230) goto dispatch;
+L230: // 6040 LD V0, 0x40
+    STEP(0x230, 0x6040);
+    V[0] = 0x40;
+L232: // F015 LD DT, V0
+    STEP(0x232, 0xF015);
+    c->dt = V[0];
+L234: // F007 LD V0, DT
+    STEP(0x234, 0xF007);
+    V[0] = c->dt;
+L236: // 3000 SE V0, 0x00
+    STEP(0x236, 0x3000);
+    if (V[0] == 0x00) goto L23A;
+L238: // 1234 JP 0x234
+    STEP(0x238, 0x1234);
+    goto L234;
+L23A: // C60F RND V6, 0x0F
+    STEP(0x23A, 0xC60F);
+    c->pc = 0x23A;
+    predecode(0xC60F, &in);
+    execute(c, &in);
+    if (c->pc != 0x23C) goto dispatch;
+L23C: // 671E LD V7, 0x1E
+    STEP(0x23C, 0x671E);
+    V[7] = 0x1E;
+L23E: // 6801 LD V8, 0x01
+    STEP(0x23E, 0x6801);
+    V[8] = 0x01;
+L240: // 69FF LD V9, 0xFF
+    STEP(0x240, 0x69FF);
+    V[9] = 0xFF;
+L242: // A30E LD I, 0x30E
+    STEP(0x242, 0xA30E);
+    c->I = 0x30E;
+L244: // D671 DRW V6, V7, 1
+    STEP(0x244, 0xD671);
+    c->pc = 0x244;
+    predecode(0xD671, &in);
+    execute(c, &in);
+    if (c->pc != 0x246) goto dispatch;
+L246: // A310 LD I, 0x310
+    STEP(0x246, 0xA310);
+    c->I = 0x310;
+L248: // DCD1 DRW VC, VD, 1
+    STEP(0x248, 0xDCD1);
+    c->pc = 0x248;
+    predecode(0xDCD1, &in);
+    execute(c, &in);
+    if (c->pc != 0x24A) goto dispatch;
+L24A: // 6004 LD V0, 0x04
+    STEP(0x24A, 0x6004);
+    V[0] = 0x04;
+L24C: // E0A1 SKNP V0
+    STEP(0x24C, 0xE0A1);
+    c->pc = 0x24C;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x24E) goto dispatch;
+L24E: // 7CFE ADD VC, 0xFE
+    STEP(0x24E, 0x7CFE);
+    V[12] += 0xFE;
+L250: // 6006 LD V0, 0x06
+    STEP(0x250, 0x6006);
+    V[0] = 0x06;
+L252: // E0A1 SKNP V0
+    STEP(0x252, 0xE0A1);
+    c->pc = 0x252;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x254) goto dispatch;
+L254: // 7C02 ADD VC, 0x02
+    STEP(0x254, 0x7C02);
+    V[12] += 0x02;
+L256: // 603F LD V0, 0x3F
+    STEP(0x256, 0x603F);
+    V[0] = 0x3F;
+L258: // 8C02 AND VC, V0
+    STEP(0x258, 0x8C02);
+    V[12] &= V[0];
+L25A: // DCD1 DRW VC, VD, 1
+    STEP(0x25A, 0xDCD1);
+    c->pc = 0x25A;
+    predecode(0xDCD1, &in);
+    execute(c, &in);
+    if (c->pc != 0x25C) goto dispatch;
+L25C: // A30E LD I, 0x30E
+    STEP(0x25C, 0xA30E);
+    c->I = 0x30E;
+L25E: // D671 DRW V6, V7, 1
+    STEP(0x25E, 0xD671);
+    c->pc = 0x25E;
+    predecode(0xD671, &in);
+    execute(c, &in);
+    if (c->pc != 0x260) goto dispatch;
+L260: // 8684 ADD V6, V8
+    STEP(0x260, 0x8684);
+    V[15] = V[6] + V[8] > 0xFF;
+    V[6] += V[8];
+L262: // 8794 ADD V7, V9
+    STEP(0x262, 0x8794);
+    V[15] = V[7] + V[9] > 0xFF;
+    V[7] += V[9];
+L264: // 603F LD V0, 0x3F
+    STEP(0x264, 0x603F);
+    V[0] = 0x3F;
+L266: // 8602 AND V6, V0
+    STEP(0x266, 0x8602);
+    V[6] &= V[0];
+L268: // 611F LD V1, 0x1F
+    STEP(0x268, 0x611F);
+    V[1] = 0x1F;
+L26A: // 8712 AND V7, V1
+    STEP(0x26A, 0x8712);
+    V[7] &= V[1];
+L26C: // 471F SNE V7, 0x1F
+    STEP(0x26C, 0x471F);
+    if (V[7] != 0x1F) goto L270;
+L26E: // 12AC JP 0x2AC
+    STEP(0x26E, 0x12AC);
+    goto L2AC;
+L270: // 4600 SNE V6, 0x00
+    STEP(0x270, 0x4600);
+    if (V[6] != 0x00) goto L274;
+L272: // 6801 LD V8, 0x01
+    STEP(0x272, 0x6801);
+    V[8] = 0x01;
+L274: // 463F SNE V6, 0x3F
+    STEP(0x274, 0x463F);
+    if (V[6] != 0x3F) goto L278;
+L276: // 68FF LD V8, 0xFF
+    STEP(0x276, 0x68FF);
+    V[8] = 0xFF;
+L278: // 4700 SNE V7, 0x00
+    STEP(0x278, 0x4700);
+    if (V[7] != 0x00) goto L27C;
+L27A: // 6901 LD V9, 0x01
+    STEP(0x27A, 0x6901);
+    V[9] = 0x01;
+L27C: // D671 DRW V6, V7, 1
+    STEP(0x27C, 0xD671);
+    c->pc = 0x27C;
+    predecode(0xD671, &in);
+    execute(c, &in);
+    if (c->pc != 0x27E) goto dispatch;
+L27E: // 3F01 SE VF, 0x01
+    STEP(0x27E, 0x3F01);
+    if (V[15] == 0x01) goto L282;
+L280: // 12AA JP 0x2AA
+    STEP(0x280, 0x12AA);
+    goto L2AA;
+L282: // 471F SNE V7, 0x1F
+    STEP(0x282, 0x471F);
+    if (V[7] != 0x1F) goto L286;
+L284: // 12AA JP 0x2AA
+    STEP(0x284, 0x12AA);
+    goto L2AA;
+L286: // 6005 LD V0, 0x05
+    STEP(0x286, 0x6005);
+    V[0] = 0x05;
+L288: // 8075 SUB V0, V7
+    STEP(0x288, 0x8075);
+    V[15] = V[0] > V[7];
+    V[0] -= V[7];
+L28A: // 3F00 SE VF, 0x00
+    STEP(0x28A, 0x3F00);
+    if (V[15] == 0x00) goto L28E;
+L28C: // 12AA JP 0x2AA
+    STEP(0x28C, 0x12AA);
+    goto L2AA;
+L28E: // 6001 LD V0, 0x01
+    STEP(0x28E, 0x6001);
+    V[0] = 0x01;
+L290: // F018 LD ST, V0
+    STEP(0x290, 0xF018);
+    c->st = V[0];
+L292: // 8060 LD V0, V6
+    STEP(0x292, 0x8060);
+    V[0] = V[6];
+L294: // 61FC LD V1, 0xFC
+    STEP(0x294, 0x61FC);
+    V[1] = 0xFC;
+L296: // 8012 AND V0, V1
+    STEP(0x296, 0x8012);
+    V[0] &= V[1];
+L298: // A30C LD I, 0x30C
+    STEP(0x298, 0xA30C);
+    c->I = 0x30C;
+L29A: // D071 DRW V0, V7, 1
+    STEP(0x29A, 0xD071);
+    c->pc = 0x29A;
+    predecode(0xD071, &in);
+    execute(c, &in);
+    if (c->pc != 0x29C) goto dispatch;
+L29C: // 60FE LD V0, 0xFE
+    STEP(0x29C, 0x60FE);
+    V[0] = 0xFE;
+L29E: // 8903 XOR V9, V0
+    STEP(0x29E, 0x8903);
+    V[9] ^= V[0];
+L2A0: // 22F6 CALL 0x2F6
+    STEP(0x2A0, 0x22F6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2A0;
+    goto L2F6;
+L2A2: // 7501 ADD V5, 0x01
+    STEP(0x2A2, 0x7501);
+    V[5] += 0x01;
+L2A4: // 22F6 CALL 0x2F6
+    STEP(0x2A4, 0x22F6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2A4;
+    goto L2F6;
+L2A6: // 4560 SNE V5, 0x60
+    STEP(0x2A6, 0x4560);
+    if (V[5] != 0x60) goto L2AA;
+L2A8: // 12DE JP 0x2DE
+    STEP(0x2A8, 0x12DE);
+    goto L2DE;
+L2AA: // 1246 JP 0x246
+    STEP(0x2AA, 0x1246);
+    goto L246;
+L2AC: // 69FF LD V9, 0xFF
+    STEP(0x2AC, 0x69FF);
+    V[9] = 0xFF;
+L2AE: // 8060 LD V0, V6
+    STEP(0x2AE, 0x8060);
+    V[0] = V[6];
+L2B0: // 80C5 SUB V0, VC
+    STEP(0x2B0, 0x80C5);
+    V[15] = V[0] > V[12];
+    V[0] -= V[12];
+L2B2: // 3F01 SE VF, 0x01
+    STEP(0x2B2, 0x3F01);
+    if (V[15] == 0x01) goto L2B6;
+L2B4: // 12CA JP 0x2CA
+    STEP(0x2B4, 0x12CA);
+    goto L2CA;
+L2B6: // 6102 LD V1, 0x02
+    STEP(0x2B6, 0x6102);
+    V[1] = 0x02;
+L2B8: // 8015 SUB V0, V1
+    STEP(0x2B8, 0x8015);
+    V[15] = V[0] > V[1];
+    V[0] -= V[1];
+L2BA: // 3F01 SE VF, 0x01
+    STEP(0x2BA, 0x3F01);
+    if (V[15] == 0x01) goto L2BE;
+L2BC: // 12E0 JP 0x2E0
+    STEP(0x2BC, 0x12E0);
+    goto L2E0;
+L2BE: // 8015 SUB V0, V1
+    STEP(0x2BE, 0x8015);
+    V[15] = V[0] > V[1];
+    V[0] -= V[1];
+L2C0: // 3F01 SE VF, 0x01
+    STEP(0x2C0, 0x3F01);
+    if (V[15] == 0x01) goto L2C4;
+L2C2: // 12EE JP 0x2EE
+    STEP(0x2C2, 0x12EE);
+    goto L2EE;
+L2C4: // 8015 SUB V0, V1
+    STEP(0x2C4, 0x8015);
+    V[15] = V[0] > V[1];
+    V[0] -= V[1];
+L2C6: // 3F01 SE VF, 0x01
+    STEP(0x2C6, 0x3F01);
+    if (V[15] == 0x01) goto L2CA;
+L2C8: // 12E8 JP 0x2E8
+    STEP(0x2C8, 0x12E8);
+    goto L2E8;
+L2CA: // 6020 LD V0, 0x20
+    STEP(0x2CA, 0x6020);
+    V[0] = 0x20;
+L2CC: // F018 LD ST, V0
+    STEP(0x2CC, 0xF018);
+    c->st = V[0];
+L2CE: // A30E LD I, 0x30E
+    STEP(0x2CE, 0xA30E);
+    c->I = 0x30E;
+L2D0: // 7EFF ADD VE, 0xFF
+    STEP(0x2D0, 0x7EFF);
+    V[14] += 0xFF;
+L2D2: // 80E0 LD V0, VE
+    STEP(0x2D2, 0x80E0);
+    V[0] = V[14];
+L2D4: // 8004 ADD V0, V0
+    STEP(0x2D4, 0x8004);
+    V[15] = V[0] + V[0] > 0xFF;
+    V[0] += V[0];
+L2D6: // 6100 LD V1, 0x00
+    STEP(0x2D6, 0x6100);
+    V[1] = 0x00;
+L2D8: // D011 DRW V0, V1, 1
+    STEP(0x2D8, 0xD011);
+    c->pc = 0x2D8;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x2DA) goto dispatch;
+L2DA: // 3E00 SE VE, 0x00
+    STEP(0x2DA, 0x3E00);
+    if (V[14] == 0x00) goto L2DE;
+L2DC: // 1230 JP 0x230
+    STEP(0x2DC, 0x1230);
+    goto L230;
+L2DE: // 12DE JP 0x2DE
+    STEP(0x2DE, 0x12DE);
+    goto L2DE;
+L2E0: // 78FF ADD V8, 0xFF
+    STEP(0x2E0, 0x78FF);
+    V[8] += 0xFF;
+L2E2: // 48FE SNE V8, 0xFE
+    STEP(0x2E2, 0x48FE);
+    if (V[8] != 0xFE) goto L2E6;
+L2E4: // 68FF LD V8, 0xFF
+    STEP(0x2E4, 0x68FF);
+    V[8] = 0xFF;
+L2E6: // 12EE JP 0x2EE
+    STEP(0x2E6, 0x12EE);
+    goto L2EE;
+L2E8: // 7801 ADD V8, 0x01
+    STEP(0x2E8, 0x7801);
+    V[8] += 0x01;
+L2EA: // 4802 SNE V8, 0x02
+    STEP(0x2EA, 0x4802);
+    if (V[8] != 0x02) goto L2EE;
+L2EC: // 6801 LD V8, 0x01
+    STEP(0x2EC, 0x6801);
+    V[8] = 0x01;
+L2EE: // 6004 LD V0, 0x04
+    STEP(0x2EE, 0x6004);
+    V[0] = 0x04;
+L2F0: // F018 LD ST, V0
+    STEP(0x2F0, 0xF018);
+    c->st = V[0];
+L2F2: // 69FF LD V9, 0xFF
+    STEP(0x2F2, 0x69FF);
+    V[9] = 0xFF;
+L2F4: // 1270 JP 0x270
+    STEP(0x2F4, 0x1270);
+    goto L270;
+L2F6: // A314 LD I, 0x314
+    STEP(0x2F6, 0xA314);
+    c->I = 0x314;
+L2F8: // F533 LD B, V5
+    STEP(0x2F8, 0xF533);
+    c->pc = 0x2F8;
+    predecode(0xF533, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2FA) goto dispatch;
+L2FA: // F265 LD V2, [I]
+    STEP(0x2FA, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2FC: // F129 LD F, V1
+    STEP(0x2FC, 0xF129);
+    c->I = V[1] * 5;
+L2FE: // 6337 LD V3, 0x37
+    STEP(0x2FE, 0x6337);
+    V[3] = 0x37;
+L300: // 6400 LD V4, 0x00
+    STEP(0x300, 0x6400);
+    V[4] = 0x00;
+L302: // D345 DRW V3, V4, 5
+    STEP(0x302, 0xD345);
+    c->pc = 0x302;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x304) goto dispatch;
+L304: // 7305 ADD V3, 0x05
+    STEP(0x304, 0x7305);
+    V[3] += 0x05;
+L306: // F229 LD F, V2
+    STEP(0x306, 0xF229);
+    c->I = V[2] * 5;
+L308: // D345 DRW V3, V4, 5
+    STEP(0x308, 0xD345);
+    c->pc = 0x308;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x30A) goto dispatch;
+L30A: // 00EE RET
+    STEP(0x30A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,243 @@
+// generated by chip8-aot from roms/TEST/C8PIC.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x00, 0xE0, 0xA2, 0x48, 0x60, 0x00, 0x61, 0x1E, 0x62, 0x00, 0xD2, 0x02,
+    0xD2, 0x12, 0x72, 0x08, 0x32, 0x40, 0x12, 0x0A, 0x60, 0x00, 0x61, 0x3E,
+    0x62, 0x02, 0xA2, 0x4A, 0xD0, 0x2E, 0xD1, 0x2E, 0x72, 0x0E, 0xD0, 0x2E,
+    0xD1, 0x2E, 0xA2, 0x58, 0x60, 0x0B, 0x61, 0x08, 0xD0, 0x1F, 0x70, 0x0A,
+    0xA2, 0x67, 0xD0, 0x1F, 0x70, 0x0A, 0xA2, 0x76, 0xD0, 0x1F, 0x70, 0x03,
+    0xA2, 0x85, 0xD0, 0x1F, 0x70, 0x0A, 0xA2, 0x94, 0xD0, 0x1F, 0x12, 0x46,
+    0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0xFF, 0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF,
+    0x81, 0x81, 0x81, 0x81, 0x81, 0x81, 0xFF, 0xFF,
+};
+const size_t aot_rom_size = 164;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000300ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 00E0 CLS
+    STEP(0x200, 0x00E0);
+    c->pc = 0x200;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x202) goto dispatch;
+L202: // A248 LD I, 0x248
+    STEP(0x202, 0xA248);
+    c->I = 0x248;
+L204: // 6000 LD V0, 0x00
+    STEP(0x204, 0x6000);
+    V[0] = 0x00;
+L206: // 611E LD V1, 0x1E
+    STEP(0x206, 0x611E);
+    V[1] = 0x1E;
+L208: // 6200 LD V2, 0x00
+    STEP(0x208, 0x6200);
+    V[2] = 0x00;
+L20A: // D202 DRW V2, V0, 2
+    STEP(0x20A, 0xD202);
+    c->pc = 0x20A;
+    predecode(0xD202, &in);
+    execute(c, &in);
+    if (c->pc != 0x20C) goto dispatch;
+L20C: // D212 DRW V2, V1, 2
+    STEP(0x20C, 0xD212);
+    c->pc = 0x20C;
+    predecode(0xD212, &in);
+    execute(c, &in);
+    if (c->pc != 0x20E) goto dispatch;
+L20E: // 7208 ADD V2, 0x08
+    STEP(0x20E, 0x7208);
+    V[2] += 0x08;
+L210: // 3240 SE V2, 0x40
+    STEP(0x210, 0x3240);
+    if (V[2] == 0x40) goto L214;
+L212: // 120A JP 0x20A
+    STEP(0x212, 0x120A);
+    goto L20A;
+L214: // 6000 LD V0, 0x00
+    STEP(0x214, 0x6000);
+    V[0] = 0x00;
+L216: // 613E LD V1, 0x3E
+    STEP(0x216, 0x613E);
+    V[1] = 0x3E;
+L218: // 6202 LD V2, 0x02
+    STEP(0x218, 0x6202);
+    V[2] = 0x02;
+L21A: // A24A LD I, 0x24A
+    STEP(0x21A, 0xA24A);
+    c->I = 0x24A;
+L21C: // D02E DRW V0, V2, 14
+    STEP(0x21C, 0xD02E);
+    c->pc = 0x21C;
+    predecode(0xD02E, &in);
+    execute(c, &in);
+    if (c->pc != 0x21E) goto dispatch;
+L21E: // D12E DRW V1, V2, 14
+    STEP(0x21E, 0xD12E);
+    c->pc = 0x21E;
+    predecode(0xD12E, &in);
+    execute(c, &in);
+    if (c->pc != 0x220) goto dispatch;
+L220: // 720E ADD V2, 0x0E
+    STEP(0x220, 0x720E);
+    V[2] += 0x0E;
+L222: // D02E DRW V0, V2, 14
+    STEP(0x222, 0xD02E);
+    c->pc = 0x222;
+    predecode(0xD02E, &in);
+    execute(c, &in);
+    if (c->pc != 0x224) goto dispatch;
+L224: // D12E DRW V1, V2, 14
+    STEP(0x224, 0xD12E);
+    c->pc = 0x224;
+    predecode(0xD12E, &in);
+    execute(c, &in);
+    if (c->pc != 0x226) goto dispatch;
+L226: // A258 LD I, 0x258
+    STEP(0x226, 0xA258);
+    c->I = 0x258;
+L228: // 600B LD V0, 0x0B
+    STEP(0x228, 0x600B);
+    V[0] = 0x0B;
+L22A: // 6108 LD V1, 0x08
+    STEP(0x22A, 0x6108);
+    V[1] = 0x08;
+L22C: // D01F DRW V0, V1, 15
+    STEP(0x22C, 0xD01F);
+    c->pc = 0x22C;
+    predecode(0xD01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x22E) goto dispatch;
+L22E: // 700A ADD V0, 0x0A
+    STEP(0x22E, 0x700A);
+    V[0] += 0x0A;
+L230: // A267 LD I, 0x267
+    STEP(0x230, 0xA267);
+    c->I = 0x267;
+L232: // D01F DRW V0, V1, 15
+    STEP(0x232, 0xD01F);
+    c->pc = 0x232;
+    predecode(0xD01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x234) goto dispatch;
+L234: // 700A ADD V0, 0x0A
+    STEP(0x234, 0x700A);
+    V[0] += 0x0A;
+L236: // A276 LD I, 0x276
+    STEP(0x236, 0xA276);
+    c->I = 0x276;
+L238: // D01F DRW V0, V1, 15
+    STEP(0x238, 0xD01F);
+    c->pc = 0x238;
+    predecode(0xD01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x23A) goto dispatch;
+L23A: // 7003 ADD V0, 0x03
+    STEP(0x23A, 0x7003);
+    V[0] += 0x03;
+L23C: // A285 LD I, 0x285
+    STEP(0x23C, 0xA285);
+    c->I = 0x285;
+L23E: // D01F DRW V0, V1, 15
+    STEP(0x23E, 0xD01F);
+    c->pc = 0x23E;
+    predecode(0xD01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x240) goto dispatch;
+L240: // 700A ADD V0, 0x0A
+    STEP(0x240, 0x700A);
+    V[0] += 0x0A;
+L242: // A294 LD I, 0x294
+    STEP(0x242, 0xA294);
+    c->I = 0x294;
+L244: // D01F DRW V0, V1, 15
+    STEP(0x244, 0xD01F);
+    c->pc = 0x244;
+    predecode(0xD01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x246) goto dispatch;
+L246: // 1246 JP 0x246
+    STEP(0x246, 0x1246);
+    goto L246;
+}
@@ -0,0 +1,2071 @@
+// generated by chip8-aot from roms/CAVE.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x00, 0xE0, 0x64, 0x00, 0x65, 0x00, 0xA2, 0x0A, 0x12, 0x0C, 0xCC, 0x33,
+    0x66, 0x1E, 0xD4, 0x52, 0xD4, 0x62, 0x74, 0x08, 0x44, 0x40, 0x12, 0x1A,
+    0x12, 0x0E, 0xA2, 0x1E, 0x12, 0x2C, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x64, 0x0D, 0x65, 0x09,
+    0xD4, 0x5E, 0x74, 0x0A, 0xA2, 0x3A, 0xD4, 0x5E, 0x12, 0x48, 0xFF, 0xFF,
+    0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3,
+    0x74, 0x0A, 0xA2, 0x50, 0xD4, 0x5E, 0x12, 0x5E, 0xC3, 0xC3, 0xC3, 0xC3,
+    0xC3, 0x66, 0x66, 0x66, 0x66, 0x66, 0x3C, 0x3C, 0x18, 0x18, 0x74, 0x0A,
+    0xA2, 0x66, 0xD4, 0x5E, 0x12, 0x74, 0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0,
+    0xFF, 0xFF, 0xC0, 0xC0, 0xC0, 0xC0, 0xFF, 0xFF, 0x6A, 0x01, 0x6B, 0x04,
+    0x6C, 0x0E, 0x6D, 0x00, 0xA2, 0x81, 0x12, 0xA6, 0x80, 0xFF, 0xFF, 0xFF,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0x64, 0x00, 0x65, 0x00,
+    0xD4, 0x58, 0x74, 0x08, 0x44, 0x40, 0x22, 0x9E, 0x45, 0x20, 0x12, 0xA4,
+    0x12, 0x90, 0x64, 0x00, 0x75, 0x08, 0x00, 0xEE, 0x12, 0xAE, 0x60, 0x0F,
+    0xE0, 0x9E, 0x12, 0xA8, 0x12, 0x8A, 0x4A, 0x01, 0x22, 0xD0, 0x4A, 0x02,
+    0x23, 0x8A, 0x4A, 0x03, 0x23, 0xB8, 0x4A, 0x04, 0x23, 0xE0, 0x4A, 0x05,
+    0x24, 0x18, 0x4A, 0x06, 0x24, 0x78, 0x4A, 0x07, 0x24, 0xE6, 0x4A, 0x08,
+    0x25, 0x10, 0x13, 0x18, 0xA2, 0x81, 0x64, 0x02, 0x65, 0x02, 0xD4, 0x58,
+    0x65, 0x0A, 0xD4, 0x58, 0x65, 0x12, 0xD4, 0x58, 0x64, 0x0A, 0x65, 0x05,
+    0xD4, 0x53, 0x64, 0x12, 0xD4, 0x53, 0x64, 0x1A, 0xD4, 0x53, 0x64, 0x22,
+    0xD4, 0x53, 0x64, 0x2A, 0xD4, 0x53, 0x64, 0x32, 0xD4, 0x53, 0xA2, 0xFE,
+    0x13, 0x0A, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC, 0xFC,
+    0xFC, 0xFC, 0x75, 0x03, 0x74, 0x02, 0xD4, 0x5C, 0x74, 0x06, 0x75, 0x09,
+    0xD4, 0x53, 0x00, 0xEE, 0xA2, 0x80, 0xDB, 0xC1, 0x4F, 0x01, 0x13, 0x72,
+    0x60, 0x02, 0xE0, 0xA1, 0x6D, 0x02, 0x60, 0x04, 0xE0, 0xA1, 0x6D, 0x04,
+    0x60, 0x06, 0xE0, 0xA1, 0x6D, 0x06, 0x60, 0x08, 0xE0, 0xA1, 0x6D, 0x08,
+    0xDB, 0xC1, 0x4D, 0x02, 0x7C, 0xFF, 0x4D, 0x04, 0x7B, 0xFF, 0x4D, 0x06,
+    0x7B, 0x01, 0x4D, 0x08, 0x7C, 0x01, 0x4B, 0x40, 0x13, 0x5E, 0x4B, 0xFF,
+    0x13, 0x64, 0x60, 0x02, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x13, 0x56,
+    0x13, 0x18, 0x7A, 0x01, 0x4A, 0x09, 0x15, 0x3A, 0x6B, 0x01, 0xA2, 0x81,
+    0x12, 0x8A, 0x7A, 0xFF, 0x6B, 0x3E, 0xA2, 0x81, 0x12, 0x8A, 0x60, 0x03,
+    0xF0, 0x18, 0x60, 0x0F, 0xE0, 0x9E, 0x13, 0x78, 0x6A, 0x01, 0x6B, 0x04,
+    0x6C, 0x0E, 0x6D, 0x00, 0xA2, 0x81, 0x00, 0xE0, 0x12, 0x8A, 0x64, 0x00,
+    0x65, 0x11, 0xA2, 0x81, 0xD4, 0x53, 0x74, 0x08, 0xD4, 0x53, 0x74, 0x08,
+    0x75, 0xFF, 0xD4, 0x53, 0x74, 0x08, 0x75, 0xFF, 0xD4, 0x53, 0x74, 0x08,
+    0xD4, 0x53, 0x74, 0x08, 0xD4, 0x53, 0x74, 0x08, 0x75, 0x01, 0xD4, 0x53,
+    0x74, 0x08, 0x75, 0x01, 0xD4, 0x53, 0x00, 0xEE, 0x64, 0x00, 0x65, 0x11,
+    0xA2, 0x81, 0xD4, 0x53, 0x74, 0x08, 0xD4, 0x53, 0x74, 0x08, 0x75, 0x02,
+    0xD4, 0x52, 0x74, 0x08, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x74, 0x08,
+    0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x00, 0xEE,
+    0x64, 0x00, 0x65, 0x13, 0xA2, 0x81, 0xD4, 0x51, 0xA2, 0x80, 0x74, 0x08,
+    0xD4, 0x51, 0x75, 0x01, 0xD4, 0x51, 0x75, 0x01, 0xA2, 0x81, 0xD4, 0x51,
+    0x74, 0x08, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x52, 0x74, 0x08, 0x75, 0xFF,
+    0xD4, 0x53, 0x74, 0x08, 0xD4, 0x54, 0x74, 0x08, 0x75, 0xFF, 0xD4, 0x56,
+    0x74, 0x08, 0x75, 0xFF, 0xD4, 0x58, 0x00, 0xEE, 0x64, 0x00, 0x65, 0x12,
+    0xA2, 0x81, 0xD4, 0x58, 0x74, 0x08, 0xD4, 0x58, 0x74, 0x08, 0xD4, 0x58,
+    0x74, 0x08, 0xD4, 0x58, 0x74, 0x08, 0xD4, 0x58, 0x74, 0x08, 0xD4, 0x58,
+    0x74, 0x08, 0xD4, 0x58, 0xA2, 0x80, 0x75, 0xFF, 0x74, 0x20, 0xD4, 0x51,
+    0x75, 0xFF, 0xD4, 0x51, 0x75, 0xFF, 0xD4, 0x51, 0x75, 0xFF, 0xD4, 0x51,
+    0x75, 0xFF, 0xD4, 0x51, 0x75, 0xFF, 0xD4, 0x51, 0x75, 0xFF, 0xD4, 0x51,
+    0x75, 0xFF, 0xD4, 0x51, 0x75, 0xFF, 0xA2, 0x81, 0xD4, 0x51, 0x74, 0x08,
+    0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x74, 0x08,
+    0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x00, 0xEE, 0x64, 0x00, 0x65, 0x09,
+    0xA2, 0x81, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51,
+    0x74, 0x08, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51,
+    0xA2, 0x80, 0x75, 0x01, 0xD4, 0x51, 0x75, 0x01, 0xD4, 0x51, 0x75, 0x01,
+    0xD4, 0x51, 0x75, 0x01, 0xD4, 0x51, 0x75, 0x01, 0xD4, 0x51, 0x75, 0x01,
+    0xD4, 0x51, 0x75, 0x01, 0xD4, 0x51, 0x75, 0x01, 0xD4, 0x51, 0x75, 0x01,
+    0xD4, 0x51, 0x75, 0x01, 0xD4, 0x51, 0x75, 0x01, 0xD4, 0x51, 0x75, 0x01,
+    0xD4, 0x51, 0x75, 0x01, 0xD4, 0x51, 0x75, 0x01, 0xD4, 0x51, 0x75, 0x01,
+    0xD4, 0x51, 0x75, 0x01, 0xD4, 0x51, 0x75, 0x01, 0xA2, 0x81, 0xD4, 0x51,
+    0x74, 0x08, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x00, 0xEE, 0x64, 0x00,
+    0x65, 0x1A, 0xA2, 0x81, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x74, 0x08,
+    0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x75, 0xFF,
+    0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x74, 0x08,
+    0xD4, 0x51, 0x00, 0xEE, 0x64, 0x00, 0x65, 0x19, 0xA2, 0x81, 0xD4, 0x51,
+    0x74, 0x08, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51,
+    0x74, 0x08, 0xD4, 0x51, 0x75, 0xFF, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51,
+    0x74, 0x08, 0xD4, 0x51, 0x74, 0x08, 0xD4, 0x51, 0x00, 0xEE, 0x00, 0xE0,
+    0x67, 0x03, 0x68, 0x03, 0xA5, 0x44, 0x15, 0x5C, 0xAE, 0xAA, 0xEA, 0x4A,
+    0x4E, 0x00, 0xA4, 0xA4, 0xA4, 0xA5, 0xE2, 0x00, 0x5D, 0x55, 0x55, 0x55,
+    0x9D, 0x00, 0xC8, 0x48, 0x48, 0x40, 0x48, 0x00, 0xD7, 0x85, 0xA5, 0x4A,
+    0x77, 0x08, 0xD7, 0x85, 0x77, 0x08, 0xA5, 0x50, 0xD7, 0x85, 0x77, 0x08,
+    0xA5, 0x56, 0xD7, 0x85, 0x15, 0x70,
+};
+const size_t aot_rom_size = 882;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x00000000003FFF00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+        case 0x30A: goto L30A;
+        case 0x30C: goto L30C;
+        case 0x30E: goto L30E;
+        case 0x310: goto L310;
+        case 0x312: goto L312;
+        case 0x314: goto L314;
+        case 0x316: goto L316;
+        case 0x318: goto L318;
+        case 0x31A: goto L31A;
+        case 0x31C: goto L31C;
+        case 0x31E: goto L31E;
+        case 0x320: goto L320;
+        case 0x322: goto L322;
+        case 0x324: goto L324;
+        case 0x326: goto L326;
+        case 0x328: goto L328;
+        case 0x32A: goto L32A;
+        case 0x32C: goto L32C;
+        case 0x32E: goto L32E;
+        case 0x330: goto L330;
+        case 0x332: goto L332;
+        case 0x334: goto L334;
+        case 0x336: goto L336;
+        case 0x338: goto L338;
+        case 0x33A: goto L33A;
+        case 0x33C: goto L33C;
+        case 0x33E: goto L33E;
+        case 0x340: goto L340;
+        case 0x342: goto L342;
+        case 0x344: goto L344;
+        case 0x346: goto L346;
+        case 0x348: goto L348;
+        case 0x34A: goto L34A;
+        case 0x34C: goto L34C;
+        case 0x34E: goto L34E;
+        case 0x350: goto L350;
+        case 0x352: goto L352;
+        case 0x354: goto L354;
+        case 0x356: goto L356;
+        case 0x358: goto L358;
+        case 0x35A: goto L35A;
+        case 0x35C: goto L35C;
+        case 0x35E: goto L35E;
+        case 0x360: goto L360;
+        case 0x362: goto L362;
+        case 0x364: goto L364;
+        case 0x366: goto L366;
+        case 0x368: goto L368;
+        case 0x372: goto L372;
+        case 0x374: goto L374;
+        case 0x376: goto L376;
+        case 0x378: goto L378;
+        case 0x37A: goto L37A;
+        case 0x37C: goto L37C;
+        case 0x37E: goto L37E;
+        case 0x380: goto L380;
+        case 0x382: goto L382;
+        case 0x384: goto L384;
+        case 0x386: goto L386;
+        case 0x388: goto L388;
+        case 0x38A: goto L38A;
+        case 0x38C: goto L38C;
+        case 0x38E: goto L38E;
+        case 0x390: goto L390;
+        case 0x392: goto L392;
+        case 0x394: goto L394;
+        case 0x396: goto L396;
+        case 0x398: goto L398;
+        case 0x39A: goto L39A;
+        case 0x39C: goto L39C;
+        case 0x39E: goto L39E;
+        case 0x3A0: goto L3A0;
+        case 0x3A2: goto L3A2;
+        case 0x3A4: goto L3A4;
+        case 0x3A6: goto L3A6;
+        case 0x3A8: goto L3A8;
+        case 0x3AA: goto L3AA;
+        case 0x3AC: goto L3AC;
+        case 0x3AE: goto L3AE;
+        case 0x3B0: goto L3B0;
+        case 0x3B2: goto L3B2;
+        case 0x3B4: goto L3B4;
+        case 0x3B6: goto L3B6;
+        case 0x3B8: goto L3B8;
+        case 0x3BA: goto L3BA;
+        case 0x3BC: goto L3BC;
+        case 0x3BE: goto L3BE;
+        case 0x3C0: goto L3C0;
+        case 0x3C2: goto L3C2;
+        case 0x3C4: goto L3C4;
+        case 0x3C6: goto L3C6;
+        case 0x3C8: goto L3C8;
+        case 0x3CA: goto L3CA;
+        case 0x3CC: goto L3CC;
+        case 0x3CE: goto L3CE;
+        case 0x3D0: goto L3D0;
+        case 0x3D2: goto L3D2;
+        case 0x3D4: goto L3D4;
+        case 0x3D6: goto L3D6;
+        case 0x3D8: goto L3D8;
+        case 0x3DA: goto L3DA;
+        case 0x3DC: goto L3DC;
+        case 0x3DE: goto L3DE;
+        case 0x3E0: goto L3E0;
+        case 0x3E2: goto L3E2;
+        case 0x3E4: goto L3E4;
+        case 0x3E6: goto L3E6;
+        case 0x3E8: goto L3E8;
+        case 0x3EA: goto L3EA;
+        case 0x3EC: goto L3EC;
+        case 0x3EE: goto L3EE;
+        case 0x3F0: goto L3F0;
+        case 0x3F2: goto L3F2;
+        case 0x3F4: goto L3F4;
+        case 0x3F6: goto L3F6;
+        case 0x3F8: goto L3F8;
+        case 0x3FA: goto L3FA;
+        case 0x3FC: goto L3FC;
+        case 0x3FE: goto L3FE;
+        case 0x400: goto L400;
+        case 0x402: goto L402;
+        case 0x404: goto L404;
+        case 0x406: goto L406;
+        case 0x408: goto L408;
+        case 0x40A: goto L40A;
+        case 0x40C: goto L40C;
+        case 0x40E: goto L40E;
+        case 0x410: goto L410;
+        case 0x412: goto L412;
+        case 0x414: goto L414;
+        case 0x416: goto L416;
+        case 0x418: goto L418;
+        case 0x41A: goto L41A;
+        case 0x41C: goto L41C;
+        case 0x41E: goto L41E;
+        case 0x420: goto L420;
+        case 0x422: goto L422;
+        case 0x424: goto L424;
+        case 0x426: goto L426;
+        case 0x428: goto L428;
+        case 0x42A: goto L42A;
+        case 0x42C: goto L42C;
+        case 0x42E: goto L42E;
+        case 0x430: goto L430;
+        case 0x432: goto L432;
+        case 0x434: goto L434;
+        case 0x436: goto L436;
+        case 0x438: goto L438;
+        case 0x43A: goto L43A;
+        case 0x43C: goto L43C;
+        case 0x43E: goto L43E;
+        case 0x440: goto L440;
+        case 0x442: goto L442;
+        case 0x444: goto L444;
+        case 0x446: goto L446;
+        case 0x448: goto L448;
+        case 0x44A: goto L44A;
+        case 0x44C: goto L44C;
+        case 0x44E: goto L44E;
+        case 0x450: goto L450;
+        case 0x452: goto L452;
+        case 0x454: goto L454;
+        case 0x456: goto L456;
+        case 0x458: goto L458;
+        case 0x45A: goto L45A;
+        case 0x45C: goto L45C;
+        case 0x45E: goto L45E;
+        case 0x460: goto L460;
+        case 0x462: goto L462;
+        case 0x464: goto L464;
+        case 0x466: goto L466;
+        case 0x468: goto L468;
+        case 0x46A: goto L46A;
+        case 0x46C: goto L46C;
+        case 0x46E: goto L46E;
+        case 0x470: goto L470;
+        case 0x472: goto L472;
+        case 0x474: goto L474;
+        case 0x476: goto L476;
+        case 0x478: goto L478;
+        case 0x47A: goto L47A;
+        case 0x47C: goto L47C;
+        case 0x47E: goto L47E;
+        case 0x480: goto L480;
+        case 0x482: goto L482;
+        case 0x484: goto L484;
+        case 0x486: goto L486;
+        case 0x488: goto L488;
+        case 0x48A: goto L48A;
+        case 0x48C: goto L48C;
+        case 0x48E: goto L48E;
+        case 0x490: goto L490;
+        case 0x492: goto L492;
+        case 0x494: goto L494;
+        case 0x496: goto L496;
+        case 0x498: goto L498;
+        case 0x49A: goto L49A;
+        case 0x49C: goto L49C;
+        case 0x49E: goto L49E;
+        case 0x4A0: goto L4A0;
+        case 0x4A2: goto L4A2;
+        case 0x4A4: goto L4A4;
+        case 0x4A6: goto L4A6;
+        case 0x4A8: goto L4A8;
+        case 0x4AA: goto L4AA;
+        case 0x4AC: goto L4AC;
+        case 0x4AE: goto L4AE;
+        case 0x4B0: goto L4B0;
+        case 0x4B2: goto L4B2;
+        case 0x4B4: goto L4B4;
+        case 0x4B6: goto L4B6;
+        case 0x4B8: goto L4B8;
+        case 0x4BA: goto L4BA;
+        case 0x4BC: goto L4BC;
+        case 0x4BE: goto L4BE;
+        case 0x4C0: goto L4C0;
+        case 0x4C2: goto L4C2;
+        case 0x4C4: goto L4C4;
+        case 0x4C6: goto L4C6;
+        case 0x4C8: goto L4C8;
+        case 0x4CA: goto L4CA;
+        case 0x4CC: goto L4CC;
+        case 0x4CE: goto L4CE;
+        case 0x4D0: goto L4D0;
+        case 0x4D2: goto L4D2;
+        case 0x4D4: goto L4D4;
+        case 0x4D6: goto L4D6;
+        case 0x4D8: goto L4D8;
+        case 0x4DA: goto L4DA;
+        case 0x4DC: goto L4DC;
+        case 0x4DE: goto L4DE;
+        case 0x4E0: goto L4E0;
+        case 0x4E2: goto L4E2;
+        case 0x4E4: goto L4E4;
+        case 0x4E6: goto L4E6;
+        case 0x4E8: goto L4E8;
+        case 0x4EA: goto L4EA;
+        case 0x4EC: goto L4EC;
+        case 0x4EE: goto L4EE;
+        case 0x4F0: goto L4F0;
+        case 0x4F2: goto L4F2;
+        case 0x4F4: goto L4F4;
+        case 0x4F6: goto L4F6;
+        case 0x4F8: goto L4F8;
+        case 0x4FA: goto L4FA;
+        case 0x4FC: goto L4FC;
+        case 0x4FE: goto L4FE;
+        case 0x500: goto L500;
+        case 0x502: goto L502;
+        case 0x504: goto L504;
+        case 0x506: goto L506;
+        case 0x508: goto L508;
+        case 0x50A: goto L50A;
+        case 0x50C: goto L50C;
+        case 0x50E: goto L50E;
+        case 0x510: goto L510;
+        case 0x512: goto L512;
+        case 0x514: goto L514;
+        case 0x516: goto L516;
+        case 0x518: goto L518;
+        case 0x51A: goto L51A;
+        case 0x51C: goto L51C;
+        case 0x51E: goto L51E;
+        case 0x520: goto L520;
+        case 0x522: goto L522;
+        case 0x524: goto L524;
+        case 0x526: goto L526;
+        case 0x528: goto L528;
+        case 0x52A: goto L52A;
+        case 0x52C: goto L52C;
+        case 0x52E: goto L52E;
+        case 0x530: goto L530;
+        case 0x532: goto L532;
+        case 0x534: goto L534;
+        case 0x536: goto L536;
+        case 0x538: goto L538;
+        case 0x53A: goto L53A;
+        case 0x53C: goto L53C;
+        case 0x53E: goto L53E;
+        case 0x540: goto L540;
+        case 0x542: goto L542;
+        case 0x55C: goto L55C;
+        case 0x55E: goto L55E;
+        case 0x560: goto L560;
+        case 0x562: goto L562;
+        case 0x564: goto L564;
+        case 0x566: goto L566;
+        case 0x568: goto L568;
+        case 0x56A: goto L56A;
+        case 0x56C: goto L56C;
+        case 0x56E: goto L56E;
+        case 0x570: goto L570;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 00E0 CLS
+    STEP(0x200, 0x00E0);
+    c->pc = 0x200;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x202) goto dispatch;
+L202: // 6400 LD V4, 0x00
+    STEP(0x202, 0x6400);
+    V[4] = 0x00;
+L204: // 6500 LD V5, 0x00
+    STEP(0x204, 0x6500);
+    V[5] = 0x00;
+L206: // A20A LD I, 0x20A
+    STEP(0x206, 0xA20A);
+    c->I = 0x20A;
+L208: // 120C JP 0x20C
+    STEP(0x208, 0x120C);
+    goto L20C;
+L20C: // 661E LD V6, 0x1E
+    STEP(0x20C, 0x661E);
+    V[6] = 0x1E;
+L20E: // D452 DRW V4, V5, 2
+    STEP(0x20E, 0xD452);
+    c->pc = 0x20E;
+    predecode(0xD452, &in);
+    execute(c, &in);
+    if (c->pc != 0x210) goto dispatch;
+L210: // D462 DRW V4, V6, 2
+    STEP(0x210, 0xD462);
+    c->pc = 0x210;
+    predecode(0xD462, &in);
+    execute(c, &in);
+    if (c->pc != 0x212) goto dispatch;
+L212: // 7408 ADD V4, 0x08
+    STEP(0x212, 0x7408);
+    V[4] += 0x08;
+L214: // 4440 SNE V4, 0x40
+    STEP(0x214, 0x4440);
+    if (V[4] != 0x40) goto L218;
+L216: // 121A JP 0x21A
+    STEP(0x216, 0x121A);
+    goto L21A;
+L218: // 120E JP 0x20E
+    STEP(0x218, 0x120E);
+    goto L20E;
+L21A: // A21E LD I, 0x21E
+    STEP(0x21A, 0xA21E);
+    c->I = 0x21E;
+L21C: // 122C JP 0x22C
+    STEP(0x21C, 0x122C);
+    goto L22C;
+L22C: // 640D LD V4, 0x0D
+    STEP(0x22C, 0x640D);
+    V[4] = 0x0D;
+L22E: // 6509 LD V5, 0x09
+    STEP(0x22E, 0x6509);
+    V[5] = 0x09;
+L230: // D45E DRW V4, V5, 14
+    STEP(0x230, 0xD45E);
+    c->pc = 0x230;
+    predecode(0xD45E, &in);
+    execute(c, &in);
+    if (c->pc != 0x232) goto dispatch;
+L232: // 740A ADD V4, 0x0A
+    STEP(0x232, 0x740A);
+    V[4] += 0x0A;
+L234: // A23A LD I, 0x23A
+    STEP(0x234, 0xA23A);
+    c->I = 0x23A;
+L236: // D45E DRW V4, V5, 14
+    STEP(0x236, 0xD45E);
+    c->pc = 0x236;
+    predecode(0xD45E, &in);
+    execute(c, &in);
+    if (c->pc != 0x238) goto dispatch;
+L238: // 1248 JP 0x248
+    STEP(0x238, 0x1248);
+    goto L248;
+L248: // 740A ADD V4, 0x0A
+    STEP(0x248, 0x740A);
+    V[4] += 0x0A;
+L24A: // A250 LD I, 0x250
+    STEP(0x24A, 0xA250);
+    c->I = 0x250;
+L24C: // D45E DRW V4, V5, 14
+    STEP(0x24C, 0xD45E);
+    c->pc = 0x24C;
+    predecode(0xD45E, &in);
+    execute(c, &in);
+    if (c->pc != 0x24E) goto dispatch;
+L24E: // 125E JP 0x25E
+    STEP(0x24E, 0x125E);
+    goto L25E;
+L25E: // 740A ADD V4, 0x0A
+    STEP(0x25E, 0x740A);
+    V[4] += 0x0A;
+L260: // A266 LD I, 0x266
+    STEP(0x260, 0xA266);
+    c->I = 0x266;
+L262: // D45E DRW V4, V5, 14
+    STEP(0x262, 0xD45E);
+    c->pc = 0x262;
+    predecode(0xD45E, &in);
+    execute(c, &in);
+    if (c->pc != 0x264) goto dispatch;
+L264: // 1274 JP 0x274
+    STEP(0x264, 0x1274);
+    goto L274;
+L274: // 6A01 LD VA, 0x01
+    STEP(0x274, 0x6A01);
+    V[10] = 0x01;
+L276: // 6B04 LD VB, 0x04
+    STEP(0x276, 0x6B04);
+    V[11] = 0x04;
+L278: // 6C0E LD VC, 0x0E
+    STEP(0x278, 0x6C0E);
+    V[12] = 0x0E;
+L27A: // 6D00 LD VD, 0x00
+    STEP(0x27A, 0x6D00);
+    V[13] = 0x00;
+L27C: // A281 LD I, 0x281
+    STEP(0x27C, 0xA281);
+    c->I = 0x281;
+L27E: // 12A6 JP 0x2A6
+    STEP(0x27E, 0x12A6);
+    goto L2A6;
+L28A: // 00E0 CLS
+    STEP(0x28A, 0x00E0);
+    c->pc = 0x28A;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x28C) goto dispatch;
+L28C: // 6400 LD V4, 0x00
+    STEP(0x28C, 0x6400);
+    V[4] = 0x00;
+L28E: // 6500 LD V5, 0x00
+    STEP(0x28E, 0x6500);
+    V[5] = 0x00;
+L290: // D458 DRW V4, V5, 8
+    STEP(0x290, 0xD458);
+    c->pc = 0x290;
+    predecode(0xD458, &in);
+    execute(c, &in);
+    if (c->pc != 0x292) goto dispatch;
+L292: // 7408 ADD V4, 0x08
+    STEP(0x292, 0x7408);
+    V[4] += 0x08;
+L294: // 4440 SNE V4, 0x40
+    STEP(0x294, 0x4440);
+    if (V[4] != 0x40) goto L298;
+L296: // 229E CALL 0x29E
+    STEP(0x296, 0x229E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x296;
+    goto L29E;
+L298: // 4520 SNE V5, 0x20
+    STEP(0x298, 0x4520);
+    if (V[5] != 0x20) goto L29C;
+L29A: // 12A4 JP 0x2A4
+    STEP(0x29A, 0x12A4);
+    goto L2A4;
+L29C: // 1290 JP 0x290
+    STEP(0x29C, 0x1290);
+    goto L290;
+L29E: // 6400 LD V4, 0x00
+    STEP(0x29E, 0x6400);
+    V[4] = 0x00;
+L2A0: // 7508 ADD V5, 0x08
+    STEP(0x2A0, 0x7508);
+    V[5] += 0x08;
+L2A2: // 00EE RET
+    STEP(0x2A2, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2A4: // 12AE JP 0x2AE
+    STEP(0x2A4, 0x12AE);
+    goto L2AE;
+L2A6: // 600F LD V0, 0x0F
+    STEP(0x2A6, 0x600F);
+    V[0] = 0x0F;
+L2A8: // E09E SKP V0
+    STEP(0x2A8, 0xE09E);
+    c->pc = 0x2A8;
+    predecode(0xE09E, &in);
+    execute(c, &in);
+    if (c->pc != 0x2AA) goto dispatch;
+L2AA: // 12A8 JP 0x2A8
+    STEP(0x2AA, 0x12A8);
+    goto L2A8;
+L2AC: // 128A JP 0x28A
+    STEP(0x2AC, 0x128A);
+    goto L28A;
+L2AE: // 4A01 SNE VA, 0x01
+    STEP(0x2AE, 0x4A01);
+    if (V[10] != 0x01) goto L2B2;
+L2B0: // 22D0 CALL 0x2D0
+    STEP(0x2B0, 0x22D0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2B0;
+    goto L2D0;
+L2B2: // 4A02 SNE VA, 0x02
+    STEP(0x2B2, 0x4A02);
+    if (V[10] != 0x02) goto L2B6;
+L2B4: // 238A CALL 0x38A
+    STEP(0x2B4, 0x238A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2B4;
+    goto L38A;
+L2B6: // 4A03 SNE VA, 0x03
+    STEP(0x2B6, 0x4A03);
+    if (V[10] != 0x03) goto L2BA;
+L2B8: // 23B8 CALL 0x3B8
+    STEP(0x2B8, 0x23B8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2B8;
+    goto L3B8;
+L2BA: // 4A04 SNE VA, 0x04
+    STEP(0x2BA, 0x4A04);
+    if (V[10] != 0x04) goto L2BE;
+L2BC: // 23E0 CALL 0x3E0
+    STEP(0x2BC, 0x23E0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2BC;
+    goto L3E0;
+L2BE: // 4A05 SNE VA, 0x05
+    STEP(0x2BE, 0x4A05);
+    if (V[10] != 0x05) goto L2C2;
+L2C0: // 2418 CALL 0x418
+    STEP(0x2C0, 0x2418);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2C0;
+    goto L418;
+L2C2: // 4A06 SNE VA, 0x06
+    STEP(0x2C2, 0x4A06);
+    if (V[10] != 0x06) goto L2C6;
+L2C4: // 2478 CALL 0x478
+    STEP(0x2C4, 0x2478);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2C4;
+    goto L478;
+L2C6: // 4A07 SNE VA, 0x07
+    STEP(0x2C6, 0x4A07);
+    if (V[10] != 0x07) goto L2CA;
+L2C8: // 24E6 CALL 0x4E6
+    STEP(0x2C8, 0x24E6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2C8;
+    goto L4E6;
+L2CA: // 4A08 SNE VA, 0x08
+    STEP(0x2CA, 0x4A08);
+    if (V[10] != 0x08) goto L2CE;
+L2CC: // 2510 CALL 0x510
+    STEP(0x2CC, 0x2510);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2CC;
+    goto L510;
+L2CE: // 1318 JP 0x318
+    STEP(0x2CE, 0x1318);
+    goto L318;
+L2D0: // A281 LD I, 0x281
+    STEP(0x2D0, 0xA281);
+    c->I = 0x281;
+L2D2: // 6402 LD V4, 0x02
+    STEP(0x2D2, 0x6402);
+    V[4] = 0x02;
+L2D4: // 6502 LD V5, 0x02
+    STEP(0x2D4, 0x6502);
+    V[5] = 0x02;
+L2D6: // D458 DRW V4, V5, 8
+    STEP(0x2D6, 0xD458);
+    c->pc = 0x2D6;
+    predecode(0xD458, &in);
+    execute(c, &in);
+    if (c->pc != 0x2D8) goto dispatch;
+L2D8: // 650A LD V5, 0x0A
+    STEP(0x2D8, 0x650A);
+    V[5] = 0x0A;
+L2DA: // D458 DRW V4, V5, 8
+    STEP(0x2DA, 0xD458);
+    c->pc = 0x2DA;
+    predecode(0xD458, &in);
+    execute(c, &in);
+    if (c->pc != 0x2DC) goto dispatch;
+L2DC: // 6512 LD V5, 0x12
+    STEP(0x2DC, 0x6512);
+    V[5] = 0x12;
+L2DE: // D458 DRW V4, V5, 8
+    STEP(0x2DE, 0xD458);
+    c->pc = 0x2DE;
+    predecode(0xD458, &in);
+    execute(c, &in);
+    if (c->pc != 0x2E0) goto dispatch;
+L2E0: // 640A LD V4, 0x0A
+    STEP(0x2E0, 0x640A);
+    V[4] = 0x0A;
+L2E2: // 6505 LD V5, 0x05
+    STEP(0x2E2, 0x6505);
+    V[5] = 0x05;
+L2E4: // D453 DRW V4, V5, 3
+    STEP(0x2E4, 0xD453);
+    c->pc = 0x2E4;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x2E6) goto dispatch;
+L2E6: // 6412 LD V4, 0x12
+    STEP(0x2E6, 0x6412);
+    V[4] = 0x12;
+L2E8: // D453 DRW V4, V5, 3
+    STEP(0x2E8, 0xD453);
+    c->pc = 0x2E8;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x2EA) goto dispatch;
+L2EA: // 641A LD V4, 0x1A
+    STEP(0x2EA, 0x641A);
+    V[4] = 0x1A;
+L2EC: // D453 DRW V4, V5, 3
+    STEP(0x2EC, 0xD453);
+    c->pc = 0x2EC;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x2EE) goto dispatch;
+L2EE: // 6422 LD V4, 0x22
+    STEP(0x2EE, 0x6422);
+    V[4] = 0x22;
+L2F0: // D453 DRW V4, V5, 3
+    STEP(0x2F0, 0xD453);
+    c->pc = 0x2F0;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x2F2) goto dispatch;
+L2F2: // 642A LD V4, 0x2A
+    STEP(0x2F2, 0x642A);
+    V[4] = 0x2A;
+L2F4: // D453 DRW V4, V5, 3
+    STEP(0x2F4, 0xD453);
+    c->pc = 0x2F4;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x2F6) goto dispatch;
+L2F6: // 6432 LD V4, 0x32
+    STEP(0x2F6, 0x6432);
+    V[4] = 0x32;
+L2F8: // D453 DRW V4, V5, 3
+    STEP(0x2F8, 0xD453);
+    c->pc = 0x2F8;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x2FA) goto dispatch;
+L2FA: // A2FE LD I, 0x2FE
+    STEP(0x2FA, 0xA2FE);
+    c->I = 0x2FE;
+L2FC: // 130A JP 0x30A
+    STEP(0x2FC, 0x130A);
+    goto L30A;
+L30A: // 7503 ADD V5, 0x03
+    STEP(0x30A, 0x7503);
+    V[5] += 0x03;
+L30C: // 7402 ADD V4, 0x02
+    STEP(0x30C, 0x7402);
+    V[4] += 0x02;
+L30E: // D45C DRW V4, V5, 12
+    STEP(0x30E, 0xD45C);
+    c->pc = 0x30E;
+    predecode(0xD45C, &in);
+    execute(c, &in);
+    if (c->pc != 0x310) goto dispatch;
+L310: // 7406 ADD V4, 0x06
+    STEP(0x310, 0x7406);
+    V[4] += 0x06;
+L312: // 7509 ADD V5, 0x09
+    STEP(0x312, 0x7509);
+    V[5] += 0x09;
+L314: // D453 DRW V4, V5, 3
+    STEP(0x314, 0xD453);
+    c->pc = 0x314;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x316) goto dispatch;
+L316: // 00EE RET
+    STEP(0x316, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L318: // A280 LD I, 0x280
+    STEP(0x318, 0xA280);
+    c->I = 0x280;
+L31A: // DBC1 DRW VB, VC, 1
+    STEP(0x31A, 0xDBC1);
+    c->pc = 0x31A;
+    predecode(0xDBC1, &in);
+    execute(c, &in);
+    if (c->pc != 0x31C) goto dispatch;
+L31C: // 4F01 SNE VF, 0x01
+    STEP(0x31C, 0x4F01);
+    if (V[15] != 0x01) goto L320;
+L31E: // 1372 JP 0x372
+    STEP(0x31E, 0x1372);
+    goto L372;
+L320: // 6002 LD V0, 0x02
+    STEP(0x320, 0x6002);
+    V[0] = 0x02;
+L322: // E0A1 SKNP V0
+    STEP(0x322, 0xE0A1);
+    c->pc = 0x322;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x324) goto dispatch;
+L324: // 6D02 LD VD, 0x02
+    STEP(0x324, 0x6D02);
+    V[13] = 0x02;
+L326: // 6004 LD V0, 0x04
+    STEP(0x326, 0x6004);
+    V[0] = 0x04;
+L328: // E0A1 SKNP V0
+    STEP(0x328, 0xE0A1);
+    c->pc = 0x328;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x32A) goto dispatch;
+L32A: // 6D04 LD VD, 0x04
+    STEP(0x32A, 0x6D04);
+    V[13] = 0x04;
+L32C: // 6006 LD V0, 0x06
+    STEP(0x32C, 0x6006);
+    V[0] = 0x06;
+L32E: // E0A1 SKNP V0
+    STEP(0x32E, 0xE0A1);
+    c->pc = 0x32E;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x330) goto dispatch;
+L330: // 6D06 LD VD, 0x06
+    STEP(0x330, 0x6D06);
+    V[13] = 0x06;
+L332: // 6008 LD V0, 0x08
+    STEP(0x332, 0x6008);
+    V[0] = 0x08;
+L334: // E0A1 SKNP V0
+    STEP(0x334, 0xE0A1);
+    c->pc = 0x334;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x336) goto dispatch;
+L336: // 6D08 LD VD, 0x08
+    STEP(0x336, 0x6D08);
+    V[13] = 0x08;
+L338: // DBC1 DRW VB, VC, 1
+    STEP(0x338, 0xDBC1);
+    c->pc = 0x338;
+    predecode(0xDBC1, &in);
+    execute(c, &in);
+    if (c->pc != 0x33A) goto dispatch;
+L33A: // 4D02 SNE VD, 0x02
+    STEP(0x33A, 0x4D02);
+    if (V[13] != 0x02) goto L33E;
+L33C: // 7CFF ADD VC, 0xFF
+    STEP(0x33C, 0x7CFF);
+    V[12] += 0xFF;
+L33E: // 4D04 SNE VD, 0x04
+    STEP(0x33E, 0x4D04);
+    if (V[13] != 0x04) goto L342;
+L340: // 7BFF ADD VB, 0xFF
+    STEP(0x340, 0x7BFF);
+    V[11] += 0xFF;
+L342: // 4D06 SNE VD, 0x06
+    STEP(0x342, 0x4D06);
+    if (V[13] != 0x06) goto L346;
+L344: // 7B01 ADD VB, 0x01
+    STEP(0x344, 0x7B01);
+    V[11] += 0x01;
+L346: // 4D08 SNE VD, 0x08
+    STEP(0x346, 0x4D08);
+    if (V[13] != 0x08) goto L34A;
+L348: // 7C01 ADD VC, 0x01
+    STEP(0x348, 0x7C01);
+    V[12] += 0x01;
+L34A: // 4B40 SNE VB, 0x40
+    STEP(0x34A, 0x4B40);
+    if (V[11] != 0x40) goto L34E;
+L34C: // 135E JP 0x35E
+    STEP(0x34C, 0x135E);
+    goto L35E;
+L34E: // 4BFF SNE VB, 0xFF
+    STEP(0x34E, 0x4BFF);
+    if (V[11] != 0xFF) goto L352;
+L350: // 1364 JP 0x364
+    STEP(0x350, 0x1364);
+    goto L364;
+L352: // 6002 LD V0, 0x02
+    STEP(0x352, 0x6002);
+    V[0] = 0x02;
+L354: // F015 LD DT, V0
+    STEP(0x354, 0xF015);
+    c->dt = V[0];
+L356: // F007 LD V0, DT
+    STEP(0x356, 0xF007);
+    V[0] = c->dt;
+L358: // 3000 SE V0, 0x00
+    STEP(0x358, 0x3000);
+    if (V[0] == 0x00) goto L35C;
+L35A: // 1356 JP 0x356
+    STEP(0x35A, 0x1356);
+    goto L356;
+L35C: // 1318 JP 0x318
+    STEP(0x35C, 0x1318);
+    goto L318;
+L35E: // 7A01 ADD VA, 0x01
+    STEP(0x35E, 0x7A01);
+    V[10] += 0x01;
+L360: // 4A09 SNE VA, 0x09
+    STEP(0x360, 0x4A09);
+    if (V[10] != 0x09) goto L364;
+L362: // 153A JP 0x53A
+    STEP(0x362, 0x153A);
+    goto L53A;
+L364: // 6B01 LD VB, 0x01
+    STEP(0x364, 0x6B01);
+    V[11] = 0x01;
+L366: // A281 LD I, 0x281
+    STEP(0x366, 0xA281);
+    c->I = 0x281;
+L368: // 128A JP 0x28A
+    STEP(0x368, 0x128A);
+    goto L28A;
+L372: // 6003 LD V0, 0x03
+    STEP(0x372, 0x6003);
+    V[0] = 0x03;
+L374: // F018 LD ST, V0
+    STEP(0x374, 0xF018);
+    c->st = V[0];
+L376: // 600F LD V0, 0x0F
+    STEP(0x376, 0x600F);
+    V[0] = 0x0F;
+L378: // E09E SKP V0
+    STEP(0x378, 0xE09E);
+    c->pc = 0x378;
+    predecode(0xE09E, &in);
+    execute(c, &in);
+    if (c->pc != 0x37A) goto dispatch;
+L37A: // 1378 JP 0x378
+    STEP(0x37A, 0x1378);
+    goto L378;
+L37C: // 6A01 LD VA, 0x01
+    STEP(0x37C, 0x6A01);
+    V[10] = 0x01;
+L37E: // 6B04 LD VB, 0x04
+    STEP(0x37E, 0x6B04);
+    V[11] = 0x04;
+L380: // 6C0E LD VC, 0x0E
+    STEP(0x380, 0x6C0E);
+    V[12] = 0x0E;
+L382: // 6D00 LD VD, 0x00
+    STEP(0x382, 0x6D00);
+    V[13] = 0x00;
+L384: // A281 LD I, 0x281
+    STEP(0x384, 0xA281);
+    c->I = 0x281;
+L386: // 00E0 CLS
+    STEP(0x386, 0x00E0);
+    c->pc = 0x386;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x388) goto dispatch;
+L388: // 128A JP 0x28A
+    STEP(0x388, 0x128A);
+    goto L28A;
+L38A: // 6400 LD V4, 0x00
+    STEP(0x38A, 0x6400);
+    V[4] = 0x00;
+L38C: // 6511 LD V5, 0x11
+    STEP(0x38C, 0x6511);
+    V[5] = 0x11;
+L38E: // A281 LD I, 0x281
+    STEP(0x38E, 0xA281);
+    c->I = 0x281;
+L390: // D453 DRW V4, V5, 3
+    STEP(0x390, 0xD453);
+    c->pc = 0x390;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x392) goto dispatch;
+L392: // 7408 ADD V4, 0x08
+    STEP(0x392, 0x7408);
+    V[4] += 0x08;
+L394: // D453 DRW V4, V5, 3
+    STEP(0x394, 0xD453);
+    c->pc = 0x394;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x396) goto dispatch;
+L396: // 7408 ADD V4, 0x08
+    STEP(0x396, 0x7408);
+    V[4] += 0x08;
+L398: // 75FF ADD V5, 0xFF
+    STEP(0x398, 0x75FF);
+    V[5] += 0xFF;
+L39A: // D453 DRW V4, V5, 3
+    STEP(0x39A, 0xD453);
+    c->pc = 0x39A;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x39C) goto dispatch;
+L39C: // 7408 ADD V4, 0x08
+    STEP(0x39C, 0x7408);
+    V[4] += 0x08;
+L39E: // 75FF ADD V5, 0xFF
+    STEP(0x39E, 0x75FF);
+    V[5] += 0xFF;
+L3A0: // D453 DRW V4, V5, 3
+    STEP(0x3A0, 0xD453);
+    c->pc = 0x3A0;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x3A2) goto dispatch;
+L3A2: // 7408 ADD V4, 0x08
+    STEP(0x3A2, 0x7408);
+    V[4] += 0x08;
+L3A4: // D453 DRW V4, V5, 3
+    STEP(0x3A4, 0xD453);
+    c->pc = 0x3A4;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x3A6) goto dispatch;
+L3A6: // 7408 ADD V4, 0x08
+    STEP(0x3A6, 0x7408);
+    V[4] += 0x08;
+L3A8: // D453 DRW V4, V5, 3
+    STEP(0x3A8, 0xD453);
+    c->pc = 0x3A8;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x3AA) goto dispatch;
+L3AA: // 7408 ADD V4, 0x08
+    STEP(0x3AA, 0x7408);
+    V[4] += 0x08;
+L3AC: // 7501 ADD V5, 0x01
+    STEP(0x3AC, 0x7501);
+    V[5] += 0x01;
+L3AE: // D453 DRW V4, V5, 3
+    STEP(0x3AE, 0xD453);
+    c->pc = 0x3AE;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x3B0) goto dispatch;
+L3B0: // 7408 ADD V4, 0x08
+    STEP(0x3B0, 0x7408);
+    V[4] += 0x08;
+L3B2: // 7501 ADD V5, 0x01
+    STEP(0x3B2, 0x7501);
+    V[5] += 0x01;
+L3B4: // D453 DRW V4, V5, 3
+    STEP(0x3B4, 0xD453);
+    c->pc = 0x3B4;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x3B6) goto dispatch;
+L3B6: // 00EE RET
+    STEP(0x3B6, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3B8: // 6400 LD V4, 0x00
+    STEP(0x3B8, 0x6400);
+    V[4] = 0x00;
+L3BA: // 6511 LD V5, 0x11
+    STEP(0x3BA, 0x6511);
+    V[5] = 0x11;
+L3BC: // A281 LD I, 0x281
+    STEP(0x3BC, 0xA281);
+    c->I = 0x281;
+L3BE: // D453 DRW V4, V5, 3
+    STEP(0x3BE, 0xD453);
+    c->pc = 0x3BE;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x3C0) goto dispatch;
+L3C0: // 7408 ADD V4, 0x08
+    STEP(0x3C0, 0x7408);
+    V[4] += 0x08;
+L3C2: // D453 DRW V4, V5, 3
+    STEP(0x3C2, 0xD453);
+    c->pc = 0x3C2;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x3C4) goto dispatch;
+L3C4: // 7408 ADD V4, 0x08
+    STEP(0x3C4, 0x7408);
+    V[4] += 0x08;
+L3C6: // 7502 ADD V5, 0x02
+    STEP(0x3C6, 0x7502);
+    V[5] += 0x02;
+L3C8: // D452 DRW V4, V5, 2
+    STEP(0x3C8, 0xD452);
+    c->pc = 0x3C8;
+    predecode(0xD452, &in);
+    execute(c, &in);
+    if (c->pc != 0x3CA) goto dispatch;
+L3CA: // 7408 ADD V4, 0x08
+    STEP(0x3CA, 0x7408);
+    V[4] += 0x08;
+L3CC: // D451 DRW V4, V5, 1
+    STEP(0x3CC, 0xD451);
+    c->pc = 0x3CC;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x3CE) goto dispatch;
+L3CE: // 7408 ADD V4, 0x08
+    STEP(0x3CE, 0x7408);
+    V[4] += 0x08;
+L3D0: // D451 DRW V4, V5, 1
+    STEP(0x3D0, 0xD451);
+    c->pc = 0x3D0;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x3D2) goto dispatch;
+L3D2: // 7408 ADD V4, 0x08
+    STEP(0x3D2, 0x7408);
+    V[4] += 0x08;
+L3D4: // D451 DRW V4, V5, 1
+    STEP(0x3D4, 0xD451);
+    c->pc = 0x3D4;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x3D6) goto dispatch;
+L3D6: // 7408 ADD V4, 0x08
+    STEP(0x3D6, 0x7408);
+    V[4] += 0x08;
+L3D8: // D451 DRW V4, V5, 1
+    STEP(0x3D8, 0xD451);
+    c->pc = 0x3D8;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x3DA) goto dispatch;
+L3DA: // 7408 ADD V4, 0x08
+    STEP(0x3DA, 0x7408);
+    V[4] += 0x08;
+L3DC: // D451 DRW V4, V5, 1
+    STEP(0x3DC, 0xD451);
+    c->pc = 0x3DC;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x3DE) goto dispatch;
+L3DE: // 00EE RET
+    STEP(0x3DE, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3E0: // 6400 LD V4, 0x00
+    STEP(0x3E0, 0x6400);
+    V[4] = 0x00;
+L3E2: // 6513 LD V5, 0x13
+    STEP(0x3E2, 0x6513);
+    V[5] = 0x13;
+L3E4: // A281 LD I, 0x281
+    STEP(0x3E4, 0xA281);
+    c->I = 0x281;
+L3E6: // D451 DRW V4, V5, 1
+    STEP(0x3E6, 0xD451);
+    c->pc = 0x3E6;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x3E8) goto dispatch;
+L3E8: // A280 LD I, 0x280
+    STEP(0x3E8, 0xA280);
+    c->I = 0x280;
+L3EA: // 7408 ADD V4, 0x08
+    STEP(0x3EA, 0x7408);
+    V[4] += 0x08;
+L3EC: // D451 DRW V4, V5, 1
+    STEP(0x3EC, 0xD451);
+    c->pc = 0x3EC;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x3EE) goto dispatch;
+L3EE: // 7501 ADD V5, 0x01
+    STEP(0x3EE, 0x7501);
+    V[5] += 0x01;
+L3F0: // D451 DRW V4, V5, 1
+    STEP(0x3F0, 0xD451);
+    c->pc = 0x3F0;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x3F2) goto dispatch;
+L3F2: // 7501 ADD V5, 0x01
+    STEP(0x3F2, 0x7501);
+    V[5] += 0x01;
+L3F4: // A281 LD I, 0x281
+    STEP(0x3F4, 0xA281);
+    c->I = 0x281;
+L3F6: // D451 DRW V4, V5, 1
+    STEP(0x3F6, 0xD451);
+    c->pc = 0x3F6;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x3F8) goto dispatch;
+L3F8: // 7408 ADD V4, 0x08
+    STEP(0x3F8, 0x7408);
+    V[4] += 0x08;
+L3FA: // D451 DRW V4, V5, 1
+    STEP(0x3FA, 0xD451);
+    c->pc = 0x3FA;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x3FC) goto dispatch;
+L3FC: // 7408 ADD V4, 0x08
+    STEP(0x3FC, 0x7408);
+    V[4] += 0x08;
+L3FE: // D452 DRW V4, V5, 2
+    STEP(0x3FE, 0xD452);
+    c->pc = 0x3FE;
+    predecode(0xD452, &in);
+    execute(c, &in);
+    if (c->pc != 0x400) goto dispatch;
+L400: // 7408 ADD V4, 0x08
+    STEP(0x400, 0x7408);
+    V[4] += 0x08;
+L402: // 75FF ADD V5, 0xFF
+    STEP(0x402, 0x75FF);
+    V[5] += 0xFF;
+L404: // D453 DRW V4, V5, 3
+    STEP(0x404, 0xD453);
+    c->pc = 0x404;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x406) goto dispatch;
+L406: // 7408 ADD V4, 0x08
+    STEP(0x406, 0x7408);
+    V[4] += 0x08;
+L408: // D454 DRW V4, V5, 4
+    STEP(0x408, 0xD454);
+    c->pc = 0x408;
+    predecode(0xD454, &in);
+    execute(c, &in);
+    if (c->pc != 0x40A) goto dispatch;
+L40A: // 7408 ADD V4, 0x08
+    STEP(0x40A, 0x7408);
+    V[4] += 0x08;
+L40C: // 75FF ADD V5, 0xFF
+    STEP(0x40C, 0x75FF);
+    V[5] += 0xFF;
+L40E: // D456 DRW V4, V5, 6
+    STEP(0x40E, 0xD456);
+    c->pc = 0x40E;
+    predecode(0xD456, &in);
+    execute(c, &in);
+    if (c->pc != 0x410) goto dispatch;
+L410: // 7408 ADD V4, 0x08
+    STEP(0x410, 0x7408);
+    V[4] += 0x08;
+L412: // 75FF ADD V5, 0xFF
+    STEP(0x412, 0x75FF);
+    V[5] += 0xFF;
+L414: // D458 DRW V4, V5, 8
+    STEP(0x414, 0xD458);
+    c->pc = 0x414;
+    predecode(0xD458, &in);
+    execute(c, &in);
+    if (c->pc != 0x416) goto dispatch;
+L416: // 00EE RET
+    STEP(0x416, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L418: // 6400 LD V4, 0x00
+    STEP(0x418, 0x6400);
+    V[4] = 0x00;
+L41A: // 6512 LD V5, 0x12
+    STEP(0x41A, 0x6512);
+    V[5] = 0x12;
+L41C: // A281 LD I, 0x281
+    STEP(0x41C, 0xA281);
+    c->I = 0x281;
+L41E: // D458 DRW V4, V5, 8
+    STEP(0x41E, 0xD458);
+    c->pc = 0x41E;
+    predecode(0xD458, &in);
+    execute(c, &in);
+    if (c->pc != 0x420) goto dispatch;
+L420: // 7408 ADD V4, 0x08
+    STEP(0x420, 0x7408);
+    V[4] += 0x08;
+L422: // D458 DRW V4, V5, 8
+    STEP(0x422, 0xD458);
+    c->pc = 0x422;
+    predecode(0xD458, &in);
+    execute(c, &in);
+    if (c->pc != 0x424) goto dispatch;
+L424: // 7408 ADD V4, 0x08
+    STEP(0x424, 0x7408);
+    V[4] += 0x08;
+L426: // D458 DRW V4, V5, 8
+    STEP(0x426, 0xD458);
+    c->pc = 0x426;
+    predecode(0xD458, &in);
+    execute(c, &in);
+    if (c->pc != 0x428) goto dispatch;
+L428: // 7408 ADD V4, 0x08
+    STEP(0x428, 0x7408);
+    V[4] += 0x08;
+L42A: // D458 DRW V4, V5, 8
+    STEP(0x42A, 0xD458);
+    c->pc = 0x42A;
+    predecode(0xD458, &in);
+    execute(c, &in);
+    if (c->pc != 0x42C) goto dispatch;
+L42C: // 7408 ADD V4, 0x08
+    STEP(0x42C, 0x7408);
+    V[4] += 0x08;
+L42E: // D458 DRW V4, V5, 8
+    STEP(0x42E, 0xD458);
+    c->pc = 0x42E;
+    predecode(0xD458, &in);
+    execute(c, &in);
+    if (c->pc != 0x430) goto dispatch;
+L430: // 7408 ADD V4, 0x08
+    STEP(0x430, 0x7408);
+    V[4] += 0x08;
+L432: // D458 DRW V4, V5, 8
+    STEP(0x432, 0xD458);
+    c->pc = 0x432;
+    predecode(0xD458, &in);
+    execute(c, &in);
+    if (c->pc != 0x434) goto dispatch;
+L434: // 7408 ADD V4, 0x08
+    STEP(0x434, 0x7408);
+    V[4] += 0x08;
+L436: // D458 DRW V4, V5, 8
+    STEP(0x436, 0xD458);
+    c->pc = 0x436;
+    predecode(0xD458, &in);
+    execute(c, &in);
+    if (c->pc != 0x438) goto dispatch;
+L438: // A280 LD I, 0x280
+    STEP(0x438, 0xA280);
+    c->I = 0x280;
+L43A: // 75FF ADD V5, 0xFF
+    STEP(0x43A, 0x75FF);
+    V[5] += 0xFF;
+L43C: // 7420 ADD V4, 0x20
+    STEP(0x43C, 0x7420);
+    V[4] += 0x20;
+L43E: // D451 DRW V4, V5, 1
+    STEP(0x43E, 0xD451);
+    c->pc = 0x43E;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x440) goto dispatch;
+L440: // 75FF ADD V5, 0xFF
+    STEP(0x440, 0x75FF);
+    V[5] += 0xFF;
+L442: // D451 DRW V4, V5, 1
+    STEP(0x442, 0xD451);
+    c->pc = 0x442;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x444) goto dispatch;
+L444: // 75FF ADD V5, 0xFF
+    STEP(0x444, 0x75FF);
+    V[5] += 0xFF;
+L446: // D451 DRW V4, V5, 1
+    STEP(0x446, 0xD451);
+    c->pc = 0x446;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x448) goto dispatch;
+L448: // 75FF ADD V5, 0xFF
+    STEP(0x448, 0x75FF);
+    V[5] += 0xFF;
+L44A: // D451 DRW V4, V5, 1
+    STEP(0x44A, 0xD451);
+    c->pc = 0x44A;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x44C) goto dispatch;
+L44C: // 75FF ADD V5, 0xFF
+    STEP(0x44C, 0x75FF);
+    V[5] += 0xFF;
+L44E: // D451 DRW V4, V5, 1
+    STEP(0x44E, 0xD451);
+    c->pc = 0x44E;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x450) goto dispatch;
+L450: // 75FF ADD V5, 0xFF
+    STEP(0x450, 0x75FF);
+    V[5] += 0xFF;
+L452: // D451 DRW V4, V5, 1
+    STEP(0x452, 0xD451);
+    c->pc = 0x452;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x454) goto dispatch;
+L454: // 75FF ADD V5, 0xFF
+    STEP(0x454, 0x75FF);
+    V[5] += 0xFF;
+L456: // D451 DRW V4, V5, 1
+    STEP(0x456, 0xD451);
+    c->pc = 0x456;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x458) goto dispatch;
+L458: // 75FF ADD V5, 0xFF
+    STEP(0x458, 0x75FF);
+    V[5] += 0xFF;
+L45A: // D451 DRW V4, V5, 1
+    STEP(0x45A, 0xD451);
+    c->pc = 0x45A;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x45C) goto dispatch;
+L45C: // 75FF ADD V5, 0xFF
+    STEP(0x45C, 0x75FF);
+    V[5] += 0xFF;
+L45E: // A281 LD I, 0x281
+    STEP(0x45E, 0xA281);
+    c->I = 0x281;
+L460: // D451 DRW V4, V5, 1
+    STEP(0x460, 0xD451);
+    c->pc = 0x460;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x462) goto dispatch;
+L462: // 7408 ADD V4, 0x08
+    STEP(0x462, 0x7408);
+    V[4] += 0x08;
+L464: // D451 DRW V4, V5, 1
+    STEP(0x464, 0xD451);
+    c->pc = 0x464;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x466) goto dispatch;
+L466: // 7408 ADD V4, 0x08
+    STEP(0x466, 0x7408);
+    V[4] += 0x08;
+L468: // D451 DRW V4, V5, 1
+    STEP(0x468, 0xD451);
+    c->pc = 0x468;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x46A) goto dispatch;
+L46A: // 7408 ADD V4, 0x08
+    STEP(0x46A, 0x7408);
+    V[4] += 0x08;
+L46C: // D451 DRW V4, V5, 1
+    STEP(0x46C, 0xD451);
+    c->pc = 0x46C;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x46E) goto dispatch;
+L46E: // 7408 ADD V4, 0x08
+    STEP(0x46E, 0x7408);
+    V[4] += 0x08;
+L470: // D451 DRW V4, V5, 1
+    STEP(0x470, 0xD451);
+    c->pc = 0x470;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x472) goto dispatch;
+L472: // 7408 ADD V4, 0x08
+    STEP(0x472, 0x7408);
+    V[4] += 0x08;
+L474: // D451 DRW V4, V5, 1
+    STEP(0x474, 0xD451);
+    c->pc = 0x474;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x476) goto dispatch;
+L476: // 00EE RET
+    STEP(0x476, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L478: // 6400 LD V4, 0x00
+    STEP(0x478, 0x6400);
+    V[4] = 0x00;
+L47A: // 6509 LD V5, 0x09
+    STEP(0x47A, 0x6509);
+    V[5] = 0x09;
+L47C: // A281 LD I, 0x281
+    STEP(0x47C, 0xA281);
+    c->I = 0x281;
+L47E: // D451 DRW V4, V5, 1
+    STEP(0x47E, 0xD451);
+    c->pc = 0x47E;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x480) goto dispatch;
+L480: // 7408 ADD V4, 0x08
+    STEP(0x480, 0x7408);
+    V[4] += 0x08;
+L482: // D451 DRW V4, V5, 1
+    STEP(0x482, 0xD451);
+    c->pc = 0x482;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x484) goto dispatch;
+L484: // 7408 ADD V4, 0x08
+    STEP(0x484, 0x7408);
+    V[4] += 0x08;
+L486: // D451 DRW V4, V5, 1
+    STEP(0x486, 0xD451);
+    c->pc = 0x486;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x488) goto dispatch;
+L488: // 7408 ADD V4, 0x08
+    STEP(0x488, 0x7408);
+    V[4] += 0x08;
+L48A: // D451 DRW V4, V5, 1
+    STEP(0x48A, 0xD451);
+    c->pc = 0x48A;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x48C) goto dispatch;
+L48C: // 7408 ADD V4, 0x08
+    STEP(0x48C, 0x7408);
+    V[4] += 0x08;
+L48E: // D451 DRW V4, V5, 1
+    STEP(0x48E, 0xD451);
+    c->pc = 0x48E;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x490) goto dispatch;
+L490: // 7408 ADD V4, 0x08
+    STEP(0x490, 0x7408);
+    V[4] += 0x08;
+L492: // D451 DRW V4, V5, 1
+    STEP(0x492, 0xD451);
+    c->pc = 0x492;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x494) goto dispatch;
+L494: // A280 LD I, 0x280
+    STEP(0x494, 0xA280);
+    c->I = 0x280;
+L496: // 7501 ADD V5, 0x01
+    STEP(0x496, 0x7501);
+    V[5] += 0x01;
+L498: // D451 DRW V4, V5, 1
+    STEP(0x498, 0xD451);
+    c->pc = 0x498;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x49A) goto dispatch;
+L49A: // 7501 ADD V5, 0x01
+    STEP(0x49A, 0x7501);
+    V[5] += 0x01;
+L49C: // D451 DRW V4, V5, 1
+    STEP(0x49C, 0xD451);
+    c->pc = 0x49C;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x49E) goto dispatch;
+L49E: // 7501 ADD V5, 0x01
+    STEP(0x49E, 0x7501);
+    V[5] += 0x01;
+L4A0: // D451 DRW V4, V5, 1
+    STEP(0x4A0, 0xD451);
+    c->pc = 0x4A0;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4A2) goto dispatch;
+L4A2: // 7501 ADD V5, 0x01
+    STEP(0x4A2, 0x7501);
+    V[5] += 0x01;
+L4A4: // D451 DRW V4, V5, 1
+    STEP(0x4A4, 0xD451);
+    c->pc = 0x4A4;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4A6) goto dispatch;
+L4A6: // 7501 ADD V5, 0x01
+    STEP(0x4A6, 0x7501);
+    V[5] += 0x01;
+L4A8: // D451 DRW V4, V5, 1
+    STEP(0x4A8, 0xD451);
+    c->pc = 0x4A8;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4AA) goto dispatch;
+L4AA: // 7501 ADD V5, 0x01
+    STEP(0x4AA, 0x7501);
+    V[5] += 0x01;
+L4AC: // D451 DRW V4, V5, 1
+    STEP(0x4AC, 0xD451);
+    c->pc = 0x4AC;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4AE) goto dispatch;
+L4AE: // 7501 ADD V5, 0x01
+    STEP(0x4AE, 0x7501);
+    V[5] += 0x01;
+L4B0: // D451 DRW V4, V5, 1
+    STEP(0x4B0, 0xD451);
+    c->pc = 0x4B0;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4B2) goto dispatch;
+L4B2: // 7501 ADD V5, 0x01
+    STEP(0x4B2, 0x7501);
+    V[5] += 0x01;
+L4B4: // D451 DRW V4, V5, 1
+    STEP(0x4B4, 0xD451);
+    c->pc = 0x4B4;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4B6) goto dispatch;
+L4B6: // 7501 ADD V5, 0x01
+    STEP(0x4B6, 0x7501);
+    V[5] += 0x01;
+L4B8: // D451 DRW V4, V5, 1
+    STEP(0x4B8, 0xD451);
+    c->pc = 0x4B8;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4BA) goto dispatch;
+L4BA: // 7501 ADD V5, 0x01
+    STEP(0x4BA, 0x7501);
+    V[5] += 0x01;
+L4BC: // D451 DRW V4, V5, 1
+    STEP(0x4BC, 0xD451);
+    c->pc = 0x4BC;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4BE) goto dispatch;
+L4BE: // 7501 ADD V5, 0x01
+    STEP(0x4BE, 0x7501);
+    V[5] += 0x01;
+L4C0: // D451 DRW V4, V5, 1
+    STEP(0x4C0, 0xD451);
+    c->pc = 0x4C0;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4C2) goto dispatch;
+L4C2: // 7501 ADD V5, 0x01
+    STEP(0x4C2, 0x7501);
+    V[5] += 0x01;
+L4C4: // D451 DRW V4, V5, 1
+    STEP(0x4C4, 0xD451);
+    c->pc = 0x4C4;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4C6) goto dispatch;
+L4C6: // 7501 ADD V5, 0x01
+    STEP(0x4C6, 0x7501);
+    V[5] += 0x01;
+L4C8: // D451 DRW V4, V5, 1
+    STEP(0x4C8, 0xD451);
+    c->pc = 0x4C8;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4CA) goto dispatch;
+L4CA: // 7501 ADD V5, 0x01
+    STEP(0x4CA, 0x7501);
+    V[5] += 0x01;
+L4CC: // D451 DRW V4, V5, 1
+    STEP(0x4CC, 0xD451);
+    c->pc = 0x4CC;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4CE) goto dispatch;
+L4CE: // 7501 ADD V5, 0x01
+    STEP(0x4CE, 0x7501);
+    V[5] += 0x01;
+L4D0: // D451 DRW V4, V5, 1
+    STEP(0x4D0, 0xD451);
+    c->pc = 0x4D0;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4D2) goto dispatch;
+L4D2: // 7501 ADD V5, 0x01
+    STEP(0x4D2, 0x7501);
+    V[5] += 0x01;
+L4D4: // D451 DRW V4, V5, 1
+    STEP(0x4D4, 0xD451);
+    c->pc = 0x4D4;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4D6) goto dispatch;
+L4D6: // 7501 ADD V5, 0x01
+    STEP(0x4D6, 0x7501);
+    V[5] += 0x01;
+L4D8: // A281 LD I, 0x281
+    STEP(0x4D8, 0xA281);
+    c->I = 0x281;
+L4DA: // D451 DRW V4, V5, 1
+    STEP(0x4DA, 0xD451);
+    c->pc = 0x4DA;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4DC) goto dispatch;
+L4DC: // 7408 ADD V4, 0x08
+    STEP(0x4DC, 0x7408);
+    V[4] += 0x08;
+L4DE: // D451 DRW V4, V5, 1
+    STEP(0x4DE, 0xD451);
+    c->pc = 0x4DE;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4E0) goto dispatch;
+L4E0: // 7408 ADD V4, 0x08
+    STEP(0x4E0, 0x7408);
+    V[4] += 0x08;
+L4E2: // D451 DRW V4, V5, 1
+    STEP(0x4E2, 0xD451);
+    c->pc = 0x4E2;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4E4) goto dispatch;
+L4E4: // 00EE RET
+    STEP(0x4E4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L4E6: // 6400 LD V4, 0x00
+    STEP(0x4E6, 0x6400);
+    V[4] = 0x00;
+L4E8: // 651A LD V5, 0x1A
+    STEP(0x4E8, 0x651A);
+    V[5] = 0x1A;
+L4EA: // A281 LD I, 0x281
+    STEP(0x4EA, 0xA281);
+    c->I = 0x281;
+L4EC: // D451 DRW V4, V5, 1
+    STEP(0x4EC, 0xD451);
+    c->pc = 0x4EC;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4EE) goto dispatch;
+L4EE: // 7408 ADD V4, 0x08
+    STEP(0x4EE, 0x7408);
+    V[4] += 0x08;
+L4F0: // D451 DRW V4, V5, 1
+    STEP(0x4F0, 0xD451);
+    c->pc = 0x4F0;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4F2) goto dispatch;
+L4F2: // 7408 ADD V4, 0x08
+    STEP(0x4F2, 0x7408);
+    V[4] += 0x08;
+L4F4: // D451 DRW V4, V5, 1
+    STEP(0x4F4, 0xD451);
+    c->pc = 0x4F4;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4F6) goto dispatch;
+L4F6: // 7408 ADD V4, 0x08
+    STEP(0x4F6, 0x7408);
+    V[4] += 0x08;
+L4F8: // D451 DRW V4, V5, 1
+    STEP(0x4F8, 0xD451);
+    c->pc = 0x4F8;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4FA) goto dispatch;
+L4FA: // 7408 ADD V4, 0x08
+    STEP(0x4FA, 0x7408);
+    V[4] += 0x08;
+L4FC: // D451 DRW V4, V5, 1
+    STEP(0x4FC, 0xD451);
+    c->pc = 0x4FC;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x4FE) goto dispatch;
+L4FE: // 75FF ADD V5, 0xFF
+    STEP(0x4FE, 0x75FF);
+    V[5] += 0xFF;
+L500: // D451 DRW V4, V5, 1
+    STEP(0x500, 0xD451);
+    c->pc = 0x500;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x502) goto dispatch;
+L502: // 7408 ADD V4, 0x08
+    STEP(0x502, 0x7408);
+    V[4] += 0x08;
+L504: // D451 DRW V4, V5, 1
+    STEP(0x504, 0xD451);
+    c->pc = 0x504;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x506) goto dispatch;
+L506: // 7408 ADD V4, 0x08
+    STEP(0x506, 0x7408);
+    V[4] += 0x08;
+L508: // D451 DRW V4, V5, 1
+    STEP(0x508, 0xD451);
+    c->pc = 0x508;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x50A) goto dispatch;
+L50A: // 7408 ADD V4, 0x08
+    STEP(0x50A, 0x7408);
+    V[4] += 0x08;
+L50C: // D451 DRW V4, V5, 1
+    STEP(0x50C, 0xD451);
+    c->pc = 0x50C;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x50E) goto dispatch;
+L50E: // 00EE RET
+    STEP(0x50E, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L510: // 6400 LD V4, 0x00
+    STEP(0x510, 0x6400);
+    V[4] = 0x00;
+L512: // 6519 LD V5, 0x19
+    STEP(0x512, 0x6519);
+    V[5] = 0x19;
+L514: // A281 LD I, 0x281
+    STEP(0x514, 0xA281);
+    c->I = 0x281;
+L516: // D451 DRW V4, V5, 1
+    STEP(0x516, 0xD451);
+    c->pc = 0x516;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x518) goto dispatch;
+L518: // 7408 ADD V4, 0x08
+    STEP(0x518, 0x7408);
+    V[4] += 0x08;
+L51A: // D451 DRW V4, V5, 1
+    STEP(0x51A, 0xD451);
+    c->pc = 0x51A;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x51C) goto dispatch;
+L51C: // 7408 ADD V4, 0x08
+    STEP(0x51C, 0x7408);
+    V[4] += 0x08;
+L51E: // D451 DRW V4, V5, 1
+    STEP(0x51E, 0xD451);
+    c->pc = 0x51E;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x520) goto dispatch;
+L520: // 7408 ADD V4, 0x08
+    STEP(0x520, 0x7408);
+    V[4] += 0x08;
+L522: // D451 DRW V4, V5, 1
+    STEP(0x522, 0xD451);
+    c->pc = 0x522;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x524) goto dispatch;
+L524: // 7408 ADD V4, 0x08
+    STEP(0x524, 0x7408);
+    V[4] += 0x08;
+L526: // D451 DRW V4, V5, 1
+    STEP(0x526, 0xD451);
+    c->pc = 0x526;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x528) goto dispatch;
+L528: // 75FF ADD V5, 0xFF
+    STEP(0x528, 0x75FF);
+    V[5] += 0xFF;
+L52A: // D451 DRW V4, V5, 1
+    STEP(0x52A, 0xD451);
+    c->pc = 0x52A;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x52C) goto dispatch;
+L52C: // 7408 ADD V4, 0x08
+    STEP(0x52C, 0x7408);
+    V[4] += 0x08;
+L52E: // D451 DRW V4, V5, 1
+    STEP(0x52E, 0xD451);
+    c->pc = 0x52E;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x530) goto dispatch;
+L530: // 7408 ADD V4, 0x08
+    STEP(0x530, 0x7408);
+    V[4] += 0x08;
+L532: // D451 DRW V4, V5, 1
+    STEP(0x532, 0xD451);
+    c->pc = 0x532;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x534) goto dispatch;
+L534: // 7408 ADD V4, 0x08
+    STEP(0x534, 0x7408);
+    V[4] += 0x08;
+L536: // D451 DRW V4, V5, 1
+    STEP(0x536, 0xD451);
+    c->pc = 0x536;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x538) goto dispatch;
+L538: // 00EE RET
+    STEP(0x538, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L53A: // 00E0 CLS
+    STEP(0x53A, 0x00E0);
+    c->pc = 0x53A;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x53C) goto dispatch;
+L53C: // 6703 LD V7, 0x03
+    STEP(0x53C, 0x6703);
+    V[7] = 0x03;
+L53E: // 6803 LD V8, 0x03
+    STEP(0x53E, 0x6803);
+    V[8] = 0x03;
+L540: // A544 LD I, 0x544
+    STEP(0x540, 0xA544);
+    c->I = 0x544;
+L542: // 155C JP 0x55C
+    STEP(0x542, 0x155C);
+    goto L55C;
+L55C: // D785 DRW V7, V8, 5
+    STEP(0x55C, 0xD785);
+    c->pc = 0x55C;
+    predecode(0xD785, &in);
+    execute(c, &in);
+    if (c->pc != 0x55E) goto dispatch;
+L55E: // A54A LD I, 0x54A
+    STEP(0x55E, 0xA54A);
+    c->I = 0x54A;
+L560: // 7708 ADD V7, 0x08
+    STEP(0x560, 0x7708);
+    V[7] += 0x08;
+L562: // D785 DRW V7, V8, 5
+    STEP(0x562, 0xD785);
+    c->pc = 0x562;
+    predecode(0xD785, &in);
+    execute(c, &in);
+    if (c->pc != 0x564) goto dispatch;
+L564: // 7708 ADD V7, 0x08
+    STEP(0x564, 0x7708);
+    V[7] += 0x08;
+L566: // A550 LD I, 0x550
+    STEP(0x566, 0xA550);
+    c->I = 0x550;
+L568: // D785 DRW V7, V8, 5
+    STEP(0x568, 0xD785);
+    c->pc = 0x568;
+    predecode(0xD785, &in);
+    execute(c, &in);
+    if (c->pc != 0x56A) goto dispatch;
+L56A: // 7708 ADD V7, 0x08
+    STEP(0x56A, 0x7708);
+    V[7] += 0x08;
+L56C: // A556 LD I, 0x556
+    STEP(0x56C, 0xA556);
+    c->I = 0x556;
+L56E: // D785 DRW V7, V8, 5
+    STEP(0x56E, 0xD785);
+    c->pc = 0x56E;
+    predecode(0xD785, &in);
+    execute(c, &in);
+    if (c->pc != 0x570) goto dispatch;
+L570: // 1570 JP 0x570
+    STEP(0x570, 0x1570);
+    goto L570;
+}
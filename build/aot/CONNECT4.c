@@ -0,0 +1,383 @@
+// generated by chip8-aot from roms/CONNECT4.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x12, 0x1A, 0x43, 0x4F, 0x4E, 0x4E, 0x45, 0x43, 0x54, 0x34, 0x20, 0x62,
+    0x79, 0x20, 0x44, 0x61, 0x76, 0x69, 0x64, 0x20, 0x57, 0x49, 0x4E, 0x54,
+    0x45, 0x52, 0xA2, 0xBB, 0xF6, 0x65, 0xA2, 0xB4, 0xF6, 0x55, 0x69, 0x00,
+    0x68, 0x01, 0x6B, 0x00, 0x6D, 0x0F, 0x6E, 0x1F, 0xA2, 0xA5, 0x60, 0x0D,
+    0x61, 0x32, 0x62, 0x00, 0xD0, 0x2F, 0xD1, 0x2F, 0x72, 0x0F, 0x32, 0x1E,
+    0x12, 0x34, 0xD0, 0x21, 0xD1, 0x21, 0x72, 0x01, 0x60, 0x0A, 0xA2, 0x9F,
+    0xD0, 0x21, 0xD1, 0x21, 0xA2, 0x9F, 0xDD, 0xE1, 0xFC, 0x0A, 0xDD, 0xE1,
+    0x4C, 0x05, 0x12, 0x7E, 0x3C, 0x04, 0x12, 0x6A, 0x7B, 0xFF, 0x7D, 0xFB,
+    0x3D, 0x0A, 0x12, 0x7A, 0x6B, 0x06, 0x6D, 0x2D, 0x12, 0x7A, 0x3C, 0x06,
+    0x12, 0x98, 0x7B, 0x01, 0x7D, 0x05, 0x3D, 0x32, 0x12, 0x7A, 0x6B, 0x00,
+    0x6D, 0x0F, 0xDD, 0xE1, 0x12, 0x50, 0xA2, 0xB4, 0xFB, 0x1E, 0xF0, 0x65,
+    0x40, 0xFC, 0x12, 0x98, 0x8A, 0x00, 0x70, 0xFB, 0xF0, 0x55, 0x89, 0x83,
+    0xA2, 0x9E, 0x39, 0x00, 0xA2, 0xA1, 0xDD, 0xA4, 0xA2, 0x9F, 0xDD, 0xE1,
+    0x12, 0x50, 0x60, 0xF0, 0xF0, 0x60, 0x90, 0x90, 0x60, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A, 0x1A,
+    0x1A, 0x1A,
+};
+const size_t aot_rom_size = 194;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000700ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 121A JP 0x21A
+    STEP(0x200, 0x121A);
+    goto L21A;
+L21A: // A2BB LD I, 0x2BB
+    STEP(0x21A, 0xA2BB);
+    c->I = 0x2BB;
+L21C: // F665 LD V6, [I]
+    STEP(0x21C, 0xF665);
+    for (int i = 0; i <= 6; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L21E: // A2B4 LD I, 0x2B4
+    STEP(0x21E, 0xA2B4);
+    c->I = 0x2B4;
+L220: // F655 LD [I], V6
+    STEP(0x220, 0xF655);
+    c->pc = 0x220;
+    predecode(0xF655, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x222) goto dispatch;
+L222: // 6900 LD V9, 0x00
+    STEP(0x222, 0x6900);
+    V[9] = 0x00;
+L224: // 6801 LD V8, 0x01
+    STEP(0x224, 0x6801);
+    V[8] = 0x01;
+L226: // 6B00 LD VB, 0x00
+    STEP(0x226, 0x6B00);
+    V[11] = 0x00;
+L228: // 6D0F LD VD, 0x0F
+    STEP(0x228, 0x6D0F);
+    V[13] = 0x0F;
+L22A: // 6E1F LD VE, 0x1F
+    STEP(0x22A, 0x6E1F);
+    V[14] = 0x1F;
+L22C: // A2A5 LD I, 0x2A5
+    STEP(0x22C, 0xA2A5);
+    c->I = 0x2A5;
+L22E: // 600D LD V0, 0x0D
+    STEP(0x22E, 0x600D);
+    V[0] = 0x0D;
+L230: // 6132 LD V1, 0x32
+    STEP(0x230, 0x6132);
+    V[1] = 0x32;
+L232: // 6200 LD V2, 0x00
+    STEP(0x232, 0x6200);
+    V[2] = 0x00;
+L234: // D02F DRW V0, V2, 15
+    STEP(0x234, 0xD02F);
+    c->pc = 0x234;
+    predecode(0xD02F, &in);
+    execute(c, &in);
+    if (c->pc != 0x236) goto dispatch;
+L236: // D12F DRW V1, V2, 15
+    STEP(0x236, 0xD12F);
+    c->pc = 0x236;
+    predecode(0xD12F, &in);
+    execute(c, &in);
+    if (c->pc != 0x238) goto dispatch;
+L238: // 720F ADD V2, 0x0F
+    STEP(0x238, 0x720F);
+    V[2] += 0x0F;
+L23A: // 321E SE V2, 0x1E
+    STEP(0x23A, 0x321E);
+    if (V[2] == 0x1E) goto L23E;
+L23C: // 1234 JP 0x234
+    STEP(0x23C, 0x1234);
+    goto L234;
+L23E: // D021 DRW V0, V2, 1
+    STEP(0x23E, 0xD021);
+    c->pc = 0x23E;
+    predecode(0xD021, &in);
+    execute(c, &in);
+    if (c->pc != 0x240) goto dispatch;
+L240: // D121 DRW V1, V2, 1
+    STEP(0x240, 0xD121);
+    c->pc = 0x240;
+    predecode(0xD121, &in);
+    execute(c, &in);
+    if (c->pc != 0x242) goto dispatch;
+L242: // 7201 ADD V2, 0x01
+    STEP(0x242, 0x7201);
+    V[2] += 0x01;
+L244: // 600A LD V0, 0x0A
+    STEP(0x244, 0x600A);
+    V[0] = 0x0A;
+L246: // A29F LD I, 0x29F
+    STEP(0x246, 0xA29F);
+    c->I = 0x29F;
+L248: // D021 DRW V0, V2, 1
+    STEP(0x248, 0xD021);
+    c->pc = 0x248;
+    predecode(0xD021, &in);
+    execute(c, &in);
+    if (c->pc != 0x24A) goto dispatch;
+L24A: // D121 DRW V1, V2, 1
+    STEP(0x24A, 0xD121);
+    c->pc = 0x24A;
+    predecode(0xD121, &in);
+    execute(c, &in);
+    if (c->pc != 0x24C) goto dispatch;
+L24C: // A29F LD I, 0x29F
+    STEP(0x24C, 0xA29F);
+    c->I = 0x29F;
+L24E: // DDE1 DRW VD, VE, 1
+    STEP(0x24E, 0xDDE1);
+    c->pc = 0x24E;
+    predecode(0xDDE1, &in);
+    execute(c, &in);
+    if (c->pc != 0x250) goto dispatch;
+L250: // FC0A LD VC, K
+    STEP(0x250, 0xFC0A);
+    if (c->keypad == 0) {
+        c->pc = 0x250;
+        return cycles - left;
+    }
+    V[12] = __builtin_ctz(c->keypad);
+L252: // DDE1 DRW VD, VE, 1
+    STEP(0x252, 0xDDE1);
+    c->pc = 0x252;
+    predecode(0xDDE1, &in);
+    execute(c, &in);
+    if (c->pc != 0x254) goto dispatch;
+L254: // 4C05 SNE VC, 0x05
+    STEP(0x254, 0x4C05);
+    if (V[12] != 0x05) goto L258;
+L256: // 127E JP 0x27E
+    STEP(0x256, 0x127E);
+    goto L27E;
+L258: // 3C04 SE VC, 0x04
+    STEP(0x258, 0x3C04);
+    if (V[12] == 0x04) goto L25C;
+L25A: // 126A JP 0x26A
+    STEP(0x25A, 0x126A);
+    goto L26A;
+L25C: // 7BFF ADD VB, 0xFF
+    STEP(0x25C, 0x7BFF);
+    V[11] += 0xFF;
+L25E: // 7DFB ADD VD, 0xFB
+    STEP(0x25E, 0x7DFB);
+    V[13] += 0xFB;
+L260: // 3D0A SE VD, 0x0A
+    STEP(0x260, 0x3D0A);
+    if (V[13] == 0x0A) goto L264;
+L262: // 127A JP 0x27A
+    STEP(0x262, 0x127A);
+    goto L27A;
+L264: // 6B06 LD VB, 0x06
+    STEP(0x264, 0x6B06);
+    V[11] = 0x06;
+L266: // 6D2D LD VD, 0x2D
+    STEP(0x266, 0x6D2D);
+    V[13] = 0x2D;
+L268: // 127A JP 0x27A
+    STEP(0x268, 0x127A);
+    goto L27A;
+L26A: // 3C06 SE VC, 0x06
+    STEP(0x26A, 0x3C06);
+    if (V[12] == 0x06) goto L26E;
+L26C: // 1298 JP 0x298
+    STEP(0x26C, 0x1298);
+    goto L298;
+L26E: // 7B01 ADD VB, 0x01
+    STEP(0x26E, 0x7B01);
+    V[11] += 0x01;
+L270: // 7D05 ADD VD, 0x05
+    STEP(0x270, 0x7D05);
+    V[13] += 0x05;
+L272: // 3D32 SE VD, 0x32
+    STEP(0x272, 0x3D32);
+    if (V[13] == 0x32) goto L276;
+L274: // 127A JP 0x27A
+    STEP(0x274, 0x127A);
+    goto L27A;
+L276: // 6B00 LD VB, 0x00
+    STEP(0x276, 0x6B00);
+    V[11] = 0x00;
+L278: // 6D0F LD VD, 0x0F
+    STEP(0x278, 0x6D0F);
+    V[13] = 0x0F;
+L27A: // DDE1 DRW VD, VE, 1
+    STEP(0x27A, 0xDDE1);
+    c->pc = 0x27A;
+    predecode(0xDDE1, &in);
+    execute(c, &in);
+    if (c->pc != 0x27C) goto dispatch;
+L27C: // 1250 JP 0x250
+    STEP(0x27C, 0x1250);
+    goto L250;
+L27E: // A2B4 LD I, 0x2B4
+    STEP(0x27E, 0xA2B4);
+    c->I = 0x2B4;
+L280: // FB1E ADD I, VB
+    STEP(0x280, 0xFB1E);
+    c->I += V[11];
+L282: // F065 LD V0, [I]
+    STEP(0x282, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L284: // 40FC SNE V0, 0xFC
+    STEP(0x284, 0x40FC);
+    if (V[0] != 0xFC) goto L288;
+L286: // 1298 JP 0x298
+    STEP(0x286, 0x1298);
+    goto L298;
+L288: // 8A00 LD VA, V0
+    STEP(0x288, 0x8A00);
+    V[10] = V[0];
+L28A: // 70FB ADD V0, 0xFB
+    STEP(0x28A, 0x70FB);
+    V[0] += 0xFB;
+L28C: // F055 LD [I], V0
+    STEP(0x28C, 0xF055);
+    c->pc = 0x28C;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x28E) goto dispatch;
+L28E: // 8983 XOR V9, V8
+    STEP(0x28E, 0x8983);
+    V[9] ^= V[8];
+L290: // A29E LD I, 0x29E
+    STEP(0x290, 0xA29E);
+    c->I = 0x29E;
+L292: // 3900 SE V9, 0x00
+    STEP(0x292, 0x3900);
+    if (V[9] == 0x00) goto L296;
+L294: // A2A1 LD I, 0x2A1
+    STEP(0x294, 0xA2A1);
+    c->I = 0x2A1;
+L296: // DDA4 DRW VD, VA, 4
+    STEP(0x296, 0xDDA4);
+    c->pc = 0x296;
+    predecode(0xDDA4, &in);
+    execute(c, &in);
+    if (c->pc != 0x298) goto dispatch;
+L298: // A29F LD I, 0x29F
+    STEP(0x298, 0xA29F);
+    c->I = 0x29F;
+L29A: // DDE1 DRW VD, VE, 1
+    STEP(0x29A, 0xDDE1);
+    c->pc = 0x29A;
+    predecode(0xDDE1, &in);
+    execute(c, &in);
+    if (c->pc != 0x29C) goto dispatch;
+L29C: // 1250 JP 0x250
+    STEP(0x29C, 0x1250);
+    goto L250;
+}
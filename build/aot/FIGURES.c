@@ -0,0 +1,721 @@
+// generated by chip8-aot from roms/FIGURES.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x00, 0xE0, 0x60, 0x00, 0x61, 0x00, 0x62, 0x15, 0xA3, 0x10, 0xD0, 0x1A,
+    0xD2, 0x1A, 0x71, 0x0A, 0x31, 0x1E, 0x12, 0x0A, 0xA3, 0x1A, 0x61, 0x1D,
+    0x60, 0x01, 0xD0, 0x11, 0x70, 0x08, 0xD0, 0x11, 0x70, 0x08, 0xA3, 0x1C,
+    0xD0, 0x11, 0x6E, 0x00, 0x6D, 0x78, 0x22, 0xD0, 0x60, 0x14, 0xCA, 0x0F,
+    0x6B, 0x09, 0x6C, 0x00, 0x22, 0xC8, 0xF0, 0x18, 0x60, 0x14, 0xF0, 0x15,
+    0xF0, 0x07, 0x30, 0x00, 0x12, 0x3C, 0x60, 0x05, 0xF0, 0x18, 0x22, 0xD0,
+    0x7D, 0xFF, 0x22, 0xD0, 0x4D, 0x00, 0x12, 0x9C, 0xA3, 0x08, 0x22, 0xC8,
+    0x7C, 0x01, 0x60, 0x04, 0xE0, 0xA1, 0x22, 0x9E, 0x60, 0x06, 0xE0, 0xA1,
+    0x22, 0xA6, 0x60, 0x02, 0xE0, 0xA1, 0x22, 0xAE, 0x22, 0xC8, 0x4F, 0x01,
+    0x12, 0x7E, 0x60, 0x01, 0xF0, 0x18, 0x60, 0x02, 0xF0, 0x15, 0xF0, 0x07,
+    0x30, 0x00, 0x12, 0x76, 0x12, 0x50, 0x22, 0xD0, 0x7E, 0x01, 0x22, 0xD0,
+    0xCA, 0x0F, 0x6B, 0x09, 0x6C, 0x00, 0x22, 0xC8, 0x4F, 0x01, 0x12, 0x9C,
+    0x60, 0x0A, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x94, 0x12, 0x42,
+    0x12, 0x9C, 0x4B, 0x01, 0x00, 0xEE, 0x7B, 0xFE, 0x00, 0xEE, 0x4B, 0x11,
+    0x00, 0xEE, 0x7B, 0x02, 0x00, 0xEE, 0x4E, 0x00, 0x00, 0xEE, 0x22, 0xD0,
+    0x7E, 0xFF, 0x22, 0xD0, 0xC0, 0x08, 0x70, 0x13, 0x61, 0x02, 0xA3, 0x20,
+    0xD1, 0x08, 0x71, 0x08, 0xD1, 0x08, 0x00, 0xEE, 0xA3, 0x08, 0xFA, 0x29,
+    0xDB, 0xC5, 0x00, 0xEE, 0xA3, 0x08, 0x63, 0x32, 0x64, 0x00, 0xFD, 0x33,
+    0xF2, 0x65, 0xF0, 0x29, 0xD3, 0x45, 0x73, 0x05, 0xF1, 0x29, 0xD3, 0x45,
+    0x73, 0x05, 0xF2, 0x29, 0xD3, 0x45, 0xA3, 0x08, 0x63, 0x32, 0x64, 0x06,
+    0xFE, 0x33, 0xF2, 0x65, 0xF0, 0x29, 0xD3, 0x45, 0x73, 0x05, 0xF1, 0x29,
+    0xD3, 0x45, 0x73, 0x05, 0xF2, 0x29, 0xD3, 0x45, 0xA3, 0x08, 0x00, 0xEE,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x00, 0xF0, 0x00, 0x80, 0x00,
+    0xAA, 0x55,
+};
+const size_t aot_rom_size = 290;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000001F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+        case 0x2FE: goto L2FE;
+        case 0x300: goto L300;
+        case 0x302: goto L302;
+        case 0x304: goto L304;
+        case 0x306: goto L306;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 00E0 CLS
+    STEP(0x200, 0x00E0);
+    c->pc = 0x200;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x202) goto dispatch;
+L202: // 6000 LD V0, 0x00
+    STEP(0x202, 0x6000);
+    V[0] = 0x00;
+L204: // 6100 LD V1, 0x00
+    STEP(0x204, 0x6100);
+    V[1] = 0x00;
+L206: // 6215 LD V2, 0x15
+    STEP(0x206, 0x6215);
+    V[2] = 0x15;
+L208: // A310 LD I, 0x310
+    STEP(0x208, 0xA310);
+    c->I = 0x310;
+L20A: // D01A DRW V0, V1, 10
+    STEP(0x20A, 0xD01A);
+    c->pc = 0x20A;
+    predecode(0xD01A, &in);
+    execute(c, &in);
+    if (c->pc != 0x20C) goto dispatch;
+L20C: // D21A DRW V2, V1, 10
+    STEP(0x20C, 0xD21A);
+    c->pc = 0x20C;
+    predecode(0xD21A, &in);
+    execute(c, &in);
+    if (c->pc != 0x20E) goto dispatch;
+L20E: // 710A ADD V1, 0x0A
+    STEP(0x20E, 0x710A);
+    V[1] += 0x0A;
+L210: // 311E SE V1, 0x1E
+    STEP(0x210, 0x311E);
+    if (V[1] == 0x1E) goto L214;
+L212: // 120A JP 0x20A
+    STEP(0x212, 0x120A);
+    goto L20A;
+L214: // A31A LD I, 0x31A
+    STEP(0x214, 0xA31A);
+    c->I = 0x31A;
+L216: // 611D LD V1, 0x1D
+    STEP(0x216, 0x611D);
+    V[1] = 0x1D;
+L218: // 6001 LD V0, 0x01
+    STEP(0x218, 0x6001);
+    V[0] = 0x01;
+L21A: // D011 DRW V0, V1, 1
+    STEP(0x21A, 0xD011);
+    c->pc = 0x21A;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x21C) goto dispatch;
+L21C: // 7008 ADD V0, 0x08
+    STEP(0x21C, 0x7008);
+    V[0] += 0x08;
+L21E: // D011 DRW V0, V1, 1
+    STEP(0x21E, 0xD011);
+    c->pc = 0x21E;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x220) goto dispatch;
+L220: // 7008 ADD V0, 0x08
+    STEP(0x220, 0x7008);
+    V[0] += 0x08;
+L222: // A31C LD I, 0x31C
+    STEP(0x222, 0xA31C);
+    c->I = 0x31C;
+L224: // D011 DRW V0, V1, 1
+    STEP(0x224, 0xD011);
+    c->pc = 0x224;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x226) goto dispatch;
+L226: // 6E00 LD VE, 0x00
+    STEP(0x226, 0x6E00);
+    V[14] = 0x00;
+L228: // 6D78 LD VD, 0x78
+    STEP(0x228, 0x6D78);
+    V[13] = 0x78;
+L22A: // 22D0 CALL 0x2D0
+    STEP(0x22A, 0x22D0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x22A;
+    goto L2D0;
+L22C: // 6014 LD V0, 0x14
+    STEP(0x22C, 0x6014);
+    V[0] = 0x14;
+L22E: // CA0F RND VA, 0x0F
+    STEP(0x22E, 0xCA0F);
+    c->pc = 0x22E;
+    predecode(0xCA0F, &in);
+    execute(c, &in);
+    if (c->pc != 0x230) goto dispatch;
+L230: // 6B09 LD VB, 0x09
+    STEP(0x230, 0x6B09);
+    V[11] = 0x09;
+L232: // 6C00 LD VC, 0x00
+    STEP(0x232, 0x6C00);
+    V[12] = 0x00;
+L234: // 22C8 CALL 0x2C8
+    STEP(0x234, 0x22C8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x234;
+    goto L2C8;
+L236: // F018 LD ST, V0
+    STEP(0x236, 0xF018);
+    c->st = V[0];
+L238: // 6014 LD V0, 0x14
+    STEP(0x238, 0x6014);
+    V[0] = 0x14;
+L23A: // F015 LD DT, V0
+    STEP(0x23A, 0xF015);
+    c->dt = V[0];
+L23C: // F007 LD V0, DT
+    STEP(0x23C, 0xF007);
+    V[0] = c->dt;
+L23E: // 3000 SE V0, 0x00
+    STEP(0x23E, 0x3000);
+    if (V[0] == 0x00) goto L242;
+L240: // 123C JP 0x23C
+    STEP(0x240, 0x123C);
+    goto L23C;
+L242: // 6005 LD V0, 0x05
+    STEP(0x242, 0x6005);
+    V[0] = 0x05;
+L244: // F018 LD ST, V0
+    STEP(0x244, 0xF018);
+    c->st = V[0];
+L246: // 22D0 CALL 0x2D0
+    STEP(0x246, 0x22D0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x246;
+    goto L2D0;
+L248: // 7DFF ADD VD, 0xFF
+    STEP(0x248, 0x7DFF);
+    V[13] += 0xFF;
+L24A: // 22D0 CALL 0x2D0
+    STEP(0x24A, 0x22D0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x24A;
+    goto L2D0;
+L24C: // 4D00 SNE VD, 0x00
+    STEP(0x24C, 0x4D00);
+    if (V[13] != 0x00) goto L250;
+L24E: // 129C JP 0x29C
+    STEP(0x24E, 0x129C);
+    goto L29C;
+L250: // A308 LD I, 0x308
+    STEP(0x250, 0xA308);
+    c->I = 0x308;
+L252: // 22C8 CALL 0x2C8
+    STEP(0x252, 0x22C8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x252;
+    goto L2C8;
+L254: // 7C01 ADD VC, 0x01
+    STEP(0x254, 0x7C01);
+    V[12] += 0x01;
+L256: // 6004 LD V0, 0x04
+    STEP(0x256, 0x6004);
+    V[0] = 0x04;
+L258: // E0A1 SKNP V0
+    STEP(0x258, 0xE0A1);
+    c->pc = 0x258;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x25A) goto dispatch;
+L25A: // 229E CALL 0x29E
+    STEP(0x25A, 0x229E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x25A;
+    goto L29E;
+L25C: // 6006 LD V0, 0x06
+    STEP(0x25C, 0x6006);
+    V[0] = 0x06;
+L25E: // E0A1 SKNP V0
+    STEP(0x25E, 0xE0A1);
+    c->pc = 0x25E;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x260) goto dispatch;
+L260: // 22A6 CALL 0x2A6
+    STEP(0x260, 0x22A6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x260;
+    goto L2A6;
+L262: // 6002 LD V0, 0x02
+    STEP(0x262, 0x6002);
+    V[0] = 0x02;
+L264: // E0A1 SKNP V0
+    STEP(0x264, 0xE0A1);
+    c->pc = 0x264;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x266) goto dispatch;
+L266: // 22AE CALL 0x2AE
+    STEP(0x266, 0x22AE);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x266;
+    goto L2AE;
+L268: // 22C8 CALL 0x2C8
+    STEP(0x268, 0x22C8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x268;
+    goto L2C8;
+L26A: // 4F01 SNE VF, 0x01
+    STEP(0x26A, 0x4F01);
+    if (V[15] != 0x01) goto L26E;
+L26C: // 127E JP 0x27E
+    STEP(0x26C, 0x127E);
+    goto L27E;
+L26E: // 6001 LD V0, 0x01
+    STEP(0x26E, 0x6001);
+    V[0] = 0x01;
+L270: // F018 LD ST, V0
+    STEP(0x270, 0xF018);
+    c->st = V[0];
+L272: // 6002 LD V0, 0x02
+    STEP(0x272, 0x6002);
+    V[0] = 0x02;
+L274: // F015 LD DT, V0
+    STEP(0x274, 0xF015);
+    c->dt = V[0];
+L276: // F007 LD V0, DT
+    STEP(0x276, 0xF007);
+    V[0] = c->dt;
+L278: // 3000 SE V0, 0x00
+    STEP(0x278, 0x3000);
+    if (V[0] == 0x00) goto L27C;
+L27A: // 1276 JP 0x276
+    STEP(0x27A, 0x1276);
+    goto L276;
+L27C: // 1250 JP 0x250
+    STEP(0x27C, 0x1250);
+    goto L250;
+L27E: // 22D0 CALL 0x2D0
+    STEP(0x27E, 0x22D0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x27E;
+    goto L2D0;
+L280: // 7E01 ADD VE, 0x01
+    STEP(0x280, 0x7E01);
+    V[14] += 0x01;
+L282: // 22D0 CALL 0x2D0
+    STEP(0x282, 0x22D0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x282;
+    goto L2D0;
+L284: // CA0F RND VA, 0x0F
+    STEP(0x284, 0xCA0F);
+    c->pc = 0x284;
+    predecode(0xCA0F, &in);
+    execute(c, &in);
+    if (c->pc != 0x286) goto dispatch;
+L286: // 6B09 LD VB, 0x09
+    STEP(0x286, 0x6B09);
+    V[11] = 0x09;
+L288: // 6C00 LD VC, 0x00
+    STEP(0x288, 0x6C00);
+    V[12] = 0x00;
+L28A: // 22C8 CALL 0x2C8
+    STEP(0x28A, 0x22C8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x28A;
+    goto L2C8;
+L28C: // 4F01 SNE VF, 0x01
+    STEP(0x28C, 0x4F01);
+    if (V[15] != 0x01) goto L290;
+L28E: // 129C JP 0x29C
+    STEP(0x28E, 0x129C);
+    goto L29C;
+L290: // 600A LD V0, 0x0A
+    STEP(0x290, 0x600A);
+    V[0] = 0x0A;
+L292: // F015 LD DT, V0
+    STEP(0x292, 0xF015);
+    c->dt = V[0];
+L294: // F007 LD V0, DT
+    STEP(0x294, 0xF007);
+    V[0] = c->dt;
+L296: // 3000 SE V0, 0x00
+    STEP(0x296, 0x3000);
+    if (V[0] == 0x00) goto L29A;
+L298: // 1294 JP 0x294
+    STEP(0x298, 0x1294);
+    goto L294;
+L29A: // 1242 JP 0x242
+    STEP(0x29A, 0x1242);
+    goto L242;
+L29C: // 129C JP 0x29C
+    STEP(0x29C, 0x129C);
+    goto L29C;
+L29E: // 4B01 SNE VB, 0x01
+    STEP(0x29E, 0x4B01);
+    if (V[11] != 0x01) goto L2A2;
+L2A0: // 00EE RET
+    STEP(0x2A0, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2A2: // 7BFE ADD VB, 0xFE
+    STEP(0x2A2, 0x7BFE);
+    V[11] += 0xFE;
+L2A4: // 00EE RET
+    STEP(0x2A4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2A6: // 4B11 SNE VB, 0x11
+    STEP(0x2A6, 0x4B11);
+    if (V[11] != 0x11) goto L2AA;
+L2A8: // 00EE RET
+    STEP(0x2A8, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2AA: // 7B02 ADD VB, 0x02
+    STEP(0x2AA, 0x7B02);
+    V[11] += 0x02;
+L2AC: // 00EE RET
+    STEP(0x2AC, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2AE: // 4E00 SNE VE, 0x00
+    STEP(0x2AE, 0x4E00);
+    if (V[14] != 0x00) goto L2B2;
+L2B0: // 00EE RET
+    STEP(0x2B0, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2B2: // 22D0 CALL 0x2D0
+    STEP(0x2B2, 0x22D0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2B2;
+    goto L2D0;
+L2B4: // 7EFF ADD VE, 0xFF
+    STEP(0x2B4, 0x7EFF);
+    V[14] += 0xFF;
+L2B6: // 22D0 CALL 0x2D0
+    STEP(0x2B6, 0x22D0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2B6;
+    goto L2D0;
+L2B8: // C008 RND V0, 0x08
+    STEP(0x2B8, 0xC008);
+    c->pc = 0x2B8;
+    predecode(0xC008, &in);
+    execute(c, &in);
+    if (c->pc != 0x2BA) goto dispatch;
+L2BA: // 7013 ADD V0, 0x13
+    STEP(0x2BA, 0x7013);
+    V[0] += 0x13;
+L2BC: // 6102 LD V1, 0x02
+    STEP(0x2BC, 0x6102);
+    V[1] = 0x02;
+L2BE: // A320 LD I, 0x320
+    STEP(0x2BE, 0xA320);
+    c->I = 0x320;
+L2C0: // D108 DRW V1, V0, 8
+    STEP(0x2C0, 0xD108);
+    c->pc = 0x2C0;
+    predecode(0xD108, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C2) goto dispatch;
+L2C2: // 7108 ADD V1, 0x08
+    STEP(0x2C2, 0x7108);
+    V[1] += 0x08;
+L2C4: // D108 DRW V1, V0, 8
+    STEP(0x2C4, 0xD108);
+    c->pc = 0x2C4;
+    predecode(0xD108, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C6) goto dispatch;
+L2C6: // 00EE RET
+    STEP(0x2C6, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2C8: // A308 LD I, 0x308
+    STEP(0x2C8, 0xA308);
+    c->I = 0x308;
+L2CA: // FA29 LD F, VA
+    STEP(0x2CA, 0xFA29);
+    c->I = V[10] * 5;
+L2CC: // DBC5 DRW VB, VC, 5
+    STEP(0x2CC, 0xDBC5);
+    c->pc = 0x2CC;
+    predecode(0xDBC5, &in);
+    execute(c, &in);
+    if (c->pc != 0x2CE) goto dispatch;
+L2CE: // 00EE RET
+    STEP(0x2CE, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2D0: // A308 LD I, 0x308
+    STEP(0x2D0, 0xA308);
+    c->I = 0x308;
+L2D2: // 6332 LD V3, 0x32
+    STEP(0x2D2, 0x6332);
+    V[3] = 0x32;
+L2D4: // 6400 LD V4, 0x00
+    STEP(0x2D4, 0x6400);
+    V[4] = 0x00;
+L2D6: // FD33 LD B, VD
+    STEP(0x2D6, 0xFD33);
+    c->pc = 0x2D6;
+    predecode(0xFD33, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2D8) goto dispatch;
+L2D8: // F265 LD V2, [I]
+    STEP(0x2D8, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2DA: // F029 LD F, V0
+    STEP(0x2DA, 0xF029);
+    c->I = V[0] * 5;
+L2DC: // D345 DRW V3, V4, 5
+    STEP(0x2DC, 0xD345);
+    c->pc = 0x2DC;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2DE) goto dispatch;
+L2DE: // 7305 ADD V3, 0x05
+    STEP(0x2DE, 0x7305);
+    V[3] += 0x05;
+L2E0: // F129 LD F, V1
+    STEP(0x2E0, 0xF129);
+    c->I = V[1] * 5;
+L2E2: // D345 DRW V3, V4, 5
+    STEP(0x2E2, 0xD345);
+    c->pc = 0x2E2;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2E4) goto dispatch;
+L2E4: // 7305 ADD V3, 0x05
+    STEP(0x2E4, 0x7305);
+    V[3] += 0x05;
+L2E6: // F229 LD F, V2
+    STEP(0x2E6, 0xF229);
+    c->I = V[2] * 5;
+L2E8: // D345 DRW V3, V4, 5
+    STEP(0x2E8, 0xD345);
+    c->pc = 0x2E8;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2EA) goto dispatch;
+L2EA: // A308 LD I, 0x308
+    STEP(0x2EA, 0xA308);
+    c->I = 0x308;
+L2EC: // 6332 LD V3, 0x32
+    STEP(0x2EC, 0x6332);
+    V[3] = 0x32;
+L2EE: // 6406 LD V4, 0x06
+    STEP(0x2EE, 0x6406);
+    V[4] = 0x06;
+L2F0: // FE33 LD B, VE
+    STEP(0x2F0, 0xFE33);
+    c->pc = 0x2F0;
+    predecode(0xFE33, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2F2) goto dispatch;
+L2F2: // F265 LD V2, [I]
+    STEP(0x2F2, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2F4: // F029 LD F, V0
+    STEP(0x2F4, 0xF029);
+    c->I = V[0] * 5;
+L2F6: // D345 DRW V3, V4, 5
+    STEP(0x2F6, 0xD345);
+    c->pc = 0x2F6;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2F8) goto dispatch;
+L2F8: // 7305 ADD V3, 0x05
+    STEP(0x2F8, 0x7305);
+    V[3] += 0x05;
+L2FA: // F129 LD F, V1
+    STEP(0x2FA, 0xF129);
+    c->I = V[1] * 5;
+L2FC: // D345 DRW V3, V4, 5
+    STEP(0x2FC, 0xD345);
+    c->pc = 0x2FC;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2FE) goto dispatch;
+L2FE: // 7305 ADD V3, 0x05
+    STEP(0x2FE, 0x7305);
+    V[3] += 0x05;
+L300: // F229 LD F, V2
+    STEP(0x300, 0xF229);
+    c->I = V[2] * 5;
+L302: // D345 DRW V3, V4, 5
+    STEP(0x302, 0xD345);
+    c->pc = 0x302;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x304) goto dispatch;
+L304: // A308 LD I, 0x308
+    STEP(0x304, 0xA308);
+    c->I = 0x308;
+L306: // 00EE RET
+    STEP(0x306, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
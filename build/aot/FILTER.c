@@ -0,0 +1,547 @@
+// generated by chip8-aot from roms/FILTER.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x00, 0xE0, 0x6E, 0x00, 0x6D, 0x07, 0x6B, 0x1D, 0x6C, 0x1C, 0x22, 0x8E,
+    0x22, 0x9E, 0x22, 0x78, 0x22, 0x6E, 0x60, 0x01, 0xF0, 0x15, 0xF0, 0x07,
+    0x30, 0x00, 0x12, 0x16, 0x22, 0x80, 0x49, 0x1F, 0x22, 0x34, 0x60, 0x04,
+    0xE0, 0xA1, 0x22, 0x5E, 0x70, 0x02, 0xE0, 0xA1, 0x22, 0x66, 0x46, 0x01,
+    0x22, 0x48, 0x12, 0x12, 0x22, 0x8A, 0x60, 0x02, 0xF0, 0x18, 0x22, 0x9E,
+    0x7D, 0xFF, 0x22, 0x9E, 0x4D, 0x00, 0x12, 0x5C, 0x22, 0x6E, 0x00, 0xEE,
+    0x60, 0x05, 0xF0, 0x18, 0x22, 0x9E, 0x7E, 0x01, 0x22, 0x9E, 0x4E, 0x63,
+    0x12, 0x5C, 0x22, 0x8A, 0x22, 0x6E, 0x00, 0xEE, 0x12, 0x5C, 0x22, 0x78,
+    0x7B, 0xFD, 0x22, 0x78, 0x00, 0xEE, 0x22, 0x78, 0x7B, 0x03, 0x22, 0x78,
+    0x00, 0xEE, 0x69, 0x07, 0xC8, 0x3D, 0x78, 0x02, 0xD8, 0x91, 0x00, 0xEE,
+    0xA2, 0xBC, 0xDB, 0xC1, 0xA2, 0xBD, 0x00, 0xEE, 0x22, 0x8A, 0x79, 0x01,
+    0x22, 0x8A, 0x86, 0xF0, 0x00, 0xEE, 0xD8, 0x91, 0x00, 0xEE, 0x63, 0x06,
+    0x64, 0x00, 0xA2, 0xBE, 0xD4, 0x31, 0x74, 0x08, 0x44, 0x40, 0x00, 0xEE,
+    0x12, 0x94, 0xA2, 0xC0, 0x63, 0x37, 0x64, 0x00, 0xFE, 0x33, 0xF2, 0x65,
+    0xF1, 0x29, 0xD3, 0x45, 0x73, 0x05, 0xF2, 0x29, 0xD3, 0x45, 0x63, 0x00,
+    0xFD, 0x29, 0xD3, 0x45, 0xA2, 0xBD, 0x00, 0xEE, 0xFC, 0x80, 0xFF, 0x75,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const size_t aot_rom_size = 198;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000700ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 00E0 CLS
+    STEP(0x200, 0x00E0);
+    c->pc = 0x200;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x202) goto dispatch;
+L202: // 6E00 LD VE, 0x00
+    STEP(0x202, 0x6E00);
+    V[14] = 0x00;
+L204: // 6D07 LD VD, 0x07
+    STEP(0x204, 0x6D07);
+    V[13] = 0x07;
+L206: // 6B1D LD VB, 0x1D
+    STEP(0x206, 0x6B1D);
+    V[11] = 0x1D;
+L208: // 6C1C LD VC, 0x1C
+    STEP(0x208, 0x6C1C);
+    V[12] = 0x1C;
+L20A: // 228E CALL 0x28E
+    STEP(0x20A, 0x228E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x20A;
+    goto L28E;
+L20C: // 229E CALL 0x29E
+    STEP(0x20C, 0x229E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x20C;
+    goto L29E;
+L20E: // 2278 CALL 0x278
+    STEP(0x20E, 0x2278);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x20E;
+    goto L278;
+L210: // 226E CALL 0x26E
+    STEP(0x210, 0x226E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x210;
+    goto L26E;
+L212: // 6001 LD V0, 0x01
+    STEP(0x212, 0x6001);
+    V[0] = 0x01;
+L214: // F015 LD DT, V0
+    STEP(0x214, 0xF015);
+    c->dt = V[0];
+L216: // F007 LD V0, DT
+    STEP(0x216, 0xF007);
+    V[0] = c->dt;
+L218: // 3000 SE V0, 0x00
+    STEP(0x218, 0x3000);
+    if (V[0] == 0x00) goto L21C;
+L21A: // 1216 JP 0x216
+    STEP(0x21A, 0x1216);
+    goto L216;
+L21C: // 2280 CALL 0x280
+    STEP(0x21C, 0x2280);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x21C;
+    goto L280;
+L21E: // 491F SNE V9, 0x1F
+    STEP(0x21E, 0x491F);
+    if (V[9] != 0x1F) goto L222;
+L220: // 2234 CALL 0x234
+    STEP(0x220, 0x2234);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x220;
+    goto L234;
+L222: // 6004 LD V0, 0x04
+    STEP(0x222, 0x6004);
+    V[0] = 0x04;
+L224: // E0A1 SKNP V0
+    STEP(0x224, 0xE0A1);
+    c->pc = 0x224;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x226) goto dispatch;
+L226: // 225E CALL 0x25E
+    STEP(0x226, 0x225E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x226;
+    goto L25E;
+L228: // 7002 ADD V0, 0x02
+    STEP(0x228, 0x7002);
+    V[0] += 0x02;
+L22A: // E0A1 SKNP V0
+    STEP(0x22A, 0xE0A1);
+    c->pc = 0x22A;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x22C) goto dispatch;
+L22C: // 2266 CALL 0x266
+    STEP(0x22C, 0x2266);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x22C;
+    goto L266;
+L22E: // 4601 SNE V6, 0x01
+    STEP(0x22E, 0x4601);
+    if (V[6] != 0x01) goto L232;
+L230: // 2248 CALL 0x248
+    STEP(0x230, 0x2248);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x230;
+    goto L248;
+L232: // 1212 JP 0x212
+    STEP(0x232, 0x1212);
+    goto L212;
+L234: // 228A CALL 0x28A
+    STEP(0x234, 0x228A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x234;
+    goto L28A;
+L236: // 6002 LD V0, 0x02
+    STEP(0x236, 0x6002);
+    V[0] = 0x02;
+L238: // F018 LD ST, V0
+    STEP(0x238, 0xF018);
+    c->st = V[0];
+L23A: // 229E CALL 0x29E
+    STEP(0x23A, 0x229E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x23A;
+    goto L29E;
+L23C: // 7DFF ADD VD, 0xFF
+    STEP(0x23C, 0x7DFF);
+    V[13] += 0xFF;
+L23E: // 229E CALL 0x29E
+    STEP(0x23E, 0x229E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x23E;
+    goto L29E;
+L240: // 4D00 SNE VD, 0x00
+    STEP(0x240, 0x4D00);
+    if (V[13] != 0x00) goto L244;
+L242: // 125C JP 0x25C
+    STEP(0x242, 0x125C);
+    goto L25C;
+L244: // 226E CALL 0x26E
+    STEP(0x244, 0x226E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x244;
+    goto L26E;
+L246: // 00EE RET
+    STEP(0x246, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L248: // 6005 LD V0, 0x05
+    STEP(0x248, 0x6005);
+    V[0] = 0x05;
+L24A: // F018 LD ST, V0
+    STEP(0x24A, 0xF018);
+    c->st = V[0];
+L24C: // 229E CALL 0x29E
+    STEP(0x24C, 0x229E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x24C;
+    goto L29E;
+L24E: // 7E01 ADD VE, 0x01
+    STEP(0x24E, 0x7E01);
+    V[14] += 0x01;
+L250: // 229E CALL 0x29E
+    STEP(0x250, 0x229E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x250;
+    goto L29E;
+L252: // 4E63 SNE VE, 0x63
+    STEP(0x252, 0x4E63);
+    if (V[14] != 0x63) goto L256;
+L254: // 125C JP 0x25C
+    STEP(0x254, 0x125C);
+    goto L25C;
+L256: // 228A CALL 0x28A
+    STEP(0x256, 0x228A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x256;
+    goto L28A;
+L258: // 226E CALL 0x26E
+    STEP(0x258, 0x226E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x258;
+    goto L26E;
+L25A: // 00EE RET
+    STEP(0x25A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L25C: // 125C JP 0x25C
+    STEP(0x25C, 0x125C);
+    goto L25C;
+L25E: // 2278 CALL 0x278
+    STEP(0x25E, 0x2278);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x25E;
+    goto L278;
+L260: // 7BFD ADD VB, 0xFD
+    STEP(0x260, 0x7BFD);
+    V[11] += 0xFD;
+L262: // 2278 CALL 0x278
+    STEP(0x262, 0x2278);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x262;
+    goto L278;
+L264: // 00EE RET
+    STEP(0x264, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L266: // 2278 CALL 0x278
+    STEP(0x266, 0x2278);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x266;
+    goto L278;
+L268: // 7B03 ADD VB, 0x03
+    STEP(0x268, 0x7B03);
+    V[11] += 0x03;
+L26A: // 2278 CALL 0x278
+    STEP(0x26A, 0x2278);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x26A;
+    goto L278;
+L26C: // 00EE RET
+    STEP(0x26C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L26E: // 6907 LD V9, 0x07
+    STEP(0x26E, 0x6907);
+    V[9] = 0x07;
+L270: // C83D RND V8, 0x3D
+    STEP(0x270, 0xC83D);
+    c->pc = 0x270;
+    predecode(0xC83D, &in);
+    execute(c, &in);
+    if (c->pc != 0x272) goto dispatch;
+L272: // 7802 ADD V8, 0x02
+    STEP(0x272, 0x7802);
+    V[8] += 0x02;
+L274: // D891 DRW V8, V9, 1
+    STEP(0x274, 0xD891);
+    c->pc = 0x274;
+    predecode(0xD891, &in);
+    execute(c, &in);
+    if (c->pc != 0x276) goto dispatch;
+L276: // 00EE RET
+    STEP(0x276, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L278: // A2BC LD I, 0x2BC
+    STEP(0x278, 0xA2BC);
+    c->I = 0x2BC;
+L27A: // DBC1 DRW VB, VC, 1
+    STEP(0x27A, 0xDBC1);
+    c->pc = 0x27A;
+    predecode(0xDBC1, &in);
+    execute(c, &in);
+    if (c->pc != 0x27C) goto dispatch;
+L27C: // A2BD LD I, 0x2BD
+    STEP(0x27C, 0xA2BD);
+    c->I = 0x2BD;
+L27E: // 00EE RET
+    STEP(0x27E, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L280: // 228A CALL 0x28A
+    STEP(0x280, 0x228A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x280;
+    goto L28A;
+L282: // 7901 ADD V9, 0x01
+    STEP(0x282, 0x7901);
+    V[9] += 0x01;
+L284: // 228A CALL 0x28A
+    STEP(0x284, 0x228A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x284;
+    goto L28A;
+L286: // 86F0 LD V6, VF
+    STEP(0x286, 0x86F0);
+    V[6] = V[15];
+L288: // 00EE RET
+    STEP(0x288, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L28A: // D891 DRW V8, V9, 1
+    STEP(0x28A, 0xD891);
+    c->pc = 0x28A;
+    predecode(0xD891, &in);
+    execute(c, &in);
+    if (c->pc != 0x28C) goto dispatch;
+L28C: // 00EE RET
+    STEP(0x28C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L28E: // 6306 LD V3, 0x06
+    STEP(0x28E, 0x6306);
+    V[3] = 0x06;
+L290: // 6400 LD V4, 0x00
+    STEP(0x290, 0x6400);
+    V[4] = 0x00;
+L292: // A2BE LD I, 0x2BE
+    STEP(0x292, 0xA2BE);
+    c->I = 0x2BE;
+L294: // D431 DRW V4, V3, 1
+    STEP(0x294, 0xD431);
+    c->pc = 0x294;
+    predecode(0xD431, &in);
+    execute(c, &in);
+    if (c->pc != 0x296) goto dispatch;
+L296: // 7408 ADD V4, 0x08
+    STEP(0x296, 0x7408);
+    V[4] += 0x08;
+L298: // 4440 SNE V4, 0x40
+    STEP(0x298, 0x4440);
+    if (V[4] != 0x40) goto L29C;
+L29A: // 00EE RET
+    STEP(0x29A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L29C: // 1294 JP 0x294
+    STEP(0x29C, 0x1294);
+    goto L294;
+L29E: // A2C0 LD I, 0x2C0
+    STEP(0x29E, 0xA2C0);
+    c->I = 0x2C0;
+L2A0: // 6337 LD V3, 0x37
+    STEP(0x2A0, 0x6337);
+    V[3] = 0x37;
+L2A2: // 6400 LD V4, 0x00
+    STEP(0x2A2, 0x6400);
+    V[4] = 0x00;
+L2A4: // FE33 LD B, VE
+    STEP(0x2A4, 0xFE33);
+    c->pc = 0x2A4;
+    predecode(0xFE33, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2A6) goto dispatch;
+L2A6: // F265 LD V2, [I]
+    STEP(0x2A6, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2A8: // F129 LD F, V1
+    STEP(0x2A8, 0xF129);
+    c->I = V[1] * 5;
+L2AA: // D345 DRW V3, V4, 5
+    STEP(0x2AA, 0xD345);
+    c->pc = 0x2AA;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2AC) goto dispatch;
+L2AC: // 7305 ADD V3, 0x05
+    STEP(0x2AC, 0x7305);
+    V[3] += 0x05;
+L2AE: // F229 LD F, V2
+    STEP(0x2AE, 0xF229);
+    c->I = V[2] * 5;
+L2B0: // D345 DRW V3, V4, 5
+    STEP(0x2B0, 0xD345);
+    c->pc = 0x2B0;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2B2) goto dispatch;
+L2B2: // 6300 LD V3, 0x00
+    STEP(0x2B2, 0x6300);
+    V[3] = 0x00;
+L2B4: // FD29 LD F, VD
+    STEP(0x2B4, 0xFD29);
+    c->I = V[13] * 5;
+L2B6: // D345 DRW V3, V4, 5
+    STEP(0x2B6, 0xD345);
+    c->pc = 0x2B6;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2B8) goto dispatch;
+L2B8: // A2BD LD I, 0x2BD
+    STEP(0x2B8, 0xA2BD);
+    c->I = 0x2BD;
+L2BA: // 00EE RET
+    STEP(0x2BA, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,301 @@
+// generated by chip8-aot from roms/GUESS.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x69, 0x00, 0x6E, 0x01, 0x00, 0xE0, 0x6D, 0x01, 0x6A, 0x01, 0x6B, 0x01,
+    0x8C, 0xD0, 0x8C, 0xE2, 0x4C, 0x00, 0x12, 0x22, 0x88, 0xD0, 0x22, 0x40,
+    0x3A, 0x40, 0x12, 0x22, 0x6A, 0x01, 0x7B, 0x06, 0x3C, 0x3F, 0x7D, 0x01,
+    0x3D, 0x3F, 0x12, 0x0C, 0xF0, 0x0A, 0x40, 0x05, 0x89, 0xE4, 0x8E, 0xE4,
+    0x3E, 0x40, 0x12, 0x04, 0x6A, 0x1C, 0x6B, 0x0D, 0x88, 0x90, 0x00, 0xE0,
+    0x22, 0x40, 0x12, 0x3E, 0xA2, 0x96, 0xF8, 0x33, 0xF2, 0x65, 0x22, 0x56,
+    0xDA, 0xB5, 0x7A, 0x04, 0x81, 0x20, 0x22, 0x56, 0xDA, 0xB5, 0x7A, 0x05,
+    0x00, 0xEE, 0x83, 0x10, 0x83, 0x34, 0x83, 0x34, 0x83, 0x14, 0xA2, 0x64,
+    0xF3, 0x1E, 0x00, 0xEE, 0xE0, 0xA0, 0xA0, 0xA0, 0xE0, 0x40, 0x40, 0x40,
+    0x40, 0x40, 0xE0, 0x20, 0xE0, 0x80, 0xE0, 0xE0, 0x20, 0xE0, 0x20, 0xE0,
+    0xA0, 0xA0, 0xE0, 0x20, 0x20, 0xE0, 0x80, 0xE0, 0x20, 0xE0, 0xE0, 0x80,
+    0xE0, 0xA0, 0xE0, 0xE0, 0x20, 0x20, 0x20, 0x20, 0xE0, 0xA0, 0xE0, 0xA0,
+    0xE0, 0xE0, 0xA0, 0xE0, 0x20, 0xE0,
+};
+const size_t aot_rom_size = 150;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000300ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 6900 LD V9, 0x00
+    STEP(0x200, 0x6900);
+    V[9] = 0x00;
+L202: // 6E01 LD VE, 0x01
+    STEP(0x202, 0x6E01);
+    V[14] = 0x01;
+L204: // 00E0 CLS
+    STEP(0x204, 0x00E0);
+    c->pc = 0x204;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x206) goto dispatch;
+L206: // 6D01 LD VD, 0x01
+    STEP(0x206, 0x6D01);
+    V[13] = 0x01;
+L208: // 6A01 LD VA, 0x01
+    STEP(0x208, 0x6A01);
+    V[10] = 0x01;
+L20A: // 6B01 LD VB, 0x01
+    STEP(0x20A, 0x6B01);
+    V[11] = 0x01;
+L20C: // 8CD0 LD VC, VD
+    STEP(0x20C, 0x8CD0);
+    V[12] = V[13];
+L20E: // 8CE2 AND VC, VE
+    STEP(0x20E, 0x8CE2);
+    V[12] &= V[14];
+L210: // 4C00 SNE VC, 0x00
+    STEP(0x210, 0x4C00);
+    if (V[12] != 0x00) goto L214;
+L212: // 1222 JP 0x222
+    STEP(0x212, 0x1222);
+    goto L222;
+L214: // 88D0 LD V8, VD
+    STEP(0x214, 0x88D0);
+    V[8] = V[13];
+L216: // 2240 CALL 0x240
+    STEP(0x216, 0x2240);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x216;
+    goto L240;
+L218: // 3A40 SE VA, 0x40
+    STEP(0x218, 0x3A40);
+    if (V[10] == 0x40) goto L21C;
+L21A: // 1222 JP 0x222
+    STEP(0x21A, 0x1222);
+    goto L222;
+L21C: // 6A01 LD VA, 0x01
+    STEP(0x21C, 0x6A01);
+    V[10] = 0x01;
+L21E: // 7B06 ADD VB, 0x06
+    STEP(0x21E, 0x7B06);
+    V[11] += 0x06;
+L220: // 3C3F SE VC, 0x3F
+    STEP(0x220, 0x3C3F);
+    if (V[12] == 0x3F) goto L224;
+L222: // 7D01 ADD VD, 0x01
+    STEP(0x222, 0x7D01);
+    V[13] += 0x01;
+L224: // 3D3F SE VD, 0x3F
+    STEP(0x224, 0x3D3F);
+    if (V[13] == 0x3F) goto L228;
+L226: // 120C JP 0x20C
+    STEP(0x226, 0x120C);
+    goto L20C;
+L228: // F00A LD V0, K
+    STEP(0x228, 0xF00A);
+    if (c->keypad == 0) {
+        c->pc = 0x228;
+        return cycles - left;
+    }
+    V[0] = __builtin_ctz(c->keypad);
+L22A: // 4005 SNE V0, 0x05
+    STEP(0x22A, 0x4005);
+    if (V[0] != 0x05) goto L22E;
+L22C: // 89E4 ADD V9, VE
+    STEP(0x22C, 0x89E4);
+    V[15] = V[9] + V[14] > 0xFF;
+    V[9] += V[14];
+L22E: // 8EE4 ADD VE, VE
+    STEP(0x22E, 0x8EE4);
+    V[15] = V[14] + V[14] > 0xFF;
+    V[14] += V[14];
+L230: // 3E40 SE VE, 0x40
+    STEP(0x230, 0x3E40);
+    if (V[14] == 0x40) goto L234;
+L232: // 1204 JP 0x204
+    STEP(0x232, 0x1204);
+    goto L204;
+L234: // 6A1C LD VA, 0x1C
+    STEP(0x234, 0x6A1C);
+    V[10] = 0x1C;
+L236: // 6B0D LD VB, 0x0D
+    STEP(0x236, 0x6B0D);
+    V[11] = 0x0D;
+L238: // 8890 LD V8, V9
+    STEP(0x238, 0x8890);
+    V[8] = V[9];
+L23A: // 00E0 CLS
+    STEP(0x23A, 0x00E0);
+    c->pc = 0x23A;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x23C) goto dispatch;
+L23C: // 2240 CALL 0x240
+    STEP(0x23C, 0x2240);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x23C;
+    goto L240;
+L23E: // 123E JP 0x23E
+    STEP(0x23E, 0x123E);
+    goto L23E;
+L240: // A296 LD I, 0x296
+    STEP(0x240, 0xA296);
+    c->I = 0x296;
+L242: // F833 LD B, V8
+    STEP(0x242, 0xF833);
+    c->pc = 0x242;
+    predecode(0xF833, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x244) goto dispatch;
+L244: // F265 LD V2, [I]
+    STEP(0x244, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L246: // 2256 CALL 0x256
+    STEP(0x246, 0x2256);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x246;
+    goto L256;
+L248: // DAB5 DRW VA, VB, 5
+    STEP(0x248, 0xDAB5);
+    c->pc = 0x248;
+    predecode(0xDAB5, &in);
+    execute(c, &in);
+    if (c->pc != 0x24A) goto dispatch;
+L24A: // 7A04 ADD VA, 0x04
+    STEP(0x24A, 0x7A04);
+    V[10] += 0x04;
+L24C: // 8120 LD V1, V2
+    STEP(0x24C, 0x8120);
+    V[1] = V[2];
+L24E: // 2256 CALL 0x256
+    STEP(0x24E, 0x2256);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x24E;
+    goto L256;
+L250: // DAB5 DRW VA, VB, 5
+    STEP(0x250, 0xDAB5);
+    c->pc = 0x250;
+    predecode(0xDAB5, &in);
+    execute(c, &in);
+    if (c->pc != 0x252) goto dispatch;
+L252: // 7A05 ADD VA, 0x05
+    STEP(0x252, 0x7A05);
+    V[10] += 0x05;
+L254: // 00EE RET
+    STEP(0x254, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L256: // 8310 LD V3, V1
+    STEP(0x256, 0x8310);
+    V[3] = V[1];
+L258: // 8334 ADD V3, V3
+    STEP(0x258, 0x8334);
+    V[15] = V[3] + V[3] > 0xFF;
+    V[3] += V[3];
+L25A: // 8334 ADD V3, V3
+    STEP(0x25A, 0x8334);
+    V[15] = V[3] + V[3] > 0xFF;
+    V[3] += V[3];
+L25C: // 8314 ADD V3, V1
+    STEP(0x25C, 0x8314);
+    V[15] = V[3] + V[1] > 0xFF;
+    V[3] += V[1];
+L25E: // A264 LD I, 0x264
+    STEP(0x25E, 0xA264);
+    c->I = 0x264;
+L260: // F31E ADD I, V3
+    STEP(0x260, 0xF31E);
+    c->I += V[3];
+L262: // 00EE RET
+    STEP(0x262, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
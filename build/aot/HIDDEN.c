@@ -0,0 +1,1354 @@
+// generated by chip8-aot from roms/HIDDEN.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x12, 0x1D, 0x48, 0x49, 0x44, 0x44, 0x45, 0x4E, 0x21, 0x20, 0x31, 0x2E,
+    0x30, 0x20, 0x42, 0x79, 0x20, 0x44, 0x61, 0x76, 0x69, 0x64, 0x20, 0x57,
+    0x49, 0x4E, 0x54, 0x45, 0x52, 0xA4, 0x3F, 0x60, 0x00, 0x61, 0x40, 0xF1,
+    0x55, 0xA4, 0x3F, 0x60, 0x00, 0xF0, 0x55, 0x00, 0xE0, 0xA4, 0x7E, 0x60,
+    0x0C, 0x61, 0x08, 0x62, 0x0F, 0xD0, 0x1F, 0x70, 0x08, 0xF2, 0x1E, 0x30,
+    0x34, 0x12, 0x35, 0xF0, 0x0A, 0x00, 0xE0, 0xA4, 0xC9, 0x60, 0x13, 0x61,
+    0x0D, 0x62, 0x04, 0xD0, 0x14, 0x70, 0x08, 0xF2, 0x1E, 0x30, 0x2B, 0x12,
+    0x4B, 0xA4, 0x1F, 0xFF, 0x65, 0xA4, 0x2F, 0xFF, 0x55, 0x63, 0x40, 0x66,
+    0x08, 0xC1, 0x0F, 0xC2, 0x0F, 0xA4, 0x2F, 0xF1, 0x1E, 0xF0, 0x65, 0x84,
+    0x00, 0xA4, 0x2F, 0xF2, 0x1E, 0xF0, 0x65, 0x85, 0x00, 0x80, 0x40, 0xF0,
+    0x55, 0xA4, 0x2F, 0xF1, 0x1E, 0x80, 0x50, 0xF0, 0x55, 0x73, 0xFF, 0x33,
+    0x00, 0x12, 0x61, 0x00, 0xE0, 0x60, 0x00, 0x61, 0x00, 0xA4, 0x77, 0xD0,
+    0x17, 0x70, 0x08, 0x30, 0x20, 0x12, 0x8F, 0x60, 0x00, 0x71, 0x08, 0x31,
+    0x20, 0x12, 0x8F, 0x6C, 0x00, 0x6D, 0x00, 0x6E, 0x00, 0xA4, 0x3F, 0xF0,
+    0x65, 0x70, 0x01, 0xF0, 0x55, 0x23, 0xB9, 0x6A, 0x10, 0x23, 0x5D, 0x23,
+    0xCD, 0x8A, 0x90, 0x87, 0xD0, 0x88, 0xE0, 0x23, 0x5D, 0x23, 0xCD, 0x23,
+    0xB9, 0xA4, 0x2F, 0xF9, 0x1E, 0xF0, 0x65, 0x81, 0x00, 0xA4, 0x2F, 0xFA,
+    0x1E, 0xF0, 0x65, 0x50, 0x10, 0x13, 0x2B, 0x23, 0xDF, 0x60, 0x20, 0x24,
+    0x01, 0x23, 0xDF, 0x60, 0x00, 0xA4, 0x2F, 0xF9, 0x1E, 0xF0, 0x55, 0xA4,
+    0x2F, 0xFA, 0x1E, 0xF0, 0x55, 0x76, 0xFF, 0x36, 0x00, 0x12, 0xA5, 0xA4,
+    0x3F, 0xF1, 0x65, 0x82, 0x00, 0x80, 0x15, 0x3F, 0x00, 0x13, 0x01, 0x80,
+    0x20, 0x81, 0x20, 0xF1, 0x55, 0x00, 0xE0, 0xA5, 0x19, 0x60, 0x10, 0x61,
+    0x07, 0x62, 0x0E, 0xD0, 0x1F, 0x70, 0x08, 0xF2, 0x1E, 0x30, 0x30, 0x13,
+    0x0B, 0xA4, 0x3F, 0xF1, 0x65, 0x84, 0x10, 0x83, 0x00, 0x66, 0x09, 0x24,
+    0x0B, 0x66, 0x0F, 0x83, 0x40, 0x24, 0x0B, 0xF0, 0x0A, 0x12, 0x25, 0x23,
+    0xDB, 0x60, 0x80, 0x24, 0x01, 0x23, 0xDB, 0xA4, 0x2F, 0xFA, 0x1E, 0xF0,
+    0x65, 0x70, 0xFF, 0x23, 0xF3, 0xA4, 0x41, 0xF0, 0x1E, 0xD7, 0x87, 0xA4,
+    0x77, 0xD7, 0x87, 0xA4, 0x2F, 0xF9, 0x1E, 0xF0, 0x65, 0x70, 0xFF, 0x23,
+    0xF3, 0xA4, 0x41, 0xF0, 0x1E, 0xDD, 0xE7, 0xA4, 0x77, 0xDD, 0xE7, 0x12,
+    0xA5, 0xA4, 0x71, 0xDD, 0xE7, 0xFB, 0x0A, 0xDD, 0xE7, 0x3B, 0x04, 0x13,
+    0x71, 0x4D, 0x00, 0x13, 0x5D, 0x7D, 0xF8, 0x7C, 0xFF, 0x3B, 0x06, 0x13,
+    0x7D, 0x4D, 0x18, 0x13, 0x5D, 0x7D, 0x08, 0x7C, 0x01, 0x3B, 0x02, 0x13,
+    0x89, 0x4E, 0x00, 0x13, 0x5D, 0x7E, 0xF8, 0x7C, 0xFC, 0x3B, 0x08, 0x13,
+    0x95, 0x4E, 0x18, 0x13, 0x5D, 0x7E, 0x08, 0x7C, 0x04, 0x3B, 0x05, 0x13,
+    0x5D, 0xA4, 0x2F, 0xFC, 0x1E, 0xF0, 0x65, 0x40, 0x00, 0x13, 0x5D, 0x89,
+    0xC0, 0x99, 0xA0, 0x13, 0x5D, 0x70, 0xFF, 0xA4, 0x77, 0xDD, 0xE7, 0xA4,
+    0x41, 0x23, 0xF3, 0xF0, 0x1E, 0xDD, 0xE7, 0x00, 0xEE, 0xA4, 0xD5, 0x60,
+    0x24, 0x61, 0x0A, 0x62, 0x0B, 0xD0, 0x1B, 0x70, 0x08, 0xF2, 0x1E, 0x30,
+    0x3C, 0x13, 0xC1, 0x00, 0xEE, 0x60, 0x34, 0x61, 0x10, 0xA4, 0xF1, 0xD0,
+    0x15, 0xA4, 0xF6, 0xD0, 0x15, 0x00, 0xEE, 0xA4, 0xFB, 0x13, 0xE1, 0xA5,
+    0x0A, 0x60, 0x24, 0x61, 0x0D, 0x62, 0x05, 0xD0, 0x15, 0x70, 0x08, 0xF2,
+    0x1E, 0x30, 0x3C, 0x13, 0xE7, 0x00, 0xEE, 0x81, 0x00, 0x81, 0x14, 0x80,
+    0x04, 0x80, 0x04, 0x80, 0x04, 0x80, 0x15, 0x00, 0xEE, 0xF0, 0x15, 0xF0,
+    0x07, 0x30, 0x00, 0x14, 0x03, 0x00, 0xEE, 0xA4, 0x2F, 0xF3, 0x33, 0xF2,
+    0x65, 0x65, 0x23, 0xF1, 0x29, 0xD5, 0x65, 0x65, 0x28, 0xF2, 0x29, 0xD5,
+    0x65, 0x00, 0xEE, 0x01, 0x02, 0x03, 0x04, 0x08, 0x07, 0x06, 0x05, 0x05,
+    0x06, 0x07, 0x08, 0x04, 0x03, 0x02, 0x01, 0x01, 0x02, 0x03, 0x04, 0x08,
+    0x07, 0x06, 0x05, 0x05, 0x06, 0x07, 0x08, 0x04, 0x03, 0x02, 0x01, 0x00,
+    0x00, 0xFE, 0xEE, 0xC6, 0x82, 0xC6, 0xEE, 0xFE, 0xFE, 0xC6, 0xC6, 0xC6,
+    0xFE, 0xFE, 0xC6, 0xAA, 0x82, 0xAA, 0xC6, 0xFE, 0xC6, 0x82, 0x82, 0x82,
+    0xC6, 0xFE, 0xBA, 0xD6, 0xEE, 0xD6, 0xBA, 0xFE, 0xEE, 0xEE, 0x82, 0xEE,
+    0xEE, 0xFE, 0x82, 0xFE, 0x82, 0xFE, 0x82, 0xFE, 0xAA, 0xAA, 0xAA, 0xAA,
+    0xAA, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xFE, 0xAA, 0xD6, 0xAA, 0xD6,
+    0xAA, 0xFE, 0x8B, 0x88, 0xF8, 0x88, 0x8B, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xF0, 0x48, 0x48, 0x48, 0xF2, 0xEF, 0x84, 0x84, 0x84, 0xEF, 0x00, 0x08,
+    0x08, 0x0A, 0x00, 0x8A, 0x8A, 0xAA, 0xAA, 0x52, 0x3C, 0x92, 0x92, 0x92,
+    0x3C, 0x00, 0xE2, 0xA3, 0xE3, 0x00, 0x8B, 0xC8, 0xA8, 0x98, 0x88, 0xFA,
+    0x83, 0xE2, 0x82, 0xFA, 0x00, 0x28, 0xB8, 0x90, 0x00, 0xEF, 0x88, 0x8E,
+    0x88, 0x8F, 0x21, 0x21, 0xA1, 0x60, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0xBC, 0x22, 0x3C, 0x28, 0xA4, 0x89, 0x8A, 0xAB, 0x52, 0x97, 0x51, 0xD1,
+    0x51, 0xC0, 0x00, 0x00, 0x15, 0x6A, 0x8A, 0x8E, 0x8A, 0x6A, 0x00, 0x64,
+    0x8A, 0x8E, 0x8A, 0x6A, 0x44, 0xAA, 0xAA, 0xAA, 0x44, 0x00, 0xCC, 0xAA,
+    0xCA, 0xAA, 0xAC, 0x6E, 0x88, 0x4C, 0x28, 0xCE, 0x00, 0x04, 0x0C, 0x04,
+    0x04, 0x0E, 0x0C, 0x12, 0x04, 0x08, 0x1E, 0x63, 0x94, 0x94, 0x94, 0x63,
+    0x38, 0xA5, 0xB8, 0xA0, 0x21, 0xE1, 0x01, 0xC1, 0x20, 0xC1, 0x89, 0x8A,
+    0x52, 0x22, 0x21, 0xCF, 0x28, 0x2F, 0x28, 0xC8, 0x02, 0x82, 0x02, 0x00,
+    0x02, 0xFF, 0x80, 0x8F, 0x90, 0x8E, 0x81, 0x9E, 0x80, 0x91, 0x91, 0x9F,
+    0x91, 0x91, 0x80, 0xFF, 0x00, 0x3C, 0x40, 0x40, 0x40, 0x3C, 0x00, 0x7C,
+    0x10, 0x10, 0x10, 0x7C, 0x00, 0xFF, 0x00, 0x00, 0x80, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x80, 0x00, 0x80, 0x00, 0x00, 0xFF, 0x01, 0x01, 0x01, 0x01,
+    0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0xFF,
+};
+const size_t aot_rom_size = 850;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x000000000001FF00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x21D: goto L21D;
+        case 0x21F: goto L21F;
+        case 0x221: goto L221;
+        case 0x223: goto L223;
+        case 0x225: goto L225;
+        case 0x227: goto L227;
+        case 0x229: goto L229;
+        case 0x22B: goto L22B;
+        case 0x22D: goto L22D;
+        case 0x22F: goto L22F;
+        case 0x231: goto L231;
+        case 0x233: goto L233;
+        case 0x235: goto L235;
+        case 0x237: goto L237;
+        case 0x239: goto L239;
+        case 0x23B: goto L23B;
+        case 0x23D: goto L23D;
+        case 0x23F: goto L23F;
+        case 0x241: goto L241;
+        case 0x243: goto L243;
+        case 0x245: goto L245;
+        case 0x247: goto L247;
+        case 0x249: goto L249;
+        case 0x24B: goto L24B;
+        case 0x24D: goto L24D;
+        case 0x24F: goto L24F;
+        case 0x251: goto L251;
+        case 0x253: goto L253;
+        case 0x255: goto L255;
+        case 0x257: goto L257;
+        case 0x259: goto L259;
+        case 0x25B: goto L25B;
+        case 0x25D: goto L25D;
+        case 0x25F: goto L25F;
+        case 0x261: goto L261;
+        case 0x263: goto L263;
+        case 0x265: goto L265;
+        case 0x267: goto L267;
+        case 0x269: goto L269;
+        case 0x26B: goto L26B;
+        case 0x26D: goto L26D;
+        case 0x26F: goto L26F;
+        case 0x271: goto L271;
+        case 0x273: goto L273;
+        case 0x275: goto L275;
+        case 0x277: goto L277;
+        case 0x279: goto L279;
+        case 0x27B: goto L27B;
+        case 0x27D: goto L27D;
+        case 0x27F: goto L27F;
+        case 0x281: goto L281;
+        case 0x283: goto L283;
+        case 0x285: goto L285;
+        case 0x287: goto L287;
+        case 0x289: goto L289;
+        case 0x28B: goto L28B;
+        case 0x28D: goto L28D;
+        case 0x28F: goto L28F;
+        case 0x291: goto L291;
+        case 0x293: goto L293;
+        case 0x295: goto L295;
+        case 0x297: goto L297;
+        case 0x299: goto L299;
+        case 0x29B: goto L29B;
+        case 0x29D: goto L29D;
+        case 0x29F: goto L29F;
+        case 0x2A1: goto L2A1;
+        case 0x2A3: goto L2A3;
+        case 0x2A5: goto L2A5;
+        case 0x2A7: goto L2A7;
+        case 0x2A9: goto L2A9;
+        case 0x2AB: goto L2AB;
+        case 0x2AD: goto L2AD;
+        case 0x2AF: goto L2AF;
+        case 0x2B1: goto L2B1;
+        case 0x2B3: goto L2B3;
+        case 0x2B5: goto L2B5;
+        case 0x2B7: goto L2B7;
+        case 0x2B9: goto L2B9;
+        case 0x2BB: goto L2BB;
+        case 0x2BD: goto L2BD;
+        case 0x2BF: goto L2BF;
+        case 0x2C1: goto L2C1;
+        case 0x2C3: goto L2C3;
+        case 0x2C5: goto L2C5;
+        case 0x2C7: goto L2C7;
+        case 0x2C9: goto L2C9;
+        case 0x2CB: goto L2CB;
+        case 0x2CD: goto L2CD;
+        case 0x2CF: goto L2CF;
+        case 0x2D1: goto L2D1;
+        case 0x2D3: goto L2D3;
+        case 0x2D5: goto L2D5;
+        case 0x2D7: goto L2D7;
+        case 0x2D9: goto L2D9;
+        case 0x2DB: goto L2DB;
+        case 0x2DD: goto L2DD;
+        case 0x2DF: goto L2DF;
+        case 0x2E1: goto L2E1;
+        case 0x2E3: goto L2E3;
+        case 0x2E5: goto L2E5;
+        case 0x2E7: goto L2E7;
+        case 0x2E9: goto L2E9;
+        case 0x2EB: goto L2EB;
+        case 0x2ED: goto L2ED;
+        case 0x2EF: goto L2EF;
+        case 0x2F1: goto L2F1;
+        case 0x2F3: goto L2F3;
+        case 0x2F5: goto L2F5;
+        case 0x2F7: goto L2F7;
+        case 0x2F9: goto L2F9;
+        case 0x2FB: goto L2FB;
+        case 0x2FD: goto L2FD;
+        case 0x2FF: goto L2FF;
+        case 0x301: goto L301;
+        case 0x303: goto L303;
+        case 0x305: goto L305;
+        case 0x307: goto L307;
+        case 0x309: goto L309;
+        case 0x30B: goto L30B;
+        case 0x30D: goto L30D;
+        case 0x30F: goto L30F;
+        case 0x311: goto L311;
+        case 0x313: goto L313;
+        case 0x315: goto L315;
+        case 0x317: goto L317;
+        case 0x319: goto L319;
+        case 0x31B: goto L31B;
+        case 0x31D: goto L31D;
+        case 0x31F: goto L31F;
+        case 0x321: goto L321;
+        case 0x323: goto L323;
+        case 0x325: goto L325;
+        case 0x327: goto L327;
+        case 0x329: goto L329;
+        case 0x32B: goto L32B;
+        case 0x32D: goto L32D;
+        case 0x32F: goto L32F;
+        case 0x331: goto L331;
+        case 0x333: goto L333;
+        case 0x335: goto L335;
+        case 0x337: goto L337;
+        case 0x339: goto L339;
+        case 0x33B: goto L33B;
+        case 0x33D: goto L33D;
+        case 0x33F: goto L33F;
+        case 0x341: goto L341;
+        case 0x343: goto L343;
+        case 0x345: goto L345;
+        case 0x347: goto L347;
+        case 0x349: goto L349;
+        case 0x34B: goto L34B;
+        case 0x34D: goto L34D;
+        case 0x34F: goto L34F;
+        case 0x351: goto L351;
+        case 0x353: goto L353;
+        case 0x355: goto L355;
+        case 0x357: goto L357;
+        case 0x359: goto L359;
+        case 0x35B: goto L35B;
+        case 0x35D: goto L35D;
+        case 0x35F: goto L35F;
+        case 0x361: goto L361;
+        case 0x363: goto L363;
+        case 0x365: goto L365;
+        case 0x367: goto L367;
+        case 0x369: goto L369;
+        case 0x36B: goto L36B;
+        case 0x36D: goto L36D;
+        case 0x36F: goto L36F;
+        case 0x371: goto L371;
+        case 0x373: goto L373;
+        case 0x375: goto L375;
+        case 0x377: goto L377;
+        case 0x379: goto L379;
+        case 0x37B: goto L37B;
+        case 0x37D: goto L37D;
+        case 0x37F: goto L37F;
+        case 0x381: goto L381;
+        case 0x383: goto L383;
+        case 0x385: goto L385;
+        case 0x387: goto L387;
+        case 0x389: goto L389;
+        case 0x38B: goto L38B;
+        case 0x38D: goto L38D;
+        case 0x38F: goto L38F;
+        case 0x391: goto L391;
+        case 0x393: goto L393;
+        case 0x395: goto L395;
+        case 0x397: goto L397;
+        case 0x399: goto L399;
+        case 0x39B: goto L39B;
+        case 0x39D: goto L39D;
+        case 0x39F: goto L39F;
+        case 0x3A1: goto L3A1;
+        case 0x3A3: goto L3A3;
+        case 0x3A5: goto L3A5;
+        case 0x3A7: goto L3A7;
+        case 0x3A9: goto L3A9;
+        case 0x3AB: goto L3AB;
+        case 0x3AD: goto L3AD;
+        case 0x3AF: goto L3AF;
+        case 0x3B1: goto L3B1;
+        case 0x3B3: goto L3B3;
+        case 0x3B5: goto L3B5;
+        case 0x3B7: goto L3B7;
+        case 0x3B9: goto L3B9;
+        case 0x3BB: goto L3BB;
+        case 0x3BD: goto L3BD;
+        case 0x3BF: goto L3BF;
+        case 0x3C1: goto L3C1;
+        case 0x3C3: goto L3C3;
+        case 0x3C5: goto L3C5;
+        case 0x3C7: goto L3C7;
+        case 0x3C9: goto L3C9;
+        case 0x3CB: goto L3CB;
+        case 0x3CD: goto L3CD;
+        case 0x3CF: goto L3CF;
+        case 0x3D1: goto L3D1;
+        case 0x3D3: goto L3D3;
+        case 0x3D5: goto L3D5;
+        case 0x3D7: goto L3D7;
+        case 0x3D9: goto L3D9;
+        case 0x3DB: goto L3DB;
+        case 0x3DD: goto L3DD;
+        case 0x3DF: goto L3DF;
+        case 0x3E1: goto L3E1;
+        case 0x3E3: goto L3E3;
+        case 0x3E5: goto L3E5;
+        case 0x3E7: goto L3E7;
+        case 0x3E9: goto L3E9;
+        case 0x3EB: goto L3EB;
+        case 0x3ED: goto L3ED;
+        case 0x3EF: goto L3EF;
+        case 0x3F1: goto L3F1;
+        case 0x3F3: goto L3F3;
+        case 0x3F5: goto L3F5;
+        case 0x3F7: goto L3F7;
+        case 0x3F9: goto L3F9;
+        case 0x3FB: goto L3FB;
+        case 0x3FD: goto L3FD;
+        case 0x3FF: goto L3FF;
+        case 0x401: goto L401;
+        case 0x403: goto L403;
+        case 0x405: goto L405;
+        case 0x407: goto L407;
+        case 0x409: goto L409;
+        case 0x40B: goto L40B;
+        case 0x40D: goto L40D;
+        case 0x40F: goto L40F;
+        case 0x411: goto L411;
+        case 0x413: goto L413;
+        case 0x415: goto L415;
+        case 0x417: goto L417;
+        case 0x419: goto L419;
+        case 0x41B: goto L41B;
+        case 0x41D: goto L41D;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 121D JP 0x21D
+    STEP(0x200, 0x121D);
+    goto L21D;
+L21D: // A43F LD I, 0x43F
+    STEP(0x21D, 0xA43F);
+    c->I = 0x43F;
+L21F: // 6000 LD V0, 0x00
+    STEP(0x21F, 0x6000);
+    V[0] = 0x00;
+L221: // 6140 LD V1, 0x40
+    STEP(0x221, 0x6140);
+    V[1] = 0x40;
+L223: // F155 LD [I], V1
+    STEP(0x223, 0xF155);
+    c->pc = 0x223;
+    predecode(0xF155, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x225) goto dispatch;
+L225: // A43F LD I, 0x43F
+    STEP(0x225, 0xA43F);
+    c->I = 0x43F;
+L227: // 6000 LD V0, 0x00
+    STEP(0x227, 0x6000);
+    V[0] = 0x00;
+L229: // F055 LD [I], V0
+    STEP(0x229, 0xF055);
+    c->pc = 0x229;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x22B) goto dispatch;
+L22B: // 00E0 CLS
+    STEP(0x22B, 0x00E0);
+    c->pc = 0x22B;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x22D) goto dispatch;
+L22D: // A47E LD I, 0x47E
+    STEP(0x22D, 0xA47E);
+    c->I = 0x47E;
+L22F: // 600C LD V0, 0x0C
+    STEP(0x22F, 0x600C);
+    V[0] = 0x0C;
+L231: // 6108 LD V1, 0x08
+    STEP(0x231, 0x6108);
+    V[1] = 0x08;
+L233: // 620F LD V2, 0x0F
+    STEP(0x233, 0x620F);
+    V[2] = 0x0F;
+L235: // D01F DRW V0, V1, 15
+    STEP(0x235, 0xD01F);
+    c->pc = 0x235;
+    predecode(0xD01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x237) goto dispatch;
+L237: // 7008 ADD V0, 0x08
+    STEP(0x237, 0x7008);
+    V[0] += 0x08;
+L239: // F21E ADD I, V2
+    STEP(0x239, 0xF21E);
+    c->I += V[2];
+L23B: // 3034 SE V0, 0x34
+    STEP(0x23B, 0x3034);
+    if (V[0] == 0x34) goto L23F;
+L23D: // 1235 JP 0x235
+    STEP(0x23D, 0x1235);
+    goto L235;
+L23F: // F00A LD V0, K
+    STEP(0x23F, 0xF00A);
+    if (c->keypad == 0) {
+        c->pc = 0x23F;
+        return cycles - left;
+    }
+    V[0] = __builtin_ctz(c->keypad);
+L241: // 00E0 CLS
+    STEP(0x241, 0x00E0);
+    c->pc = 0x241;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x243) goto dispatch;
+L243: // A4C9 LD I, 0x4C9
+    STEP(0x243, 0xA4C9);
+    c->I = 0x4C9;
+L245: // 6013 LD V0, 0x13
+    STEP(0x245, 0x6013);
+    V[0] = 0x13;
+L247: // 610D LD V1, 0x0D
+    STEP(0x247, 0x610D);
+    V[1] = 0x0D;
+L249: // 6204 LD V2, 0x04
+    STEP(0x249, 0x6204);
+    V[2] = 0x04;
+L24B: // D014 DRW V0, V1, 4
+    STEP(0x24B, 0xD014);
+    c->pc = 0x24B;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x24D) goto dispatch;
+L24D: // 7008 ADD V0, 0x08
+    STEP(0x24D, 0x7008);
+    V[0] += 0x08;
+L24F: // F21E ADD I, V2
+    STEP(0x24F, 0xF21E);
+    c->I += V[2];
+L251: // 302B SE V0, 0x2B
+    STEP(0x251, 0x302B);
+    if (V[0] == 0x2B) goto L255;
+L253: // 124B JP 0x24B
+    STEP(0x253, 0x124B);
+    goto L24B;
+L255: // A41F LD I, 0x41F
+    STEP(0x255, 0xA41F);
+    c->I = 0x41F;
+L257: // FF65 LD VF, [I]
+    STEP(0x257, 0xFF65);
+    for (int i = 0; i <= 15; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L259: // A42F LD I, 0x42F
+    STEP(0x259, 0xA42F);
+    c->I = 0x42F;
+L25B: // FF55 LD [I], VF
+    STEP(0x25B, 0xFF55);
+    c->pc = 0x25B;
+    predecode(0xFF55, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x25D) goto dispatch;
+L25D: // 6340 LD V3, 0x40
+    STEP(0x25D, 0x6340);
+    V[3] = 0x40;
+L25F: // 6608 LD V6, 0x08
+    STEP(0x25F, 0x6608);
+    V[6] = 0x08;
+L261: // C10F RND V1, 0x0F
+    STEP(0x261, 0xC10F);
+    c->pc = 0x261;
+    predecode(0xC10F, &in);
+    execute(c, &in);
+    if (c->pc != 0x263) goto dispatch;
+L263: // C20F RND V2, 0x0F
+    STEP(0x263, 0xC20F);
+    c->pc = 0x263;
+    predecode(0xC20F, &in);
+    execute(c, &in);
+    if (c->pc != 0x265) goto dispatch;
+L265: // A42F LD I, 0x42F
+    STEP(0x265, 0xA42F);
+    c->I = 0x42F;
+L267: // F11E ADD I, V1
+    STEP(0x267, 0xF11E);
+    c->I += V[1];
+L269: // F065 LD V0, [I]
+    STEP(0x269, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L26B: // 8400 LD V4, V0
+    STEP(0x26B, 0x8400);
+    V[4] = V[0];
+L26D: // A42F LD I, 0x42F
+    STEP(0x26D, 0xA42F);
+    c->I = 0x42F;
+L26F: // F21E ADD I, V2
+    STEP(0x26F, 0xF21E);
+    c->I += V[2];
+L271: // F065 LD V0, [I]
+    STEP(0x271, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L273: // 8500 LD V5, V0
+    STEP(0x273, 0x8500);
+    V[5] = V[0];
+L275: // 8040 LD V0, V4
+    STEP(0x275, 0x8040);
+    V[0] = V[4];
+L277: // F055 LD [I], V0
+    STEP(0x277, 0xF055);
+    c->pc = 0x277;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x279) goto dispatch;
+L279: // A42F LD I, 0x42F
+    STEP(0x279, 0xA42F);
+    c->I = 0x42F;
+L27B: // F11E ADD I, V1
+    STEP(0x27B, 0xF11E);
+    c->I += V[1];
+L27D: // 8050 LD V0, V5
+    STEP(0x27D, 0x8050);
+    V[0] = V[5];
+L27F: // F055 LD [I], V0
+    STEP(0x27F, 0xF055);
+    c->pc = 0x27F;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x281) goto dispatch;
+L281: // 73FF ADD V3, 0xFF
+    STEP(0x281, 0x73FF);
+    V[3] += 0xFF;
+L283: // 3300 SE V3, 0x00
+    STEP(0x283, 0x3300);
+    if (V[3] == 0x00) goto L287;
+L285: // 1261 JP 0x261
+    STEP(0x285, 0x1261);
+    goto L261;
+L287: // 00E0 CLS
+    STEP(0x287, 0x00E0);
+    c->pc = 0x287;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x289) goto dispatch;
+L289: // 6000 LD V0, 0x00
+    STEP(0x289, 0x6000);
+    V[0] = 0x00;
+L28B: // 6100 LD V1, 0x00
+    STEP(0x28B, 0x6100);
+    V[1] = 0x00;
+L28D: // A477 LD I, 0x477
+    STEP(0x28D, 0xA477);
+    c->I = 0x477;
+L28F: // D017 DRW V0, V1, 7
+    STEP(0x28F, 0xD017);
+    c->pc = 0x28F;
+    predecode(0xD017, &in);
+    execute(c, &in);
+    if (c->pc != 0x291) goto dispatch;
+L291: // 7008 ADD V0, 0x08
+    STEP(0x291, 0x7008);
+    V[0] += 0x08;
+L293: // 3020 SE V0, 0x20
+    STEP(0x293, 0x3020);
+    if (V[0] == 0x20) goto L297;
+L295: // 128F JP 0x28F
+    STEP(0x295, 0x128F);
+    goto L28F;
+L297: // 6000 LD V0, 0x00
+    STEP(0x297, 0x6000);
+    V[0] = 0x00;
+L299: // 7108 ADD V1, 0x08
+    STEP(0x299, 0x7108);
+    V[1] += 0x08;
+L29B: // 3120 SE V1, 0x20
+    STEP(0x29B, 0x3120);
+    if (V[1] == 0x20) goto L29F;
+L29D: // 128F JP 0x28F
+    STEP(0x29D, 0x128F);
+    goto L28F;
+L29F: // 6C00 LD VC, 0x00
+    STEP(0x29F, 0x6C00);
+    V[12] = 0x00;
+L2A1: // 6D00 LD VD, 0x00
+    STEP(0x2A1, 0x6D00);
+    V[13] = 0x00;
+L2A3: // 6E00 LD VE, 0x00
+    STEP(0x2A3, 0x6E00);
+    V[14] = 0x00;
+L2A5: // A43F LD I, 0x43F
+    STEP(0x2A5, 0xA43F);
+    c->I = 0x43F;
+L2A7: // F065 LD V0, [I]
+    STEP(0x2A7, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2A9: // 7001 ADD V0, 0x01
+    STEP(0x2A9, 0x7001);
+    V[0] += 0x01;
+L2AB: // F055 LD [I], V0
+    STEP(0x2AB, 0xF055);
+    c->pc = 0x2AB;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2AD) goto dispatch;
+L2AD: // 23B9 CALL 0x3B9
+    STEP(0x2AD, 0x23B9);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2AD;
+    goto L3B9;
+L2AF: // 6A10 LD VA, 0x10
+    STEP(0x2AF, 0x6A10);
+    V[10] = 0x10;
+L2B1: // 235D CALL 0x35D
+    STEP(0x2B1, 0x235D);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2B1;
+    goto L35D;
+L2B3: // 23CD CALL 0x3CD
+    STEP(0x2B3, 0x23CD);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2B3;
+    goto L3CD;
+L2B5: // 8A90 LD VA, V9
+    STEP(0x2B5, 0x8A90);
+    V[10] = V[9];
+L2B7: // 87D0 LD V7, VD
+    STEP(0x2B7, 0x87D0);
+    V[7] = V[13];
+L2B9: // 88E0 LD V8, VE
+    STEP(0x2B9, 0x88E0);
+    V[8] = V[14];
+L2BB: // 235D CALL 0x35D
+    STEP(0x2BB, 0x235D);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2BB;
+    goto L35D;
+L2BD: // 23CD CALL 0x3CD
+    STEP(0x2BD, 0x23CD);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2BD;
+    goto L3CD;
+L2BF: // 23B9 CALL 0x3B9
+    STEP(0x2BF, 0x23B9);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2BF;
+    goto L3B9;
+L2C1: // A42F LD I, 0x42F
+    STEP(0x2C1, 0xA42F);
+    c->I = 0x42F;
+L2C3: // F91E ADD I, V9
+    STEP(0x2C3, 0xF91E);
+    c->I += V[9];
+L2C5: // F065 LD V0, [I]
+    STEP(0x2C5, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2C7: // 8100 LD V1, V0
+    STEP(0x2C7, 0x8100);
+    V[1] = V[0];
+L2C9: // A42F LD I, 0x42F
+    STEP(0x2C9, 0xA42F);
+    c->I = 0x42F;
+L2CB: // FA1E ADD I, VA
+    STEP(0x2CB, 0xFA1E);
+    c->I += V[10];
+L2CD: // F065 LD V0, [I]
+    STEP(0x2CD, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2CF: // 5010 SE V0, V1
+    STEP(0x2CF, 0x5010);
+    if (V[0] == V[1]) goto L2D3;
+L2D1: // 132B JP 0x32B
+    STEP(0x2D1, 0x132B);
+    goto L32B;
+L2D3: // 23DF CALL 0x3DF
+    STEP(0x2D3, 0x23DF);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2D3;
+    goto L3DF;
+L2D5: // 6020 LD V0, 0x20
+    STEP(0x2D5, 0x6020);
+    V[0] = 0x20;
+L2D7: // 2401 CALL 0x401
+    STEP(0x2D7, 0x2401);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2D7;
+    goto L401;
+L2D9: // 23DF CALL 0x3DF
+    STEP(0x2D9, 0x23DF);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2D9;
+    goto L3DF;
+L2DB: // 6000 LD V0, 0x00
+    STEP(0x2DB, 0x6000);
+    V[0] = 0x00;
+L2DD: // A42F LD I, 0x42F
+    STEP(0x2DD, 0xA42F);
+    c->I = 0x42F;
+L2DF: // F91E ADD I, V9
+    STEP(0x2DF, 0xF91E);
+    c->I += V[9];
+L2E1: // F055 LD [I], V0
+    STEP(0x2E1, 0xF055);
+    c->pc = 0x2E1;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2E3) goto dispatch;
+L2E3: // A42F LD I, 0x42F
+    STEP(0x2E3, 0xA42F);
+    c->I = 0x42F;
+L2E5: // FA1E ADD I, VA
+    STEP(0x2E5, 0xFA1E);
+    c->I += V[10];
+L2E7: // F055 LD [I], V0
+    STEP(0x2E7, 0xF055);
+    c->pc = 0x2E7;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2E9) goto dispatch;
+L2E9: // 76FF ADD V6, 0xFF
+    STEP(0x2E9, 0x76FF);
+    V[6] += 0xFF;
+L2EB: // 3600 SE V6, 0x00
+    STEP(0x2EB, 0x3600);
+    if (V[6] == 0x00) goto L2EF;
+L2ED: // 12A5 JP 0x2A5
+    STEP(0x2ED, 0x12A5);
+    goto L2A5;
+L2EF: // A43F LD I, 0x43F
+    STEP(0x2EF, 0xA43F);
+    c->I = 0x43F;
+L2F1: // F165 LD V1, [I]
+    STEP(0x2F1, 0xF165);
+    for (int i = 0; i <= 1; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2F3: // 8200 LD V2, V0
+    STEP(0x2F3, 0x8200);
+    V[2] = V[0];
+L2F5: // 8015 SUB V0, V1
+    STEP(0x2F5, 0x8015);
+    V[15] = V[0] > V[1];
+    V[0] -= V[1];
+L2F7: // 3F00 SE VF, 0x00
+    STEP(0x2F7, 0x3F00);
+    if (V[15] == 0x00) goto L2FB;
+L2F9: // 1301 JP 0x301
+    STEP(0x2F9, 0x1301);
+    goto L301;
+L2FB: // 8020 LD V0, V2
+    STEP(0x2FB, 0x8020);
+    V[0] = V[2];
+L2FD: // 8120 LD V1, V2
+    STEP(0x2FD, 0x8120);
+    V[1] = V[2];
+L2FF: // F155 LD [I], V1
+    STEP(0x2FF, 0xF155);
+    c->pc = 0x2FF;
+    predecode(0xF155, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x301) goto dispatch;
+L301: // 00E0 CLS
+    STEP(0x301, 0x00E0);
+    c->pc = 0x301;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x303) goto dispatch;
+L303: // A519 LD I, 0x519
+    STEP(0x303, 0xA519);
+    c->I = 0x519;
+L305: // 6010 LD V0, 0x10
+    STEP(0x305, 0x6010);
+    V[0] = 0x10;
+L307: // 6107 LD V1, 0x07
+    STEP(0x307, 0x6107);
+    V[1] = 0x07;
+L309: // 620E LD V2, 0x0E
+    STEP(0x309, 0x620E);
+    V[2] = 0x0E;
+L30B: // D01F DRW V0, V1, 15
+    STEP(0x30B, 0xD01F);
+    c->pc = 0x30B;
+    predecode(0xD01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x30D) goto dispatch;
+L30D: // 7008 ADD V0, 0x08
+    STEP(0x30D, 0x7008);
+    V[0] += 0x08;
+L30F: // F21E ADD I, V2
+    STEP(0x30F, 0xF21E);
+    c->I += V[2];
+L311: // 3030 SE V0, 0x30
+    STEP(0x311, 0x3030);
+    if (V[0] == 0x30) goto L315;
+L313: // 130B JP 0x30B
+    STEP(0x313, 0x130B);
+    goto L30B;
+L315: // A43F LD I, 0x43F
+    STEP(0x315, 0xA43F);
+    c->I = 0x43F;
+L317: // F165 LD V1, [I]
+    STEP(0x317, 0xF165);
+    for (int i = 0; i <= 1; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L319: // 8410 LD V4, V1
+    STEP(0x319, 0x8410);
+    V[4] = V[1];
+L31B: // 8300 LD V3, V0
+    STEP(0x31B, 0x8300);
+    V[3] = V[0];
+L31D: // 6609 LD V6, 0x09
+    STEP(0x31D, 0x6609);
+    V[6] = 0x09;
+L31F: // 240B CALL 0x40B
+    STEP(0x31F, 0x240B);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x31F;
+    goto L40B;
+L321: // 660F LD V6, 0x0F
+    STEP(0x321, 0x660F);
+    V[6] = 0x0F;
+L323: // 8340 LD V3, V4
+    STEP(0x323, 0x8340);
+    V[3] = V[4];
+L325: // 240B CALL 0x40B
+    STEP(0x325, 0x240B);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x325;
+    goto L40B;
+L327: // F00A LD V0, K
+    STEP(0x327, 0xF00A);
+    if (c->keypad == 0) {
+        c->pc = 0x327;
+        return cycles - left;
+    }
+    V[0] = __builtin_ctz(c->keypad);
+L329: // 1225 JP 0x225
+    STEP(0x329, 0x1225);
+    goto L225;
+L32B: // 23DB CALL 0x3DB
+    STEP(0x32B, 0x23DB);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x32B;
+    goto L3DB;
+L32D: // 6080 LD V0, 0x80
+    STEP(0x32D, 0x6080);
+    V[0] = 0x80;
+L32F: // 2401 CALL 0x401
+    STEP(0x32F, 0x2401);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x32F;
+    goto L401;
+L331: // 23DB CALL 0x3DB
+    STEP(0x331, 0x23DB);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x331;
+    goto L3DB;
+L333: // A42F LD I, 0x42F
+    STEP(0x333, 0xA42F);
+    c->I = 0x42F;
+L335: // FA1E ADD I, VA
+    STEP(0x335, 0xFA1E);
+    c->I += V[10];
+L337: // F065 LD V0, [I]
+    STEP(0x337, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L339: // 70FF ADD V0, 0xFF
+    STEP(0x339, 0x70FF);
+    V[0] += 0xFF;
+L33B: // 23F3 CALL 0x3F3
+    STEP(0x33B, 0x23F3);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x33B;
+    goto L3F3;
+L33D: // A441 LD I, 0x441
+    STEP(0x33D, 0xA441);
+    c->I = 0x441;
+L33F: // F01E ADD I, V0
+    STEP(0x33F, 0xF01E);
+    c->I += V[0];
+L341: // D787 DRW V7, V8, 7
+    STEP(0x341, 0xD787);
+    c->pc = 0x341;
+    predecode(0xD787, &in);
+    execute(c, &in);
+    if (c->pc != 0x343) goto dispatch;
+L343: // A477 LD I, 0x477
+    STEP(0x343, 0xA477);
+    c->I = 0x477;
+L345: // D787 DRW V7, V8, 7
+    STEP(0x345, 0xD787);
+    c->pc = 0x345;
+    predecode(0xD787, &in);
+    execute(c, &in);
+    if (c->pc != 0x347) goto dispatch;
+L347: // A42F LD I, 0x42F
+    STEP(0x347, 0xA42F);
+    c->I = 0x42F;
+L349: // F91E ADD I, V9
+    STEP(0x349, 0xF91E);
+    c->I += V[9];
+L34B: // F065 LD V0, [I]
+    STEP(0x34B, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L34D: // 70FF ADD V0, 0xFF
+    STEP(0x34D, 0x70FF);
+    V[0] += 0xFF;
+L34F: // 23F3 CALL 0x3F3
+    STEP(0x34F, 0x23F3);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x34F;
+    goto L3F3;
+L351: // A441 LD I, 0x441
+    STEP(0x351, 0xA441);
+    c->I = 0x441;
+L353: // F01E ADD I, V0
+    STEP(0x353, 0xF01E);
+    c->I += V[0];
+L355: // DDE7 DRW VD, VE, 7
+    STEP(0x355, 0xDDE7);
+    c->pc = 0x355;
+    predecode(0xDDE7, &in);
+    execute(c, &in);
+    if (c->pc != 0x357) goto dispatch;
+L357: // A477 LD I, 0x477
+    STEP(0x357, 0xA477);
+    c->I = 0x477;
+L359: // DDE7 DRW VD, VE, 7
+    STEP(0x359, 0xDDE7);
+    c->pc = 0x359;
+    predecode(0xDDE7, &in);
+    execute(c, &in);
+    if (c->pc != 0x35B) goto dispatch;
+L35B: // 12A5 JP 0x2A5
+    STEP(0x35B, 0x12A5);
+    goto L2A5;
+L35D: // A471 LD I, 0x471
+    STEP(0x35D, 0xA471);
+    c->I = 0x471;
+L35F: // DDE7 DRW VD, VE, 7
+    STEP(0x35F, 0xDDE7);
+    c->pc = 0x35F;
+    predecode(0xDDE7, &in);
+    execute(c, &in);
+    if (c->pc != 0x361) goto dispatch;
+L361: // FB0A LD VB, K
+    STEP(0x361, 0xFB0A);
+    if (c->keypad == 0) {
+        c->pc = 0x361;
+        return cycles - left;
+    }
+    V[11] = __builtin_ctz(c->keypad);
+L363: // DDE7 DRW VD, VE, 7
+    STEP(0x363, 0xDDE7);
+    c->pc = 0x363;
+    predecode(0xDDE7, &in);
+    execute(c, &in);
+    if (c->pc != 0x365) goto dispatch;
+L365: // 3B04 SE VB, 0x04
+    STEP(0x365, 0x3B04);
+    if (V[11] == 0x04) goto L369;
+L367: // 1371 JP 0x371
+    STEP(0x367, 0x1371);
+    goto L371;
+L369: // 4D00 SNE VD, 0x00
+    STEP(0x369, 0x4D00);
+    if (V[13] != 0x00) goto L36D;
+L36B: // 135D JP 0x35D
+    STEP(0x36B, 0x135D);
+    goto L35D;
+L36D: // 7DF8 ADD VD, 0xF8
+    STEP(0x36D, 0x7DF8);
+    V[13] += 0xF8;
+L36F: // 7CFF ADD VC, 0xFF
+    STEP(0x36F, 0x7CFF);
+    V[12] += 0xFF;
+L371: // 3B06 SE VB, 0x06
+    STEP(0x371, 0x3B06);
+    if (V[11] == 0x06) goto L375;
+L373: // 137D JP 0x37D
+    STEP(0x373, 0x137D);
+    goto L37D;
+L375: // 4D18 SNE VD, 0x18
+    STEP(0x375, 0x4D18);
+    if (V[13] != 0x18) goto L379;
+L377: // 135D JP 0x35D
+    STEP(0x377, 0x135D);
+    goto L35D;
+L379: // 7D08 ADD VD, 0x08
+    STEP(0x379, 0x7D08);
+    V[13] += 0x08;
+L37B: // 7C01 ADD VC, 0x01
+    STEP(0x37B, 0x7C01);
+    V[12] += 0x01;
+L37D: // 3B02 SE VB, 0x02
+    STEP(0x37D, 0x3B02);
+    if (V[11] == 0x02) goto L381;
+L37F: // 1389 JP 0x389
+    STEP(0x37F, 0x1389);
+    goto L389;
+L381: // 4E00 SNE VE, 0x00
+    STEP(0x381, 0x4E00);
+    if (V[14] != 0x00) goto L385;
+L383: // 135D JP 0x35D
+    STEP(0x383, 0x135D);
+    goto L35D;
+L385: // 7EF8 ADD VE, 0xF8
+    STEP(0x385, 0x7EF8);
+    V[14] += 0xF8;
+L387: // 7CFC ADD VC, 0xFC
+    STEP(0x387, 0x7CFC);
+    V[12] += 0xFC;
+L389: // 3B08 SE VB, 0x08
+    STEP(0x389, 0x3B08);
+    if (V[11] == 0x08) goto L38D;
+L38B: // 1395 JP 0x395
+    STEP(0x38B, 0x1395);
+    goto L395;
+L38D: // 4E18 SNE VE, 0x18
+    STEP(0x38D, 0x4E18);
+    if (V[14] != 0x18) goto L391;
+L38F: // 135D JP 0x35D
+    STEP(0x38F, 0x135D);
+    goto L35D;
+L391: // 7E08 ADD VE, 0x08
+    STEP(0x391, 0x7E08);
+    V[14] += 0x08;
+L393: // 7C04 ADD VC, 0x04
+    STEP(0x393, 0x7C04);
+    V[12] += 0x04;
+L395: // 3B05 SE VB, 0x05
+    STEP(0x395, 0x3B05);
+    if (V[11] == 0x05) goto L399;
+L397: // 135D JP 0x35D
+    STEP(0x397, 0x135D);
+    goto L35D;
+L399: // A42F LD I, 0x42F
+    STEP(0x399, 0xA42F);
+    c->I = 0x42F;
+L39B: // FC1E ADD I, VC
+    STEP(0x39B, 0xFC1E);
+    c->I += V[12];
+L39D: // F065 LD V0, [I]
+    STEP(0x39D, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L39F: // 4000 SNE V0, 0x00
+    STEP(0x39F, 0x4000);
+    if (V[0] != 0x00) goto L3A3;
+L3A1: // 135D JP 0x35D
+    STEP(0x3A1, 0x135D);
+    goto L35D;
+L3A3: // 89C0 LD V9, VC
+    STEP(0x3A3, 0x89C0);
+    V[9] = V[12];
+L3A5: // 99A0 SNE V9, VA
+    STEP(0x3A5, 0x99A0);
+    if (V[9] != V[10]) goto L3A9;
+L3A7: // 135D JP 0x35D
+    STEP(0x3A7, 0x135D);
+    goto L35D;
+L3A9: // 70FF ADD V0, 0xFF
+    STEP(0x3A9, 0x70FF);
+    V[0] += 0xFF;
+L3AB: // A477 LD I, 0x477
+    STEP(0x3AB, 0xA477);
+    c->I = 0x477;
+L3AD: // DDE7 DRW VD, VE, 7
+    STEP(0x3AD, 0xDDE7);
+    c->pc = 0x3AD;
+    predecode(0xDDE7, &in);
+    execute(c, &in);
+    if (c->pc != 0x3AF) goto dispatch;
+L3AF: // A441 LD I, 0x441
+    STEP(0x3AF, 0xA441);
+    c->I = 0x441;
+L3B1: // 23F3 CALL 0x3F3
+    STEP(0x3B1, 0x23F3);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x3B1;
+    goto L3F3;
+L3B3: // F01E ADD I, V0
+    STEP(0x3B3, 0xF01E);
+    c->I += V[0];
+L3B5: // DDE7 DRW VD, VE, 7
+    STEP(0x3B5, 0xDDE7);
+    c->pc = 0x3B5;
+    predecode(0xDDE7, &in);
+    execute(c, &in);
+    if (c->pc != 0x3B7) goto dispatch;
+L3B7: // 00EE RET
+    STEP(0x3B7, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3B9: // A4D5 LD I, 0x4D5
+    STEP(0x3B9, 0xA4D5);
+    c->I = 0x4D5;
+L3BB: // 6024 LD V0, 0x24
+    STEP(0x3BB, 0x6024);
+    V[0] = 0x24;
+L3BD: // 610A LD V1, 0x0A
+    STEP(0x3BD, 0x610A);
+    V[1] = 0x0A;
+L3BF: // 620B LD V2, 0x0B
+    STEP(0x3BF, 0x620B);
+    V[2] = 0x0B;
+L3C1: // D01B DRW V0, V1, 11
+    STEP(0x3C1, 0xD01B);
+    c->pc = 0x3C1;
+    predecode(0xD01B, &in);
+    execute(c, &in);
+    if (c->pc != 0x3C3) goto dispatch;
+L3C3: // 7008 ADD V0, 0x08
+    STEP(0x3C3, 0x7008);
+    V[0] += 0x08;
+L3C5: // F21E ADD I, V2
+    STEP(0x3C5, 0xF21E);
+    c->I += V[2];
+L3C7: // 303C SE V0, 0x3C
+    STEP(0x3C7, 0x303C);
+    if (V[0] == 0x3C) goto L3CB;
+L3C9: // 13C1 JP 0x3C1
+    STEP(0x3C9, 0x13C1);
+    goto L3C1;
+L3CB: // 00EE RET
+    STEP(0x3CB, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3CD: // 6034 LD V0, 0x34
+    STEP(0x3CD, 0x6034);
+    V[0] = 0x34;
+L3CF: // 6110 LD V1, 0x10
+    STEP(0x3CF, 0x6110);
+    V[1] = 0x10;
+L3D1: // A4F1 LD I, 0x4F1
+    STEP(0x3D1, 0xA4F1);
+    c->I = 0x4F1;
+L3D3: // D015 DRW V0, V1, 5
+    STEP(0x3D3, 0xD015);
+    c->pc = 0x3D3;
+    predecode(0xD015, &in);
+    execute(c, &in);
+    if (c->pc != 0x3D5) goto dispatch;
+L3D5: // A4F6 LD I, 0x4F6
+    STEP(0x3D5, 0xA4F6);
+    c->I = 0x4F6;
+L3D7: // D015 DRW V0, V1, 5
+    STEP(0x3D7, 0xD015);
+    c->pc = 0x3D7;
+    predecode(0xD015, &in);
+    execute(c, &in);
+    if (c->pc != 0x3D9) goto dispatch;
+L3D9: // 00EE RET
+    STEP(0x3D9, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3DB: // A4FB LD I, 0x4FB
+    STEP(0x3DB, 0xA4FB);
+    c->I = 0x4FB;
+L3DD: // 13E1 JP 0x3E1
+    STEP(0x3DD, 0x13E1);
+    goto L3E1;
+L3DF: // A50A LD I, 0x50A
+    STEP(0x3DF, 0xA50A);
+    c->I = 0x50A;
+L3E1: // 6024 LD V0, 0x24
+    STEP(0x3E1, 0x6024);
+    V[0] = 0x24;
+L3E3: // 610D LD V1, 0x0D
+    STEP(0x3E3, 0x610D);
+    V[1] = 0x0D;
+L3E5: // 6205 LD V2, 0x05
+    STEP(0x3E5, 0x6205);
+    V[2] = 0x05;
+L3E7: // D015 DRW V0, V1, 5
+    STEP(0x3E7, 0xD015);
+    c->pc = 0x3E7;
+    predecode(0xD015, &in);
+    execute(c, &in);
+    if (c->pc != 0x3E9) goto dispatch;
+L3E9: // 7008 ADD V0, 0x08
+    STEP(0x3E9, 0x7008);
+    V[0] += 0x08;
+L3EB: // F21E ADD I, V2
+    STEP(0x3EB, 0xF21E);
+    c->I += V[2];
+L3ED: // 303C SE V0, 0x3C
+    STEP(0x3ED, 0x303C);
+    if (V[0] == 0x3C) goto L3F1;
+L3EF: // 13E7 JP 0x3E7
+    STEP(0x3EF, 0x13E7);
+    goto L3E7;
+L3F1: // 00EE RET
+    STEP(0x3F1, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3F3: // 8100 LD V1, V0
+    STEP(0x3F3, 0x8100);
+    V[1] = V[0];
+L3F5: // 8114 ADD V1, V1
+    STEP(0x3F5, 0x8114);
+    V[15] = V[1] + V[1] > 0xFF;
+    V[1] += V[1];
+L3F7: // 8004 ADD V0, V0
+    STEP(0x3F7, 0x8004);
+    V[15] = V[0] + V[0] > 0xFF;
+    V[0] += V[0];
+L3F9: // 8004 ADD V0, V0
+    STEP(0x3F9, 0x8004);
+    V[15] = V[0] + V[0] > 0xFF;
+    V[0] += V[0];
+L3FB: // 8004 ADD V0, V0
+    STEP(0x3FB, 0x8004);
+    V[15] = V[0] + V[0] > 0xFF;
+    V[0] += V[0];
+L3FD: // 8015 SUB V0, V1
+    STEP(0x3FD, 0x8015);
+    V[15] = V[0] > V[1];
+    V[0] -= V[1];
+L3FF: // 00EE RET
+    STEP(0x3FF, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L401: // F015 LD DT, V0
+    STEP(0x401, 0xF015);
+    c->dt = V[0];
+L403: // F007 LD V0, DT
+    STEP(0x403, 0xF007);
+    V[0] = c->dt;
+L405: // 3000 SE V0, 0x00
+    STEP(0x405, 0x3000);
+    if (V[0] == 0x00) goto L409;
+L407: // 1403 JP 0x403
+    STEP(0x407, 0x1403);
+    goto L403;
+L409: // 00EE RET
+    STEP(0x409, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L40B: // A42F LD I, 0x42F
+    STEP(0x40B, 0xA42F);
+    c->I = 0x42F;
+L40D: // F333 LD B, V3
+    STEP(0x40D, 0xF333);
+    c->pc = 0x40D;
+    predecode(0xF333, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x40F) goto dispatch;
+L40F: // F265 LD V2, [I]
+    STEP(0x40F, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L411: // 6523 LD V5, 0x23
+    STEP(0x411, 0x6523);
+    V[5] = 0x23;
+L413: // F129 LD F, V1
+    STEP(0x413, 0xF129);
+    c->I = V[1] * 5;
+L415: // D565 DRW V5, V6, 5
+    STEP(0x415, 0xD565);
+    c->pc = 0x415;
+    predecode(0xD565, &in);
+    execute(c, &in);
+    if (c->pc != 0x417) goto dispatch;
+L417: // 6528 LD V5, 0x28
+    STEP(0x417, 0x6528);
+    V[5] = 0x28;
+L419: // F229 LD F, V2
+    STEP(0x419, 0xF229);
+    c->I = V[2] * 5;
+L41B: // D565 DRW V5, V6, 5
+    STEP(0x41B, 0xD565);
+    c->pc = 0x41B;
+    predecode(0xD565, &in);
+    execute(c, &in);
+    if (c->pc != 0x41D) goto dispatch;
+L41D: // 00EE RET
+    STEP(0x41D, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,165 @@
+// generated by chip8-aot from roms/TEST/IBM.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x00, 0xE0, 0xA2, 0x2A, 0x60, 0x0C, 0x61, 0x08, 0xD0, 0x1F, 0x70, 0x09,
+    0xA2, 0x39, 0xD0, 0x1F, 0xA2, 0x48, 0x70, 0x08, 0xD0, 0x1F, 0x70, 0x04,
+    0xA2, 0x57, 0xD0, 0x1F, 0x70, 0x08, 0xA2, 0x66, 0xD0, 0x1F, 0x70, 0x08,
+    0xA2, 0x75, 0xD0, 0x1F, 0x12, 0x28, 0xFF, 0x00, 0xFF, 0x00, 0x3C, 0x00,
+    0x3C, 0x00, 0x3C, 0x00, 0x3C, 0x00, 0xFF, 0x00, 0xFF, 0xFF, 0x00, 0xFF,
+    0x00, 0x38, 0x00, 0x3F, 0x00, 0x3F, 0x00, 0x38, 0x00, 0xFF, 0x00, 0xFF,
+    0x80, 0x00, 0xE0, 0x00, 0xE0, 0x00, 0x80, 0x00, 0x80, 0x00, 0xE0, 0x00,
+    0xE0, 0x00, 0x80, 0xF8, 0x00, 0xFC, 0x00, 0x3E, 0x00, 0x3F, 0x00, 0x3B,
+    0x00, 0x39, 0x00, 0xF8, 0x00, 0xF8, 0x03, 0x00, 0x07, 0x00, 0x0F, 0x00,
+    0xBF, 0x00, 0xFB, 0x00, 0xF3, 0x00, 0xE3, 0x00, 0x43, 0xE0, 0x00, 0xE0,
+    0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0x80, 0x00, 0xE0, 0x00, 0xE0,
+};
+const size_t aot_rom_size = 132;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000100ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 00E0 CLS
+    STEP(0x200, 0x00E0);
+    c->pc = 0x200;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x202) goto dispatch;
+L202: // A22A LD I, 0x22A
+    STEP(0x202, 0xA22A);
+    c->I = 0x22A;
+L204: // 600C LD V0, 0x0C
+    STEP(0x204, 0x600C);
+    V[0] = 0x0C;
+L206: // 6108 LD V1, 0x08
+    STEP(0x206, 0x6108);
+    V[1] = 0x08;
+L208: // D01F DRW V0, V1, 15
+    STEP(0x208, 0xD01F);
+    c->pc = 0x208;
+    predecode(0xD01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x20A) goto dispatch;
+L20A: // 7009 ADD V0, 0x09
+    STEP(0x20A, 0x7009);
+    V[0] += 0x09;
+L20C: // A239 LD I, 0x239
+    STEP(0x20C, 0xA239);
+    c->I = 0x239;
+L20E: // D01F DRW V0, V1, 15
+    STEP(0x20E, 0xD01F);
+    c->pc = 0x20E;
+    predecode(0xD01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x210) goto dispatch;
+L210: // A248 LD I, 0x248
+    STEP(0x210, 0xA248);
+    c->I = 0x248;
+L212: // 7008 ADD V0, 0x08
+    STEP(0x212, 0x7008);
+    V[0] += 0x08;
+L214: // D01F DRW V0, V1, 15
+    STEP(0x214, 0xD01F);
+    c->pc = 0x214;
+    predecode(0xD01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x216) goto dispatch;
+L216: // 7004 ADD V0, 0x04
+    STEP(0x216, 0x7004);
+    V[0] += 0x04;
+L218: // A257 LD I, 0x257
+    STEP(0x218, 0xA257);
+    c->I = 0x257;
+L21A: // D01F DRW V0, V1, 15
+    STEP(0x21A, 0xD01F);
+    c->pc = 0x21A;
+    predecode(0xD01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x21C) goto dispatch;
+L21C: // 7008 ADD V0, 0x08
+    STEP(0x21C, 0x7008);
+    V[0] += 0x08;
+L21E: // A266 LD I, 0x266
+    STEP(0x21E, 0xA266);
+    c->I = 0x266;
+L220: // D01F DRW V0, V1, 15
+    STEP(0x220, 0xD01F);
+    c->pc = 0x220;
+    predecode(0xD01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x222) goto dispatch;
+L222: // 7008 ADD V0, 0x08
+    STEP(0x222, 0x7008);
+    V[0] += 0x08;
+L224: // A275 LD I, 0x275
+    STEP(0x224, 0xA275);
+    c->I = 0x275;
+L226: // D01F DRW V0, V1, 15
+    STEP(0x226, 0xD01F);
+    c->pc = 0x226;
+    predecode(0xD01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x228) goto dispatch;
+L228: // 1228 JP 0x228
+    STEP(0x228, 0x1228);
+    goto L228;
+}
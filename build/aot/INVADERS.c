@@ -0,0 +1,1107 @@
+// generated by chip8-aot from roms/INVADERS.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x12, 0x25, 0x53, 0x50, 0x41, 0x43, 0x45, 0x20, 0x49, 0x4E, 0x56, 0x41,
+    0x44, 0x45, 0x52, 0x53, 0x20, 0x30, 0x2E, 0x39, 0x31, 0x20, 0x42, 0x79,
+    0x20, 0x44, 0x61, 0x76, 0x69, 0x64, 0x20, 0x57, 0x49, 0x4E, 0x54, 0x45,
+    0x52, 0x60, 0x00, 0x61, 0x00, 0x62, 0x08, 0xA3, 0xDD, 0xD0, 0x18, 0x71,
+    0x08, 0xF2, 0x1E, 0x31, 0x20, 0x12, 0x2D, 0x70, 0x08, 0x61, 0x00, 0x30,
+    0x40, 0x12, 0x2D, 0x69, 0x05, 0x6C, 0x15, 0x6E, 0x00, 0x23, 0x91, 0x60,
+    0x0A, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x4B, 0x23, 0x91, 0x7E,
+    0x01, 0x12, 0x45, 0x66, 0x00, 0x68, 0x1C, 0x69, 0x00, 0x6A, 0x04, 0x6B,
+    0x0A, 0x6C, 0x04, 0x6D, 0x3C, 0x6E, 0x0F, 0x00, 0xE0, 0x23, 0x75, 0x23,
+    0x51, 0xFD, 0x15, 0x60, 0x04, 0xE0, 0x9E, 0x12, 0x7D, 0x23, 0x75, 0x38,
+    0x00, 0x78, 0xFF, 0x23, 0x75, 0x60, 0x06, 0xE0, 0x9E, 0x12, 0x8B, 0x23,
+    0x75, 0x38, 0x39, 0x78, 0x01, 0x23, 0x75, 0x36, 0x00, 0x12, 0x9F, 0x60,
+    0x05, 0xE0, 0x9E, 0x12, 0xE9, 0x66, 0x01, 0x65, 0x1B, 0x84, 0x80, 0xA3,
+    0xD9, 0xD4, 0x51, 0xA3, 0xD9, 0xD4, 0x51, 0x75, 0xFF, 0x35, 0xFF, 0x12,
+    0xAD, 0x66, 0x00, 0x12, 0xE9, 0xD4, 0x51, 0x3F, 0x01, 0x12, 0xE9, 0xD4,
+    0x51, 0x66, 0x00, 0x83, 0x40, 0x73, 0x03, 0x83, 0xB5, 0x62, 0xF8, 0x83,
+    0x22, 0x62, 0x08, 0x33, 0x00, 0x12, 0xC9, 0x23, 0x7D, 0x82, 0x06, 0x43,
+    0x08, 0x12, 0xD3, 0x33, 0x10, 0x12, 0xD5, 0x23, 0x7D, 0x82, 0x06, 0x33,
+    0x18, 0x12, 0xDD, 0x23, 0x7D, 0x82, 0x06, 0x43, 0x20, 0x12, 0xE7, 0x33,
+    0x28, 0x12, 0xE9, 0x23, 0x7D, 0x3E, 0x00, 0x13, 0x07, 0x79, 0x06, 0x49,
+    0x18, 0x69, 0x00, 0x6A, 0x04, 0x6B, 0x0A, 0x6C, 0x04, 0x7D, 0xF4, 0x6E,
+    0x0F, 0x00, 0xE0, 0x23, 0x51, 0x23, 0x75, 0xFD, 0x15, 0x12, 0x6F, 0xF7,
+    0x07, 0x37, 0x00, 0x12, 0x6F, 0xFD, 0x15, 0x23, 0x51, 0x8B, 0xA4, 0x3B,
+    0x12, 0x13, 0x1B, 0x7C, 0x02, 0x6A, 0xFC, 0x3B, 0x02, 0x13, 0x23, 0x7C,
+    0x02, 0x6A, 0x04, 0x23, 0x51, 0x3C, 0x18, 0x12, 0x6F, 0x00, 0xE0, 0xA4,
+    0xDD, 0x60, 0x14, 0x61, 0x08, 0x62, 0x0F, 0xD0, 0x1F, 0x70, 0x08, 0xF2,
+    0x1E, 0x30, 0x2C, 0x13, 0x33, 0x60, 0xFF, 0xF0, 0x15, 0xF0, 0x07, 0x30,
+    0x00, 0x13, 0x41, 0xF0, 0x0A, 0x00, 0xE0, 0xA7, 0x06, 0xFE, 0x65, 0x12,
+    0x25, 0xA3, 0xC1, 0xF9, 0x1E, 0x61, 0x08, 0x23, 0x69, 0x81, 0x06, 0x23,
+    0x69, 0x81, 0x06, 0x23, 0x69, 0x81, 0x06, 0x23, 0x69, 0x7B, 0xD0, 0x00,
+    0xEE, 0x80, 0xE0, 0x80, 0x12, 0x30, 0x00, 0xDB, 0xC6, 0x7B, 0x0C, 0x00,
+    0xEE, 0xA3, 0xD9, 0x60, 0x1C, 0xD8, 0x04, 0x00, 0xEE, 0x23, 0x51, 0x8E,
+    0x23, 0x23, 0x51, 0x60, 0x05, 0xF0, 0x18, 0xF0, 0x15, 0xF0, 0x07, 0x30,
+    0x00, 0x13, 0x89, 0x00, 0xEE, 0x6A, 0x00, 0x8D, 0xE0, 0x6B, 0x04, 0xE9,
+    0xA1, 0x12, 0x57, 0xA6, 0x0C, 0xFD, 0x1E, 0xF0, 0x65, 0x30, 0xFF, 0x13,
+    0xAF, 0x6A, 0x00, 0x6B, 0x04, 0x6D, 0x01, 0x6E, 0x01, 0x13, 0x97, 0xA5,
+    0x0A, 0xF0, 0x1E, 0xDB, 0xC6, 0x7B, 0x08, 0x7D, 0x01, 0x7A, 0x01, 0x3A,
+    0x07, 0x13, 0x97, 0x00, 0xEE, 0x3C, 0x7E, 0xFF, 0xFF, 0x99, 0x99, 0x7E,
+    0xFF, 0xFF, 0x24, 0x24, 0xE7, 0x7E, 0xFF, 0x3C, 0x3C, 0x7E, 0xDB, 0x81,
+    0x42, 0x3C, 0x7E, 0xFF, 0xDB, 0x10, 0x38, 0x7C, 0xFE, 0x00, 0x00, 0x7F,
+    0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x03, 0x03,
+    0x03, 0x03, 0x00, 0x00, 0x3F, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x3F, 0x08, 0x08, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xFE,
+    0x00, 0x00, 0x00, 0x7E, 0x42, 0x42, 0x62, 0x62, 0x62, 0x62, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0x7D, 0x00, 0x41, 0x7D, 0x05, 0x7D, 0x7D, 0x00, 0x00, 0xC2,
+    0xC2, 0xC6, 0x44, 0x6C, 0x28, 0x38, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xF7, 0x10,
+    0x14, 0xF7, 0xF7, 0x04, 0x04, 0x00, 0x00, 0x7C, 0x44, 0xFE, 0xC2, 0xC2,
+    0xC2, 0xC2, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0xEF, 0x20, 0x28, 0xE8, 0xE8, 0x2F,
+    0x2F, 0x00, 0x00, 0xF9, 0x85, 0xC5, 0xC5, 0xC5, 0xC5, 0xF9, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
+    0xFF, 0x00, 0xBE, 0x00, 0x20, 0x30, 0x20, 0xBE, 0xBE, 0x00, 0x00, 0xF7,
+    0x04, 0xE7, 0x85, 0x85, 0x84, 0xF4, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x7F,
+    0x00, 0x3F, 0x00, 0x7F, 0x00, 0x00, 0x00, 0xEF, 0x28, 0xEF, 0x00, 0xE0,
+    0x60, 0x6F, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0xFF, 0x00, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0x00, 0xFC, 0x00, 0xFE,
+    0x00, 0x00, 0x00, 0xC0, 0x00, 0xC0, 0xC0, 0xC0, 0xC0, 0xC0, 0x00, 0x00,
+    0xFC, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0xFC, 0x10, 0x10,
+    0xFF, 0xF9, 0x81, 0xB9, 0x8B, 0x9A, 0x9A, 0xFA, 0x00, 0xFA, 0x8A, 0x9A,
+    0x9A, 0x9B, 0x99, 0xF8, 0xE6, 0x25, 0x25, 0xF4, 0x34, 0x34, 0x34, 0x00,
+    0x17, 0x14, 0x34, 0x37, 0x36, 0x26, 0xC7, 0xDF, 0x50, 0x50, 0x5C, 0xD8,
+    0xD8, 0xDF, 0x00, 0xDF, 0x11, 0x1F, 0x12, 0x1B, 0x19, 0xD9, 0x7C, 0x44,
+    0xFE, 0x86, 0x86, 0x86, 0xFC, 0x84, 0xFE, 0x82, 0x82, 0xFE, 0xFE, 0x80,
+    0xC0, 0xC0, 0xC0, 0xFE, 0xFC, 0x82, 0xC2, 0xC2, 0xC2, 0xFC, 0xFE, 0x80,
+    0xF8, 0xC0, 0xC0, 0xFE, 0xFE, 0x80, 0xF0, 0xC0, 0xC0, 0xC0, 0xFE, 0x80,
+    0xBE, 0x86, 0x86, 0xFE, 0x86, 0x86, 0xFE, 0x86, 0x86, 0x86, 0x10, 0x10,
+    0x10, 0x10, 0x10, 0x10, 0x18, 0x18, 0x18, 0x48, 0x48, 0x78, 0x9C, 0x90,
+    0xB0, 0xC0, 0xB0, 0x9C, 0x80, 0x80, 0xC0, 0xC0, 0xC0, 0xFE, 0xEE, 0x92,
+    0x92, 0x86, 0x86, 0x86, 0xFE, 0x82, 0x86, 0x86, 0x86, 0x86, 0x7C, 0x82,
+    0x86, 0x86, 0x86, 0x7C, 0xFE, 0x82, 0xFE, 0xC0, 0xC0, 0xC0, 0x7C, 0x82,
+    0xC2, 0xCA, 0xC4, 0x7A, 0xFE, 0x86, 0xFE, 0x90, 0x9C, 0x84, 0xFE, 0xC0,
+    0xFE, 0x02, 0x02, 0xFE, 0xFE, 0x10, 0x30, 0x30, 0x30, 0x30, 0x82, 0x82,
+    0xC2, 0xC2, 0xC2, 0xFE, 0x82, 0x82, 0x82, 0xEE, 0x38, 0x10, 0x86, 0x86,
+    0x96, 0x92, 0x92, 0xEE, 0x82, 0x44, 0x38, 0x38, 0x44, 0x82, 0x82, 0x82,
+    0xFE, 0x30, 0x30, 0x30, 0xFE, 0x02, 0x1E, 0xF0, 0x80, 0xFE, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x60, 0x60, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x18, 0x18, 0x18, 0x18, 0x00, 0x18, 0x7C, 0xC6,
+    0x0C, 0x18, 0x00, 0x18, 0x00, 0x00, 0xFE, 0xFE, 0x00, 0x00, 0xFE, 0x82,
+    0x86, 0x86, 0x86, 0xFE, 0x08, 0x08, 0x08, 0x18, 0x18, 0x18, 0xFE, 0x02,
+    0xFE, 0xC0, 0xC0, 0xFE, 0xFE, 0x02, 0x1E, 0x06, 0x06, 0xFE, 0x84, 0xC4,
+    0xC4, 0xFE, 0x04, 0x04, 0xFE, 0x80, 0xFE, 0x06, 0x06, 0xFE, 0xC0, 0xC0,
+    0xC0, 0xFE, 0x82, 0xFE, 0xFE, 0x02, 0x02, 0x06, 0x06, 0x06, 0x7C, 0x44,
+    0xFE, 0x86, 0x86, 0xFE, 0xFE, 0x82, 0xFE, 0x06, 0x06, 0x06, 0x44, 0xFE,
+    0x44, 0x44, 0xFE, 0x44, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x6C,
+    0x5A, 0x00, 0x0C, 0x18, 0xA8, 0x30, 0x4E, 0x7E, 0x00, 0x12, 0x18, 0x66,
+    0x6C, 0xA8, 0x5A, 0x66, 0x54, 0x24, 0x66, 0x00, 0x48, 0x48, 0x18, 0x12,
+    0xA8, 0x06, 0x90, 0xA8, 0x12, 0x00, 0x7E, 0x30, 0x12, 0xA8, 0x84, 0x30,
+    0x4E, 0x72, 0x18, 0x66, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0x90, 0x54,
+    0x78, 0xA8, 0x48, 0x78, 0x6C, 0x72, 0xA8, 0x12, 0x18, 0x6C, 0x72, 0x66,
+    0x54, 0x90, 0xA8, 0x72, 0x2A, 0x18, 0xA8, 0x30, 0x4E, 0x7E, 0x00, 0x12,
+    0x18, 0x66, 0x6C, 0xA8, 0x72, 0x54, 0xA8, 0x5A, 0x66, 0x18, 0x7E, 0x18,
+    0x4E, 0x72, 0xA8, 0x72, 0x2A, 0x18, 0x30, 0x66, 0xA8, 0x30, 0x4E, 0x7E,
+    0x00, 0x6C, 0x30, 0x54, 0x4E, 0x9C, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+    0xA8, 0x48, 0x54, 0x7E, 0x18, 0xA8, 0x90, 0x54, 0x78, 0x66, 0xA8, 0x6C,
+    0x2A, 0x30, 0x5A, 0xA8, 0x84, 0x30, 0x72, 0x2A, 0xA8, 0xD8, 0xA8, 0x00,
+    0x4E, 0x12, 0xA8, 0xE4, 0xA2, 0xA8, 0x00, 0x4E, 0x12, 0xA8, 0x6C, 0x2A,
+    0x54, 0x54, 0x72, 0xA8, 0x84, 0x30, 0x72, 0x2A, 0xA8, 0xDE, 0x9C, 0xA8,
+    0x72, 0x2A, 0x18, 0xA8, 0x0C, 0x54, 0x48, 0x5A, 0x78, 0x72, 0x18, 0x66,
+    0xA8, 0x66, 0x18, 0x5A, 0x54, 0x66, 0x72, 0x6C, 0xA8, 0x72, 0x2A, 0x00,
+    0x72, 0xA8, 0x72, 0x2A, 0x18, 0xA8, 0x30, 0x4E, 0x7E, 0x00, 0x12, 0x18,
+    0x66, 0x6C, 0xA8, 0x00, 0x66, 0x18, 0xA8, 0x30, 0x4E, 0x0C, 0x66, 0x18,
+    0x00, 0x6C, 0x30, 0x4E, 0x24, 0xA8, 0x72, 0x2A, 0x18, 0x30, 0x66, 0xA8,
+    0x1E, 0x54, 0x66, 0x0C, 0x18, 0x9C, 0xA8, 0x24, 0x54, 0x54, 0x12, 0xA8,
+    0x42, 0x78, 0x0C, 0x3C, 0xA8, 0xAE, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8, 0xA8,
+    0xA8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const size_t aot_rom_size = 1301;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x000000000000FF00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x225: goto L225;
+        case 0x227: goto L227;
+        case 0x229: goto L229;
+        case 0x22B: goto L22B;
+        case 0x22D: goto L22D;
+        case 0x22F: goto L22F;
+        case 0x231: goto L231;
+        case 0x233: goto L233;
+        case 0x235: goto L235;
+        case 0x237: goto L237;
+        case 0x239: goto L239;
+        case 0x23B: goto L23B;
+        case 0x23D: goto L23D;
+        case 0x23F: goto L23F;
+        case 0x241: goto L241;
+        case 0x243: goto L243;
+        case 0x245: goto L245;
+        case 0x247: goto L247;
+        case 0x249: goto L249;
+        case 0x24B: goto L24B;
+        case 0x24D: goto L24D;
+        case 0x24F: goto L24F;
+        case 0x251: goto L251;
+        case 0x253: goto L253;
+        case 0x255: goto L255;
+        case 0x257: goto L257;
+        case 0x259: goto L259;
+        case 0x25B: goto L25B;
+        case 0x25D: goto L25D;
+        case 0x25F: goto L25F;
+        case 0x261: goto L261;
+        case 0x263: goto L263;
+        case 0x265: goto L265;
+        case 0x267: goto L267;
+        case 0x269: goto L269;
+        case 0x26B: goto L26B;
+        case 0x26D: goto L26D;
+        case 0x26F: goto L26F;
+        case 0x271: goto L271;
+        case 0x273: goto L273;
+        case 0x275: goto L275;
+        case 0x277: goto L277;
+        case 0x279: goto L279;
+        case 0x27B: goto L27B;
+        case 0x27D: goto L27D;
+        case 0x27F: goto L27F;
+        case 0x281: goto L281;
+        case 0x283: goto L283;
+        case 0x285: goto L285;
+        case 0x287: goto L287;
+        case 0x289: goto L289;
+        case 0x28B: goto L28B;
+        case 0x28D: goto L28D;
+        case 0x28F: goto L28F;
+        case 0x291: goto L291;
+        case 0x293: goto L293;
+        case 0x295: goto L295;
+        case 0x297: goto L297;
+        case 0x299: goto L299;
+        case 0x29B: goto L29B;
+        case 0x29D: goto L29D;
+        case 0x29F: goto L29F;
+        case 0x2A1: goto L2A1;
+        case 0x2A3: goto L2A3;
+        case 0x2A5: goto L2A5;
+        case 0x2A7: goto L2A7;
+        case 0x2A9: goto L2A9;
+        case 0x2AB: goto L2AB;
+        case 0x2AD: goto L2AD;
+        case 0x2AF: goto L2AF;
+        case 0x2B1: goto L2B1;
+        case 0x2B3: goto L2B3;
+        case 0x2B5: goto L2B5;
+        case 0x2B7: goto L2B7;
+        case 0x2B9: goto L2B9;
+        case 0x2BB: goto L2BB;
+        case 0x2BD: goto L2BD;
+        case 0x2BF: goto L2BF;
+        case 0x2C1: goto L2C1;
+        case 0x2C3: goto L2C3;
+        case 0x2C5: goto L2C5;
+        case 0x2C7: goto L2C7;
+        case 0x2C9: goto L2C9;
+        case 0x2CB: goto L2CB;
+        case 0x2CD: goto L2CD;
+        case 0x2CF: goto L2CF;
+        case 0x2D1: goto L2D1;
+        case 0x2D3: goto L2D3;
+        case 0x2D5: goto L2D5;
+        case 0x2D7: goto L2D7;
+        case 0x2D9: goto L2D9;
+        case 0x2DB: goto L2DB;
+        case 0x2DD: goto L2DD;
+        case 0x2DF: goto L2DF;
+        case 0x2E1: goto L2E1;
+        case 0x2E3: goto L2E3;
+        case 0x2E5: goto L2E5;
+        case 0x2E7: goto L2E7;
+        case 0x2E9: goto L2E9;
+        case 0x2EB: goto L2EB;
+        case 0x2ED: goto L2ED;
+        case 0x2EF: goto L2EF;
+        case 0x2F1: goto L2F1;
+        case 0x2F3: goto L2F3;
+        case 0x2F5: goto L2F5;
+        case 0x2F7: goto L2F7;
+        case 0x2F9: goto L2F9;
+        case 0x2FB: goto L2FB;
+        case 0x2FD: goto L2FD;
+        case 0x2FF: goto L2FF;
+        case 0x301: goto L301;
+        case 0x303: goto L303;
+        case 0x305: goto L305;
+        case 0x307: goto L307;
+        case 0x309: goto L309;
+        case 0x30B: goto L30B;
+        case 0x30D: goto L30D;
+        case 0x30F: goto L30F;
+        case 0x311: goto L311;
+        case 0x313: goto L313;
+        case 0x315: goto L315;
+        case 0x317: goto L317;
+        case 0x319: goto L319;
+        case 0x31B: goto L31B;
+        case 0x31D: goto L31D;
+        case 0x31F: goto L31F;
+        case 0x321: goto L321;
+        case 0x323: goto L323;
+        case 0x325: goto L325;
+        case 0x327: goto L327;
+        case 0x329: goto L329;
+        case 0x32B: goto L32B;
+        case 0x32D: goto L32D;
+        case 0x32F: goto L32F;
+        case 0x331: goto L331;
+        case 0x333: goto L333;
+        case 0x335: goto L335;
+        case 0x337: goto L337;
+        case 0x339: goto L339;
+        case 0x33B: goto L33B;
+        case 0x33D: goto L33D;
+        case 0x33F: goto L33F;
+        case 0x341: goto L341;
+        case 0x343: goto L343;
+        case 0x345: goto L345;
+        case 0x347: goto L347;
+        case 0x349: goto L349;
+        case 0x34B: goto L34B;
+        case 0x34D: goto L34D;
+        case 0x34F: goto L34F;
+        case 0x351: goto L351;
+        case 0x353: goto L353;
+        case 0x355: goto L355;
+        case 0x357: goto L357;
+        case 0x359: goto L359;
+        case 0x35B: goto L35B;
+        case 0x35D: goto L35D;
+        case 0x35F: goto L35F;
+        case 0x361: goto L361;
+        case 0x363: goto L363;
+        case 0x365: goto L365;
+        case 0x367: goto L367;
+        case 0x369: goto L369;
+        case 0x36B: goto L36B;
+        case 0x36D: goto L36D;
+        case 0x36F: goto L36F;
+        case 0x371: goto L371;
+        case 0x373: goto L373;
+        case 0x375: goto L375;
+        case 0x377: goto L377;
+        case 0x379: goto L379;
+        case 0x37B: goto L37B;
+        case 0x37D: goto L37D;
+        case 0x37F: goto L37F;
+        case 0x381: goto L381;
+        case 0x383: goto L383;
+        case 0x385: goto L385;
+        case 0x387: goto L387;
+        case 0x389: goto L389;
+        case 0x38B: goto L38B;
+        case 0x38D: goto L38D;
+        case 0x38F: goto L38F;
+        case 0x391: goto L391;
+        case 0x393: goto L393;
+        case 0x395: goto L395;
+        case 0x397: goto L397;
+        case 0x399: goto L399;
+        case 0x39B: goto L39B;
+        case 0x39D: goto L39D;
+        case 0x39F: goto L39F;
+        case 0x3A1: goto L3A1;
+        case 0x3A3: goto L3A3;
+        case 0x3A5: goto L3A5;
+        case 0x3A7: goto L3A7;
+        case 0x3A9: goto L3A9;
+        case 0x3AB: goto L3AB;
+        case 0x3AD: goto L3AD;
+        case 0x3AF: goto L3AF;
+        case 0x3B1: goto L3B1;
+        case 0x3B3: goto L3B3;
+        case 0x3B5: goto L3B5;
+        case 0x3B7: goto L3B7;
+        case 0x3B9: goto L3B9;
+        case 0x3BB: goto L3BB;
+        case 0x3BD: goto L3BD;
+        case 0x3BF: goto L3BF;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 1225 JP 0x225
+    STEP(0x200, 0x1225);
+    goto L225;
+L225: // 6000 LD V0, 0x00
+    STEP(0x225, 0x6000);
+    V[0] = 0x00;
+L227: // 6100 LD V1, 0x00
+    STEP(0x227, 0x6100);
+    V[1] = 0x00;
+L229: // 6208 LD V2, 0x08
+    STEP(0x229, 0x6208);
+    V[2] = 0x08;
+L22B: // A3DD LD I, 0x3DD
+    STEP(0x22B, 0xA3DD);
+    c->I = 0x3DD;
+L22D: // D018 DRW V0, V1, 8
+    STEP(0x22D, 0xD018);
+    c->pc = 0x22D;
+    predecode(0xD018, &in);
+    execute(c, &in);
+    if (c->pc != 0x22F) goto dispatch;
+L22F: // 7108 ADD V1, 0x08
+    STEP(0x22F, 0x7108);
+    V[1] += 0x08;
+L231: // F21E ADD I, V2
+    STEP(0x231, 0xF21E);
+    c->I += V[2];
+L233: // 3120 SE V1, 0x20
+    STEP(0x233, 0x3120);
+    if (V[1] == 0x20) goto L237;
+L235: // 122D JP 0x22D
+    STEP(0x235, 0x122D);
+    goto L22D;
+L237: // 7008 ADD V0, 0x08
+    STEP(0x237, 0x7008);
+    V[0] += 0x08;
+L239: // 6100 LD V1, 0x00
+    STEP(0x239, 0x6100);
+    V[1] = 0x00;
+L23B: // 3040 SE V0, 0x40
+    STEP(0x23B, 0x3040);
+    if (V[0] == 0x40) goto L23F;
+L23D: // 122D JP 0x22D
+    STEP(0x23D, 0x122D);
+    goto L22D;
+L23F: // 6905 LD V9, 0x05
+    STEP(0x23F, 0x6905);
+    V[9] = 0x05;
+L241: // 6C15 LD VC, 0x15
+    STEP(0x241, 0x6C15);
+    V[12] = 0x15;
+L243: // 6E00 LD VE, 0x00
+    STEP(0x243, 0x6E00);
+    V[14] = 0x00;
+L245: // 2391 CALL 0x391
+    STEP(0x245, 0x2391);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x245;
+    goto L391;
+L247: // 600A LD V0, 0x0A
+    STEP(0x247, 0x600A);
+    V[0] = 0x0A;
+L249: // F015 LD DT, V0
+    STEP(0x249, 0xF015);
+    c->dt = V[0];
+L24B: // F007 LD V0, DT
+    STEP(0x24B, 0xF007);
+    V[0] = c->dt;
+L24D: // 3000 SE V0, 0x00
+    STEP(0x24D, 0x3000);
+    if (V[0] == 0x00) goto L251;
+L24F: // 124B JP 0x24B
+    STEP(0x24F, 0x124B);
+    goto L24B;
+L251: // 2391 CALL 0x391
+    STEP(0x251, 0x2391);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x251;
+    goto L391;
+L253: // 7E01 ADD VE, 0x01
+    STEP(0x253, 0x7E01);
+    V[14] += 0x01;
+L255: // 1245 JP 0x245
+    STEP(0x255, 0x1245);
+    goto L245;
+L257: // 6600 LD V6, 0x00
+    STEP(0x257, 0x6600);
+    V[6] = 0x00;
+L259: // 681C LD V8, 0x1C
+    STEP(0x259, 0x681C);
+    V[8] = 0x1C;
+L25B: // 6900 LD V9, 0x00
+    STEP(0x25B, 0x6900);
+    V[9] = 0x00;
+L25D: // 6A04 LD VA, 0x04
+    STEP(0x25D, 0x6A04);
+    V[10] = 0x04;
+L25F: // 6B0A LD VB, 0x0A
+    STEP(0x25F, 0x6B0A);
+    V[11] = 0x0A;
+L261: // 6C04 LD VC, 0x04
+    STEP(0x261, 0x6C04);
+    V[12] = 0x04;
+L263: // 6D3C LD VD, 0x3C
+    STEP(0x263, 0x6D3C);
+    V[13] = 0x3C;
+L265: // 6E0F LD VE, 0x0F
+    STEP(0x265, 0x6E0F);
+    V[14] = 0x0F;
+L267: // 00E0 CLS
+    STEP(0x267, 0x00E0);
+    c->pc = 0x267;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x269) goto dispatch;
+L269: // 2375 CALL 0x375
+    STEP(0x269, 0x2375);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x269;
+    goto L375;
+L26B: // 2351 CALL 0x351
+    STEP(0x26B, 0x2351);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x26B;
+    goto L351;
+L26D: // FD15 LD DT, VD
+    STEP(0x26D, 0xFD15);
+    c->dt = V[13];
+L26F: // 6004 LD V0, 0x04
+    STEP(0x26F, 0x6004);
+    V[0] = 0x04;
+L271: // E09E SKP V0
+    STEP(0x271, 0xE09E);
+    c->pc = 0x271;
+    predecode(0xE09E, &in);
+    execute(c, &in);
+    if (c->pc != 0x273) goto dispatch;
+L273: // 127D JP 0x27D
+    STEP(0x273, 0x127D);
+    goto L27D;
+L275: // 2375 CALL 0x375
+    STEP(0x275, 0x2375);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x275;
+    goto L375;
+L277: // 3800 SE V8, 0x00
+    STEP(0x277, 0x3800);
+    if (V[8] == 0x00) goto L27B;
+L279: // 78FF ADD V8, 0xFF
+    STEP(0x279, 0x78FF);
+    V[8] += 0xFF;
+L27B: // 2375 CALL 0x375
+    STEP(0x27B, 0x2375);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x27B;
+    goto L375;
+L27D: // 6006 LD V0, 0x06
+    STEP(0x27D, 0x6006);
+    V[0] = 0x06;
+L27F: // E09E SKP V0
+    STEP(0x27F, 0xE09E);
+    c->pc = 0x27F;
+    predecode(0xE09E, &in);
+    execute(c, &in);
+    if (c->pc != 0x281) goto dispatch;
+L281: // 128B JP 0x28B
+    STEP(0x281, 0x128B);
+    goto L28B;
+L283: // 2375 CALL 0x375
+    STEP(0x283, 0x2375);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x283;
+    goto L375;
+L285: // 3839 SE V8, 0x39
+    STEP(0x285, 0x3839);
+    if (V[8] == 0x39) goto L289;
+L287: // 7801 ADD V8, 0x01
+    STEP(0x287, 0x7801);
+    V[8] += 0x01;
+L289: // 2375 CALL 0x375
+    STEP(0x289, 0x2375);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x289;
+    goto L375;
+L28B: // 3600 SE V6, 0x00
+    STEP(0x28B, 0x3600);
+    if (V[6] == 0x00) goto L28F;
+L28D: // 129F JP 0x29F
+    STEP(0x28D, 0x129F);
+    goto L29F;
+L28F: // 6005 LD V0, 0x05
+    STEP(0x28F, 0x6005);
+    V[0] = 0x05;
+L291: // E09E SKP V0
+    STEP(0x291, 0xE09E);
+    c->pc = 0x291;
+    predecode(0xE09E, &in);
+    execute(c, &in);
+    if (c->pc != 0x293) goto dispatch;
+L293: // 12E9 JP 0x2E9
+    STEP(0x293, 0x12E9);
+    goto L2E9;
+L295: // 6601 LD V6, 0x01
+    STEP(0x295, 0x6601);
+    V[6] = 0x01;
+L297: // 651B LD V5, 0x1B
+    STEP(0x297, 0x651B);
+    V[5] = 0x1B;
+L299: // 8480 LD V4, V8
+    STEP(0x299, 0x8480);
+    V[4] = V[8];
+L29B: // A3D9 LD I, 0x3D9
+    STEP(0x29B, 0xA3D9);
+    c->I = 0x3D9;
+L29D: // D451 DRW V4, V5, 1
+    STEP(0x29D, 0xD451);
+    c->pc = 0x29D;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x29F) goto dispatch;
+L29F: // A3D9 LD I, 0x3D9
+    STEP(0x29F, 0xA3D9);
+    c->I = 0x3D9;
+L2A1: // D451 DRW V4, V5, 1
+    STEP(0x2A1, 0xD451);
+    c->pc = 0x2A1;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A3) goto dispatch;
+L2A3: // 75FF ADD V5, 0xFF
+    STEP(0x2A3, 0x75FF);
+    V[5] += 0xFF;
+L2A5: // 35FF SE V5, 0xFF
+    STEP(0x2A5, 0x35FF);
+    if (V[5] == 0xFF) goto L2A9;
+L2A7: // 12AD JP 0x2AD
+    STEP(0x2A7, 0x12AD);
+    goto L2AD;
+L2A9: // 6600 LD V6, 0x00
+    STEP(0x2A9, 0x6600);
+    V[6] = 0x00;
+L2AB: // 12E9 JP 0x2E9
+    STEP(0x2AB, 0x12E9);
+    goto L2E9;
+L2AD: // D451 DRW V4, V5, 1
+    STEP(0x2AD, 0xD451);
+    c->pc = 0x2AD;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x2AF) goto dispatch;
+L2AF: // 3F01 SE VF, 0x01
+    STEP(0x2AF, 0x3F01);
+    if (V[15] == 0x01) goto L2B3;
+L2B1: // 12E9 JP 0x2E9
+    STEP(0x2B1, 0x12E9);
+    goto L2E9;
+L2B3: // D451 DRW V4, V5, 1
+    STEP(0x2B3, 0xD451);
+    c->pc = 0x2B3;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x2B5) goto dispatch;
+L2B5: // 6600 LD V6, 0x00
+    STEP(0x2B5, 0x6600);
+    V[6] = 0x00;
+L2B7: // 8340 LD V3, V4
+    STEP(0x2B7, 0x8340);
+    V[3] = V[4];
+L2B9: // 7303 ADD V3, 0x03
+    STEP(0x2B9, 0x7303);
+    V[3] += 0x03;
+L2BB: // 83B5 SUB V3, VB
+    STEP(0x2BB, 0x83B5);
+    V[15] = V[3] > V[11];
+    V[3] -= V[11];
+L2BD: // 62F8 LD V2, 0xF8
+    STEP(0x2BD, 0x62F8);
+    V[2] = 0xF8;
+L2BF: // 8322 AND V3, V2
+    STEP(0x2BF, 0x8322);
+    V[3] &= V[2];
+L2C1: // 6208 LD V2, 0x08
+    STEP(0x2C1, 0x6208);
+    V[2] = 0x08;
+L2C3: // 3300 SE V3, 0x00
+    STEP(0x2C3, 0x3300);
+    if (V[3] == 0x00) goto L2C7;
+L2C5: // 12C9 JP 0x2C9
+    STEP(0x2C5, 0x12C9);
+    goto L2C9;
+L2C7: // 237D CALL 0x37D
+    STEP(0x2C7, 0x237D);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2C7;
+    goto L37D;
+L2C9: // 8206 SHR V2, V0
+    STEP(0x2C9, 0x8206);
+    V[15] = V[2] & 1;
+    V[2] >>= 1;
+L2CB: // 4308 SNE V3, 0x08
+    STEP(0x2CB, 0x4308);
+    if (V[3] != 0x08) goto L2CF;
+L2CD: // 12D3 JP 0x2D3
+    STEP(0x2CD, 0x12D3);
+    goto L2D3;
+L2CF: // 3310 SE V3, 0x10
+    STEP(0x2CF, 0x3310);
+    if (V[3] == 0x10) goto L2D3;
+L2D1: // 12D5 JP 0x2D5
+    STEP(0x2D1, 0x12D5);
+    goto L2D5;
+L2D3: // 237D CALL 0x37D
+    STEP(0x2D3, 0x237D);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2D3;
+    goto L37D;
+L2D5: // 8206 SHR V2, V0
+    STEP(0x2D5, 0x8206);
+    V[15] = V[2] & 1;
+    V[2] >>= 1;
+L2D7: // 3318 SE V3, 0x18
+    STEP(0x2D7, 0x3318);
+    if (V[3] == 0x18) goto L2DB;
+L2D9: // 12DD JP 0x2DD
+    STEP(0x2D9, 0x12DD);
+    goto L2DD;
+L2DB: // 237D CALL 0x37D
+    STEP(0x2DB, 0x237D);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2DB;
+    goto L37D;
+L2DD: // 8206 SHR V2, V0
+    STEP(0x2DD, 0x8206);
+    V[15] = V[2] & 1;
+    V[2] >>= 1;
+L2DF: // 4320 SNE V3, 0x20
+    STEP(0x2DF, 0x4320);
+    if (V[3] != 0x20) goto L2E3;
+L2E1: // 12E7 JP 0x2E7
+    STEP(0x2E1, 0x12E7);
+    goto L2E7;
+L2E3: // 3328 SE V3, 0x28
+    STEP(0x2E3, 0x3328);
+    if (V[3] == 0x28) goto L2E7;
+L2E5: // 12E9 JP 0x2E9
+    STEP(0x2E5, 0x12E9);
+    goto L2E9;
+L2E7: // 237D CALL 0x37D
+    STEP(0x2E7, 0x237D);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2E7;
+    goto L37D;
+L2E9: // 3E00 SE VE, 0x00
+    STEP(0x2E9, 0x3E00);
+    if (V[14] == 0x00) goto L2ED;
+L2EB: // 1307 JP 0x307
+    STEP(0x2EB, 0x1307);
+    goto L307;
+L2ED: // 7906 ADD V9, 0x06
+    STEP(0x2ED, 0x7906);
+    V[9] += 0x06;
+L2EF: // 4918 SNE V9, 0x18
+    STEP(0x2EF, 0x4918);
+    if (V[9] != 0x18) goto L2F3;
+L2F1: // 6900 LD V9, 0x00
+    STEP(0x2F1, 0x6900);
+    V[9] = 0x00;
+L2F3: // 6A04 LD VA, 0x04
+    STEP(0x2F3, 0x6A04);
+    V[10] = 0x04;
+L2F5: // 6B0A LD VB, 0x0A
+    STEP(0x2F5, 0x6B0A);
+    V[11] = 0x0A;
+L2F7: // 6C04 LD VC, 0x04
+    STEP(0x2F7, 0x6C04);
+    V[12] = 0x04;
+L2F9: // 7DF4 ADD VD, 0xF4
+    STEP(0x2F9, 0x7DF4);
+    V[13] += 0xF4;
+L2FB: // 6E0F LD VE, 0x0F
+    STEP(0x2FB, 0x6E0F);
+    V[14] = 0x0F;
+L2FD: // 00E0 CLS
+    STEP(0x2FD, 0x00E0);
+    c->pc = 0x2FD;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x2FF) goto dispatch;
+L2FF: // 2351 CALL 0x351
+    STEP(0x2FF, 0x2351);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2FF;
+    goto L351;
+L301: // 2375 CALL 0x375
+    STEP(0x301, 0x2375);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x301;
+    goto L375;
+L303: // FD15 LD DT, VD
+    STEP(0x303, 0xFD15);
+    c->dt = V[13];
+L305: // 126F JP 0x26F
+    STEP(0x305, 0x126F);
+    goto L26F;
+L307: // F707 LD V7, DT
+    STEP(0x307, 0xF707);
+    V[7] = c->dt;
+L309: // 3700 SE V7, 0x00
+    STEP(0x309, 0x3700);
+    if (V[7] == 0x00) goto L30D;
+L30B: // 126F JP 0x26F
+    STEP(0x30B, 0x126F);
+    goto L26F;
+L30D: // FD15 LD DT, VD
+    STEP(0x30D, 0xFD15);
+    c->dt = V[13];
+L30F: // 2351 CALL 0x351
+    STEP(0x30F, 0x2351);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x30F;
+    goto L351;
+L311: // 8BA4 ADD VB, VA
+    STEP(0x311, 0x8BA4);
+    V[15] = V[11] + V[10] > 0xFF;
+    V[11] += V[10];
+L313: // 3B12 SE VB, 0x12
+    STEP(0x313, 0x3B12);
+    if (V[11] == 0x12) goto L317;
+L315: // 131B JP 0x31B
+    STEP(0x315, 0x131B);
+    goto L31B;
+L317: // 7C02 ADD VC, 0x02
+    STEP(0x317, 0x7C02);
+    V[12] += 0x02;
+L319: // 6AFC LD VA, 0xFC
+    STEP(0x319, 0x6AFC);
+    V[10] = 0xFC;
+L31B: // 3B02 SE VB, 0x02
+    STEP(0x31B, 0x3B02);
+    if (V[11] == 0x02) goto L31F;
+L31D: // 1323 JP 0x323
+    STEP(0x31D, 0x1323);
+    goto L323;
+L31F: // 7C02 ADD VC, 0x02
+    STEP(0x31F, 0x7C02);
+    V[12] += 0x02;
+L321: // 6A04 LD VA, 0x04
+    STEP(0x321, 0x6A04);
+    V[10] = 0x04;
+L323: // 2351 CALL 0x351
+    STEP(0x323, 0x2351);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x323;
+    goto L351;
+L325: // 3C18 SE VC, 0x18
+    STEP(0x325, 0x3C18);
+    if (V[12] == 0x18) goto L329;
+L327: // 126F JP 0x26F
+    STEP(0x327, 0x126F);
+    goto L26F;
+L329: // 00E0 CLS
+    STEP(0x329, 0x00E0);
+    c->pc = 0x329;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x32B) goto dispatch;
+L32B: // A4DD LD I, 0x4DD
+    STEP(0x32B, 0xA4DD);
+    c->I = 0x4DD;
+L32D: // 6014 LD V0, 0x14
+    STEP(0x32D, 0x6014);
+    V[0] = 0x14;
+L32F: // 6108 LD V1, 0x08
+    STEP(0x32F, 0x6108);
+    V[1] = 0x08;
+L331: // 620F LD V2, 0x0F
+    STEP(0x331, 0x620F);
+    V[2] = 0x0F;
+L333: // D01F DRW V0, V1, 15
+    STEP(0x333, 0xD01F);
+    c->pc = 0x333;
+    predecode(0xD01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x335) goto dispatch;
+L335: // 7008 ADD V0, 0x08
+    STEP(0x335, 0x7008);
+    V[0] += 0x08;
+L337: // F21E ADD I, V2
+    STEP(0x337, 0xF21E);
+    c->I += V[2];
+L339: // 302C SE V0, 0x2C
+    STEP(0x339, 0x302C);
+    if (V[0] == 0x2C) goto L33D;
+L33B: // 1333 JP 0x333
+    STEP(0x33B, 0x1333);
+    goto L333;
+L33D: // 60FF LD V0, 0xFF
+    STEP(0x33D, 0x60FF);
+    V[0] = 0xFF;
+L33F: // F015 LD DT, V0
+    STEP(0x33F, 0xF015);
+    c->dt = V[0];
+L341: // F007 LD V0, DT
+    STEP(0x341, 0xF007);
+    V[0] = c->dt;
+L343: // 3000 SE V0, 0x00
+    STEP(0x343, 0x3000);
+    if (V[0] == 0x00) goto L347;
+L345: // 1341 JP 0x341
+    STEP(0x345, 0x1341);
+    goto L341;
+L347: // F00A LD V0, K
+    STEP(0x347, 0xF00A);
+    if (c->keypad == 0) {
+        c->pc = 0x347;
+        return cycles - left;
+    }
+    V[0] = __builtin_ctz(c->keypad);
+L349: // 00E0 CLS
+    STEP(0x349, 0x00E0);
+    c->pc = 0x349;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x34B) goto dispatch;
+L34B: // A706 LD I, 0x706
+    STEP(0x34B, 0xA706);
+    c->I = 0x706;
+L34D: // FE65 LD VE, [I]
+    STEP(0x34D, 0xFE65);
+    for (int i = 0; i <= 14; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L34F: // 1225 JP 0x225
+    STEP(0x34F, 0x1225);
+    goto L225;
+L351: // A3C1 LD I, 0x3C1
+    STEP(0x351, 0xA3C1);
+    c->I = 0x3C1;
+L353: // F91E ADD I, V9
+    STEP(0x353, 0xF91E);
+    c->I += V[9];
+L355: // 6108 LD V1, 0x08
+    STEP(0x355, 0x6108);
+    V[1] = 0x08;
+L357: // 2369 CALL 0x369
+    STEP(0x357, 0x2369);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x357;
+    goto L369;
+L359: // 8106 SHR V1, V0
+    STEP(0x359, 0x8106);
+    V[15] = V[1] & 1;
+    V[1] >>= 1;
+L35B: // 2369 CALL 0x369
+    STEP(0x35B, 0x2369);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x35B;
+    goto L369;
+L35D: // 8106 SHR V1, V0
+    STEP(0x35D, 0x8106);
+    V[15] = V[1] & 1;
+    V[1] >>= 1;
+L35F: // 2369 CALL 0x369
+    STEP(0x35F, 0x2369);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x35F;
+    goto L369;
+L361: // 8106 SHR V1, V0
+    STEP(0x361, 0x8106);
+    V[15] = V[1] & 1;
+    V[1] >>= 1;
+L363: // 2369 CALL 0x369
+    STEP(0x363, 0x2369);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x363;
+    goto L369;
+L365: // 7BD0 ADD VB, 0xD0
+    STEP(0x365, 0x7BD0);
+    V[11] += 0xD0;
+L367: // 00EE RET
+    STEP(0x367, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L369: // 80E0 LD V0, VE
+    STEP(0x369, 0x80E0);
+    V[0] = V[14];
+L36B: // 8012 AND V0, V1
+    STEP(0x36B, 0x8012);
+    V[0] &= V[1];
+L36D: // 3000 SE V0, 0x00
+    STEP(0x36D, 0x3000);
+    if (V[0] == 0x00) goto L371;
+L36F: // DBC6 DRW VB, VC, 6
+    STEP(0x36F, 0xDBC6);
+    c->pc = 0x36F;
+    predecode(0xDBC6, &in);
+    execute(c, &in);
+    if (c->pc != 0x371) goto dispatch;
+L371: // 7B0C ADD VB, 0x0C
+    STEP(0x371, 0x7B0C);
+    V[11] += 0x0C;
+L373: // 00EE RET
+    STEP(0x373, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L375: // A3D9 LD I, 0x3D9
+    STEP(0x375, 0xA3D9);
+    c->I = 0x3D9;
+L377: // 601C LD V0, 0x1C
+    STEP(0x377, 0x601C);
+    V[0] = 0x1C;
+L379: // D804 DRW V8, V0, 4
+    STEP(0x379, 0xD804);
+    c->pc = 0x379;
+    predecode(0xD804, &in);
+    execute(c, &in);
+    if (c->pc != 0x37B) goto dispatch;
+L37B: // 00EE RET
+    STEP(0x37B, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L37D: // 2351 CALL 0x351
+    STEP(0x37D, 0x2351);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x37D;
+    goto L351;
+L37F: // 8E23 XOR VE, V2
+    STEP(0x37F, 0x8E23);
+    V[14] ^= V[2];
+L381: // 2351 CALL 0x351
+    STEP(0x381, 0x2351);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x381;
+    goto L351;
+L383: // 6005 LD V0, 0x05
+    STEP(0x383, 0x6005);
+    V[0] = 0x05;
+L385: // F018 LD ST, V0
+    STEP(0x385, 0xF018);
+    c->st = V[0];
+L387: // F015 LD DT, V0
+    STEP(0x387, 0xF015);
+    c->dt = V[0];
+L389: // F007 LD V0, DT
+    STEP(0x389, 0xF007);
+    V[0] = c->dt;
+L38B: // 3000 SE V0, 0x00
+    STEP(0x38B, 0x3000);
+    if (V[0] == 0x00) goto L38F;
+L38D: // 1389 JP 0x389
+    STEP(0x38D, 0x1389);
+    goto L389;
+L38F: // 00EE RET
+    STEP(0x38F, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L391: // 6A00 LD VA, 0x00
+    STEP(0x391, 0x6A00);
+    V[10] = 0x00;
+L393: // 8DE0 LD VD, VE
+    STEP(0x393, 0x8DE0);
+    V[13] = V[14];
+L395: // 6B04 LD VB, 0x04
+    STEP(0x395, 0x6B04);
+    V[11] = 0x04;
+L397: // E9A1 SKNP V9
+    STEP(0x397, 0xE9A1);
+    c->pc = 0x397;
+    predecode(0xE9A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x399) goto dispatch;
+L399: // 1257 JP 0x257
+    STEP(0x399, 0x1257);
+    goto L257;
+L39B: // A60C LD I, 0x60C
+    STEP(0x39B, 0xA60C);
+    c->I = 0x60C;
+L39D: // FD1E ADD I, VD
+    STEP(0x39D, 0xFD1E);
+    c->I += V[13];
+L39F: // F065 LD V0, [I]
+    STEP(0x39F, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L3A1: // 30FF SE V0, 0xFF
+    STEP(0x3A1, 0x30FF);
+    if (V[0] == 0xFF) goto L3A5;
+L3A3: // 13AF JP 0x3AF
+    STEP(0x3A3, 0x13AF);
+    goto L3AF;
+L3A5: // 6A00 LD VA, 0x00
+    STEP(0x3A5, 0x6A00);
+    V[10] = 0x00;
+L3A7: // 6B04 LD VB, 0x04
+    STEP(0x3A7, 0x6B04);
+    V[11] = 0x04;
+L3A9: // 6D01 LD VD, 0x01
+    STEP(0x3A9, 0x6D01);
+    V[13] = 0x01;
+L3AB: // 6E01 LD VE, 0x01
+    STEP(0x3AB, 0x6E01);
+    V[14] = 0x01;
+L3AD: // 1397 JP 0x397
+    STEP(0x3AD, 0x1397);
+    goto L397;
+L3AF: // A50A LD I, 0x50A
+    STEP(0x3AF, 0xA50A);
+    c->I = 0x50A;
+L3B1: // F01E ADD I, V0
+    STEP(0x3B1, 0xF01E);
+    c->I += V[0];
+L3B3: // DBC6 DRW VB, VC, 6
+    STEP(0x3B3, 0xDBC6);
+    c->pc = 0x3B3;
+    predecode(0xDBC6, &in);
+    execute(c, &in);
+    if (c->pc != 0x3B5) goto dispatch;
+L3B5: // 7B08 ADD VB, 0x08
+    STEP(0x3B5, 0x7B08);
+    V[11] += 0x08;
+L3B7: // 7D01 ADD VD, 0x01
+    STEP(0x3B7, 0x7D01);
+    V[13] += 0x01;
+L3B9: // 7A01 ADD VA, 0x01
+    STEP(0x3B9, 0x7A01);
+    V[10] += 0x01;
+L3BB: // 3A07 SE VA, 0x07
+    STEP(0x3BB, 0x3A07);
+    if (V[10] == 0x07) goto L3BF;
+L3BD: // 1397 JP 0x397
+    STEP(0x3BD, 0x1397);
+    goto L397;
+L3BF: // 00EE RET
+    STEP(0x3BF, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,325 @@
+// generated by chip8-aot from roms/KALEID.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x60, 0x00, 0x63, 0x80, 0x61, 0x1F, 0x62, 0x0F, 0x22, 0x32, 0xA2, 0x00,
+    0xF3, 0x1E, 0xF0, 0x0A, 0xF0, 0x55, 0x40, 0x00, 0x12, 0x1C, 0x73, 0x01,
+    0x33, 0x00, 0x12, 0x08, 0x63, 0x80, 0xA2, 0x00, 0xF3, 0x1E, 0xF0, 0x65,
+    0x40, 0x00, 0x12, 0x1C, 0x73, 0x01, 0x43, 0x00, 0x12, 0x1C, 0x22, 0x32,
+    0x12, 0x1E, 0x40, 0x02, 0x72, 0xFF, 0x40, 0x04, 0x71, 0xFF, 0x40, 0x06,
+    0x71, 0x01, 0x40, 0x08, 0x72, 0x01, 0xA2, 0x77, 0x6A, 0xE0, 0x8A, 0x12,
+    0x6B, 0x1F, 0x81, 0xB2, 0x3A, 0x00, 0x72, 0x01, 0x6A, 0xF0, 0x8A, 0x22,
+    0x6B, 0x0F, 0x82, 0xB2, 0x3A, 0x00, 0x71, 0x01, 0x6B, 0x1F, 0x81, 0xB2,
+    0xD1, 0x21, 0x8A, 0x10, 0x6B, 0x1F, 0x8B, 0x25, 0xDA, 0xB1, 0x6A, 0x3F,
+    0x8A, 0x15, 0xDA, 0xB1, 0x8B, 0x20, 0xDA, 0xB1, 0x00, 0xEE, 0x01, 0x80,
+};
+const size_t aot_rom_size = 120;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000300ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 6000 LD V0, 0x00
+    STEP(0x200, 0x6000);
+    V[0] = 0x00;
+L202: // 6380 LD V3, 0x80
+    STEP(0x202, 0x6380);
+    V[3] = 0x80;
+L204: // 611F LD V1, 0x1F
+    STEP(0x204, 0x611F);
+    V[1] = 0x1F;
+L206: // 620F LD V2, 0x0F
+    STEP(0x206, 0x620F);
+    V[2] = 0x0F;
+L208: // 2232 CALL 0x232
+    STEP(0x208, 0x2232);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x208;
+    goto L232;
+L20A: // A200 LD I, 0x200
+    STEP(0x20A, 0xA200);
+    c->I = 0x200;
+L20C: // F31E ADD I, V3
+    STEP(0x20C, 0xF31E);
+    c->I += V[3];
+L20E: // F00A LD V0, K
+    STEP(0x20E, 0xF00A);
+    if (c->keypad == 0) {
+        c->pc = 0x20E;
+        return cycles - left;
+    }
+    V[0] = __builtin_ctz(c->keypad);
+L210: // F055 LD [I], V0
+    STEP(0x210, 0xF055);
+    c->pc = 0x210;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x212) goto dispatch;
+L212: // 4000 SNE V0, 0x00
+    STEP(0x212, 0x4000);
+    if (V[0] != 0x00) goto L216;
+L214: // 121C JP 0x21C
+    STEP(0x214, 0x121C);
+    goto L21C;
+L216: // 7301 ADD V3, 0x01
+    STEP(0x216, 0x7301);
+    V[3] += 0x01;
+L218: // 3300 SE V3, 0x00
+    STEP(0x218, 0x3300);
+    if (V[3] == 0x00) goto L21C;
+L21A: // 1208 JP 0x208
+    STEP(0x21A, 0x1208);
+    goto L208;
+L21C: // 6380 LD V3, 0x80
+    STEP(0x21C, 0x6380);
+    V[3] = 0x80;
+L21E: // A200 LD I, 0x200
+    STEP(0x21E, 0xA200);
+    c->I = 0x200;
+L220: // F31E ADD I, V3
+    STEP(0x220, 0xF31E);
+    c->I += V[3];
+L222: // F065 LD V0, [I]
+    STEP(0x222, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L224: // 4000 SNE V0, 0x00
+    STEP(0x224, 0x4000);
+    if (V[0] != 0x00) goto L228;
+L226: // 121C JP 0x21C
+    STEP(0x226, 0x121C);
+    goto L21C;
+L228: // 7301 ADD V3, 0x01
+    STEP(0x228, 0x7301);
+    V[3] += 0x01;
+L22A: // 4300 SNE V3, 0x00
+    STEP(0x22A, 0x4300);
+    if (V[3] != 0x00) goto L22E;
+L22C: // 121C JP 0x21C
+    STEP(0x22C, 0x121C);
+    goto L21C;
+L22E: // 2232 CALL 0x232
+    STEP(0x22E, 0x2232);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x22E;
+    goto L232;
+L230: // 121E JP 0x21E
+    STEP(0x230, 0x121E);
+    goto L21E;
+L232: // 4002 SNE V0, 0x02
+    STEP(0x232, 0x4002);
+    if (V[0] != 0x02) goto L236;
+L234: // 72FF ADD V2, 0xFF
+    STEP(0x234, 0x72FF);
+    V[2] += 0xFF;
+L236: // 4004 SNE V0, 0x04
+    STEP(0x236, 0x4004);
+    if (V[0] != 0x04) goto L23A;
+L238: // 71FF ADD V1, 0xFF
+    STEP(0x238, 0x71FF);
+    V[1] += 0xFF;
+L23A: // 4006 SNE V0, 0x06
+    STEP(0x23A, 0x4006);
+    if (V[0] != 0x06) goto L23E;
+L23C: // 7101 ADD V1, 0x01
+    STEP(0x23C, 0x7101);
+    V[1] += 0x01;
+L23E: // 4008 SNE V0, 0x08
+    STEP(0x23E, 0x4008);
+    if (V[0] != 0x08) goto L242;
+L240: // 7201 ADD V2, 0x01
+    STEP(0x240, 0x7201);
+    V[2] += 0x01;
+L242: // A277 LD I, 0x277
+    STEP(0x242, 0xA277);
+    c->I = 0x277;
+L244: // 6AE0 LD VA, 0xE0
+    STEP(0x244, 0x6AE0);
+    V[10] = 0xE0;
+L246: // 8A12 AND VA, V1
+    STEP(0x246, 0x8A12);
+    V[10] &= V[1];
+L248: // 6B1F LD VB, 0x1F
+    STEP(0x248, 0x6B1F);
+    V[11] = 0x1F;
+L24A: // 81B2 AND V1, VB
+    STEP(0x24A, 0x81B2);
+    V[1] &= V[11];
+L24C: // 3A00 SE VA, 0x00
+    STEP(0x24C, 0x3A00);
+    if (V[10] == 0x00) goto L250;
+L24E: // 7201 ADD V2, 0x01
+    STEP(0x24E, 0x7201);
+    V[2] += 0x01;
+L250: // 6AF0 LD VA, 0xF0
+    STEP(0x250, 0x6AF0);
+    V[10] = 0xF0;
+L252: // 8A22 AND VA, V2
+    STEP(0x252, 0x8A22);
+    V[10] &= V[2];
+L254: // 6B0F LD VB, 0x0F
+    STEP(0x254, 0x6B0F);
+    V[11] = 0x0F;
+L256: // 82B2 AND V2, VB
+    STEP(0x256, 0x82B2);
+    V[2] &= V[11];
+L258: // 3A00 SE VA, 0x00
+    STEP(0x258, 0x3A00);
+    if (V[10] == 0x00) goto L25C;
+L25A: // 7101 ADD V1, 0x01
+    STEP(0x25A, 0x7101);
+    V[1] += 0x01;
+L25C: // 6B1F LD VB, 0x1F
+    STEP(0x25C, 0x6B1F);
+    V[11] = 0x1F;
+L25E: // 81B2 AND V1, VB
+    STEP(0x25E, 0x81B2);
+    V[1] &= V[11];
+L260: // D121 DRW V1, V2, 1
+    STEP(0x260, 0xD121);
+    c->pc = 0x260;
+    predecode(0xD121, &in);
+    execute(c, &in);
+    if (c->pc != 0x262) goto dispatch;
+L262: // 8A10 LD VA, V1
+    STEP(0x262, 0x8A10);
+    V[10] = V[1];
+L264: // 6B1F LD VB, 0x1F
+    STEP(0x264, 0x6B1F);
+    V[11] = 0x1F;
+L266: // 8B25 SUB VB, V2
+    STEP(0x266, 0x8B25);
+    V[15] = V[11] > V[2];
+    V[11] -= V[2];
+L268: // DAB1 DRW VA, VB, 1
+    STEP(0x268, 0xDAB1);
+    c->pc = 0x268;
+    predecode(0xDAB1, &in);
+    execute(c, &in);
+    if (c->pc != 0x26A) goto dispatch;
+L26A: // 6A3F LD VA, 0x3F
+    STEP(0x26A, 0x6A3F);
+    V[10] = 0x3F;
+L26C: // 8A15 SUB VA, V1
+    STEP(0x26C, 0x8A15);
+    V[15] = V[10] > V[1];
+    V[10] -= V[1];
+L26E: // DAB1 DRW VA, VB, 1
+    STEP(0x26E, 0xDAB1);
+    c->pc = 0x26E;
+    predecode(0xDAB1, &in);
+    execute(c, &in);
+    if (c->pc != 0x270) goto dispatch;
+L270: // 8B20 LD VB, V2
+    STEP(0x270, 0x8B20);
+    V[11] = V[2];
+L272: // DAB1 DRW VA, VB, 1
+    STEP(0x272, 0xDAB1);
+    c->pc = 0x272;
+    predecode(0xDAB1, &in);
+    execute(c, &in);
+    if (c->pc != 0x274) goto dispatch;
+L274: // 00EE RET
+    STEP(0x274, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
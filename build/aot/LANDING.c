@@ -0,0 +1,679 @@
+// generated by chip8-aot from roms/LANDING.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x00, 0xE0, 0xA3, 0x0A, 0x60, 0x00, 0x61, 0x1F, 0xD0, 0x11, 0x70, 0x08,
+    0x40, 0x40, 0x12, 0x12, 0x12, 0x08, 0xA3, 0x00, 0x64, 0x09, 0x74, 0x01,
+    0x44, 0x36, 0x12, 0x50, 0xC5, 0x0B, 0x86, 0x50, 0x76, 0x0F, 0x46, 0x18,
+    0xD4, 0x61, 0x46, 0x17, 0xD4, 0x62, 0x46, 0x16, 0xD4, 0x63, 0x46, 0x15,
+    0xD4, 0x64, 0x46, 0x14, 0xD4, 0x65, 0x46, 0x13, 0xD4, 0x66, 0x46, 0x12,
+    0xD4, 0x67, 0x46, 0x11, 0xD4, 0x68, 0x46, 0x10, 0xD4, 0x69, 0x46, 0x0F,
+    0xD4, 0x6A, 0x66, 0x19, 0xD4, 0x66, 0x12, 0x16, 0x6A, 0x00, 0x6B, 0x00,
+    0x69, 0x02, 0xA2, 0xFE, 0xDA, 0xB1, 0x60, 0x14, 0xF0, 0x18, 0x60, 0x14,
+    0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x62, 0x60, 0x01, 0xF0, 0x18,
+    0xDA, 0xB1, 0x7A, 0x01, 0x4A, 0x3E, 0x22, 0x90, 0xDA, 0xB1, 0x4F, 0x01,
+    0x12, 0x9E, 0x60, 0x08, 0xE0, 0xA1, 0x22, 0xBE, 0x48, 0x01, 0x22, 0xD6,
+    0x60, 0x02, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x88, 0x12, 0x68,
+    0x79, 0xFF, 0x39, 0x00, 0x12, 0xFA, 0x6A, 0x00, 0x7B, 0x01, 0x69, 0x02,
+    0x00, 0xEE, 0x60, 0x0A, 0xF0, 0x18, 0xA3, 0x0E, 0xF5, 0x33, 0xF2, 0x65,
+    0x63, 0x19, 0x64, 0x00, 0xF0, 0x29, 0xD3, 0x45, 0x73, 0x05, 0xF1, 0x29,
+    0xD3, 0x45, 0x73, 0x05, 0xF2, 0x29, 0xD3, 0x45, 0x12, 0xBC, 0x48, 0x01,
+    0x00, 0xEE, 0x68, 0x01, 0x60, 0x03, 0xF0, 0x18, 0x8D, 0xA0, 0x8E, 0xB0,
+    0x7D, 0x01, 0x7E, 0x01, 0xA3, 0x0C, 0xDD, 0xE1, 0x00, 0xEE, 0xA3, 0x0C,
+    0xDD, 0xE1, 0x7E, 0x01, 0xDD, 0xE1, 0x4F, 0x01, 0x12, 0xEA, 0x60, 0x01,
+    0xF0, 0x18, 0xA2, 0xFE, 0x00, 0xEE, 0x75, 0x01, 0x60, 0x05, 0xF0, 0x18,
+    0x68, 0x00, 0x4E, 0x1F, 0xDD, 0xE1, 0xA2, 0xFE, 0x00, 0xEE, 0x6A, 0x00,
+    0x00, 0xEE, 0xE0, 0x00, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0xFF, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const size_t aot_rom_size = 276;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 00E0 CLS
+    STEP(0x200, 0x00E0);
+    c->pc = 0x200;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x202) goto dispatch;
+L202: // A30A LD I, 0x30A
+    STEP(0x202, 0xA30A);
+    c->I = 0x30A;
+L204: // 6000 LD V0, 0x00
+    STEP(0x204, 0x6000);
+    V[0] = 0x00;
+L206: // 611F LD V1, 0x1F
+    STEP(0x206, 0x611F);
+    V[1] = 0x1F;
+L208: // D011 DRW V0, V1, 1
+    STEP(0x208, 0xD011);
+    c->pc = 0x208;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x20A) goto dispatch;
+L20A: // 7008 ADD V0, 0x08
+    STEP(0x20A, 0x7008);
+    V[0] += 0x08;
+L20C: // 4040 SNE V0, 0x40
+    STEP(0x20C, 0x4040);
+    if (V[0] != 0x40) goto L210;
+L20E: // 1212 JP 0x212
+    STEP(0x20E, 0x1212);
+    goto L212;
+L210: // 1208 JP 0x208
+    STEP(0x210, 0x1208);
+    goto L208;
+L212: // A300 LD I, 0x300
+    STEP(0x212, 0xA300);
+    c->I = 0x300;
+L214: // 6409 LD V4, 0x09
+    STEP(0x214, 0x6409);
+    V[4] = 0x09;
+L216: // 7401 ADD V4, 0x01
+    STEP(0x216, 0x7401);
+    V[4] += 0x01;
+L218: // 4436 SNE V4, 0x36
+    STEP(0x218, 0x4436);
+    if (V[4] != 0x36) goto L21C;
+L21A: // 1250 JP 0x250
+    STEP(0x21A, 0x1250);
+    goto L250;
+L21C: // C50B RND V5, 0x0B
+    STEP(0x21C, 0xC50B);
+    c->pc = 0x21C;
+    predecode(0xC50B, &in);
+    execute(c, &in);
+    if (c->pc != 0x21E) goto dispatch;
+L21E: // 8650 LD V6, V5
+    STEP(0x21E, 0x8650);
+    V[6] = V[5];
+L220: // 760F ADD V6, 0x0F
+    STEP(0x220, 0x760F);
+    V[6] += 0x0F;
+L222: // 4618 SNE V6, 0x18
+    STEP(0x222, 0x4618);
+    if (V[6] != 0x18) goto L226;
+L224: // D461 DRW V4, V6, 1
+    STEP(0x224, 0xD461);
+    c->pc = 0x224;
+    predecode(0xD461, &in);
+    execute(c, &in);
+    if (c->pc != 0x226) goto dispatch;
+L226: // 4617 SNE V6, 0x17
+    STEP(0x226, 0x4617);
+    if (V[6] != 0x17) goto L22A;
+L228: // D462 DRW V4, V6, 2
+    STEP(0x228, 0xD462);
+    c->pc = 0x228;
+    predecode(0xD462, &in);
+    execute(c, &in);
+    if (c->pc != 0x22A) goto dispatch;
+L22A: // 4616 SNE V6, 0x16
+    STEP(0x22A, 0x4616);
+    if (V[6] != 0x16) goto L22E;
+L22C: // D463 DRW V4, V6, 3
+    STEP(0x22C, 0xD463);
+    c->pc = 0x22C;
+    predecode(0xD463, &in);
+    execute(c, &in);
+    if (c->pc != 0x22E) goto dispatch;
+L22E: // 4615 SNE V6, 0x15
+    STEP(0x22E, 0x4615);
+    if (V[6] != 0x15) goto L232;
+L230: // D464 DRW V4, V6, 4
+    STEP(0x230, 0xD464);
+    c->pc = 0x230;
+    predecode(0xD464, &in);
+    execute(c, &in);
+    if (c->pc != 0x232) goto dispatch;
+L232: // 4614 SNE V6, 0x14
+    STEP(0x232, 0x4614);
+    if (V[6] != 0x14) goto L236;
+L234: // D465 DRW V4, V6, 5
+    STEP(0x234, 0xD465);
+    c->pc = 0x234;
+    predecode(0xD465, &in);
+    execute(c, &in);
+    if (c->pc != 0x236) goto dispatch;
+L236: // 4613 SNE V6, 0x13
+    STEP(0x236, 0x4613);
+    if (V[6] != 0x13) goto L23A;
+L238: // D466 DRW V4, V6, 6
+    STEP(0x238, 0xD466);
+    c->pc = 0x238;
+    predecode(0xD466, &in);
+    execute(c, &in);
+    if (c->pc != 0x23A) goto dispatch;
+L23A: // 4612 SNE V6, 0x12
+    STEP(0x23A, 0x4612);
+    if (V[6] != 0x12) goto L23E;
+L23C: // D467 DRW V4, V6, 7
+    STEP(0x23C, 0xD467);
+    c->pc = 0x23C;
+    predecode(0xD467, &in);
+    execute(c, &in);
+    if (c->pc != 0x23E) goto dispatch;
+L23E: // 4611 SNE V6, 0x11
+    STEP(0x23E, 0x4611);
+    if (V[6] != 0x11) goto L242;
+L240: // D468 DRW V4, V6, 8
+    STEP(0x240, 0xD468);
+    c->pc = 0x240;
+    predecode(0xD468, &in);
+    execute(c, &in);
+    if (c->pc != 0x242) goto dispatch;
+L242: // 4610 SNE V6, 0x10
+    STEP(0x242, 0x4610);
+    if (V[6] != 0x10) goto L246;
+L244: // D469 DRW V4, V6, 9
+    STEP(0x244, 0xD469);
+    c->pc = 0x244;
+    predecode(0xD469, &in);
+    execute(c, &in);
+    if (c->pc != 0x246) goto dispatch;
+L246: // 460F SNE V6, 0x0F
+    STEP(0x246, 0x460F);
+    if (V[6] != 0x0F) goto L24A;
+L248: // D46A DRW V4, V6, 10
+    STEP(0x248, 0xD46A);
+    c->pc = 0x248;
+    predecode(0xD46A, &in);
+    execute(c, &in);
+    if (c->pc != 0x24A) goto dispatch;
+L24A: // 6619 LD V6, 0x19
+    STEP(0x24A, 0x6619);
+    V[6] = 0x19;
+L24C: // D466 DRW V4, V6, 6
+    STEP(0x24C, 0xD466);
+    c->pc = 0x24C;
+    predecode(0xD466, &in);
+    execute(c, &in);
+    if (c->pc != 0x24E) goto dispatch;
+L24E: // 1216 JP 0x216
+    STEP(0x24E, 0x1216);
+    goto L216;
+L250: // 6A00 LD VA, 0x00
+    STEP(0x250, 0x6A00);
+    V[10] = 0x00;
+L252: // 6B00 LD VB, 0x00
+    STEP(0x252, 0x6B00);
+    V[11] = 0x00;
+L254: // 6902 LD V9, 0x02
+    STEP(0x254, 0x6902);
+    V[9] = 0x02;
+L256: // A2FE LD I, 0x2FE
+    STEP(0x256, 0xA2FE);
+    c->I = 0x2FE;
+L258: // DAB1 DRW VA, VB, 1
+    STEP(0x258, 0xDAB1);
+    c->pc = 0x258;
+    predecode(0xDAB1, &in);
+    execute(c, &in);
+    if (c->pc != 0x25A) goto dispatch;
+L25A: // 6014 LD V0, 0x14
+    STEP(0x25A, 0x6014);
+    V[0] = 0x14;
+L25C: // F018 LD ST, V0
+    STEP(0x25C, 0xF018);
+    c->st = V[0];
+L25E: // 6014 LD V0, 0x14
+    STEP(0x25E, 0x6014);
+    V[0] = 0x14;
+L260: // F015 LD DT, V0
+    STEP(0x260, 0xF015);
+    c->dt = V[0];
+L262: // F007 LD V0, DT
+    STEP(0x262, 0xF007);
+    V[0] = c->dt;
+L264: // 3000 SE V0, 0x00
+    STEP(0x264, 0x3000);
+    if (V[0] == 0x00) goto L268;
+L266: // 1262 JP 0x262
+    STEP(0x266, 0x1262);
+    goto L262;
+L268: // 6001 LD V0, 0x01
+    STEP(0x268, 0x6001);
+    V[0] = 0x01;
+L26A: // F018 LD ST, V0
+    STEP(0x26A, 0xF018);
+    c->st = V[0];
+L26C: // DAB1 DRW VA, VB, 1
+    STEP(0x26C, 0xDAB1);
+    c->pc = 0x26C;
+    predecode(0xDAB1, &in);
+    execute(c, &in);
+    if (c->pc != 0x26E) goto dispatch;
+L26E: // 7A01 ADD VA, 0x01
+    STEP(0x26E, 0x7A01);
+    V[10] += 0x01;
+L270: // 4A3E SNE VA, 0x3E
+    STEP(0x270, 0x4A3E);
+    if (V[10] != 0x3E) goto L274;
+L272: // 2290 CALL 0x290
+    STEP(0x272, 0x2290);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x272;
+    goto L290;
+L274: // DAB1 DRW VA, VB, 1
+    STEP(0x274, 0xDAB1);
+    c->pc = 0x274;
+    predecode(0xDAB1, &in);
+    execute(c, &in);
+    if (c->pc != 0x276) goto dispatch;
+L276: // 4F01 SNE VF, 0x01
+    STEP(0x276, 0x4F01);
+    if (V[15] != 0x01) goto L27A;
+L278: // 129E JP 0x29E
+    STEP(0x278, 0x129E);
+    goto L29E;
+L27A: // 6008 LD V0, 0x08
+    STEP(0x27A, 0x6008);
+    V[0] = 0x08;
+L27C: // E0A1 SKNP V0
+    STEP(0x27C, 0xE0A1);
+    c->pc = 0x27C;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x27E) goto dispatch;
+L27E: // 22BE CALL 0x2BE
+    STEP(0x27E, 0x22BE);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x27E;
+    goto L2BE;
+L280: // 4801 SNE V8, 0x01
+    STEP(0x280, 0x4801);
+    if (V[8] != 0x01) goto L284;
+L282: // 22D6 CALL 0x2D6
+    STEP(0x282, 0x22D6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x282;
+    goto L2D6;
+L284: // 6002 LD V0, 0x02
+    STEP(0x284, 0x6002);
+    V[0] = 0x02;
+L286: // F015 LD DT, V0
+    STEP(0x286, 0xF015);
+    c->dt = V[0];
+L288: // F007 LD V0, DT
+    STEP(0x288, 0xF007);
+    V[0] = c->dt;
+L28A: // 3000 SE V0, 0x00
+    STEP(0x28A, 0x3000);
+    if (V[0] == 0x00) goto L28E;
+L28C: // 1288 JP 0x288
+    STEP(0x28C, 0x1288);
+    goto L288;
+L28E: // 1268 JP 0x268
+    STEP(0x28E, 0x1268);
+    goto L268;
+L290: // 79FF ADD V9, 0xFF
+    STEP(0x290, 0x79FF);
+    V[9] += 0xFF;
+L292: // 3900 SE V9, 0x00
+    STEP(0x292, 0x3900);
+    if (V[9] == 0x00) goto L296;
+L294: // 12FA JP 0x2FA
+    STEP(0x294, 0x12FA);
+    goto L2FA;
+L296: // 6A00 LD VA, 0x00
+    STEP(0x296, 0x6A00);
+    V[10] = 0x00;
+L298: // 7B01 ADD VB, 0x01
+    STEP(0x298, 0x7B01);
+    V[11] += 0x01;
+L29A: // 6902 LD V9, 0x02
+    STEP(0x29A, 0x6902);
+    V[9] = 0x02;
+L29C: // 00EE RET
+    STEP(0x29C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L29E: // 600A LD V0, 0x0A
+    STEP(0x29E, 0x600A);
+    V[0] = 0x0A;
+L2A0: // F018 LD ST, V0
+    STEP(0x2A0, 0xF018);
+    c->st = V[0];
+L2A2: // A30E LD I, 0x30E
+    STEP(0x2A2, 0xA30E);
+    c->I = 0x30E;
+L2A4: // F533 LD B, V5
+    STEP(0x2A4, 0xF533);
+    c->pc = 0x2A4;
+    predecode(0xF533, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2A6) goto dispatch;
+L2A6: // F265 LD V2, [I]
+    STEP(0x2A6, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2A8: // 6319 LD V3, 0x19
+    STEP(0x2A8, 0x6319);
+    V[3] = 0x19;
+L2AA: // 6400 LD V4, 0x00
+    STEP(0x2AA, 0x6400);
+    V[4] = 0x00;
+L2AC: // F029 LD F, V0
+    STEP(0x2AC, 0xF029);
+    c->I = V[0] * 5;
+L2AE: // D345 DRW V3, V4, 5
+    STEP(0x2AE, 0xD345);
+    c->pc = 0x2AE;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2B0) goto dispatch;
+L2B0: // 7305 ADD V3, 0x05
+    STEP(0x2B0, 0x7305);
+    V[3] += 0x05;
+L2B2: // F129 LD F, V1
+    STEP(0x2B2, 0xF129);
+    c->I = V[1] * 5;
+L2B4: // D345 DRW V3, V4, 5
+    STEP(0x2B4, 0xD345);
+    c->pc = 0x2B4;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2B6) goto dispatch;
+L2B6: // 7305 ADD V3, 0x05
+    STEP(0x2B6, 0x7305);
+    V[3] += 0x05;
+L2B8: // F229 LD F, V2
+    STEP(0x2B8, 0xF229);
+    c->I = V[2] * 5;
+L2BA: // D345 DRW V3, V4, 5
+    STEP(0x2BA, 0xD345);
+    c->pc = 0x2BA;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2BC) goto dispatch;
+L2BC: // 12BC JP 0x2BC
+    STEP(0x2BC, 0x12BC);
+    goto L2BC;
+L2BE: // 4801 SNE V8, 0x01
+    STEP(0x2BE, 0x4801);
+    if (V[8] != 0x01) goto L2C2;
+L2C0: // 00EE RET
+    STEP(0x2C0, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2C2: // 6801 LD V8, 0x01
+    STEP(0x2C2, 0x6801);
+    V[8] = 0x01;
+L2C4: // 6003 LD V0, 0x03
+    STEP(0x2C4, 0x6003);
+    V[0] = 0x03;
+L2C6: // F018 LD ST, V0
+    STEP(0x2C6, 0xF018);
+    c->st = V[0];
+L2C8: // 8DA0 LD VD, VA
+    STEP(0x2C8, 0x8DA0);
+    V[13] = V[10];
+L2CA: // 8EB0 LD VE, VB
+    STEP(0x2CA, 0x8EB0);
+    V[14] = V[11];
+L2CC: // 7D01 ADD VD, 0x01
+    STEP(0x2CC, 0x7D01);
+    V[13] += 0x01;
+L2CE: // 7E01 ADD VE, 0x01
+    STEP(0x2CE, 0x7E01);
+    V[14] += 0x01;
+L2D0: // A30C LD I, 0x30C
+    STEP(0x2D0, 0xA30C);
+    c->I = 0x30C;
+L2D2: // DDE1 DRW VD, VE, 1
+    STEP(0x2D2, 0xDDE1);
+    c->pc = 0x2D2;
+    predecode(0xDDE1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2D4) goto dispatch;
+L2D4: // 00EE RET
+    STEP(0x2D4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2D6: // A30C LD I, 0x30C
+    STEP(0x2D6, 0xA30C);
+    c->I = 0x30C;
+L2D8: // DDE1 DRW VD, VE, 1
+    STEP(0x2D8, 0xDDE1);
+    c->pc = 0x2D8;
+    predecode(0xDDE1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2DA) goto dispatch;
+L2DA: // 7E01 ADD VE, 0x01
+    STEP(0x2DA, 0x7E01);
+    V[14] += 0x01;
+L2DC: // DDE1 DRW VD, VE, 1
+    STEP(0x2DC, 0xDDE1);
+    c->pc = 0x2DC;
+    predecode(0xDDE1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2DE) goto dispatch;
+L2DE: // 4F01 SNE VF, 0x01
+    STEP(0x2DE, 0x4F01);
+    if (V[15] != 0x01) goto L2E2;
+L2E0: // 12EA JP 0x2EA
+    STEP(0x2E0, 0x12EA);
+    goto L2EA;
+L2E2: // 6001 LD V0, 0x01
+    STEP(0x2E2, 0x6001);
+    V[0] = 0x01;
+L2E4: // F018 LD ST, V0
+    STEP(0x2E4, 0xF018);
+    c->st = V[0];
+L2E6: // A2FE LD I, 0x2FE
+    STEP(0x2E6, 0xA2FE);
+    c->I = 0x2FE;
+L2E8: // 00EE RET
+    STEP(0x2E8, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2EA: // 7501 ADD V5, 0x01
+    STEP(0x2EA, 0x7501);
+    V[5] += 0x01;
+L2EC: // 6005 LD V0, 0x05
+    STEP(0x2EC, 0x6005);
+    V[0] = 0x05;
+L2EE: // F018 LD ST, V0
+    STEP(0x2EE, 0xF018);
+    c->st = V[0];
+L2F0: // 6800 LD V8, 0x00
+    STEP(0x2F0, 0x6800);
+    V[8] = 0x00;
+L2F2: // 4E1F SNE VE, 0x1F
+    STEP(0x2F2, 0x4E1F);
+    if (V[14] != 0x1F) goto L2F6;
+L2F4: // DDE1 DRW VD, VE, 1
+    STEP(0x2F4, 0xDDE1);
+    c->pc = 0x2F4;
+    predecode(0xDDE1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2F6) goto dispatch;
+L2F6: // A2FE LD I, 0x2FE
+    STEP(0x2F6, 0xA2FE);
+    c->I = 0x2FE;
+L2F8: // 00EE RET
+    STEP(0x2F8, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2FA: // 6A00 LD VA, 0x00
+    STEP(0x2FA, 0x6A00);
+    V[10] = 0x00;
+L2FC: // 00EE RET
+    STEP(0x2FC, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,119 @@
+// generated by chip8-aot from roms/MAZE.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x60, 0x00, 0x61, 0x00, 0xA2, 0x22, 0xC2, 0x01, 0x32, 0x01, 0xA2, 0x1E,
+    0xD0, 0x14, 0x70, 0x04, 0x30, 0x40, 0x12, 0x04, 0x60, 0x00, 0x71, 0x04,
+    0x31, 0x20, 0x12, 0x04, 0x12, 0x1C, 0x80, 0x40, 0x20, 0x10, 0x20, 0x40,
+    0x80, 0x10,
+};
+const size_t aot_rom_size = 38;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000100ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 6000 LD V0, 0x00
+    STEP(0x200, 0x6000);
+    V[0] = 0x00;
+L202: // 6100 LD V1, 0x00
+    STEP(0x202, 0x6100);
+    V[1] = 0x00;
+L204: // A222 LD I, 0x222
+    STEP(0x204, 0xA222);
+    c->I = 0x222;
+L206: // C201 RND V2, 0x01
+    STEP(0x206, 0xC201);
+    c->pc = 0x206;
+    predecode(0xC201, &in);
+    execute(c, &in);
+    if (c->pc != 0x208) goto dispatch;
+L208: // 3201 SE V2, 0x01
+    STEP(0x208, 0x3201);
+    if (V[2] == 0x01) goto L20C;
+L20A: // A21E LD I, 0x21E
+    STEP(0x20A, 0xA21E);
+    c->I = 0x21E;
+L20C: // D014 DRW V0, V1, 4
+    STEP(0x20C, 0xD014);
+    c->pc = 0x20C;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x20E) goto dispatch;
+L20E: // 7004 ADD V0, 0x04
+    STEP(0x20E, 0x7004);
+    V[0] += 0x04;
+L210: // 3040 SE V0, 0x40
+    STEP(0x210, 0x3040);
+    if (V[0] == 0x40) goto L214;
+L212: // 1204 JP 0x204
+    STEP(0x212, 0x1204);
+    goto L204;
+L214: // 6000 LD V0, 0x00
+    STEP(0x214, 0x6000);
+    V[0] = 0x00;
+L216: // 7104 ADD V1, 0x04
+    STEP(0x216, 0x7104);
+    V[1] += 0x04;
+L218: // 3120 SE V1, 0x20
+    STEP(0x218, 0x3120);
+    if (V[1] == 0x20) goto L21C;
+L21A: // 1204 JP 0x204
+    STEP(0x21A, 0x1204);
+    goto L204;
+L21C: // 121C JP 0x21C
+    STEP(0x21C, 0x121C);
+    goto L21C;
+}
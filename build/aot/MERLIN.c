@@ -0,0 +1,656 @@
+// generated by chip8-aot from roms/MERLIN.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x12, 0x19, 0x20, 0x4D, 0x45, 0x52, 0x4C, 0x49, 0x4E, 0x20, 0x42, 0x79,
+    0x20, 0x44, 0x61, 0x76, 0x69, 0x64, 0x20, 0x57, 0x49, 0x4E, 0x54, 0x45,
+    0x52, 0x22, 0xF9, 0xA3, 0x1D, 0x60, 0x10, 0x61, 0x00, 0x22, 0xCB, 0xA3,
+    0x31, 0x60, 0x0B, 0x61, 0x1B, 0x22, 0xCB, 0x64, 0x04, 0x22, 0xDF, 0x65,
+    0x00, 0x62, 0x28, 0x22, 0xC1, 0xC2, 0x03, 0x80, 0x20, 0xA3, 0x59, 0xF5,
+    0x1E, 0xF0, 0x55, 0x60, 0x17, 0x61, 0x08, 0x63, 0x01, 0x83, 0x22, 0x33,
+    0x00, 0x70, 0x0A, 0x63, 0x02, 0x83, 0x22, 0x33, 0x00, 0x71, 0x0A, 0xA3,
+    0x17, 0xD0, 0x16, 0x62, 0x14, 0x22, 0xC1, 0xD0, 0x16, 0x62, 0x05, 0x22,
+    0xC1, 0x75, 0x01, 0x54, 0x50, 0x12, 0x35, 0x65, 0x00, 0x60, 0x17, 0x61,
+    0x08, 0xA3, 0x17, 0xF3, 0x0A, 0x33, 0x04, 0x12, 0x79, 0x63, 0x00, 0x12,
+    0x97, 0x33, 0x05, 0x12, 0x83, 0x70, 0x0A, 0x63, 0x01, 0x12, 0x97, 0x33,
+    0x07, 0x12, 0x8D, 0x71, 0x0A, 0x63, 0x02, 0x12, 0x97, 0x33, 0x08, 0x12,
+    0x69, 0x70, 0x0A, 0x71, 0x0A, 0x63, 0x03, 0xD0, 0x16, 0x62, 0x14, 0x22,
+    0xC1, 0xD0, 0x16, 0xA3, 0x59, 0xF5, 0x1E, 0xF0, 0x65, 0x75, 0x01, 0x50,
+    0x30, 0x12, 0xB5, 0x55, 0x40, 0x12, 0x69, 0x22, 0xDF, 0x74, 0x01, 0x12,
+    0x2D, 0x22, 0xF9, 0xA3, 0x45, 0x60, 0x10, 0x61, 0x0E, 0x22, 0xCB, 0x12,
+    0xBF, 0xF2, 0x15, 0xF2, 0x07, 0x32, 0x00, 0x12, 0xC3, 0x00, 0xEE, 0x83,
+    0x00, 0x62, 0x05, 0xD0, 0x15, 0xF2, 0x1E, 0x70, 0x08, 0x85, 0x30, 0x75,
+    0x20, 0x50, 0x50, 0x12, 0xCF, 0x00, 0xEE, 0xA3, 0x59, 0x83, 0x40, 0x73,
+    0xFD, 0xF3, 0x33, 0xF2, 0x65, 0xF1, 0x29, 0x60, 0x2B, 0x63, 0x1B, 0xD0,
+    0x35, 0x70, 0x05, 0xF2, 0x29, 0xD0, 0x35, 0x00, 0xEE, 0xA3, 0x0F, 0x60,
+    0x17, 0x61, 0x07, 0xD0, 0x18, 0x70, 0x0A, 0xD0, 0x18, 0x71, 0x0A, 0xD0,
+    0x18, 0x70, 0xF6, 0xD0, 0x18, 0x00, 0xEE, 0xFF, 0x81, 0x81, 0x81, 0x81,
+    0x81, 0x81, 0xFF, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0x7E, 0xDB, 0xAA, 0x8B,
+    0xCB, 0xCB, 0xEF, 0x08, 0x8F, 0x0D, 0xEC, 0xA0, 0xA0, 0xB0, 0x30, 0xBE,
+    0x5F, 0x51, 0x51, 0xD9, 0xD9, 0x83, 0x82, 0x83, 0x82, 0xFB, 0xE8, 0x08,
+    0x88, 0x05, 0xE2, 0xBE, 0xA0, 0xB8, 0x20, 0x3E, 0x80, 0x80, 0x80, 0x80,
+    0xF8, 0xF7, 0x85, 0xB7, 0x95, 0xF5, 0x76, 0x54, 0x56, 0x54, 0x56, 0x3A,
+    0x2A, 0x2A, 0x2A, 0x39, 0xB6, 0xA5, 0xB6, 0xA5, 0x35,
+};
+const size_t aot_rom_size = 345;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000001F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x219: goto L219;
+        case 0x21B: goto L21B;
+        case 0x21D: goto L21D;
+        case 0x21F: goto L21F;
+        case 0x221: goto L221;
+        case 0x223: goto L223;
+        case 0x225: goto L225;
+        case 0x227: goto L227;
+        case 0x229: goto L229;
+        case 0x22B: goto L22B;
+        case 0x22D: goto L22D;
+        case 0x22F: goto L22F;
+        case 0x231: goto L231;
+        case 0x233: goto L233;
+        case 0x235: goto L235;
+        case 0x237: goto L237;
+        case 0x239: goto L239;
+        case 0x23B: goto L23B;
+        case 0x23D: goto L23D;
+        case 0x23F: goto L23F;
+        case 0x241: goto L241;
+        case 0x243: goto L243;
+        case 0x245: goto L245;
+        case 0x247: goto L247;
+        case 0x249: goto L249;
+        case 0x24B: goto L24B;
+        case 0x24D: goto L24D;
+        case 0x24F: goto L24F;
+        case 0x251: goto L251;
+        case 0x253: goto L253;
+        case 0x255: goto L255;
+        case 0x257: goto L257;
+        case 0x259: goto L259;
+        case 0x25B: goto L25B;
+        case 0x25D: goto L25D;
+        case 0x25F: goto L25F;
+        case 0x261: goto L261;
+        case 0x263: goto L263;
+        case 0x265: goto L265;
+        case 0x267: goto L267;
+        case 0x269: goto L269;
+        case 0x26B: goto L26B;
+        case 0x26D: goto L26D;
+        case 0x26F: goto L26F;
+        case 0x271: goto L271;
+        case 0x273: goto L273;
+        case 0x275: goto L275;
+        case 0x277: goto L277;
+        case 0x279: goto L279;
+        case 0x27B: goto L27B;
+        case 0x27D: goto L27D;
+        case 0x27F: goto L27F;
+        case 0x281: goto L281;
+        case 0x283: goto L283;
+        case 0x285: goto L285;
+        case 0x287: goto L287;
+        case 0x289: goto L289;
+        case 0x28B: goto L28B;
+        case 0x28D: goto L28D;
+        case 0x28F: goto L28F;
+        case 0x291: goto L291;
+        case 0x293: goto L293;
+        case 0x295: goto L295;
+        case 0x297: goto L297;
+        case 0x299: goto L299;
+        case 0x29B: goto L29B;
+        case 0x29D: goto L29D;
+        case 0x29F: goto L29F;
+        case 0x2A1: goto L2A1;
+        case 0x2A3: goto L2A3;
+        case 0x2A5: goto L2A5;
+        case 0x2A7: goto L2A7;
+        case 0x2A9: goto L2A9;
+        case 0x2AB: goto L2AB;
+        case 0x2AD: goto L2AD;
+        case 0x2AF: goto L2AF;
+        case 0x2B1: goto L2B1;
+        case 0x2B3: goto L2B3;
+        case 0x2B5: goto L2B5;
+        case 0x2B7: goto L2B7;
+        case 0x2B9: goto L2B9;
+        case 0x2BB: goto L2BB;
+        case 0x2BD: goto L2BD;
+        case 0x2BF: goto L2BF;
+        case 0x2C1: goto L2C1;
+        case 0x2C3: goto L2C3;
+        case 0x2C5: goto L2C5;
+        case 0x2C7: goto L2C7;
+        case 0x2C9: goto L2C9;
+        case 0x2CB: goto L2CB;
+        case 0x2CD: goto L2CD;
+        case 0x2CF: goto L2CF;
+        case 0x2D1: goto L2D1;
+        case 0x2D3: goto L2D3;
+        case 0x2D5: goto L2D5;
+        case 0x2D7: goto L2D7;
+        case 0x2D9: goto L2D9;
+        case 0x2DB: goto L2DB;
+        case 0x2DD: goto L2DD;
+        case 0x2DF: goto L2DF;
+        case 0x2E1: goto L2E1;
+        case 0x2E3: goto L2E3;
+        case 0x2E5: goto L2E5;
+        case 0x2E7: goto L2E7;
+        case 0x2E9: goto L2E9;
+        case 0x2EB: goto L2EB;
+        case 0x2ED: goto L2ED;
+        case 0x2EF: goto L2EF;
+        case 0x2F1: goto L2F1;
+        case 0x2F3: goto L2F3;
+        case 0x2F5: goto L2F5;
+        case 0x2F7: goto L2F7;
+        case 0x2F9: goto L2F9;
+        case 0x2FB: goto L2FB;
+        case 0x2FD: goto L2FD;
+        case 0x2FF: goto L2FF;
+        case 0x301: goto L301;
+        case 0x303: goto L303;
+        case 0x305: goto L305;
+        case 0x307: goto L307;
+        case 0x309: goto L309;
+        case 0x30B: goto L30B;
+        case 0x30D: goto L30D;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 1219 JP 0x219
+    STEP(0x200, 0x1219);
+    goto L219;
+L219: // 22F9 CALL 0x2F9
+    STEP(0x219, 0x22F9);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x219;
+    goto L2F9;
+L21B: // A31D LD I, 0x31D
+    STEP(0x21B, 0xA31D);
+    c->I = 0x31D;
+L21D: // 6010 LD V0, 0x10
+    STEP(0x21D, 0x6010);
+    V[0] = 0x10;
+L21F: // 6100 LD V1, 0x00
+    STEP(0x21F, 0x6100);
+    V[1] = 0x00;
+L221: // 22CB CALL 0x2CB
+    STEP(0x221, 0x22CB);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x221;
+    goto L2CB;
+L223: // A331 LD I, 0x331
+    STEP(0x223, 0xA331);
+    c->I = 0x331;
+L225: // 600B LD V0, 0x0B
+    STEP(0x225, 0x600B);
+    V[0] = 0x0B;
+L227: // 611B LD V1, 0x1B
+    STEP(0x227, 0x611B);
+    V[1] = 0x1B;
+L229: // 22CB CALL 0x2CB
+    STEP(0x229, 0x22CB);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x229;
+    goto L2CB;
+L22B: // 6404 LD V4, 0x04
+    STEP(0x22B, 0x6404);
+    V[4] = 0x04;
+L22D: // 22DF CALL 0x2DF
+    STEP(0x22D, 0x22DF);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x22D;
+    goto L2DF;
+L22F: // 6500 LD V5, 0x00
+    STEP(0x22F, 0x6500);
+    V[5] = 0x00;
+L231: // 6228 LD V2, 0x28
+    STEP(0x231, 0x6228);
+    V[2] = 0x28;
+L233: // 22C1 CALL 0x2C1
+    STEP(0x233, 0x22C1);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x233;
+    goto L2C1;
+L235: // C203 RND V2, 0x03
+    STEP(0x235, 0xC203);
+    c->pc = 0x235;
+    predecode(0xC203, &in);
+    execute(c, &in);
+    if (c->pc != 0x237) goto dispatch;
+L237: // 8020 LD V0, V2
+    STEP(0x237, 0x8020);
+    V[0] = V[2];
+L239: // A359 LD I, 0x359
+    STEP(0x239, 0xA359);
+    c->I = 0x359;
+L23B: // F51E ADD I, V5
+    STEP(0x23B, 0xF51E);
+    c->I += V[5];
+L23D: // F055 LD [I], V0
+    STEP(0x23D, 0xF055);
+    c->pc = 0x23D;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x23F) goto dispatch;
+L23F: // 6017 LD V0, 0x17
+    STEP(0x23F, 0x6017);
+    V[0] = 0x17;
+L241: // 6108 LD V1, 0x08
+    STEP(0x241, 0x6108);
+    V[1] = 0x08;
+L243: // 6301 LD V3, 0x01
+    STEP(0x243, 0x6301);
+    V[3] = 0x01;
+L245: // 8322 AND V3, V2
+    STEP(0x245, 0x8322);
+    V[3] &= V[2];
+L247: // 3300 SE V3, 0x00
+    STEP(0x247, 0x3300);
+    if (V[3] == 0x00) goto L24B;
+L249: // 700A ADD V0, 0x0A
+    STEP(0x249, 0x700A);
+    V[0] += 0x0A;
+L24B: // 6302 LD V3, 0x02
+    STEP(0x24B, 0x6302);
+    V[3] = 0x02;
+L24D: // 8322 AND V3, V2
+    STEP(0x24D, 0x8322);
+    V[3] &= V[2];
+L24F: // 3300 SE V3, 0x00
+    STEP(0x24F, 0x3300);
+    if (V[3] == 0x00) goto L253;
+L251: // 710A ADD V1, 0x0A
+    STEP(0x251, 0x710A);
+    V[1] += 0x0A;
+L253: // A317 LD I, 0x317
+    STEP(0x253, 0xA317);
+    c->I = 0x317;
+L255: // D016 DRW V0, V1, 6
+    STEP(0x255, 0xD016);
+    c->pc = 0x255;
+    predecode(0xD016, &in);
+    execute(c, &in);
+    if (c->pc != 0x257) goto dispatch;
+L257: // 6214 LD V2, 0x14
+    STEP(0x257, 0x6214);
+    V[2] = 0x14;
+L259: // 22C1 CALL 0x2C1
+    STEP(0x259, 0x22C1);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x259;
+    goto L2C1;
+L25B: // D016 DRW V0, V1, 6
+    STEP(0x25B, 0xD016);
+    c->pc = 0x25B;
+    predecode(0xD016, &in);
+    execute(c, &in);
+    if (c->pc != 0x25D) goto dispatch;
+L25D: // 6205 LD V2, 0x05
+    STEP(0x25D, 0x6205);
+    V[2] = 0x05;
+L25F: // 22C1 CALL 0x2C1
+    STEP(0x25F, 0x22C1);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x25F;
+    goto L2C1;
+L261: // 7501 ADD V5, 0x01
+    STEP(0x261, 0x7501);
+    V[5] += 0x01;
+L263: // 5450 SE V4, V5
+    STEP(0x263, 0x5450);
+    if (V[4] == V[5]) goto L267;
+L265: // 1235 JP 0x235
+    STEP(0x265, 0x1235);
+    goto L235;
+L267: // 6500 LD V5, 0x00
+    STEP(0x267, 0x6500);
+    V[5] = 0x00;
+L269: // 6017 LD V0, 0x17
+    STEP(0x269, 0x6017);
+    V[0] = 0x17;
+L26B: // 6108 LD V1, 0x08
+    STEP(0x26B, 0x6108);
+    V[1] = 0x08;
+L26D: // A317 LD I, 0x317
+    STEP(0x26D, 0xA317);
+    c->I = 0x317;
+L26F: // F30A LD V3, K
+    STEP(0x26F, 0xF30A);
+    if (c->keypad == 0) {
+        c->pc = 0x26F;
+        return cycles - left;
+    }
+    V[3] = __builtin_ctz(c->keypad);
+L271: // 3304 SE V3, 0x04
+    STEP(0x271, 0x3304);
+    if (V[3] == 0x04) goto L275;
+L273: // 1279 JP 0x279
+    STEP(0x273, 0x1279);
+    goto L279;
+L275: // 6300 LD V3, 0x00
+    STEP(0x275, 0x6300);
+    V[3] = 0x00;
+L277: // 1297 JP 0x297
+    STEP(0x277, 0x1297);
+    goto L297;
+L279: // 3305 SE V3, 0x05
+    STEP(0x279, 0x3305);
+    if (V[3] == 0x05) goto L27D;
+L27B: // 1283 JP 0x283
+    STEP(0x27B, 0x1283);
+    goto L283;
+L27D: // 700A ADD V0, 0x0A
+    STEP(0x27D, 0x700A);
+    V[0] += 0x0A;
+L27F: // 6301 LD V3, 0x01
+    STEP(0x27F, 0x6301);
+    V[3] = 0x01;
+L281: // 1297 JP 0x297
+    STEP(0x281, 0x1297);
+    goto L297;
+L283: // 3307 SE V3, 0x07
+    STEP(0x283, 0x3307);
+    if (V[3] == 0x07) goto L287;
+L285: // 128D JP 0x28D
+    STEP(0x285, 0x128D);
+    goto L28D;
+L287: // 710A ADD V1, 0x0A
+    STEP(0x287, 0x710A);
+    V[1] += 0x0A;
+L289: // 6302 LD V3, 0x02
+    STEP(0x289, 0x6302);
+    V[3] = 0x02;
+L28B: // 1297 JP 0x297
+    STEP(0x28B, 0x1297);
+    goto L297;
+L28D: // 3308 SE V3, 0x08
+    STEP(0x28D, 0x3308);
+    if (V[3] == 0x08) goto L291;
+L28F: // 1269 JP 0x269
+    STEP(0x28F, 0x1269);
+    goto L269;
+L291: // 700A ADD V0, 0x0A
+    STEP(0x291, 0x700A);
+    V[0] += 0x0A;
+L293: // 710A ADD V1, 0x0A
+    STEP(0x293, 0x710A);
+    V[1] += 0x0A;
+L295: // 6303 LD V3, 0x03
+    STEP(0x295, 0x6303);
+    V[3] = 0x03;
+L297: // D016 DRW V0, V1, 6
+    STEP(0x297, 0xD016);
+    c->pc = 0x297;
+    predecode(0xD016, &in);
+    execute(c, &in);
+    if (c->pc != 0x299) goto dispatch;
+L299: // 6214 LD V2, 0x14
+    STEP(0x299, 0x6214);
+    V[2] = 0x14;
+L29B: // 22C1 CALL 0x2C1
+    STEP(0x29B, 0x22C1);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x29B;
+    goto L2C1;
+L29D: // D016 DRW V0, V1, 6
+    STEP(0x29D, 0xD016);
+    c->pc = 0x29D;
+    predecode(0xD016, &in);
+    execute(c, &in);
+    if (c->pc != 0x29F) goto dispatch;
+L29F: // A359 LD I, 0x359
+    STEP(0x29F, 0xA359);
+    c->I = 0x359;
+L2A1: // F51E ADD I, V5
+    STEP(0x2A1, 0xF51E);
+    c->I += V[5];
+L2A3: // F065 LD V0, [I]
+    STEP(0x2A3, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2A5: // 7501 ADD V5, 0x01
+    STEP(0x2A5, 0x7501);
+    V[5] += 0x01;
+L2A7: // 5030 SE V0, V3
+    STEP(0x2A7, 0x5030);
+    if (V[0] == V[3]) goto L2AB;
+L2A9: // 12B5 JP 0x2B5
+    STEP(0x2A9, 0x12B5);
+    goto L2B5;
+L2AB: // 5540 SE V5, V4
+    STEP(0x2AB, 0x5540);
+    if (V[5] == V[4]) goto L2AF;
+L2AD: // 1269 JP 0x269
+    STEP(0x2AD, 0x1269);
+    goto L269;
+L2AF: // 22DF CALL 0x2DF
+    STEP(0x2AF, 0x22DF);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2AF;
+    goto L2DF;
+L2B1: // 7401 ADD V4, 0x01
+    STEP(0x2B1, 0x7401);
+    V[4] += 0x01;
+L2B3: // 122D JP 0x22D
+    STEP(0x2B3, 0x122D);
+    goto L22D;
+L2B5: // 22F9 CALL 0x2F9
+    STEP(0x2B5, 0x22F9);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2B5;
+    goto L2F9;
+L2B7: // A345 LD I, 0x345
+    STEP(0x2B7, 0xA345);
+    c->I = 0x345;
+L2B9: // 6010 LD V0, 0x10
+    STEP(0x2B9, 0x6010);
+    V[0] = 0x10;
+L2BB: // 610E LD V1, 0x0E
+    STEP(0x2BB, 0x610E);
+    V[1] = 0x0E;
+L2BD: // 22CB CALL 0x2CB
+    STEP(0x2BD, 0x22CB);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2BD;
+    goto L2CB;
+L2BF: // 12BF JP 0x2BF
+    STEP(0x2BF, 0x12BF);
+    goto L2BF;
+L2C1: // F215 LD DT, V2
+    STEP(0x2C1, 0xF215);
+    c->dt = V[2];
+L2C3: // F207 LD V2, DT
+    STEP(0x2C3, 0xF207);
+    V[2] = c->dt;
+L2C5: // 3200 SE V2, 0x00
+    STEP(0x2C5, 0x3200);
+    if (V[2] == 0x00) goto L2C9;
+L2C7: // 12C3 JP 0x2C3
+    STEP(0x2C7, 0x12C3);
+    goto L2C3;
+L2C9: // 00EE RET
+    STEP(0x2C9, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2CB: // 8300 LD V3, V0
+    STEP(0x2CB, 0x8300);
+    V[3] = V[0];
+L2CD: // 6205 LD V2, 0x05
+    STEP(0x2CD, 0x6205);
+    V[2] = 0x05;
+L2CF: // D015 DRW V0, V1, 5
+    STEP(0x2CF, 0xD015);
+    c->pc = 0x2CF;
+    predecode(0xD015, &in);
+    execute(c, &in);
+    if (c->pc != 0x2D1) goto dispatch;
+L2D1: // F21E ADD I, V2
+    STEP(0x2D1, 0xF21E);
+    c->I += V[2];
+L2D3: // 7008 ADD V0, 0x08
+    STEP(0x2D3, 0x7008);
+    V[0] += 0x08;
+L2D5: // 8530 LD V5, V3
+    STEP(0x2D5, 0x8530);
+    V[5] = V[3];
+L2D7: // 7520 ADD V5, 0x20
+    STEP(0x2D7, 0x7520);
+    V[5] += 0x20;
+L2D9: // 5050 SE V0, V5
+    STEP(0x2D9, 0x5050);
+    if (V[0] == V[5]) goto L2DD;
+L2DB: // 12CF JP 0x2CF
+    STEP(0x2DB, 0x12CF);
+    goto L2CF;
+L2DD: // 00EE RET
+    STEP(0x2DD, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2DF: // A359 LD I, 0x359
+    STEP(0x2DF, 0xA359);
+    c->I = 0x359;
+L2E1: // 8340 LD V3, V4
+    STEP(0x2E1, 0x8340);
+    V[3] = V[4];
+L2E3: // 73FD ADD V3, 0xFD
+    STEP(0x2E3, 0x73FD);
+    V[3] += 0xFD;
+L2E5: // F333 LD B, V3
+    STEP(0x2E5, 0xF333);
+    c->pc = 0x2E5;
+    predecode(0xF333, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2E7) goto dispatch;
+L2E7: // F265 LD V2, [I]
+    STEP(0x2E7, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2E9: // F129 LD F, V1
+    STEP(0x2E9, 0xF129);
+    c->I = V[1] * 5;
+L2EB: // 602B LD V0, 0x2B
+    STEP(0x2EB, 0x602B);
+    V[0] = 0x2B;
+L2ED: // 631B LD V3, 0x1B
+    STEP(0x2ED, 0x631B);
+    V[3] = 0x1B;
+L2EF: // D035 DRW V0, V3, 5
+    STEP(0x2EF, 0xD035);
+    c->pc = 0x2EF;
+    predecode(0xD035, &in);
+    execute(c, &in);
+    if (c->pc != 0x2F1) goto dispatch;
+L2F1: // 7005 ADD V0, 0x05
+    STEP(0x2F1, 0x7005);
+    V[0] += 0x05;
+L2F3: // F229 LD F, V2
+    STEP(0x2F3, 0xF229);
+    c->I = V[2] * 5;
+L2F5: // D035 DRW V0, V3, 5
+    STEP(0x2F5, 0xD035);
+    c->pc = 0x2F5;
+    predecode(0xD035, &in);
+    execute(c, &in);
+    if (c->pc != 0x2F7) goto dispatch;
+L2F7: // 00EE RET
+    STEP(0x2F7, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2F9: // A30F LD I, 0x30F
+    STEP(0x2F9, 0xA30F);
+    c->I = 0x30F;
+L2FB: // 6017 LD V0, 0x17
+    STEP(0x2FB, 0x6017);
+    V[0] = 0x17;
+L2FD: // 6107 LD V1, 0x07
+    STEP(0x2FD, 0x6107);
+    V[1] = 0x07;
+L2FF: // D018 DRW V0, V1, 8
+    STEP(0x2FF, 0xD018);
+    c->pc = 0x2FF;
+    predecode(0xD018, &in);
+    execute(c, &in);
+    if (c->pc != 0x301) goto dispatch;
+L301: // 700A ADD V0, 0x0A
+    STEP(0x301, 0x700A);
+    V[0] += 0x0A;
+L303: // D018 DRW V0, V1, 8
+    STEP(0x303, 0xD018);
+    c->pc = 0x303;
+    predecode(0xD018, &in);
+    execute(c, &in);
+    if (c->pc != 0x305) goto dispatch;
+L305: // 710A ADD V1, 0x0A
+    STEP(0x305, 0x710A);
+    V[1] += 0x0A;
+L307: // D018 DRW V0, V1, 8
+    STEP(0x307, 0xD018);
+    c->pc = 0x307;
+    predecode(0xD018, &in);
+    execute(c, &in);
+    if (c->pc != 0x309) goto dispatch;
+L309: // 70F6 ADD V0, 0xF6
+    STEP(0x309, 0x70F6);
+    V[0] += 0xF6;
+L30B: // D018 DRW V0, V1, 8
+    STEP(0x30B, 0xD018);
+    c->pc = 0x30B;
+    predecode(0xD018, &in);
+    execute(c, &in);
+    if (c->pc != 0x30D) goto dispatch;
+L30D: // 00EE RET
+    STEP(0x30D, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
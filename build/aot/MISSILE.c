@@ -0,0 +1,406 @@
+// generated by chip8-aot from roms/MISSILE.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x12, 0x19, 0x4D, 0x49, 0x53, 0x53, 0x49, 0x4C, 0x45, 0x20, 0x62, 0x79,
+    0x20, 0x44, 0x61, 0x76, 0x69, 0x64, 0x20, 0x57, 0x49, 0x4E, 0x54, 0x45,
+    0x52, 0x6C, 0x0C, 0x60, 0x00, 0x61, 0x00, 0x65, 0x08, 0x66, 0x0A, 0x67,
+    0x00, 0x6E, 0x01, 0xA2, 0xAD, 0xD0, 0x14, 0x70, 0x08, 0x30, 0x40, 0x12,
+    0x29, 0x60, 0x00, 0x61, 0x1C, 0xA2, 0xB0, 0xD0, 0x14, 0xA2, 0xB0, 0xD0,
+    0x14, 0x3E, 0x01, 0x12, 0x49, 0x70, 0x04, 0x40, 0x38, 0x6E, 0x00, 0x12,
+    0x4F, 0x70, 0xFC, 0x40, 0x00, 0x6E, 0x01, 0xD0, 0x14, 0xFC, 0x15, 0xFB,
+    0x07, 0x3B, 0x00, 0x12, 0x53, 0x62, 0x08, 0xE2, 0x9E, 0x12, 0x95, 0x3C,
+    0x00, 0x7C, 0xFE, 0x63, 0x1B, 0x82, 0x00, 0xA2, 0xB0, 0xD2, 0x31, 0x64,
+    0x00, 0xD2, 0x31, 0x73, 0xFF, 0xD2, 0x31, 0x3F, 0x00, 0x64, 0x01, 0x33,
+    0x03, 0x12, 0x6D, 0xD2, 0x31, 0x34, 0x01, 0x12, 0x91, 0x77, 0x05, 0x75,
+    0xFF, 0x82, 0x00, 0x63, 0x00, 0xA2, 0xAD, 0xD2, 0x34, 0x45, 0x00, 0x12,
+    0x97, 0x76, 0xFF, 0x36, 0x00, 0x12, 0x39, 0xA2, 0xB4, 0xF7, 0x33, 0xF2,
+    0x65, 0x63, 0x1B, 0x64, 0x0D, 0xF1, 0x29, 0xD3, 0x45, 0x73, 0x05, 0xF2,
+    0x29, 0xD3, 0x45, 0x12, 0xAB, 0x10, 0x38, 0x38, 0x10, 0x38, 0x7C, 0xFE,
+};
+const size_t aot_rom_size = 180;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000700ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x219: goto L219;
+        case 0x21B: goto L21B;
+        case 0x21D: goto L21D;
+        case 0x21F: goto L21F;
+        case 0x221: goto L221;
+        case 0x223: goto L223;
+        case 0x225: goto L225;
+        case 0x227: goto L227;
+        case 0x229: goto L229;
+        case 0x22B: goto L22B;
+        case 0x22D: goto L22D;
+        case 0x22F: goto L22F;
+        case 0x231: goto L231;
+        case 0x233: goto L233;
+        case 0x235: goto L235;
+        case 0x237: goto L237;
+        case 0x239: goto L239;
+        case 0x23B: goto L23B;
+        case 0x23D: goto L23D;
+        case 0x23F: goto L23F;
+        case 0x241: goto L241;
+        case 0x243: goto L243;
+        case 0x245: goto L245;
+        case 0x247: goto L247;
+        case 0x249: goto L249;
+        case 0x24B: goto L24B;
+        case 0x24D: goto L24D;
+        case 0x24F: goto L24F;
+        case 0x251: goto L251;
+        case 0x253: goto L253;
+        case 0x255: goto L255;
+        case 0x257: goto L257;
+        case 0x259: goto L259;
+        case 0x25B: goto L25B;
+        case 0x25D: goto L25D;
+        case 0x25F: goto L25F;
+        case 0x261: goto L261;
+        case 0x263: goto L263;
+        case 0x265: goto L265;
+        case 0x267: goto L267;
+        case 0x269: goto L269;
+        case 0x26B: goto L26B;
+        case 0x26D: goto L26D;
+        case 0x26F: goto L26F;
+        case 0x271: goto L271;
+        case 0x273: goto L273;
+        case 0x275: goto L275;
+        case 0x277: goto L277;
+        case 0x279: goto L279;
+        case 0x27B: goto L27B;
+        case 0x27D: goto L27D;
+        case 0x27F: goto L27F;
+        case 0x281: goto L281;
+        case 0x283: goto L283;
+        case 0x285: goto L285;
+        case 0x287: goto L287;
+        case 0x289: goto L289;
+        case 0x28B: goto L28B;
+        case 0x28D: goto L28D;
+        case 0x28F: goto L28F;
+        case 0x291: goto L291;
+        case 0x293: goto L293;
+        case 0x295: goto L295;
+        case 0x297: goto L297;
+        case 0x299: goto L299;
+        case 0x29B: goto L29B;
+        case 0x29D: goto L29D;
+        case 0x29F: goto L29F;
+        case 0x2A1: goto L2A1;
+        case 0x2A3: goto L2A3;
+        case 0x2A5: goto L2A5;
+        case 0x2A7: goto L2A7;
+        case 0x2A9: goto L2A9;
+        case 0x2AB: goto L2AB;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 1219 JP 0x219
+    STEP(0x200, 0x1219);
+    goto L219;
+L219: // 6C0C LD VC, 0x0C
+    STEP(0x219, 0x6C0C);
+    V[12] = 0x0C;
+L21B: // 6000 LD V0, 0x00
+    STEP(0x21B, 0x6000);
+    V[0] = 0x00;
+L21D: // 6100 LD V1, 0x00
+    STEP(0x21D, 0x6100);
+    V[1] = 0x00;
+L21F: // 6508 LD V5, 0x08
+    STEP(0x21F, 0x6508);
+    V[5] = 0x08;
+L221: // 660A LD V6, 0x0A
+    STEP(0x221, 0x660A);
+    V[6] = 0x0A;
+L223: // 6700 LD V7, 0x00
+    STEP(0x223, 0x6700);
+    V[7] = 0x00;
+L225: // 6E01 LD VE, 0x01
+    STEP(0x225, 0x6E01);
+    V[14] = 0x01;
+L227: // A2AD LD I, 0x2AD
+    STEP(0x227, 0xA2AD);
+    c->I = 0x2AD;
+L229: // D014 DRW V0, V1, 4
+    STEP(0x229, 0xD014);
+    c->pc = 0x229;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x22B) goto dispatch;
+L22B: // 7008 ADD V0, 0x08
+    STEP(0x22B, 0x7008);
+    V[0] += 0x08;
+L22D: // 3040 SE V0, 0x40
+    STEP(0x22D, 0x3040);
+    if (V[0] == 0x40) goto L231;
+L22F: // 1229 JP 0x229
+    STEP(0x22F, 0x1229);
+    goto L229;
+L231: // 6000 LD V0, 0x00
+    STEP(0x231, 0x6000);
+    V[0] = 0x00;
+L233: // 611C LD V1, 0x1C
+    STEP(0x233, 0x611C);
+    V[1] = 0x1C;
+L235: // A2B0 LD I, 0x2B0
+    STEP(0x235, 0xA2B0);
+    c->I = 0x2B0;
+L237: // D014 DRW V0, V1, 4
+    STEP(0x237, 0xD014);
+    c->pc = 0x237;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x239) goto dispatch;
+L239: // A2B0 LD I, 0x2B0
+    STEP(0x239, 0xA2B0);
+    c->I = 0x2B0;
+L23B: // D014 DRW V0, V1, 4
+    STEP(0x23B, 0xD014);
+    c->pc = 0x23B;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x23D) goto dispatch;
+L23D: // 3E01 SE VE, 0x01
+    STEP(0x23D, 0x3E01);
+    if (V[14] == 0x01) goto L241;
+L23F: // 1249 JP 0x249
+    STEP(0x23F, 0x1249);
+    goto L249;
+L241: // 7004 ADD V0, 0x04
+    STEP(0x241, 0x7004);
+    V[0] += 0x04;
+L243: // 4038 SNE V0, 0x38
+    STEP(0x243, 0x4038);
+    if (V[0] != 0x38) goto L247;
+L245: // 6E00 LD VE, 0x00
+    STEP(0x245, 0x6E00);
+    V[14] = 0x00;
+L247: // 124F JP 0x24F
+    STEP(0x247, 0x124F);
+    goto L24F;
+L249: // 70FC ADD V0, 0xFC
+    STEP(0x249, 0x70FC);
+    V[0] += 0xFC;
+L24B: // 4000 SNE V0, 0x00
+    STEP(0x24B, 0x4000);
+    if (V[0] != 0x00) goto L24F;
+L24D: // 6E01 LD VE, 0x01
+    STEP(0x24D, 0x6E01);
+    V[14] = 0x01;
+L24F: // D014 DRW V0, V1, 4
+    STEP(0x24F, 0xD014);
+    c->pc = 0x24F;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x251) goto dispatch;
+L251: // FC15 LD DT, VC
+    STEP(0x251, 0xFC15);
+    c->dt = V[12];
+L253: // FB07 LD VB, DT
+    STEP(0x253, 0xFB07);
+    V[11] = c->dt;
+L255: // 3B00 SE VB, 0x00
+    STEP(0x255, 0x3B00);
+    if (V[11] == 0x00) goto L259;
+L257: // 1253 JP 0x253
+    STEP(0x257, 0x1253);
+    goto L253;
+L259: // 6208 LD V2, 0x08
+    STEP(0x259, 0x6208);
+    V[2] = 0x08;
+L25B: // E29E SKP V2
+    STEP(0x25B, 0xE29E);
+    c->pc = 0x25B;
+    predecode(0xE29E, &in);
+    execute(c, &in);
+    if (c->pc != 0x25D) goto dispatch;
+L25D: // 1295 JP 0x295
+    STEP(0x25D, 0x1295);
+    goto L295;
+L25F: // 3C00 SE VC, 0x00
+    STEP(0x25F, 0x3C00);
+    if (V[12] == 0x00) goto L263;
+L261: // 7CFE ADD VC, 0xFE
+    STEP(0x261, 0x7CFE);
+    V[12] += 0xFE;
+L263: // 631B LD V3, 0x1B
+    STEP(0x263, 0x631B);
+    V[3] = 0x1B;
+L265: // 8200 LD V2, V0
+    STEP(0x265, 0x8200);
+    V[2] = V[0];
+L267: // A2B0 LD I, 0x2B0
+    STEP(0x267, 0xA2B0);
+    c->I = 0x2B0;
+L269: // D231 DRW V2, V3, 1
+    STEP(0x269, 0xD231);
+    c->pc = 0x269;
+    predecode(0xD231, &in);
+    execute(c, &in);
+    if (c->pc != 0x26B) goto dispatch;
+L26B: // 6400 LD V4, 0x00
+    STEP(0x26B, 0x6400);
+    V[4] = 0x00;
+L26D: // D231 DRW V2, V3, 1
+    STEP(0x26D, 0xD231);
+    c->pc = 0x26D;
+    predecode(0xD231, &in);
+    execute(c, &in);
+    if (c->pc != 0x26F) goto dispatch;
+L26F: // 73FF ADD V3, 0xFF
+    STEP(0x26F, 0x73FF);
+    V[3] += 0xFF;
+L271: // D231 DRW V2, V3, 1
+    STEP(0x271, 0xD231);
+    c->pc = 0x271;
+    predecode(0xD231, &in);
+    execute(c, &in);
+    if (c->pc != 0x273) goto dispatch;
+L273: // 3F00 SE VF, 0x00
+    STEP(0x273, 0x3F00);
+    if (V[15] == 0x00) goto L277;
+L275: // 6401 LD V4, 0x01
+    STEP(0x275, 0x6401);
+    V[4] = 0x01;
+L277: // 3303 SE V3, 0x03
+    STEP(0x277, 0x3303);
+    if (V[3] == 0x03) goto L27B;
+L279: // 126D JP 0x26D
+    STEP(0x279, 0x126D);
+    goto L26D;
+L27B: // D231 DRW V2, V3, 1
+    STEP(0x27B, 0xD231);
+    c->pc = 0x27B;
+    predecode(0xD231, &in);
+    execute(c, &in);
+    if (c->pc != 0x27D) goto dispatch;
+L27D: // 3401 SE V4, 0x01
+    STEP(0x27D, 0x3401);
+    if (V[4] == 0x01) goto L281;
+L27F: // 1291 JP 0x291
+    STEP(0x27F, 0x1291);
+    goto L291;
+L281: // 7705 ADD V7, 0x05
+    STEP(0x281, 0x7705);
+    V[7] += 0x05;
+L283: // 75FF ADD V5, 0xFF
+    STEP(0x283, 0x75FF);
+    V[5] += 0xFF;
+L285: // 8200 LD V2, V0
+    STEP(0x285, 0x8200);
+    V[2] = V[0];
+L287: // 6300 LD V3, 0x00
+    STEP(0x287, 0x6300);
+    V[3] = 0x00;
+L289: // A2AD LD I, 0x2AD
+    STEP(0x289, 0xA2AD);
+    c->I = 0x2AD;
+L28B: // D234 DRW V2, V3, 4
+    STEP(0x28B, 0xD234);
+    c->pc = 0x28B;
+    predecode(0xD234, &in);
+    execute(c, &in);
+    if (c->pc != 0x28D) goto dispatch;
+L28D: // 4500 SNE V5, 0x00
+    STEP(0x28D, 0x4500);
+    if (V[5] != 0x00) goto L291;
+L28F: // 1297 JP 0x297
+    STEP(0x28F, 0x1297);
+    goto L297;
+L291: // 76FF ADD V6, 0xFF
+    STEP(0x291, 0x76FF);
+    V[6] += 0xFF;
+L293: // 3600 SE V6, 0x00
+    STEP(0x293, 0x3600);
+    if (V[6] == 0x00) goto L297;
+L295: // 1239 JP 0x239
+    STEP(0x295, 0x1239);
+    goto L239;
+L297: // A2B4 LD I, 0x2B4
+    STEP(0x297, 0xA2B4);
+    c->I = 0x2B4;
+L299: // F733 LD B, V7
+    STEP(0x299, 0xF733);
+    c->pc = 0x299;
+    predecode(0xF733, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x29B) goto dispatch;
+L29B: // F265 LD V2, [I]
+    STEP(0x29B, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L29D: // 631B LD V3, 0x1B
+    STEP(0x29D, 0x631B);
+    V[3] = 0x1B;
+L29F: // 640D LD V4, 0x0D
+    STEP(0x29F, 0x640D);
+    V[4] = 0x0D;
+L2A1: // F129 LD F, V1
+    STEP(0x2A1, 0xF129);
+    c->I = V[1] * 5;
+L2A3: // D345 DRW V3, V4, 5
+    STEP(0x2A3, 0xD345);
+    c->pc = 0x2A3;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A5) goto dispatch;
+L2A5: // 7305 ADD V3, 0x05
+    STEP(0x2A5, 0x7305);
+    V[3] += 0x05;
+L2A7: // F229 LD F, V2
+    STEP(0x2A7, 0xF229);
+    c->I = V[2] * 5;
+L2A9: // D345 DRW V3, V4, 5
+    STEP(0x2A9, 0xD345);
+    c->pc = 0x2A9;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2AB) goto dispatch;
+L2AB: // 12AB JP 0x2AB
+    STEP(0x2AB, 0x12AB);
+    goto L2AB;
+}
@@ -0,0 +1,1419 @@
+// generated by chip8-aot from roms/PADDLES.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x00, 0xE0, 0x68, 0x00, 0x69, 0x00, 0x6A, 0x20, 0x6B, 0x20, 0x6C, 0x09,
+    0x6D, 0x03, 0x6E, 0x03, 0x23, 0x86, 0x23, 0xB2, 0x23, 0xA0, 0x23, 0xE2,
+    0x67, 0x00, 0x60, 0x0F, 0xE0, 0xA1, 0x67, 0x01, 0x60, 0x0E, 0xE0, 0xA1,
+    0x67, 0x02, 0x47, 0x00, 0x12, 0x1A, 0x00, 0xE0, 0x23, 0x86, 0x23, 0xB2,
+    0x23, 0xA0, 0x23, 0xE2, 0x23, 0xAC, 0x23, 0xAC, 0x23, 0xA0, 0x4E, 0x01,
+    0x23, 0x40, 0x4E, 0x02, 0x23, 0x46, 0x4E, 0x03, 0x23, 0x4C, 0x4E, 0x04,
+    0x23, 0x52, 0x23, 0x58, 0x47, 0x01, 0x22, 0x9A, 0x47, 0x02, 0x22, 0xC0,
+    0x23, 0xA0, 0x23, 0xAC, 0x4F, 0x01, 0x12, 0xFA, 0x4D, 0x00, 0x12, 0x66,
+    0x4D, 0x1F, 0x12, 0x80, 0x12, 0x36, 0x23, 0xAC, 0x23, 0xE2, 0x79, 0x01,
+    0x23, 0xE2, 0x60, 0x0F, 0xF0, 0x18, 0x49, 0x09, 0x14, 0x1C, 0x6C, 0x09,
+    0x6D, 0x02, 0x6E, 0x02, 0x23, 0xAC, 0x12, 0x36, 0x23, 0xAC, 0x23, 0xE2,
+    0x78, 0x01, 0x23, 0xE2, 0x60, 0x0F, 0xF0, 0x18, 0x48, 0x09, 0x14, 0x1C,
+    0x6C, 0x09, 0x6D, 0x1C, 0x6E, 0x01, 0x23, 0xAC, 0x12, 0x36, 0x60, 0x04,
+    0xE0, 0xA1, 0x22, 0xB0, 0x60, 0x06, 0xE0, 0xA1, 0x22, 0xB8, 0xC3, 0x03,
+    0x43, 0x00, 0x00, 0xEE, 0x8A, 0xC0, 0x00, 0xEE, 0x4B, 0x08, 0x00, 0xEE,
+    0x7B, 0xFE, 0x00, 0xEE, 0x4B, 0x38, 0x00, 0xEE, 0x7B, 0x02, 0x00, 0xEE,
+    0x60, 0x04, 0xE0, 0xA1, 0x22, 0xDA, 0x60, 0x06, 0xE0, 0xA1, 0x22, 0xE2,
+    0x60, 0x07, 0xE0, 0xA1, 0x22, 0xEA, 0x60, 0x09, 0xE0, 0xA1, 0x22, 0xF2,
+    0x00, 0xEE, 0x4A, 0x08, 0x00, 0xEE, 0x7A, 0xFE, 0x00, 0xEE, 0x4A, 0x38,
+    0x00, 0xEE, 0x7A, 0x02, 0x00, 0xEE, 0x4B, 0x08, 0x00, 0xEE, 0x7B, 0xFE,
+    0x00, 0xEE, 0x4B, 0x38, 0x00, 0xEE, 0x7B, 0x02, 0x00, 0xEE, 0x60, 0x05,
+    0xF0, 0x18, 0x4D, 0x01, 0x13, 0x2C, 0x4D, 0x1E, 0x13, 0x36, 0x4D, 0x10,
+    0x13, 0x0A, 0x4E, 0x01, 0x13, 0x1C, 0x4E, 0x02, 0x13, 0x20, 0x4E, 0x03,
+    0x13, 0x24, 0x4E, 0x04, 0x13, 0x28, 0x12, 0x36, 0x6E, 0x02, 0x12, 0x36,
+    0x6E, 0x01, 0x12, 0x36, 0x6E, 0x04, 0x12, 0x36, 0x6E, 0x03, 0x12, 0x36,
+    0xC0, 0x01, 0x6E, 0x02, 0x40, 0x01, 0x6E, 0x03, 0x12, 0x36, 0xC0, 0x01,
+    0x6E, 0x01, 0x40, 0x01, 0x6E, 0x04, 0x12, 0x36, 0x7C, 0x01, 0x7D, 0xFF,
+    0x00, 0xEE, 0x7C, 0x01, 0x7D, 0x01, 0x00, 0xEE, 0x7C, 0xFF, 0x7D, 0x01,
+    0x00, 0xEE, 0x7C, 0xFF, 0x7D, 0xFF, 0x00, 0xEE, 0x4C, 0x3F, 0x13, 0x62,
+    0x4C, 0x08, 0x13, 0x74, 0x00, 0xEE, 0x4E, 0x01, 0x13, 0x6C, 0x4E, 0x02,
+    0x13, 0x70, 0x00, 0xEE, 0x6E, 0x04, 0x00, 0xEE, 0x6E, 0x03, 0x00, 0xEE,
+    0x4E, 0x03, 0x13, 0x7E, 0x4E, 0x04, 0x13, 0x82, 0x00, 0xEE, 0x6E, 0x02,
+    0x00, 0xEE, 0x6E, 0x01, 0x00, 0xEE, 0x63, 0x00, 0x64, 0x0F, 0xA4, 0x2E,
+    0xD3, 0x42, 0xA4, 0x1E, 0x64, 0x00, 0x63, 0x07, 0xD3, 0x48, 0x74, 0x08,
+    0x44, 0x20, 0x00, 0xEE, 0x13, 0x94, 0x00, 0xEE, 0xA4, 0x26, 0x63, 0x01,
+    0xDA, 0x31, 0x63, 0x1E, 0xDB, 0x31, 0x00, 0xEE, 0xA4, 0x27, 0xDC, 0xD1,
+    0x00, 0xEE, 0xC5, 0x02, 0x63, 0x08, 0x64, 0x10, 0xA4, 0x26, 0x45, 0x00,
+    0x23, 0xC8, 0x45, 0x01, 0x23, 0xD0, 0x45, 0x02, 0x23, 0xD8, 0x00, 0xEE,
+    0xD3, 0x41, 0x63, 0x38, 0xD3, 0x41, 0x00, 0xEE, 0xD3, 0x41, 0x73, 0x08,
+    0xD3, 0x41, 0x00, 0xEE, 0x63, 0x38, 0xD3, 0x41, 0x73, 0xF8, 0xD3, 0x41,
+    0x00, 0xEE, 0x63, 0x01, 0x64, 0x01, 0xF8, 0x29, 0xD3, 0x45, 0x74, 0x19,
+    0xF9, 0x29, 0xD3, 0x45, 0x47, 0x01, 0x23, 0xFA, 0x47, 0x02, 0x24, 0x0A,
+    0x00, 0xEE, 0x64, 0x09, 0x60, 0x0C, 0xF0, 0x29, 0xD3, 0x45, 0x64, 0x12,
+    0xA4, 0x28, 0xD3, 0x45, 0x00, 0xEE, 0x64, 0x09, 0x60, 0x0A, 0xF0, 0x29,
+    0xD3, 0x45, 0x64, 0x12, 0x70, 0x01, 0xF0, 0x29, 0xD3, 0x45, 0x00, 0xEE,
+    0x14, 0x1C, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0xFF, 0x80,
+    0xF0, 0x90, 0xF0, 0x90, 0x90, 0x00, 0xFE, 0xFE,
+};
+const size_t aot_rom_size = 560;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x000000000001FF00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+        case 0x2FE: goto L2FE;
+        case 0x300: goto L300;
+        case 0x302: goto L302;
+        case 0x304: goto L304;
+        case 0x306: goto L306;
+        case 0x308: goto L308;
+        case 0x30A: goto L30A;
+        case 0x30C: goto L30C;
+        case 0x30E: goto L30E;
+        case 0x310: goto L310;
+        case 0x312: goto L312;
+        case 0x314: goto L314;
+        case 0x316: goto L316;
+        case 0x318: goto L318;
+        case 0x31A: goto L31A;
+        case 0x31C: goto L31C;
+        case 0x31E: goto L31E;
+        case 0x320: goto L320;
+        case 0x322: goto L322;
+        case 0x324: goto L324;
+        case 0x326: goto L326;
+        case 0x328: goto L328;
+        case 0x32A: goto L32A;
+        case 0x32C: goto L32C;
+        case 0x32E: goto L32E;
+        case 0x330: goto L330;
+        case 0x332: goto L332;
+        case 0x334: goto L334;
+        case 0x336: goto L336;
+        case 0x338: goto L338;
+        case 0x33A: goto L33A;
+        case 0x33C: goto L33C;
+        case 0x33E: goto L33E;
+        case 0x340: goto L340;
+        case 0x342: goto L342;
+        case 0x344: goto L344;
+        case 0x346: goto L346;
+        case 0x348: goto L348;
+        case 0x34A: goto L34A;
+        case 0x34C: goto L34C;
+        case 0x34E: goto L34E;
+        case 0x350: goto L350;
+        case 0x352: goto L352;
+        case 0x354: goto L354;
+        case 0x356: goto L356;
+        case 0x358: goto L358;
+        case 0x35A: goto L35A;
+        case 0x35C: goto L35C;
+        case 0x35E: goto L35E;
+        case 0x360: goto L360;
+        case 0x362: goto L362;
+        case 0x364: goto L364;
+        case 0x366: goto L366;
+        case 0x368: goto L368;
+        case 0x36A: goto L36A;
+        case 0x36C: goto L36C;
+        case 0x36E: goto L36E;
+        case 0x370: goto L370;
+        case 0x372: goto L372;
+        case 0x374: goto L374;
+        case 0x376: goto L376;
+        case 0x378: goto L378;
+        case 0x37A: goto L37A;
+        case 0x37C: goto L37C;
+        case 0x37E: goto L37E;
+        case 0x380: goto L380;
+        case 0x382: goto L382;
+        case 0x384: goto L384;
+        case 0x386: goto L386;
+        case 0x388: goto L388;
+        case 0x38A: goto L38A;
+        case 0x38C: goto L38C;
+        case 0x38E: goto L38E;
+        case 0x390: goto L390;
+        case 0x392: goto L392;
+        case 0x394: goto L394;
+        case 0x396: goto L396;
+        case 0x398: goto L398;
+        case 0x39A: goto L39A;
+        case 0x39C: goto L39C;
+        case 0x3A0: goto L3A0;
+        case 0x3A2: goto L3A2;
+        case 0x3A4: goto L3A4;
+        case 0x3A6: goto L3A6;
+        case 0x3A8: goto L3A8;
+        case 0x3AA: goto L3AA;
+        case 0x3AC: goto L3AC;
+        case 0x3AE: goto L3AE;
+        case 0x3B0: goto L3B0;
+        case 0x3B2: goto L3B2;
+        case 0x3B4: goto L3B4;
+        case 0x3B6: goto L3B6;
+        case 0x3B8: goto L3B8;
+        case 0x3BA: goto L3BA;
+        case 0x3BC: goto L3BC;
+        case 0x3BE: goto L3BE;
+        case 0x3C0: goto L3C0;
+        case 0x3C2: goto L3C2;
+        case 0x3C4: goto L3C4;
+        case 0x3C6: goto L3C6;
+        case 0x3C8: goto L3C8;
+        case 0x3CA: goto L3CA;
+        case 0x3CC: goto L3CC;
+        case 0x3CE: goto L3CE;
+        case 0x3D0: goto L3D0;
+        case 0x3D2: goto L3D2;
+        case 0x3D4: goto L3D4;
+        case 0x3D6: goto L3D6;
+        case 0x3D8: goto L3D8;
+        case 0x3DA: goto L3DA;
+        case 0x3DC: goto L3DC;
+        case 0x3DE: goto L3DE;
+        case 0x3E0: goto L3E0;
+        case 0x3E2: goto L3E2;
+        case 0x3E4: goto L3E4;
+        case 0x3E6: goto L3E6;
+        case 0x3E8: goto L3E8;
+        case 0x3EA: goto L3EA;
+        case 0x3EC: goto L3EC;
+        case 0x3EE: goto L3EE;
+        case 0x3F0: goto L3F0;
+        case 0x3F2: goto L3F2;
+        case 0x3F4: goto L3F4;
+        case 0x3F6: goto L3F6;
+        case 0x3F8: goto L3F8;
+        case 0x3FA: goto L3FA;
+        case 0x3FC: goto L3FC;
+        case 0x3FE: goto L3FE;
+        case 0x400: goto L400;
+        case 0x402: goto L402;
+        case 0x404: goto L404;
+        case 0x406: goto L406;
+        case 0x408: goto L408;
+        case 0x40A: goto L40A;
+        case 0x40C: goto L40C;
+        case 0x40E: goto L40E;
+        case 0x410: goto L410;
+        case 0x412: goto L412;
+        case 0x414: goto L414;
+        case 0x416: goto L416;
+        case 0x418: goto L418;
+        case 0x41A: goto L41A;
+        case 0x41C: goto L41C;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 00E0 CLS
+    STEP(0x200, 0x00E0);
+    c->pc = 0x200;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x202) goto dispatch;
+L202: // 6800 LD V8, 0x00
+    STEP(0x202, 0x6800);
+    V[8] = 0x00;
+L204: // 6900 LD V9, 0x00
+    STEP(0x204, 0x6900);
+    V[9] = 0x00;
+L206: // 6A20 LD VA, 0x20
+    STEP(0x206, 0x6A20);
+    V[10] = 0x20;
+L208: // 6B20 LD VB, 0x20
+    STEP(0x208, 0x6B20);
+    V[11] = 0x20;
+L20A: // 6C09 LD VC, 0x09
+    STEP(0x20A, 0x6C09);
+    V[12] = 0x09;
+L20C: // 6D03 LD VD, 0x03
+    STEP(0x20C, 0x6D03);
+    V[13] = 0x03;
+L20E: // 6E03 LD VE, 0x03
+    STEP(0x20E, 0x6E03);
+    V[14] = 0x03;
+L210: // 2386 CALL 0x386
+    STEP(0x210, 0x2386);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x210;
+    goto L386;
+L212: // 23B2 CALL 0x3B2
+    STEP(0x212, 0x23B2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x212;
+    goto L3B2;
+L214: // 23A0 CALL 0x3A0
+    STEP(0x214, 0x23A0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x214;
+    goto L3A0;
+L216: // 23E2 CALL 0x3E2
+    STEP(0x216, 0x23E2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x216;
+    goto L3E2;
+L218: // 6700 LD V7, 0x00
+    STEP(0x218, 0x6700);
+    V[7] = 0x00;
+L21A: // 600F LD V0, 0x0F
+    STEP(0x21A, 0x600F);
+    V[0] = 0x0F;
+L21C: // E0A1 SKNP V0
+    STEP(0x21C, 0xE0A1);
+    c->pc = 0x21C;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x21E) goto dispatch;
+L21E: // 6701 LD V7, 0x01
+    STEP(0x21E, 0x6701);
+    V[7] = 0x01;
+L220: // 600E LD V0, 0x0E
+    STEP(0x220, 0x600E);
+    V[0] = 0x0E;
+L222: // E0A1 SKNP V0
+    STEP(0x222, 0xE0A1);
+    c->pc = 0x222;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x224) goto dispatch;
+L224: // 6702 LD V7, 0x02
+    STEP(0x224, 0x6702);
+    V[7] = 0x02;
+L226: // 4700 SNE V7, 0x00
+    STEP(0x226, 0x4700);
+    if (V[7] != 0x00) goto L22A;
+L228: // 121A JP 0x21A
+    STEP(0x228, 0x121A);
+    goto L21A;
+L22A: // 00E0 CLS
+    STEP(0x22A, 0x00E0);
+    c->pc = 0x22A;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x22C) goto dispatch;
+L22C: // 2386 CALL 0x386
+    STEP(0x22C, 0x2386);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x22C;
+    goto L386;
+L22E: // 23B2 CALL 0x3B2
+    STEP(0x22E, 0x23B2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x22E;
+    goto L3B2;
+L230: // 23A0 CALL 0x3A0
+    STEP(0x230, 0x23A0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x230;
+    goto L3A0;
+L232: // 23E2 CALL 0x3E2
+    STEP(0x232, 0x23E2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x232;
+    goto L3E2;
+L234: // 23AC CALL 0x3AC
+    STEP(0x234, 0x23AC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x234;
+    goto L3AC;
+L236: // 23AC CALL 0x3AC
+    STEP(0x236, 0x23AC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x236;
+    goto L3AC;
+L238: // 23A0 CALL 0x3A0
+    STEP(0x238, 0x23A0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x238;
+    goto L3A0;
+L23A: // 4E01 SNE VE, 0x01
+    STEP(0x23A, 0x4E01);
+    if (V[14] != 0x01) goto L23E;
+L23C: // 2340 CALL 0x340
+    STEP(0x23C, 0x2340);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x23C;
+    goto L340;
+L23E: // 4E02 SNE VE, 0x02
+    STEP(0x23E, 0x4E02);
+    if (V[14] != 0x02) goto L242;
+L240: // 2346 CALL 0x346
+    STEP(0x240, 0x2346);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x240;
+    goto L346;
+L242: // 4E03 SNE VE, 0x03
+    STEP(0x242, 0x4E03);
+    if (V[14] != 0x03) goto L246;
+L244: // 234C CALL 0x34C
+    STEP(0x244, 0x234C);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x244;
+    goto L34C;
+L246: // 4E04 SNE VE, 0x04
+    STEP(0x246, 0x4E04);
+    if (V[14] != 0x04) goto L24A;
+L248: // 2352 CALL 0x352
+    STEP(0x248, 0x2352);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x248;
+    goto L352;
+L24A: // 2358 CALL 0x358
+    STEP(0x24A, 0x2358);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x24A;
+    goto L358;
+L24C: // 4701 SNE V7, 0x01
+    STEP(0x24C, 0x4701);
+    if (V[7] != 0x01) goto L250;
+L24E: // 229A CALL 0x29A
+    STEP(0x24E, 0x229A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x24E;
+    goto L29A;
+L250: // 4702 SNE V7, 0x02
+    STEP(0x250, 0x4702);
+    if (V[7] != 0x02) goto L254;
+L252: // 22C0 CALL 0x2C0
+    STEP(0x252, 0x22C0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x252;
+    goto L2C0;
+L254: // 23A0 CALL 0x3A0
+    STEP(0x254, 0x23A0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x254;
+    goto L3A0;
+L256: // 23AC CALL 0x3AC
+    STEP(0x256, 0x23AC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x256;
+    goto L3AC;
+L258: // 4F01 SNE VF, 0x01
+    STEP(0x258, 0x4F01);
+    if (V[15] != 0x01) goto L25C;
+L25A: // 12FA JP 0x2FA
+    STEP(0x25A, 0x12FA);
+    goto L2FA;
+L25C: // 4D00 SNE VD, 0x00
+    STEP(0x25C, 0x4D00);
+    if (V[13] != 0x00) goto L260;
+L25E: // 1266 JP 0x266
+    STEP(0x25E, 0x1266);
+    goto L266;
+L260: // 4D1F SNE VD, 0x1F
+    STEP(0x260, 0x4D1F);
+    if (V[13] != 0x1F) goto L264;
+L262: // 1280 JP 0x280
+    STEP(0x262, 0x1280);
+    goto L280;
+L264: // 1236 JP 0x236
+    STEP(0x264, 0x1236);
+    goto L236;
+L266: // 23AC CALL 0x3AC
+    STEP(0x266, 0x23AC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x266;
+    goto L3AC;
+L268: // 23E2 CALL 0x3E2
+    STEP(0x268, 0x23E2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x268;
+    goto L3E2;
+L26A: // 7901 ADD V9, 0x01
+    STEP(0x26A, 0x7901);
+    V[9] += 0x01;
+L26C: // 23E2 CALL 0x3E2
+    STEP(0x26C, 0x23E2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x26C;
+    goto L3E2;
+L26E: // 600F LD V0, 0x0F
+    STEP(0x26E, 0x600F);
+    V[0] = 0x0F;
+L270: // F018 LD ST, V0
+    STEP(0x270, 0xF018);
+    c->st = V[0];
+L272: // 4909 SNE V9, 0x09
+    STEP(0x272, 0x4909);
+    if (V[9] != 0x09) goto L276;
+L274: // 141C JP 0x41C
+    STEP(0x274, 0x141C);
+    goto L41C;
+L276: // 6C09 LD VC, 0x09
+    STEP(0x276, 0x6C09);
+    V[12] = 0x09;
+L278: // 6D02 LD VD, 0x02
+    STEP(0x278, 0x6D02);
+    V[13] = 0x02;
+L27A: // 6E02 LD VE, 0x02
+    STEP(0x27A, 0x6E02);
+    V[14] = 0x02;
+L27C: // 23AC CALL 0x3AC
+    STEP(0x27C, 0x23AC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x27C;
+    goto L3AC;
+L27E: // 1236 JP 0x236
+    STEP(0x27E, 0x1236);
+    goto L236;
+L280: // 23AC CALL 0x3AC
+    STEP(0x280, 0x23AC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x280;
+    goto L3AC;
+L282: // 23E2 CALL 0x3E2
+    STEP(0x282, 0x23E2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x282;
+    goto L3E2;
+L284: // 7801 ADD V8, 0x01
+    STEP(0x284, 0x7801);
+    V[8] += 0x01;
+L286: // 23E2 CALL 0x3E2
+    STEP(0x286, 0x23E2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x286;
+    goto L3E2;
+L288: // 600F LD V0, 0x0F
+    STEP(0x288, 0x600F);
+    V[0] = 0x0F;
+L28A: // F018 LD ST, V0
+    STEP(0x28A, 0xF018);
+    c->st = V[0];
+L28C: // 4809 SNE V8, 0x09
+    STEP(0x28C, 0x4809);
+    if (V[8] != 0x09) goto L290;
+L28E: // 141C JP 0x41C
+    STEP(0x28E, 0x141C);
+    goto L41C;
+L290: // 6C09 LD VC, 0x09
+    STEP(0x290, 0x6C09);
+    V[12] = 0x09;
+L292: // 6D1C LD VD, 0x1C
+    STEP(0x292, 0x6D1C);
+    V[13] = 0x1C;
+L294: // 6E01 LD VE, 0x01
+    STEP(0x294, 0x6E01);
+    V[14] = 0x01;
+L296: // 23AC CALL 0x3AC
+    STEP(0x296, 0x23AC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x296;
+    goto L3AC;
+L298: // 1236 JP 0x236
+    STEP(0x298, 0x1236);
+    goto L236;
+L29A: // 6004 LD V0, 0x04
+    STEP(0x29A, 0x6004);
+    V[0] = 0x04;
+L29C: // E0A1 SKNP V0
+    STEP(0x29C, 0xE0A1);
+    c->pc = 0x29C;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x29E) goto dispatch;
+L29E: // 22B0 CALL 0x2B0
+    STEP(0x29E, 0x22B0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x29E;
+    goto L2B0;
+L2A0: // 6006 LD V0, 0x06
+    STEP(0x2A0, 0x6006);
+    V[0] = 0x06;
+L2A2: // E0A1 SKNP V0
+    STEP(0x2A2, 0xE0A1);
+    c->pc = 0x2A2;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A4) goto dispatch;
+L2A4: // 22B8 CALL 0x2B8
+    STEP(0x2A4, 0x22B8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2A4;
+    goto L2B8;
+L2A6: // C303 RND V3, 0x03
+    STEP(0x2A6, 0xC303);
+    c->pc = 0x2A6;
+    predecode(0xC303, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A8) goto dispatch;
+L2A8: // 4300 SNE V3, 0x00
+    STEP(0x2A8, 0x4300);
+    if (V[3] != 0x00) goto L2AC;
+L2AA: // 00EE RET
+    STEP(0x2AA, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2AC: // 8AC0 LD VA, VC
+    STEP(0x2AC, 0x8AC0);
+    V[10] = V[12];
+L2AE: // 00EE RET
+    STEP(0x2AE, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2B0: // 4B08 SNE VB, 0x08
+    STEP(0x2B0, 0x4B08);
+    if (V[11] != 0x08) goto L2B4;
+L2B2: // 00EE RET
+    STEP(0x2B2, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2B4: // 7BFE ADD VB, 0xFE
+    STEP(0x2B4, 0x7BFE);
+    V[11] += 0xFE;
+L2B6: // 00EE RET
+    STEP(0x2B6, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2B8: // 4B38 SNE VB, 0x38
+    STEP(0x2B8, 0x4B38);
+    if (V[11] != 0x38) goto L2BC;
+L2BA: // 00EE RET
+    STEP(0x2BA, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2BC: // 7B02 ADD VB, 0x02
+    STEP(0x2BC, 0x7B02);
+    V[11] += 0x02;
+L2BE: // 00EE RET
+    STEP(0x2BE, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2C0: // 6004 LD V0, 0x04
+    STEP(0x2C0, 0x6004);
+    V[0] = 0x04;
+L2C2: // E0A1 SKNP V0
+    STEP(0x2C2, 0xE0A1);
+    c->pc = 0x2C2;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C4) goto dispatch;
+L2C4: // 22DA CALL 0x2DA
+    STEP(0x2C4, 0x22DA);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2C4;
+    goto L2DA;
+L2C6: // 6006 LD V0, 0x06
+    STEP(0x2C6, 0x6006);
+    V[0] = 0x06;
+L2C8: // E0A1 SKNP V0
+    STEP(0x2C8, 0xE0A1);
+    c->pc = 0x2C8;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2CA) goto dispatch;
+L2CA: // 22E2 CALL 0x2E2
+    STEP(0x2CA, 0x22E2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2CA;
+    goto L2E2;
+L2CC: // 6007 LD V0, 0x07
+    STEP(0x2CC, 0x6007);
+    V[0] = 0x07;
+L2CE: // E0A1 SKNP V0
+    STEP(0x2CE, 0xE0A1);
+    c->pc = 0x2CE;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2D0) goto dispatch;
+L2D0: // 22EA CALL 0x2EA
+    STEP(0x2D0, 0x22EA);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2D0;
+    goto L2EA;
+L2D2: // 6009 LD V0, 0x09
+    STEP(0x2D2, 0x6009);
+    V[0] = 0x09;
+L2D4: // E0A1 SKNP V0
+    STEP(0x2D4, 0xE0A1);
+    c->pc = 0x2D4;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2D6) goto dispatch;
+L2D6: // 22F2 CALL 0x2F2
+    STEP(0x2D6, 0x22F2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2D6;
+    goto L2F2;
+L2D8: // 00EE RET
+    STEP(0x2D8, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2DA: // 4A08 SNE VA, 0x08
+    STEP(0x2DA, 0x4A08);
+    if (V[10] != 0x08) goto L2DE;
+L2DC: // 00EE RET
+    STEP(0x2DC, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2DE: // 7AFE ADD VA, 0xFE
+    STEP(0x2DE, 0x7AFE);
+    V[10] += 0xFE;
+L2E0: // 00EE RET
+    STEP(0x2E0, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2E2: // 4A38 SNE VA, 0x38
+    STEP(0x2E2, 0x4A38);
+    if (V[10] != 0x38) goto L2E6;
+L2E4: // 00EE RET
+    STEP(0x2E4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2E6: // 7A02 ADD VA, 0x02
+    STEP(0x2E6, 0x7A02);
+    V[10] += 0x02;
+L2E8: // 00EE RET
+    STEP(0x2E8, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2EA: // 4B08 SNE VB, 0x08
+    STEP(0x2EA, 0x4B08);
+    if (V[11] != 0x08) goto L2EE;
+L2EC: // 00EE RET
+    STEP(0x2EC, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2EE: // 7BFE ADD VB, 0xFE
+    STEP(0x2EE, 0x7BFE);
+    V[11] += 0xFE;
+L2F0: // 00EE RET
+    STEP(0x2F0, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2F2: // 4B38 SNE VB, 0x38
+    STEP(0x2F2, 0x4B38);
+    if (V[11] != 0x38) goto L2F6;
+L2F4: // 00EE RET
+    STEP(0x2F4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2F6: // 7B02 ADD VB, 0x02
+    STEP(0x2F6, 0x7B02);
+    V[11] += 0x02;
+L2F8: // 00EE RET
+    STEP(0x2F8, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2FA: // 6005 LD V0, 0x05
+    STEP(0x2FA, 0x6005);
+    V[0] = 0x05;
+L2FC: // F018 LD ST, V0
+    STEP(0x2FC, 0xF018);
+    c->st = V[0];
+L2FE: // 4D01 SNE VD, 0x01
+    STEP(0x2FE, 0x4D01);
+    if (V[13] != 0x01) goto L302;
+L300: // 132C JP 0x32C
+    STEP(0x300, 0x132C);
+    goto L32C;
+L302: // 4D1E SNE VD, 0x1E
+    STEP(0x302, 0x4D1E);
+    if (V[13] != 0x1E) goto L306;
+L304: // 1336 JP 0x336
+    STEP(0x304, 0x1336);
+    goto L336;
+L306: // 4D10 SNE VD, 0x10
+    STEP(0x306, 0x4D10);
+    if (V[13] != 0x10) goto L30A;
+L308: // 130A JP 0x30A
+    STEP(0x308, 0x130A);
+    goto L30A;
+L30A: // 4E01 SNE VE, 0x01
+    STEP(0x30A, 0x4E01);
+    if (V[14] != 0x01) goto L30E;
+L30C: // 131C JP 0x31C
+    STEP(0x30C, 0x131C);
+    goto L31C;
+L30E: // 4E02 SNE VE, 0x02
+    STEP(0x30E, 0x4E02);
+    if (V[14] != 0x02) goto L312;
+L310: // 1320 JP 0x320
+    STEP(0x310, 0x1320);
+    goto L320;
+L312: // 4E03 SNE VE, 0x03
+    STEP(0x312, 0x4E03);
+    if (V[14] != 0x03) goto L316;
+L314: // 1324 JP 0x324
+    STEP(0x314, 0x1324);
+    goto L324;
+L316: // 4E04 SNE VE, 0x04
+    STEP(0x316, 0x4E04);
+    if (V[14] != 0x04) goto L31A;
+L318: // 1328 JP 0x328
+    STEP(0x318, 0x1328);
+    goto L328;
+L31A: // 1236 JP 0x236
+    STEP(0x31A, 0x1236);
+    goto L236;
+L31C: // 6E02 LD VE, 0x02
+    STEP(0x31C, 0x6E02);
+    V[14] = 0x02;
+L31E: // 1236 JP 0x236
+    STEP(0x31E, 0x1236);
+    goto L236;
+L320: // 6E01 LD VE, 0x01
+    STEP(0x320, 0x6E01);
+    V[14] = 0x01;
+L322: // 1236 JP 0x236
+    STEP(0x322, 0x1236);
+    goto L236;
+L324: // 6E04 LD VE, 0x04
+    STEP(0x324, 0x6E04);
+    V[14] = 0x04;
+L326: // 1236 JP 0x236
+    STEP(0x326, 0x1236);
+    goto L236;
+L328: // 6E03 LD VE, 0x03
+    STEP(0x328, 0x6E03);
+    V[14] = 0x03;
+L32A: // 1236 JP 0x236
+    STEP(0x32A, 0x1236);
+    goto L236;
+L32C: // C001 RND V0, 0x01
+    STEP(0x32C, 0xC001);
+    c->pc = 0x32C;
+    predecode(0xC001, &in);
+    execute(c, &in);
+    if (c->pc != 0x32E) goto dispatch;
+L32E: // 6E02 LD VE, 0x02
+    STEP(0x32E, 0x6E02);
+    V[14] = 0x02;
+L330: // 4001 SNE V0, 0x01
+    STEP(0x330, 0x4001);
+    if (V[0] != 0x01) goto L334;
+L332: // 6E03 LD VE, 0x03
+    STEP(0x332, 0x6E03);
+    V[14] = 0x03;
+L334: // 1236 JP 0x236
+    STEP(0x334, 0x1236);
+    goto L236;
+L336: // C001 RND V0, 0x01
+    STEP(0x336, 0xC001);
+    c->pc = 0x336;
+    predecode(0xC001, &in);
+    execute(c, &in);
+    if (c->pc != 0x338) goto dispatch;
+L338: // 6E01 LD VE, 0x01
+    STEP(0x338, 0x6E01);
+    V[14] = 0x01;
+L33A: // 4001 SNE V0, 0x01
+    STEP(0x33A, 0x4001);
+    if (V[0] != 0x01) goto L33E;
+L33C: // 6E04 LD VE, 0x04
+    STEP(0x33C, 0x6E04);
+    V[14] = 0x04;
+L33E: // 1236 JP 0x236
+    STEP(0x33E, 0x1236);
+    goto L236;
+L340: // 7C01 ADD VC, 0x01
+    STEP(0x340, 0x7C01);
+    V[12] += 0x01;
+L342: // 7DFF ADD VD, 0xFF
+    STEP(0x342, 0x7DFF);
+    V[13] += 0xFF;
+L344: // 00EE RET
+    STEP(0x344, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L346: // 7C01 ADD VC, 0x01
+    STEP(0x346, 0x7C01);
+    V[12] += 0x01;
+L348: // 7D01 ADD VD, 0x01
+    STEP(0x348, 0x7D01);
+    V[13] += 0x01;
+L34A: // 00EE RET
+    STEP(0x34A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L34C: // 7CFF ADD VC, 0xFF
+    STEP(0x34C, 0x7CFF);
+    V[12] += 0xFF;
+L34E: // 7D01 ADD VD, 0x01
+    STEP(0x34E, 0x7D01);
+    V[13] += 0x01;
+L350: // 00EE RET
+    STEP(0x350, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L352: // 7CFF ADD VC, 0xFF
+    STEP(0x352, 0x7CFF);
+    V[12] += 0xFF;
+L354: // 7DFF ADD VD, 0xFF
+    STEP(0x354, 0x7DFF);
+    V[13] += 0xFF;
+L356: // 00EE RET
+    STEP(0x356, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L358: // 4C3F SNE VC, 0x3F
+    STEP(0x358, 0x4C3F);
+    if (V[12] != 0x3F) goto L35C;
+L35A: // 1362 JP 0x362
+    STEP(0x35A, 0x1362);
+    goto L362;
+L35C: // 4C08 SNE VC, 0x08
+    STEP(0x35C, 0x4C08);
+    if (V[12] != 0x08) goto L360;
+L35E: // 1374 JP 0x374
+    STEP(0x35E, 0x1374);
+    goto L374;
+L360: // 00EE RET
+    STEP(0x360, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L362: // 4E01 SNE VE, 0x01
+    STEP(0x362, 0x4E01);
+    if (V[14] != 0x01) goto L366;
+L364: // 136C JP 0x36C
+    STEP(0x364, 0x136C);
+    goto L36C;
+L366: // 4E02 SNE VE, 0x02
+    STEP(0x366, 0x4E02);
+    if (V[14] != 0x02) goto L36A;
+L368: // 1370 JP 0x370
+    STEP(0x368, 0x1370);
+    goto L370;
+L36A: // 00EE RET
+    STEP(0x36A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L36C: // 6E04 LD VE, 0x04
+    STEP(0x36C, 0x6E04);
+    V[14] = 0x04;
+L36E: // 00EE RET
+    STEP(0x36E, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L370: // 6E03 LD VE, 0x03
+    STEP(0x370, 0x6E03);
+    V[14] = 0x03;
+L372: // 00EE RET
+    STEP(0x372, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L374: // 4E03 SNE VE, 0x03
+    STEP(0x374, 0x4E03);
+    if (V[14] != 0x03) goto L378;
+L376: // 137E JP 0x37E
+    STEP(0x376, 0x137E);
+    goto L37E;
+L378: // 4E04 SNE VE, 0x04
+    STEP(0x378, 0x4E04);
+    if (V[14] != 0x04) goto L37C;
+L37A: // 1382 JP 0x382
+    STEP(0x37A, 0x1382);
+    goto L382;
+L37C: // 00EE RET
+    STEP(0x37C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L37E: // 6E02 LD VE, 0x02
+    STEP(0x37E, 0x6E02);
+    V[14] = 0x02;
+L380: // 00EE RET
+    STEP(0x380, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L382: // 6E01 LD VE, 0x01
+    STEP(0x382, 0x6E01);
+    V[14] = 0x01;
+L384: // 00EE RET
+    STEP(0x384, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L386: // 6300 LD V3, 0x00
+    STEP(0x386, 0x6300);
+    V[3] = 0x00;
+L388: // 640F LD V4, 0x0F
+    STEP(0x388, 0x640F);
+    V[4] = 0x0F;
+L38A: // A42E LD I, 0x42E
+    STEP(0x38A, 0xA42E);
+    c->I = 0x42E;
+L38C: // D342 DRW V3, V4, 2
+    STEP(0x38C, 0xD342);
+    c->pc = 0x38C;
+    predecode(0xD342, &in);
+    execute(c, &in);
+    if (c->pc != 0x38E) goto dispatch;
+L38E: // A41E LD I, 0x41E
+    STEP(0x38E, 0xA41E);
+    c->I = 0x41E;
+L390: // 6400 LD V4, 0x00
+    STEP(0x390, 0x6400);
+    V[4] = 0x00;
+L392: // 6307 LD V3, 0x07
+    STEP(0x392, 0x6307);
+    V[3] = 0x07;
+L394: // D348 DRW V3, V4, 8
+    STEP(0x394, 0xD348);
+    c->pc = 0x394;
+    predecode(0xD348, &in);
+    execute(c, &in);
+    if (c->pc != 0x396) goto dispatch;
+L396: // 7408 ADD V4, 0x08
+    STEP(0x396, 0x7408);
+    V[4] += 0x08;
+L398: // 4420 SNE V4, 0x20
+    STEP(0x398, 0x4420);
+    if (V[4] != 0x20) goto L39C;
+L39A: // 00EE RET
+    STEP(0x39A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L39C: // 1394 JP 0x394
+    STEP(0x39C, 0x1394);
+    goto L394;
+L3A0: // A426 LD I, 0x426
+    STEP(0x3A0, 0xA426);
+    c->I = 0x426;
+L3A2: // 6301 LD V3, 0x01
+    STEP(0x3A2, 0x6301);
+    V[3] = 0x01;
+L3A4: // DA31 DRW VA, V3, 1
+    STEP(0x3A4, 0xDA31);
+    c->pc = 0x3A4;
+    predecode(0xDA31, &in);
+    execute(c, &in);
+    if (c->pc != 0x3A6) goto dispatch;
+L3A6: // 631E LD V3, 0x1E
+    STEP(0x3A6, 0x631E);
+    V[3] = 0x1E;
+L3A8: // DB31 DRW VB, V3, 1
+    STEP(0x3A8, 0xDB31);
+    c->pc = 0x3A8;
+    predecode(0xDB31, &in);
+    execute(c, &in);
+    if (c->pc != 0x3AA) goto dispatch;
+L3AA: // 00EE RET
+    STEP(0x3AA, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3AC: // A427 LD I, 0x427
+    STEP(0x3AC, 0xA427);
+    c->I = 0x427;
+L3AE: // DCD1 DRW VC, VD, 1
+    STEP(0x3AE, 0xDCD1);
+    c->pc = 0x3AE;
+    predecode(0xDCD1, &in);
+    execute(c, &in);
+    if (c->pc != 0x3B0) goto dispatch;
+L3B0: // 00EE RET
+    STEP(0x3B0, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3B2: // C502 RND V5, 0x02
+    STEP(0x3B2, 0xC502);
+    c->pc = 0x3B2;
+    predecode(0xC502, &in);
+    execute(c, &in);
+    if (c->pc != 0x3B4) goto dispatch;
+L3B4: // 6308 LD V3, 0x08
+    STEP(0x3B4, 0x6308);
+    V[3] = 0x08;
+L3B6: // 6410 LD V4, 0x10
+    STEP(0x3B6, 0x6410);
+    V[4] = 0x10;
+L3B8: // A426 LD I, 0x426
+    STEP(0x3B8, 0xA426);
+    c->I = 0x426;
+L3BA: // 4500 SNE V5, 0x00
+    STEP(0x3BA, 0x4500);
+    if (V[5] != 0x00) goto L3BE;
+L3BC: // 23C8 CALL 0x3C8
+    STEP(0x3BC, 0x23C8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x3BC;
+    goto L3C8;
+L3BE: // 4501 SNE V5, 0x01
+    STEP(0x3BE, 0x4501);
+    if (V[5] != 0x01) goto L3C2;
+L3C0: // 23D0 CALL 0x3D0
+    STEP(0x3C0, 0x23D0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x3C0;
+    goto L3D0;
+L3C2: // 4502 SNE V5, 0x02
+    STEP(0x3C2, 0x4502);
+    if (V[5] != 0x02) goto L3C6;
+L3C4: // 23D8 CALL 0x3D8
+    STEP(0x3C4, 0x23D8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x3C4;
+    goto L3D8;
+L3C6: // 00EE RET
+    STEP(0x3C6, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3C8: // D341 DRW V3, V4, 1
+    STEP(0x3C8, 0xD341);
+    c->pc = 0x3C8;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x3CA) goto dispatch;
+L3CA: // 6338 LD V3, 0x38
+    STEP(0x3CA, 0x6338);
+    V[3] = 0x38;
+L3CC: // D341 DRW V3, V4, 1
+    STEP(0x3CC, 0xD341);
+    c->pc = 0x3CC;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x3CE) goto dispatch;
+L3CE: // 00EE RET
+    STEP(0x3CE, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3D0: // D341 DRW V3, V4, 1
+    STEP(0x3D0, 0xD341);
+    c->pc = 0x3D0;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x3D2) goto dispatch;
+L3D2: // 7308 ADD V3, 0x08
+    STEP(0x3D2, 0x7308);
+    V[3] += 0x08;
+L3D4: // D341 DRW V3, V4, 1
+    STEP(0x3D4, 0xD341);
+    c->pc = 0x3D4;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x3D6) goto dispatch;
+L3D6: // 00EE RET
+    STEP(0x3D6, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3D8: // 6338 LD V3, 0x38
+    STEP(0x3D8, 0x6338);
+    V[3] = 0x38;
+L3DA: // D341 DRW V3, V4, 1
+    STEP(0x3DA, 0xD341);
+    c->pc = 0x3DA;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x3DC) goto dispatch;
+L3DC: // 73F8 ADD V3, 0xF8
+    STEP(0x3DC, 0x73F8);
+    V[3] += 0xF8;
+L3DE: // D341 DRW V3, V4, 1
+    STEP(0x3DE, 0xD341);
+    c->pc = 0x3DE;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x3E0) goto dispatch;
+L3E0: // 00EE RET
+    STEP(0x3E0, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3E2: // 6301 LD V3, 0x01
+    STEP(0x3E2, 0x6301);
+    V[3] = 0x01;
+L3E4: // 6401 LD V4, 0x01
+    STEP(0x3E4, 0x6401);
+    V[4] = 0x01;
+L3E6: // F829 LD F, V8
+    STEP(0x3E6, 0xF829);
+    c->I = V[8] * 5;
+L3E8: // D345 DRW V3, V4, 5
+    STEP(0x3E8, 0xD345);
+    c->pc = 0x3E8;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x3EA) goto dispatch;
+L3EA: // 7419 ADD V4, 0x19
+    STEP(0x3EA, 0x7419);
+    V[4] += 0x19;
+L3EC: // F929 LD F, V9
+    STEP(0x3EC, 0xF929);
+    c->I = V[9] * 5;
+L3EE: // D345 DRW V3, V4, 5
+    STEP(0x3EE, 0xD345);
+    c->pc = 0x3EE;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x3F0) goto dispatch;
+L3F0: // 4701 SNE V7, 0x01
+    STEP(0x3F0, 0x4701);
+    if (V[7] != 0x01) goto L3F4;
+L3F2: // 23FA CALL 0x3FA
+    STEP(0x3F2, 0x23FA);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x3F2;
+    goto L3FA;
+L3F4: // 4702 SNE V7, 0x02
+    STEP(0x3F4, 0x4702);
+    if (V[7] != 0x02) goto L3F8;
+L3F6: // 240A CALL 0x40A
+    STEP(0x3F6, 0x240A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x3F6;
+    goto L40A;
+L3F8: // 00EE RET
+    STEP(0x3F8, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3FA: // 6409 LD V4, 0x09
+    STEP(0x3FA, 0x6409);
+    V[4] = 0x09;
+L3FC: // 600C LD V0, 0x0C
+    STEP(0x3FC, 0x600C);
+    V[0] = 0x0C;
+L3FE: // F029 LD F, V0
+    STEP(0x3FE, 0xF029);
+    c->I = V[0] * 5;
+L400: // D345 DRW V3, V4, 5
+    STEP(0x400, 0xD345);
+    c->pc = 0x400;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x402) goto dispatch;
+L402: // 6412 LD V4, 0x12
+    STEP(0x402, 0x6412);
+    V[4] = 0x12;
+L404: // A428 LD I, 0x428
+    STEP(0x404, 0xA428);
+    c->I = 0x428;
+L406: // D345 DRW V3, V4, 5
+    STEP(0x406, 0xD345);
+    c->pc = 0x406;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x408) goto dispatch;
+L408: // 00EE RET
+    STEP(0x408, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L40A: // 6409 LD V4, 0x09
+    STEP(0x40A, 0x6409);
+    V[4] = 0x09;
+L40C: // 600A LD V0, 0x0A
+    STEP(0x40C, 0x600A);
+    V[0] = 0x0A;
+L40E: // F029 LD F, V0
+    STEP(0x40E, 0xF029);
+    c->I = V[0] * 5;
+L410: // D345 DRW V3, V4, 5
+    STEP(0x410, 0xD345);
+    c->pc = 0x410;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x412) goto dispatch;
+L412: // 6412 LD V4, 0x12
+    STEP(0x412, 0x6412);
+    V[4] = 0x12;
+L414: // 7001 ADD V0, 0x01
+    STEP(0x414, 0x7001);
+    V[0] += 0x01;
+L416: // F029 LD F, V0
+    STEP(0x416, 0xF029);
+    c->I = V[0] * 5;
+L418: // D345 DRW V3, V4, 5
+    STEP(0x418, 0xD345);
+    c->pc = 0x418;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x41A) goto dispatch;
+L41A: // 00EE RET
+    STEP(0x41A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L41C: // 141C JP 0x41C
+    STEP(0x41C, 0x141C);
+    goto L41C;
+}
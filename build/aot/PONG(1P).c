@@ -0,0 +1,605 @@
+// generated by chip8-aot from roms/PONG(1P).ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x6A, 0x02, 0x6B, 0x0C, 0x6C, 0x3F, 0x6D, 0x0C, 0xA2, 0xEA, 0xDA, 0xB6,
+    0xDC, 0xD6, 0x6E, 0x00, 0x22, 0xD4, 0x66, 0x03, 0x68, 0x02, 0x60, 0x60,
+    0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x1A, 0xC7, 0x17, 0x77, 0x08,
+    0x69, 0xFF, 0xA2, 0xF0, 0xD6, 0x71, 0xA2, 0xEA, 0xDA, 0xB6, 0xDC, 0xD6,
+    0x60, 0x01, 0xE0, 0xA1, 0x7B, 0xFE, 0x60, 0x04, 0xE0, 0xA1, 0x7B, 0x02,
+    0x60, 0x1F, 0x8B, 0x02, 0xDA, 0xB6, 0x8D, 0x70, 0xC0, 0x0A, 0x7D, 0xFE,
+    0x40, 0x00, 0x7D, 0x02, 0x60, 0x00, 0x60, 0x1F, 0x8D, 0x02, 0xDC, 0xD6,
+    0xA2, 0xF0, 0xD6, 0x71, 0x86, 0x84, 0x87, 0x94, 0x60, 0x3F, 0x86, 0x02,
+    0x61, 0x1F, 0x87, 0x12, 0x46, 0x02, 0x12, 0x78, 0x46, 0x3F, 0x12, 0x82,
+    0x47, 0x1F, 0x69, 0xFF, 0x47, 0x00, 0x69, 0x01, 0xD6, 0x71, 0x12, 0x2A,
+    0x68, 0x02, 0x63, 0x01, 0x80, 0x70, 0x80, 0xB5, 0x12, 0x8A, 0x68, 0xFE,
+    0x63, 0x0A, 0x80, 0x70, 0x80, 0xD5, 0x3F, 0x01, 0x12, 0xA2, 0x61, 0x02,
+    0x80, 0x15, 0x3F, 0x01, 0x12, 0xBA, 0x80, 0x15, 0x3F, 0x01, 0x12, 0xC8,
+    0x80, 0x15, 0x3F, 0x01, 0x12, 0xC2, 0x60, 0x20, 0xF0, 0x18, 0x22, 0xD4,
+    0x8E, 0x34, 0x22, 0xD4, 0x66, 0x3E, 0x33, 0x01, 0x66, 0x03, 0x68, 0xFE,
+    0x33, 0x01, 0x68, 0x02, 0x12, 0x16, 0x79, 0xFF, 0x49, 0xFE, 0x69, 0xFF,
+    0x12, 0xC8, 0x79, 0x01, 0x49, 0x02, 0x69, 0x01, 0x60, 0x04, 0xF0, 0x18,
+    0x76, 0x01, 0x46, 0x40, 0x76, 0xFE, 0x12, 0x6C, 0xA2, 0xF2, 0xFE, 0x33,
+    0xF2, 0x65, 0xF1, 0x29, 0x64, 0x14, 0x65, 0x00, 0xD4, 0x55, 0x74, 0x15,
+    0xF2, 0x29, 0xD4, 0x55, 0x00, 0xEE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const size_t aot_rom_size = 246;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 6A02 LD VA, 0x02
+    STEP(0x200, 0x6A02);
+    V[10] = 0x02;
+L202: // 6B0C LD VB, 0x0C
+    STEP(0x202, 0x6B0C);
+    V[11] = 0x0C;
+L204: // 6C3F LD VC, 0x3F
+    STEP(0x204, 0x6C3F);
+    V[12] = 0x3F;
+L206: // 6D0C LD VD, 0x0C
+    STEP(0x206, 0x6D0C);
+    V[13] = 0x0C;
+L208: // A2EA LD I, 0x2EA
+    STEP(0x208, 0xA2EA);
+    c->I = 0x2EA;
+L20A: // DAB6 DRW VA, VB, 6
+    STEP(0x20A, 0xDAB6);
+    c->pc = 0x20A;
+    predecode(0xDAB6, &in);
+    execute(c, &in);
+    if (c->pc != 0x20C) goto dispatch;
+L20C: // DCD6 DRW VC, VD, 6
+    STEP(0x20C, 0xDCD6);
+    c->pc = 0x20C;
+    predecode(0xDCD6, &in);
+    execute(c, &in);
+    if (c->pc != 0x20E) goto dispatch;
+L20E: // 6E00 LD VE, 0x00
+    STEP(0x20E, 0x6E00);
+    V[14] = 0x00;
+L210: // 22D4 CALL 0x2D4
+    STEP(0x210, 0x22D4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x210;
+    goto L2D4;
+L212: // 6603 LD V6, 0x03
+    STEP(0x212, 0x6603);
+    V[6] = 0x03;
+L214: // 6802 LD V8, 0x02
+    STEP(0x214, 0x6802);
+    V[8] = 0x02;
+L216: // 6060 LD V0, 0x60
+    STEP(0x216, 0x6060);
+    V[0] = 0x60;
+L218: // F015 LD DT, V0
+    STEP(0x218, 0xF015);
+    c->dt = V[0];
+L21A: // F007 LD V0, DT
+    STEP(0x21A, 0xF007);
+    V[0] = c->dt;
+L21C: // 3000 SE V0, 0x00
+    STEP(0x21C, 0x3000);
+    if (V[0] == 0x00) goto L220;
+L21E: // 121A JP 0x21A
+    STEP(0x21E, 0x121A);
+    goto L21A;
+L220: // C717 RND V7, 0x17
+    STEP(0x220, 0xC717);
+    c->pc = 0x220;
+    predecode(0xC717, &in);
+    execute(c, &in);
+    if (c->pc != 0x222) goto dispatch;
+L222: // 7708 ADD V7, 0x08
+    STEP(0x222, 0x7708);
+    V[7] += 0x08;
+L224: // 69FF LD V9, 0xFF
+    STEP(0x224, 0x69FF);
+    V[9] = 0xFF;
+L226: // A2F0 LD I, 0x2F0
+    STEP(0x226, 0xA2F0);
+    c->I = 0x2F0;
+L228: // D671 DRW V6, V7, 1
+    STEP(0x228, 0xD671);
+    c->pc = 0x228;
+    predecode(0xD671, &in);
+    execute(c, &in);
+    if (c->pc != 0x22A) goto dispatch;
+L22A: // A2EA LD I, 0x2EA
+    STEP(0x22A, 0xA2EA);
+    c->I = 0x2EA;
+L22C: // DAB6 DRW VA, VB, 6
+    STEP(0x22C, 0xDAB6);
+    c->pc = 0x22C;
+    predecode(0xDAB6, &in);
+    execute(c, &in);
+    if (c->pc != 0x22E) goto dispatch;
+L22E: // DCD6 DRW VC, VD, 6
+    STEP(0x22E, 0xDCD6);
+    c->pc = 0x22E;
+    predecode(0xDCD6, &in);
+    execute(c, &in);
+    if (c->pc != 0x230) goto dispatch;
+L230: // 6001 LD V0, 0x01
+    STEP(0x230, 0x6001);
+    V[0] = 0x01;
+L232: // E0A1 SKNP V0
+    STEP(0x232, 0xE0A1);
+    c->pc = 0x232;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x234) goto dispatch;
+L234: // 7BFE ADD VB, 0xFE
+    STEP(0x234, 0x7BFE);
+    V[11] += 0xFE;
+L236: // 6004 LD V0, 0x04
+    STEP(0x236, 0x6004);
+    V[0] = 0x04;
+L238: // E0A1 SKNP V0
+    STEP(0x238, 0xE0A1);
+    c->pc = 0x238;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x23A) goto dispatch;
+L23A: // 7B02 ADD VB, 0x02
+    STEP(0x23A, 0x7B02);
+    V[11] += 0x02;
+L23C: // 601F LD V0, 0x1F
+    STEP(0x23C, 0x601F);
+    V[0] = 0x1F;
+L23E: // 8B02 AND VB, V0
+    STEP(0x23E, 0x8B02);
+    V[11] &= V[0];
+L240: // DAB6 DRW VA, VB, 6
+    STEP(0x240, 0xDAB6);
+    c->pc = 0x240;
+    predecode(0xDAB6, &in);
+    execute(c, &in);
+    if (c->pc != 0x242) goto dispatch;
+L242: // 8D70 LD VD, V7
+    STEP(0x242, 0x8D70);
+    V[13] = V[7];
+L244: // C00A RND V0, 0x0A
+    STEP(0x244, 0xC00A);
+    c->pc = 0x244;
+    predecode(0xC00A, &in);
+    execute(c, &in);
+    if (c->pc != 0x246) goto dispatch;
+L246: // 7DFE ADD VD, 0xFE
+    STEP(0x246, 0x7DFE);
+    V[13] += 0xFE;
+L248: // 4000 SNE V0, 0x00
+    STEP(0x248, 0x4000);
+    if (V[0] != 0x00) goto L24C;
+L24A: // 7D02 ADD VD, 0x02
+    STEP(0x24A, 0x7D02);
+    V[13] += 0x02;
+L24C: // 6000 LD V0, 0x00
+    STEP(0x24C, 0x6000);
+    V[0] = 0x00;
+L24E: // 601F LD V0, 0x1F
+    STEP(0x24E, 0x601F);
+    V[0] = 0x1F;
+L250: // 8D02 AND VD, V0
+    STEP(0x250, 0x8D02);
+    V[13] &= V[0];
+L252: // DCD6 DRW VC, VD, 6
+    STEP(0x252, 0xDCD6);
+    c->pc = 0x252;
+    predecode(0xDCD6, &in);
+    execute(c, &in);
+    if (c->pc != 0x254) goto dispatch;
+L254: // A2F0 LD I, 0x2F0
+    STEP(0x254, 0xA2F0);
+    c->I = 0x2F0;
+L256: // D671 DRW V6, V7, 1
+    STEP(0x256, 0xD671);
+    c->pc = 0x256;
+    predecode(0xD671, &in);
+    execute(c, &in);
+    if (c->pc != 0x258) goto dispatch;
+L258: // 8684 ADD V6, V8
+    STEP(0x258, 0x8684);
+    V[15] = V[6] + V[8] > 0xFF;
+    V[6] += V[8];
+L25A: // 8794 ADD V7, V9
+    STEP(0x25A, 0x8794);
+    V[15] = V[7] + V[9] > 0xFF;
+    V[7] += V[9];
+L25C: // 603F LD V0, 0x3F
+    STEP(0x25C, 0x603F);
+    V[0] = 0x3F;
+L25E: // 8602 AND V6, V0
+    STEP(0x25E, 0x8602);
+    V[6] &= V[0];
+L260: // 611F LD V1, 0x1F
+    STEP(0x260, 0x611F);
+    V[1] = 0x1F;
+L262: // 8712 AND V7, V1
+    STEP(0x262, 0x8712);
+    V[7] &= V[1];
+L264: // 4602 SNE V6, 0x02
+    STEP(0x264, 0x4602);
+    if (V[6] != 0x02) goto L268;
+L266: // 1278 JP 0x278
+    STEP(0x266, 0x1278);
+    goto L278;
+L268: // 463F SNE V6, 0x3F
+    STEP(0x268, 0x463F);
+    if (V[6] != 0x3F) goto L26C;
+L26A: // 1282 JP 0x282
+    STEP(0x26A, 0x1282);
+    goto L282;
+L26C: // 471F SNE V7, 0x1F
+    STEP(0x26C, 0x471F);
+    if (V[7] != 0x1F) goto L270;
+L26E: // 69FF LD V9, 0xFF
+    STEP(0x26E, 0x69FF);
+    V[9] = 0xFF;
+L270: // 4700 SNE V7, 0x00
+    STEP(0x270, 0x4700);
+    if (V[7] != 0x00) goto L274;
+L272: // 6901 LD V9, 0x01
+    STEP(0x272, 0x6901);
+    V[9] = 0x01;
+L274: // D671 DRW V6, V7, 1
+    STEP(0x274, 0xD671);
+    c->pc = 0x274;
+    predecode(0xD671, &in);
+    execute(c, &in);
+    if (c->pc != 0x276) goto dispatch;
+L276: // 122A JP 0x22A
+    STEP(0x276, 0x122A);
+    goto L22A;
+L278: // 6802 LD V8, 0x02
+    STEP(0x278, 0x6802);
+    V[8] = 0x02;
+L27A: // 6301 LD V3, 0x01
+    STEP(0x27A, 0x6301);
+    V[3] = 0x01;
+L27C: // 8070 LD V0, V7
+    STEP(0x27C, 0x8070);
+    V[0] = V[7];
+L27E: // 80B5 SUB V0, VB
+    STEP(0x27E, 0x80B5);
+    V[15] = V[0] > V[11];
+    V[0] -= V[11];
+L280: // 128A JP 0x28A
+    STEP(0x280, 0x128A);
+    goto L28A;
+L282: // 68FE LD V8, 0xFE
+    STEP(0x282, 0x68FE);
+    V[8] = 0xFE;
+L284: // 630A LD V3, 0x0A
+    STEP(0x284, 0x630A);
+    V[3] = 0x0A;
+L286: // 8070 LD V0, V7
+    STEP(0x286, 0x8070);
+    V[0] = V[7];
+L288: // 80D5 SUB V0, VD
+    STEP(0x288, 0x80D5);
+    V[15] = V[0] > V[13];
+    V[0] -= V[13];
+L28A: // 3F01 SE VF, 0x01
+    STEP(0x28A, 0x3F01);
+    if (V[15] == 0x01) goto L28E;
+L28C: // 12A2 JP 0x2A2
+    STEP(0x28C, 0x12A2);
+    goto L2A2;
+L28E: // 6102 LD V1, 0x02
+    STEP(0x28E, 0x6102);
+    V[1] = 0x02;
+L290: // 8015 SUB V0, V1
+    STEP(0x290, 0x8015);
+    V[15] = V[0] > V[1];
+    V[0] -= V[1];
+L292: // 3F01 SE VF, 0x01
+    STEP(0x292, 0x3F01);
+    if (V[15] == 0x01) goto L296;
+L294: // 12BA JP 0x2BA
+    STEP(0x294, 0x12BA);
+    goto L2BA;
+L296: // 8015 SUB V0, V1
+    STEP(0x296, 0x8015);
+    V[15] = V[0] > V[1];
+    V[0] -= V[1];
+L298: // 3F01 SE VF, 0x01
+    STEP(0x298, 0x3F01);
+    if (V[15] == 0x01) goto L29C;
+L29A: // 12C8 JP 0x2C8
+    STEP(0x29A, 0x12C8);
+    goto L2C8;
+L29C: // 8015 SUB V0, V1
+    STEP(0x29C, 0x8015);
+    V[15] = V[0] > V[1];
+    V[0] -= V[1];
+L29E: // 3F01 SE VF, 0x01
+    STEP(0x29E, 0x3F01);
+    if (V[15] == 0x01) goto L2A2;
+L2A0: // 12C2 JP 0x2C2
+    STEP(0x2A0, 0x12C2);
+    goto L2C2;
+L2A2: // 6020 LD V0, 0x20
+    STEP(0x2A2, 0x6020);
+    V[0] = 0x20;
+L2A4: // F018 LD ST, V0
+    STEP(0x2A4, 0xF018);
+    c->st = V[0];
+L2A6: // 22D4 CALL 0x2D4
+    STEP(0x2A6, 0x22D4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2A6;
+    goto L2D4;
+L2A8: // 8E34 ADD VE, V3
+    STEP(0x2A8, 0x8E34);
+    V[15] = V[14] + V[3] > 0xFF;
+    V[14] += V[3];
+L2AA: // 22D4 CALL 0x2D4
+    STEP(0x2AA, 0x22D4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2AA;
+    goto L2D4;
+L2AC: // 663E LD V6, 0x3E
+    STEP(0x2AC, 0x663E);
+    V[6] = 0x3E;
+L2AE: // 3301 SE V3, 0x01
+    STEP(0x2AE, 0x3301);
+    if (V[3] == 0x01) goto L2B2;
+L2B0: // 6603 LD V6, 0x03
+    STEP(0x2B0, 0x6603);
+    V[6] = 0x03;
+L2B2: // 68FE LD V8, 0xFE
+    STEP(0x2B2, 0x68FE);
+    V[8] = 0xFE;
+L2B4: // 3301 SE V3, 0x01
+    STEP(0x2B4, 0x3301);
+    if (V[3] == 0x01) goto L2B8;
+L2B6: // 6802 LD V8, 0x02
+    STEP(0x2B6, 0x6802);
+    V[8] = 0x02;
+L2B8: // 1216 JP 0x216
+    STEP(0x2B8, 0x1216);
+    goto L216;
+L2BA: // 79FF ADD V9, 0xFF
+    STEP(0x2BA, 0x79FF);
+    V[9] += 0xFF;
+L2BC: // 49FE SNE V9, 0xFE
+    STEP(0x2BC, 0x49FE);
+    if (V[9] != 0xFE) goto L2C0;
+L2BE: // 69FF LD V9, 0xFF
+    STEP(0x2BE, 0x69FF);
+    V[9] = 0xFF;
+L2C0: // 12C8 JP 0x2C8
+    STEP(0x2C0, 0x12C8);
+    goto L2C8;
+L2C2: // 7901 ADD V9, 0x01
+    STEP(0x2C2, 0x7901);
+    V[9] += 0x01;
+L2C4: // 4902 SNE V9, 0x02
+    STEP(0x2C4, 0x4902);
+    if (V[9] != 0x02) goto L2C8;
+L2C6: // 6901 LD V9, 0x01
+    STEP(0x2C6, 0x6901);
+    V[9] = 0x01;
+L2C8: // 6004 LD V0, 0x04
+    STEP(0x2C8, 0x6004);
+    V[0] = 0x04;
+L2CA: // F018 LD ST, V0
+    STEP(0x2CA, 0xF018);
+    c->st = V[0];
+L2CC: // 7601 ADD V6, 0x01
+    STEP(0x2CC, 0x7601);
+    V[6] += 0x01;
+L2CE: // 4640 SNE V6, 0x40
+    STEP(0x2CE, 0x4640);
+    if (V[6] != 0x40) goto L2D2;
+L2D0: // 76FE ADD V6, 0xFE
+    STEP(0x2D0, 0x76FE);
+    V[6] += 0xFE;
+L2D2: // 126C JP 0x26C
+    STEP(0x2D2, 0x126C);
+    goto L26C;
+L2D4: // A2F2 LD I, 0x2F2
+    STEP(0x2D4, 0xA2F2);
+    c->I = 0x2F2;
+L2D6: // FE33 LD B, VE
+    STEP(0x2D6, 0xFE33);
+    c->pc = 0x2D6;
+    predecode(0xFE33, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2D8) goto dispatch;
+L2D8: // F265 LD V2, [I]
+    STEP(0x2D8, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2DA: // F129 LD F, V1
+    STEP(0x2DA, 0xF129);
+    c->I = V[1] * 5;
+L2DC: // 6414 LD V4, 0x14
+    STEP(0x2DC, 0x6414);
+    V[4] = 0x14;
+L2DE: // 6500 LD V5, 0x00
+    STEP(0x2DE, 0x6500);
+    V[5] = 0x00;
+L2E0: // D455 DRW V4, V5, 5
+    STEP(0x2E0, 0xD455);
+    c->pc = 0x2E0;
+    predecode(0xD455, &in);
+    execute(c, &in);
+    if (c->pc != 0x2E2) goto dispatch;
+L2E2: // 7415 ADD V4, 0x15
+    STEP(0x2E2, 0x7415);
+    V[4] += 0x15;
+L2E4: // F229 LD F, V2
+    STEP(0x2E4, 0xF229);
+    c->I = V[2] * 5;
+L2E6: // D455 DRW V4, V5, 5
+    STEP(0x2E6, 0xD455);
+    c->pc = 0x2E6;
+    predecode(0xD455, &in);
+    execute(c, &in);
+    if (c->pc != 0x2E8) goto dispatch;
+L2E8: // 00EE RET
+    STEP(0x2E8, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,452 @@
+// generated by chip8-aot from roms/PUZZLE.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x6A, 0x12, 0x6B, 0x01, 0x61, 0x10, 0x62, 0x00, 0x60, 0x00, 0xA2, 0xB0,
+    0xD1, 0x27, 0xF0, 0x29, 0x30, 0x00, 0xDA, 0xB5, 0x71, 0x08, 0x7A, 0x08,
+    0x31, 0x30, 0x12, 0x24, 0x61, 0x10, 0x72, 0x08, 0x6A, 0x12, 0x7B, 0x08,
+    0xA3, 0x00, 0xF0, 0x1E, 0xF0, 0x55, 0x70, 0x01, 0x30, 0x10, 0x12, 0x0A,
+    0x6A, 0x12, 0x6B, 0x01, 0x6C, 0x00, 0x62, 0xFF, 0xC0, 0x06, 0x70, 0x02,
+    0x22, 0x52, 0x72, 0xFF, 0x32, 0x00, 0x12, 0x38, 0x6E, 0x00, 0x6E, 0x00,
+    0xF0, 0x0A, 0x22, 0x52, 0x7E, 0x01, 0x7E, 0x01, 0x12, 0x48, 0x84, 0xA0,
+    0x85, 0xB0, 0x86, 0xC0, 0x30, 0x02, 0x12, 0x64, 0x45, 0x01, 0x12, 0x64,
+    0x75, 0xF8, 0x76, 0xFC, 0x30, 0x08, 0x12, 0x70, 0x45, 0x19, 0x12, 0x70,
+    0x75, 0x08, 0x76, 0x04, 0x30, 0x06, 0x12, 0x7C, 0x44, 0x12, 0x12, 0x7C,
+    0x74, 0xF8, 0x76, 0xFF, 0x30, 0x04, 0x12, 0x88, 0x44, 0x2A, 0x12, 0x88,
+    0x74, 0x08, 0x76, 0x01, 0xA3, 0x00, 0xF6, 0x1E, 0xF0, 0x65, 0x81, 0x00,
+    0x60, 0x00, 0xA3, 0x00, 0xF6, 0x1E, 0xF0, 0x55, 0xA3, 0x00, 0xFC, 0x1E,
+    0x80, 0x10, 0xF0, 0x55, 0xF1, 0x29, 0xD4, 0x55, 0xDA, 0xB5, 0x8A, 0x40,
+    0x8B, 0x50, 0x8C, 0x60, 0x00, 0xEE, 0xEE, 0x5E, 0xFE, 0xFE, 0xFE, 0xFE,
+    0xFE, 0xFE, 0xFE, 0xFE,
+};
+const size_t aot_rom_size = 184;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000700ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 6A12 LD VA, 0x12
+    STEP(0x200, 0x6A12);
+    V[10] = 0x12;
+L202: // 6B01 LD VB, 0x01
+    STEP(0x202, 0x6B01);
+    V[11] = 0x01;
+L204: // 6110 LD V1, 0x10
+    STEP(0x204, 0x6110);
+    V[1] = 0x10;
+L206: // 6200 LD V2, 0x00
+    STEP(0x206, 0x6200);
+    V[2] = 0x00;
+L208: // 6000 LD V0, 0x00
+    STEP(0x208, 0x6000);
+    V[0] = 0x00;
+L20A: // A2B0 LD I, 0x2B0
+    STEP(0x20A, 0xA2B0);
+    c->I = 0x2B0;
+L20C: // D127 DRW V1, V2, 7
+    STEP(0x20C, 0xD127);
+    c->pc = 0x20C;
+    predecode(0xD127, &in);
+    execute(c, &in);
+    if (c->pc != 0x20E) goto dispatch;
+L20E: // F029 LD F, V0
+    STEP(0x20E, 0xF029);
+    c->I = V[0] * 5;
+L210: // 3000 SE V0, 0x00
+    STEP(0x210, 0x3000);
+    if (V[0] == 0x00) goto L214;
+L212: // DAB5 DRW VA, VB, 5
+    STEP(0x212, 0xDAB5);
+    c->pc = 0x212;
+    predecode(0xDAB5, &in);
+    execute(c, &in);
+    if (c->pc != 0x214) goto dispatch;
+L214: // 7108 ADD V1, 0x08
+    STEP(0x214, 0x7108);
+    V[1] += 0x08;
+L216: // 7A08 ADD VA, 0x08
+    STEP(0x216, 0x7A08);
+    V[10] += 0x08;
+L218: // 3130 SE V1, 0x30
+    STEP(0x218, 0x3130);
+    if (V[1] == 0x30) goto L21C;
+L21A: // 1224 JP 0x224
+    STEP(0x21A, 0x1224);
+    goto L224;
+L21C: // 6110 LD V1, 0x10
+    STEP(0x21C, 0x6110);
+    V[1] = 0x10;
+L21E: // 7208 ADD V2, 0x08
+    STEP(0x21E, 0x7208);
+    V[2] += 0x08;
+L220: // 6A12 LD VA, 0x12
+    STEP(0x220, 0x6A12);
+    V[10] = 0x12;
+L222: // 7B08 ADD VB, 0x08
+    STEP(0x222, 0x7B08);
+    V[11] += 0x08;
+L224: // A300 LD I, 0x300
+    STEP(0x224, 0xA300);
+    c->I = 0x300;
+L226: // F01E ADD I, V0
+    STEP(0x226, 0xF01E);
+    c->I += V[0];
+L228: // F055 LD [I], V0
+    STEP(0x228, 0xF055);
+    c->pc = 0x228;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x22A) goto dispatch;
+L22A: // 7001 ADD V0, 0x01
+    STEP(0x22A, 0x7001);
+    V[0] += 0x01;
+L22C: // 3010 SE V0, 0x10
+    STEP(0x22C, 0x3010);
+    if (V[0] == 0x10) goto L230;
+L22E: // 120A JP 0x20A
+    STEP(0x22E, 0x120A);
+    goto L20A;
+L230: // 6A12 LD VA, 0x12
+    STEP(0x230, 0x6A12);
+    V[10] = 0x12;
+L232: // 6B01 LD VB, 0x01
+    STEP(0x232, 0x6B01);
+    V[11] = 0x01;
+L234: // 6C00 LD VC, 0x00
+    STEP(0x234, 0x6C00);
+    V[12] = 0x00;
+L236: // 62FF LD V2, 0xFF
+    STEP(0x236, 0x62FF);
+    V[2] = 0xFF;
+L238: // C006 RND V0, 0x06
+    STEP(0x238, 0xC006);
+    c->pc = 0x238;
+    predecode(0xC006, &in);
+    execute(c, &in);
+    if (c->pc != 0x23A) goto dispatch;
+L23A: // 7002 ADD V0, 0x02
+    STEP(0x23A, 0x7002);
+    V[0] += 0x02;
+L23C: // 2252 CALL 0x252
+    STEP(0x23C, 0x2252);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x23C;
+    goto L252;
+L23E: // 72FF ADD V2, 0xFF
+    STEP(0x23E, 0x72FF);
+    V[2] += 0xFF;
+L240: // 3200 SE V2, 0x00
+    STEP(0x240, 0x3200);
+    if (V[2] == 0x00) goto L244;
+L242: // 1238 JP 0x238
+    STEP(0x242, 0x1238);
+    goto L238;
+L244: // 6E00 LD VE, 0x00
+    STEP(0x244, 0x6E00);
+    V[14] = 0x00;
+L246: // 6E00 LD VE, 0x00
+    STEP(0x246, 0x6E00);
+    V[14] = 0x00;
+L248: // F00A LD V0, K
+    STEP(0x248, 0xF00A);
+    if (c->keypad == 0) {
+        c->pc = 0x248;
+        return cycles - left;
+    }
+    V[0] = __builtin_ctz(c->keypad);
+L24A: // 2252 CALL 0x252
+    STEP(0x24A, 0x2252);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x24A;
+    goto L252;
+L24C: // 7E01 ADD VE, 0x01
+    STEP(0x24C, 0x7E01);
+    V[14] += 0x01;
+L24E: // 7E01 ADD VE, 0x01
+    STEP(0x24E, 0x7E01);
+    V[14] += 0x01;
+L250: // 1248 JP 0x248
+    STEP(0x250, 0x1248);
+    goto L248;
+L252: // 84A0 LD V4, VA
+    STEP(0x252, 0x84A0);
+    V[4] = V[10];
+L254: // 85B0 LD V5, VB
+    STEP(0x254, 0x85B0);
+    V[5] = V[11];
+L256: // 86C0 LD V6, VC
+    STEP(0x256, 0x86C0);
+    V[6] = V[12];
+L258: // 3002 SE V0, 0x02
+    STEP(0x258, 0x3002);
+    if (V[0] == 0x02) goto L25C;
+L25A: // 1264 JP 0x264
+    STEP(0x25A, 0x1264);
+    goto L264;
+L25C: // 4501 SNE V5, 0x01
+    STEP(0x25C, 0x4501);
+    if (V[5] != 0x01) goto L260;
+L25E: // 1264 JP 0x264
+    STEP(0x25E, 0x1264);
+    goto L264;
+L260: // 75F8 ADD V5, 0xF8
+    STEP(0x260, 0x75F8);
+    V[5] += 0xF8;
+L262: // 76FC ADD V6, 0xFC
+    STEP(0x262, 0x76FC);
+    V[6] += 0xFC;
+L264: // 3008 SE V0, 0x08
+    STEP(0x264, 0x3008);
+    if (V[0] == 0x08) goto L268;
+L266: // 1270 JP 0x270
+    STEP(0x266, 0x1270);
+    goto L270;
+L268: // 4519 SNE V5, 0x19
+    STEP(0x268, 0x4519);
+    if (V[5] != 0x19) goto L26C;
+L26A: // 1270 JP 0x270
+    STEP(0x26A, 0x1270);
+    goto L270;
+L26C: // 7508 ADD V5, 0x08
+    STEP(0x26C, 0x7508);
+    V[5] += 0x08;
+L26E: // 7604 ADD V6, 0x04
+    STEP(0x26E, 0x7604);
+    V[6] += 0x04;
+L270: // 3006 SE V0, 0x06
+    STEP(0x270, 0x3006);
+    if (V[0] == 0x06) goto L274;
+L272: // 127C JP 0x27C
+    STEP(0x272, 0x127C);
+    goto L27C;
+L274: // 4412 SNE V4, 0x12
+    STEP(0x274, 0x4412);
+    if (V[4] != 0x12) goto L278;
+L276: // 127C JP 0x27C
+    STEP(0x276, 0x127C);
+    goto L27C;
+L278: // 74F8 ADD V4, 0xF8
+    STEP(0x278, 0x74F8);
+    V[4] += 0xF8;
+L27A: // 76FF ADD V6, 0xFF
+    STEP(0x27A, 0x76FF);
+    V[6] += 0xFF;
+L27C: // 3004 SE V0, 0x04
+    STEP(0x27C, 0x3004);
+    if (V[0] == 0x04) goto L280;
+L27E: // 1288 JP 0x288
+    STEP(0x27E, 0x1288);
+    goto L288;
+L280: // 442A SNE V4, 0x2A
+    STEP(0x280, 0x442A);
+    if (V[4] != 0x2A) goto L284;
+L282: // 1288 JP 0x288
+    STEP(0x282, 0x1288);
+    goto L288;
+L284: // 7408 ADD V4, 0x08
+    STEP(0x284, 0x7408);
+    V[4] += 0x08;
+L286: // 7601 ADD V6, 0x01
+    STEP(0x286, 0x7601);
+    V[6] += 0x01;
+L288: // A300 LD I, 0x300
+    STEP(0x288, 0xA300);
+    c->I = 0x300;
+L28A: // F61E ADD I, V6
+    STEP(0x28A, 0xF61E);
+    c->I += V[6];
+L28C: // F065 LD V0, [I]
+    STEP(0x28C, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L28E: // 8100 LD V1, V0
+    STEP(0x28E, 0x8100);
+    V[1] = V[0];
+L290: // 6000 LD V0, 0x00
+    STEP(0x290, 0x6000);
+    V[0] = 0x00;
+L292: // A300 LD I, 0x300
+    STEP(0x292, 0xA300);
+    c->I = 0x300;
+L294: // F61E ADD I, V6
+    STEP(0x294, 0xF61E);
+    c->I += V[6];
+L296: // F055 LD [I], V0
+    STEP(0x296, 0xF055);
+    c->pc = 0x296;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x298) goto dispatch;
+L298: // A300 LD I, 0x300
+    STEP(0x298, 0xA300);
+    c->I = 0x300;
+L29A: // FC1E ADD I, VC
+    STEP(0x29A, 0xFC1E);
+    c->I += V[12];
+L29C: // 8010 LD V0, V1
+    STEP(0x29C, 0x8010);
+    V[0] = V[1];
+L29E: // F055 LD [I], V0
+    STEP(0x29E, 0xF055);
+    c->pc = 0x29E;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2A0) goto dispatch;
+L2A0: // F129 LD F, V1
+    STEP(0x2A0, 0xF129);
+    c->I = V[1] * 5;
+L2A2: // D455 DRW V4, V5, 5
+    STEP(0x2A2, 0xD455);
+    c->pc = 0x2A2;
+    predecode(0xD455, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A4) goto dispatch;
+L2A4: // DAB5 DRW VA, VB, 5
+    STEP(0x2A4, 0xDAB5);
+    c->pc = 0x2A4;
+    predecode(0xDAB5, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A6) goto dispatch;
+L2A6: // 8A40 LD VA, V4
+    STEP(0x2A6, 0x8A40);
+    V[10] = V[4];
+L2A8: // 8B50 LD VB, V5
+    STEP(0x2A8, 0x8B50);
+    V[11] = V[5];
+L2AA: // 8C60 LD VC, V6
+    STEP(0x2AA, 0x8C60);
+    V[12] = V[6];
+L2AC: // 00EE RET
+    STEP(0x2AC, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,1095 @@
+// generated by chip8-aot from roms/ROCKET.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x12, 0x12, 0x4A, 0x6F, 0x6E, 0x61, 0x73, 0x21, 0xFF, 0xFF, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0xE0, 0x60, 0x01, 0x61, 0x01,
+    0x62, 0x3E, 0xA2, 0x08, 0xD0, 0x11, 0xD0, 0x21, 0x70, 0x08, 0x30, 0x41,
+    0x12, 0x1C, 0xA2, 0x0A, 0x60, 0x02, 0x61, 0x01, 0x62, 0x3F, 0xD1, 0x07,
+    0xD2, 0x07, 0x70, 0x07, 0x30, 0x1E, 0x12, 0x2E, 0x12, 0x74, 0xC4, 0xAA,
+    0xCA, 0xAA, 0xA4, 0x00, 0x84, 0x8A, 0x8E, 0x8A, 0xEA, 0x00, 0x6A, 0x8A,
+    0x8C, 0x8A, 0x6A, 0x00, 0xAA, 0xAE, 0xAE, 0xAA, 0x4A, 0x00, 0xEE, 0x84,
+    0xC4, 0x84, 0xE4, 0x00, 0x6A, 0x8A, 0x8E, 0x8A, 0x6A, 0x00, 0xA2, 0x3A,
+    0x62, 0x0C, 0xD0, 0x1B, 0x70, 0x08, 0xF2, 0x1E, 0xD0, 0x1B, 0x70, 0x08,
+    0xF2, 0x1E, 0xD0, 0x1B, 0x70, 0xF0, 0x00, 0xEE, 0xC0, 0x1F, 0xC1, 0x0F,
+    0x70, 0x06, 0x71, 0x03, 0x22, 0x5E, 0x62, 0x1E, 0xF2, 0x15, 0xF2, 0x07,
+    0x32, 0x00, 0x12, 0x8C, 0x22, 0x5E, 0x12, 0x74, 0x62, 0x0B, 0xE2, 0x9E,
+    0x12, 0x82, 0x22, 0x5E, 0x12, 0xD4, 0xF8, 0x70, 0x70, 0x70, 0x70, 0x20,
+    0x20, 0x03, 0xA2, 0x96, 0xD0, 0x16, 0x00, 0xEE, 0xAF, 0xA0, 0xF2, 0x55,
+    0xA2, 0x9C, 0xF1, 0x65, 0x62, 0x06, 0xE2, 0x9E, 0x12, 0xB8, 0x22, 0x9E,
+    0x70, 0x01, 0x22, 0x9E, 0x62, 0x04, 0xE2, 0x9E, 0x12, 0xC4, 0x22, 0x9E,
+    0x70, 0xFF, 0x22, 0x9E, 0x3F, 0x00, 0x13, 0x9C, 0xA2, 0x9C, 0xF1, 0x55,
+    0xAF, 0xA0, 0xF2, 0x65, 0x00, 0xEE, 0x19, 0x19, 0xAF, 0x00, 0x60, 0x1D,
+    0x81, 0x00, 0x82, 0x00, 0x83, 0x00, 0x84, 0x00, 0xF4, 0x55, 0xA2, 0x9C,
+    0x60, 0x20, 0x61, 0x03, 0xF1, 0x55, 0x6D, 0x0D, 0x6E, 0x00, 0x13, 0x24,
+    0x62, 0x02, 0x63, 0x00, 0xAF, 0x00, 0xF3, 0x1E, 0xF1, 0x65, 0xA2, 0x0A,
+    0xD0, 0x27, 0xD1, 0x27, 0x3F, 0x00, 0x13, 0x9C, 0x80, 0xD4, 0xD0, 0x27,
+    0x80, 0x10, 0x81, 0xD4, 0xD1, 0x27, 0x3F, 0x00, 0x13, 0x9C, 0xAF, 0x00,
+    0xF3, 0x1E, 0xF0, 0x55, 0x22, 0xA4, 0x72, 0x07, 0x73, 0x01, 0x33, 0x04,
+    0x12, 0xF4, 0x00, 0xEE, 0x61, 0x02, 0x62, 0x00, 0xAF, 0x00, 0xF2, 0x1E,
+    0xF0, 0x65, 0xA2, 0x0A, 0xD0, 0x17, 0x80, 0xD4, 0xD0, 0x17, 0x71, 0x07,
+    0x72, 0x01, 0x32, 0x04, 0x13, 0x28, 0xA2, 0x9C, 0xF1, 0x65, 0xA2, 0x96,
+    0xD0, 0x16, 0x22, 0xF0, 0xAF, 0x00, 0x60, 0x04, 0xF0, 0x1E, 0xF0, 0x65,
+    0xC1, 0x02, 0x71, 0xFF, 0x80, 0x14, 0x40, 0x02, 0x60, 0x03, 0x40, 0x2E,
+    0x60, 0x2D, 0xF0, 0x55, 0x7E, 0x01, 0x60, 0x1F, 0x81, 0xE0, 0x81, 0x02,
+    0x31, 0x1F, 0x13, 0x46, 0x61, 0x02, 0x62, 0x00, 0xAF, 0x00, 0xF2, 0x1E,
+    0xF0, 0x65, 0x80, 0xD4, 0xA2, 0x0A, 0xD0, 0x17, 0x70, 0xFF, 0xD0, 0x17,
+    0x71, 0x07, 0x72, 0x01, 0x32, 0x04, 0x13, 0x70, 0x7D, 0xFF, 0x13, 0x46,
+    0x66, 0x88, 0x48, 0x28, 0xC6, 0x4C, 0xAA, 0xAC, 0xAA, 0x4A, 0xE0, 0x88,
+    0xC0, 0x88, 0xE0, 0x00, 0x60, 0x1E, 0xF0, 0x18, 0x80, 0x0E, 0xF0, 0x15,
+    0xF0, 0x07, 0x30, 0x00, 0x13, 0xA4, 0x00, 0xE0, 0xAE, 0x00, 0xFE, 0x33,
+    0x6B, 0x0D, 0x6A, 0x0D, 0x6C, 0x05, 0xA3, 0x8C, 0xDA, 0xB5, 0x7A, 0x08,
+    0xFC, 0x1E, 0xDA, 0xB5, 0x7A, 0x08, 0xFC, 0x1E, 0xDA, 0xB5, 0xAE, 0x00,
+    0xF2, 0x65, 0xF0, 0x29, 0x7A, 0x08, 0xDA, 0xB5, 0xF1, 0x29, 0x7A, 0x05,
+    0xDA, 0xB5, 0xF2, 0x29, 0x7A, 0x05, 0xDA, 0xB5, 0x6C, 0x14, 0xFC, 0x15,
+    0xFC, 0x07, 0x3C, 0x00, 0x13, 0xE0, 0x6C, 0x0B, 0xEC, 0x9E, 0x13, 0xB0,
+    0x12, 0x00,
+};
+const size_t aot_rom_size = 494;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x000000000000FF00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+        case 0x2FE: goto L2FE;
+        case 0x300: goto L300;
+        case 0x302: goto L302;
+        case 0x304: goto L304;
+        case 0x306: goto L306;
+        case 0x308: goto L308;
+        case 0x30A: goto L30A;
+        case 0x30C: goto L30C;
+        case 0x30E: goto L30E;
+        case 0x310: goto L310;
+        case 0x312: goto L312;
+        case 0x314: goto L314;
+        case 0x316: goto L316;
+        case 0x318: goto L318;
+        case 0x31A: goto L31A;
+        case 0x31C: goto L31C;
+        case 0x31E: goto L31E;
+        case 0x320: goto L320;
+        case 0x322: goto L322;
+        case 0x324: goto L324;
+        case 0x326: goto L326;
+        case 0x328: goto L328;
+        case 0x32A: goto L32A;
+        case 0x32C: goto L32C;
+        case 0x32E: goto L32E;
+        case 0x330: goto L330;
+        case 0x332: goto L332;
+        case 0x334: goto L334;
+        case 0x336: goto L336;
+        case 0x338: goto L338;
+        case 0x33A: goto L33A;
+        case 0x33C: goto L33C;
+        case 0x33E: goto L33E;
+        case 0x340: goto L340;
+        case 0x342: goto L342;
+        case 0x344: goto L344;
+        case 0x346: goto L346;
+        case 0x348: goto L348;
+        case 0x34A: goto L34A;
+        case 0x34C: goto L34C;
+        case 0x34E: goto L34E;
+        case 0x350: goto L350;
+        case 0x352: goto L352;
+        case 0x354: goto L354;
+        case 0x356: goto L356;
+        case 0x358: goto L358;
+        case 0x35A: goto L35A;
+        case 0x35C: goto L35C;
+        case 0x35E: goto L35E;
+        case 0x360: goto L360;
+        case 0x362: goto L362;
+        case 0x364: goto L364;
+        case 0x366: goto L366;
+        case 0x368: goto L368;
+        case 0x36A: goto L36A;
+        case 0x36C: goto L36C;
+        case 0x36E: goto L36E;
+        case 0x370: goto L370;
+        case 0x372: goto L372;
+        case 0x374: goto L374;
+        case 0x376: goto L376;
+        case 0x378: goto L378;
+        case 0x37A: goto L37A;
+        case 0x37C: goto L37C;
+        case 0x37E: goto L37E;
+        case 0x380: goto L380;
+        case 0x382: goto L382;
+        case 0x384: goto L384;
+        case 0x386: goto L386;
+        case 0x388: goto L388;
+        case 0x38A: goto L38A;
+        case 0x39C: goto L39C;
+        case 0x39E: goto L39E;
+        case 0x3A0: goto L3A0;
+        case 0x3A2: goto L3A2;
+        case 0x3A4: goto L3A4;
+        case 0x3A6: goto L3A6;
+        case 0x3A8: goto L3A8;
+        case 0x3AA: goto L3AA;
+        case 0x3AC: goto L3AC;
+        case 0x3AE: goto L3AE;
+        case 0x3B0: goto L3B0;
+        case 0x3B2: goto L3B2;
+        case 0x3B4: goto L3B4;
+        case 0x3B6: goto L3B6;
+        case 0x3B8: goto L3B8;
+        case 0x3BA: goto L3BA;
+        case 0x3BC: goto L3BC;
+        case 0x3BE: goto L3BE;
+        case 0x3C0: goto L3C0;
+        case 0x3C2: goto L3C2;
+        case 0x3C4: goto L3C4;
+        case 0x3C6: goto L3C6;
+        case 0x3C8: goto L3C8;
+        case 0x3CA: goto L3CA;
+        case 0x3CC: goto L3CC;
+        case 0x3CE: goto L3CE;
+        case 0x3D0: goto L3D0;
+        case 0x3D2: goto L3D2;
+        case 0x3D4: goto L3D4;
+        case 0x3D6: goto L3D6;
+        case 0x3D8: goto L3D8;
+        case 0x3DA: goto L3DA;
+        case 0x3DC: goto L3DC;
+        case 0x3DE: goto L3DE;
+        case 0x3E0: goto L3E0;
+        case 0x3E2: goto L3E2;
+        case 0x3E4: goto L3E4;
+        case 0x3E6: goto L3E6;
+        case 0x3E8: goto L3E8;
+        case 0x3EA: goto L3EA;
+        case 0x3EC: goto L3EC;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 1212 JP 0x212
+    STEP(0x200, 0x1212);
+    goto L212;
+L212: // 00E0 CLS
+    STEP(0x212, 0x00E0);
+    c->pc = 0x212;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x214) goto dispatch;
+L214: // 6001 LD V0, 0x01
+    STEP(0x214, 0x6001);
+    V[0] = 0x01;
+L216: // 6101 LD V1, 0x01
+    STEP(0x216, 0x6101);
+    V[1] = 0x01;
+L218: // 623E LD V2, 0x3E
+    STEP(0x218, 0x623E);
+    V[2] = 0x3E;
+L21A: // A208 LD I, 0x208
+    STEP(0x21A, 0xA208);
+    c->I = 0x208;
+L21C: // D011 DRW V0, V1, 1
+    STEP(0x21C, 0xD011);
+    c->pc = 0x21C;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x21E) goto dispatch;
+L21E: // D021 DRW V0, V2, 1
+    STEP(0x21E, 0xD021);
+    c->pc = 0x21E;
+    predecode(0xD021, &in);
+    execute(c, &in);
+    if (c->pc != 0x220) goto dispatch;
+L220: // 7008 ADD V0, 0x08
+    STEP(0x220, 0x7008);
+    V[0] += 0x08;
+L222: // 3041 SE V0, 0x41
+    STEP(0x222, 0x3041);
+    if (V[0] == 0x41) goto L226;
+L224: // 121C JP 0x21C
+    STEP(0x224, 0x121C);
+    goto L21C;
+L226: // A20A LD I, 0x20A
+    STEP(0x226, 0xA20A);
+    c->I = 0x20A;
+L228: // 6002 LD V0, 0x02
+    STEP(0x228, 0x6002);
+    V[0] = 0x02;
+L22A: // 6101 LD V1, 0x01
+    STEP(0x22A, 0x6101);
+    V[1] = 0x01;
+L22C: // 623F LD V2, 0x3F
+    STEP(0x22C, 0x623F);
+    V[2] = 0x3F;
+L22E: // D107 DRW V1, V0, 7
+    STEP(0x22E, 0xD107);
+    c->pc = 0x22E;
+    predecode(0xD107, &in);
+    execute(c, &in);
+    if (c->pc != 0x230) goto dispatch;
+L230: // D207 DRW V2, V0, 7
+    STEP(0x230, 0xD207);
+    c->pc = 0x230;
+    predecode(0xD207, &in);
+    execute(c, &in);
+    if (c->pc != 0x232) goto dispatch;
+L232: // 7007 ADD V0, 0x07
+    STEP(0x232, 0x7007);
+    V[0] += 0x07;
+L234: // 301E SE V0, 0x1E
+    STEP(0x234, 0x301E);
+    if (V[0] == 0x1E) goto L238;
+L236: // 122E JP 0x22E
+    STEP(0x236, 0x122E);
+    goto L22E;
+L238: // 1274 JP 0x274
+    STEP(0x238, 0x1274);
+    goto L274;
+L25E: // A23A LD I, 0x23A
+    STEP(0x25E, 0xA23A);
+    c->I = 0x23A;
+L260: // 620C LD V2, 0x0C
+    STEP(0x260, 0x620C);
+    V[2] = 0x0C;
+L262: // D01B DRW V0, V1, 11
+    STEP(0x262, 0xD01B);
+    c->pc = 0x262;
+    predecode(0xD01B, &in);
+    execute(c, &in);
+    if (c->pc != 0x264) goto dispatch;
+L264: // 7008 ADD V0, 0x08
+    STEP(0x264, 0x7008);
+    V[0] += 0x08;
+L266: // F21E ADD I, V2
+    STEP(0x266, 0xF21E);
+    c->I += V[2];
+L268: // D01B DRW V0, V1, 11
+    STEP(0x268, 0xD01B);
+    c->pc = 0x268;
+    predecode(0xD01B, &in);
+    execute(c, &in);
+    if (c->pc != 0x26A) goto dispatch;
+L26A: // 7008 ADD V0, 0x08
+    STEP(0x26A, 0x7008);
+    V[0] += 0x08;
+L26C: // F21E ADD I, V2
+    STEP(0x26C, 0xF21E);
+    c->I += V[2];
+L26E: // D01B DRW V0, V1, 11
+    STEP(0x26E, 0xD01B);
+    c->pc = 0x26E;
+    predecode(0xD01B, &in);
+    execute(c, &in);
+    if (c->pc != 0x270) goto dispatch;
+L270: // 70F0 ADD V0, 0xF0
+    STEP(0x270, 0x70F0);
+    V[0] += 0xF0;
+L272: // 00EE RET
+    STEP(0x272, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L274: // C01F RND V0, 0x1F
+    STEP(0x274, 0xC01F);
+    c->pc = 0x274;
+    predecode(0xC01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x276) goto dispatch;
+L276: // C10F RND V1, 0x0F
+    STEP(0x276, 0xC10F);
+    c->pc = 0x276;
+    predecode(0xC10F, &in);
+    execute(c, &in);
+    if (c->pc != 0x278) goto dispatch;
+L278: // 7006 ADD V0, 0x06
+    STEP(0x278, 0x7006);
+    V[0] += 0x06;
+L27A: // 7103 ADD V1, 0x03
+    STEP(0x27A, 0x7103);
+    V[1] += 0x03;
+L27C: // 225E CALL 0x25E
+    STEP(0x27C, 0x225E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x27C;
+    goto L25E;
+L27E: // 621E LD V2, 0x1E
+    STEP(0x27E, 0x621E);
+    V[2] = 0x1E;
+L280: // F215 LD DT, V2
+    STEP(0x280, 0xF215);
+    c->dt = V[2];
+L282: // F207 LD V2, DT
+    STEP(0x282, 0xF207);
+    V[2] = c->dt;
+L284: // 3200 SE V2, 0x00
+    STEP(0x284, 0x3200);
+    if (V[2] == 0x00) goto L288;
+L286: // 128C JP 0x28C
+    STEP(0x286, 0x128C);
+    goto L28C;
+L288: // 225E CALL 0x25E
+    STEP(0x288, 0x225E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x288;
+    goto L25E;
+L28A: // 1274 JP 0x274
+    STEP(0x28A, 0x1274);
+    goto L274;
+L28C: // 620B LD V2, 0x0B
+    STEP(0x28C, 0x620B);
+    V[2] = 0x0B;
+L28E: // E29E SKP V2
+    STEP(0x28E, 0xE29E);
+    c->pc = 0x28E;
+    predecode(0xE29E, &in);
+    execute(c, &in);
+    if (c->pc != 0x290) goto dispatch;
+L290: // 1282 JP 0x282
+    STEP(0x290, 0x1282);
+    goto L282;
+L292: // 225E CALL 0x25E
+    STEP(0x292, 0x225E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x292;
+    goto L25E;
+L294: // 12D4 JP 0x2D4
+    STEP(0x294, 0x12D4);
+    goto L2D4;
+L29E: // A296 LD I, 0x296
+    STEP(0x29E, 0xA296);
+    c->I = 0x296;
+L2A0: // D016 DRW V0, V1, 6
+    STEP(0x2A0, 0xD016);
+    c->pc = 0x2A0;
+    predecode(0xD016, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A2) goto dispatch;
+L2A2: // 00EE RET
+    STEP(0x2A2, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2A4: // AFA0 LD I, 0xFA0
+    STEP(0x2A4, 0xAFA0);
+    c->I = 0xFA0;
+L2A6: // F255 LD [I], V2
+    STEP(0x2A6, 0xF255);
+    c->pc = 0x2A6;
+    predecode(0xF255, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2A8) goto dispatch;
+L2A8: // A29C LD I, 0x29C
+    STEP(0x2A8, 0xA29C);
+    c->I = 0x29C;
+L2AA: // F165 LD V1, [I]
+    STEP(0x2AA, 0xF165);
+    for (int i = 0; i <= 1; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2AC: // 6206 LD V2, 0x06
+    STEP(0x2AC, 0x6206);
+    V[2] = 0x06;
+L2AE: // E29E SKP V2
+    STEP(0x2AE, 0xE29E);
+    c->pc = 0x2AE;
+    predecode(0xE29E, &in);
+    execute(c, &in);
+    if (c->pc != 0x2B0) goto dispatch;
+L2B0: // 12B8 JP 0x2B8
+    STEP(0x2B0, 0x12B8);
+    goto L2B8;
+L2B2: // 229E CALL 0x29E
+    STEP(0x2B2, 0x229E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2B2;
+    goto L29E;
+L2B4: // 7001 ADD V0, 0x01
+    STEP(0x2B4, 0x7001);
+    V[0] += 0x01;
+L2B6: // 229E CALL 0x29E
+    STEP(0x2B6, 0x229E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2B6;
+    goto L29E;
+L2B8: // 6204 LD V2, 0x04
+    STEP(0x2B8, 0x6204);
+    V[2] = 0x04;
+L2BA: // E29E SKP V2
+    STEP(0x2BA, 0xE29E);
+    c->pc = 0x2BA;
+    predecode(0xE29E, &in);
+    execute(c, &in);
+    if (c->pc != 0x2BC) goto dispatch;
+L2BC: // 12C4 JP 0x2C4
+    STEP(0x2BC, 0x12C4);
+    goto L2C4;
+L2BE: // 229E CALL 0x29E
+    STEP(0x2BE, 0x229E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2BE;
+    goto L29E;
+L2C0: // 70FF ADD V0, 0xFF
+    STEP(0x2C0, 0x70FF);
+    V[0] += 0xFF;
+L2C2: // 229E CALL 0x29E
+    STEP(0x2C2, 0x229E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2C2;
+    goto L29E;
+L2C4: // 3F00 SE VF, 0x00
+    STEP(0x2C4, 0x3F00);
+    if (V[15] == 0x00) goto L2C8;
+L2C6: // 139C JP 0x39C
+    STEP(0x2C6, 0x139C);
+    goto L39C;
+L2C8: // A29C LD I, 0x29C
+    STEP(0x2C8, 0xA29C);
+    c->I = 0x29C;
+L2CA: // F155 LD [I], V1
+    STEP(0x2CA, 0xF155);
+    c->pc = 0x2CA;
+    predecode(0xF155, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2CC) goto dispatch;
+L2CC: // AFA0 LD I, 0xFA0
+    STEP(0x2CC, 0xAFA0);
+    c->I = 0xFA0;
+L2CE: // F265 LD V2, [I]
+    STEP(0x2CE, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2D0: // 00EE RET
+    STEP(0x2D0, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2D4: // AF00 LD I, 0xF00
+    STEP(0x2D4, 0xAF00);
+    c->I = 0xF00;
+L2D6: // 601D LD V0, 0x1D
+    STEP(0x2D6, 0x601D);
+    V[0] = 0x1D;
+L2D8: // 8100 LD V1, V0
+    STEP(0x2D8, 0x8100);
+    V[1] = V[0];
+L2DA: // 8200 LD V2, V0
+    STEP(0x2DA, 0x8200);
+    V[2] = V[0];
+L2DC: // 8300 LD V3, V0
+    STEP(0x2DC, 0x8300);
+    V[3] = V[0];
+L2DE: // 8400 LD V4, V0
+    STEP(0x2DE, 0x8400);
+    V[4] = V[0];
+L2E0: // F455 LD [I], V4
+    STEP(0x2E0, 0xF455);
+    c->pc = 0x2E0;
+    predecode(0xF455, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2E2) goto dispatch;
+L2E2: // A29C LD I, 0x29C
+    STEP(0x2E2, 0xA29C);
+    c->I = 0x29C;
+L2E4: // 6020 LD V0, 0x20
+    STEP(0x2E4, 0x6020);
+    V[0] = 0x20;
+L2E6: // 6103 LD V1, 0x03
+    STEP(0x2E6, 0x6103);
+    V[1] = 0x03;
+L2E8: // F155 LD [I], V1
+    STEP(0x2E8, 0xF155);
+    c->pc = 0x2E8;
+    predecode(0xF155, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2EA) goto dispatch;
+L2EA: // 6D0D LD VD, 0x0D
+    STEP(0x2EA, 0x6D0D);
+    V[13] = 0x0D;
+L2EC: // 6E00 LD VE, 0x00
+    STEP(0x2EC, 0x6E00);
+    V[14] = 0x00;
+L2EE: // 1324 JP 0x324
+    STEP(0x2EE, 0x1324);
+    goto L324;
+L2F0: // 6202 LD V2, 0x02
+    STEP(0x2F0, 0x6202);
+    V[2] = 0x02;
+L2F2: // 6300 LD V3, 0x00
+    STEP(0x2F2, 0x6300);
+    V[3] = 0x00;
+L2F4: // AF00 LD I, 0xF00
+    STEP(0x2F4, 0xAF00);
+    c->I = 0xF00;
+L2F6: // F31E ADD I, V3
+    STEP(0x2F6, 0xF31E);
+    c->I += V[3];
+L2F8: // F165 LD V1, [I]
+    STEP(0x2F8, 0xF165);
+    for (int i = 0; i <= 1; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2FA: // A20A LD I, 0x20A
+    STEP(0x2FA, 0xA20A);
+    c->I = 0x20A;
+L2FC: // D027 DRW V0, V2, 7
+    STEP(0x2FC, 0xD027);
+    c->pc = 0x2FC;
+    predecode(0xD027, &in);
+    execute(c, &in);
+    if (c->pc != 0x2FE) goto dispatch;
+L2FE: // D127 DRW V1, V2, 7
+    STEP(0x2FE, 0xD127);
+    c->pc = 0x2FE;
+    predecode(0xD127, &in);
+    execute(c, &in);
+    if (c->pc != 0x300) goto dispatch;
+L300: // 3F00 SE VF, 0x00
+    STEP(0x300, 0x3F00);
+    if (V[15] == 0x00) goto L304;
+L302: // 139C JP 0x39C
+    STEP(0x302, 0x139C);
+    goto L39C;
+L304: // 80D4 ADD V0, VD
+    STEP(0x304, 0x80D4);
+    V[15] = V[0] + V[13] > 0xFF;
+    V[0] += V[13];
+L306: // D027 DRW V0, V2, 7
+    STEP(0x306, 0xD027);
+    c->pc = 0x306;
+    predecode(0xD027, &in);
+    execute(c, &in);
+    if (c->pc != 0x308) goto dispatch;
+L308: // 8010 LD V0, V1
+    STEP(0x308, 0x8010);
+    V[0] = V[1];
+L30A: // 81D4 ADD V1, VD
+    STEP(0x30A, 0x81D4);
+    V[15] = V[1] + V[13] > 0xFF;
+    V[1] += V[13];
+L30C: // D127 DRW V1, V2, 7
+    STEP(0x30C, 0xD127);
+    c->pc = 0x30C;
+    predecode(0xD127, &in);
+    execute(c, &in);
+    if (c->pc != 0x30E) goto dispatch;
+L30E: // 3F00 SE VF, 0x00
+    STEP(0x30E, 0x3F00);
+    if (V[15] == 0x00) goto L312;
+L310: // 139C JP 0x39C
+    STEP(0x310, 0x139C);
+    goto L39C;
+L312: // AF00 LD I, 0xF00
+    STEP(0x312, 0xAF00);
+    c->I = 0xF00;
+L314: // F31E ADD I, V3
+    STEP(0x314, 0xF31E);
+    c->I += V[3];
+L316: // F055 LD [I], V0
+    STEP(0x316, 0xF055);
+    c->pc = 0x316;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x318) goto dispatch;
+L318: // 22A4 CALL 0x2A4
+    STEP(0x318, 0x22A4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x318;
+    goto L2A4;
+L31A: // 7207 ADD V2, 0x07
+    STEP(0x31A, 0x7207);
+    V[2] += 0x07;
+L31C: // 7301 ADD V3, 0x01
+    STEP(0x31C, 0x7301);
+    V[3] += 0x01;
+L31E: // 3304 SE V3, 0x04
+    STEP(0x31E, 0x3304);
+    if (V[3] == 0x04) goto L322;
+L320: // 12F4 JP 0x2F4
+    STEP(0x320, 0x12F4);
+    goto L2F4;
+L322: // 00EE RET
+    STEP(0x322, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L324: // 6102 LD V1, 0x02
+    STEP(0x324, 0x6102);
+    V[1] = 0x02;
+L326: // 6200 LD V2, 0x00
+    STEP(0x326, 0x6200);
+    V[2] = 0x00;
+L328: // AF00 LD I, 0xF00
+    STEP(0x328, 0xAF00);
+    c->I = 0xF00;
+L32A: // F21E ADD I, V2
+    STEP(0x32A, 0xF21E);
+    c->I += V[2];
+L32C: // F065 LD V0, [I]
+    STEP(0x32C, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L32E: // A20A LD I, 0x20A
+    STEP(0x32E, 0xA20A);
+    c->I = 0x20A;
+L330: // D017 DRW V0, V1, 7
+    STEP(0x330, 0xD017);
+    c->pc = 0x330;
+    predecode(0xD017, &in);
+    execute(c, &in);
+    if (c->pc != 0x332) goto dispatch;
+L332: // 80D4 ADD V0, VD
+    STEP(0x332, 0x80D4);
+    V[15] = V[0] + V[13] > 0xFF;
+    V[0] += V[13];
+L334: // D017 DRW V0, V1, 7
+    STEP(0x334, 0xD017);
+    c->pc = 0x334;
+    predecode(0xD017, &in);
+    execute(c, &in);
+    if (c->pc != 0x336) goto dispatch;
+L336: // 7107 ADD V1, 0x07
+    STEP(0x336, 0x7107);
+    V[1] += 0x07;
+L338: // 7201 ADD V2, 0x01
+    STEP(0x338, 0x7201);
+    V[2] += 0x01;
+L33A: // 3204 SE V2, 0x04
+    STEP(0x33A, 0x3204);
+    if (V[2] == 0x04) goto L33E;
+L33C: // 1328 JP 0x328
+    STEP(0x33C, 0x1328);
+    goto L328;
+L33E: // A29C LD I, 0x29C
+    STEP(0x33E, 0xA29C);
+    c->I = 0x29C;
+L340: // F165 LD V1, [I]
+    STEP(0x340, 0xF165);
+    for (int i = 0; i <= 1; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L342: // A296 LD I, 0x296
+    STEP(0x342, 0xA296);
+    c->I = 0x296;
+L344: // D016 DRW V0, V1, 6
+    STEP(0x344, 0xD016);
+    c->pc = 0x344;
+    predecode(0xD016, &in);
+    execute(c, &in);
+    if (c->pc != 0x346) goto dispatch;
+L346: // 22F0 CALL 0x2F0
+    STEP(0x346, 0x22F0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x346;
+    goto L2F0;
+L348: // AF00 LD I, 0xF00
+    STEP(0x348, 0xAF00);
+    c->I = 0xF00;
+L34A: // 6004 LD V0, 0x04
+    STEP(0x34A, 0x6004);
+    V[0] = 0x04;
+L34C: // F01E ADD I, V0
+    STEP(0x34C, 0xF01E);
+    c->I += V[0];
+L34E: // F065 LD V0, [I]
+    STEP(0x34E, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L350: // C102 RND V1, 0x02
+    STEP(0x350, 0xC102);
+    c->pc = 0x350;
+    predecode(0xC102, &in);
+    execute(c, &in);
+    if (c->pc != 0x352) goto dispatch;
+L352: // 71FF ADD V1, 0xFF
+    STEP(0x352, 0x71FF);
+    V[1] += 0xFF;
+L354: // 8014 ADD V0, V1
+    STEP(0x354, 0x8014);
+    V[15] = V[0] + V[1] > 0xFF;
+    V[0] += V[1];
+L356: // 4002 SNE V0, 0x02
+    STEP(0x356, 0x4002);
+    if (V[0] != 0x02) goto L35A;
+L358: // 6003 LD V0, 0x03
+    STEP(0x358, 0x6003);
+    V[0] = 0x03;
+L35A: // 402E SNE V0, 0x2E
+    STEP(0x35A, 0x402E);
+    if (V[0] != 0x2E) goto L35E;
+L35C: // 602D LD V0, 0x2D
+    STEP(0x35C, 0x602D);
+    V[0] = 0x2D;
+L35E: // F055 LD [I], V0
+    STEP(0x35E, 0xF055);
+    c->pc = 0x35E;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x360) goto dispatch;
+L360: // 7E01 ADD VE, 0x01
+    STEP(0x360, 0x7E01);
+    V[14] += 0x01;
+L362: // 601F LD V0, 0x1F
+    STEP(0x362, 0x601F);
+    V[0] = 0x1F;
+L364: // 81E0 LD V1, VE
+    STEP(0x364, 0x81E0);
+    V[1] = V[14];
+L366: // 8102 AND V1, V0
+    STEP(0x366, 0x8102);
+    V[1] &= V[0];
+L368: // 311F SE V1, 0x1F
+    STEP(0x368, 0x311F);
+    if (V[1] == 0x1F) goto L36C;
+L36A: // 1346 JP 0x346
+    STEP(0x36A, 0x1346);
+    goto L346;
+L36C: // 6102 LD V1, 0x02
+    STEP(0x36C, 0x6102);
+    V[1] = 0x02;
+L36E: // 6200 LD V2, 0x00
+    STEP(0x36E, 0x6200);
+    V[2] = 0x00;
+L370: // AF00 LD I, 0xF00
+    STEP(0x370, 0xAF00);
+    c->I = 0xF00;
+L372: // F21E ADD I, V2
+    STEP(0x372, 0xF21E);
+    c->I += V[2];
+L374: // F065 LD V0, [I]
+    STEP(0x374, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L376: // 80D4 ADD V0, VD
+    STEP(0x376, 0x80D4);
+    V[15] = V[0] + V[13] > 0xFF;
+    V[0] += V[13];
+L378: // A20A LD I, 0x20A
+    STEP(0x378, 0xA20A);
+    c->I = 0x20A;
+L37A: // D017 DRW V0, V1, 7
+    STEP(0x37A, 0xD017);
+    c->pc = 0x37A;
+    predecode(0xD017, &in);
+    execute(c, &in);
+    if (c->pc != 0x37C) goto dispatch;
+L37C: // 70FF ADD V0, 0xFF
+    STEP(0x37C, 0x70FF);
+    V[0] += 0xFF;
+L37E: // D017 DRW V0, V1, 7
+    STEP(0x37E, 0xD017);
+    c->pc = 0x37E;
+    predecode(0xD017, &in);
+    execute(c, &in);
+    if (c->pc != 0x380) goto dispatch;
+L380: // 7107 ADD V1, 0x07
+    STEP(0x380, 0x7107);
+    V[1] += 0x07;
+L382: // 7201 ADD V2, 0x01
+    STEP(0x382, 0x7201);
+    V[2] += 0x01;
+L384: // 3204 SE V2, 0x04
+    STEP(0x384, 0x3204);
+    if (V[2] == 0x04) goto L388;
+L386: // 1370 JP 0x370
+    STEP(0x386, 0x1370);
+    goto L370;
+L388: // 7DFF ADD VD, 0xFF
+    STEP(0x388, 0x7DFF);
+    V[13] += 0xFF;
+L38A: // 1346 JP 0x346
+    STEP(0x38A, 0x1346);
+    goto L346;
+L39C: // 601E LD V0, 0x1E
+    STEP(0x39C, 0x601E);
+    V[0] = 0x1E;
+L39E: // F018 LD ST, V0
+    STEP(0x39E, 0xF018);
+    c->st = V[0];
+L3A0: // 800E SHL V0, V0
+    STEP(0x3A0, 0x800E);
+    V[15] = V[0] >> 7;
+    V[0] <<= 1;
+L3A2: // F015 LD DT, V0
+    STEP(0x3A2, 0xF015);
+    c->dt = V[0];
+L3A4: // F007 LD V0, DT
+    STEP(0x3A4, 0xF007);
+    V[0] = c->dt;
+L3A6: // 3000 SE V0, 0x00
+    STEP(0x3A6, 0x3000);
+    if (V[0] == 0x00) goto L3AA;
+L3A8: // 13A4 JP 0x3A4
+    STEP(0x3A8, 0x13A4);
+    goto L3A4;
+L3AA: // 00E0 CLS
+    STEP(0x3AA, 0x00E0);
+    c->pc = 0x3AA;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x3AC) goto dispatch;
+L3AC: // AE00 LD I, 0xE00
+    STEP(0x3AC, 0xAE00);
+    c->I = 0xE00;
+L3AE: // FE33 LD B, VE
+    STEP(0x3AE, 0xFE33);
+    c->pc = 0x3AE;
+    predecode(0xFE33, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x3B0) goto dispatch;
+L3B0: // 6B0D LD VB, 0x0D
+    STEP(0x3B0, 0x6B0D);
+    V[11] = 0x0D;
+L3B2: // 6A0D LD VA, 0x0D
+    STEP(0x3B2, 0x6A0D);
+    V[10] = 0x0D;
+L3B4: // 6C05 LD VC, 0x05
+    STEP(0x3B4, 0x6C05);
+    V[12] = 0x05;
+L3B6: // A38C LD I, 0x38C
+    STEP(0x3B6, 0xA38C);
+    c->I = 0x38C;
+L3B8: // DAB5 DRW VA, VB, 5
+    STEP(0x3B8, 0xDAB5);
+    c->pc = 0x3B8;
+    predecode(0xDAB5, &in);
+    execute(c, &in);
+    if (c->pc != 0x3BA) goto dispatch;
+L3BA: // 7A08 ADD VA, 0x08
+    STEP(0x3BA, 0x7A08);
+    V[10] += 0x08;
+L3BC: // FC1E ADD I, VC
+    STEP(0x3BC, 0xFC1E);
+    c->I += V[12];
+L3BE: // DAB5 DRW VA, VB, 5
+    STEP(0x3BE, 0xDAB5);
+    c->pc = 0x3BE;
+    predecode(0xDAB5, &in);
+    execute(c, &in);
+    if (c->pc != 0x3C0) goto dispatch;
+L3C0: // 7A08 ADD VA, 0x08
+    STEP(0x3C0, 0x7A08);
+    V[10] += 0x08;
+L3C2: // FC1E ADD I, VC
+    STEP(0x3C2, 0xFC1E);
+    c->I += V[12];
+L3C4: // DAB5 DRW VA, VB, 5
+    STEP(0x3C4, 0xDAB5);
+    c->pc = 0x3C4;
+    predecode(0xDAB5, &in);
+    execute(c, &in);
+    if (c->pc != 0x3C6) goto dispatch;
+L3C6: // AE00 LD I, 0xE00
+    STEP(0x3C6, 0xAE00);
+    c->I = 0xE00;
+L3C8: // F265 LD V2, [I]
+    STEP(0x3C8, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L3CA: // F029 LD F, V0
+    STEP(0x3CA, 0xF029);
+    c->I = V[0] * 5;
+L3CC: // 7A08 ADD VA, 0x08
+    STEP(0x3CC, 0x7A08);
+    V[10] += 0x08;
+L3CE: // DAB5 DRW VA, VB, 5
+    STEP(0x3CE, 0xDAB5);
+    c->pc = 0x3CE;
+    predecode(0xDAB5, &in);
+    execute(c, &in);
+    if (c->pc != 0x3D0) goto dispatch;
+L3D0: // F129 LD F, V1
+    STEP(0x3D0, 0xF129);
+    c->I = V[1] * 5;
+L3D2: // 7A05 ADD VA, 0x05
+    STEP(0x3D2, 0x7A05);
+    V[10] += 0x05;
+L3D4: // DAB5 DRW VA, VB, 5
+    STEP(0x3D4, 0xDAB5);
+    c->pc = 0x3D4;
+    predecode(0xDAB5, &in);
+    execute(c, &in);
+    if (c->pc != 0x3D6) goto dispatch;
+L3D6: // F229 LD F, V2
+    STEP(0x3D6, 0xF229);
+    c->I = V[2] * 5;
+L3D8: // 7A05 ADD VA, 0x05
+    STEP(0x3D8, 0x7A05);
+    V[10] += 0x05;
+L3DA: // DAB5 DRW VA, VB, 5
+    STEP(0x3DA, 0xDAB5);
+    c->pc = 0x3DA;
+    predecode(0xDAB5, &in);
+    execute(c, &in);
+    if (c->pc != 0x3DC) goto dispatch;
+L3DC: // 6C14 LD VC, 0x14
+    STEP(0x3DC, 0x6C14);
+    V[12] = 0x14;
+L3DE: // FC15 LD DT, VC
+    STEP(0x3DE, 0xFC15);
+    c->dt = V[12];
+L3E0: // FC07 LD VC, DT
+    STEP(0x3E0, 0xFC07);
+    V[12] = c->dt;
+L3E2: // 3C00 SE VC, 0x00
+    STEP(0x3E2, 0x3C00);
+    if (V[12] == 0x00) goto L3E6;
+L3E4: // 13E0 JP 0x3E0
+    STEP(0x3E4, 0x13E0);
+    goto L3E0;
+L3E6: // 6C0B LD VC, 0x0B
+    STEP(0x3E6, 0x6C0B);
+    V[12] = 0x0B;
+L3E8: // EC9E SKP VC
+    STEP(0x3E8, 0xEC9E);
+    c->pc = 0x3E8;
+    predecode(0xEC9E, &in);
+    execute(c, &in);
+    if (c->pc != 0x3EA) goto dispatch;
+L3EA: // 13B0 JP 0x3B0
+    STEP(0x3EA, 0x13B0);
+    goto L3B0;
+L3EC: // 1200 JP 0x200
+    STEP(0x3EC, 0x1200);
+    goto L200;
+}
@@ -0,0 +1,285 @@
+// generated by chip8-aot from roms/TEST/Rocket2.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x00, 0xE0, 0xA2, 0x60, 0x60, 0x07, 0x61, 0x38, 0x62, 0x19, 0xD0, 0x27,
+    0xD1, 0x27, 0xA2, 0x5E, 0x60, 0x00, 0x61, 0x18, 0xD0, 0x11, 0x70, 0x08,
+    0x30, 0x40, 0x12, 0x14, 0x68, 0x1E, 0x69, 0x11, 0x22, 0x58, 0x60, 0x0F,
+    0xE0, 0x9E, 0x12, 0x24, 0x60, 0x08, 0xF0, 0x18, 0x22, 0x58, 0x79, 0xFF,
+    0x22, 0x58, 0x60, 0x02, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x36,
+    0x60, 0x01, 0xF0, 0x18, 0x39, 0x00, 0x12, 0x2C, 0x00, 0xE0, 0x64, 0x0C,
+    0xC5, 0x20, 0xC6, 0x40, 0xD6, 0x51, 0x74, 0xFF, 0x34, 0x00, 0x12, 0x48,
+    0x69, 0x1A, 0x12, 0x2E, 0xA2, 0x68, 0xD8, 0x97, 0x00, 0xEE, 0xFF, 0x00,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x20, 0x70, 0x70, 0x70,
+    0x70, 0xF8, 0x50, 0x00,
+};
+const size_t aot_rom_size = 112;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000300ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 00E0 CLS
+    STEP(0x200, 0x00E0);
+    c->pc = 0x200;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x202) goto dispatch;
+L202: // A260 LD I, 0x260
+    STEP(0x202, 0xA260);
+    c->I = 0x260;
+L204: // 6007 LD V0, 0x07
+    STEP(0x204, 0x6007);
+    V[0] = 0x07;
+L206: // 6138 LD V1, 0x38
+    STEP(0x206, 0x6138);
+    V[1] = 0x38;
+L208: // 6219 LD V2, 0x19
+    STEP(0x208, 0x6219);
+    V[2] = 0x19;
+L20A: // D027 DRW V0, V2, 7
+    STEP(0x20A, 0xD027);
+    c->pc = 0x20A;
+    predecode(0xD027, &in);
+    execute(c, &in);
+    if (c->pc != 0x20C) goto dispatch;
+L20C: // D127 DRW V1, V2, 7
+    STEP(0x20C, 0xD127);
+    c->pc = 0x20C;
+    predecode(0xD127, &in);
+    execute(c, &in);
+    if (c->pc != 0x20E) goto dispatch;
+L20E: // A25E LD I, 0x25E
+    STEP(0x20E, 0xA25E);
+    c->I = 0x25E;
+L210: // 6000 LD V0, 0x00
+    STEP(0x210, 0x6000);
+    V[0] = 0x00;
+L212: // 6118 LD V1, 0x18
+    STEP(0x212, 0x6118);
+    V[1] = 0x18;
+L214: // D011 DRW V0, V1, 1
+    STEP(0x214, 0xD011);
+    c->pc = 0x214;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x216) goto dispatch;
+L216: // 7008 ADD V0, 0x08
+    STEP(0x216, 0x7008);
+    V[0] += 0x08;
+L218: // 3040 SE V0, 0x40
+    STEP(0x218, 0x3040);
+    if (V[0] == 0x40) goto L21C;
+L21A: // 1214 JP 0x214
+    STEP(0x21A, 0x1214);
+    goto L214;
+L21C: // 681E LD V8, 0x1E
+    STEP(0x21C, 0x681E);
+    V[8] = 0x1E;
+L21E: // 6911 LD V9, 0x11
+    STEP(0x21E, 0x6911);
+    V[9] = 0x11;
+L220: // 2258 CALL 0x258
+    STEP(0x220, 0x2258);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x220;
+    goto L258;
+L222: // 600F LD V0, 0x0F
+    STEP(0x222, 0x600F);
+    V[0] = 0x0F;
+L224: // E09E SKP V0
+    STEP(0x224, 0xE09E);
+    c->pc = 0x224;
+    predecode(0xE09E, &in);
+    execute(c, &in);
+    if (c->pc != 0x226) goto dispatch;
+L226: // 1224 JP 0x224
+    STEP(0x226, 0x1224);
+    goto L224;
+L228: // 6008 LD V0, 0x08
+    STEP(0x228, 0x6008);
+    V[0] = 0x08;
+L22A: // F018 LD ST, V0
+    STEP(0x22A, 0xF018);
+    c->st = V[0];
+L22C: // 2258 CALL 0x258
+    STEP(0x22C, 0x2258);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x22C;
+    goto L258;
+L22E: // 79FF ADD V9, 0xFF
+    STEP(0x22E, 0x79FF);
+    V[9] += 0xFF;
+L230: // 2258 CALL 0x258
+    STEP(0x230, 0x2258);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x230;
+    goto L258;
+L232: // 6002 LD V0, 0x02
+    STEP(0x232, 0x6002);
+    V[0] = 0x02;
+L234: // F015 LD DT, V0
+    STEP(0x234, 0xF015);
+    c->dt = V[0];
+L236: // F007 LD V0, DT
+    STEP(0x236, 0xF007);
+    V[0] = c->dt;
+L238: // 3000 SE V0, 0x00
+    STEP(0x238, 0x3000);
+    if (V[0] == 0x00) goto L23C;
+L23A: // 1236 JP 0x236
+    STEP(0x23A, 0x1236);
+    goto L236;
+L23C: // 6001 LD V0, 0x01
+    STEP(0x23C, 0x6001);
+    V[0] = 0x01;
+L23E: // F018 LD ST, V0
+    STEP(0x23E, 0xF018);
+    c->st = V[0];
+L240: // 3900 SE V9, 0x00
+    STEP(0x240, 0x3900);
+    if (V[9] == 0x00) goto L244;
+L242: // 122C JP 0x22C
+    STEP(0x242, 0x122C);
+    goto L22C;
+L244: // 00E0 CLS
+    STEP(0x244, 0x00E0);
+    c->pc = 0x244;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x246) goto dispatch;
+L246: // 640C LD V4, 0x0C
+    STEP(0x246, 0x640C);
+    V[4] = 0x0C;
+L248: // C520 RND V5, 0x20
+    STEP(0x248, 0xC520);
+    c->pc = 0x248;
+    predecode(0xC520, &in);
+    execute(c, &in);
+    if (c->pc != 0x24A) goto dispatch;
+L24A: // C640 RND V6, 0x40
+    STEP(0x24A, 0xC640);
+    c->pc = 0x24A;
+    predecode(0xC640, &in);
+    execute(c, &in);
+    if (c->pc != 0x24C) goto dispatch;
+L24C: // D651 DRW V6, V5, 1
+    STEP(0x24C, 0xD651);
+    c->pc = 0x24C;
+    predecode(0xD651, &in);
+    execute(c, &in);
+    if (c->pc != 0x24E) goto dispatch;
+L24E: // 74FF ADD V4, 0xFF
+    STEP(0x24E, 0x74FF);
+    V[4] += 0xFF;
+L250: // 3400 SE V4, 0x00
+    STEP(0x250, 0x3400);
+    if (V[4] == 0x00) goto L254;
+L252: // 1248 JP 0x248
+    STEP(0x252, 0x1248);
+    goto L248;
+L254: // 691A LD V9, 0x1A
+    STEP(0x254, 0x691A);
+    V[9] = 0x1A;
+L256: // 122E JP 0x22E
+    STEP(0x256, 0x122E);
+    goto L22E;
+L258: // A268 LD I, 0x268
+    STEP(0x258, 0xA268);
+    c->I = 0x268;
+L25A: // D897 DRW V8, V9, 7
+    STEP(0x25A, 0xD897);
+    c->pc = 0x25A;
+    predecode(0xD897, &in);
+    execute(c, &in);
+    if (c->pc != 0x25C) goto dispatch;
+L25C: // 00EE RET
+    STEP(0x25C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
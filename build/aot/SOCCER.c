@@ -0,0 +1,872 @@
+// generated by chip8-aot from roms/SOCCER.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x00, 0xE0, 0x6A, 0x0C, 0x6B, 0x0C, 0x68, 0x00, 0x69, 0x00, 0x66, 0x00,
+    0x67, 0x00, 0x65, 0x00, 0x64, 0x00, 0xA3, 0x48, 0x23, 0x22, 0x23, 0x34,
+    0x23, 0x3E, 0x60, 0x60, 0xF0, 0x15, 0xF0, 0x07, 0x40, 0x00, 0x12, 0x26,
+    0x12, 0x1E, 0x64, 0x02, 0x66, 0x02, 0x67, 0x10, 0x23, 0x08, 0x22, 0xD4,
+    0x23, 0x08, 0x23, 0x0C, 0x46, 0x40, 0x12, 0x5C, 0x46, 0xFE, 0x12, 0x80,
+    0x23, 0x08, 0x4F, 0x01, 0x22, 0xE4, 0x60, 0x01, 0xE0, 0xA1, 0x22, 0xA4,
+    0x60, 0x04, 0xE0, 0xA1, 0x22, 0xB0, 0x60, 0x0C, 0xE0, 0xA1, 0x22, 0xBC,
+    0x60, 0x0D, 0xE0, 0xA1, 0x22, 0xC8, 0x12, 0x30, 0x23, 0x22, 0x78, 0x01,
+    0x48, 0x0A, 0x68, 0x00, 0x23, 0x22, 0x60, 0x14, 0xF0, 0x18, 0x66, 0x02,
+    0x67, 0x10, 0x64, 0x02, 0x22, 0xD4, 0x23, 0x08, 0x60, 0x60, 0xF0, 0x15,
+    0xF0, 0x07, 0x40, 0x00, 0x12, 0x30, 0x12, 0x78, 0x23, 0x22, 0x79, 0x01,
+    0x49, 0x0A, 0x69, 0x00, 0x23, 0x22, 0x60, 0x14, 0xF0, 0x18, 0x66, 0x3A,
+    0x67, 0x10, 0x64, 0xFE, 0x22, 0xD4, 0x23, 0x08, 0x60, 0x60, 0xF0, 0x15,
+    0xF0, 0x07, 0x40, 0x00, 0x12, 0x30, 0x12, 0x9C, 0x4A, 0x00, 0x00, 0xEE,
+    0x23, 0x34, 0x7A, 0xFE, 0x23, 0x34, 0x00, 0xEE, 0x4A, 0x1A, 0x00, 0xEE,
+    0x23, 0x34, 0x7A, 0x02, 0x23, 0x34, 0x00, 0xEE, 0x4B, 0x00, 0x00, 0xEE,
+    0x23, 0x3E, 0x7B, 0xFE, 0x23, 0x3E, 0x00, 0xEE, 0x4B, 0x1A, 0x00, 0xEE,
+    0x23, 0x3E, 0x7B, 0x02, 0x23, 0x3E, 0x00, 0xEE, 0xC0, 0x03, 0x40, 0x00,
+    0x65, 0xFF, 0x40, 0x01, 0x65, 0x00, 0x40, 0x02, 0x65, 0x01, 0x00, 0xEE,
+    0x46, 0x00, 0x12, 0xF6, 0x46, 0x14, 0x12, 0xF6, 0x46, 0x28, 0x12, 0xF6,
+    0x46, 0x3C, 0x12, 0xF6, 0x00, 0xEE, 0x22, 0xD4, 0x60, 0x04, 0xF0, 0x18,
+    0x44, 0xFE, 0x13, 0x04, 0x64, 0xFE, 0x00, 0xEE, 0x64, 0x02, 0x00, 0xEE,
+    0xD6, 0x71, 0x00, 0xEE, 0x86, 0x44, 0x87, 0x54, 0x47, 0x00, 0x13, 0x1A,
+    0x47, 0x1F, 0x13, 0x1E, 0x00, 0xEE, 0x65, 0x01, 0x00, 0xEE, 0x65, 0xFF,
+    0x00, 0xEE, 0x61, 0x15, 0x60, 0x00, 0xF8, 0x29, 0xD1, 0x05, 0x71, 0x14,
+    0xF9, 0x29, 0xD1, 0x05, 0xA3, 0x48, 0x00, 0xEE, 0x61, 0x00, 0xD1, 0xA6,
+    0x71, 0x28, 0xD1, 0xA6, 0x00, 0xEE, 0x61, 0x14, 0xD1, 0xB6, 0x71, 0x28,
+    0xD1, 0xB6, 0x00, 0xEE, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+};
+const size_t aot_rom_size = 334;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000003F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+        case 0x2FE: goto L2FE;
+        case 0x300: goto L300;
+        case 0x302: goto L302;
+        case 0x304: goto L304;
+        case 0x306: goto L306;
+        case 0x308: goto L308;
+        case 0x30A: goto L30A;
+        case 0x30C: goto L30C;
+        case 0x30E: goto L30E;
+        case 0x310: goto L310;
+        case 0x312: goto L312;
+        case 0x314: goto L314;
+        case 0x316: goto L316;
+        case 0x318: goto L318;
+        case 0x31A: goto L31A;
+        case 0x31C: goto L31C;
+        case 0x31E: goto L31E;
+        case 0x320: goto L320;
+        case 0x322: goto L322;
+        case 0x324: goto L324;
+        case 0x326: goto L326;
+        case 0x328: goto L328;
+        case 0x32A: goto L32A;
+        case 0x32C: goto L32C;
+        case 0x32E: goto L32E;
+        case 0x330: goto L330;
+        case 0x332: goto L332;
+        case 0x334: goto L334;
+        case 0x336: goto L336;
+        case 0x338: goto L338;
+        case 0x33A: goto L33A;
+        case 0x33C: goto L33C;
+        case 0x33E: goto L33E;
+        case 0x340: goto L340;
+        case 0x342: goto L342;
+        case 0x344: goto L344;
+        case 0x346: goto L346;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 00E0 CLS
+    STEP(0x200, 0x00E0);
+    c->pc = 0x200;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x202) goto dispatch;
+L202: // 6A0C LD VA, 0x0C
+    STEP(0x202, 0x6A0C);
+    V[10] = 0x0C;
+L204: // 6B0C LD VB, 0x0C
+    STEP(0x204, 0x6B0C);
+    V[11] = 0x0C;
+L206: // 6800 LD V8, 0x00
+    STEP(0x206, 0x6800);
+    V[8] = 0x00;
+L208: // 6900 LD V9, 0x00
+    STEP(0x208, 0x6900);
+    V[9] = 0x00;
+L20A: // 6600 LD V6, 0x00
+    STEP(0x20A, 0x6600);
+    V[6] = 0x00;
+L20C: // 6700 LD V7, 0x00
+    STEP(0x20C, 0x6700);
+    V[7] = 0x00;
+L20E: // 6500 LD V5, 0x00
+    STEP(0x20E, 0x6500);
+    V[5] = 0x00;
+L210: // 6400 LD V4, 0x00
+    STEP(0x210, 0x6400);
+    V[4] = 0x00;
+L212: // A348 LD I, 0x348
+    STEP(0x212, 0xA348);
+    c->I = 0x348;
+L214: // 2322 CALL 0x322
+    STEP(0x214, 0x2322);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x214;
+    goto L322;
+L216: // 2334 CALL 0x334
+    STEP(0x216, 0x2334);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x216;
+    goto L334;
+L218: // 233E CALL 0x33E
+    STEP(0x218, 0x233E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x218;
+    goto L33E;
+L21A: // 6060 LD V0, 0x60
+    STEP(0x21A, 0x6060);
+    V[0] = 0x60;
+L21C: // F015 LD DT, V0
+    STEP(0x21C, 0xF015);
+    c->dt = V[0];
+L21E: // F007 LD V0, DT
+    STEP(0x21E, 0xF007);
+    V[0] = c->dt;
+L220: // 4000 SNE V0, 0x00
+    STEP(0x220, 0x4000);
+    if (V[0] != 0x00) goto L224;
+L222: // 1226 JP 0x226
+    STEP(0x222, 0x1226);
+    goto L226;
+L224: // 121E JP 0x21E
+    STEP(0x224, 0x121E);
+    goto L21E;
+L226: // 6402 LD V4, 0x02
+    STEP(0x226, 0x6402);
+    V[4] = 0x02;
+L228: // 6602 LD V6, 0x02
+    STEP(0x228, 0x6602);
+    V[6] = 0x02;
+L22A: // 6710 LD V7, 0x10
+    STEP(0x22A, 0x6710);
+    V[7] = 0x10;
+L22C: // 2308 CALL 0x308
+    STEP(0x22C, 0x2308);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x22C;
+    goto L308;
+L22E: // 22D4 CALL 0x2D4
+    STEP(0x22E, 0x22D4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x22E;
+    goto L2D4;
+L230: // 2308 CALL 0x308
+    STEP(0x230, 0x2308);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x230;
+    goto L308;
+L232: // 230C CALL 0x30C
+    STEP(0x232, 0x230C);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x232;
+    goto L30C;
+L234: // 4640 SNE V6, 0x40
+    STEP(0x234, 0x4640);
+    if (V[6] != 0x40) goto L238;
+L236: // 125C JP 0x25C
+    STEP(0x236, 0x125C);
+    goto L25C;
+L238: // 46FE SNE V6, 0xFE
+    STEP(0x238, 0x46FE);
+    if (V[6] != 0xFE) goto L23C;
+L23A: // 1280 JP 0x280
+    STEP(0x23A, 0x1280);
+    goto L280;
+L23C: // 2308 CALL 0x308
+    STEP(0x23C, 0x2308);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x23C;
+    goto L308;
+L23E: // 4F01 SNE VF, 0x01
+    STEP(0x23E, 0x4F01);
+    if (V[15] != 0x01) goto L242;
+L240: // 22E4 CALL 0x2E4
+    STEP(0x240, 0x22E4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x240;
+    goto L2E4;
+L242: // 6001 LD V0, 0x01
+    STEP(0x242, 0x6001);
+    V[0] = 0x01;
+L244: // E0A1 SKNP V0
+    STEP(0x244, 0xE0A1);
+    c->pc = 0x244;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x246) goto dispatch;
+L246: // 22A4 CALL 0x2A4
+    STEP(0x246, 0x22A4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x246;
+    goto L2A4;
+L248: // 6004 LD V0, 0x04
+    STEP(0x248, 0x6004);
+    V[0] = 0x04;
+L24A: // E0A1 SKNP V0
+    STEP(0x24A, 0xE0A1);
+    c->pc = 0x24A;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x24C) goto dispatch;
+L24C: // 22B0 CALL 0x2B0
+    STEP(0x24C, 0x22B0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x24C;
+    goto L2B0;
+L24E: // 600C LD V0, 0x0C
+    STEP(0x24E, 0x600C);
+    V[0] = 0x0C;
+L250: // E0A1 SKNP V0
+    STEP(0x250, 0xE0A1);
+    c->pc = 0x250;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x252) goto dispatch;
+L252: // 22BC CALL 0x2BC
+    STEP(0x252, 0x22BC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x252;
+    goto L2BC;
+L254: // 600D LD V0, 0x0D
+    STEP(0x254, 0x600D);
+    V[0] = 0x0D;
+L256: // E0A1 SKNP V0
+    STEP(0x256, 0xE0A1);
+    c->pc = 0x256;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x258) goto dispatch;
+L258: // 22C8 CALL 0x2C8
+    STEP(0x258, 0x22C8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x258;
+    goto L2C8;
+L25A: // 1230 JP 0x230
+    STEP(0x25A, 0x1230);
+    goto L230;
+L25C: // 2322 CALL 0x322
+    STEP(0x25C, 0x2322);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x25C;
+    goto L322;
+L25E: // 7801 ADD V8, 0x01
+    STEP(0x25E, 0x7801);
+    V[8] += 0x01;
+L260: // 480A SNE V8, 0x0A
+    STEP(0x260, 0x480A);
+    if (V[8] != 0x0A) goto L264;
+L262: // 6800 LD V8, 0x00
+    STEP(0x262, 0x6800);
+    V[8] = 0x00;
+L264: // 2322 CALL 0x322
+    STEP(0x264, 0x2322);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x264;
+    goto L322;
+L266: // 6014 LD V0, 0x14
+    STEP(0x266, 0x6014);
+    V[0] = 0x14;
+L268: // F018 LD ST, V0
+    STEP(0x268, 0xF018);
+    c->st = V[0];
+L26A: // 6602 LD V6, 0x02
+    STEP(0x26A, 0x6602);
+    V[6] = 0x02;
+L26C: // 6710 LD V7, 0x10
+    STEP(0x26C, 0x6710);
+    V[7] = 0x10;
+L26E: // 6402 LD V4, 0x02
+    STEP(0x26E, 0x6402);
+    V[4] = 0x02;
+L270: // 22D4 CALL 0x2D4
+    STEP(0x270, 0x22D4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x270;
+    goto L2D4;
+L272: // 2308 CALL 0x308
+    STEP(0x272, 0x2308);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x272;
+    goto L308;
+L274: // 6060 LD V0, 0x60
+    STEP(0x274, 0x6060);
+    V[0] = 0x60;
+L276: // F015 LD DT, V0
+    STEP(0x276, 0xF015);
+    c->dt = V[0];
+L278: // F007 LD V0, DT
+    STEP(0x278, 0xF007);
+    V[0] = c->dt;
+L27A: // 4000 SNE V0, 0x00
+    STEP(0x27A, 0x4000);
+    if (V[0] != 0x00) goto L27E;
+L27C: // 1230 JP 0x230
+    STEP(0x27C, 0x1230);
+    goto L230;
+L27E: // 1278 JP 0x278
+    STEP(0x27E, 0x1278);
+    goto L278;
+L280: // 2322 CALL 0x322
+    STEP(0x280, 0x2322);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x280;
+    goto L322;
+L282: // 7901 ADD V9, 0x01
+    STEP(0x282, 0x7901);
+    V[9] += 0x01;
+L284: // 490A SNE V9, 0x0A
+    STEP(0x284, 0x490A);
+    if (V[9] != 0x0A) goto L288;
+L286: // 6900 LD V9, 0x00
+    STEP(0x286, 0x6900);
+    V[9] = 0x00;
+L288: // 2322 CALL 0x322
+    STEP(0x288, 0x2322);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x288;
+    goto L322;
+L28A: // 6014 LD V0, 0x14
+    STEP(0x28A, 0x6014);
+    V[0] = 0x14;
+L28C: // F018 LD ST, V0
+    STEP(0x28C, 0xF018);
+    c->st = V[0];
+L28E: // 663A LD V6, 0x3A
+    STEP(0x28E, 0x663A);
+    V[6] = 0x3A;
+L290: // 6710 LD V7, 0x10
+    STEP(0x290, 0x6710);
+    V[7] = 0x10;
+L292: // 64FE LD V4, 0xFE
+    STEP(0x292, 0x64FE);
+    V[4] = 0xFE;
+L294: // 22D4 CALL 0x2D4
+    STEP(0x294, 0x22D4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x294;
+    goto L2D4;
+L296: // 2308 CALL 0x308
+    STEP(0x296, 0x2308);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x296;
+    goto L308;
+L298: // 6060 LD V0, 0x60
+    STEP(0x298, 0x6060);
+    V[0] = 0x60;
+L29A: // F015 LD DT, V0
+    STEP(0x29A, 0xF015);
+    c->dt = V[0];
+L29C: // F007 LD V0, DT
+    STEP(0x29C, 0xF007);
+    V[0] = c->dt;
+L29E: // 4000 SNE V0, 0x00
+    STEP(0x29E, 0x4000);
+    if (V[0] != 0x00) goto L2A2;
+L2A0: // 1230 JP 0x230
+    STEP(0x2A0, 0x1230);
+    goto L230;
+L2A2: // 129C JP 0x29C
+    STEP(0x2A2, 0x129C);
+    goto L29C;
+L2A4: // 4A00 SNE VA, 0x00
+    STEP(0x2A4, 0x4A00);
+    if (V[10] != 0x00) goto L2A8;
+L2A6: // 00EE RET
+    STEP(0x2A6, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2A8: // 2334 CALL 0x334
+    STEP(0x2A8, 0x2334);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2A8;
+    goto L334;
+L2AA: // 7AFE ADD VA, 0xFE
+    STEP(0x2AA, 0x7AFE);
+    V[10] += 0xFE;
+L2AC: // 2334 CALL 0x334
+    STEP(0x2AC, 0x2334);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2AC;
+    goto L334;
+L2AE: // 00EE RET
+    STEP(0x2AE, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2B0: // 4A1A SNE VA, 0x1A
+    STEP(0x2B0, 0x4A1A);
+    if (V[10] != 0x1A) goto L2B4;
+L2B2: // 00EE RET
+    STEP(0x2B2, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2B4: // 2334 CALL 0x334
+    STEP(0x2B4, 0x2334);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2B4;
+    goto L334;
+L2B6: // 7A02 ADD VA, 0x02
+    STEP(0x2B6, 0x7A02);
+    V[10] += 0x02;
+L2B8: // 2334 CALL 0x334
+    STEP(0x2B8, 0x2334);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2B8;
+    goto L334;
+L2BA: // 00EE RET
+    STEP(0x2BA, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2BC: // 4B00 SNE VB, 0x00
+    STEP(0x2BC, 0x4B00);
+    if (V[11] != 0x00) goto L2C0;
+L2BE: // 00EE RET
+    STEP(0x2BE, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2C0: // 233E CALL 0x33E
+    STEP(0x2C0, 0x233E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2C0;
+    goto L33E;
+L2C2: // 7BFE ADD VB, 0xFE
+    STEP(0x2C2, 0x7BFE);
+    V[11] += 0xFE;
+L2C4: // 233E CALL 0x33E
+    STEP(0x2C4, 0x233E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2C4;
+    goto L33E;
+L2C6: // 00EE RET
+    STEP(0x2C6, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2C8: // 4B1A SNE VB, 0x1A
+    STEP(0x2C8, 0x4B1A);
+    if (V[11] != 0x1A) goto L2CC;
+L2CA: // 00EE RET
+    STEP(0x2CA, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2CC: // 233E CALL 0x33E
+    STEP(0x2CC, 0x233E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2CC;
+    goto L33E;
+L2CE: // 7B02 ADD VB, 0x02
+    STEP(0x2CE, 0x7B02);
+    V[11] += 0x02;
+L2D0: // 233E CALL 0x33E
+    STEP(0x2D0, 0x233E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2D0;
+    goto L33E;
+L2D2: // 00EE RET
+    STEP(0x2D2, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2D4: // C003 RND V0, 0x03
+    STEP(0x2D4, 0xC003);
+    c->pc = 0x2D4;
+    predecode(0xC003, &in);
+    execute(c, &in);
+    if (c->pc != 0x2D6) goto dispatch;
+L2D6: // 4000 SNE V0, 0x00
+    STEP(0x2D6, 0x4000);
+    if (V[0] != 0x00) goto L2DA;
+L2D8: // 65FF LD V5, 0xFF
+    STEP(0x2D8, 0x65FF);
+    V[5] = 0xFF;
+L2DA: // 4001 SNE V0, 0x01
+    STEP(0x2DA, 0x4001);
+    if (V[0] != 0x01) goto L2DE;
+L2DC: // 6500 LD V5, 0x00
+    STEP(0x2DC, 0x6500);
+    V[5] = 0x00;
+L2DE: // 4002 SNE V0, 0x02
+    STEP(0x2DE, 0x4002);
+    if (V[0] != 0x02) goto L2E2;
+L2E0: // 6501 LD V5, 0x01
+    STEP(0x2E0, 0x6501);
+    V[5] = 0x01;
+L2E2: // 00EE RET
+    STEP(0x2E2, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2E4: // 4600 SNE V6, 0x00
+    STEP(0x2E4, 0x4600);
+    if (V[6] != 0x00) goto L2E8;
+L2E6: // 12F6 JP 0x2F6
+    STEP(0x2E6, 0x12F6);
+    goto L2F6;
+L2E8: // 4614 SNE V6, 0x14
+    STEP(0x2E8, 0x4614);
+    if (V[6] != 0x14) goto L2EC;
+L2EA: // 12F6 JP 0x2F6
+    STEP(0x2EA, 0x12F6);
+    goto L2F6;
+L2EC: // 4628 SNE V6, 0x28
+    STEP(0x2EC, 0x4628);
+    if (V[6] != 0x28) goto L2F0;
+L2EE: // 12F6 JP 0x2F6
+    STEP(0x2EE, 0x12F6);
+    goto L2F6;
+L2F0: // 463C SNE V6, 0x3C
+    STEP(0x2F0, 0x463C);
+    if (V[6] != 0x3C) goto L2F4;
+L2F2: // 12F6 JP 0x2F6
+    STEP(0x2F2, 0x12F6);
+    goto L2F6;
+L2F4: // 00EE RET
+    STEP(0x2F4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2F6: // 22D4 CALL 0x2D4
+    STEP(0x2F6, 0x22D4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2F6;
+    goto L2D4;
+L2F8: // 6004 LD V0, 0x04
+    STEP(0x2F8, 0x6004);
+    V[0] = 0x04;
+L2FA: // F018 LD ST, V0
+    STEP(0x2FA, 0xF018);
+    c->st = V[0];
+L2FC: // 44FE SNE V4, 0xFE
+    STEP(0x2FC, 0x44FE);
+    if (V[4] != 0xFE) goto L300;
+L2FE: // 1304 JP 0x304
+    STEP(0x2FE, 0x1304);
+    goto L304;
+L300: // 64FE LD V4, 0xFE
+    STEP(0x300, 0x64FE);
+    V[4] = 0xFE;
+L302: // 00EE RET
+    STEP(0x302, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L304: // 6402 LD V4, 0x02
+    STEP(0x304, 0x6402);
+    V[4] = 0x02;
+L306: // 00EE RET
+    STEP(0x306, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L308: // D671 DRW V6, V7, 1
+    STEP(0x308, 0xD671);
+    c->pc = 0x308;
+    predecode(0xD671, &in);
+    execute(c, &in);
+    if (c->pc != 0x30A) goto dispatch;
+L30A: // 00EE RET
+    STEP(0x30A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L30C: // 8644 ADD V6, V4
+    STEP(0x30C, 0x8644);
+    V[15] = V[6] + V[4] > 0xFF;
+    V[6] += V[4];
+L30E: // 8754 ADD V7, V5
+    STEP(0x30E, 0x8754);
+    V[15] = V[7] + V[5] > 0xFF;
+    V[7] += V[5];
+L310: // 4700 SNE V7, 0x00
+    STEP(0x310, 0x4700);
+    if (V[7] != 0x00) goto L314;
+L312: // 131A JP 0x31A
+    STEP(0x312, 0x131A);
+    goto L31A;
+L314: // 471F SNE V7, 0x1F
+    STEP(0x314, 0x471F);
+    if (V[7] != 0x1F) goto L318;
+L316: // 131E JP 0x31E
+    STEP(0x316, 0x131E);
+    goto L31E;
+L318: // 00EE RET
+    STEP(0x318, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L31A: // 6501 LD V5, 0x01
+    STEP(0x31A, 0x6501);
+    V[5] = 0x01;
+L31C: // 00EE RET
+    STEP(0x31C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L31E: // 65FF LD V5, 0xFF
+    STEP(0x31E, 0x65FF);
+    V[5] = 0xFF;
+L320: // 00EE RET
+    STEP(0x320, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L322: // 6115 LD V1, 0x15
+    STEP(0x322, 0x6115);
+    V[1] = 0x15;
+L324: // 6000 LD V0, 0x00
+    STEP(0x324, 0x6000);
+    V[0] = 0x00;
+L326: // F829 LD F, V8
+    STEP(0x326, 0xF829);
+    c->I = V[8] * 5;
+L328: // D105 DRW V1, V0, 5
+    STEP(0x328, 0xD105);
+    c->pc = 0x328;
+    predecode(0xD105, &in);
+    execute(c, &in);
+    if (c->pc != 0x32A) goto dispatch;
+L32A: // 7114 ADD V1, 0x14
+    STEP(0x32A, 0x7114);
+    V[1] += 0x14;
+L32C: // F929 LD F, V9
+    STEP(0x32C, 0xF929);
+    c->I = V[9] * 5;
+L32E: // D105 DRW V1, V0, 5
+    STEP(0x32E, 0xD105);
+    c->pc = 0x32E;
+    predecode(0xD105, &in);
+    execute(c, &in);
+    if (c->pc != 0x330) goto dispatch;
+L330: // A348 LD I, 0x348
+    STEP(0x330, 0xA348);
+    c->I = 0x348;
+L332: // 00EE RET
+    STEP(0x332, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L334: // 6100 LD V1, 0x00
+    STEP(0x334, 0x6100);
+    V[1] = 0x00;
+L336: // D1A6 DRW V1, VA, 6
+    STEP(0x336, 0xD1A6);
+    c->pc = 0x336;
+    predecode(0xD1A6, &in);
+    execute(c, &in);
+    if (c->pc != 0x338) goto dispatch;
+L338: // 7128 ADD V1, 0x28
+    STEP(0x338, 0x7128);
+    V[1] += 0x28;
+L33A: // D1A6 DRW V1, VA, 6
+    STEP(0x33A, 0xD1A6);
+    c->pc = 0x33A;
+    predecode(0xD1A6, &in);
+    execute(c, &in);
+    if (c->pc != 0x33C) goto dispatch;
+L33C: // 00EE RET
+    STEP(0x33C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L33E: // 6114 LD V1, 0x14
+    STEP(0x33E, 0x6114);
+    V[1] = 0x14;
+L340: // D1B6 DRW V1, VB, 6
+    STEP(0x340, 0xD1B6);
+    c->pc = 0x340;
+    predecode(0xD1B6, &in);
+    execute(c, &in);
+    if (c->pc != 0x342) goto dispatch;
+L342: // 7128 ADD V1, 0x28
+    STEP(0x342, 0x7128);
+    V[1] += 0x28;
+L344: // D1B6 DRW V1, VB, 6
+    STEP(0x344, 0xD1B6);
+    c->pc = 0x344;
+    predecode(0xD1B6, &in);
+    execute(c, &in);
+    if (c->pc != 0x346) goto dispatch;
+L346: // 00EE RET
+    STEP(0x346, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,1312 @@
+// generated by chip8-aot from roms/SPACEF.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x00, 0xE0, 0xA4, 0x08, 0x63, 0x00, 0x64, 0x00, 0x65, 0x1F, 0xD3, 0x41,
+    0xD3, 0x51, 0x73, 0x08, 0x43, 0x40, 0x12, 0x16, 0x12, 0x0A, 0x63, 0x00,
+    0x64, 0x01, 0x65, 0x3F, 0xA4, 0x09, 0xD3, 0x4A, 0xD5, 0x4A, 0x74, 0x0A,
+    0x44, 0x1F, 0x12, 0x2A, 0x12, 0x1E, 0xA4, 0x13, 0x63, 0x11, 0x64, 0x06,
+    0xD3, 0x47, 0xA4, 0x1A, 0x73, 0x08, 0xD3, 0x47, 0xA4, 0x21, 0x73, 0x08,
+    0xD3, 0x47, 0xA4, 0x28, 0x73, 0x08, 0xD3, 0x47, 0xA4, 0x2F, 0x63, 0x0E,
+    0x64, 0x14, 0xD3, 0x47, 0xA4, 0x36, 0x73, 0x08, 0xD3, 0x47, 0xA4, 0x3D,
+    0x73, 0x08, 0xD3, 0x47, 0xA4, 0x44, 0x73, 0x08, 0xD3, 0x47, 0xA4, 0x4B,
+    0x73, 0x08, 0xD3, 0x47, 0x60, 0x0F, 0xE0, 0xA1, 0x12, 0x6C, 0x12, 0x66,
+    0x69, 0x03, 0x6A, 0x04, 0x6B, 0x01, 0x6C, 0x00, 0x6D, 0x0F, 0x4B, 0x0B,
+    0x6B, 0x0A, 0x22, 0x84, 0x60, 0x0E, 0xE0, 0xA1, 0x13, 0x0E, 0x12, 0x7E,
+    0x00, 0xE0, 0xA4, 0x08, 0x63, 0x00, 0x64, 0x00, 0x65, 0x1F, 0xD3, 0x41,
+    0xD3, 0x51, 0x73, 0x08, 0x43, 0x40, 0x12, 0x9A, 0x12, 0x8E, 0x63, 0x00,
+    0x64, 0x01, 0x65, 0x3F, 0xA4, 0x09, 0xD3, 0x4A, 0xD5, 0x4A, 0x74, 0x0A,
+    0x44, 0x1F, 0x12, 0xAE, 0x12, 0xA2, 0xA4, 0x2F, 0x63, 0x0A, 0x64, 0x0C,
+    0xD3, 0x47, 0xA4, 0x36, 0x73, 0x08, 0xD3, 0x47, 0xA4, 0x3D, 0x73, 0x08,
+    0xD3, 0x47, 0xA4, 0x44, 0x73, 0x08, 0xD3, 0x47, 0xA4, 0x4B, 0x73, 0x08,
+    0xD3, 0x47, 0x4B, 0x01, 0xA4, 0x52, 0x4B, 0x02, 0xA4, 0x59, 0x4B, 0x03,
+    0xA4, 0x60, 0x4B, 0x04, 0xA4, 0x67, 0x4B, 0x05, 0xA4, 0x6E, 0x4B, 0x06,
+    0xA4, 0x75, 0x4B, 0x07, 0xA4, 0x7C, 0x4B, 0x08, 0xA4, 0x83, 0x4B, 0x09,
+    0xA4, 0x8A, 0x4B, 0x0A, 0xA4, 0x91, 0x73, 0x05, 0xD3, 0x47, 0x49, 0x03,
+    0xA4, 0x9C, 0x49, 0x02, 0xA4, 0x9E, 0x49, 0x01, 0xA4, 0xA0, 0x60, 0x02,
+    0x61, 0x02, 0xD0, 0x12, 0x00, 0xEE, 0x23, 0x1C, 0xA4, 0x9A, 0xDC, 0xD2,
+    0x60, 0x0F, 0xE0, 0x9E, 0x13, 0x16, 0x13, 0x58, 0x00, 0xE0, 0xA4, 0x98,
+    0x4B, 0x01, 0x63, 0x1E, 0x4B, 0x02, 0x63, 0x28, 0x4B, 0x03, 0x63, 0x32,
+    0x4B, 0x04, 0x63, 0x37, 0x4B, 0x05, 0x63, 0x3C, 0x4B, 0x06, 0x63, 0x41,
+    0x4B, 0x07, 0x63, 0x46, 0x4B, 0x08, 0x63, 0x4B, 0x4B, 0x09, 0x63, 0x50,
+    0x4B, 0x0A, 0x63, 0x55, 0xC4, 0x34, 0x74, 0x0A, 0xC6, 0x1F, 0xD4, 0x61,
+    0x73, 0xFF, 0x43, 0xFF, 0x00, 0xEE, 0x13, 0x48, 0xDC, 0xD2, 0x60, 0x01,
+    0xE0, 0xA1, 0x7D, 0xFF, 0x60, 0x04, 0xE0, 0xA1, 0x7D, 0x01, 0x7C, 0x02,
+    0xDC, 0xD2, 0x4F, 0x01, 0x13, 0x96, 0x4C, 0x3E, 0x13, 0x7E, 0x60, 0x05,
+    0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x13, 0x76, 0x13, 0x58, 0xDC, 0xD2,
+    0x6C, 0x00, 0x60, 0x05, 0xF0, 0x18, 0x7A, 0xFF, 0x3A, 0x00, 0x13, 0x5A,
+    0x6A, 0x04, 0x6C, 0x00, 0x6D, 0x0F, 0x7B, 0x01, 0x12, 0x76, 0x60, 0x08,
+    0xF0, 0x18, 0x60, 0x0F, 0xE0, 0xA1, 0x13, 0xA2, 0x13, 0x9C, 0x79, 0xFF,
+    0x6C, 0x00, 0x6D, 0x0F, 0x6A, 0x04, 0x49, 0x00, 0x13, 0xB4, 0x22, 0x84,
+    0x60, 0x0E, 0x12, 0x7E, 0x00, 0xE0, 0xA4, 0x08, 0x63, 0x00, 0x64, 0x00,
+    0x65, 0x1F, 0xD3, 0x41, 0xD3, 0x51, 0x73, 0x08, 0x43, 0x40, 0x13, 0xCA,
+    0x13, 0xBE, 0x63, 0x00, 0x64, 0x01, 0x65, 0x3F, 0xA4, 0x09, 0xD3, 0x4A,
+    0xD5, 0x4A, 0x74, 0x0A, 0x44, 0x1F, 0x13, 0xDE, 0x13, 0xD2, 0xA4, 0xA2,
+    0x64, 0x08, 0x63, 0x14, 0xD3, 0x47, 0x73, 0x08, 0xA4, 0xA9, 0xD3, 0x47,
+    0x73, 0x08, 0xA4, 0xB0, 0xD3, 0x47, 0x63, 0x14, 0x64, 0x11, 0xA4, 0xB7,
+    0xD3, 0x47, 0x73, 0x08, 0xA4, 0xBE, 0xD3, 0x47, 0xA4, 0xC5, 0x73, 0x08,
+    0xD3, 0x47, 0x14, 0x06, 0xFF, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0xFB, 0x82, 0x82, 0xFB, 0x0A, 0x0A, 0xFA, 0xEF, 0x28,
+    0x28, 0xEF, 0x08, 0x08, 0x08, 0xBE, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0xBE,
+    0xF8, 0x80, 0x80, 0xF8, 0x80, 0x80, 0xF8, 0xFA, 0x82, 0x82, 0xFA, 0x82,
+    0x82, 0x83, 0x0F, 0x02, 0x02, 0x02, 0x02, 0x02, 0xEF, 0xBE, 0x20, 0x20,
+    0x26, 0x22, 0x22, 0xBE, 0x8B, 0x88, 0x88, 0xF8, 0x88, 0x88, 0x88, 0xE0,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x08, 0x08, 0x08, 0x08, 0x08, 0x08,
+    0x08, 0x3E, 0x02, 0x02, 0x3E, 0x20, 0x20, 0x3E, 0x3E, 0x02, 0x02, 0x3E,
+    0x02, 0x02, 0x3E, 0x22, 0x22, 0x22, 0x3E, 0x02, 0x02, 0x02, 0x3E, 0x20,
+    0x20, 0x3E, 0x02, 0x02, 0x3E, 0x3E, 0x20, 0x20, 0x3E, 0x22, 0x22, 0x3E,
+    0x3E, 0x02, 0x04, 0x08, 0x10, 0x10, 0x10, 0x3E, 0x22, 0x22, 0x3E, 0x22,
+    0x22, 0x3E, 0x3E, 0x22, 0x22, 0x3E, 0x02, 0x02, 0x3E, 0x2F, 0x29, 0x29,
+    0x29, 0x29, 0x29, 0x2F, 0x80, 0x00, 0xE0, 0xE0, 0xDB, 0xDB, 0xD8, 0xD8,
+    0xC0, 0xC0, 0xFB, 0x82, 0x82, 0x83, 0x8A, 0x8A, 0xFA, 0xED, 0x2A, 0x28,
+    0xE8, 0x28, 0x28, 0x28, 0xBE, 0xA0, 0xA0, 0xBE, 0xA0, 0xA0, 0xBE, 0xFA,
+    0x8A, 0x8A, 0x8A, 0x8A, 0x89, 0xF8, 0x2F, 0x28, 0x28, 0x2F, 0x28, 0x48,
+    0x8F, 0xBE, 0x22, 0x22, 0xBE, 0x28, 0x24, 0xA2,
+};
+const size_t aot_rom_size = 716;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x000000000001FF00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+        case 0x2FE: goto L2FE;
+        case 0x300: goto L300;
+        case 0x302: goto L302;
+        case 0x304: goto L304;
+        case 0x306: goto L306;
+        case 0x308: goto L308;
+        case 0x30A: goto L30A;
+        case 0x30C: goto L30C;
+        case 0x30E: goto L30E;
+        case 0x310: goto L310;
+        case 0x312: goto L312;
+        case 0x314: goto L314;
+        case 0x316: goto L316;
+        case 0x318: goto L318;
+        case 0x31A: goto L31A;
+        case 0x31C: goto L31C;
+        case 0x31E: goto L31E;
+        case 0x320: goto L320;
+        case 0x322: goto L322;
+        case 0x324: goto L324;
+        case 0x326: goto L326;
+        case 0x328: goto L328;
+        case 0x32A: goto L32A;
+        case 0x32C: goto L32C;
+        case 0x32E: goto L32E;
+        case 0x330: goto L330;
+        case 0x332: goto L332;
+        case 0x334: goto L334;
+        case 0x336: goto L336;
+        case 0x338: goto L338;
+        case 0x33A: goto L33A;
+        case 0x33C: goto L33C;
+        case 0x33E: goto L33E;
+        case 0x340: goto L340;
+        case 0x342: goto L342;
+        case 0x344: goto L344;
+        case 0x346: goto L346;
+        case 0x348: goto L348;
+        case 0x34A: goto L34A;
+        case 0x34C: goto L34C;
+        case 0x34E: goto L34E;
+        case 0x350: goto L350;
+        case 0x352: goto L352;
+        case 0x354: goto L354;
+        case 0x356: goto L356;
+        case 0x358: goto L358;
+        case 0x35A: goto L35A;
+        case 0x35C: goto L35C;
+        case 0x35E: goto L35E;
+        case 0x360: goto L360;
+        case 0x362: goto L362;
+        case 0x364: goto L364;
+        case 0x366: goto L366;
+        case 0x368: goto L368;
+        case 0x36A: goto L36A;
+        case 0x36C: goto L36C;
+        case 0x36E: goto L36E;
+        case 0x370: goto L370;
+        case 0x372: goto L372;
+        case 0x374: goto L374;
+        case 0x376: goto L376;
+        case 0x378: goto L378;
+        case 0x37A: goto L37A;
+        case 0x37C: goto L37C;
+        case 0x37E: goto L37E;
+        case 0x380: goto L380;
+        case 0x382: goto L382;
+        case 0x384: goto L384;
+        case 0x386: goto L386;
+        case 0x388: goto L388;
+        case 0x38A: goto L38A;
+        case 0x38C: goto L38C;
+        case 0x38E: goto L38E;
+        case 0x390: goto L390;
+        case 0x392: goto L392;
+        case 0x394: goto L394;
+        case 0x396: goto L396;
+        case 0x398: goto L398;
+        case 0x39A: goto L39A;
+        case 0x39C: goto L39C;
+        case 0x39E: goto L39E;
+        case 0x3A0: goto L3A0;
+        case 0x3A2: goto L3A2;
+        case 0x3A4: goto L3A4;
+        case 0x3A6: goto L3A6;
+        case 0x3A8: goto L3A8;
+        case 0x3AA: goto L3AA;
+        case 0x3AC: goto L3AC;
+        case 0x3AE: goto L3AE;
+        case 0x3B0: goto L3B0;
+        case 0x3B2: goto L3B2;
+        case 0x3B4: goto L3B4;
+        case 0x3B6: goto L3B6;
+        case 0x3B8: goto L3B8;
+        case 0x3BA: goto L3BA;
+        case 0x3BC: goto L3BC;
+        case 0x3BE: goto L3BE;
+        case 0x3C0: goto L3C0;
+        case 0x3C2: goto L3C2;
+        case 0x3C4: goto L3C4;
+        case 0x3C6: goto L3C6;
+        case 0x3C8: goto L3C8;
+        case 0x3CA: goto L3CA;
+        case 0x3CC: goto L3CC;
+        case 0x3CE: goto L3CE;
+        case 0x3D0: goto L3D0;
+        case 0x3D2: goto L3D2;
+        case 0x3D4: goto L3D4;
+        case 0x3D6: goto L3D6;
+        case 0x3D8: goto L3D8;
+        case 0x3DA: goto L3DA;
+        case 0x3DC: goto L3DC;
+        case 0x3DE: goto L3DE;
+        case 0x3E0: goto L3E0;
+        case 0x3E2: goto L3E2;
+        case 0x3E4: goto L3E4;
+        case 0x3E6: goto L3E6;
+        case 0x3E8: goto L3E8;
+        case 0x3EA: goto L3EA;
+        case 0x3EC: goto L3EC;
+        case 0x3EE: goto L3EE;
+        case 0x3F0: goto L3F0;
+        case 0x3F2: goto L3F2;
+        case 0x3F4: goto L3F4;
+        case 0x3F6: goto L3F6;
+        case 0x3F8: goto L3F8;
+        case 0x3FA: goto L3FA;
+        case 0x3FC: goto L3FC;
+        case 0x3FE: goto L3FE;
+        case 0x400: goto L400;
+        case 0x402: goto L402;
+        case 0x404: goto L404;
+        case 0x406: goto L406;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 00E0 CLS
+    STEP(0x200, 0x00E0);
+    c->pc = 0x200;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x202) goto dispatch;
+L202: // A408 LD I, 0x408
+    STEP(0x202, 0xA408);
+    c->I = 0x408;
+L204: // 6300 LD V3, 0x00
+    STEP(0x204, 0x6300);
+    V[3] = 0x00;
+L206: // 6400 LD V4, 0x00
+    STEP(0x206, 0x6400);
+    V[4] = 0x00;
+L208: // 651F LD V5, 0x1F
+    STEP(0x208, 0x651F);
+    V[5] = 0x1F;
+L20A: // D341 DRW V3, V4, 1
+    STEP(0x20A, 0xD341);
+    c->pc = 0x20A;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x20C) goto dispatch;
+L20C: // D351 DRW V3, V5, 1
+    STEP(0x20C, 0xD351);
+    c->pc = 0x20C;
+    predecode(0xD351, &in);
+    execute(c, &in);
+    if (c->pc != 0x20E) goto dispatch;
+L20E: // 7308 ADD V3, 0x08
+    STEP(0x20E, 0x7308);
+    V[3] += 0x08;
+L210: // 4340 SNE V3, 0x40
+    STEP(0x210, 0x4340);
+    if (V[3] != 0x40) goto L214;
+L212: // 1216 JP 0x216
+    STEP(0x212, 0x1216);
+    goto L216;
+L214: // 120A JP 0x20A
+    STEP(0x214, 0x120A);
+    goto L20A;
+L216: // 6300 LD V3, 0x00
+    STEP(0x216, 0x6300);
+    V[3] = 0x00;
+L218: // 6401 LD V4, 0x01
+    STEP(0x218, 0x6401);
+    V[4] = 0x01;
+L21A: // 653F LD V5, 0x3F
+    STEP(0x21A, 0x653F);
+    V[5] = 0x3F;
+L21C: // A409 LD I, 0x409
+    STEP(0x21C, 0xA409);
+    c->I = 0x409;
+L21E: // D34A DRW V3, V4, 10
+    STEP(0x21E, 0xD34A);
+    c->pc = 0x21E;
+    predecode(0xD34A, &in);
+    execute(c, &in);
+    if (c->pc != 0x220) goto dispatch;
+L220: // D54A DRW V5, V4, 10
+    STEP(0x220, 0xD54A);
+    c->pc = 0x220;
+    predecode(0xD54A, &in);
+    execute(c, &in);
+    if (c->pc != 0x222) goto dispatch;
+L222: // 740A ADD V4, 0x0A
+    STEP(0x222, 0x740A);
+    V[4] += 0x0A;
+L224: // 441F SNE V4, 0x1F
+    STEP(0x224, 0x441F);
+    if (V[4] != 0x1F) goto L228;
+L226: // 122A JP 0x22A
+    STEP(0x226, 0x122A);
+    goto L22A;
+L228: // 121E JP 0x21E
+    STEP(0x228, 0x121E);
+    goto L21E;
+L22A: // A413 LD I, 0x413
+    STEP(0x22A, 0xA413);
+    c->I = 0x413;
+L22C: // 6311 LD V3, 0x11
+    STEP(0x22C, 0x6311);
+    V[3] = 0x11;
+L22E: // 6406 LD V4, 0x06
+    STEP(0x22E, 0x6406);
+    V[4] = 0x06;
+L230: // D347 DRW V3, V4, 7
+    STEP(0x230, 0xD347);
+    c->pc = 0x230;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x232) goto dispatch;
+L232: // A41A LD I, 0x41A
+    STEP(0x232, 0xA41A);
+    c->I = 0x41A;
+L234: // 7308 ADD V3, 0x08
+    STEP(0x234, 0x7308);
+    V[3] += 0x08;
+L236: // D347 DRW V3, V4, 7
+    STEP(0x236, 0xD347);
+    c->pc = 0x236;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x238) goto dispatch;
+L238: // A421 LD I, 0x421
+    STEP(0x238, 0xA421);
+    c->I = 0x421;
+L23A: // 7308 ADD V3, 0x08
+    STEP(0x23A, 0x7308);
+    V[3] += 0x08;
+L23C: // D347 DRW V3, V4, 7
+    STEP(0x23C, 0xD347);
+    c->pc = 0x23C;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x23E) goto dispatch;
+L23E: // A428 LD I, 0x428
+    STEP(0x23E, 0xA428);
+    c->I = 0x428;
+L240: // 7308 ADD V3, 0x08
+    STEP(0x240, 0x7308);
+    V[3] += 0x08;
+L242: // D347 DRW V3, V4, 7
+    STEP(0x242, 0xD347);
+    c->pc = 0x242;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x244) goto dispatch;
+L244: // A42F LD I, 0x42F
+    STEP(0x244, 0xA42F);
+    c->I = 0x42F;
+L246: // 630E LD V3, 0x0E
+    STEP(0x246, 0x630E);
+    V[3] = 0x0E;
+L248: // 6414 LD V4, 0x14
+    STEP(0x248, 0x6414);
+    V[4] = 0x14;
+L24A: // D347 DRW V3, V4, 7
+    STEP(0x24A, 0xD347);
+    c->pc = 0x24A;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x24C) goto dispatch;
+L24C: // A436 LD I, 0x436
+    STEP(0x24C, 0xA436);
+    c->I = 0x436;
+L24E: // 7308 ADD V3, 0x08
+    STEP(0x24E, 0x7308);
+    V[3] += 0x08;
+L250: // D347 DRW V3, V4, 7
+    STEP(0x250, 0xD347);
+    c->pc = 0x250;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x252) goto dispatch;
+L252: // A43D LD I, 0x43D
+    STEP(0x252, 0xA43D);
+    c->I = 0x43D;
+L254: // 7308 ADD V3, 0x08
+    STEP(0x254, 0x7308);
+    V[3] += 0x08;
+L256: // D347 DRW V3, V4, 7
+    STEP(0x256, 0xD347);
+    c->pc = 0x256;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x258) goto dispatch;
+L258: // A444 LD I, 0x444
+    STEP(0x258, 0xA444);
+    c->I = 0x444;
+L25A: // 7308 ADD V3, 0x08
+    STEP(0x25A, 0x7308);
+    V[3] += 0x08;
+L25C: // D347 DRW V3, V4, 7
+    STEP(0x25C, 0xD347);
+    c->pc = 0x25C;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x25E) goto dispatch;
+L25E: // A44B LD I, 0x44B
+    STEP(0x25E, 0xA44B);
+    c->I = 0x44B;
+L260: // 7308 ADD V3, 0x08
+    STEP(0x260, 0x7308);
+    V[3] += 0x08;
+L262: // D347 DRW V3, V4, 7
+    STEP(0x262, 0xD347);
+    c->pc = 0x262;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x264) goto dispatch;
+L264: // 600F LD V0, 0x0F
+    STEP(0x264, 0x600F);
+    V[0] = 0x0F;
+L266: // E0A1 SKNP V0
+    STEP(0x266, 0xE0A1);
+    c->pc = 0x266;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x268) goto dispatch;
+L268: // 126C JP 0x26C
+    STEP(0x268, 0x126C);
+    goto L26C;
+L26A: // 1266 JP 0x266
+    STEP(0x26A, 0x1266);
+    goto L266;
+L26C: // 6903 LD V9, 0x03
+    STEP(0x26C, 0x6903);
+    V[9] = 0x03;
+L26E: // 6A04 LD VA, 0x04
+    STEP(0x26E, 0x6A04);
+    V[10] = 0x04;
+L270: // 6B01 LD VB, 0x01
+    STEP(0x270, 0x6B01);
+    V[11] = 0x01;
+L272: // 6C00 LD VC, 0x00
+    STEP(0x272, 0x6C00);
+    V[12] = 0x00;
+L274: // 6D0F LD VD, 0x0F
+    STEP(0x274, 0x6D0F);
+    V[13] = 0x0F;
+L276: // 4B0B SNE VB, 0x0B
+    STEP(0x276, 0x4B0B);
+    if (V[11] != 0x0B) goto L27A;
+L278: // 6B0A LD VB, 0x0A
+    STEP(0x278, 0x6B0A);
+    V[11] = 0x0A;
+L27A: // 2284 CALL 0x284
+    STEP(0x27A, 0x2284);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x27A;
+    goto L284;
+L27C: // 600E LD V0, 0x0E
+    STEP(0x27C, 0x600E);
+    V[0] = 0x0E;
+L27E: // E0A1 SKNP V0
+    STEP(0x27E, 0xE0A1);
+    c->pc = 0x27E;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x280) goto dispatch;
+L280: // 130E JP 0x30E
+    STEP(0x280, 0x130E);
+    goto L30E;
+L282: // 127E JP 0x27E
+    STEP(0x282, 0x127E);
+    goto L27E;
+L284: // 00E0 CLS
+    STEP(0x284, 0x00E0);
+    c->pc = 0x284;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x286) goto dispatch;
+L286: // A408 LD I, 0x408
+    STEP(0x286, 0xA408);
+    c->I = 0x408;
+L288: // 6300 LD V3, 0x00
+    STEP(0x288, 0x6300);
+    V[3] = 0x00;
+L28A: // 6400 LD V4, 0x00
+    STEP(0x28A, 0x6400);
+    V[4] = 0x00;
+L28C: // 651F LD V5, 0x1F
+    STEP(0x28C, 0x651F);
+    V[5] = 0x1F;
+L28E: // D341 DRW V3, V4, 1
+    STEP(0x28E, 0xD341);
+    c->pc = 0x28E;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x290) goto dispatch;
+L290: // D351 DRW V3, V5, 1
+    STEP(0x290, 0xD351);
+    c->pc = 0x290;
+    predecode(0xD351, &in);
+    execute(c, &in);
+    if (c->pc != 0x292) goto dispatch;
+L292: // 7308 ADD V3, 0x08
+    STEP(0x292, 0x7308);
+    V[3] += 0x08;
+L294: // 4340 SNE V3, 0x40
+    STEP(0x294, 0x4340);
+    if (V[3] != 0x40) goto L298;
+L296: // 129A JP 0x29A
+    STEP(0x296, 0x129A);
+    goto L29A;
+L298: // 128E JP 0x28E
+    STEP(0x298, 0x128E);
+    goto L28E;
+L29A: // 6300 LD V3, 0x00
+    STEP(0x29A, 0x6300);
+    V[3] = 0x00;
+L29C: // 6401 LD V4, 0x01
+    STEP(0x29C, 0x6401);
+    V[4] = 0x01;
+L29E: // 653F LD V5, 0x3F
+    STEP(0x29E, 0x653F);
+    V[5] = 0x3F;
+L2A0: // A409 LD I, 0x409
+    STEP(0x2A0, 0xA409);
+    c->I = 0x409;
+L2A2: // D34A DRW V3, V4, 10
+    STEP(0x2A2, 0xD34A);
+    c->pc = 0x2A2;
+    predecode(0xD34A, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A4) goto dispatch;
+L2A4: // D54A DRW V5, V4, 10
+    STEP(0x2A4, 0xD54A);
+    c->pc = 0x2A4;
+    predecode(0xD54A, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A6) goto dispatch;
+L2A6: // 740A ADD V4, 0x0A
+    STEP(0x2A6, 0x740A);
+    V[4] += 0x0A;
+L2A8: // 441F SNE V4, 0x1F
+    STEP(0x2A8, 0x441F);
+    if (V[4] != 0x1F) goto L2AC;
+L2AA: // 12AE JP 0x2AE
+    STEP(0x2AA, 0x12AE);
+    goto L2AE;
+L2AC: // 12A2 JP 0x2A2
+    STEP(0x2AC, 0x12A2);
+    goto L2A2;
+L2AE: // A42F LD I, 0x42F
+    STEP(0x2AE, 0xA42F);
+    c->I = 0x42F;
+L2B0: // 630A LD V3, 0x0A
+    STEP(0x2B0, 0x630A);
+    V[3] = 0x0A;
+L2B2: // 640C LD V4, 0x0C
+    STEP(0x2B2, 0x640C);
+    V[4] = 0x0C;
+L2B4: // D347 DRW V3, V4, 7
+    STEP(0x2B4, 0xD347);
+    c->pc = 0x2B4;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x2B6) goto dispatch;
+L2B6: // A436 LD I, 0x436
+    STEP(0x2B6, 0xA436);
+    c->I = 0x436;
+L2B8: // 7308 ADD V3, 0x08
+    STEP(0x2B8, 0x7308);
+    V[3] += 0x08;
+L2BA: // D347 DRW V3, V4, 7
+    STEP(0x2BA, 0xD347);
+    c->pc = 0x2BA;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x2BC) goto dispatch;
+L2BC: // A43D LD I, 0x43D
+    STEP(0x2BC, 0xA43D);
+    c->I = 0x43D;
+L2BE: // 7308 ADD V3, 0x08
+    STEP(0x2BE, 0x7308);
+    V[3] += 0x08;
+L2C0: // D347 DRW V3, V4, 7
+    STEP(0x2C0, 0xD347);
+    c->pc = 0x2C0;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C2) goto dispatch;
+L2C2: // A444 LD I, 0x444
+    STEP(0x2C2, 0xA444);
+    c->I = 0x444;
+L2C4: // 7308 ADD V3, 0x08
+    STEP(0x2C4, 0x7308);
+    V[3] += 0x08;
+L2C6: // D347 DRW V3, V4, 7
+    STEP(0x2C6, 0xD347);
+    c->pc = 0x2C6;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C8) goto dispatch;
+L2C8: // A44B LD I, 0x44B
+    STEP(0x2C8, 0xA44B);
+    c->I = 0x44B;
+L2CA: // 7308 ADD V3, 0x08
+    STEP(0x2CA, 0x7308);
+    V[3] += 0x08;
+L2CC: // D347 DRW V3, V4, 7
+    STEP(0x2CC, 0xD347);
+    c->pc = 0x2CC;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x2CE) goto dispatch;
+L2CE: // 4B01 SNE VB, 0x01
+    STEP(0x2CE, 0x4B01);
+    if (V[11] != 0x01) goto L2D2;
+L2D0: // A452 LD I, 0x452
+    STEP(0x2D0, 0xA452);
+    c->I = 0x452;
+L2D2: // 4B02 SNE VB, 0x02
+    STEP(0x2D2, 0x4B02);
+    if (V[11] != 0x02) goto L2D6;
+L2D4: // A459 LD I, 0x459
+    STEP(0x2D4, 0xA459);
+    c->I = 0x459;
+L2D6: // 4B03 SNE VB, 0x03
+    STEP(0x2D6, 0x4B03);
+    if (V[11] != 0x03) goto L2DA;
+L2D8: // A460 LD I, 0x460
+    STEP(0x2D8, 0xA460);
+    c->I = 0x460;
+L2DA: // 4B04 SNE VB, 0x04
+    STEP(0x2DA, 0x4B04);
+    if (V[11] != 0x04) goto L2DE;
+L2DC: // A467 LD I, 0x467
+    STEP(0x2DC, 0xA467);
+    c->I = 0x467;
+L2DE: // 4B05 SNE VB, 0x05
+    STEP(0x2DE, 0x4B05);
+    if (V[11] != 0x05) goto L2E2;
+L2E0: // A46E LD I, 0x46E
+    STEP(0x2E0, 0xA46E);
+    c->I = 0x46E;
+L2E2: // 4B06 SNE VB, 0x06
+    STEP(0x2E2, 0x4B06);
+    if (V[11] != 0x06) goto L2E6;
+L2E4: // A475 LD I, 0x475
+    STEP(0x2E4, 0xA475);
+    c->I = 0x475;
+L2E6: // 4B07 SNE VB, 0x07
+    STEP(0x2E6, 0x4B07);
+    if (V[11] != 0x07) goto L2EA;
+L2E8: // A47C LD I, 0x47C
+    STEP(0x2E8, 0xA47C);
+    c->I = 0x47C;
+L2EA: // 4B08 SNE VB, 0x08
+    STEP(0x2EA, 0x4B08);
+    if (V[11] != 0x08) goto L2EE;
+L2EC: // A483 LD I, 0x483
+    STEP(0x2EC, 0xA483);
+    c->I = 0x483;
+L2EE: // 4B09 SNE VB, 0x09
+    STEP(0x2EE, 0x4B09);
+    if (V[11] != 0x09) goto L2F2;
+L2F0: // A48A LD I, 0x48A
+    STEP(0x2F0, 0xA48A);
+    c->I = 0x48A;
+L2F2: // 4B0A SNE VB, 0x0A
+    STEP(0x2F2, 0x4B0A);
+    if (V[11] != 0x0A) goto L2F6;
+L2F4: // A491 LD I, 0x491
+    STEP(0x2F4, 0xA491);
+    c->I = 0x491;
+L2F6: // 7305 ADD V3, 0x05
+    STEP(0x2F6, 0x7305);
+    V[3] += 0x05;
+L2F8: // D347 DRW V3, V4, 7
+    STEP(0x2F8, 0xD347);
+    c->pc = 0x2F8;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x2FA) goto dispatch;
+L2FA: // 4903 SNE V9, 0x03
+    STEP(0x2FA, 0x4903);
+    if (V[9] != 0x03) goto L2FE;
+L2FC: // A49C LD I, 0x49C
+    STEP(0x2FC, 0xA49C);
+    c->I = 0x49C;
+L2FE: // 4902 SNE V9, 0x02
+    STEP(0x2FE, 0x4902);
+    if (V[9] != 0x02) goto L302;
+L300: // A49E LD I, 0x49E
+    STEP(0x300, 0xA49E);
+    c->I = 0x49E;
+L302: // 4901 SNE V9, 0x01
+    STEP(0x302, 0x4901);
+    if (V[9] != 0x01) goto L306;
+L304: // A4A0 LD I, 0x4A0
+    STEP(0x304, 0xA4A0);
+    c->I = 0x4A0;
+L306: // 6002 LD V0, 0x02
+    STEP(0x306, 0x6002);
+    V[0] = 0x02;
+L308: // 6102 LD V1, 0x02
+    STEP(0x308, 0x6102);
+    V[1] = 0x02;
+L30A: // D012 DRW V0, V1, 2
+    STEP(0x30A, 0xD012);
+    c->pc = 0x30A;
+    predecode(0xD012, &in);
+    execute(c, &in);
+    if (c->pc != 0x30C) goto dispatch;
+L30C: // 00EE RET
+    STEP(0x30C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L30E: // 231C CALL 0x31C
+    STEP(0x30E, 0x231C);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x30E;
+    goto L31C;
+L310: // A49A LD I, 0x49A
+    STEP(0x310, 0xA49A);
+    c->I = 0x49A;
+L312: // DCD2 DRW VC, VD, 2
+    STEP(0x312, 0xDCD2);
+    c->pc = 0x312;
+    predecode(0xDCD2, &in);
+    execute(c, &in);
+    if (c->pc != 0x314) goto dispatch;
+L314: // 600F LD V0, 0x0F
+    STEP(0x314, 0x600F);
+    V[0] = 0x0F;
+L316: // E09E SKP V0
+    STEP(0x316, 0xE09E);
+    c->pc = 0x316;
+    predecode(0xE09E, &in);
+    execute(c, &in);
+    if (c->pc != 0x318) goto dispatch;
+L318: // 1316 JP 0x316
+    STEP(0x318, 0x1316);
+    goto L316;
+L31A: // 1358 JP 0x358
+    STEP(0x31A, 0x1358);
+    goto L358;
+L31C: // 00E0 CLS
+    STEP(0x31C, 0x00E0);
+    c->pc = 0x31C;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x31E) goto dispatch;
+L31E: // A498 LD I, 0x498
+    STEP(0x31E, 0xA498);
+    c->I = 0x498;
+L320: // 4B01 SNE VB, 0x01
+    STEP(0x320, 0x4B01);
+    if (V[11] != 0x01) goto L324;
+L322: // 631E LD V3, 0x1E
+    STEP(0x322, 0x631E);
+    V[3] = 0x1E;
+L324: // 4B02 SNE VB, 0x02
+    STEP(0x324, 0x4B02);
+    if (V[11] != 0x02) goto L328;
+L326: // 6328 LD V3, 0x28
+    STEP(0x326, 0x6328);
+    V[3] = 0x28;
+L328: // 4B03 SNE VB, 0x03
+    STEP(0x328, 0x4B03);
+    if (V[11] != 0x03) goto L32C;
+L32A: // 6332 LD V3, 0x32
+    STEP(0x32A, 0x6332);
+    V[3] = 0x32;
+L32C: // 4B04 SNE VB, 0x04
+    STEP(0x32C, 0x4B04);
+    if (V[11] != 0x04) goto L330;
+L32E: // 6337 LD V3, 0x37
+    STEP(0x32E, 0x6337);
+    V[3] = 0x37;
+L330: // 4B05 SNE VB, 0x05
+    STEP(0x330, 0x4B05);
+    if (V[11] != 0x05) goto L334;
+L332: // 633C LD V3, 0x3C
+    STEP(0x332, 0x633C);
+    V[3] = 0x3C;
+L334: // 4B06 SNE VB, 0x06
+    STEP(0x334, 0x4B06);
+    if (V[11] != 0x06) goto L338;
+L336: // 6341 LD V3, 0x41
+    STEP(0x336, 0x6341);
+    V[3] = 0x41;
+L338: // 4B07 SNE VB, 0x07
+    STEP(0x338, 0x4B07);
+    if (V[11] != 0x07) goto L33C;
+L33A: // 6346 LD V3, 0x46
+    STEP(0x33A, 0x6346);
+    V[3] = 0x46;
+L33C: // 4B08 SNE VB, 0x08
+    STEP(0x33C, 0x4B08);
+    if (V[11] != 0x08) goto L340;
+L33E: // 634B LD V3, 0x4B
+    STEP(0x33E, 0x634B);
+    V[3] = 0x4B;
+L340: // 4B09 SNE VB, 0x09
+    STEP(0x340, 0x4B09);
+    if (V[11] != 0x09) goto L344;
+L342: // 6350 LD V3, 0x50
+    STEP(0x342, 0x6350);
+    V[3] = 0x50;
+L344: // 4B0A SNE VB, 0x0A
+    STEP(0x344, 0x4B0A);
+    if (V[11] != 0x0A) goto L348;
+L346: // 6355 LD V3, 0x55
+    STEP(0x346, 0x6355);
+    V[3] = 0x55;
+L348: // C434 RND V4, 0x34
+    STEP(0x348, 0xC434);
+    c->pc = 0x348;
+    predecode(0xC434, &in);
+    execute(c, &in);
+    if (c->pc != 0x34A) goto dispatch;
+L34A: // 740A ADD V4, 0x0A
+    STEP(0x34A, 0x740A);
+    V[4] += 0x0A;
+L34C: // C61F RND V6, 0x1F
+    STEP(0x34C, 0xC61F);
+    c->pc = 0x34C;
+    predecode(0xC61F, &in);
+    execute(c, &in);
+    if (c->pc != 0x34E) goto dispatch;
+L34E: // D461 DRW V4, V6, 1
+    STEP(0x34E, 0xD461);
+    c->pc = 0x34E;
+    predecode(0xD461, &in);
+    execute(c, &in);
+    if (c->pc != 0x350) goto dispatch;
+L350: // 73FF ADD V3, 0xFF
+    STEP(0x350, 0x73FF);
+    V[3] += 0xFF;
+L352: // 43FF SNE V3, 0xFF
+    STEP(0x352, 0x43FF);
+    if (V[3] != 0xFF) goto L356;
+L354: // 00EE RET
+    STEP(0x354, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L356: // 1348 JP 0x348
+    STEP(0x356, 0x1348);
+    goto L348;
+L358: // DCD2 DRW VC, VD, 2
+    STEP(0x358, 0xDCD2);
+    c->pc = 0x358;
+    predecode(0xDCD2, &in);
+    execute(c, &in);
+    if (c->pc != 0x35A) goto dispatch;
+L35A: // 6001 LD V0, 0x01
+    STEP(0x35A, 0x6001);
+    V[0] = 0x01;
+L35C: // E0A1 SKNP V0
+    STEP(0x35C, 0xE0A1);
+    c->pc = 0x35C;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x35E) goto dispatch;
+L35E: // 7DFF ADD VD, 0xFF
+    STEP(0x35E, 0x7DFF);
+    V[13] += 0xFF;
+L360: // 6004 LD V0, 0x04
+    STEP(0x360, 0x6004);
+    V[0] = 0x04;
+L362: // E0A1 SKNP V0
+    STEP(0x362, 0xE0A1);
+    c->pc = 0x362;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x364) goto dispatch;
+L364: // 7D01 ADD VD, 0x01
+    STEP(0x364, 0x7D01);
+    V[13] += 0x01;
+L366: // 7C02 ADD VC, 0x02
+    STEP(0x366, 0x7C02);
+    V[12] += 0x02;
+L368: // DCD2 DRW VC, VD, 2
+    STEP(0x368, 0xDCD2);
+    c->pc = 0x368;
+    predecode(0xDCD2, &in);
+    execute(c, &in);
+    if (c->pc != 0x36A) goto dispatch;
+L36A: // 4F01 SNE VF, 0x01
+    STEP(0x36A, 0x4F01);
+    if (V[15] != 0x01) goto L36E;
+L36C: // 1396 JP 0x396
+    STEP(0x36C, 0x1396);
+    goto L396;
+L36E: // 4C3E SNE VC, 0x3E
+    STEP(0x36E, 0x4C3E);
+    if (V[12] != 0x3E) goto L372;
+L370: // 137E JP 0x37E
+    STEP(0x370, 0x137E);
+    goto L37E;
+L372: // 6005 LD V0, 0x05
+    STEP(0x372, 0x6005);
+    V[0] = 0x05;
+L374: // F015 LD DT, V0
+    STEP(0x374, 0xF015);
+    c->dt = V[0];
+L376: // F007 LD V0, DT
+    STEP(0x376, 0xF007);
+    V[0] = c->dt;
+L378: // 3000 SE V0, 0x00
+    STEP(0x378, 0x3000);
+    if (V[0] == 0x00) goto L37C;
+L37A: // 1376 JP 0x376
+    STEP(0x37A, 0x1376);
+    goto L376;
+L37C: // 1358 JP 0x358
+    STEP(0x37C, 0x1358);
+    goto L358;
+L37E: // DCD2 DRW VC, VD, 2
+    STEP(0x37E, 0xDCD2);
+    c->pc = 0x37E;
+    predecode(0xDCD2, &in);
+    execute(c, &in);
+    if (c->pc != 0x380) goto dispatch;
+L380: // 6C00 LD VC, 0x00
+    STEP(0x380, 0x6C00);
+    V[12] = 0x00;
+L382: // 6005 LD V0, 0x05
+    STEP(0x382, 0x6005);
+    V[0] = 0x05;
+L384: // F018 LD ST, V0
+    STEP(0x384, 0xF018);
+    c->st = V[0];
+L386: // 7AFF ADD VA, 0xFF
+    STEP(0x386, 0x7AFF);
+    V[10] += 0xFF;
+L388: // 3A00 SE VA, 0x00
+    STEP(0x388, 0x3A00);
+    if (V[10] == 0x00) goto L38C;
+L38A: // 135A JP 0x35A
+    STEP(0x38A, 0x135A);
+    goto L35A;
+L38C: // 6A04 LD VA, 0x04
+    STEP(0x38C, 0x6A04);
+    V[10] = 0x04;
+L38E: // 6C00 LD VC, 0x00
+    STEP(0x38E, 0x6C00);
+    V[12] = 0x00;
+L390: // 6D0F LD VD, 0x0F
+    STEP(0x390, 0x6D0F);
+    V[13] = 0x0F;
+L392: // 7B01 ADD VB, 0x01
+    STEP(0x392, 0x7B01);
+    V[11] += 0x01;
+L394: // 1276 JP 0x276
+    STEP(0x394, 0x1276);
+    goto L276;
+L396: // 6008 LD V0, 0x08
+    STEP(0x396, 0x6008);
+    V[0] = 0x08;
+L398: // F018 LD ST, V0
+    STEP(0x398, 0xF018);
+    c->st = V[0];
+L39A: // 600F LD V0, 0x0F
+    STEP(0x39A, 0x600F);
+    V[0] = 0x0F;
+L39C: // E0A1 SKNP V0
+    STEP(0x39C, 0xE0A1);
+    c->pc = 0x39C;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x39E) goto dispatch;
+L39E: // 13A2 JP 0x3A2
+    STEP(0x39E, 0x13A2);
+    goto L3A2;
+L3A0: // 139C JP 0x39C
+    STEP(0x3A0, 0x139C);
+    goto L39C;
+L3A2: // 79FF ADD V9, 0xFF
+    STEP(0x3A2, 0x79FF);
+    V[9] += 0xFF;
+L3A4: // 6C00 LD VC, 0x00
+    STEP(0x3A4, 0x6C00);
+    V[12] = 0x00;
+L3A6: // 6D0F LD VD, 0x0F
+    STEP(0x3A6, 0x6D0F);
+    V[13] = 0x0F;
+L3A8: // 6A04 LD VA, 0x04
+    STEP(0x3A8, 0x6A04);
+    V[10] = 0x04;
+L3AA: // 4900 SNE V9, 0x00
+    STEP(0x3AA, 0x4900);
+    if (V[9] != 0x00) goto L3AE;
+L3AC: // 13B4 JP 0x3B4
+    STEP(0x3AC, 0x13B4);
+    goto L3B4;
+L3AE: // 2284 CALL 0x284
+    STEP(0x3AE, 0x2284);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x3AE;
+    goto L284;
+L3B0: // 600E LD V0, 0x0E
+    STEP(0x3B0, 0x600E);
+    V[0] = 0x0E;
+L3B2: // 127E JP 0x27E
+    STEP(0x3B2, 0x127E);
+    goto L27E;
+L3B4: // 00E0 CLS
+    STEP(0x3B4, 0x00E0);
+    c->pc = 0x3B4;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x3B6) goto dispatch;
+L3B6: // A408 LD I, 0x408
+    STEP(0x3B6, 0xA408);
+    c->I = 0x408;
+L3B8: // 6300 LD V3, 0x00
+    STEP(0x3B8, 0x6300);
+    V[3] = 0x00;
+L3BA: // 6400 LD V4, 0x00
+    STEP(0x3BA, 0x6400);
+    V[4] = 0x00;
+L3BC: // 651F LD V5, 0x1F
+    STEP(0x3BC, 0x651F);
+    V[5] = 0x1F;
+L3BE: // D341 DRW V3, V4, 1
+    STEP(0x3BE, 0xD341);
+    c->pc = 0x3BE;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x3C0) goto dispatch;
+L3C0: // D351 DRW V3, V5, 1
+    STEP(0x3C0, 0xD351);
+    c->pc = 0x3C0;
+    predecode(0xD351, &in);
+    execute(c, &in);
+    if (c->pc != 0x3C2) goto dispatch;
+L3C2: // 7308 ADD V3, 0x08
+    STEP(0x3C2, 0x7308);
+    V[3] += 0x08;
+L3C4: // 4340 SNE V3, 0x40
+    STEP(0x3C4, 0x4340);
+    if (V[3] != 0x40) goto L3C8;
+L3C6: // 13CA JP 0x3CA
+    STEP(0x3C6, 0x13CA);
+    goto L3CA;
+L3C8: // 13BE JP 0x3BE
+    STEP(0x3C8, 0x13BE);
+    goto L3BE;
+L3CA: // 6300 LD V3, 0x00
+    STEP(0x3CA, 0x6300);
+    V[3] = 0x00;
+L3CC: // 6401 LD V4, 0x01
+    STEP(0x3CC, 0x6401);
+    V[4] = 0x01;
+L3CE: // 653F LD V5, 0x3F
+    STEP(0x3CE, 0x653F);
+    V[5] = 0x3F;
+L3D0: // A409 LD I, 0x409
+    STEP(0x3D0, 0xA409);
+    c->I = 0x409;
+L3D2: // D34A DRW V3, V4, 10
+    STEP(0x3D2, 0xD34A);
+    c->pc = 0x3D2;
+    predecode(0xD34A, &in);
+    execute(c, &in);
+    if (c->pc != 0x3D4) goto dispatch;
+L3D4: // D54A DRW V5, V4, 10
+    STEP(0x3D4, 0xD54A);
+    c->pc = 0x3D4;
+    predecode(0xD54A, &in);
+    execute(c, &in);
+    if (c->pc != 0x3D6) goto dispatch;
+L3D6: // 740A ADD V4, 0x0A
+    STEP(0x3D6, 0x740A);
+    V[4] += 0x0A;
+L3D8: // 441F SNE V4, 0x1F
+    STEP(0x3D8, 0x441F);
+    if (V[4] != 0x1F) goto L3DC;
+L3DA: // 13DE JP 0x3DE
+    STEP(0x3DA, 0x13DE);
+    goto L3DE;
+L3DC: // 13D2 JP 0x3D2
+    STEP(0x3DC, 0x13D2);
+    goto L3D2;
+L3DE: // A4A2 LD I, 0x4A2
+    STEP(0x3DE, 0xA4A2);
+    c->I = 0x4A2;
+L3E0: // 6408 LD V4, 0x08
+    STEP(0x3E0, 0x6408);
+    V[4] = 0x08;
+L3E2: // 6314 LD V3, 0x14
+    STEP(0x3E2, 0x6314);
+    V[3] = 0x14;
+L3E4: // D347 DRW V3, V4, 7
+    STEP(0x3E4, 0xD347);
+    c->pc = 0x3E4;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x3E6) goto dispatch;
+L3E6: // 7308 ADD V3, 0x08
+    STEP(0x3E6, 0x7308);
+    V[3] += 0x08;
+L3E8: // A4A9 LD I, 0x4A9
+    STEP(0x3E8, 0xA4A9);
+    c->I = 0x4A9;
+L3EA: // D347 DRW V3, V4, 7
+    STEP(0x3EA, 0xD347);
+    c->pc = 0x3EA;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x3EC) goto dispatch;
+L3EC: // 7308 ADD V3, 0x08
+    STEP(0x3EC, 0x7308);
+    V[3] += 0x08;
+L3EE: // A4B0 LD I, 0x4B0
+    STEP(0x3EE, 0xA4B0);
+    c->I = 0x4B0;
+L3F0: // D347 DRW V3, V4, 7
+    STEP(0x3F0, 0xD347);
+    c->pc = 0x3F0;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x3F2) goto dispatch;
+L3F2: // 6314 LD V3, 0x14
+    STEP(0x3F2, 0x6314);
+    V[3] = 0x14;
+L3F4: // 6411 LD V4, 0x11
+    STEP(0x3F4, 0x6411);
+    V[4] = 0x11;
+L3F6: // A4B7 LD I, 0x4B7
+    STEP(0x3F6, 0xA4B7);
+    c->I = 0x4B7;
+L3F8: // D347 DRW V3, V4, 7
+    STEP(0x3F8, 0xD347);
+    c->pc = 0x3F8;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x3FA) goto dispatch;
+L3FA: // 7308 ADD V3, 0x08
+    STEP(0x3FA, 0x7308);
+    V[3] += 0x08;
+L3FC: // A4BE LD I, 0x4BE
+    STEP(0x3FC, 0xA4BE);
+    c->I = 0x4BE;
+L3FE: // D347 DRW V3, V4, 7
+    STEP(0x3FE, 0xD347);
+    c->pc = 0x3FE;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x400) goto dispatch;
+L400: // A4C5 LD I, 0x4C5
+    STEP(0x400, 0xA4C5);
+    c->I = 0x4C5;
+L402: // 7308 ADD V3, 0x08
+    STEP(0x402, 0x7308);
+    V[3] += 0x08;
+L404: // D347 DRW V3, V4, 7
+    STEP(0x404, 0xD347);
+    c->pc = 0x404;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x406) goto dispatch;
+L406: // 1406 JP 0x406
+    STEP(0x406, 0x1406);
+    goto L406;
+}
@@ -0,0 +1,2074 @@
+// generated by chip8-aot from roms/SYZYGY.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x12, 0x12, 0x8D, 0x8D, 0x20, 0xA9, 0x31, 0x39, 0x39, 0x30, 0x20, 0x52,
+    0x54, 0x54, 0x20, 0x8E, 0x8E, 0x00, 0x24, 0xB6, 0x24, 0xDA, 0x60, 0x0F,
+    0xE0, 0xA1, 0x12, 0x24, 0x60, 0x0E, 0xE0, 0xA1, 0x12, 0x28, 0x12, 0x16,
+    0x24, 0xDA, 0x12, 0x2C, 0x00, 0xE0, 0x12, 0x2C, 0xC1, 0x1F, 0x71, 0x10,
+    0xC2, 0x0F, 0x72, 0x08, 0xC3, 0x03, 0x85, 0x30, 0x86, 0x10, 0x87, 0x20,
+    0x88, 0x30, 0x48, 0x00, 0x77, 0x01, 0x48, 0x01, 0x77, 0xFF, 0x48, 0x02,
+    0x76, 0x01, 0x48, 0x03, 0x76, 0xFF, 0xA5, 0x4C, 0xD1, 0x21, 0xD6, 0x71,
+    0x64, 0xF0, 0x69, 0xF1, 0xA8, 0x00, 0xF4, 0x1E, 0x80, 0x30, 0xF0, 0x55,
+    0x74, 0x01, 0xA8, 0x00, 0xF4, 0x1E, 0x60, 0x01, 0xF0, 0x55, 0x25, 0x22,
+    0x6A, 0x00, 0x7A, 0x00, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x9C, 0x3D, 0x00,
+    0x12, 0x94, 0x60, 0x00, 0xF0, 0x29, 0xDB, 0xC5, 0x3F, 0x01, 0x12, 0x8C,
+    0xDB, 0xC5, 0x25, 0x22, 0xF0, 0x15, 0x12, 0x9C, 0xFE, 0x15, 0x6D, 0x01,
+    0x6E, 0x00, 0x12, 0x9C, 0x80, 0xE0, 0xF0, 0x29, 0xDB, 0xC5, 0x25, 0x22,
+    0x60, 0x03, 0xE0, 0xA1, 0x63, 0x00, 0x60, 0x06, 0xE0, 0xA1, 0x63, 0x01,
+    0x60, 0x07, 0xE0, 0xA1, 0x63, 0x02, 0x60, 0x08, 0xE0, 0xA1, 0x63, 0x03,
+    0x43, 0x00, 0x72, 0xFF, 0x43, 0x01, 0x72, 0x01, 0x43, 0x02, 0x71, 0xFF,
+    0x43, 0x03, 0x71, 0x01, 0xA5, 0x4C, 0xD1, 0x21, 0x3F, 0x01, 0x13, 0x24,
+    0x3D, 0x01, 0x13, 0x88, 0x60, 0x3F, 0x81, 0x02, 0x60, 0x1F, 0x82, 0x02,
+    0x80, 0xB0, 0x80, 0x17, 0x3F, 0x01, 0x13, 0x88, 0x80, 0xB0, 0x70, 0x03,
+    0x80, 0x15, 0x3F, 0x01, 0x13, 0x88, 0x80, 0xC0, 0x80, 0x27, 0x3F, 0x01,
+    0x13, 0x88, 0x80, 0xC0, 0x70, 0x04, 0x80, 0x25, 0x3F, 0x01, 0x13, 0x88,
+    0x60, 0x04, 0xF0, 0x18, 0xCE, 0x07, 0x7E, 0x02, 0x8A, 0xE4, 0xA5, 0x4C,
+    0xD1, 0x21, 0x60, 0x00, 0xF0, 0x29, 0xDB, 0xC5, 0x80, 0xE0, 0xF0, 0x29,
+    0xDB, 0xC5, 0x60, 0x30, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x13, 0x1A,
+    0xA5, 0x4C, 0xD1, 0x21, 0x93, 0x50, 0x13, 0x3E, 0x74, 0x01, 0xA8, 0x00,
+    0xF4, 0x1E, 0x80, 0x30, 0xF0, 0x55, 0x74, 0x01, 0xA8, 0x00, 0xF4, 0x1E,
+    0x60, 0x00, 0xF0, 0x55, 0x85, 0x30, 0xA8, 0x00, 0xF4, 0x1E, 0xF0, 0x65,
+    0x70, 0x01, 0xF0, 0x55, 0x4A, 0x00, 0x13, 0x58, 0x60, 0x0C, 0x70, 0xFF,
+    0x30, 0x00, 0x13, 0x4E, 0x7A, 0xFF, 0x12, 0x70, 0xA5, 0x4C, 0xD6, 0x71,
+    0x48, 0x00, 0x77, 0xFF, 0x48, 0x01, 0x77, 0x01, 0x48, 0x02, 0x76, 0xFF,
+    0x48, 0x03, 0x76, 0x01, 0xA8, 0x00, 0xF9, 0x1E, 0xF0, 0x65, 0x70, 0xFF,
+    0xF0, 0x55, 0x30, 0x00, 0x12, 0x70, 0x79, 0x01, 0xA8, 0x00, 0xF9, 0x1E,
+    0xF0, 0x65, 0x88, 0x00, 0x79, 0x01, 0x12, 0x70, 0x60, 0x0D, 0xF0, 0x18,
+    0x60, 0x0B, 0xE0, 0x9E, 0x13, 0x8E, 0x6B, 0x01, 0x6C, 0x00, 0x6D, 0x00,
+    0x7B, 0x01, 0x3B, 0x0A, 0x13, 0xAA, 0x6B, 0x00, 0x7C, 0x01, 0x3C, 0x0A,
+    0x13, 0xAA, 0x6C, 0x00, 0x7D, 0x01, 0xA5, 0x4C, 0xD6, 0x71, 0x48, 0x00,
+    0x77, 0xFF, 0x48, 0x01, 0x77, 0x01, 0x48, 0x02, 0x76, 0xFF, 0x48, 0x03,
+    0x76, 0x01, 0xA8, 0x00, 0xF9, 0x1E, 0xF0, 0x65, 0x70, 0xFF, 0xF0, 0x55,
+    0x30, 0x00, 0x13, 0x98, 0x99, 0x40, 0x13, 0xDE, 0x79, 0x01, 0xA8, 0x00,
+    0xF9, 0x1E, 0xF0, 0x65, 0x88, 0x00, 0x79, 0x01, 0x13, 0x98, 0x00, 0xE0,
+    0x66, 0x11, 0x67, 0x09, 0x68, 0x2F, 0x69, 0x17, 0xA5, 0x52, 0xD6, 0x7E,
+    0xD8, 0x7E, 0x77, 0xFF, 0xA5, 0x4E, 0xD6, 0x71, 0xD6, 0x91, 0x76, 0x08,
+    0xD6, 0x71, 0xD6, 0x91, 0x76, 0x08, 0xD6, 0x71, 0xD6, 0x91, 0x76, 0x08,
+    0xA5, 0x50, 0xD6, 0x71, 0xD6, 0x91, 0xA5, 0x9E, 0x66, 0x13, 0x67, 0x11,
+    0x24, 0x9A, 0xA5, 0xAE, 0xF3, 0x65, 0x93, 0xD0, 0x14, 0x24, 0x80, 0x30,
+    0x80, 0xD5, 0x3F, 0x01, 0x14, 0x3A, 0x14, 0x44, 0x92, 0xC0, 0x14, 0x32,
+    0x80, 0x20, 0x80, 0xC5, 0x3F, 0x01, 0x14, 0x3A, 0x14, 0x44, 0x80, 0x10,
+    0x80, 0xB5, 0x3F, 0x00, 0x14, 0x44, 0xA5, 0xAE, 0x83, 0xD0, 0x82, 0xC0,
+    0x81, 0xB0, 0xF3, 0x55, 0xA5, 0xAE, 0xF3, 0x65, 0x66, 0x13, 0x77, 0xF9,
+    0x8D, 0x30, 0x8C, 0x20, 0x8B, 0x10, 0xA5, 0xA4, 0x24, 0x9A, 0xC1, 0x3F,
+    0xC2, 0x1F, 0x60, 0x0D, 0x80, 0x15, 0x3F, 0x00, 0x14, 0x7C, 0x60, 0x30,
+    0x80, 0x17, 0x3F, 0x00, 0x14, 0x7C, 0x60, 0x03, 0x80, 0x25, 0x3F, 0x00,
+    0x14, 0x7C, 0x60, 0x18, 0x80, 0x27, 0x3F, 0x00, 0x14, 0x7C, 0x14, 0x82,
+    0xC3, 0x0F, 0xF3, 0x29, 0xD1, 0x25, 0x60, 0x0F, 0xE0, 0xA1, 0x14, 0x90,
+    0x60, 0x0E, 0xE0, 0xA1, 0x14, 0x96, 0x14, 0x56, 0x00, 0xE0, 0x24, 0xB6,
+    0x12, 0x2C, 0x00, 0xE0, 0x12, 0x2C, 0xD6, 0x75, 0xA5, 0xAA, 0x76, 0x02,
+    0xD6, 0x74, 0xFD, 0x29, 0x76, 0x0A, 0xD6, 0x75, 0xFC, 0x29, 0x76, 0x05,
+    0xD6, 0x75, 0xFB, 0x29, 0x76, 0x05, 0xD6, 0x75, 0x00, 0xEE, 0xA5, 0x4E,
+    0x61, 0x00, 0x62, 0x00, 0x66, 0x1F, 0xD1, 0x21, 0xD1, 0x61, 0x71, 0x08,
+    0x31, 0x40, 0x14, 0xBE, 0xA5, 0x52, 0x62, 0x01, 0x65, 0x3F, 0xD1, 0x2F,
+    0xD5, 0x2F, 0x72, 0x0F, 0xD1, 0x2F, 0xD5, 0x2F, 0x00, 0xEE, 0x61, 0x0C,
+    0x62, 0x07, 0xA5, 0x62, 0xD1, 0x2A, 0xA5, 0x6C, 0x71, 0x06, 0xD1, 0x2A,
+    0xA5, 0x76, 0x71, 0x06, 0xD1, 0x2A, 0xA5, 0x6C, 0x71, 0x06, 0xD1, 0x2A,
+    0xA5, 0x80, 0x71, 0x06, 0xD1, 0x2A, 0xA5, 0x6C, 0x71, 0x06, 0xD1, 0x2A,
+    0x61, 0x0E, 0x62, 0x18, 0xA5, 0x8A, 0xD1, 0x23, 0xA5, 0x8E, 0x71, 0x08,
+    0x72, 0xFF, 0xD1, 0x24, 0x71, 0x09, 0x72, 0xFE, 0xA5, 0x92, 0xD1, 0x26,
+    0x71, 0x06, 0x72, 0x01, 0xA5, 0x98, 0xD1, 0x25, 0x00, 0xEE, 0x6D, 0xC5,
+    0xCB, 0x3F, 0x8E, 0xB0, 0x8E, 0xD4, 0x4F, 0x01, 0x15, 0x24, 0x7B, 0x01,
+    0x6D, 0xE6, 0xCC, 0x1F, 0x8E, 0xC0, 0x8E, 0xD4, 0x4F, 0x01, 0x15, 0x32,
+    0x7C, 0x01, 0x6D, 0x00, 0xCE, 0x3F, 0x7E, 0x40, 0xFE, 0x15, 0xCE, 0x3F,
+    0x7E, 0x40, 0x00, 0xEE, 0x80, 0x00, 0xFF, 0x00, 0xFE, 0x00, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x1F, 0x10, 0x10, 0x10, 0x1F, 0x01, 0x01, 0x01, 0x01, 0x1F,
+    0x11, 0x11, 0x11, 0x11, 0x1F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x1F, 0x01,
+    0x02, 0x02, 0x04, 0x04, 0x08, 0x08, 0x10, 0x1F, 0x1F, 0x11, 0x10, 0x10,
+    0x10, 0x13, 0x11, 0x11, 0x11, 0x1F, 0x05, 0x05, 0x02, 0x00, 0x71, 0x51,
+    0x51, 0x75, 0x0C, 0x12, 0x1E, 0x14, 0x12, 0x09, 0x14, 0x3E, 0x15, 0x15,
+    0x2A, 0x00, 0x77, 0x44, 0x24, 0x14, 0x77, 0x00, 0x57, 0x52, 0x72, 0x52,
+    0x57, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+};
+const size_t aot_rom_size = 946;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x00000000003FFF00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+        case 0x2FE: goto L2FE;
+        case 0x300: goto L300;
+        case 0x302: goto L302;
+        case 0x304: goto L304;
+        case 0x306: goto L306;
+        case 0x308: goto L308;
+        case 0x30A: goto L30A;
+        case 0x30C: goto L30C;
+        case 0x30E: goto L30E;
+        case 0x310: goto L310;
+        case 0x312: goto L312;
+        case 0x314: goto L314;
+        case 0x316: goto L316;
+        case 0x318: goto L318;
+        case 0x31A: goto L31A;
+        case 0x31C: goto L31C;
+        case 0x31E: goto L31E;
+        case 0x320: goto L320;
+        case 0x322: goto L322;
+        case 0x324: goto L324;
+        case 0x326: goto L326;
+        case 0x328: goto L328;
+        case 0x32A: goto L32A;
+        case 0x32C: goto L32C;
+        case 0x32E: goto L32E;
+        case 0x330: goto L330;
+        case 0x332: goto L332;
+        case 0x334: goto L334;
+        case 0x336: goto L336;
+        case 0x338: goto L338;
+        case 0x33A: goto L33A;
+        case 0x33C: goto L33C;
+        case 0x33E: goto L33E;
+        case 0x340: goto L340;
+        case 0x342: goto L342;
+        case 0x344: goto L344;
+        case 0x346: goto L346;
+        case 0x348: goto L348;
+        case 0x34A: goto L34A;
+        case 0x34C: goto L34C;
+        case 0x34E: goto L34E;
+        case 0x350: goto L350;
+        case 0x352: goto L352;
+        case 0x354: goto L354;
+        case 0x356: goto L356;
+        case 0x358: goto L358;
+        case 0x35A: goto L35A;
+        case 0x35C: goto L35C;
+        case 0x35E: goto L35E;
+        case 0x360: goto L360;
+        case 0x362: goto L362;
+        case 0x364: goto L364;
+        case 0x366: goto L366;
+        case 0x368: goto L368;
+        case 0x36A: goto L36A;
+        case 0x36C: goto L36C;
+        case 0x36E: goto L36E;
+        case 0x370: goto L370;
+        case 0x372: goto L372;
+        case 0x374: goto L374;
+        case 0x376: goto L376;
+        case 0x378: goto L378;
+        case 0x37A: goto L37A;
+        case 0x37C: goto L37C;
+        case 0x37E: goto L37E;
+        case 0x380: goto L380;
+        case 0x382: goto L382;
+        case 0x384: goto L384;
+        case 0x386: goto L386;
+        case 0x388: goto L388;
+        case 0x38A: goto L38A;
+        case 0x38C: goto L38C;
+        case 0x38E: goto L38E;
+        case 0x390: goto L390;
+        case 0x392: goto L392;
+        case 0x394: goto L394;
+        case 0x396: goto L396;
+        case 0x398: goto L398;
+        case 0x39A: goto L39A;
+        case 0x39C: goto L39C;
+        case 0x39E: goto L39E;
+        case 0x3A0: goto L3A0;
+        case 0x3A2: goto L3A2;
+        case 0x3A4: goto L3A4;
+        case 0x3A6: goto L3A6;
+        case 0x3A8: goto L3A8;
+        case 0x3AA: goto L3AA;
+        case 0x3AC: goto L3AC;
+        case 0x3AE: goto L3AE;
+        case 0x3B0: goto L3B0;
+        case 0x3B2: goto L3B2;
+        case 0x3B4: goto L3B4;
+        case 0x3B6: goto L3B6;
+        case 0x3B8: goto L3B8;
+        case 0x3BA: goto L3BA;
+        case 0x3BC: goto L3BC;
+        case 0x3BE: goto L3BE;
+        case 0x3C0: goto L3C0;
+        case 0x3C2: goto L3C2;
+        case 0x3C4: goto L3C4;
+        case 0x3C6: goto L3C6;
+        case 0x3C8: goto L3C8;
+        case 0x3CA: goto L3CA;
+        case 0x3CC: goto L3CC;
+        case 0x3CE: goto L3CE;
+        case 0x3D0: goto L3D0;
+        case 0x3D2: goto L3D2;
+        case 0x3D4: goto L3D4;
+        case 0x3D6: goto L3D6;
+        case 0x3D8: goto L3D8;
+        case 0x3DA: goto L3DA;
+        case 0x3DC: goto L3DC;
+        case 0x3DE: goto L3DE;
+        case 0x3E0: goto L3E0;
+        case 0x3E2: goto L3E2;
+        case 0x3E4: goto L3E4;
+        case 0x3E6: goto L3E6;
+        case 0x3E8: goto L3E8;
+        case 0x3EA: goto L3EA;
+        case 0x3EC: goto L3EC;
+        case 0x3EE: goto L3EE;
+        case 0x3F0: goto L3F0;
+        case 0x3F2: goto L3F2;
+        case 0x3F4: goto L3F4;
+        case 0x3F6: goto L3F6;
+        case 0x3F8: goto L3F8;
+        case 0x3FA: goto L3FA;
+        case 0x3FC: goto L3FC;
+        case 0x3FE: goto L3FE;
+        case 0x400: goto L400;
+        case 0x402: goto L402;
+        case 0x404: goto L404;
+        case 0x406: goto L406;
+        case 0x408: goto L408;
+        case 0x40A: goto L40A;
+        case 0x40C: goto L40C;
+        case 0x40E: goto L40E;
+        case 0x410: goto L410;
+        case 0x412: goto L412;
+        case 0x414: goto L414;
+        case 0x416: goto L416;
+        case 0x418: goto L418;
+        case 0x41A: goto L41A;
+        case 0x41C: goto L41C;
+        case 0x41E: goto L41E;
+        case 0x420: goto L420;
+        case 0x422: goto L422;
+        case 0x424: goto L424;
+        case 0x426: goto L426;
+        case 0x428: goto L428;
+        case 0x42A: goto L42A;
+        case 0x42C: goto L42C;
+        case 0x42E: goto L42E;
+        case 0x430: goto L430;
+        case 0x432: goto L432;
+        case 0x434: goto L434;
+        case 0x436: goto L436;
+        case 0x438: goto L438;
+        case 0x43A: goto L43A;
+        case 0x43C: goto L43C;
+        case 0x43E: goto L43E;
+        case 0x440: goto L440;
+        case 0x442: goto L442;
+        case 0x444: goto L444;
+        case 0x446: goto L446;
+        case 0x448: goto L448;
+        case 0x44A: goto L44A;
+        case 0x44C: goto L44C;
+        case 0x44E: goto L44E;
+        case 0x450: goto L450;
+        case 0x452: goto L452;
+        case 0x454: goto L454;
+        case 0x456: goto L456;
+        case 0x458: goto L458;
+        case 0x45A: goto L45A;
+        case 0x45C: goto L45C;
+        case 0x45E: goto L45E;
+        case 0x460: goto L460;
+        case 0x462: goto L462;
+        case 0x464: goto L464;
+        case 0x466: goto L466;
+        case 0x468: goto L468;
+        case 0x46A: goto L46A;
+        case 0x46C: goto L46C;
+        case 0x46E: goto L46E;
+        case 0x470: goto L470;
+        case 0x472: goto L472;
+        case 0x474: goto L474;
+        case 0x476: goto L476;
+        case 0x478: goto L478;
+        case 0x47A: goto L47A;
+        case 0x47C: goto L47C;
+        case 0x47E: goto L47E;
+        case 0x480: goto L480;
+        case 0x482: goto L482;
+        case 0x484: goto L484;
+        case 0x486: goto L486;
+        case 0x488: goto L488;
+        case 0x48A: goto L48A;
+        case 0x48C: goto L48C;
+        case 0x48E: goto L48E;
+        case 0x490: goto L490;
+        case 0x492: goto L492;
+        case 0x494: goto L494;
+        case 0x496: goto L496;
+        case 0x498: goto L498;
+        case 0x49A: goto L49A;
+        case 0x49C: goto L49C;
+        case 0x49E: goto L49E;
+        case 0x4A0: goto L4A0;
+        case 0x4A2: goto L4A2;
+        case 0x4A4: goto L4A4;
+        case 0x4A6: goto L4A6;
+        case 0x4A8: goto L4A8;
+        case 0x4AA: goto L4AA;
+        case 0x4AC: goto L4AC;
+        case 0x4AE: goto L4AE;
+        case 0x4B0: goto L4B0;
+        case 0x4B2: goto L4B2;
+        case 0x4B4: goto L4B4;
+        case 0x4B6: goto L4B6;
+        case 0x4B8: goto L4B8;
+        case 0x4BA: goto L4BA;
+        case 0x4BC: goto L4BC;
+        case 0x4BE: goto L4BE;
+        case 0x4C0: goto L4C0;
+        case 0x4C2: goto L4C2;
+        case 0x4C4: goto L4C4;
+        case 0x4C6: goto L4C6;
+        case 0x4C8: goto L4C8;
+        case 0x4CA: goto L4CA;
+        case 0x4CC: goto L4CC;
+        case 0x4CE: goto L4CE;
+        case 0x4D0: goto L4D0;
+        case 0x4D2: goto L4D2;
+        case 0x4D4: goto L4D4;
+        case 0x4D6: goto L4D6;
+        case 0x4D8: goto L4D8;
+        case 0x4DA: goto L4DA;
+        case 0x4DC: goto L4DC;
+        case 0x4DE: goto L4DE;
+        case 0x4E0: goto L4E0;
+        case 0x4E2: goto L4E2;
+        case 0x4E4: goto L4E4;
+        case 0x4E6: goto L4E6;
+        case 0x4E8: goto L4E8;
+        case 0x4EA: goto L4EA;
+        case 0x4EC: goto L4EC;
+        case 0x4EE: goto L4EE;
+        case 0x4F0: goto L4F0;
+        case 0x4F2: goto L4F2;
+        case 0x4F4: goto L4F4;
+        case 0x4F6: goto L4F6;
+        case 0x4F8: goto L4F8;
+        case 0x4FA: goto L4FA;
+        case 0x4FC: goto L4FC;
+        case 0x4FE: goto L4FE;
+        case 0x500: goto L500;
+        case 0x502: goto L502;
+        case 0x504: goto L504;
+        case 0x506: goto L506;
+        case 0x508: goto L508;
+        case 0x50A: goto L50A;
+        case 0x50C: goto L50C;
+        case 0x50E: goto L50E;
+        case 0x510: goto L510;
+        case 0x512: goto L512;
+        case 0x514: goto L514;
+        case 0x516: goto L516;
+        case 0x518: goto L518;
+        case 0x51A: goto L51A;
+        case 0x51C: goto L51C;
+        case 0x51E: goto L51E;
+        case 0x520: goto L520;
+        case 0x522: goto L522;
+        case 0x524: goto L524;
+        case 0x526: goto L526;
+        case 0x528: goto L528;
+        case 0x52A: goto L52A;
+        case 0x52C: goto L52C;
+        case 0x52E: goto L52E;
+        case 0x530: goto L530;
+        case 0x532: goto L532;
+        case 0x534: goto L534;
+        case 0x536: goto L536;
+        case 0x538: goto L538;
+        case 0x53A: goto L53A;
+        case 0x53C: goto L53C;
+        case 0x53E: goto L53E;
+        case 0x540: goto L540;
+        case 0x542: goto L542;
+        case 0x544: goto L544;
+        case 0x546: goto L546;
+        case 0x548: goto L548;
+        case 0x54A: goto L54A;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 1212 JP 0x212
+    STEP(0x200, 0x1212);
+    goto L212;
+L212: // 24B6 CALL 0x4B6
+    STEP(0x212, 0x24B6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x212;
+    goto L4B6;
+L214: // 24DA CALL 0x4DA
+    STEP(0x214, 0x24DA);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x214;
+    goto L4DA;
+L216: // 600F LD V0, 0x0F
+    STEP(0x216, 0x600F);
+    V[0] = 0x0F;
+L218: // E0A1 SKNP V0
+    STEP(0x218, 0xE0A1);
+    c->pc = 0x218;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x21A) goto dispatch;
+L21A: // 1224 JP 0x224
+    STEP(0x21A, 0x1224);
+    goto L224;
+L21C: // 600E LD V0, 0x0E
+    STEP(0x21C, 0x600E);
+    V[0] = 0x0E;
+L21E: // E0A1 SKNP V0
+    STEP(0x21E, 0xE0A1);
+    c->pc = 0x21E;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x220) goto dispatch;
+L220: // 1228 JP 0x228
+    STEP(0x220, 0x1228);
+    goto L228;
+L222: // 1216 JP 0x216
+    STEP(0x222, 0x1216);
+    goto L216;
+L224: // 24DA CALL 0x4DA
+    STEP(0x224, 0x24DA);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x224;
+    goto L4DA;
+L226: // 122C JP 0x22C
+    STEP(0x226, 0x122C);
+    goto L22C;
+L228: // 00E0 CLS
+    STEP(0x228, 0x00E0);
+    c->pc = 0x228;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x22A) goto dispatch;
+L22A: // 122C JP 0x22C
+    STEP(0x22A, 0x122C);
+    goto L22C;
+L22C: // C11F RND V1, 0x1F
+    STEP(0x22C, 0xC11F);
+    c->pc = 0x22C;
+    predecode(0xC11F, &in);
+    execute(c, &in);
+    if (c->pc != 0x22E) goto dispatch;
+L22E: // 7110 ADD V1, 0x10
+    STEP(0x22E, 0x7110);
+    V[1] += 0x10;
+L230: // C20F RND V2, 0x0F
+    STEP(0x230, 0xC20F);
+    c->pc = 0x230;
+    predecode(0xC20F, &in);
+    execute(c, &in);
+    if (c->pc != 0x232) goto dispatch;
+L232: // 7208 ADD V2, 0x08
+    STEP(0x232, 0x7208);
+    V[2] += 0x08;
+L234: // C303 RND V3, 0x03
+    STEP(0x234, 0xC303);
+    c->pc = 0x234;
+    predecode(0xC303, &in);
+    execute(c, &in);
+    if (c->pc != 0x236) goto dispatch;
+L236: // 8530 LD V5, V3
+    STEP(0x236, 0x8530);
+    V[5] = V[3];
+L238: // 8610 LD V6, V1
+    STEP(0x238, 0x8610);
+    V[6] = V[1];
+L23A: // 8720 LD V7, V2
+    STEP(0x23A, 0x8720);
+    V[7] = V[2];
+L23C: // 8830 LD V8, V3
+    STEP(0x23C, 0x8830);
+    V[8] = V[3];
+L23E: // 4800 SNE V8, 0x00
+    STEP(0x23E, 0x4800);
+    if (V[8] != 0x00) goto L242;
+L240: // 7701 ADD V7, 0x01
+    STEP(0x240, 0x7701);
+    V[7] += 0x01;
+L242: // 4801 SNE V8, 0x01
+    STEP(0x242, 0x4801);
+    if (V[8] != 0x01) goto L246;
+L244: // 77FF ADD V7, 0xFF
+    STEP(0x244, 0x77FF);
+    V[7] += 0xFF;
+L246: // 4802 SNE V8, 0x02
+    STEP(0x246, 0x4802);
+    if (V[8] != 0x02) goto L24A;
+L248: // 7601 ADD V6, 0x01
+    STEP(0x248, 0x7601);
+    V[6] += 0x01;
+L24A: // 4803 SNE V8, 0x03
+    STEP(0x24A, 0x4803);
+    if (V[8] != 0x03) goto L24E;
+L24C: // 76FF ADD V6, 0xFF
+    STEP(0x24C, 0x76FF);
+    V[6] += 0xFF;
+L24E: // A54C LD I, 0x54C
+    STEP(0x24E, 0xA54C);
+    c->I = 0x54C;
+L250: // D121 DRW V1, V2, 1
+    STEP(0x250, 0xD121);
+    c->pc = 0x250;
+    predecode(0xD121, &in);
+    execute(c, &in);
+    if (c->pc != 0x252) goto dispatch;
+L252: // D671 DRW V6, V7, 1
+    STEP(0x252, 0xD671);
+    c->pc = 0x252;
+    predecode(0xD671, &in);
+    execute(c, &in);
+    if (c->pc != 0x254) goto dispatch;
+L254: // 64F0 LD V4, 0xF0
+    STEP(0x254, 0x64F0);
+    V[4] = 0xF0;
+L256: // 69F1 LD V9, 0xF1
+    STEP(0x256, 0x69F1);
+    V[9] = 0xF1;
+L258: // A800 LD I, 0x800
+    STEP(0x258, 0xA800);
+    c->I = 0x800;
+L25A: // F41E ADD I, V4
+    STEP(0x25A, 0xF41E);
+    c->I += V[4];
+L25C: // 8030 LD V0, V3
+    STEP(0x25C, 0x8030);
+    V[0] = V[3];
+L25E: // F055 LD [I], V0
+    STEP(0x25E, 0xF055);
+    c->pc = 0x25E;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x260) goto dispatch;
+L260: // 7401 ADD V4, 0x01
+    STEP(0x260, 0x7401);
+    V[4] += 0x01;
+L262: // A800 LD I, 0x800
+    STEP(0x262, 0xA800);
+    c->I = 0x800;
+L264: // F41E ADD I, V4
+    STEP(0x264, 0xF41E);
+    c->I += V[4];
+L266: // 6001 LD V0, 0x01
+    STEP(0x266, 0x6001);
+    V[0] = 0x01;
+L268: // F055 LD [I], V0
+    STEP(0x268, 0xF055);
+    c->pc = 0x268;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x26A) goto dispatch;
+L26A: // 2522 CALL 0x522
+    STEP(0x26A, 0x2522);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x26A;
+    goto L522;
+L26C: // 6A00 LD VA, 0x00
+    STEP(0x26C, 0x6A00);
+    V[10] = 0x00;
+L26E: // 7A00 ADD VA, 0x00
+    STEP(0x26E, 0x7A00);
+    V[10] += 0x00;
+L270: // F007 LD V0, DT
+    STEP(0x270, 0xF007);
+    V[0] = c->dt;
+L272: // 3000 SE V0, 0x00
+    STEP(0x272, 0x3000);
+    if (V[0] == 0x00) goto L276;
+L274: // 129C JP 0x29C
+    STEP(0x274, 0x129C);
+    goto L29C;
+L276: // 3D00 SE VD, 0x00
+    STEP(0x276, 0x3D00);
+    if (V[13] == 0x00) goto L27A;
+L278: // 1294 JP 0x294
+    STEP(0x278, 0x1294);
+    goto L294;
+L27A: // 6000 LD V0, 0x00
+    STEP(0x27A, 0x6000);
+    V[0] = 0x00;
+L27C: // F029 LD F, V0
+    STEP(0x27C, 0xF029);
+    c->I = V[0] * 5;
+L27E: // DBC5 DRW VB, VC, 5
+    STEP(0x27E, 0xDBC5);
+    c->pc = 0x27E;
+    predecode(0xDBC5, &in);
+    execute(c, &in);
+    if (c->pc != 0x280) goto dispatch;
+L280: // 3F01 SE VF, 0x01
+    STEP(0x280, 0x3F01);
+    if (V[15] == 0x01) goto L284;
+L282: // 128C JP 0x28C
+    STEP(0x282, 0x128C);
+    goto L28C;
+L284: // DBC5 DRW VB, VC, 5
+    STEP(0x284, 0xDBC5);
+    c->pc = 0x284;
+    predecode(0xDBC5, &in);
+    execute(c, &in);
+    if (c->pc != 0x286) goto dispatch;
+L286: // 2522 CALL 0x522
+    STEP(0x286, 0x2522);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x286;
+    goto L522;
+L288: // F015 LD DT, V0
+    STEP(0x288, 0xF015);
+    c->dt = V[0];
+L28A: // 129C JP 0x29C
+    STEP(0x28A, 0x129C);
+    goto L29C;
+L28C: // FE15 LD DT, VE
+    STEP(0x28C, 0xFE15);
+    c->dt = V[14];
+L28E: // 6D01 LD VD, 0x01
+    STEP(0x28E, 0x6D01);
+    V[13] = 0x01;
+L290: // 6E00 LD VE, 0x00
+    STEP(0x290, 0x6E00);
+    V[14] = 0x00;
+L292: // 129C JP 0x29C
+    STEP(0x292, 0x129C);
+    goto L29C;
+L294: // 80E0 LD V0, VE
+    STEP(0x294, 0x80E0);
+    V[0] = V[14];
+L296: // F029 LD F, V0
+    STEP(0x296, 0xF029);
+    c->I = V[0] * 5;
+L298: // DBC5 DRW VB, VC, 5
+    STEP(0x298, 0xDBC5);
+    c->pc = 0x298;
+    predecode(0xDBC5, &in);
+    execute(c, &in);
+    if (c->pc != 0x29A) goto dispatch;
+L29A: // 2522 CALL 0x522
+    STEP(0x29A, 0x2522);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x29A;
+    goto L522;
+L29C: // 6003 LD V0, 0x03
+    STEP(0x29C, 0x6003);
+    V[0] = 0x03;
+L29E: // E0A1 SKNP V0
+    STEP(0x29E, 0xE0A1);
+    c->pc = 0x29E;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A0) goto dispatch;
+L2A0: // 6300 LD V3, 0x00
+    STEP(0x2A0, 0x6300);
+    V[3] = 0x00;
+L2A2: // 6006 LD V0, 0x06
+    STEP(0x2A2, 0x6006);
+    V[0] = 0x06;
+L2A4: // E0A1 SKNP V0
+    STEP(0x2A4, 0xE0A1);
+    c->pc = 0x2A4;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A6) goto dispatch;
+L2A6: // 6301 LD V3, 0x01
+    STEP(0x2A6, 0x6301);
+    V[3] = 0x01;
+L2A8: // 6007 LD V0, 0x07
+    STEP(0x2A8, 0x6007);
+    V[0] = 0x07;
+L2AA: // E0A1 SKNP V0
+    STEP(0x2AA, 0xE0A1);
+    c->pc = 0x2AA;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2AC) goto dispatch;
+L2AC: // 6302 LD V3, 0x02
+    STEP(0x2AC, 0x6302);
+    V[3] = 0x02;
+L2AE: // 6008 LD V0, 0x08
+    STEP(0x2AE, 0x6008);
+    V[0] = 0x08;
+L2B0: // E0A1 SKNP V0
+    STEP(0x2B0, 0xE0A1);
+    c->pc = 0x2B0;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2B2) goto dispatch;
+L2B2: // 6303 LD V3, 0x03
+    STEP(0x2B2, 0x6303);
+    V[3] = 0x03;
+L2B4: // 4300 SNE V3, 0x00
+    STEP(0x2B4, 0x4300);
+    if (V[3] != 0x00) goto L2B8;
+L2B6: // 72FF ADD V2, 0xFF
+    STEP(0x2B6, 0x72FF);
+    V[2] += 0xFF;
+L2B8: // 4301 SNE V3, 0x01
+    STEP(0x2B8, 0x4301);
+    if (V[3] != 0x01) goto L2BC;
+L2BA: // 7201 ADD V2, 0x01
+    STEP(0x2BA, 0x7201);
+    V[2] += 0x01;
+L2BC: // 4302 SNE V3, 0x02
+    STEP(0x2BC, 0x4302);
+    if (V[3] != 0x02) goto L2C0;
+L2BE: // 71FF ADD V1, 0xFF
+    STEP(0x2BE, 0x71FF);
+    V[1] += 0xFF;
+L2C0: // 4303 SNE V3, 0x03
+    STEP(0x2C0, 0x4303);
+    if (V[3] != 0x03) goto L2C4;
+L2C2: // 7101 ADD V1, 0x01
+    STEP(0x2C2, 0x7101);
+    V[1] += 0x01;
+L2C4: // A54C LD I, 0x54C
+    STEP(0x2C4, 0xA54C);
+    c->I = 0x54C;
+L2C6: // D121 DRW V1, V2, 1
+    STEP(0x2C6, 0xD121);
+    c->pc = 0x2C6;
+    predecode(0xD121, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C8) goto dispatch;
+L2C8: // 3F01 SE VF, 0x01
+    STEP(0x2C8, 0x3F01);
+    if (V[15] == 0x01) goto L2CC;
+L2CA: // 1324 JP 0x324
+    STEP(0x2CA, 0x1324);
+    goto L324;
+L2CC: // 3D01 SE VD, 0x01
+    STEP(0x2CC, 0x3D01);
+    if (V[13] == 0x01) goto L2D0;
+L2CE: // 1388 JP 0x388
+    STEP(0x2CE, 0x1388);
+    goto L388;
+L2D0: // 603F LD V0, 0x3F
+    STEP(0x2D0, 0x603F);
+    V[0] = 0x3F;
+L2D2: // 8102 AND V1, V0
+    STEP(0x2D2, 0x8102);
+    V[1] &= V[0];
+L2D4: // 601F LD V0, 0x1F
+    STEP(0x2D4, 0x601F);
+    V[0] = 0x1F;
+L2D6: // 8202 AND V2, V0
+    STEP(0x2D6, 0x8202);
+    V[2] &= V[0];
+L2D8: // 80B0 LD V0, VB
+    STEP(0x2D8, 0x80B0);
+    V[0] = V[11];
+L2DA: // 8017 SUBN V0, V1
+    STEP(0x2DA, 0x8017);
+    V[15] = V[1] > V[0];
+    V[0] = V[1] - V[0];
+L2DC: // 3F01 SE VF, 0x01
+    STEP(0x2DC, 0x3F01);
+    if (V[15] == 0x01) goto L2E0;
+L2DE: // 1388 JP 0x388
+    STEP(0x2DE, 0x1388);
+    goto L388;
+L2E0: // 80B0 LD V0, VB
+    STEP(0x2E0, 0x80B0);
+    V[0] = V[11];
+L2E2: // 7003 ADD V0, 0x03
+    STEP(0x2E2, 0x7003);
+    V[0] += 0x03;
+L2E4: // 8015 SUB V0, V1
+    STEP(0x2E4, 0x8015);
+    V[15] = V[0] > V[1];
+    V[0] -= V[1];
+L2E6: // 3F01 SE VF, 0x01
+    STEP(0x2E6, 0x3F01);
+    if (V[15] == 0x01) goto L2EA;
+L2E8: // 1388 JP 0x388
+    STEP(0x2E8, 0x1388);
+    goto L388;
+L2EA: // 80C0 LD V0, VC
+    STEP(0x2EA, 0x80C0);
+    V[0] = V[12];
+L2EC: // 8027 SUBN V0, V2
+    STEP(0x2EC, 0x8027);
+    V[15] = V[2] > V[0];
+    V[0] = V[2] - V[0];
+L2EE: // 3F01 SE VF, 0x01
+    STEP(0x2EE, 0x3F01);
+    if (V[15] == 0x01) goto L2F2;
+L2F0: // 1388 JP 0x388
+    STEP(0x2F0, 0x1388);
+    goto L388;
+L2F2: // 80C0 LD V0, VC
+    STEP(0x2F2, 0x80C0);
+    V[0] = V[12];
+L2F4: // 7004 ADD V0, 0x04
+    STEP(0x2F4, 0x7004);
+    V[0] += 0x04;
+L2F6: // 8025 SUB V0, V2
+    STEP(0x2F6, 0x8025);
+    V[15] = V[0] > V[2];
+    V[0] -= V[2];
+L2F8: // 3F01 SE VF, 0x01
+    STEP(0x2F8, 0x3F01);
+    if (V[15] == 0x01) goto L2FC;
+L2FA: // 1388 JP 0x388
+    STEP(0x2FA, 0x1388);
+    goto L388;
+L2FC: // 6004 LD V0, 0x04
+    STEP(0x2FC, 0x6004);
+    V[0] = 0x04;
+L2FE: // F018 LD ST, V0
+    STEP(0x2FE, 0xF018);
+    c->st = V[0];
+L300: // CE07 RND VE, 0x07
+    STEP(0x300, 0xCE07);
+    c->pc = 0x300;
+    predecode(0xCE07, &in);
+    execute(c, &in);
+    if (c->pc != 0x302) goto dispatch;
+L302: // 7E02 ADD VE, 0x02
+    STEP(0x302, 0x7E02);
+    V[14] += 0x02;
+L304: // 8AE4 ADD VA, VE
+    STEP(0x304, 0x8AE4);
+    V[15] = V[10] + V[14] > 0xFF;
+    V[10] += V[14];
+L306: // A54C LD I, 0x54C
+    STEP(0x306, 0xA54C);
+    c->I = 0x54C;
+L308: // D121 DRW V1, V2, 1
+    STEP(0x308, 0xD121);
+    c->pc = 0x308;
+    predecode(0xD121, &in);
+    execute(c, &in);
+    if (c->pc != 0x30A) goto dispatch;
+L30A: // 6000 LD V0, 0x00
+    STEP(0x30A, 0x6000);
+    V[0] = 0x00;
+L30C: // F029 LD F, V0
+    STEP(0x30C, 0xF029);
+    c->I = V[0] * 5;
+L30E: // DBC5 DRW VB, VC, 5
+    STEP(0x30E, 0xDBC5);
+    c->pc = 0x30E;
+    predecode(0xDBC5, &in);
+    execute(c, &in);
+    if (c->pc != 0x310) goto dispatch;
+L310: // 80E0 LD V0, VE
+    STEP(0x310, 0x80E0);
+    V[0] = V[14];
+L312: // F029 LD F, V0
+    STEP(0x312, 0xF029);
+    c->I = V[0] * 5;
+L314: // DBC5 DRW VB, VC, 5
+    STEP(0x314, 0xDBC5);
+    c->pc = 0x314;
+    predecode(0xDBC5, &in);
+    execute(c, &in);
+    if (c->pc != 0x316) goto dispatch;
+L316: // 6030 LD V0, 0x30
+    STEP(0x316, 0x6030);
+    V[0] = 0x30;
+L318: // F015 LD DT, V0
+    STEP(0x318, 0xF015);
+    c->dt = V[0];
+L31A: // F007 LD V0, DT
+    STEP(0x31A, 0xF007);
+    V[0] = c->dt;
+L31C: // 3000 SE V0, 0x00
+    STEP(0x31C, 0x3000);
+    if (V[0] == 0x00) goto L320;
+L31E: // 131A JP 0x31A
+    STEP(0x31E, 0x131A);
+    goto L31A;
+L320: // A54C LD I, 0x54C
+    STEP(0x320, 0xA54C);
+    c->I = 0x54C;
+L322: // D121 DRW V1, V2, 1
+    STEP(0x322, 0xD121);
+    c->pc = 0x322;
+    predecode(0xD121, &in);
+    execute(c, &in);
+    if (c->pc != 0x324) goto dispatch;
+L324: // 9350 SNE V3, V5
+    STEP(0x324, 0x9350);
+    if (V[3] != V[5]) goto L328;
+L326: // 133E JP 0x33E
+    STEP(0x326, 0x133E);
+    goto L33E;
+L328: // 7401 ADD V4, 0x01
+    STEP(0x328, 0x7401);
+    V[4] += 0x01;
+L32A: // A800 LD I, 0x800
+    STEP(0x32A, 0xA800);
+    c->I = 0x800;
+L32C: // F41E ADD I, V4
+    STEP(0x32C, 0xF41E);
+    c->I += V[4];
+L32E: // 8030 LD V0, V3
+    STEP(0x32E, 0x8030);
+    V[0] = V[3];
+L330: // F055 LD [I], V0
+    STEP(0x330, 0xF055);
+    c->pc = 0x330;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x332) goto dispatch;
+L332: // 7401 ADD V4, 0x01
+    STEP(0x332, 0x7401);
+    V[4] += 0x01;
+L334: // A800 LD I, 0x800
+    STEP(0x334, 0xA800);
+    c->I = 0x800;
+L336: // F41E ADD I, V4
+    STEP(0x336, 0xF41E);
+    c->I += V[4];
+L338: // 6000 LD V0, 0x00
+    STEP(0x338, 0x6000);
+    V[0] = 0x00;
+L33A: // F055 LD [I], V0
+    STEP(0x33A, 0xF055);
+    c->pc = 0x33A;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x33C) goto dispatch;
+L33C: // 8530 LD V5, V3
+    STEP(0x33C, 0x8530);
+    V[5] = V[3];
+L33E: // A800 LD I, 0x800
+    STEP(0x33E, 0xA800);
+    c->I = 0x800;
+L340: // F41E ADD I, V4
+    STEP(0x340, 0xF41E);
+    c->I += V[4];
+L342: // F065 LD V0, [I]
+    STEP(0x342, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L344: // 7001 ADD V0, 0x01
+    STEP(0x344, 0x7001);
+    V[0] += 0x01;
+L346: // F055 LD [I], V0
+    STEP(0x346, 0xF055);
+    c->pc = 0x346;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x348) goto dispatch;
+L348: // 4A00 SNE VA, 0x00
+    STEP(0x348, 0x4A00);
+    if (V[10] != 0x00) goto L34C;
+L34A: // 1358 JP 0x358
+    STEP(0x34A, 0x1358);
+    goto L358;
+L34C: // 600C LD V0, 0x0C
+    STEP(0x34C, 0x600C);
+    V[0] = 0x0C;
+L34E: // 70FF ADD V0, 0xFF
+    STEP(0x34E, 0x70FF);
+    V[0] += 0xFF;
+L350: // 3000 SE V0, 0x00
+    STEP(0x350, 0x3000);
+    if (V[0] == 0x00) goto L354;
+L352: // 134E JP 0x34E
+    STEP(0x352, 0x134E);
+    goto L34E;
+L354: // 7AFF ADD VA, 0xFF
+    STEP(0x354, 0x7AFF);
+    V[10] += 0xFF;
+L356: // 1270 JP 0x270
+    STEP(0x356, 0x1270);
+    goto L270;
+L358: // A54C LD I, 0x54C
+    STEP(0x358, 0xA54C);
+    c->I = 0x54C;
+L35A: // D671 DRW V6, V7, 1
+    STEP(0x35A, 0xD671);
+    c->pc = 0x35A;
+    predecode(0xD671, &in);
+    execute(c, &in);
+    if (c->pc != 0x35C) goto dispatch;
+L35C: // 4800 SNE V8, 0x00
+    STEP(0x35C, 0x4800);
+    if (V[8] != 0x00) goto L360;
+L35E: // 77FF ADD V7, 0xFF
+    STEP(0x35E, 0x77FF);
+    V[7] += 0xFF;
+L360: // 4801 SNE V8, 0x01
+    STEP(0x360, 0x4801);
+    if (V[8] != 0x01) goto L364;
+L362: // 7701 ADD V7, 0x01
+    STEP(0x362, 0x7701);
+    V[7] += 0x01;
+L364: // 4802 SNE V8, 0x02
+    STEP(0x364, 0x4802);
+    if (V[8] != 0x02) goto L368;
+L366: // 76FF ADD V6, 0xFF
+    STEP(0x366, 0x76FF);
+    V[6] += 0xFF;
+L368: // 4803 SNE V8, 0x03
+    STEP(0x368, 0x4803);
+    if (V[8] != 0x03) goto L36C;
+L36A: // 7601 ADD V6, 0x01
+    STEP(0x36A, 0x7601);
+    V[6] += 0x01;
+L36C: // A800 LD I, 0x800
+    STEP(0x36C, 0xA800);
+    c->I = 0x800;
+L36E: // F91E ADD I, V9
+    STEP(0x36E, 0xF91E);
+    c->I += V[9];
+L370: // F065 LD V0, [I]
+    STEP(0x370, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L372: // 70FF ADD V0, 0xFF
+    STEP(0x372, 0x70FF);
+    V[0] += 0xFF;
+L374: // F055 LD [I], V0
+    STEP(0x374, 0xF055);
+    c->pc = 0x374;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x376) goto dispatch;
+L376: // 3000 SE V0, 0x00
+    STEP(0x376, 0x3000);
+    if (V[0] == 0x00) goto L37A;
+L378: // 1270 JP 0x270
+    STEP(0x378, 0x1270);
+    goto L270;
+L37A: // 7901 ADD V9, 0x01
+    STEP(0x37A, 0x7901);
+    V[9] += 0x01;
+L37C: // A800 LD I, 0x800
+    STEP(0x37C, 0xA800);
+    c->I = 0x800;
+L37E: // F91E ADD I, V9
+    STEP(0x37E, 0xF91E);
+    c->I += V[9];
+L380: // F065 LD V0, [I]
+    STEP(0x380, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L382: // 8800 LD V8, V0
+    STEP(0x382, 0x8800);
+    V[8] = V[0];
+L384: // 7901 ADD V9, 0x01
+    STEP(0x384, 0x7901);
+    V[9] += 0x01;
+L386: // 1270 JP 0x270
+    STEP(0x386, 0x1270);
+    goto L270;
+L388: // 600D LD V0, 0x0D
+    STEP(0x388, 0x600D);
+    V[0] = 0x0D;
+L38A: // F018 LD ST, V0
+    STEP(0x38A, 0xF018);
+    c->st = V[0];
+L38C: // 600B LD V0, 0x0B
+    STEP(0x38C, 0x600B);
+    V[0] = 0x0B;
+L38E: // E09E SKP V0
+    STEP(0x38E, 0xE09E);
+    c->pc = 0x38E;
+    predecode(0xE09E, &in);
+    execute(c, &in);
+    if (c->pc != 0x390) goto dispatch;
+L390: // 138E JP 0x38E
+    STEP(0x390, 0x138E);
+    goto L38E;
+L392: // 6B01 LD VB, 0x01
+    STEP(0x392, 0x6B01);
+    V[11] = 0x01;
+L394: // 6C00 LD VC, 0x00
+    STEP(0x394, 0x6C00);
+    V[12] = 0x00;
+L396: // 6D00 LD VD, 0x00
+    STEP(0x396, 0x6D00);
+    V[13] = 0x00;
+L398: // 7B01 ADD VB, 0x01
+    STEP(0x398, 0x7B01);
+    V[11] += 0x01;
+L39A: // 3B0A SE VB, 0x0A
+    STEP(0x39A, 0x3B0A);
+    if (V[11] == 0x0A) goto L39E;
+L39C: // 13AA JP 0x3AA
+    STEP(0x39C, 0x13AA);
+    goto L3AA;
+L39E: // 6B00 LD VB, 0x00
+    STEP(0x39E, 0x6B00);
+    V[11] = 0x00;
+L3A0: // 7C01 ADD VC, 0x01
+    STEP(0x3A0, 0x7C01);
+    V[12] += 0x01;
+L3A2: // 3C0A SE VC, 0x0A
+    STEP(0x3A2, 0x3C0A);
+    if (V[12] == 0x0A) goto L3A6;
+L3A4: // 13AA JP 0x3AA
+    STEP(0x3A4, 0x13AA);
+    goto L3AA;
+L3A6: // 6C00 LD VC, 0x00
+    STEP(0x3A6, 0x6C00);
+    V[12] = 0x00;
+L3A8: // 7D01 ADD VD, 0x01
+    STEP(0x3A8, 0x7D01);
+    V[13] += 0x01;
+L3AA: // A54C LD I, 0x54C
+    STEP(0x3AA, 0xA54C);
+    c->I = 0x54C;
+L3AC: // D671 DRW V6, V7, 1
+    STEP(0x3AC, 0xD671);
+    c->pc = 0x3AC;
+    predecode(0xD671, &in);
+    execute(c, &in);
+    if (c->pc != 0x3AE) goto dispatch;
+L3AE: // 4800 SNE V8, 0x00
+    STEP(0x3AE, 0x4800);
+    if (V[8] != 0x00) goto L3B2;
+L3B0: // 77FF ADD V7, 0xFF
+    STEP(0x3B0, 0x77FF);
+    V[7] += 0xFF;
+L3B2: // 4801 SNE V8, 0x01
+    STEP(0x3B2, 0x4801);
+    if (V[8] != 0x01) goto L3B6;
+L3B4: // 7701 ADD V7, 0x01
+    STEP(0x3B4, 0x7701);
+    V[7] += 0x01;
+L3B6: // 4802 SNE V8, 0x02
+    STEP(0x3B6, 0x4802);
+    if (V[8] != 0x02) goto L3BA;
+L3B8: // 76FF ADD V6, 0xFF
+    STEP(0x3B8, 0x76FF);
+    V[6] += 0xFF;
+L3BA: // 4803 SNE V8, 0x03
+    STEP(0x3BA, 0x4803);
+    if (V[8] != 0x03) goto L3BE;
+L3BC: // 7601 ADD V6, 0x01
+    STEP(0x3BC, 0x7601);
+    V[6] += 0x01;
+L3BE: // A800 LD I, 0x800
+    STEP(0x3BE, 0xA800);
+    c->I = 0x800;
+L3C0: // F91E ADD I, V9
+    STEP(0x3C0, 0xF91E);
+    c->I += V[9];
+L3C2: // F065 LD V0, [I]
+    STEP(0x3C2, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L3C4: // 70FF ADD V0, 0xFF
+    STEP(0x3C4, 0x70FF);
+    V[0] += 0xFF;
+L3C6: // F055 LD [I], V0
+    STEP(0x3C6, 0xF055);
+    c->pc = 0x3C6;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x3C8) goto dispatch;
+L3C8: // 3000 SE V0, 0x00
+    STEP(0x3C8, 0x3000);
+    if (V[0] == 0x00) goto L3CC;
+L3CA: // 1398 JP 0x398
+    STEP(0x3CA, 0x1398);
+    goto L398;
+L3CC: // 9940 SNE V9, V4
+    STEP(0x3CC, 0x9940);
+    if (V[9] != V[4]) goto L3D0;
+L3CE: // 13DE JP 0x3DE
+    STEP(0x3CE, 0x13DE);
+    goto L3DE;
+L3D0: // 7901 ADD V9, 0x01
+    STEP(0x3D0, 0x7901);
+    V[9] += 0x01;
+L3D2: // A800 LD I, 0x800
+    STEP(0x3D2, 0xA800);
+    c->I = 0x800;
+L3D4: // F91E ADD I, V9
+    STEP(0x3D4, 0xF91E);
+    c->I += V[9];
+L3D6: // F065 LD V0, [I]
+    STEP(0x3D6, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L3D8: // 8800 LD V8, V0
+    STEP(0x3D8, 0x8800);
+    V[8] = V[0];
+L3DA: // 7901 ADD V9, 0x01
+    STEP(0x3DA, 0x7901);
+    V[9] += 0x01;
+L3DC: // 1398 JP 0x398
+    STEP(0x3DC, 0x1398);
+    goto L398;
+L3DE: // 00E0 CLS
+    STEP(0x3DE, 0x00E0);
+    c->pc = 0x3DE;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x3E0) goto dispatch;
+L3E0: // 6611 LD V6, 0x11
+    STEP(0x3E0, 0x6611);
+    V[6] = 0x11;
+L3E2: // 6709 LD V7, 0x09
+    STEP(0x3E2, 0x6709);
+    V[7] = 0x09;
+L3E4: // 682F LD V8, 0x2F
+    STEP(0x3E4, 0x682F);
+    V[8] = 0x2F;
+L3E6: // 6917 LD V9, 0x17
+    STEP(0x3E6, 0x6917);
+    V[9] = 0x17;
+L3E8: // A552 LD I, 0x552
+    STEP(0x3E8, 0xA552);
+    c->I = 0x552;
+L3EA: // D67E DRW V6, V7, 14
+    STEP(0x3EA, 0xD67E);
+    c->pc = 0x3EA;
+    predecode(0xD67E, &in);
+    execute(c, &in);
+    if (c->pc != 0x3EC) goto dispatch;
+L3EC: // D87E DRW V8, V7, 14
+    STEP(0x3EC, 0xD87E);
+    c->pc = 0x3EC;
+    predecode(0xD87E, &in);
+    execute(c, &in);
+    if (c->pc != 0x3EE) goto dispatch;
+L3EE: // 77FF ADD V7, 0xFF
+    STEP(0x3EE, 0x77FF);
+    V[7] += 0xFF;
+L3F0: // A54E LD I, 0x54E
+    STEP(0x3F0, 0xA54E);
+    c->I = 0x54E;
+L3F2: // D671 DRW V6, V7, 1
+    STEP(0x3F2, 0xD671);
+    c->pc = 0x3F2;
+    predecode(0xD671, &in);
+    execute(c, &in);
+    if (c->pc != 0x3F4) goto dispatch;
+L3F4: // D691 DRW V6, V9, 1
+    STEP(0x3F4, 0xD691);
+    c->pc = 0x3F4;
+    predecode(0xD691, &in);
+    execute(c, &in);
+    if (c->pc != 0x3F6) goto dispatch;
+L3F6: // 7608 ADD V6, 0x08
+    STEP(0x3F6, 0x7608);
+    V[6] += 0x08;
+L3F8: // D671 DRW V6, V7, 1
+    STEP(0x3F8, 0xD671);
+    c->pc = 0x3F8;
+    predecode(0xD671, &in);
+    execute(c, &in);
+    if (c->pc != 0x3FA) goto dispatch;
+L3FA: // D691 DRW V6, V9, 1
+    STEP(0x3FA, 0xD691);
+    c->pc = 0x3FA;
+    predecode(0xD691, &in);
+    execute(c, &in);
+    if (c->pc != 0x3FC) goto dispatch;
+L3FC: // 7608 ADD V6, 0x08
+    STEP(0x3FC, 0x7608);
+    V[6] += 0x08;
+L3FE: // D671 DRW V6, V7, 1
+    STEP(0x3FE, 0xD671);
+    c->pc = 0x3FE;
+    predecode(0xD671, &in);
+    execute(c, &in);
+    if (c->pc != 0x400) goto dispatch;
+L400: // D691 DRW V6, V9, 1
+    STEP(0x400, 0xD691);
+    c->pc = 0x400;
+    predecode(0xD691, &in);
+    execute(c, &in);
+    if (c->pc != 0x402) goto dispatch;
+L402: // 7608 ADD V6, 0x08
+    STEP(0x402, 0x7608);
+    V[6] += 0x08;
+L404: // A550 LD I, 0x550
+    STEP(0x404, 0xA550);
+    c->I = 0x550;
+L406: // D671 DRW V6, V7, 1
+    STEP(0x406, 0xD671);
+    c->pc = 0x406;
+    predecode(0xD671, &in);
+    execute(c, &in);
+    if (c->pc != 0x408) goto dispatch;
+L408: // D691 DRW V6, V9, 1
+    STEP(0x408, 0xD691);
+    c->pc = 0x408;
+    predecode(0xD691, &in);
+    execute(c, &in);
+    if (c->pc != 0x40A) goto dispatch;
+L40A: // A59E LD I, 0x59E
+    STEP(0x40A, 0xA59E);
+    c->I = 0x59E;
+L40C: // 6613 LD V6, 0x13
+    STEP(0x40C, 0x6613);
+    V[6] = 0x13;
+L40E: // 6711 LD V7, 0x11
+    STEP(0x40E, 0x6711);
+    V[7] = 0x11;
+L410: // 249A CALL 0x49A
+    STEP(0x410, 0x249A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x410;
+    goto L49A;
+L412: // A5AE LD I, 0x5AE
+    STEP(0x412, 0xA5AE);
+    c->I = 0x5AE;
+L414: // F365 LD V3, [I]
+    STEP(0x414, 0xF365);
+    for (int i = 0; i <= 3; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L416: // 93D0 SNE V3, VD
+    STEP(0x416, 0x93D0);
+    if (V[3] != V[13]) goto L41A;
+L418: // 1424 JP 0x424
+    STEP(0x418, 0x1424);
+    goto L424;
+L41A: // 8030 LD V0, V3
+    STEP(0x41A, 0x8030);
+    V[0] = V[3];
+L41C: // 80D5 SUB V0, VD
+    STEP(0x41C, 0x80D5);
+    V[15] = V[0] > V[13];
+    V[0] -= V[13];
+L41E: // 3F01 SE VF, 0x01
+    STEP(0x41E, 0x3F01);
+    if (V[15] == 0x01) goto L422;
+L420: // 143A JP 0x43A
+    STEP(0x420, 0x143A);
+    goto L43A;
+L422: // 1444 JP 0x444
+    STEP(0x422, 0x1444);
+    goto L444;
+L424: // 92C0 SNE V2, VC
+    STEP(0x424, 0x92C0);
+    if (V[2] != V[12]) goto L428;
+L426: // 1432 JP 0x432
+    STEP(0x426, 0x1432);
+    goto L432;
+L428: // 8020 LD V0, V2
+    STEP(0x428, 0x8020);
+    V[0] = V[2];
+L42A: // 80C5 SUB V0, VC
+    STEP(0x42A, 0x80C5);
+    V[15] = V[0] > V[12];
+    V[0] -= V[12];
+L42C: // 3F01 SE VF, 0x01
+    STEP(0x42C, 0x3F01);
+    if (V[15] == 0x01) goto L430;
+L42E: // 143A JP 0x43A
+    STEP(0x42E, 0x143A);
+    goto L43A;
+L430: // 1444 JP 0x444
+    STEP(0x430, 0x1444);
+    goto L444;
+L432: // 8010 LD V0, V1
+    STEP(0x432, 0x8010);
+    V[0] = V[1];
+L434: // 80B5 SUB V0, VB
+    STEP(0x434, 0x80B5);
+    V[15] = V[0] > V[11];
+    V[0] -= V[11];
+L436: // 3F00 SE VF, 0x00
+    STEP(0x436, 0x3F00);
+    if (V[15] == 0x00) goto L43A;
+L438: // 1444 JP 0x444
+    STEP(0x438, 0x1444);
+    goto L444;
+L43A: // A5AE LD I, 0x5AE
+    STEP(0x43A, 0xA5AE);
+    c->I = 0x5AE;
+L43C: // 83D0 LD V3, VD
+    STEP(0x43C, 0x83D0);
+    V[3] = V[13];
+L43E: // 82C0 LD V2, VC
+    STEP(0x43E, 0x82C0);
+    V[2] = V[12];
+L440: // 81B0 LD V1, VB
+    STEP(0x440, 0x81B0);
+    V[1] = V[11];
+L442: // F355 LD [I], V3
+    STEP(0x442, 0xF355);
+    c->pc = 0x442;
+    predecode(0xF355, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x444) goto dispatch;
+L444: // A5AE LD I, 0x5AE
+    STEP(0x444, 0xA5AE);
+    c->I = 0x5AE;
+L446: // F365 LD V3, [I]
+    STEP(0x446, 0xF365);
+    for (int i = 0; i <= 3; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L448: // 6613 LD V6, 0x13
+    STEP(0x448, 0x6613);
+    V[6] = 0x13;
+L44A: // 77F9 ADD V7, 0xF9
+    STEP(0x44A, 0x77F9);
+    V[7] += 0xF9;
+L44C: // 8D30 LD VD, V3
+    STEP(0x44C, 0x8D30);
+    V[13] = V[3];
+L44E: // 8C20 LD VC, V2
+    STEP(0x44E, 0x8C20);
+    V[12] = V[2];
+L450: // 8B10 LD VB, V1
+    STEP(0x450, 0x8B10);
+    V[11] = V[1];
+L452: // A5A4 LD I, 0x5A4
+    STEP(0x452, 0xA5A4);
+    c->I = 0x5A4;
+L454: // 249A CALL 0x49A
+    STEP(0x454, 0x249A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x454;
+    goto L49A;
+L456: // C13F RND V1, 0x3F
+    STEP(0x456, 0xC13F);
+    c->pc = 0x456;
+    predecode(0xC13F, &in);
+    execute(c, &in);
+    if (c->pc != 0x458) goto dispatch;
+L458: // C21F RND V2, 0x1F
+    STEP(0x458, 0xC21F);
+    c->pc = 0x458;
+    predecode(0xC21F, &in);
+    execute(c, &in);
+    if (c->pc != 0x45A) goto dispatch;
+L45A: // 600D LD V0, 0x0D
+    STEP(0x45A, 0x600D);
+    V[0] = 0x0D;
+L45C: // 8015 SUB V0, V1
+    STEP(0x45C, 0x8015);
+    V[15] = V[0] > V[1];
+    V[0] -= V[1];
+L45E: // 3F00 SE VF, 0x00
+    STEP(0x45E, 0x3F00);
+    if (V[15] == 0x00) goto L462;
+L460: // 147C JP 0x47C
+    STEP(0x460, 0x147C);
+    goto L47C;
+L462: // 6030 LD V0, 0x30
+    STEP(0x462, 0x6030);
+    V[0] = 0x30;
+L464: // 8017 SUBN V0, V1
+    STEP(0x464, 0x8017);
+    V[15] = V[1] > V[0];
+    V[0] = V[1] - V[0];
+L466: // 3F00 SE VF, 0x00
+    STEP(0x466, 0x3F00);
+    if (V[15] == 0x00) goto L46A;
+L468: // 147C JP 0x47C
+    STEP(0x468, 0x147C);
+    goto L47C;
+L46A: // 6003 LD V0, 0x03
+    STEP(0x46A, 0x6003);
+    V[0] = 0x03;
+L46C: // 8025 SUB V0, V2
+    STEP(0x46C, 0x8025);
+    V[15] = V[0] > V[2];
+    V[0] -= V[2];
+L46E: // 3F00 SE VF, 0x00
+    STEP(0x46E, 0x3F00);
+    if (V[15] == 0x00) goto L472;
+L470: // 147C JP 0x47C
+    STEP(0x470, 0x147C);
+    goto L47C;
+L472: // 6018 LD V0, 0x18
+    STEP(0x472, 0x6018);
+    V[0] = 0x18;
+L474: // 8027 SUBN V0, V2
+    STEP(0x474, 0x8027);
+    V[15] = V[2] > V[0];
+    V[0] = V[2] - V[0];
+L476: // 3F00 SE VF, 0x00
+    STEP(0x476, 0x3F00);
+    if (V[15] == 0x00) goto L47A;
+L478: // 147C JP 0x47C
+    STEP(0x478, 0x147C);
+    goto L47C;
+L47A: // 1482 JP 0x482
+    STEP(0x47A, 0x1482);
+    goto L482;
+L47C: // C30F RND V3, 0x0F
+    STEP(0x47C, 0xC30F);
+    c->pc = 0x47C;
+    predecode(0xC30F, &in);
+    execute(c, &in);
+    if (c->pc != 0x47E) goto dispatch;
+L47E: // F329 LD F, V3
+    STEP(0x47E, 0xF329);
+    c->I = V[3] * 5;
+L480: // D125 DRW V1, V2, 5
+    STEP(0x480, 0xD125);
+    c->pc = 0x480;
+    predecode(0xD125, &in);
+    execute(c, &in);
+    if (c->pc != 0x482) goto dispatch;
+L482: // 600F LD V0, 0x0F
+    STEP(0x482, 0x600F);
+    V[0] = 0x0F;
+L484: // E0A1 SKNP V0
+    STEP(0x484, 0xE0A1);
+    c->pc = 0x484;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x486) goto dispatch;
+L486: // 1490 JP 0x490
+    STEP(0x486, 0x1490);
+    goto L490;
+L488: // 600E LD V0, 0x0E
+    STEP(0x488, 0x600E);
+    V[0] = 0x0E;
+L48A: // E0A1 SKNP V0
+    STEP(0x48A, 0xE0A1);
+    c->pc = 0x48A;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x48C) goto dispatch;
+L48C: // 1496 JP 0x496
+    STEP(0x48C, 0x1496);
+    goto L496;
+L48E: // 1456 JP 0x456
+    STEP(0x48E, 0x1456);
+    goto L456;
+L490: // 00E0 CLS
+    STEP(0x490, 0x00E0);
+    c->pc = 0x490;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x492) goto dispatch;
+L492: // 24B6 CALL 0x4B6
+    STEP(0x492, 0x24B6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x492;
+    goto L4B6;
+L494: // 122C JP 0x22C
+    STEP(0x494, 0x122C);
+    goto L22C;
+L496: // 00E0 CLS
+    STEP(0x496, 0x00E0);
+    c->pc = 0x496;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x498) goto dispatch;
+L498: // 122C JP 0x22C
+    STEP(0x498, 0x122C);
+    goto L22C;
+L49A: // D675 DRW V6, V7, 5
+    STEP(0x49A, 0xD675);
+    c->pc = 0x49A;
+    predecode(0xD675, &in);
+    execute(c, &in);
+    if (c->pc != 0x49C) goto dispatch;
+L49C: // A5AA LD I, 0x5AA
+    STEP(0x49C, 0xA5AA);
+    c->I = 0x5AA;
+L49E: // 7602 ADD V6, 0x02
+    STEP(0x49E, 0x7602);
+    V[6] += 0x02;
+L4A0: // D674 DRW V6, V7, 4
+    STEP(0x4A0, 0xD674);
+    c->pc = 0x4A0;
+    predecode(0xD674, &in);
+    execute(c, &in);
+    if (c->pc != 0x4A2) goto dispatch;
+L4A2: // FD29 LD F, VD
+    STEP(0x4A2, 0xFD29);
+    c->I = V[13] * 5;
+L4A4: // 760A ADD V6, 0x0A
+    STEP(0x4A4, 0x760A);
+    V[6] += 0x0A;
+L4A6: // D675 DRW V6, V7, 5
+    STEP(0x4A6, 0xD675);
+    c->pc = 0x4A6;
+    predecode(0xD675, &in);
+    execute(c, &in);
+    if (c->pc != 0x4A8) goto dispatch;
+L4A8: // FC29 LD F, VC
+    STEP(0x4A8, 0xFC29);
+    c->I = V[12] * 5;
+L4AA: // 7605 ADD V6, 0x05
+    STEP(0x4AA, 0x7605);
+    V[6] += 0x05;
+L4AC: // D675 DRW V6, V7, 5
+    STEP(0x4AC, 0xD675);
+    c->pc = 0x4AC;
+    predecode(0xD675, &in);
+    execute(c, &in);
+    if (c->pc != 0x4AE) goto dispatch;
+L4AE: // FB29 LD F, VB
+    STEP(0x4AE, 0xFB29);
+    c->I = V[11] * 5;
+L4B0: // 7605 ADD V6, 0x05
+    STEP(0x4B0, 0x7605);
+    V[6] += 0x05;
+L4B2: // D675 DRW V6, V7, 5
+    STEP(0x4B2, 0xD675);
+    c->pc = 0x4B2;
+    predecode(0xD675, &in);
+    execute(c, &in);
+    if (c->pc != 0x4B4) goto dispatch;
+L4B4: // 00EE RET
+    STEP(0x4B4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L4B6: // A54E LD I, 0x54E
+    STEP(0x4B6, 0xA54E);
+    c->I = 0x54E;
+L4B8: // 6100 LD V1, 0x00
+    STEP(0x4B8, 0x6100);
+    V[1] = 0x00;
+L4BA: // 6200 LD V2, 0x00
+    STEP(0x4BA, 0x6200);
+    V[2] = 0x00;
+L4BC: // 661F LD V6, 0x1F
+    STEP(0x4BC, 0x661F);
+    V[6] = 0x1F;
+L4BE: // D121 DRW V1, V2, 1
+    STEP(0x4BE, 0xD121);
+    c->pc = 0x4BE;
+    predecode(0xD121, &in);
+    execute(c, &in);
+    if (c->pc != 0x4C0) goto dispatch;
+L4C0: // D161 DRW V1, V6, 1
+    STEP(0x4C0, 0xD161);
+    c->pc = 0x4C0;
+    predecode(0xD161, &in);
+    execute(c, &in);
+    if (c->pc != 0x4C2) goto dispatch;
+L4C2: // 7108 ADD V1, 0x08
+    STEP(0x4C2, 0x7108);
+    V[1] += 0x08;
+L4C4: // 3140 SE V1, 0x40
+    STEP(0x4C4, 0x3140);
+    if (V[1] == 0x40) goto L4C8;
+L4C6: // 14BE JP 0x4BE
+    STEP(0x4C6, 0x14BE);
+    goto L4BE;
+L4C8: // A552 LD I, 0x552
+    STEP(0x4C8, 0xA552);
+    c->I = 0x552;
+L4CA: // 6201 LD V2, 0x01
+    STEP(0x4CA, 0x6201);
+    V[2] = 0x01;
+L4CC: // 653F LD V5, 0x3F
+    STEP(0x4CC, 0x653F);
+    V[5] = 0x3F;
+L4CE: // D12F DRW V1, V2, 15
+    STEP(0x4CE, 0xD12F);
+    c->pc = 0x4CE;
+    predecode(0xD12F, &in);
+    execute(c, &in);
+    if (c->pc != 0x4D0) goto dispatch;
+L4D0: // D52F DRW V5, V2, 15
+    STEP(0x4D0, 0xD52F);
+    c->pc = 0x4D0;
+    predecode(0xD52F, &in);
+    execute(c, &in);
+    if (c->pc != 0x4D2) goto dispatch;
+L4D2: // 720F ADD V2, 0x0F
+    STEP(0x4D2, 0x720F);
+    V[2] += 0x0F;
+L4D4: // D12F DRW V1, V2, 15
+    STEP(0x4D4, 0xD12F);
+    c->pc = 0x4D4;
+    predecode(0xD12F, &in);
+    execute(c, &in);
+    if (c->pc != 0x4D6) goto dispatch;
+L4D6: // D52F DRW V5, V2, 15
+    STEP(0x4D6, 0xD52F);
+    c->pc = 0x4D6;
+    predecode(0xD52F, &in);
+    execute(c, &in);
+    if (c->pc != 0x4D8) goto dispatch;
+L4D8: // 00EE RET
+    STEP(0x4D8, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L4DA: // 610C LD V1, 0x0C
+    STEP(0x4DA, 0x610C);
+    V[1] = 0x0C;
+L4DC: // 6207 LD V2, 0x07
+    STEP(0x4DC, 0x6207);
+    V[2] = 0x07;
+L4DE: // A562 LD I, 0x562
+    STEP(0x4DE, 0xA562);
+    c->I = 0x562;
+L4E0: // D12A DRW V1, V2, 10
+    STEP(0x4E0, 0xD12A);
+    c->pc = 0x4E0;
+    predecode(0xD12A, &in);
+    execute(c, &in);
+    if (c->pc != 0x4E2) goto dispatch;
+L4E2: // A56C LD I, 0x56C
+    STEP(0x4E2, 0xA56C);
+    c->I = 0x56C;
+L4E4: // 7106 ADD V1, 0x06
+    STEP(0x4E4, 0x7106);
+    V[1] += 0x06;
+L4E6: // D12A DRW V1, V2, 10
+    STEP(0x4E6, 0xD12A);
+    c->pc = 0x4E6;
+    predecode(0xD12A, &in);
+    execute(c, &in);
+    if (c->pc != 0x4E8) goto dispatch;
+L4E8: // A576 LD I, 0x576
+    STEP(0x4E8, 0xA576);
+    c->I = 0x576;
+L4EA: // 7106 ADD V1, 0x06
+    STEP(0x4EA, 0x7106);
+    V[1] += 0x06;
+L4EC: // D12A DRW V1, V2, 10
+    STEP(0x4EC, 0xD12A);
+    c->pc = 0x4EC;
+    predecode(0xD12A, &in);
+    execute(c, &in);
+    if (c->pc != 0x4EE) goto dispatch;
+L4EE: // A56C LD I, 0x56C
+    STEP(0x4EE, 0xA56C);
+    c->I = 0x56C;
+L4F0: // 7106 ADD V1, 0x06
+    STEP(0x4F0, 0x7106);
+    V[1] += 0x06;
+L4F2: // D12A DRW V1, V2, 10
+    STEP(0x4F2, 0xD12A);
+    c->pc = 0x4F2;
+    predecode(0xD12A, &in);
+    execute(c, &in);
+    if (c->pc != 0x4F4) goto dispatch;
+L4F4: // A580 LD I, 0x580
+    STEP(0x4F4, 0xA580);
+    c->I = 0x580;
+L4F6: // 7106 ADD V1, 0x06
+    STEP(0x4F6, 0x7106);
+    V[1] += 0x06;
+L4F8: // D12A DRW V1, V2, 10
+    STEP(0x4F8, 0xD12A);
+    c->pc = 0x4F8;
+    predecode(0xD12A, &in);
+    execute(c, &in);
+    if (c->pc != 0x4FA) goto dispatch;
+L4FA: // A56C LD I, 0x56C
+    STEP(0x4FA, 0xA56C);
+    c->I = 0x56C;
+L4FC: // 7106 ADD V1, 0x06
+    STEP(0x4FC, 0x7106);
+    V[1] += 0x06;
+L4FE: // D12A DRW V1, V2, 10
+    STEP(0x4FE, 0xD12A);
+    c->pc = 0x4FE;
+    predecode(0xD12A, &in);
+    execute(c, &in);
+    if (c->pc != 0x500) goto dispatch;
+L500: // 610E LD V1, 0x0E
+    STEP(0x500, 0x610E);
+    V[1] = 0x0E;
+L502: // 6218 LD V2, 0x18
+    STEP(0x502, 0x6218);
+    V[2] = 0x18;
+L504: // A58A LD I, 0x58A
+    STEP(0x504, 0xA58A);
+    c->I = 0x58A;
+L506: // D123 DRW V1, V2, 3
+    STEP(0x506, 0xD123);
+    c->pc = 0x506;
+    predecode(0xD123, &in);
+    execute(c, &in);
+    if (c->pc != 0x508) goto dispatch;
+L508: // A58E LD I, 0x58E
+    STEP(0x508, 0xA58E);
+    c->I = 0x58E;
+L50A: // 7108 ADD V1, 0x08
+    STEP(0x50A, 0x7108);
+    V[1] += 0x08;
+L50C: // 72FF ADD V2, 0xFF
+    STEP(0x50C, 0x72FF);
+    V[2] += 0xFF;
+L50E: // D124 DRW V1, V2, 4
+    STEP(0x50E, 0xD124);
+    c->pc = 0x50E;
+    predecode(0xD124, &in);
+    execute(c, &in);
+    if (c->pc != 0x510) goto dispatch;
+L510: // 7109 ADD V1, 0x09
+    STEP(0x510, 0x7109);
+    V[1] += 0x09;
+L512: // 72FE ADD V2, 0xFE
+    STEP(0x512, 0x72FE);
+    V[2] += 0xFE;
+L514: // A592 LD I, 0x592
+    STEP(0x514, 0xA592);
+    c->I = 0x592;
+L516: // D126 DRW V1, V2, 6
+    STEP(0x516, 0xD126);
+    c->pc = 0x516;
+    predecode(0xD126, &in);
+    execute(c, &in);
+    if (c->pc != 0x518) goto dispatch;
+L518: // 7106 ADD V1, 0x06
+    STEP(0x518, 0x7106);
+    V[1] += 0x06;
+L51A: // 7201 ADD V2, 0x01
+    STEP(0x51A, 0x7201);
+    V[2] += 0x01;
+L51C: // A598 LD I, 0x598
+    STEP(0x51C, 0xA598);
+    c->I = 0x598;
+L51E: // D125 DRW V1, V2, 5
+    STEP(0x51E, 0xD125);
+    c->pc = 0x51E;
+    predecode(0xD125, &in);
+    execute(c, &in);
+    if (c->pc != 0x520) goto dispatch;
+L520: // 00EE RET
+    STEP(0x520, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L522: // 6DC5 LD VD, 0xC5
+    STEP(0x522, 0x6DC5);
+    V[13] = 0xC5;
+L524: // CB3F RND VB, 0x3F
+    STEP(0x524, 0xCB3F);
+    c->pc = 0x524;
+    predecode(0xCB3F, &in);
+    execute(c, &in);
+    if (c->pc != 0x526) goto dispatch;
+L526: // 8EB0 LD VE, VB
+    STEP(0x526, 0x8EB0);
+    V[14] = V[11];
+L528: // 8ED4 ADD VE, VD
+    STEP(0x528, 0x8ED4);
+    V[15] = V[14] + V[13] > 0xFF;
+    V[14] += V[13];
+L52A: // 4F01 SNE VF, 0x01
+    STEP(0x52A, 0x4F01);
+    if (V[15] != 0x01) goto L52E;
+L52C: // 1524 JP 0x524
+    STEP(0x52C, 0x1524);
+    goto L524;
+L52E: // 7B01 ADD VB, 0x01
+    STEP(0x52E, 0x7B01);
+    V[11] += 0x01;
+L530: // 6DE6 LD VD, 0xE6
+    STEP(0x530, 0x6DE6);
+    V[13] = 0xE6;
+L532: // CC1F RND VC, 0x1F
+    STEP(0x532, 0xCC1F);
+    c->pc = 0x532;
+    predecode(0xCC1F, &in);
+    execute(c, &in);
+    if (c->pc != 0x534) goto dispatch;
+L534: // 8EC0 LD VE, VC
+    STEP(0x534, 0x8EC0);
+    V[14] = V[12];
+L536: // 8ED4 ADD VE, VD
+    STEP(0x536, 0x8ED4);
+    V[15] = V[14] + V[13] > 0xFF;
+    V[14] += V[13];
+L538: // 4F01 SNE VF, 0x01
+    STEP(0x538, 0x4F01);
+    if (V[15] != 0x01) goto L53C;
+L53A: // 1532 JP 0x532
+    STEP(0x53A, 0x1532);
+    goto L532;
+L53C: // 7C01 ADD VC, 0x01
+    STEP(0x53C, 0x7C01);
+    V[12] += 0x01;
+L53E: // 6D00 LD VD, 0x00
+    STEP(0x53E, 0x6D00);
+    V[13] = 0x00;
+L540: // CE3F RND VE, 0x3F
+    STEP(0x540, 0xCE3F);
+    c->pc = 0x540;
+    predecode(0xCE3F, &in);
+    execute(c, &in);
+    if (c->pc != 0x542) goto dispatch;
+L542: // 7E40 ADD VE, 0x40
+    STEP(0x542, 0x7E40);
+    V[14] += 0x40;
+L544: // FE15 LD DT, VE
+    STEP(0x544, 0xFE15);
+    c->dt = V[14];
+L546: // CE3F RND VE, 0x3F
+    STEP(0x546, 0xCE3F);
+    c->pc = 0x546;
+    predecode(0xCE3F, &in);
+    execute(c, &in);
+    if (c->pc != 0x548) goto dispatch;
+L548: // 7E40 ADD VE, 0x40
+    STEP(0x548, 0x7E40);
+    V[14] += 0x40;
+L54A: // 00EE RET
+    STEP(0x54A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,1235 @@
+// generated by chip8-aot from roms/TANK.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x12, 0x30, 0x76, 0xFB, 0x60, 0x20, 0x80, 0x65, 0x4F, 0x00, 0x66, 0x00,
+    0x13, 0x84, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x01, 0x00, 0x0C, 0x0A, 0x00,
+    0x19, 0x02, 0x04, 0x06, 0x08, 0x02, 0x02, 0x03, 0x2C, 0x00, 0x0F, 0x00,
+    0x02, 0x05, 0x2E, 0x08, 0x00, 0x00, 0x02, 0x05, 0x00, 0x00, 0x00, 0x00,
+    0x6E, 0x00, 0x6D, 0xA0, 0x6A, 0x08, 0x69, 0x06, 0x68, 0x04, 0x67, 0x02,
+    0x66, 0x19, 0x64, 0x10, 0x63, 0x0C, 0x62, 0x00, 0x61, 0x06, 0xA2, 0x12,
+    0xFA, 0x55, 0x23, 0xD4, 0x60, 0x40, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00,
+    0x12, 0x50, 0x23, 0xD4, 0x23, 0x0A, 0x23, 0x62, 0xA2, 0x12, 0xF5, 0x65,
+    0x22, 0xAE, 0x22, 0xC6, 0x22, 0xEC, 0x3F, 0x01, 0x23, 0x14, 0x3F, 0x01,
+    0x22, 0xEC, 0x3F, 0x01, 0x22, 0xEC, 0x3F, 0x01, 0x22, 0x7C, 0x4F, 0x01,
+    0x13, 0x66, 0x12, 0x62, 0xA2, 0x12, 0xF5, 0x65, 0x46, 0x00, 0x35, 0x00,
+    0x12, 0x88, 0x13, 0x8C, 0xE7, 0xA1, 0x62, 0x09, 0xE8, 0xA1, 0x62, 0x04,
+    0xE9, 0xA1, 0x62, 0x06, 0xEA, 0xA1, 0x62, 0x01, 0x42, 0x00, 0x00, 0xEE,
+    0x22, 0xAE, 0x81, 0x20, 0x23, 0x9A, 0x23, 0xAC, 0x6C, 0x01, 0x62, 0x00,
+    0x6F, 0x00, 0xA2, 0x12, 0xF5, 0x55, 0xA3, 0xFF, 0x41, 0x01, 0x60, 0x00,
+    0x41, 0x04, 0x60, 0x13, 0x41, 0x06, 0x60, 0x0D, 0x41, 0x09, 0x60, 0x06,
+    0xF0, 0x1E, 0xD3, 0x47, 0x00, 0xEE, 0x60, 0x05, 0xE0, 0x9E, 0x00, 0xEE,
+    0x45, 0x0F, 0x00, 0xEE, 0x65, 0x0F, 0x76, 0xFF, 0xA2, 0x12, 0xF5, 0x55,
+    0x74, 0x03, 0x73, 0x03, 0x23, 0x9A, 0x23, 0x9A, 0x23, 0x9A, 0xA2, 0x23,
+    0xF5, 0x55, 0xA4, 0x19, 0xD3, 0x41, 0x00, 0xEE, 0xA2, 0x23, 0xF5, 0x65,
+    0x45, 0x00, 0x00, 0xEE, 0xA4, 0x19, 0xD3, 0x41, 0x23, 0x9A, 0x6C, 0x02,
+    0x23, 0xBE, 0x4B, 0xBB, 0x13, 0x0A, 0xD3, 0x41, 0xA2, 0x23, 0xF5, 0x55,
+    0x00, 0xEE, 0x65, 0x00, 0x60, 0x00, 0xA2, 0x17, 0xF0, 0x55, 0x13, 0x04,
+    0xA2, 0x1D, 0xF5, 0x65, 0x35, 0x0F, 0x13, 0x44, 0xA4, 0x1A, 0xD3, 0x45,
+    0x32, 0x00, 0x13, 0x32, 0xC1, 0x03, 0xA2, 0x19, 0xF1, 0x1E, 0xF0, 0x65,
+    0x81, 0x00, 0xC2, 0x0F, 0x72, 0x01, 0x23, 0x9A, 0xA4, 0x1A, 0x6C, 0x03,
+    0x72, 0xFF, 0x6F, 0x00, 0xD3, 0x45, 0xA2, 0x1D, 0xF5, 0x55, 0x00, 0xEE,
+    0xC4, 0x07, 0xA4, 0x1F, 0xF4, 0x1E, 0xF0, 0x65, 0x83, 0x00, 0xA4, 0x27,
+    0xF4, 0x1E, 0xF0, 0x65, 0x84, 0x00, 0xA4, 0x1A, 0xD3, 0x45, 0x60, 0x20,
+    0xF0, 0x18, 0x65, 0x0F, 0x13, 0x3E, 0x65, 0x00, 0x13, 0x3E, 0x4C, 0x01,
+    0x12, 0x02, 0x4C, 0x02, 0x13, 0x82, 0xA2, 0x23, 0xF5, 0x65, 0x45, 0x00,
+    0x12, 0x02, 0xA4, 0x19, 0xD3, 0x41, 0x6F, 0x00, 0xD3, 0x41, 0x3F, 0x01,
+    0x12, 0x02, 0x7E, 0x0A, 0x60, 0x40, 0xF0, 0x18, 0x00, 0xE0, 0x12, 0x4A,
+    0x00, 0xE0, 0x23, 0xD4, 0x60, 0x60, 0xF0, 0x18, 0x13, 0x94, 0x6E, 0x00,
+    0x13, 0x84, 0x41, 0x01, 0x74, 0xFF, 0x41, 0x04, 0x73, 0xFF, 0x41, 0x06,
+    0x73, 0x01, 0x41, 0x09, 0x74, 0x01, 0x00, 0xEE, 0x44, 0x00, 0x74, 0x01,
+    0x43, 0x00, 0x73, 0x01, 0x43, 0x38, 0x73, 0xFF, 0x44, 0x18, 0x74, 0xFF,
+    0x00, 0xEE, 0x6B, 0x00, 0x44, 0x00, 0x13, 0xCE, 0x43, 0x00, 0x13, 0xCE,
+    0x43, 0x3F, 0x13, 0xCE, 0x44, 0x1F, 0x6B, 0xBB, 0x6F, 0x00, 0x00, 0xEE,
+    0x63, 0x08, 0x64, 0x08, 0xA2, 0x29, 0xFE, 0x33, 0xF2, 0x65, 0x23, 0xEC,
+    0x63, 0x28, 0xA2, 0x29, 0xF6, 0x33, 0xF2, 0x65, 0x23, 0xF2, 0x00, 0xEE,
+    0xF0, 0x29, 0xD3, 0x45, 0x73, 0x06, 0xF1, 0x29, 0xD3, 0x45, 0x73, 0x06,
+    0xF2, 0x29, 0xD3, 0x45, 0x00, 0xEE, 0x01, 0x10, 0x54, 0x7C, 0x6C, 0x7C,
+    0x7C, 0x44, 0x7C, 0x7C, 0x6C, 0x7C, 0x54, 0x10, 0x00, 0xFC, 0x78, 0x6E,
+    0x78, 0xFC, 0x00, 0x3F, 0x1E, 0x76, 0x1E, 0x3F, 0x00, 0x80, 0xA8, 0x70,
+    0xF8, 0x70, 0xA8, 0x0B, 0x1B, 0x28, 0x38, 0x30, 0x20, 0x10, 0x00, 0x00,
+    0x00, 0x00, 0x08, 0x1B, 0x1B, 0x1B, 0x18, 0x04,
+};
+const size_t aot_rom_size = 560;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x000000000000FF00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+        case 0x2FE: goto L2FE;
+        case 0x300: goto L300;
+        case 0x302: goto L302;
+        case 0x304: goto L304;
+        case 0x306: goto L306;
+        case 0x308: goto L308;
+        case 0x30A: goto L30A;
+        case 0x30C: goto L30C;
+        case 0x30E: goto L30E;
+        case 0x310: goto L310;
+        case 0x312: goto L312;
+        case 0x314: goto L314;
+        case 0x316: goto L316;
+        case 0x318: goto L318;
+        case 0x31A: goto L31A;
+        case 0x31C: goto L31C;
+        case 0x31E: goto L31E;
+        case 0x320: goto L320;
+        case 0x322: goto L322;
+        case 0x324: goto L324;
+        case 0x326: goto L326;
+        case 0x328: goto L328;
+        case 0x32A: goto L32A;
+        case 0x32C: goto L32C;
+        case 0x32E: goto L32E;
+        case 0x330: goto L330;
+        case 0x332: goto L332;
+        case 0x334: goto L334;
+        case 0x336: goto L336;
+        case 0x338: goto L338;
+        case 0x33A: goto L33A;
+        case 0x33C: goto L33C;
+        case 0x33E: goto L33E;
+        case 0x340: goto L340;
+        case 0x342: goto L342;
+        case 0x344: goto L344;
+        case 0x346: goto L346;
+        case 0x348: goto L348;
+        case 0x34A: goto L34A;
+        case 0x34C: goto L34C;
+        case 0x34E: goto L34E;
+        case 0x350: goto L350;
+        case 0x352: goto L352;
+        case 0x354: goto L354;
+        case 0x356: goto L356;
+        case 0x358: goto L358;
+        case 0x35A: goto L35A;
+        case 0x35C: goto L35C;
+        case 0x35E: goto L35E;
+        case 0x360: goto L360;
+        case 0x362: goto L362;
+        case 0x364: goto L364;
+        case 0x366: goto L366;
+        case 0x368: goto L368;
+        case 0x36A: goto L36A;
+        case 0x36C: goto L36C;
+        case 0x36E: goto L36E;
+        case 0x370: goto L370;
+        case 0x372: goto L372;
+        case 0x374: goto L374;
+        case 0x376: goto L376;
+        case 0x378: goto L378;
+        case 0x37A: goto L37A;
+        case 0x37C: goto L37C;
+        case 0x37E: goto L37E;
+        case 0x380: goto L380;
+        case 0x382: goto L382;
+        case 0x384: goto L384;
+        case 0x386: goto L386;
+        case 0x388: goto L388;
+        case 0x38A: goto L38A;
+        case 0x38C: goto L38C;
+        case 0x38E: goto L38E;
+        case 0x390: goto L390;
+        case 0x392: goto L392;
+        case 0x394: goto L394;
+        case 0x39A: goto L39A;
+        case 0x39C: goto L39C;
+        case 0x39E: goto L39E;
+        case 0x3A0: goto L3A0;
+        case 0x3A2: goto L3A2;
+        case 0x3A4: goto L3A4;
+        case 0x3A6: goto L3A6;
+        case 0x3A8: goto L3A8;
+        case 0x3AA: goto L3AA;
+        case 0x3AC: goto L3AC;
+        case 0x3AE: goto L3AE;
+        case 0x3B0: goto L3B0;
+        case 0x3B2: goto L3B2;
+        case 0x3B4: goto L3B4;
+        case 0x3B6: goto L3B6;
+        case 0x3B8: goto L3B8;
+        case 0x3BA: goto L3BA;
+        case 0x3BC: goto L3BC;
+        case 0x3BE: goto L3BE;
+        case 0x3C0: goto L3C0;
+        case 0x3C2: goto L3C2;
+        case 0x3C4: goto L3C4;
+        case 0x3C6: goto L3C6;
+        case 0x3C8: goto L3C8;
+        case 0x3CA: goto L3CA;
+        case 0x3CC: goto L3CC;
+        case 0x3CE: goto L3CE;
+        case 0x3D0: goto L3D0;
+        case 0x3D2: goto L3D2;
+        case 0x3D4: goto L3D4;
+        case 0x3D6: goto L3D6;
+        case 0x3D8: goto L3D8;
+        case 0x3DA: goto L3DA;
+        case 0x3DC: goto L3DC;
+        case 0x3DE: goto L3DE;
+        case 0x3E0: goto L3E0;
+        case 0x3E2: goto L3E2;
+        case 0x3E4: goto L3E4;
+        case 0x3E6: goto L3E6;
+        case 0x3E8: goto L3E8;
+        case 0x3EA: goto L3EA;
+        case 0x3EC: goto L3EC;
+        case 0x3EE: goto L3EE;
+        case 0x3F0: goto L3F0;
+        case 0x3F2: goto L3F2;
+        case 0x3F4: goto L3F4;
+        case 0x3F6: goto L3F6;
+        case 0x3F8: goto L3F8;
+        case 0x3FA: goto L3FA;
+        case 0x3FC: goto L3FC;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 1230 JP 0x230
+    STEP(0x200, 0x1230);
+    goto L230;
+L202: // 76FB ADD V6, 0xFB
+    STEP(0x202, 0x76FB);
+    V[6] += 0xFB;
+L204: // 6020 LD V0, 0x20
+    STEP(0x204, 0x6020);
+    V[0] = 0x20;
+L206: // 8065 SUB V0, V6
+    STEP(0x206, 0x8065);
+    V[15] = V[0] > V[6];
+    V[0] -= V[6];
+L208: // 4F00 SNE VF, 0x00
+    STEP(0x208, 0x4F00);
+    if (V[15] != 0x00) goto L20C;
+L20A: // 6600 LD V6, 0x00
+    STEP(0x20A, 0x6600);
+    V[6] = 0x00;
+L20C: // 1384 JP 0x384
+    STEP(0x20C, 0x1384);
+    goto L384;
+L230: // 6E00 LD VE, 0x00
+    STEP(0x230, 0x6E00);
+    V[14] = 0x00;
+L232: // 6DA0 LD VD, 0xA0
+    STEP(0x232, 0x6DA0);
+    V[13] = 0xA0;
+L234: // 6A08 LD VA, 0x08
+    STEP(0x234, 0x6A08);
+    V[10] = 0x08;
+L236: // 6906 LD V9, 0x06
+    STEP(0x236, 0x6906);
+    V[9] = 0x06;
+L238: // 6804 LD V8, 0x04
+    STEP(0x238, 0x6804);
+    V[8] = 0x04;
+L23A: // 6702 LD V7, 0x02
+    STEP(0x23A, 0x6702);
+    V[7] = 0x02;
+L23C: // 6619 LD V6, 0x19
+    STEP(0x23C, 0x6619);
+    V[6] = 0x19;
+L23E: // 6410 LD V4, 0x10
+    STEP(0x23E, 0x6410);
+    V[4] = 0x10;
+L240: // 630C LD V3, 0x0C
+    STEP(0x240, 0x630C);
+    V[3] = 0x0C;
+L242: // 6200 LD V2, 0x00
+    STEP(0x242, 0x6200);
+    V[2] = 0x00;
+L244: // 6106 LD V1, 0x06
+    STEP(0x244, 0x6106);
+    V[1] = 0x06;
+L246: // A212 LD I, 0x212
+    STEP(0x246, 0xA212);
+    c->I = 0x212;
+L248: // FA55 LD [I], VA
+    STEP(0x248, 0xFA55);
+    c->pc = 0x248;
+    predecode(0xFA55, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x24A) goto dispatch;
+L24A: // 23D4 CALL 0x3D4
+    STEP(0x24A, 0x23D4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x24A;
+    goto L3D4;
+L24C: // 6040 LD V0, 0x40
+    STEP(0x24C, 0x6040);
+    V[0] = 0x40;
+L24E: // F015 LD DT, V0
+    STEP(0x24E, 0xF015);
+    c->dt = V[0];
+L250: // F007 LD V0, DT
+    STEP(0x250, 0xF007);
+    V[0] = c->dt;
+L252: // 3000 SE V0, 0x00
+    STEP(0x252, 0x3000);
+    if (V[0] == 0x00) goto L256;
+L254: // 1250 JP 0x250
+    STEP(0x254, 0x1250);
+    goto L250;
+L256: // 23D4 CALL 0x3D4
+    STEP(0x256, 0x23D4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x256;
+    goto L3D4;
+L258: // 230A CALL 0x30A
+    STEP(0x258, 0x230A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x258;
+    goto L30A;
+L25A: // 2362 CALL 0x362
+    STEP(0x25A, 0x2362);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x25A;
+    goto L362;
+L25C: // A212 LD I, 0x212
+    STEP(0x25C, 0xA212);
+    c->I = 0x212;
+L25E: // F565 LD V5, [I]
+    STEP(0x25E, 0xF565);
+    for (int i = 0; i <= 5; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L260: // 22AE CALL 0x2AE
+    STEP(0x260, 0x22AE);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x260;
+    goto L2AE;
+L262: // 22C6 CALL 0x2C6
+    STEP(0x262, 0x22C6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x262;
+    goto L2C6;
+L264: // 22EC CALL 0x2EC
+    STEP(0x264, 0x22EC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x264;
+    goto L2EC;
+L266: // 3F01 SE VF, 0x01
+    STEP(0x266, 0x3F01);
+    if (V[15] == 0x01) goto L26A;
+L268: // 2314 CALL 0x314
+    STEP(0x268, 0x2314);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x268;
+    goto L314;
+L26A: // 3F01 SE VF, 0x01
+    STEP(0x26A, 0x3F01);
+    if (V[15] == 0x01) goto L26E;
+L26C: // 22EC CALL 0x2EC
+    STEP(0x26C, 0x22EC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x26C;
+    goto L2EC;
+L26E: // 3F01 SE VF, 0x01
+    STEP(0x26E, 0x3F01);
+    if (V[15] == 0x01) goto L272;
+L270: // 22EC CALL 0x2EC
+    STEP(0x270, 0x22EC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x270;
+    goto L2EC;
+L272: // 3F01 SE VF, 0x01
+    STEP(0x272, 0x3F01);
+    if (V[15] == 0x01) goto L276;
+L274: // 227C CALL 0x27C
+    STEP(0x274, 0x227C);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x274;
+    goto L27C;
+L276: // 4F01 SNE VF, 0x01
+    STEP(0x276, 0x4F01);
+    if (V[15] != 0x01) goto L27A;
+L278: // 1366 JP 0x366
+    STEP(0x278, 0x1366);
+    goto L366;
+L27A: // 1262 JP 0x262
+    STEP(0x27A, 0x1262);
+    goto L262;
+L27C: // A212 LD I, 0x212
+    STEP(0x27C, 0xA212);
+    c->I = 0x212;
+L27E: // F565 LD V5, [I]
+    STEP(0x27E, 0xF565);
+    for (int i = 0; i <= 5; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L280: // 4600 SNE V6, 0x00
+    STEP(0x280, 0x4600);
+    if (V[6] != 0x00) goto L284;
+L282: // 3500 SE V5, 0x00
+    STEP(0x282, 0x3500);
+    if (V[5] == 0x00) goto L286;
+L284: // 1288 JP 0x288
+    STEP(0x284, 0x1288);
+    goto L288;
+L286: // 138C JP 0x38C
+    STEP(0x286, 0x138C);
+    goto L38C;
+L288: // E7A1 SKNP V7
+    STEP(0x288, 0xE7A1);
+    c->pc = 0x288;
+    predecode(0xE7A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x28A) goto dispatch;
+L28A: // 6209 LD V2, 0x09
+    STEP(0x28A, 0x6209);
+    V[2] = 0x09;
+L28C: // E8A1 SKNP V8
+    STEP(0x28C, 0xE8A1);
+    c->pc = 0x28C;
+    predecode(0xE8A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x28E) goto dispatch;
+L28E: // 6204 LD V2, 0x04
+    STEP(0x28E, 0x6204);
+    V[2] = 0x04;
+L290: // E9A1 SKNP V9
+    STEP(0x290, 0xE9A1);
+    c->pc = 0x290;
+    predecode(0xE9A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x292) goto dispatch;
+L292: // 6206 LD V2, 0x06
+    STEP(0x292, 0x6206);
+    V[2] = 0x06;
+L294: // EAA1 SKNP VA
+    STEP(0x294, 0xEAA1);
+    c->pc = 0x294;
+    predecode(0xEAA1, &in);
+    execute(c, &in);
+    if (c->pc != 0x296) goto dispatch;
+L296: // 6201 LD V2, 0x01
+    STEP(0x296, 0x6201);
+    V[2] = 0x01;
+L298: // 4200 SNE V2, 0x00
+    STEP(0x298, 0x4200);
+    if (V[2] != 0x00) goto L29C;
+L29A: // 00EE RET
+    STEP(0x29A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L29C: // 22AE CALL 0x2AE
+    STEP(0x29C, 0x22AE);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x29C;
+    goto L2AE;
+L29E: // 8120 LD V1, V2
+    STEP(0x29E, 0x8120);
+    V[1] = V[2];
+L2A0: // 239A CALL 0x39A
+    STEP(0x2A0, 0x239A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2A0;
+    goto L39A;
+L2A2: // 23AC CALL 0x3AC
+    STEP(0x2A2, 0x23AC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2A2;
+    goto L3AC;
+L2A4: // 6C01 LD VC, 0x01
+    STEP(0x2A4, 0x6C01);
+    V[12] = 0x01;
+L2A6: // 6200 LD V2, 0x00
+    STEP(0x2A6, 0x6200);
+    V[2] = 0x00;
+L2A8: // 6F00 LD VF, 0x00
+    STEP(0x2A8, 0x6F00);
+    V[15] = 0x00;
+L2AA: // A212 LD I, 0x212
+    STEP(0x2AA, 0xA212);
+    c->I = 0x212;
+L2AC: // F555 LD [I], V5
+    STEP(0x2AC, 0xF555);
+    c->pc = 0x2AC;
+    predecode(0xF555, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2AE) goto dispatch;
+L2AE: // A3FF LD I, 0x3FF
+    STEP(0x2AE, 0xA3FF);
+    c->I = 0x3FF;
+L2B0: // 4101 SNE V1, 0x01
+    STEP(0x2B0, 0x4101);
+    if (V[1] != 0x01) goto L2B4;
+L2B2: // 6000 LD V0, 0x00
+    STEP(0x2B2, 0x6000);
+    V[0] = 0x00;
+L2B4: // 4104 SNE V1, 0x04
+    STEP(0x2B4, 0x4104);
+    if (V[1] != 0x04) goto L2B8;
+L2B6: // 6013 LD V0, 0x13
+    STEP(0x2B6, 0x6013);
+    V[0] = 0x13;
+L2B8: // 4106 SNE V1, 0x06
+    STEP(0x2B8, 0x4106);
+    if (V[1] != 0x06) goto L2BC;
+L2BA: // 600D LD V0, 0x0D
+    STEP(0x2BA, 0x600D);
+    V[0] = 0x0D;
+L2BC: // 4109 SNE V1, 0x09
+    STEP(0x2BC, 0x4109);
+    if (V[1] != 0x09) goto L2C0;
+L2BE: // 6006 LD V0, 0x06
+    STEP(0x2BE, 0x6006);
+    V[0] = 0x06;
+L2C0: // F01E ADD I, V0
+    STEP(0x2C0, 0xF01E);
+    c->I += V[0];
+L2C2: // D347 DRW V3, V4, 7
+    STEP(0x2C2, 0xD347);
+    c->pc = 0x2C2;
+    predecode(0xD347, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C4) goto dispatch;
+L2C4: // 00EE RET
+    STEP(0x2C4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2C6: // 6005 LD V0, 0x05
+    STEP(0x2C6, 0x6005);
+    V[0] = 0x05;
+L2C8: // E09E SKP V0
+    STEP(0x2C8, 0xE09E);
+    c->pc = 0x2C8;
+    predecode(0xE09E, &in);
+    execute(c, &in);
+    if (c->pc != 0x2CA) goto dispatch;
+L2CA: // 00EE RET
+    STEP(0x2CA, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2CC: // 450F SNE V5, 0x0F
+    STEP(0x2CC, 0x450F);
+    if (V[5] != 0x0F) goto L2D0;
+L2CE: // 00EE RET
+    STEP(0x2CE, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2D0: // 650F LD V5, 0x0F
+    STEP(0x2D0, 0x650F);
+    V[5] = 0x0F;
+L2D2: // 76FF ADD V6, 0xFF
+    STEP(0x2D2, 0x76FF);
+    V[6] += 0xFF;
+L2D4: // A212 LD I, 0x212
+    STEP(0x2D4, 0xA212);
+    c->I = 0x212;
+L2D6: // F555 LD [I], V5
+    STEP(0x2D6, 0xF555);
+    c->pc = 0x2D6;
+    predecode(0xF555, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2D8) goto dispatch;
+L2D8: // 7403 ADD V4, 0x03
+    STEP(0x2D8, 0x7403);
+    V[4] += 0x03;
+L2DA: // 7303 ADD V3, 0x03
+    STEP(0x2DA, 0x7303);
+    V[3] += 0x03;
+L2DC: // 239A CALL 0x39A
+    STEP(0x2DC, 0x239A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2DC;
+    goto L39A;
+L2DE: // 239A CALL 0x39A
+    STEP(0x2DE, 0x239A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2DE;
+    goto L39A;
+L2E0: // 239A CALL 0x39A
+    STEP(0x2E0, 0x239A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2E0;
+    goto L39A;
+L2E2: // A223 LD I, 0x223
+    STEP(0x2E2, 0xA223);
+    c->I = 0x223;
+L2E4: // F555 LD [I], V5
+    STEP(0x2E4, 0xF555);
+    c->pc = 0x2E4;
+    predecode(0xF555, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2E6) goto dispatch;
+L2E6: // A419 LD I, 0x419
+    STEP(0x2E6, 0xA419);
+    c->I = 0x419;
+L2E8: // D341 DRW V3, V4, 1
+    STEP(0x2E8, 0xD341);
+    c->pc = 0x2E8;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x2EA) goto dispatch;
+L2EA: // 00EE RET
+    STEP(0x2EA, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2EC: // A223 LD I, 0x223
+    STEP(0x2EC, 0xA223);
+    c->I = 0x223;
+L2EE: // F565 LD V5, [I]
+    STEP(0x2EE, 0xF565);
+    for (int i = 0; i <= 5; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2F0: // 4500 SNE V5, 0x00
+    STEP(0x2F0, 0x4500);
+    if (V[5] != 0x00) goto L2F4;
+L2F2: // 00EE RET
+    STEP(0x2F2, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2F4: // A419 LD I, 0x419
+    STEP(0x2F4, 0xA419);
+    c->I = 0x419;
+L2F6: // D341 DRW V3, V4, 1
+    STEP(0x2F6, 0xD341);
+    c->pc = 0x2F6;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x2F8) goto dispatch;
+L2F8: // 239A CALL 0x39A
+    STEP(0x2F8, 0x239A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2F8;
+    goto L39A;
+L2FA: // 6C02 LD VC, 0x02
+    STEP(0x2FA, 0x6C02);
+    V[12] = 0x02;
+L2FC: // 23BE CALL 0x3BE
+    STEP(0x2FC, 0x23BE);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2FC;
+    goto L3BE;
+L2FE: // 4BBB SNE VB, 0xBB
+    STEP(0x2FE, 0x4BBB);
+    if (V[11] != 0xBB) goto L302;
+L300: // 130A JP 0x30A
+    STEP(0x300, 0x130A);
+    goto L30A;
+L302: // D341 DRW V3, V4, 1
+    STEP(0x302, 0xD341);
+    c->pc = 0x302;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x304) goto dispatch;
+L304: // A223 LD I, 0x223
+    STEP(0x304, 0xA223);
+    c->I = 0x223;
+L306: // F555 LD [I], V5
+    STEP(0x306, 0xF555);
+    c->pc = 0x306;
+    predecode(0xF555, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x308) goto dispatch;
+L308: // 00EE RET
+    STEP(0x308, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L30A: // 6500 LD V5, 0x00
+    STEP(0x30A, 0x6500);
+    V[5] = 0x00;
+L30C: // 6000 LD V0, 0x00
+    STEP(0x30C, 0x6000);
+    V[0] = 0x00;
+L30E: // A217 LD I, 0x217
+    STEP(0x30E, 0xA217);
+    c->I = 0x217;
+L310: // F055 LD [I], V0
+    STEP(0x310, 0xF055);
+    c->pc = 0x310;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x312) goto dispatch;
+L312: // 1304 JP 0x304
+    STEP(0x312, 0x1304);
+    goto L304;
+L314: // A21D LD I, 0x21D
+    STEP(0x314, 0xA21D);
+    c->I = 0x21D;
+L316: // F565 LD V5, [I]
+    STEP(0x316, 0xF565);
+    for (int i = 0; i <= 5; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L318: // 350F SE V5, 0x0F
+    STEP(0x318, 0x350F);
+    if (V[5] == 0x0F) goto L31C;
+L31A: // 1344 JP 0x344
+    STEP(0x31A, 0x1344);
+    goto L344;
+L31C: // A41A LD I, 0x41A
+    STEP(0x31C, 0xA41A);
+    c->I = 0x41A;
+L31E: // D345 DRW V3, V4, 5
+    STEP(0x31E, 0xD345);
+    c->pc = 0x31E;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x320) goto dispatch;
+L320: // 3200 SE V2, 0x00
+    STEP(0x320, 0x3200);
+    if (V[2] == 0x00) goto L324;
+L322: // 1332 JP 0x332
+    STEP(0x322, 0x1332);
+    goto L332;
+L324: // C103 RND V1, 0x03
+    STEP(0x324, 0xC103);
+    c->pc = 0x324;
+    predecode(0xC103, &in);
+    execute(c, &in);
+    if (c->pc != 0x326) goto dispatch;
+L326: // A219 LD I, 0x219
+    STEP(0x326, 0xA219);
+    c->I = 0x219;
+L328: // F11E ADD I, V1
+    STEP(0x328, 0xF11E);
+    c->I += V[1];
+L32A: // F065 LD V0, [I]
+    STEP(0x32A, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L32C: // 8100 LD V1, V0
+    STEP(0x32C, 0x8100);
+    V[1] = V[0];
+L32E: // C20F RND V2, 0x0F
+    STEP(0x32E, 0xC20F);
+    c->pc = 0x32E;
+    predecode(0xC20F, &in);
+    execute(c, &in);
+    if (c->pc != 0x330) goto dispatch;
+L330: // 7201 ADD V2, 0x01
+    STEP(0x330, 0x7201);
+    V[2] += 0x01;
+L332: // 239A CALL 0x39A
+    STEP(0x332, 0x239A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x332;
+    goto L39A;
+L334: // A41A LD I, 0x41A
+    STEP(0x334, 0xA41A);
+    c->I = 0x41A;
+L336: // 6C03 LD VC, 0x03
+    STEP(0x336, 0x6C03);
+    V[12] = 0x03;
+L338: // 72FF ADD V2, 0xFF
+    STEP(0x338, 0x72FF);
+    V[2] += 0xFF;
+L33A: // 6F00 LD VF, 0x00
+    STEP(0x33A, 0x6F00);
+    V[15] = 0x00;
+L33C: // D345 DRW V3, V4, 5
+    STEP(0x33C, 0xD345);
+    c->pc = 0x33C;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x33E) goto dispatch;
+L33E: // A21D LD I, 0x21D
+    STEP(0x33E, 0xA21D);
+    c->I = 0x21D;
+L340: // F555 LD [I], V5
+    STEP(0x340, 0xF555);
+    c->pc = 0x340;
+    predecode(0xF555, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x342) goto dispatch;
+L342: // 00EE RET
+    STEP(0x342, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L344: // C407 RND V4, 0x07
+    STEP(0x344, 0xC407);
+    c->pc = 0x344;
+    predecode(0xC407, &in);
+    execute(c, &in);
+    if (c->pc != 0x346) goto dispatch;
+L346: // A41F LD I, 0x41F
+    STEP(0x346, 0xA41F);
+    c->I = 0x41F;
+L348: // F41E ADD I, V4
+    STEP(0x348, 0xF41E);
+    c->I += V[4];
+L34A: // F065 LD V0, [I]
+    STEP(0x34A, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L34C: // 8300 LD V3, V0
+    STEP(0x34C, 0x8300);
+    V[3] = V[0];
+L34E: // A427 LD I, 0x427
+    STEP(0x34E, 0xA427);
+    c->I = 0x427;
+L350: // F41E ADD I, V4
+    STEP(0x350, 0xF41E);
+    c->I += V[4];
+L352: // F065 LD V0, [I]
+    STEP(0x352, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L354: // 8400 LD V4, V0
+    STEP(0x354, 0x8400);
+    V[4] = V[0];
+L356: // A41A LD I, 0x41A
+    STEP(0x356, 0xA41A);
+    c->I = 0x41A;
+L358: // D345 DRW V3, V4, 5
+    STEP(0x358, 0xD345);
+    c->pc = 0x358;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x35A) goto dispatch;
+L35A: // 6020 LD V0, 0x20
+    STEP(0x35A, 0x6020);
+    V[0] = 0x20;
+L35C: // F018 LD ST, V0
+    STEP(0x35C, 0xF018);
+    c->st = V[0];
+L35E: // 650F LD V5, 0x0F
+    STEP(0x35E, 0x650F);
+    V[5] = 0x0F;
+L360: // 133E JP 0x33E
+    STEP(0x360, 0x133E);
+    goto L33E;
+L362: // 6500 LD V5, 0x00
+    STEP(0x362, 0x6500);
+    V[5] = 0x00;
+L364: // 133E JP 0x33E
+    STEP(0x364, 0x133E);
+    goto L33E;
+L366: // 4C01 SNE VC, 0x01
+    STEP(0x366, 0x4C01);
+    if (V[12] != 0x01) goto L36A;
+L368: // 1202 JP 0x202
+    STEP(0x368, 0x1202);
+    goto L202;
+L36A: // 4C02 SNE VC, 0x02
+    STEP(0x36A, 0x4C02);
+    if (V[12] != 0x02) goto L36E;
+L36C: // 1382 JP 0x382
+    STEP(0x36C, 0x1382);
+    goto L382;
+L36E: // A223 LD I, 0x223
+    STEP(0x36E, 0xA223);
+    c->I = 0x223;
+L370: // F565 LD V5, [I]
+    STEP(0x370, 0xF565);
+    for (int i = 0; i <= 5; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L372: // 4500 SNE V5, 0x00
+    STEP(0x372, 0x4500);
+    if (V[5] != 0x00) goto L376;
+L374: // 1202 JP 0x202
+    STEP(0x374, 0x1202);
+    goto L202;
+L376: // A419 LD I, 0x419
+    STEP(0x376, 0xA419);
+    c->I = 0x419;
+L378: // D341 DRW V3, V4, 1
+    STEP(0x378, 0xD341);
+    c->pc = 0x378;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x37A) goto dispatch;
+L37A: // 6F00 LD VF, 0x00
+    STEP(0x37A, 0x6F00);
+    V[15] = 0x00;
+L37C: // D341 DRW V3, V4, 1
+    STEP(0x37C, 0xD341);
+    c->pc = 0x37C;
+    predecode(0xD341, &in);
+    execute(c, &in);
+    if (c->pc != 0x37E) goto dispatch;
+L37E: // 3F01 SE VF, 0x01
+    STEP(0x37E, 0x3F01);
+    if (V[15] == 0x01) goto L382;
+L380: // 1202 JP 0x202
+    STEP(0x380, 0x1202);
+    goto L202;
+L382: // 7E0A ADD VE, 0x0A
+    STEP(0x382, 0x7E0A);
+    V[14] += 0x0A;
+L384: // 6040 LD V0, 0x40
+    STEP(0x384, 0x6040);
+    V[0] = 0x40;
+L386: // F018 LD ST, V0
+    STEP(0x386, 0xF018);
+    c->st = V[0];
+L388: // 00E0 CLS
+    STEP(0x388, 0x00E0);
+    c->pc = 0x388;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x38A) goto dispatch;
+L38A: // 124A JP 0x24A
+    STEP(0x38A, 0x124A);
+    goto L24A;
+L38C: // 00E0 CLS
+    STEP(0x38C, 0x00E0);
+    c->pc = 0x38C;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x38E) goto dispatch;
+L38E: // 23D4 CALL 0x3D4
+    STEP(0x38E, 0x23D4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x38E;
+    goto L3D4;
+L390: // 6060 LD V0, 0x60
+    STEP(0x390, 0x6060);
+    V[0] = 0x60;
+L392: // F018 LD ST, V0
+    STEP(0x392, 0xF018);
+    c->st = V[0];
+L394: // 1394 JP 0x394
+    STEP(0x394, 0x1394);
+    goto L394;
+L39A: // 4101 SNE V1, 0x01
+    STEP(0x39A, 0x4101);
+    if (V[1] != 0x01) goto L39E;
+L39C: // 74FF ADD V4, 0xFF
+    STEP(0x39C, 0x74FF);
+    V[4] += 0xFF;
+L39E: // 4104 SNE V1, 0x04
+    STEP(0x39E, 0x4104);
+    if (V[1] != 0x04) goto L3A2;
+L3A0: // 73FF ADD V3, 0xFF
+    STEP(0x3A0, 0x73FF);
+    V[3] += 0xFF;
+L3A2: // 4106 SNE V1, 0x06
+    STEP(0x3A2, 0x4106);
+    if (V[1] != 0x06) goto L3A6;
+L3A4: // 7301 ADD V3, 0x01
+    STEP(0x3A4, 0x7301);
+    V[3] += 0x01;
+L3A6: // 4109 SNE V1, 0x09
+    STEP(0x3A6, 0x4109);
+    if (V[1] != 0x09) goto L3AA;
+L3A8: // 7401 ADD V4, 0x01
+    STEP(0x3A8, 0x7401);
+    V[4] += 0x01;
+L3AA: // 00EE RET
+    STEP(0x3AA, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3AC: // 4400 SNE V4, 0x00
+    STEP(0x3AC, 0x4400);
+    if (V[4] != 0x00) goto L3B0;
+L3AE: // 7401 ADD V4, 0x01
+    STEP(0x3AE, 0x7401);
+    V[4] += 0x01;
+L3B0: // 4300 SNE V3, 0x00
+    STEP(0x3B0, 0x4300);
+    if (V[3] != 0x00) goto L3B4;
+L3B2: // 7301 ADD V3, 0x01
+    STEP(0x3B2, 0x7301);
+    V[3] += 0x01;
+L3B4: // 4338 SNE V3, 0x38
+    STEP(0x3B4, 0x4338);
+    if (V[3] != 0x38) goto L3B8;
+L3B6: // 73FF ADD V3, 0xFF
+    STEP(0x3B6, 0x73FF);
+    V[3] += 0xFF;
+L3B8: // 4418 SNE V4, 0x18
+    STEP(0x3B8, 0x4418);
+    if (V[4] != 0x18) goto L3BC;
+L3BA: // 74FF ADD V4, 0xFF
+    STEP(0x3BA, 0x74FF);
+    V[4] += 0xFF;
+L3BC: // 00EE RET
+    STEP(0x3BC, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3BE: // 6B00 LD VB, 0x00
+    STEP(0x3BE, 0x6B00);
+    V[11] = 0x00;
+L3C0: // 4400 SNE V4, 0x00
+    STEP(0x3C0, 0x4400);
+    if (V[4] != 0x00) goto L3C4;
+L3C2: // 13CE JP 0x3CE
+    STEP(0x3C2, 0x13CE);
+    goto L3CE;
+L3C4: // 4300 SNE V3, 0x00
+    STEP(0x3C4, 0x4300);
+    if (V[3] != 0x00) goto L3C8;
+L3C6: // 13CE JP 0x3CE
+    STEP(0x3C6, 0x13CE);
+    goto L3CE;
+L3C8: // 433F SNE V3, 0x3F
+    STEP(0x3C8, 0x433F);
+    if (V[3] != 0x3F) goto L3CC;
+L3CA: // 13CE JP 0x3CE
+    STEP(0x3CA, 0x13CE);
+    goto L3CE;
+L3CC: // 441F SNE V4, 0x1F
+    STEP(0x3CC, 0x441F);
+    if (V[4] != 0x1F) goto L3D0;
+L3CE: // 6BBB LD VB, 0xBB
+    STEP(0x3CE, 0x6BBB);
+    V[11] = 0xBB;
+L3D0: // 6F00 LD VF, 0x00
+    STEP(0x3D0, 0x6F00);
+    V[15] = 0x00;
+L3D2: // 00EE RET
+    STEP(0x3D2, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3D4: // 6308 LD V3, 0x08
+    STEP(0x3D4, 0x6308);
+    V[3] = 0x08;
+L3D6: // 6408 LD V4, 0x08
+    STEP(0x3D6, 0x6408);
+    V[4] = 0x08;
+L3D8: // A229 LD I, 0x229
+    STEP(0x3D8, 0xA229);
+    c->I = 0x229;
+L3DA: // FE33 LD B, VE
+    STEP(0x3DA, 0xFE33);
+    c->pc = 0x3DA;
+    predecode(0xFE33, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x3DC) goto dispatch;
+L3DC: // F265 LD V2, [I]
+    STEP(0x3DC, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L3DE: // 23EC CALL 0x3EC
+    STEP(0x3DE, 0x23EC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x3DE;
+    goto L3EC;
+L3E0: // 6328 LD V3, 0x28
+    STEP(0x3E0, 0x6328);
+    V[3] = 0x28;
+L3E2: // A229 LD I, 0x229
+    STEP(0x3E2, 0xA229);
+    c->I = 0x229;
+L3E4: // F633 LD B, V6
+    STEP(0x3E4, 0xF633);
+    c->pc = 0x3E4;
+    predecode(0xF633, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x3E6) goto dispatch;
+L3E6: // F265 LD V2, [I]
+    STEP(0x3E6, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L3E8: // 23F2 CALL 0x3F2
+    STEP(0x3E8, 0x23F2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x3E8;
+    goto L3F2;
+L3EA: // 00EE RET
+    STEP(0x3EA, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3EC: // F029 LD F, V0
+    STEP(0x3EC, 0xF029);
+    c->I = V[0] * 5;
+L3EE: // D345 DRW V3, V4, 5
+    STEP(0x3EE, 0xD345);
+    c->pc = 0x3EE;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x3F0) goto dispatch;
+L3F0: // 7306 ADD V3, 0x06
+    STEP(0x3F0, 0x7306);
+    V[3] += 0x06;
+L3F2: // F129 LD F, V1
+    STEP(0x3F2, 0xF129);
+    c->I = V[1] * 5;
+L3F4: // D345 DRW V3, V4, 5
+    STEP(0x3F4, 0xD345);
+    c->pc = 0x3F4;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x3F6) goto dispatch;
+L3F6: // 7306 ADD V3, 0x06
+    STEP(0x3F6, 0x7306);
+    V[3] += 0x06;
+L3F8: // F229 LD F, V2
+    STEP(0x3F8, 0xF229);
+    c->I = V[2] * 5;
+L3FA: // D345 DRW V3, V4, 5
+    STEP(0x3FA, 0xD345);
+    c->pc = 0x3FA;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x3FC) goto dispatch;
+L3FC: // 00EE RET
+    STEP(0x3FC, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,545 @@
+// generated by chip8-aot from roms/TEST/TAPEWORM.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x00, 0xE0, 0xA2, 0x06, 0x12, 0x38, 0xFF, 0x80, 0xFB, 0x22, 0x22, 0x23,
+    0x22, 0x22, 0x22, 0x00, 0xEF, 0x28, 0x28, 0xEF, 0x28, 0x28, 0x28, 0x00,
+    0xBD, 0xA1, 0xA1, 0xB9, 0x21, 0x20, 0x3C, 0x00, 0x0B, 0x0A, 0x0A, 0x0A,
+    0x0A, 0xAA, 0x53, 0x00, 0xEF, 0x28, 0x28, 0x2F, 0x2A, 0x29, 0xE8, 0x00,
+    0xB6, 0xAA, 0xA2, 0xA2, 0x22, 0x22, 0xA2, 0x00, 0x64, 0x00, 0x65, 0x00,
+    0x66, 0x1F, 0xD4, 0x51, 0xD4, 0x61, 0x74, 0x08, 0x44, 0x40, 0x12, 0x4A,
+    0x12, 0x3E, 0xA2, 0x5E, 0x64, 0x00, 0x65, 0x3F, 0x66, 0x01, 0xD4, 0x6A,
+    0xD5, 0x6A, 0x76, 0x0A, 0x46, 0x1F, 0x12, 0x68, 0x12, 0x52, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x64, 0x08, 0x65, 0x08,
+    0xA2, 0x08, 0xD4, 0x57, 0x74, 0x08, 0xA2, 0x10, 0xD4, 0x57, 0x74, 0x08,
+    0xA2, 0x18, 0xD4, 0x57, 0x74, 0x08, 0xA2, 0x20, 0xD4, 0x57, 0x74, 0x08,
+    0xA2, 0x28, 0xD4, 0x57, 0xA2, 0x30, 0x74, 0x08, 0xD4, 0x57, 0xA2, 0x92,
+    0x12, 0xAA, 0xF7, 0x14, 0x14, 0x94, 0xF7, 0x00, 0x38, 0xA8, 0xB8, 0xB1,
+    0x2A, 0x00, 0x4E, 0xCA, 0x4E, 0x42, 0xEE, 0x00, 0xEE, 0xAA, 0xEE, 0x22,
+    0xEE, 0x00, 0x64, 0x11, 0x65, 0x13, 0xD4, 0x55, 0x74, 0x08, 0xA2, 0x98,
+    0xD4, 0x55, 0x74, 0x09, 0xA2, 0x9E, 0xD4, 0x55, 0x74, 0x08, 0xA2, 0xA4,
+    0xD4, 0x55, 0x60, 0x0F, 0xE0, 0xA1, 0x12, 0xCA, 0x12, 0xC4, 0x00, 0xE0,
+    0x65, 0x1F, 0x66, 0x0F, 0xA2, 0x07, 0x67, 0x06, 0x68, 0x02, 0xD5, 0x61,
+    0x4F, 0x01, 0x13, 0x0E, 0xF8, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0xDE,
+    0x60, 0x02, 0xE0, 0xA1, 0x67, 0x02, 0x60, 0x04, 0xE0, 0xA1, 0x67, 0x04,
+    0x60, 0x06, 0xE0, 0xA1, 0x67, 0x06, 0x60, 0x08, 0xE0, 0xA1, 0x67, 0x08,
+    0x47, 0x02, 0x76, 0xFF, 0x47, 0x08, 0x76, 0x01, 0x47, 0x04, 0x75, 0xFF,
+    0x47, 0x06, 0x75, 0x01, 0x12, 0xD6, 0x60, 0x06, 0xF0, 0x18, 0x60, 0x0F,
+    0xE0, 0x9E, 0x13, 0x14, 0x00, 0xE0, 0x12, 0xCC,
+};
+const size_t aot_rom_size = 284;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000001F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+        case 0x2FE: goto L2FE;
+        case 0x300: goto L300;
+        case 0x302: goto L302;
+        case 0x304: goto L304;
+        case 0x306: goto L306;
+        case 0x308: goto L308;
+        case 0x30A: goto L30A;
+        case 0x30C: goto L30C;
+        case 0x30E: goto L30E;
+        case 0x310: goto L310;
+        case 0x312: goto L312;
+        case 0x314: goto L314;
+        case 0x316: goto L316;
+        case 0x318: goto L318;
+        case 0x31A: goto L31A;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 00E0 CLS
+    STEP(0x200, 0x00E0);
+    c->pc = 0x200;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x202) goto dispatch;
+L202: // A206 LD I, 0x206
+    STEP(0x202, 0xA206);
+    c->I = 0x206;
+L204: // 1238 JP 0x238
+    STEP(0x204, 0x1238);
+    goto L238;
+L238: // 6400 LD V4, 0x00
+    STEP(0x238, 0x6400);
+    V[4] = 0x00;
+L23A: // 6500 LD V5, 0x00
+    STEP(0x23A, 0x6500);
+    V[5] = 0x00;
+L23C: // 661F LD V6, 0x1F
+    STEP(0x23C, 0x661F);
+    V[6] = 0x1F;
+L23E: // D451 DRW V4, V5, 1
+    STEP(0x23E, 0xD451);
+    c->pc = 0x23E;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x240) goto dispatch;
+L240: // D461 DRW V4, V6, 1
+    STEP(0x240, 0xD461);
+    c->pc = 0x240;
+    predecode(0xD461, &in);
+    execute(c, &in);
+    if (c->pc != 0x242) goto dispatch;
+L242: // 7408 ADD V4, 0x08
+    STEP(0x242, 0x7408);
+    V[4] += 0x08;
+L244: // 4440 SNE V4, 0x40
+    STEP(0x244, 0x4440);
+    if (V[4] != 0x40) goto L248;
+L246: // 124A JP 0x24A
+    STEP(0x246, 0x124A);
+    goto L24A;
+L248: // 123E JP 0x23E
+    STEP(0x248, 0x123E);
+    goto L23E;
+L24A: // A25E LD I, 0x25E
+    STEP(0x24A, 0xA25E);
+    c->I = 0x25E;
+L24C: // 6400 LD V4, 0x00
+    STEP(0x24C, 0x6400);
+    V[4] = 0x00;
+L24E: // 653F LD V5, 0x3F
+    STEP(0x24E, 0x653F);
+    V[5] = 0x3F;
+L250: // 6601 LD V6, 0x01
+    STEP(0x250, 0x6601);
+    V[6] = 0x01;
+L252: // D46A DRW V4, V6, 10
+    STEP(0x252, 0xD46A);
+    c->pc = 0x252;
+    predecode(0xD46A, &in);
+    execute(c, &in);
+    if (c->pc != 0x254) goto dispatch;
+L254: // D56A DRW V5, V6, 10
+    STEP(0x254, 0xD56A);
+    c->pc = 0x254;
+    predecode(0xD56A, &in);
+    execute(c, &in);
+    if (c->pc != 0x256) goto dispatch;
+L256: // 760A ADD V6, 0x0A
+    STEP(0x256, 0x760A);
+    V[6] += 0x0A;
+L258: // 461F SNE V6, 0x1F
+    STEP(0x258, 0x461F);
+    if (V[6] != 0x1F) goto L25C;
+L25A: // 1268 JP 0x268
+    STEP(0x25A, 0x1268);
+    goto L268;
+L25C: // 1252 JP 0x252
+    STEP(0x25C, 0x1252);
+    goto L252;
+L268: // 6408 LD V4, 0x08
+    STEP(0x268, 0x6408);
+    V[4] = 0x08;
+L26A: // 6508 LD V5, 0x08
+    STEP(0x26A, 0x6508);
+    V[5] = 0x08;
+L26C: // A208 LD I, 0x208
+    STEP(0x26C, 0xA208);
+    c->I = 0x208;
+L26E: // D457 DRW V4, V5, 7
+    STEP(0x26E, 0xD457);
+    c->pc = 0x26E;
+    predecode(0xD457, &in);
+    execute(c, &in);
+    if (c->pc != 0x270) goto dispatch;
+L270: // 7408 ADD V4, 0x08
+    STEP(0x270, 0x7408);
+    V[4] += 0x08;
+L272: // A210 LD I, 0x210
+    STEP(0x272, 0xA210);
+    c->I = 0x210;
+L274: // D457 DRW V4, V5, 7
+    STEP(0x274, 0xD457);
+    c->pc = 0x274;
+    predecode(0xD457, &in);
+    execute(c, &in);
+    if (c->pc != 0x276) goto dispatch;
+L276: // 7408 ADD V4, 0x08
+    STEP(0x276, 0x7408);
+    V[4] += 0x08;
+L278: // A218 LD I, 0x218
+    STEP(0x278, 0xA218);
+    c->I = 0x218;
+L27A: // D457 DRW V4, V5, 7
+    STEP(0x27A, 0xD457);
+    c->pc = 0x27A;
+    predecode(0xD457, &in);
+    execute(c, &in);
+    if (c->pc != 0x27C) goto dispatch;
+L27C: // 7408 ADD V4, 0x08
+    STEP(0x27C, 0x7408);
+    V[4] += 0x08;
+L27E: // A220 LD I, 0x220
+    STEP(0x27E, 0xA220);
+    c->I = 0x220;
+L280: // D457 DRW V4, V5, 7
+    STEP(0x280, 0xD457);
+    c->pc = 0x280;
+    predecode(0xD457, &in);
+    execute(c, &in);
+    if (c->pc != 0x282) goto dispatch;
+L282: // 7408 ADD V4, 0x08
+    STEP(0x282, 0x7408);
+    V[4] += 0x08;
+L284: // A228 LD I, 0x228
+    STEP(0x284, 0xA228);
+    c->I = 0x228;
+L286: // D457 DRW V4, V5, 7
+    STEP(0x286, 0xD457);
+    c->pc = 0x286;
+    predecode(0xD457, &in);
+    execute(c, &in);
+    if (c->pc != 0x288) goto dispatch;
+L288: // A230 LD I, 0x230
+    STEP(0x288, 0xA230);
+    c->I = 0x230;
+L28A: // 7408 ADD V4, 0x08
+    STEP(0x28A, 0x7408);
+    V[4] += 0x08;
+L28C: // D457 DRW V4, V5, 7
+    STEP(0x28C, 0xD457);
+    c->pc = 0x28C;
+    predecode(0xD457, &in);
+    execute(c, &in);
+    if (c->pc != 0x28E) goto dispatch;
+L28E: // A292 LD I, 0x292
+    STEP(0x28E, 0xA292);
+    c->I = 0x292;
+L290: // 12AA JP 0x2AA
+    STEP(0x290, 0x12AA);
+    goto L2AA;
+L2AA: // 6411 LD V4, 0x11
+    STEP(0x2AA, 0x6411);
+    V[4] = 0x11;
+L2AC: // 6513 LD V5, 0x13
+    STEP(0x2AC, 0x6513);
+    V[5] = 0x13;
+L2AE: // D455 DRW V4, V5, 5
+    STEP(0x2AE, 0xD455);
+    c->pc = 0x2AE;
+    predecode(0xD455, &in);
+    execute(c, &in);
+    if (c->pc != 0x2B0) goto dispatch;
+L2B0: // 7408 ADD V4, 0x08
+    STEP(0x2B0, 0x7408);
+    V[4] += 0x08;
+L2B2: // A298 LD I, 0x298
+    STEP(0x2B2, 0xA298);
+    c->I = 0x298;
+L2B4: // D455 DRW V4, V5, 5
+    STEP(0x2B4, 0xD455);
+    c->pc = 0x2B4;
+    predecode(0xD455, &in);
+    execute(c, &in);
+    if (c->pc != 0x2B6) goto dispatch;
+L2B6: // 7409 ADD V4, 0x09
+    STEP(0x2B6, 0x7409);
+    V[4] += 0x09;
+L2B8: // A29E LD I, 0x29E
+    STEP(0x2B8, 0xA29E);
+    c->I = 0x29E;
+L2BA: // D455 DRW V4, V5, 5
+    STEP(0x2BA, 0xD455);
+    c->pc = 0x2BA;
+    predecode(0xD455, &in);
+    execute(c, &in);
+    if (c->pc != 0x2BC) goto dispatch;
+L2BC: // 7408 ADD V4, 0x08
+    STEP(0x2BC, 0x7408);
+    V[4] += 0x08;
+L2BE: // A2A4 LD I, 0x2A4
+    STEP(0x2BE, 0xA2A4);
+    c->I = 0x2A4;
+L2C0: // D455 DRW V4, V5, 5
+    STEP(0x2C0, 0xD455);
+    c->pc = 0x2C0;
+    predecode(0xD455, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C2) goto dispatch;
+L2C2: // 600F LD V0, 0x0F
+    STEP(0x2C2, 0x600F);
+    V[0] = 0x0F;
+L2C4: // E0A1 SKNP V0
+    STEP(0x2C4, 0xE0A1);
+    c->pc = 0x2C4;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C6) goto dispatch;
+L2C6: // 12CA JP 0x2CA
+    STEP(0x2C6, 0x12CA);
+    goto L2CA;
+L2C8: // 12C4 JP 0x2C4
+    STEP(0x2C8, 0x12C4);
+    goto L2C4;
+L2CA: // 00E0 CLS
+    STEP(0x2CA, 0x00E0);
+    c->pc = 0x2CA;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x2CC) goto dispatch;
+L2CC: // 651F LD V5, 0x1F
+    STEP(0x2CC, 0x651F);
+    V[5] = 0x1F;
+L2CE: // 660F LD V6, 0x0F
+    STEP(0x2CE, 0x660F);
+    V[6] = 0x0F;
+L2D0: // A207 LD I, 0x207
+    STEP(0x2D0, 0xA207);
+    c->I = 0x207;
+L2D2: // 6706 LD V7, 0x06
+    STEP(0x2D2, 0x6706);
+    V[7] = 0x06;
+L2D4: // 6802 LD V8, 0x02
+    STEP(0x2D4, 0x6802);
+    V[8] = 0x02;
+L2D6: // D561 DRW V5, V6, 1
+    STEP(0x2D6, 0xD561);
+    c->pc = 0x2D6;
+    predecode(0xD561, &in);
+    execute(c, &in);
+    if (c->pc != 0x2D8) goto dispatch;
+L2D8: // 4F01 SNE VF, 0x01
+    STEP(0x2D8, 0x4F01);
+    if (V[15] != 0x01) goto L2DC;
+L2DA: // 130E JP 0x30E
+    STEP(0x2DA, 0x130E);
+    goto L30E;
+L2DC: // F815 LD DT, V8
+    STEP(0x2DC, 0xF815);
+    c->dt = V[8];
+L2DE: // F007 LD V0, DT
+    STEP(0x2DE, 0xF007);
+    V[0] = c->dt;
+L2E0: // 3000 SE V0, 0x00
+    STEP(0x2E0, 0x3000);
+    if (V[0] == 0x00) goto L2E4;
+L2E2: // 12DE JP 0x2DE
+    STEP(0x2E2, 0x12DE);
+    goto L2DE;
+L2E4: // 6002 LD V0, 0x02
+    STEP(0x2E4, 0x6002);
+    V[0] = 0x02;
+L2E6: // E0A1 SKNP V0
+    STEP(0x2E6, 0xE0A1);
+    c->pc = 0x2E6;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2E8) goto dispatch;
+L2E8: // 6702 LD V7, 0x02
+    STEP(0x2E8, 0x6702);
+    V[7] = 0x02;
+L2EA: // 6004 LD V0, 0x04
+    STEP(0x2EA, 0x6004);
+    V[0] = 0x04;
+L2EC: // E0A1 SKNP V0
+    STEP(0x2EC, 0xE0A1);
+    c->pc = 0x2EC;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2EE) goto dispatch;
+L2EE: // 6704 LD V7, 0x04
+    STEP(0x2EE, 0x6704);
+    V[7] = 0x04;
+L2F0: // 6006 LD V0, 0x06
+    STEP(0x2F0, 0x6006);
+    V[0] = 0x06;
+L2F2: // E0A1 SKNP V0
+    STEP(0x2F2, 0xE0A1);
+    c->pc = 0x2F2;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2F4) goto dispatch;
+L2F4: // 6706 LD V7, 0x06
+    STEP(0x2F4, 0x6706);
+    V[7] = 0x06;
+L2F6: // 6008 LD V0, 0x08
+    STEP(0x2F6, 0x6008);
+    V[0] = 0x08;
+L2F8: // E0A1 SKNP V0
+    STEP(0x2F8, 0xE0A1);
+    c->pc = 0x2F8;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2FA) goto dispatch;
+L2FA: // 6708 LD V7, 0x08
+    STEP(0x2FA, 0x6708);
+    V[7] = 0x08;
+L2FC: // 4702 SNE V7, 0x02
+    STEP(0x2FC, 0x4702);
+    if (V[7] != 0x02) goto L300;
+L2FE: // 76FF ADD V6, 0xFF
+    STEP(0x2FE, 0x76FF);
+    V[6] += 0xFF;
+L300: // 4708 SNE V7, 0x08
+    STEP(0x300, 0x4708);
+    if (V[7] != 0x08) goto L304;
+L302: // 7601 ADD V6, 0x01
+    STEP(0x302, 0x7601);
+    V[6] += 0x01;
+L304: // 4704 SNE V7, 0x04
+    STEP(0x304, 0x4704);
+    if (V[7] != 0x04) goto L308;
+L306: // 75FF ADD V5, 0xFF
+    STEP(0x306, 0x75FF);
+    V[5] += 0xFF;
+L308: // 4706 SNE V7, 0x06
+    STEP(0x308, 0x4706);
+    if (V[7] != 0x06) goto L30C;
+L30A: // 7501 ADD V5, 0x01
+    STEP(0x30A, 0x7501);
+    V[5] += 0x01;
+L30C: // 12D6 JP 0x2D6
+    STEP(0x30C, 0x12D6);
+    goto L2D6;
+L30E: // 6006 LD V0, 0x06
+    STEP(0x30E, 0x6006);
+    V[0] = 0x06;
+L310: // F018 LD ST, V0
+    STEP(0x310, 0xF018);
+    c->st = V[0];
+L312: // 600F LD V0, 0x0F
+    STEP(0x312, 0x600F);
+    V[0] = 0x0F;
+L314: // E09E SKP V0
+    STEP(0x314, 0xE09E);
+    c->pc = 0x314;
+    predecode(0xE09E, &in);
+    execute(c, &in);
+    if (c->pc != 0x316) goto dispatch;
+L316: // 1314 JP 0x314
+    STEP(0x316, 0x1314);
+    goto L314;
+L318: // 00E0 CLS
+    STEP(0x318, 0x00E0);
+    c->pc = 0x318;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x31A) goto dispatch;
+L31A: // 12CC JP 0x2CC
+    STEP(0x31A, 0x12CC);
+    goto L2CC;
+}
@@ -0,0 +1,1014 @@
+// generated by chip8-aot from roms/TETRIS.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0xA2, 0xB4, 0x23, 0xE6, 0x22, 0xB6, 0x70, 0x01, 0xD0, 0x11, 0x30, 0x25,
+    0x12, 0x06, 0x71, 0xFF, 0xD0, 0x11, 0x60, 0x1A, 0xD0, 0x11, 0x60, 0x25,
+    0x31, 0x00, 0x12, 0x0E, 0xC4, 0x70, 0x44, 0x70, 0x12, 0x1C, 0xC3, 0x03,
+    0x60, 0x1E, 0x61, 0x03, 0x22, 0x5C, 0xF5, 0x15, 0xD0, 0x14, 0x3F, 0x01,
+    0x12, 0x3C, 0xD0, 0x14, 0x71, 0xFF, 0xD0, 0x14, 0x23, 0x40, 0x12, 0x1C,
+    0xE7, 0xA1, 0x22, 0x72, 0xE8, 0xA1, 0x22, 0x84, 0xE9, 0xA1, 0x22, 0x96,
+    0xE2, 0x9E, 0x12, 0x50, 0x66, 0x00, 0xF6, 0x15, 0xF6, 0x07, 0x36, 0x00,
+    0x12, 0x3C, 0xD0, 0x14, 0x71, 0x01, 0x12, 0x2A, 0xA2, 0xC4, 0xF4, 0x1E,
+    0x66, 0x00, 0x43, 0x01, 0x66, 0x04, 0x43, 0x02, 0x66, 0x08, 0x43, 0x03,
+    0x66, 0x0C, 0xF6, 0x1E, 0x00, 0xEE, 0xD0, 0x14, 0x70, 0xFF, 0x23, 0x34,
+    0x3F, 0x01, 0x00, 0xEE, 0xD0, 0x14, 0x70, 0x01, 0x23, 0x34, 0x00, 0xEE,
+    0xD0, 0x14, 0x70, 0x01, 0x23, 0x34, 0x3F, 0x01, 0x00, 0xEE, 0xD0, 0x14,
+    0x70, 0xFF, 0x23, 0x34, 0x00, 0xEE, 0xD0, 0x14, 0x73, 0x01, 0x43, 0x04,
+    0x63, 0x00, 0x22, 0x5C, 0x23, 0x34, 0x3F, 0x01, 0x00, 0xEE, 0xD0, 0x14,
+    0x73, 0xFF, 0x43, 0xFF, 0x63, 0x03, 0x22, 0x5C, 0x23, 0x34, 0x00, 0xEE,
+    0x80, 0x00, 0x67, 0x05, 0x68, 0x06, 0x69, 0x04, 0x61, 0x1F, 0x65, 0x10,
+    0x62, 0x07, 0x00, 0xEE, 0x40, 0xE0, 0x00, 0x00, 0x40, 0xC0, 0x40, 0x00,
+    0x00, 0xE0, 0x40, 0x00, 0x40, 0x60, 0x40, 0x00, 0x40, 0x40, 0x60, 0x00,
+    0x20, 0xE0, 0x00, 0x00, 0xC0, 0x40, 0x40, 0x00, 0x00, 0xE0, 0x80, 0x00,
+    0x40, 0x40, 0xC0, 0x00, 0x00, 0xE0, 0x20, 0x00, 0x60, 0x40, 0x40, 0x00,
+    0x80, 0xE0, 0x00, 0x00, 0x40, 0xC0, 0x80, 0x00, 0xC0, 0x60, 0x00, 0x00,
+    0x40, 0xC0, 0x80, 0x00, 0xC0, 0x60, 0x00, 0x00, 0x80, 0xC0, 0x40, 0x00,
+    0x00, 0x60, 0xC0, 0x00, 0x80, 0xC0, 0x40, 0x00, 0x00, 0x60, 0xC0, 0x00,
+    0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00, 0xC0, 0xC0, 0x00, 0x00,
+    0xC0, 0xC0, 0x00, 0x00, 0x40, 0x40, 0x40, 0x40, 0x00, 0xF0, 0x00, 0x00,
+    0x40, 0x40, 0x40, 0x40, 0x00, 0xF0, 0x00, 0x00, 0xD0, 0x14, 0x66, 0x35,
+    0x76, 0xFF, 0x36, 0x00, 0x13, 0x38, 0x00, 0xEE, 0xA2, 0xB4, 0x8C, 0x10,
+    0x3C, 0x1E, 0x7C, 0x01, 0x3C, 0x1E, 0x7C, 0x01, 0x3C, 0x1E, 0x7C, 0x01,
+    0x23, 0x5E, 0x4B, 0x0A, 0x23, 0x72, 0x91, 0xC0, 0x00, 0xEE, 0x71, 0x01,
+    0x13, 0x50, 0x60, 0x1B, 0x6B, 0x00, 0xD0, 0x11, 0x3F, 0x00, 0x7B, 0x01,
+    0xD0, 0x11, 0x70, 0x01, 0x30, 0x25, 0x13, 0x62, 0x00, 0xEE, 0x60, 0x1B,
+    0xD0, 0x11, 0x70, 0x01, 0x30, 0x25, 0x13, 0x74, 0x8E, 0x10, 0x8D, 0xE0,
+    0x7E, 0xFF, 0x60, 0x1B, 0x6B, 0x00, 0xD0, 0xE1, 0x3F, 0x00, 0x13, 0x90,
+    0xD0, 0xE1, 0x13, 0x94, 0xD0, 0xD1, 0x7B, 0x01, 0x70, 0x01, 0x30, 0x25,
+    0x13, 0x86, 0x4B, 0x00, 0x13, 0xA6, 0x7D, 0xFF, 0x7E, 0xFF, 0x3D, 0x01,
+    0x13, 0x82, 0x23, 0xC0, 0x3F, 0x01, 0x23, 0xC0, 0x7A, 0x01, 0x23, 0xC0,
+    0x80, 0xA0, 0x6D, 0x07, 0x80, 0xD2, 0x40, 0x04, 0x75, 0xFE, 0x45, 0x02,
+    0x65, 0x04, 0x00, 0xEE, 0xA7, 0x00, 0xF2, 0x55, 0xA8, 0x04, 0xFA, 0x33,
+    0xF2, 0x65, 0xF0, 0x29, 0x6D, 0x32, 0x6E, 0x00, 0xDD, 0xE5, 0x7D, 0x05,
+    0xF1, 0x29, 0xDD, 0xE5, 0x7D, 0x05, 0xF2, 0x29, 0xDD, 0xE5, 0xA7, 0x00,
+    0xF2, 0x65, 0xA2, 0xB4, 0x00, 0xEE, 0x6A, 0x00, 0x60, 0x19, 0x00, 0xEE,
+    0x37, 0x23,
+};
+const size_t aot_rom_size = 494;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x000000000000FF00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x334: goto L334;
+        case 0x336: goto L336;
+        case 0x338: goto L338;
+        case 0x33A: goto L33A;
+        case 0x33C: goto L33C;
+        case 0x33E: goto L33E;
+        case 0x340: goto L340;
+        case 0x342: goto L342;
+        case 0x344: goto L344;
+        case 0x346: goto L346;
+        case 0x348: goto L348;
+        case 0x34A: goto L34A;
+        case 0x34C: goto L34C;
+        case 0x34E: goto L34E;
+        case 0x350: goto L350;
+        case 0x352: goto L352;
+        case 0x354: goto L354;
+        case 0x356: goto L356;
+        case 0x358: goto L358;
+        case 0x35A: goto L35A;
+        case 0x35C: goto L35C;
+        case 0x35E: goto L35E;
+        case 0x360: goto L360;
+        case 0x362: goto L362;
+        case 0x364: goto L364;
+        case 0x366: goto L366;
+        case 0x368: goto L368;
+        case 0x36A: goto L36A;
+        case 0x36C: goto L36C;
+        case 0x36E: goto L36E;
+        case 0x370: goto L370;
+        case 0x372: goto L372;
+        case 0x374: goto L374;
+        case 0x376: goto L376;
+        case 0x378: goto L378;
+        case 0x37A: goto L37A;
+        case 0x37C: goto L37C;
+        case 0x37E: goto L37E;
+        case 0x380: goto L380;
+        case 0x382: goto L382;
+        case 0x384: goto L384;
+        case 0x386: goto L386;
+        case 0x388: goto L388;
+        case 0x38A: goto L38A;
+        case 0x38C: goto L38C;
+        case 0x38E: goto L38E;
+        case 0x390: goto L390;
+        case 0x392: goto L392;
+        case 0x394: goto L394;
+        case 0x396: goto L396;
+        case 0x398: goto L398;
+        case 0x39A: goto L39A;
+        case 0x39C: goto L39C;
+        case 0x39E: goto L39E;
+        case 0x3A0: goto L3A0;
+        case 0x3A2: goto L3A2;
+        case 0x3A4: goto L3A4;
+        case 0x3A6: goto L3A6;
+        case 0x3A8: goto L3A8;
+        case 0x3AA: goto L3AA;
+        case 0x3AC: goto L3AC;
+        case 0x3AE: goto L3AE;
+        case 0x3B0: goto L3B0;
+        case 0x3B2: goto L3B2;
+        case 0x3B4: goto L3B4;
+        case 0x3B6: goto L3B6;
+        case 0x3B8: goto L3B8;
+        case 0x3BA: goto L3BA;
+        case 0x3BC: goto L3BC;
+        case 0x3BE: goto L3BE;
+        case 0x3C0: goto L3C0;
+        case 0x3C2: goto L3C2;
+        case 0x3C4: goto L3C4;
+        case 0x3C6: goto L3C6;
+        case 0x3C8: goto L3C8;
+        case 0x3CA: goto L3CA;
+        case 0x3CC: goto L3CC;
+        case 0x3CE: goto L3CE;
+        case 0x3D0: goto L3D0;
+        case 0x3D2: goto L3D2;
+        case 0x3D4: goto L3D4;
+        case 0x3D6: goto L3D6;
+        case 0x3D8: goto L3D8;
+        case 0x3DA: goto L3DA;
+        case 0x3DC: goto L3DC;
+        case 0x3DE: goto L3DE;
+        case 0x3E0: goto L3E0;
+        case 0x3E2: goto L3E2;
+        case 0x3E4: goto L3E4;
+        case 0x3E6: goto L3E6;
+        case 0x3E8: goto L3E8;
+        case 0x3EA: goto L3EA;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // A2B4 LD I, 0x2B4
+    STEP(0x200, 0xA2B4);
+    c->I = 0x2B4;
+L202: // 23E6 CALL 0x3E6
+    STEP(0x202, 0x23E6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x202;
+    goto L3E6;
+L204: // 22B6 CALL 0x2B6
+    STEP(0x204, 0x22B6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x204;
+    goto L2B6;
+L206: // 7001 ADD V0, 0x01
+    STEP(0x206, 0x7001);
+    V[0] += 0x01;
+L208: // D011 DRW V0, V1, 1
+    STEP(0x208, 0xD011);
+    c->pc = 0x208;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x20A) goto dispatch;
+L20A: // 3025 SE V0, 0x25
+    STEP(0x20A, 0x3025);
+    if (V[0] == 0x25) goto L20E;
+L20C: // 1206 JP 0x206
+    STEP(0x20C, 0x1206);
+    goto L206;
+L20E: // 71FF ADD V1, 0xFF
+    STEP(0x20E, 0x71FF);
+    V[1] += 0xFF;
+L210: // D011 DRW V0, V1, 1
+    STEP(0x210, 0xD011);
+    c->pc = 0x210;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x212) goto dispatch;
+L212: // 601A LD V0, 0x1A
+    STEP(0x212, 0x601A);
+    V[0] = 0x1A;
+L214: // D011 DRW V0, V1, 1
+    STEP(0x214, 0xD011);
+    c->pc = 0x214;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x216) goto dispatch;
+L216: // 6025 LD V0, 0x25
+    STEP(0x216, 0x6025);
+    V[0] = 0x25;
+L218: // 3100 SE V1, 0x00
+    STEP(0x218, 0x3100);
+    if (V[1] == 0x00) goto L21C;
+L21A: // 120E JP 0x20E
+    STEP(0x21A, 0x120E);
+    goto L20E;
+L21C: // C470 RND V4, 0x70
+    STEP(0x21C, 0xC470);
+    c->pc = 0x21C;
+    predecode(0xC470, &in);
+    execute(c, &in);
+    if (c->pc != 0x21E) goto dispatch;
+L21E: // 4470 SNE V4, 0x70
+    STEP(0x21E, 0x4470);
+    if (V[4] != 0x70) goto L222;
+L220: // 121C JP 0x21C
+    STEP(0x220, 0x121C);
+    goto L21C;
+L222: // C303 RND V3, 0x03
+    STEP(0x222, 0xC303);
+    c->pc = 0x222;
+    predecode(0xC303, &in);
+    execute(c, &in);
+    if (c->pc != 0x224) goto dispatch;
+L224: // 601E LD V0, 0x1E
+    STEP(0x224, 0x601E);
+    V[0] = 0x1E;
+L226: // 6103 LD V1, 0x03
+    STEP(0x226, 0x6103);
+    V[1] = 0x03;
+L228: // 225C CALL 0x25C
+    STEP(0x228, 0x225C);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x228;
+    goto L25C;
+L22A: // F515 LD DT, V5
+    STEP(0x22A, 0xF515);
+    c->dt = V[5];
+L22C: // D014 DRW V0, V1, 4
+    STEP(0x22C, 0xD014);
+    c->pc = 0x22C;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x22E) goto dispatch;
+L22E: // 3F01 SE VF, 0x01
+    STEP(0x22E, 0x3F01);
+    if (V[15] == 0x01) goto L232;
+L230: // 123C JP 0x23C
+    STEP(0x230, 0x123C);
+    goto L23C;
+L232: // D014 DRW V0, V1, 4
+    STEP(0x232, 0xD014);
+    c->pc = 0x232;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x234) goto dispatch;
+L234: // 71FF ADD V1, 0xFF
+    STEP(0x234, 0x71FF);
+    V[1] += 0xFF;
+L236: // D014 DRW V0, V1, 4
+    STEP(0x236, 0xD014);
+    c->pc = 0x236;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x238) goto dispatch;
+L238: // 2340 CALL 0x340
+    STEP(0x238, 0x2340);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x238;
+    goto L340;
+L23A: // 121C JP 0x21C
+    STEP(0x23A, 0x121C);
+    goto L21C;
+L23C: // E7A1 SKNP V7
+    STEP(0x23C, 0xE7A1);
+    c->pc = 0x23C;
+    predecode(0xE7A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x23E) goto dispatch;
+L23E: // 2272 CALL 0x272
+    STEP(0x23E, 0x2272);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x23E;
+    goto L272;
+L240: // E8A1 SKNP V8
+    STEP(0x240, 0xE8A1);
+    c->pc = 0x240;
+    predecode(0xE8A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x242) goto dispatch;
+L242: // 2284 CALL 0x284
+    STEP(0x242, 0x2284);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x242;
+    goto L284;
+L244: // E9A1 SKNP V9
+    STEP(0x244, 0xE9A1);
+    c->pc = 0x244;
+    predecode(0xE9A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x246) goto dispatch;
+L246: // 2296 CALL 0x296
+    STEP(0x246, 0x2296);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x246;
+    goto L296;
+L248: // E29E SKP V2
+    STEP(0x248, 0xE29E);
+    c->pc = 0x248;
+    predecode(0xE29E, &in);
+    execute(c, &in);
+    if (c->pc != 0x24A) goto dispatch;
+L24A: // 1250 JP 0x250
+    STEP(0x24A, 0x1250);
+    goto L250;
+L24C: // 6600 LD V6, 0x00
+    STEP(0x24C, 0x6600);
+    V[6] = 0x00;
+L24E: // F615 LD DT, V6
+    STEP(0x24E, 0xF615);
+    c->dt = V[6];
+L250: // F607 LD V6, DT
+    STEP(0x250, 0xF607);
+    V[6] = c->dt;
+L252: // 3600 SE V6, 0x00
+    STEP(0x252, 0x3600);
+    if (V[6] == 0x00) goto L256;
+L254: // 123C JP 0x23C
+    STEP(0x254, 0x123C);
+    goto L23C;
+L256: // D014 DRW V0, V1, 4
+    STEP(0x256, 0xD014);
+    c->pc = 0x256;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x258) goto dispatch;
+L258: // 7101 ADD V1, 0x01
+    STEP(0x258, 0x7101);
+    V[1] += 0x01;
+L25A: // 122A JP 0x22A
+    STEP(0x25A, 0x122A);
+    goto L22A;
+L25C: // A2C4 LD I, 0x2C4
+    STEP(0x25C, 0xA2C4);
+    c->I = 0x2C4;
+L25E: // F41E ADD I, V4
+    STEP(0x25E, 0xF41E);
+    c->I += V[4];
+L260: // 6600 LD V6, 0x00
+    STEP(0x260, 0x6600);
+    V[6] = 0x00;
+L262: // 4301 SNE V3, 0x01
+    STEP(0x262, 0x4301);
+    if (V[3] != 0x01) goto L266;
+L264: // 6604 LD V6, 0x04
+    STEP(0x264, 0x6604);
+    V[6] = 0x04;
+L266: // 4302 SNE V3, 0x02
+    STEP(0x266, 0x4302);
+    if (V[3] != 0x02) goto L26A;
+L268: // 6608 LD V6, 0x08
+    STEP(0x268, 0x6608);
+    V[6] = 0x08;
+L26A: // 4303 SNE V3, 0x03
+    STEP(0x26A, 0x4303);
+    if (V[3] != 0x03) goto L26E;
+L26C: // 660C LD V6, 0x0C
+    STEP(0x26C, 0x660C);
+    V[6] = 0x0C;
+L26E: // F61E ADD I, V6
+    STEP(0x26E, 0xF61E);
+    c->I += V[6];
+L270: // 00EE RET
+    STEP(0x270, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L272: // D014 DRW V0, V1, 4
+    STEP(0x272, 0xD014);
+    c->pc = 0x272;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x274) goto dispatch;
+L274: // 70FF ADD V0, 0xFF
+    STEP(0x274, 0x70FF);
+    V[0] += 0xFF;
+L276: // 2334 CALL 0x334
+    STEP(0x276, 0x2334);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x276;
+    goto L334;
+L278: // 3F01 SE VF, 0x01
+    STEP(0x278, 0x3F01);
+    if (V[15] == 0x01) goto L27C;
+L27A: // 00EE RET
+    STEP(0x27A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L27C: // D014 DRW V0, V1, 4
+    STEP(0x27C, 0xD014);
+    c->pc = 0x27C;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x27E) goto dispatch;
+L27E: // 7001 ADD V0, 0x01
+    STEP(0x27E, 0x7001);
+    V[0] += 0x01;
+L280: // 2334 CALL 0x334
+    STEP(0x280, 0x2334);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x280;
+    goto L334;
+L282: // 00EE RET
+    STEP(0x282, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L284: // D014 DRW V0, V1, 4
+    STEP(0x284, 0xD014);
+    c->pc = 0x284;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x286) goto dispatch;
+L286: // 7001 ADD V0, 0x01
+    STEP(0x286, 0x7001);
+    V[0] += 0x01;
+L288: // 2334 CALL 0x334
+    STEP(0x288, 0x2334);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x288;
+    goto L334;
+L28A: // 3F01 SE VF, 0x01
+    STEP(0x28A, 0x3F01);
+    if (V[15] == 0x01) goto L28E;
+L28C: // 00EE RET
+    STEP(0x28C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L28E: // D014 DRW V0, V1, 4
+    STEP(0x28E, 0xD014);
+    c->pc = 0x28E;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x290) goto dispatch;
+L290: // 70FF ADD V0, 0xFF
+    STEP(0x290, 0x70FF);
+    V[0] += 0xFF;
+L292: // 2334 CALL 0x334
+    STEP(0x292, 0x2334);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x292;
+    goto L334;
+L294: // 00EE RET
+    STEP(0x294, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L296: // D014 DRW V0, V1, 4
+    STEP(0x296, 0xD014);
+    c->pc = 0x296;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x298) goto dispatch;
+L298: // 7301 ADD V3, 0x01
+    STEP(0x298, 0x7301);
+    V[3] += 0x01;
+L29A: // 4304 SNE V3, 0x04
+    STEP(0x29A, 0x4304);
+    if (V[3] != 0x04) goto L29E;
+L29C: // 6300 LD V3, 0x00
+    STEP(0x29C, 0x6300);
+    V[3] = 0x00;
+L29E: // 225C CALL 0x25C
+    STEP(0x29E, 0x225C);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x29E;
+    goto L25C;
+L2A0: // 2334 CALL 0x334
+    STEP(0x2A0, 0x2334);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2A0;
+    goto L334;
+L2A2: // 3F01 SE VF, 0x01
+    STEP(0x2A2, 0x3F01);
+    if (V[15] == 0x01) goto L2A6;
+L2A4: // 00EE RET
+    STEP(0x2A4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2A6: // D014 DRW V0, V1, 4
+    STEP(0x2A6, 0xD014);
+    c->pc = 0x2A6;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A8) goto dispatch;
+L2A8: // 73FF ADD V3, 0xFF
+    STEP(0x2A8, 0x73FF);
+    V[3] += 0xFF;
+L2AA: // 43FF SNE V3, 0xFF
+    STEP(0x2AA, 0x43FF);
+    if (V[3] != 0xFF) goto L2AE;
+L2AC: // 6303 LD V3, 0x03
+    STEP(0x2AC, 0x6303);
+    V[3] = 0x03;
+L2AE: // 225C CALL 0x25C
+    STEP(0x2AE, 0x225C);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2AE;
+    goto L25C;
+L2B0: // 2334 CALL 0x334
+    STEP(0x2B0, 0x2334);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2B0;
+    goto L334;
+L2B2: // 00EE RET
+    STEP(0x2B2, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2B6: // 6705 LD V7, 0x05
+    STEP(0x2B6, 0x6705);
+    V[7] = 0x05;
+L2B8: // 6806 LD V8, 0x06
+    STEP(0x2B8, 0x6806);
+    V[8] = 0x06;
+L2BA: // 6904 LD V9, 0x04
+    STEP(0x2BA, 0x6904);
+    V[9] = 0x04;
+L2BC: // 611F LD V1, 0x1F
+    STEP(0x2BC, 0x611F);
+    V[1] = 0x1F;
+L2BE: // 6510 LD V5, 0x10
+    STEP(0x2BE, 0x6510);
+    V[5] = 0x10;
+L2C0: // 6207 LD V2, 0x07
+    STEP(0x2C0, 0x6207);
+    V[2] = 0x07;
+L2C2: // 00EE RET
+    STEP(0x2C2, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L334: // D014 DRW V0, V1, 4
+    STEP(0x334, 0xD014);
+    c->pc = 0x334;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x336) goto dispatch;
+L336: // 6635 LD V6, 0x35
+    STEP(0x336, 0x6635);
+    V[6] = 0x35;
+L338: // 76FF ADD V6, 0xFF
+    STEP(0x338, 0x76FF);
+    V[6] += 0xFF;
+L33A: // 3600 SE V6, 0x00
+    STEP(0x33A, 0x3600);
+    if (V[6] == 0x00) goto L33E;
+L33C: // 1338 JP 0x338
+    STEP(0x33C, 0x1338);
+    goto L338;
+L33E: // 00EE RET
+    STEP(0x33E, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L340: // A2B4 LD I, 0x2B4
+    STEP(0x340, 0xA2B4);
+    c->I = 0x2B4;
+L342: // 8C10 LD VC, V1
+    STEP(0x342, 0x8C10);
+    V[12] = V[1];
+L344: // 3C1E SE VC, 0x1E
+    STEP(0x344, 0x3C1E);
+    if (V[12] == 0x1E) goto L348;
+L346: // 7C01 ADD VC, 0x01
+    STEP(0x346, 0x7C01);
+    V[12] += 0x01;
+L348: // 3C1E SE VC, 0x1E
+    STEP(0x348, 0x3C1E);
+    if (V[12] == 0x1E) goto L34C;
+L34A: // 7C01 ADD VC, 0x01
+    STEP(0x34A, 0x7C01);
+    V[12] += 0x01;
+L34C: // 3C1E SE VC, 0x1E
+    STEP(0x34C, 0x3C1E);
+    if (V[12] == 0x1E) goto L350;
+L34E: // 7C01 ADD VC, 0x01
+    STEP(0x34E, 0x7C01);
+    V[12] += 0x01;
+L350: // 235E CALL 0x35E
+    STEP(0x350, 0x235E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x350;
+    goto L35E;
+L352: // 4B0A SNE VB, 0x0A
+    STEP(0x352, 0x4B0A);
+    if (V[11] != 0x0A) goto L356;
+L354: // 2372 CALL 0x372
+    STEP(0x354, 0x2372);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x354;
+    goto L372;
+L356: // 91C0 SNE V1, VC
+    STEP(0x356, 0x91C0);
+    if (V[1] != V[12]) goto L35A;
+L358: // 00EE RET
+    STEP(0x358, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L35A: // 7101 ADD V1, 0x01
+    STEP(0x35A, 0x7101);
+    V[1] += 0x01;
+L35C: // 1350 JP 0x350
+    STEP(0x35C, 0x1350);
+    goto L350;
+L35E: // 601B LD V0, 0x1B
+    STEP(0x35E, 0x601B);
+    V[0] = 0x1B;
+L360: // 6B00 LD VB, 0x00
+    STEP(0x360, 0x6B00);
+    V[11] = 0x00;
+L362: // D011 DRW V0, V1, 1
+    STEP(0x362, 0xD011);
+    c->pc = 0x362;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x364) goto dispatch;
+L364: // 3F00 SE VF, 0x00
+    STEP(0x364, 0x3F00);
+    if (V[15] == 0x00) goto L368;
+L366: // 7B01 ADD VB, 0x01
+    STEP(0x366, 0x7B01);
+    V[11] += 0x01;
+L368: // D011 DRW V0, V1, 1
+    STEP(0x368, 0xD011);
+    c->pc = 0x368;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x36A) goto dispatch;
+L36A: // 7001 ADD V0, 0x01
+    STEP(0x36A, 0x7001);
+    V[0] += 0x01;
+L36C: // 3025 SE V0, 0x25
+    STEP(0x36C, 0x3025);
+    if (V[0] == 0x25) goto L370;
+L36E: // 1362 JP 0x362
+    STEP(0x36E, 0x1362);
+    goto L362;
+L370: // 00EE RET
+    STEP(0x370, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L372: // 601B LD V0, 0x1B
+    STEP(0x372, 0x601B);
+    V[0] = 0x1B;
+L374: // D011 DRW V0, V1, 1
+    STEP(0x374, 0xD011);
+    c->pc = 0x374;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x376) goto dispatch;
+L376: // 7001 ADD V0, 0x01
+    STEP(0x376, 0x7001);
+    V[0] += 0x01;
+L378: // 3025 SE V0, 0x25
+    STEP(0x378, 0x3025);
+    if (V[0] == 0x25) goto L37C;
+L37A: // 1374 JP 0x374
+    STEP(0x37A, 0x1374);
+    goto L374;
+L37C: // 8E10 LD VE, V1
+    STEP(0x37C, 0x8E10);
+    V[14] = V[1];
+L37E: // 8DE0 LD VD, VE
+    STEP(0x37E, 0x8DE0);
+    V[13] = V[14];
+L380: // 7EFF ADD VE, 0xFF
+    STEP(0x380, 0x7EFF);
+    V[14] += 0xFF;
+L382: // 601B LD V0, 0x1B
+    STEP(0x382, 0x601B);
+    V[0] = 0x1B;
+L384: // 6B00 LD VB, 0x00
+    STEP(0x384, 0x6B00);
+    V[11] = 0x00;
+L386: // D0E1 DRW V0, VE, 1
+    STEP(0x386, 0xD0E1);
+    c->pc = 0x386;
+    predecode(0xD0E1, &in);
+    execute(c, &in);
+    if (c->pc != 0x388) goto dispatch;
+L388: // 3F00 SE VF, 0x00
+    STEP(0x388, 0x3F00);
+    if (V[15] == 0x00) goto L38C;
+L38A: // 1390 JP 0x390
+    STEP(0x38A, 0x1390);
+    goto L390;
+L38C: // D0E1 DRW V0, VE, 1
+    STEP(0x38C, 0xD0E1);
+    c->pc = 0x38C;
+    predecode(0xD0E1, &in);
+    execute(c, &in);
+    if (c->pc != 0x38E) goto dispatch;
+L38E: // 1394 JP 0x394
+    STEP(0x38E, 0x1394);
+    goto L394;
+L390: // D0D1 DRW V0, VD, 1
+    STEP(0x390, 0xD0D1);
+    c->pc = 0x390;
+    predecode(0xD0D1, &in);
+    execute(c, &in);
+    if (c->pc != 0x392) goto dispatch;
+L392: // 7B01 ADD VB, 0x01
+    STEP(0x392, 0x7B01);
+    V[11] += 0x01;
+L394: // 7001 ADD V0, 0x01
+    STEP(0x394, 0x7001);
+    V[0] += 0x01;
+L396: // 3025 SE V0, 0x25
+    STEP(0x396, 0x3025);
+    if (V[0] == 0x25) goto L39A;
+L398: // 1386 JP 0x386
+    STEP(0x398, 0x1386);
+    goto L386;
+L39A: // 4B00 SNE VB, 0x00
+    STEP(0x39A, 0x4B00);
+    if (V[11] != 0x00) goto L39E;
+L39C: // 13A6 JP 0x3A6
+    STEP(0x39C, 0x13A6);
+    goto L3A6;
+L39E: // 7DFF ADD VD, 0xFF
+    STEP(0x39E, 0x7DFF);
+    V[13] += 0xFF;
+L3A0: // 7EFF ADD VE, 0xFF
+    STEP(0x3A0, 0x7EFF);
+    V[14] += 0xFF;
+L3A2: // 3D01 SE VD, 0x01
+    STEP(0x3A2, 0x3D01);
+    if (V[13] == 0x01) goto L3A6;
+L3A4: // 1382 JP 0x382
+    STEP(0x3A4, 0x1382);
+    goto L382;
+L3A6: // 23C0 CALL 0x3C0
+    STEP(0x3A6, 0x23C0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x3A6;
+    goto L3C0;
+L3A8: // 3F01 SE VF, 0x01
+    STEP(0x3A8, 0x3F01);
+    if (V[15] == 0x01) goto L3AC;
+L3AA: // 23C0 CALL 0x3C0
+    STEP(0x3AA, 0x23C0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x3AA;
+    goto L3C0;
+L3AC: // 7A01 ADD VA, 0x01
+    STEP(0x3AC, 0x7A01);
+    V[10] += 0x01;
+L3AE: // 23C0 CALL 0x3C0
+    STEP(0x3AE, 0x23C0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x3AE;
+    goto L3C0;
+L3B0: // 80A0 LD V0, VA
+    STEP(0x3B0, 0x80A0);
+    V[0] = V[10];
+L3B2: // 6D07 LD VD, 0x07
+    STEP(0x3B2, 0x6D07);
+    V[13] = 0x07;
+L3B4: // 80D2 AND V0, VD
+    STEP(0x3B4, 0x80D2);
+    V[0] &= V[13];
+L3B6: // 4004 SNE V0, 0x04
+    STEP(0x3B6, 0x4004);
+    if (V[0] != 0x04) goto L3BA;
+L3B8: // 75FE ADD V5, 0xFE
+    STEP(0x3B8, 0x75FE);
+    V[5] += 0xFE;
+L3BA: // 4502 SNE V5, 0x02
+    STEP(0x3BA, 0x4502);
+    if (V[5] != 0x02) goto L3BE;
+L3BC: // 6504 LD V5, 0x04
+    STEP(0x3BC, 0x6504);
+    V[5] = 0x04;
+L3BE: // 00EE RET
+    STEP(0x3BE, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3C0: // A700 LD I, 0x700
+    STEP(0x3C0, 0xA700);
+    c->I = 0x700;
+L3C2: // F255 LD [I], V2
+    STEP(0x3C2, 0xF255);
+    c->pc = 0x3C2;
+    predecode(0xF255, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x3C4) goto dispatch;
+L3C4: // A804 LD I, 0x804
+    STEP(0x3C4, 0xA804);
+    c->I = 0x804;
+L3C6: // FA33 LD B, VA
+    STEP(0x3C6, 0xFA33);
+    c->pc = 0x3C6;
+    predecode(0xFA33, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x3C8) goto dispatch;
+L3C8: // F265 LD V2, [I]
+    STEP(0x3C8, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L3CA: // F029 LD F, V0
+    STEP(0x3CA, 0xF029);
+    c->I = V[0] * 5;
+L3CC: // 6D32 LD VD, 0x32
+    STEP(0x3CC, 0x6D32);
+    V[13] = 0x32;
+L3CE: // 6E00 LD VE, 0x00
+    STEP(0x3CE, 0x6E00);
+    V[14] = 0x00;
+L3D0: // DDE5 DRW VD, VE, 5
+    STEP(0x3D0, 0xDDE5);
+    c->pc = 0x3D0;
+    predecode(0xDDE5, &in);
+    execute(c, &in);
+    if (c->pc != 0x3D2) goto dispatch;
+L3D2: // 7D05 ADD VD, 0x05
+    STEP(0x3D2, 0x7D05);
+    V[13] += 0x05;
+L3D4: // F129 LD F, V1
+    STEP(0x3D4, 0xF129);
+    c->I = V[1] * 5;
+L3D6: // DDE5 DRW VD, VE, 5
+    STEP(0x3D6, 0xDDE5);
+    c->pc = 0x3D6;
+    predecode(0xDDE5, &in);
+    execute(c, &in);
+    if (c->pc != 0x3D8) goto dispatch;
+L3D8: // 7D05 ADD VD, 0x05
+    STEP(0x3D8, 0x7D05);
+    V[13] += 0x05;
+L3DA: // F229 LD F, V2
+    STEP(0x3DA, 0xF229);
+    c->I = V[2] * 5;
+L3DC: // DDE5 DRW VD, VE, 5
+    STEP(0x3DC, 0xDDE5);
+    c->pc = 0x3DC;
+    predecode(0xDDE5, &in);
+    execute(c, &in);
+    if (c->pc != 0x3DE) goto dispatch;
+L3DE: // A700 LD I, 0x700
+    STEP(0x3DE, 0xA700);
+    c->I = 0x700;
+L3E0: // F265 LD V2, [I]
+    STEP(0x3E0, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L3E2: // A2B4 LD I, 0x2B4
+    STEP(0x3E2, 0xA2B4);
+    c->I = 0x2B4;
+L3E4: // 00EE RET
+    STEP(0x3E4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3E6: // 6A00 LD VA, 0x00
+    STEP(0x3E6, 0x6A00);
+    V[10] = 0x00;
+L3E8: // 6019 LD V0, 0x19
+    STEP(0x3E8, 0x6019);
+    V[0] = 0x19;
+L3EA: // 00EE RET
+    STEP(0x3EA, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,1037 @@
+// generated by chip8-aot from roms/TICTAC.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x12, 0x18, 0x54, 0x49, 0x43, 0x54, 0x41, 0x43, 0x20, 0x62, 0x79, 0x20,
+    0x44, 0x61, 0x76, 0x69, 0x64, 0x20, 0x57, 0x49, 0x4E, 0x54, 0x45, 0x52,
+    0x6B, 0x00, 0x6C, 0x00, 0x80, 0xB0, 0x81, 0xC0, 0xA3, 0xE6, 0xF1, 0x55,
+    0xA3, 0xC4, 0xFF, 0x65, 0xA3, 0xB4, 0xFF, 0x55, 0xA3, 0xE6, 0xF1, 0x65,
+    0x8B, 0x00, 0x8C, 0x10, 0x00, 0xE0, 0x6E, 0x01, 0x60, 0x13, 0x61, 0x03,
+    0xA3, 0x9A, 0xD0, 0x11, 0x70, 0x08, 0x30, 0x2B, 0x12, 0x3E, 0x60, 0x13,
+    0x71, 0x08, 0x31, 0x23, 0x12, 0x3E, 0x60, 0x13, 0x61, 0x03, 0xA3, 0x9B,
+    0xD0, 0x1F, 0x70, 0x08, 0x30, 0x33, 0x12, 0x54, 0x60, 0x13, 0x71, 0x0F,
+    0xD0, 0x1A, 0x70, 0x08, 0x30, 0x33, 0x12, 0x60, 0x23, 0x66, 0xF0, 0x0A,
+    0x81, 0x00, 0xA3, 0xB4, 0xF0, 0x1E, 0xF0, 0x65, 0x40, 0x00, 0x12, 0x8A,
+    0x22, 0x7C, 0x12, 0x6A, 0x60, 0x10, 0xF0, 0x18, 0xF0, 0x15, 0xF0, 0x07,
+    0x30, 0x00, 0x12, 0x82, 0x00, 0xEE, 0x60, 0x02, 0x8E, 0x03, 0x80, 0xE0,
+    0xF0, 0x55, 0xA3, 0xD4, 0x80, 0x10, 0x70, 0xFF, 0x80, 0x04, 0xF0, 0x1E,
+    0xF1, 0x65, 0xA3, 0xAA, 0x3E, 0x03, 0xA3, 0xAF, 0xD0, 0x15, 0x22, 0xC8,
+    0x3A, 0x00, 0x12, 0x1C, 0xA3, 0xB4, 0x61, 0x00, 0x62, 0x00, 0x63, 0x01,
+    0xF0, 0x65, 0x30, 0x00, 0x71, 0x01, 0xF3, 0x1E, 0x72, 0x01, 0x32, 0x10,
+    0x12, 0xB4, 0x31, 0x10, 0x12, 0x6A, 0x12, 0x1C, 0x6A, 0x00, 0xA3, 0xB4,
+    0x60, 0x01, 0xF0, 0x1E, 0xF8, 0x65, 0x69, 0x00, 0x89, 0x04, 0x23, 0x44,
+    0x89, 0x14, 0x23, 0x44, 0x89, 0x24, 0x23, 0x4A, 0x69, 0x00, 0x89, 0x34,
+    0x23, 0x44, 0x89, 0x44, 0x23, 0x44, 0x89, 0x54, 0x23, 0x4A, 0x69, 0x00,
+    0x89, 0x64, 0x23, 0x44, 0x89, 0x74, 0x23, 0x44, 0x89, 0x84, 0x23, 0x4A,
+    0x69, 0x00, 0x89, 0x64, 0x23, 0x44, 0x89, 0x34, 0x23, 0x44, 0x89, 0x04,
+    0x23, 0x4A, 0x69, 0x00, 0x89, 0x74, 0x23, 0x44, 0x89, 0x44, 0x23, 0x44,
+    0x89, 0x14, 0x23, 0x4A, 0x69, 0x00, 0x89, 0x84, 0x23, 0x44, 0x89, 0x54,
+    0x23, 0x44, 0x89, 0x24, 0x23, 0x4A, 0x69, 0x00, 0x89, 0x84, 0x23, 0x44,
+    0x89, 0x44, 0x23, 0x44, 0x89, 0x04, 0x23, 0x4A, 0x69, 0x00, 0x89, 0x64,
+    0x23, 0x44, 0x89, 0x44, 0x23, 0x44, 0x89, 0x24, 0x23, 0x4A, 0x00, 0xEE,
+    0x89, 0x0E, 0x89, 0x0E, 0x00, 0xEE, 0x49, 0x15, 0x13, 0x54, 0x49, 0x3F,
+    0x13, 0x5A, 0x00, 0xEE, 0x23, 0x66, 0x7B, 0x01, 0x13, 0x5E, 0x23, 0x66,
+    0x7C, 0x01, 0x23, 0x66, 0x6A, 0x01, 0xF0, 0x0A, 0x00, 0xEE, 0x63, 0x05,
+    0x64, 0x0A, 0xA3, 0xAF, 0xD3, 0x45, 0x63, 0x02, 0x74, 0x06, 0xA3, 0xE6,
+    0xFB, 0x33, 0x23, 0x88, 0x63, 0x32, 0x64, 0x0A, 0xA3, 0xAA, 0xD3, 0x45,
+    0x63, 0x2F, 0x74, 0x06, 0xA3, 0xE6, 0xFC, 0x33, 0xF2, 0x65, 0xF0, 0x29,
+    0x23, 0x94, 0xF1, 0x29, 0x23, 0x94, 0xF2, 0x29, 0xD3, 0x45, 0x73, 0x05,
+    0x00, 0xEE, 0x7F, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x1C, 0x22, 0x22, 0x22, 0x1C, 0x22,
+    0x14, 0x08, 0x14, 0x22, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+    0x13, 0x05, 0x1B, 0x05, 0x23, 0x05, 0x13, 0x0D, 0x1B, 0x0D, 0x23, 0x0D,
+    0x13, 0x15, 0x1B, 0x15, 0x23, 0x15,
+};
+const size_t aot_rom_size = 486;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000007F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+        case 0x2FE: goto L2FE;
+        case 0x300: goto L300;
+        case 0x302: goto L302;
+        case 0x304: goto L304;
+        case 0x306: goto L306;
+        case 0x308: goto L308;
+        case 0x30A: goto L30A;
+        case 0x30C: goto L30C;
+        case 0x30E: goto L30E;
+        case 0x310: goto L310;
+        case 0x312: goto L312;
+        case 0x314: goto L314;
+        case 0x316: goto L316;
+        case 0x318: goto L318;
+        case 0x31A: goto L31A;
+        case 0x31C: goto L31C;
+        case 0x31E: goto L31E;
+        case 0x320: goto L320;
+        case 0x322: goto L322;
+        case 0x324: goto L324;
+        case 0x326: goto L326;
+        case 0x328: goto L328;
+        case 0x32A: goto L32A;
+        case 0x32C: goto L32C;
+        case 0x32E: goto L32E;
+        case 0x330: goto L330;
+        case 0x332: goto L332;
+        case 0x334: goto L334;
+        case 0x336: goto L336;
+        case 0x338: goto L338;
+        case 0x33A: goto L33A;
+        case 0x33C: goto L33C;
+        case 0x33E: goto L33E;
+        case 0x340: goto L340;
+        case 0x342: goto L342;
+        case 0x344: goto L344;
+        case 0x346: goto L346;
+        case 0x348: goto L348;
+        case 0x34A: goto L34A;
+        case 0x34C: goto L34C;
+        case 0x34E: goto L34E;
+        case 0x350: goto L350;
+        case 0x352: goto L352;
+        case 0x354: goto L354;
+        case 0x356: goto L356;
+        case 0x358: goto L358;
+        case 0x35A: goto L35A;
+        case 0x35C: goto L35C;
+        case 0x35E: goto L35E;
+        case 0x360: goto L360;
+        case 0x362: goto L362;
+        case 0x364: goto L364;
+        case 0x366: goto L366;
+        case 0x368: goto L368;
+        case 0x36A: goto L36A;
+        case 0x36C: goto L36C;
+        case 0x36E: goto L36E;
+        case 0x370: goto L370;
+        case 0x372: goto L372;
+        case 0x374: goto L374;
+        case 0x376: goto L376;
+        case 0x378: goto L378;
+        case 0x37A: goto L37A;
+        case 0x37C: goto L37C;
+        case 0x37E: goto L37E;
+        case 0x380: goto L380;
+        case 0x382: goto L382;
+        case 0x384: goto L384;
+        case 0x386: goto L386;
+        case 0x388: goto L388;
+        case 0x38A: goto L38A;
+        case 0x38C: goto L38C;
+        case 0x38E: goto L38E;
+        case 0x390: goto L390;
+        case 0x392: goto L392;
+        case 0x394: goto L394;
+        case 0x396: goto L396;
+        case 0x398: goto L398;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 1218 JP 0x218
+    STEP(0x200, 0x1218);
+    goto L218;
+L218: // 6B00 LD VB, 0x00
+    STEP(0x218, 0x6B00);
+    V[11] = 0x00;
+L21A: // 6C00 LD VC, 0x00
+    STEP(0x21A, 0x6C00);
+    V[12] = 0x00;
+L21C: // 80B0 LD V0, VB
+    STEP(0x21C, 0x80B0);
+    V[0] = V[11];
+L21E: // 81C0 LD V1, VC
+    STEP(0x21E, 0x81C0);
+    V[1] = V[12];
+L220: // A3E6 LD I, 0x3E6
+    STEP(0x220, 0xA3E6);
+    c->I = 0x3E6;
+L222: // F155 LD [I], V1
+    STEP(0x222, 0xF155);
+    c->pc = 0x222;
+    predecode(0xF155, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x224) goto dispatch;
+L224: // A3C4 LD I, 0x3C4
+    STEP(0x224, 0xA3C4);
+    c->I = 0x3C4;
+L226: // FF65 LD VF, [I]
+    STEP(0x226, 0xFF65);
+    for (int i = 0; i <= 15; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L228: // A3B4 LD I, 0x3B4
+    STEP(0x228, 0xA3B4);
+    c->I = 0x3B4;
+L22A: // FF55 LD [I], VF
+    STEP(0x22A, 0xFF55);
+    c->pc = 0x22A;
+    predecode(0xFF55, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x22C) goto dispatch;
+L22C: // A3E6 LD I, 0x3E6
+    STEP(0x22C, 0xA3E6);
+    c->I = 0x3E6;
+L22E: // F165 LD V1, [I]
+    STEP(0x22E, 0xF165);
+    for (int i = 0; i <= 1; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L230: // 8B00 LD VB, V0
+    STEP(0x230, 0x8B00);
+    V[11] = V[0];
+L232: // 8C10 LD VC, V1
+    STEP(0x232, 0x8C10);
+    V[12] = V[1];
+L234: // 00E0 CLS
+    STEP(0x234, 0x00E0);
+    c->pc = 0x234;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x236) goto dispatch;
+L236: // 6E01 LD VE, 0x01
+    STEP(0x236, 0x6E01);
+    V[14] = 0x01;
+L238: // 6013 LD V0, 0x13
+    STEP(0x238, 0x6013);
+    V[0] = 0x13;
+L23A: // 6103 LD V1, 0x03
+    STEP(0x23A, 0x6103);
+    V[1] = 0x03;
+L23C: // A39A LD I, 0x39A
+    STEP(0x23C, 0xA39A);
+    c->I = 0x39A;
+L23E: // D011 DRW V0, V1, 1
+    STEP(0x23E, 0xD011);
+    c->pc = 0x23E;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x240) goto dispatch;
+L240: // 7008 ADD V0, 0x08
+    STEP(0x240, 0x7008);
+    V[0] += 0x08;
+L242: // 302B SE V0, 0x2B
+    STEP(0x242, 0x302B);
+    if (V[0] == 0x2B) goto L246;
+L244: // 123E JP 0x23E
+    STEP(0x244, 0x123E);
+    goto L23E;
+L246: // 6013 LD V0, 0x13
+    STEP(0x246, 0x6013);
+    V[0] = 0x13;
+L248: // 7108 ADD V1, 0x08
+    STEP(0x248, 0x7108);
+    V[1] += 0x08;
+L24A: // 3123 SE V1, 0x23
+    STEP(0x24A, 0x3123);
+    if (V[1] == 0x23) goto L24E;
+L24C: // 123E JP 0x23E
+    STEP(0x24C, 0x123E);
+    goto L23E;
+L24E: // 6013 LD V0, 0x13
+    STEP(0x24E, 0x6013);
+    V[0] = 0x13;
+L250: // 6103 LD V1, 0x03
+    STEP(0x250, 0x6103);
+    V[1] = 0x03;
+L252: // A39B LD I, 0x39B
+    STEP(0x252, 0xA39B);
+    c->I = 0x39B;
+L254: // D01F DRW V0, V1, 15
+    STEP(0x254, 0xD01F);
+    c->pc = 0x254;
+    predecode(0xD01F, &in);
+    execute(c, &in);
+    if (c->pc != 0x256) goto dispatch;
+L256: // 7008 ADD V0, 0x08
+    STEP(0x256, 0x7008);
+    V[0] += 0x08;
+L258: // 3033 SE V0, 0x33
+    STEP(0x258, 0x3033);
+    if (V[0] == 0x33) goto L25C;
+L25A: // 1254 JP 0x254
+    STEP(0x25A, 0x1254);
+    goto L254;
+L25C: // 6013 LD V0, 0x13
+    STEP(0x25C, 0x6013);
+    V[0] = 0x13;
+L25E: // 710F ADD V1, 0x0F
+    STEP(0x25E, 0x710F);
+    V[1] += 0x0F;
+L260: // D01A DRW V0, V1, 10
+    STEP(0x260, 0xD01A);
+    c->pc = 0x260;
+    predecode(0xD01A, &in);
+    execute(c, &in);
+    if (c->pc != 0x262) goto dispatch;
+L262: // 7008 ADD V0, 0x08
+    STEP(0x262, 0x7008);
+    V[0] += 0x08;
+L264: // 3033 SE V0, 0x33
+    STEP(0x264, 0x3033);
+    if (V[0] == 0x33) goto L268;
+L266: // 1260 JP 0x260
+    STEP(0x266, 0x1260);
+    goto L260;
+L268: // 2366 CALL 0x366
+    STEP(0x268, 0x2366);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x268;
+    goto L366;
+L26A: // F00A LD V0, K
+    STEP(0x26A, 0xF00A);
+    if (c->keypad == 0) {
+        c->pc = 0x26A;
+        return cycles - left;
+    }
+    V[0] = __builtin_ctz(c->keypad);
+L26C: // 8100 LD V1, V0
+    STEP(0x26C, 0x8100);
+    V[1] = V[0];
+L26E: // A3B4 LD I, 0x3B4
+    STEP(0x26E, 0xA3B4);
+    c->I = 0x3B4;
+L270: // F01E ADD I, V0
+    STEP(0x270, 0xF01E);
+    c->I += V[0];
+L272: // F065 LD V0, [I]
+    STEP(0x272, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L274: // 4000 SNE V0, 0x00
+    STEP(0x274, 0x4000);
+    if (V[0] != 0x00) goto L278;
+L276: // 128A JP 0x28A
+    STEP(0x276, 0x128A);
+    goto L28A;
+L278: // 227C CALL 0x27C
+    STEP(0x278, 0x227C);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x278;
+    goto L27C;
+L27A: // 126A JP 0x26A
+    STEP(0x27A, 0x126A);
+    goto L26A;
+L27C: // 6010 LD V0, 0x10
+    STEP(0x27C, 0x6010);
+    V[0] = 0x10;
+L27E: // F018 LD ST, V0
+    STEP(0x27E, 0xF018);
+    c->st = V[0];
+L280: // F015 LD DT, V0
+    STEP(0x280, 0xF015);
+    c->dt = V[0];
+L282: // F007 LD V0, DT
+    STEP(0x282, 0xF007);
+    V[0] = c->dt;
+L284: // 3000 SE V0, 0x00
+    STEP(0x284, 0x3000);
+    if (V[0] == 0x00) goto L288;
+L286: // 1282 JP 0x282
+    STEP(0x286, 0x1282);
+    goto L282;
+L288: // 00EE RET
+    STEP(0x288, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L28A: // 6002 LD V0, 0x02
+    STEP(0x28A, 0x6002);
+    V[0] = 0x02;
+L28C: // 8E03 XOR VE, V0
+    STEP(0x28C, 0x8E03);
+    V[14] ^= V[0];
+L28E: // 80E0 LD V0, VE
+    STEP(0x28E, 0x80E0);
+    V[0] = V[14];
+L290: // F055 LD [I], V0
+    STEP(0x290, 0xF055);
+    c->pc = 0x290;
+    predecode(0xF055, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x292) goto dispatch;
+L292: // A3D4 LD I, 0x3D4
+    STEP(0x292, 0xA3D4);
+    c->I = 0x3D4;
+L294: // 8010 LD V0, V1
+    STEP(0x294, 0x8010);
+    V[0] = V[1];
+L296: // 70FF ADD V0, 0xFF
+    STEP(0x296, 0x70FF);
+    V[0] += 0xFF;
+L298: // 8004 ADD V0, V0
+    STEP(0x298, 0x8004);
+    V[15] = V[0] + V[0] > 0xFF;
+    V[0] += V[0];
+L29A: // F01E ADD I, V0
+    STEP(0x29A, 0xF01E);
+    c->I += V[0];
+L29C: // F165 LD V1, [I]
+    STEP(0x29C, 0xF165);
+    for (int i = 0; i <= 1; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L29E: // A3AA LD I, 0x3AA
+    STEP(0x29E, 0xA3AA);
+    c->I = 0x3AA;
+L2A0: // 3E03 SE VE, 0x03
+    STEP(0x2A0, 0x3E03);
+    if (V[14] == 0x03) goto L2A4;
+L2A2: // A3AF LD I, 0x3AF
+    STEP(0x2A2, 0xA3AF);
+    c->I = 0x3AF;
+L2A4: // D015 DRW V0, V1, 5
+    STEP(0x2A4, 0xD015);
+    c->pc = 0x2A4;
+    predecode(0xD015, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A6) goto dispatch;
+L2A6: // 22C8 CALL 0x2C8
+    STEP(0x2A6, 0x22C8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2A6;
+    goto L2C8;
+L2A8: // 3A00 SE VA, 0x00
+    STEP(0x2A8, 0x3A00);
+    if (V[10] == 0x00) goto L2AC;
+L2AA: // 121C JP 0x21C
+    STEP(0x2AA, 0x121C);
+    goto L21C;
+L2AC: // A3B4 LD I, 0x3B4
+    STEP(0x2AC, 0xA3B4);
+    c->I = 0x3B4;
+L2AE: // 6100 LD V1, 0x00
+    STEP(0x2AE, 0x6100);
+    V[1] = 0x00;
+L2B0: // 6200 LD V2, 0x00
+    STEP(0x2B0, 0x6200);
+    V[2] = 0x00;
+L2B2: // 6301 LD V3, 0x01
+    STEP(0x2B2, 0x6301);
+    V[3] = 0x01;
+L2B4: // F065 LD V0, [I]
+    STEP(0x2B4, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2B6: // 3000 SE V0, 0x00
+    STEP(0x2B6, 0x3000);
+    if (V[0] == 0x00) goto L2BA;
+L2B8: // 7101 ADD V1, 0x01
+    STEP(0x2B8, 0x7101);
+    V[1] += 0x01;
+L2BA: // F31E ADD I, V3
+    STEP(0x2BA, 0xF31E);
+    c->I += V[3];
+L2BC: // 7201 ADD V2, 0x01
+    STEP(0x2BC, 0x7201);
+    V[2] += 0x01;
+L2BE: // 3210 SE V2, 0x10
+    STEP(0x2BE, 0x3210);
+    if (V[2] == 0x10) goto L2C2;
+L2C0: // 12B4 JP 0x2B4
+    STEP(0x2C0, 0x12B4);
+    goto L2B4;
+L2C2: // 3110 SE V1, 0x10
+    STEP(0x2C2, 0x3110);
+    if (V[1] == 0x10) goto L2C6;
+L2C4: // 126A JP 0x26A
+    STEP(0x2C4, 0x126A);
+    goto L26A;
+L2C6: // 121C JP 0x21C
+    STEP(0x2C6, 0x121C);
+    goto L21C;
+L2C8: // 6A00 LD VA, 0x00
+    STEP(0x2C8, 0x6A00);
+    V[10] = 0x00;
+L2CA: // A3B4 LD I, 0x3B4
+    STEP(0x2CA, 0xA3B4);
+    c->I = 0x3B4;
+L2CC: // 6001 LD V0, 0x01
+    STEP(0x2CC, 0x6001);
+    V[0] = 0x01;
+L2CE: // F01E ADD I, V0
+    STEP(0x2CE, 0xF01E);
+    c->I += V[0];
+L2D0: // F865 LD V8, [I]
+    STEP(0x2D0, 0xF865);
+    for (int i = 0; i <= 8; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2D2: // 6900 LD V9, 0x00
+    STEP(0x2D2, 0x6900);
+    V[9] = 0x00;
+L2D4: // 8904 ADD V9, V0
+    STEP(0x2D4, 0x8904);
+    V[15] = V[9] + V[0] > 0xFF;
+    V[9] += V[0];
+L2D6: // 2344 CALL 0x344
+    STEP(0x2D6, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2D6;
+    goto L344;
+L2D8: // 8914 ADD V9, V1
+    STEP(0x2D8, 0x8914);
+    V[15] = V[9] + V[1] > 0xFF;
+    V[9] += V[1];
+L2DA: // 2344 CALL 0x344
+    STEP(0x2DA, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2DA;
+    goto L344;
+L2DC: // 8924 ADD V9, V2
+    STEP(0x2DC, 0x8924);
+    V[15] = V[9] + V[2] > 0xFF;
+    V[9] += V[2];
+L2DE: // 234A CALL 0x34A
+    STEP(0x2DE, 0x234A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2DE;
+    goto L34A;
+L2E0: // 6900 LD V9, 0x00
+    STEP(0x2E0, 0x6900);
+    V[9] = 0x00;
+L2E2: // 8934 ADD V9, V3
+    STEP(0x2E2, 0x8934);
+    V[15] = V[9] + V[3] > 0xFF;
+    V[9] += V[3];
+L2E4: // 2344 CALL 0x344
+    STEP(0x2E4, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2E4;
+    goto L344;
+L2E6: // 8944 ADD V9, V4
+    STEP(0x2E6, 0x8944);
+    V[15] = V[9] + V[4] > 0xFF;
+    V[9] += V[4];
+L2E8: // 2344 CALL 0x344
+    STEP(0x2E8, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2E8;
+    goto L344;
+L2EA: // 8954 ADD V9, V5
+    STEP(0x2EA, 0x8954);
+    V[15] = V[9] + V[5] > 0xFF;
+    V[9] += V[5];
+L2EC: // 234A CALL 0x34A
+    STEP(0x2EC, 0x234A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2EC;
+    goto L34A;
+L2EE: // 6900 LD V9, 0x00
+    STEP(0x2EE, 0x6900);
+    V[9] = 0x00;
+L2F0: // 8964 ADD V9, V6
+    STEP(0x2F0, 0x8964);
+    V[15] = V[9] + V[6] > 0xFF;
+    V[9] += V[6];
+L2F2: // 2344 CALL 0x344
+    STEP(0x2F2, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2F2;
+    goto L344;
+L2F4: // 8974 ADD V9, V7
+    STEP(0x2F4, 0x8974);
+    V[15] = V[9] + V[7] > 0xFF;
+    V[9] += V[7];
+L2F6: // 2344 CALL 0x344
+    STEP(0x2F6, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2F6;
+    goto L344;
+L2F8: // 8984 ADD V9, V8
+    STEP(0x2F8, 0x8984);
+    V[15] = V[9] + V[8] > 0xFF;
+    V[9] += V[8];
+L2FA: // 234A CALL 0x34A
+    STEP(0x2FA, 0x234A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2FA;
+    goto L34A;
+L2FC: // 6900 LD V9, 0x00
+    STEP(0x2FC, 0x6900);
+    V[9] = 0x00;
+L2FE: // 8964 ADD V9, V6
+    STEP(0x2FE, 0x8964);
+    V[15] = V[9] + V[6] > 0xFF;
+    V[9] += V[6];
+L300: // 2344 CALL 0x344
+    STEP(0x300, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x300;
+    goto L344;
+L302: // 8934 ADD V9, V3
+    STEP(0x302, 0x8934);
+    V[15] = V[9] + V[3] > 0xFF;
+    V[9] += V[3];
+L304: // 2344 CALL 0x344
+    STEP(0x304, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x304;
+    goto L344;
+L306: // 8904 ADD V9, V0
+    STEP(0x306, 0x8904);
+    V[15] = V[9] + V[0] > 0xFF;
+    V[9] += V[0];
+L308: // 234A CALL 0x34A
+    STEP(0x308, 0x234A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x308;
+    goto L34A;
+L30A: // 6900 LD V9, 0x00
+    STEP(0x30A, 0x6900);
+    V[9] = 0x00;
+L30C: // 8974 ADD V9, V7
+    STEP(0x30C, 0x8974);
+    V[15] = V[9] + V[7] > 0xFF;
+    V[9] += V[7];
+L30E: // 2344 CALL 0x344
+    STEP(0x30E, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x30E;
+    goto L344;
+L310: // 8944 ADD V9, V4
+    STEP(0x310, 0x8944);
+    V[15] = V[9] + V[4] > 0xFF;
+    V[9] += V[4];
+L312: // 2344 CALL 0x344
+    STEP(0x312, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x312;
+    goto L344;
+L314: // 8914 ADD V9, V1
+    STEP(0x314, 0x8914);
+    V[15] = V[9] + V[1] > 0xFF;
+    V[9] += V[1];
+L316: // 234A CALL 0x34A
+    STEP(0x316, 0x234A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x316;
+    goto L34A;
+L318: // 6900 LD V9, 0x00
+    STEP(0x318, 0x6900);
+    V[9] = 0x00;
+L31A: // 8984 ADD V9, V8
+    STEP(0x31A, 0x8984);
+    V[15] = V[9] + V[8] > 0xFF;
+    V[9] += V[8];
+L31C: // 2344 CALL 0x344
+    STEP(0x31C, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x31C;
+    goto L344;
+L31E: // 8954 ADD V9, V5
+    STEP(0x31E, 0x8954);
+    V[15] = V[9] + V[5] > 0xFF;
+    V[9] += V[5];
+L320: // 2344 CALL 0x344
+    STEP(0x320, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x320;
+    goto L344;
+L322: // 8924 ADD V9, V2
+    STEP(0x322, 0x8924);
+    V[15] = V[9] + V[2] > 0xFF;
+    V[9] += V[2];
+L324: // 234A CALL 0x34A
+    STEP(0x324, 0x234A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x324;
+    goto L34A;
+L326: // 6900 LD V9, 0x00
+    STEP(0x326, 0x6900);
+    V[9] = 0x00;
+L328: // 8984 ADD V9, V8
+    STEP(0x328, 0x8984);
+    V[15] = V[9] + V[8] > 0xFF;
+    V[9] += V[8];
+L32A: // 2344 CALL 0x344
+    STEP(0x32A, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x32A;
+    goto L344;
+L32C: // 8944 ADD V9, V4
+    STEP(0x32C, 0x8944);
+    V[15] = V[9] + V[4] > 0xFF;
+    V[9] += V[4];
+L32E: // 2344 CALL 0x344
+    STEP(0x32E, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x32E;
+    goto L344;
+L330: // 8904 ADD V9, V0
+    STEP(0x330, 0x8904);
+    V[15] = V[9] + V[0] > 0xFF;
+    V[9] += V[0];
+L332: // 234A CALL 0x34A
+    STEP(0x332, 0x234A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x332;
+    goto L34A;
+L334: // 6900 LD V9, 0x00
+    STEP(0x334, 0x6900);
+    V[9] = 0x00;
+L336: // 8964 ADD V9, V6
+    STEP(0x336, 0x8964);
+    V[15] = V[9] + V[6] > 0xFF;
+    V[9] += V[6];
+L338: // 2344 CALL 0x344
+    STEP(0x338, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x338;
+    goto L344;
+L33A: // 8944 ADD V9, V4
+    STEP(0x33A, 0x8944);
+    V[15] = V[9] + V[4] > 0xFF;
+    V[9] += V[4];
+L33C: // 2344 CALL 0x344
+    STEP(0x33C, 0x2344);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x33C;
+    goto L344;
+L33E: // 8924 ADD V9, V2
+    STEP(0x33E, 0x8924);
+    V[15] = V[9] + V[2] > 0xFF;
+    V[9] += V[2];
+L340: // 234A CALL 0x34A
+    STEP(0x340, 0x234A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x340;
+    goto L34A;
+L342: // 00EE RET
+    STEP(0x342, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L344: // 890E SHL V9, V0
+    STEP(0x344, 0x890E);
+    V[15] = V[9] >> 7;
+    V[9] <<= 1;
+L346: // 890E SHL V9, V0
+    STEP(0x346, 0x890E);
+    V[15] = V[9] >> 7;
+    V[9] <<= 1;
+L348: // 00EE RET
+    STEP(0x348, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L34A: // 4915 SNE V9, 0x15
+    STEP(0x34A, 0x4915);
+    if (V[9] != 0x15) goto L34E;
+L34C: // 1354 JP 0x354
+    STEP(0x34C, 0x1354);
+    goto L354;
+L34E: // 493F SNE V9, 0x3F
+    STEP(0x34E, 0x493F);
+    if (V[9] != 0x3F) goto L352;
+L350: // 135A JP 0x35A
+    STEP(0x350, 0x135A);
+    goto L35A;
+L352: // 00EE RET
+    STEP(0x352, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L354: // 2366 CALL 0x366
+    STEP(0x354, 0x2366);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x354;
+    goto L366;
+L356: // 7B01 ADD VB, 0x01
+    STEP(0x356, 0x7B01);
+    V[11] += 0x01;
+L358: // 135E JP 0x35E
+    STEP(0x358, 0x135E);
+    goto L35E;
+L35A: // 2366 CALL 0x366
+    STEP(0x35A, 0x2366);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x35A;
+    goto L366;
+L35C: // 7C01 ADD VC, 0x01
+    STEP(0x35C, 0x7C01);
+    V[12] += 0x01;
+L35E: // 2366 CALL 0x366
+    STEP(0x35E, 0x2366);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x35E;
+    goto L366;
+L360: // 6A01 LD VA, 0x01
+    STEP(0x360, 0x6A01);
+    V[10] = 0x01;
+L362: // F00A LD V0, K
+    STEP(0x362, 0xF00A);
+    if (c->keypad == 0) {
+        c->pc = 0x362;
+        return cycles - left;
+    }
+    V[0] = __builtin_ctz(c->keypad);
+L364: // 00EE RET
+    STEP(0x364, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L366: // 6305 LD V3, 0x05
+    STEP(0x366, 0x6305);
+    V[3] = 0x05;
+L368: // 640A LD V4, 0x0A
+    STEP(0x368, 0x640A);
+    V[4] = 0x0A;
+L36A: // A3AF LD I, 0x3AF
+    STEP(0x36A, 0xA3AF);
+    c->I = 0x3AF;
+L36C: // D345 DRW V3, V4, 5
+    STEP(0x36C, 0xD345);
+    c->pc = 0x36C;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x36E) goto dispatch;
+L36E: // 6302 LD V3, 0x02
+    STEP(0x36E, 0x6302);
+    V[3] = 0x02;
+L370: // 7406 ADD V4, 0x06
+    STEP(0x370, 0x7406);
+    V[4] += 0x06;
+L372: // A3E6 LD I, 0x3E6
+    STEP(0x372, 0xA3E6);
+    c->I = 0x3E6;
+L374: // FB33 LD B, VB
+    STEP(0x374, 0xFB33);
+    c->pc = 0x374;
+    predecode(0xFB33, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x376) goto dispatch;
+L376: // 2388 CALL 0x388
+    STEP(0x376, 0x2388);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x376;
+    goto L388;
+L378: // 6332 LD V3, 0x32
+    STEP(0x378, 0x6332);
+    V[3] = 0x32;
+L37A: // 640A LD V4, 0x0A
+    STEP(0x37A, 0x640A);
+    V[4] = 0x0A;
+L37C: // A3AA LD I, 0x3AA
+    STEP(0x37C, 0xA3AA);
+    c->I = 0x3AA;
+L37E: // D345 DRW V3, V4, 5
+    STEP(0x37E, 0xD345);
+    c->pc = 0x37E;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x380) goto dispatch;
+L380: // 632F LD V3, 0x2F
+    STEP(0x380, 0x632F);
+    V[3] = 0x2F;
+L382: // 7406 ADD V4, 0x06
+    STEP(0x382, 0x7406);
+    V[4] += 0x06;
+L384: // A3E6 LD I, 0x3E6
+    STEP(0x384, 0xA3E6);
+    c->I = 0x3E6;
+L386: // FC33 LD B, VC
+    STEP(0x386, 0xFC33);
+    c->pc = 0x386;
+    predecode(0xFC33, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x388) goto dispatch;
+L388: // F265 LD V2, [I]
+    STEP(0x388, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L38A: // F029 LD F, V0
+    STEP(0x38A, 0xF029);
+    c->I = V[0] * 5;
+L38C: // 2394 CALL 0x394
+    STEP(0x38C, 0x2394);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x38C;
+    goto L394;
+L38E: // F129 LD F, V1
+    STEP(0x38E, 0xF129);
+    c->I = V[1] * 5;
+L390: // 2394 CALL 0x394
+    STEP(0x390, 0x2394);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x390;
+    goto L394;
+L392: // F229 LD F, V2
+    STEP(0x392, 0xF229);
+    c->I = V[2] * 5;
+L394: // D345 DRW V3, V4, 5
+    STEP(0x394, 0xD345);
+    c->pc = 0x394;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x396) goto dispatch;
+L396: // 7305 ADD V3, 0x05
+    STEP(0x396, 0x7305);
+    V[3] += 0x05;
+L398: // 00EE RET
+    STEP(0x398, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,385 @@
+// generated by chip8-aot from roms/TEST/TIMEBOMB.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x00, 0xE0, 0x6A, 0x05, 0x22, 0x3A, 0x60, 0x02, 0xE0, 0xA1, 0x12, 0x1A,
+    0x60, 0x08, 0xE0, 0xA1, 0x12, 0x2A, 0x60, 0x05, 0xE0, 0xA1, 0x12, 0x56,
+    0x12, 0x06, 0x4A, 0xF0, 0x12, 0x06, 0x22, 0x3A, 0x7A, 0x01, 0x22, 0x3A,
+    0x60, 0x02, 0xF0, 0x18, 0x12, 0x06, 0x4A, 0x05, 0x12, 0x06, 0x22, 0x3A,
+    0x7A, 0xFF, 0x22, 0x3A, 0x60, 0x02, 0xF0, 0x18, 0x12, 0x06, 0xA2, 0x8A,
+    0xFA, 0x33, 0xF2, 0x65, 0x63, 0x19, 0x64, 0x0E, 0xF0, 0x29, 0xD3, 0x45,
+    0x73, 0x05, 0xF1, 0x29, 0xD3, 0x45, 0x73, 0x05, 0xF2, 0x29, 0xD3, 0x45,
+    0x00, 0xEE, 0x60, 0x3C, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x5A,
+    0x22, 0x3A, 0x7A, 0xFF, 0x22, 0x3A, 0x60, 0x05, 0xF0, 0x18, 0x4A, 0x00,
+    0x12, 0x74, 0x60, 0x3C, 0xF0, 0x15, 0x12, 0x5A, 0x00, 0xE0, 0x60, 0x32,
+    0xF0, 0x18, 0x60, 0x14, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x7E,
+    0x6A, 0x05, 0x22, 0x3A, 0x12, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+const size_t aot_rom_size = 144;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000700ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 00E0 CLS
+    STEP(0x200, 0x00E0);
+    c->pc = 0x200;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x202) goto dispatch;
+L202: // 6A05 LD VA, 0x05
+    STEP(0x202, 0x6A05);
+    V[10] = 0x05;
+L204: // 223A CALL 0x23A
+    STEP(0x204, 0x223A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x204;
+    goto L23A;
+L206: // 6002 LD V0, 0x02
+    STEP(0x206, 0x6002);
+    V[0] = 0x02;
+L208: // E0A1 SKNP V0
+    STEP(0x208, 0xE0A1);
+    c->pc = 0x208;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x20A) goto dispatch;
+L20A: // 121A JP 0x21A
+    STEP(0x20A, 0x121A);
+    goto L21A;
+L20C: // 6008 LD V0, 0x08
+    STEP(0x20C, 0x6008);
+    V[0] = 0x08;
+L20E: // E0A1 SKNP V0
+    STEP(0x20E, 0xE0A1);
+    c->pc = 0x20E;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x210) goto dispatch;
+L210: // 122A JP 0x22A
+    STEP(0x210, 0x122A);
+    goto L22A;
+L212: // 6005 LD V0, 0x05
+    STEP(0x212, 0x6005);
+    V[0] = 0x05;
+L214: // E0A1 SKNP V0
+    STEP(0x214, 0xE0A1);
+    c->pc = 0x214;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x216) goto dispatch;
+L216: // 1256 JP 0x256
+    STEP(0x216, 0x1256);
+    goto L256;
+L218: // 1206 JP 0x206
+    STEP(0x218, 0x1206);
+    goto L206;
+L21A: // 4AF0 SNE VA, 0xF0
+    STEP(0x21A, 0x4AF0);
+    if (V[10] != 0xF0) goto L21E;
+L21C: // 1206 JP 0x206
+    STEP(0x21C, 0x1206);
+    goto L206;
+L21E: // 223A CALL 0x23A
+    STEP(0x21E, 0x223A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x21E;
+    goto L23A;
+L220: // 7A01 ADD VA, 0x01
+    STEP(0x220, 0x7A01);
+    V[10] += 0x01;
+L222: // 223A CALL 0x23A
+    STEP(0x222, 0x223A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x222;
+    goto L23A;
+L224: // 6002 LD V0, 0x02
+    STEP(0x224, 0x6002);
+    V[0] = 0x02;
+L226: // F018 LD ST, V0
+    STEP(0x226, 0xF018);
+    c->st = V[0];
+L228: // 1206 JP 0x206
+    STEP(0x228, 0x1206);
+    goto L206;
+L22A: // 4A05 SNE VA, 0x05
+    STEP(0x22A, 0x4A05);
+    if (V[10] != 0x05) goto L22E;
+L22C: // 1206 JP 0x206
+    STEP(0x22C, 0x1206);
+    goto L206;
+L22E: // 223A CALL 0x23A
+    STEP(0x22E, 0x223A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x22E;
+    goto L23A;
+L230: // 7AFF ADD VA, 0xFF
+    STEP(0x230, 0x7AFF);
+    V[10] += 0xFF;
+L232: // 223A CALL 0x23A
+    STEP(0x232, 0x223A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x232;
+    goto L23A;
+L234: // 6002 LD V0, 0x02
+    STEP(0x234, 0x6002);
+    V[0] = 0x02;
+L236: // F018 LD ST, V0
+    STEP(0x236, 0xF018);
+    c->st = V[0];
+L238: // 1206 JP 0x206
+    STEP(0x238, 0x1206);
+    goto L206;
+L23A: // A28A LD I, 0x28A
+    STEP(0x23A, 0xA28A);
+    c->I = 0x28A;
+L23C: // FA33 LD B, VA
+    STEP(0x23C, 0xFA33);
+    c->pc = 0x23C;
+    predecode(0xFA33, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x23E) goto dispatch;
+L23E: // F265 LD V2, [I]
+    STEP(0x23E, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L240: // 6319 LD V3, 0x19
+    STEP(0x240, 0x6319);
+    V[3] = 0x19;
+L242: // 640E LD V4, 0x0E
+    STEP(0x242, 0x640E);
+    V[4] = 0x0E;
+L244: // F029 LD F, V0
+    STEP(0x244, 0xF029);
+    c->I = V[0] * 5;
+L246: // D345 DRW V3, V4, 5
+    STEP(0x246, 0xD345);
+    c->pc = 0x246;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x248) goto dispatch;
+L248: // 7305 ADD V3, 0x05
+    STEP(0x248, 0x7305);
+    V[3] += 0x05;
+L24A: // F129 LD F, V1
+    STEP(0x24A, 0xF129);
+    c->I = V[1] * 5;
+L24C: // D345 DRW V3, V4, 5
+    STEP(0x24C, 0xD345);
+    c->pc = 0x24C;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x24E) goto dispatch;
+L24E: // 7305 ADD V3, 0x05
+    STEP(0x24E, 0x7305);
+    V[3] += 0x05;
+L250: // F229 LD F, V2
+    STEP(0x250, 0xF229);
+    c->I = V[2] * 5;
+L252: // D345 DRW V3, V4, 5
+    STEP(0x252, 0xD345);
+    c->pc = 0x252;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x254) goto dispatch;
+L254: // 00EE RET
+    STEP(0x254, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L256: // 603C LD V0, 0x3C
+    STEP(0x256, 0x603C);
+    V[0] = 0x3C;
+L258: // F015 LD DT, V0
+    STEP(0x258, 0xF015);
+    c->dt = V[0];
+L25A: // F007 LD V0, DT
+    STEP(0x25A, 0xF007);
+    V[0] = c->dt;
+L25C: // 3000 SE V0, 0x00
+    STEP(0x25C, 0x3000);
+    if (V[0] == 0x00) goto L260;
+L25E: // 125A JP 0x25A
+    STEP(0x25E, 0x125A);
+    goto L25A;
+L260: // 223A CALL 0x23A
+    STEP(0x260, 0x223A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x260;
+    goto L23A;
+L262: // 7AFF ADD VA, 0xFF
+    STEP(0x262, 0x7AFF);
+    V[10] += 0xFF;
+L264: // 223A CALL 0x23A
+    STEP(0x264, 0x223A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x264;
+    goto L23A;
+L266: // 6005 LD V0, 0x05
+    STEP(0x266, 0x6005);
+    V[0] = 0x05;
+L268: // F018 LD ST, V0
+    STEP(0x268, 0xF018);
+    c->st = V[0];
+L26A: // 4A00 SNE VA, 0x00
+    STEP(0x26A, 0x4A00);
+    if (V[10] != 0x00) goto L26E;
+L26C: // 1274 JP 0x274
+    STEP(0x26C, 0x1274);
+    goto L274;
+L26E: // 603C LD V0, 0x3C
+    STEP(0x26E, 0x603C);
+    V[0] = 0x3C;
+L270: // F015 LD DT, V0
+    STEP(0x270, 0xF015);
+    c->dt = V[0];
+L272: // 125A JP 0x25A
+    STEP(0x272, 0x125A);
+    goto L25A;
+L274: // 00E0 CLS
+    STEP(0x274, 0x00E0);
+    c->pc = 0x274;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x276) goto dispatch;
+L276: // 6032 LD V0, 0x32
+    STEP(0x276, 0x6032);
+    V[0] = 0x32;
+L278: // F018 LD ST, V0
+    STEP(0x278, 0xF018);
+    c->st = V[0];
+L27A: // 6014 LD V0, 0x14
+    STEP(0x27A, 0x6014);
+    V[0] = 0x14;
+L27C: // F015 LD DT, V0
+    STEP(0x27C, 0xF015);
+    c->dt = V[0];
+L27E: // F007 LD V0, DT
+    STEP(0x27E, 0xF007);
+    V[0] = c->dt;
+L280: // 3000 SE V0, 0x00
+    STEP(0x280, 0x3000);
+    if (V[0] == 0x00) goto L284;
+L282: // 127E JP 0x27E
+    STEP(0x282, 0x127E);
+    goto L27E;
+L284: // 6A05 LD VA, 0x05
+    STEP(0x284, 0x6A05);
+    V[10] = 0x05;
+L286: // 223A CALL 0x23A
+    STEP(0x286, 0x223A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x286;
+    goto L23A;
+L288: // 1206 JP 0x206
+    STEP(0x288, 0x1206);
+    goto L206;
+}
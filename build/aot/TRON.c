@@ -0,0 +1,890 @@
+// generated by chip8-aot from roms/TRON.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x00, 0xE0, 0xA3, 0x4C, 0x63, 0x12, 0x64, 0x0B, 0xD3, 0x49, 0x73, 0x08,
+    0xA3, 0x55, 0xD3, 0x49, 0x73, 0x08, 0xA3, 0x5E, 0xD3, 0x49, 0x73, 0x08,
+    0xA3, 0x67, 0xD3, 0x49, 0x63, 0x00, 0x64, 0x00, 0x60, 0x0F, 0xE0, 0xA1,
+    0x12, 0x2E, 0x60, 0x0B, 0xE0, 0xA1, 0x12, 0x34, 0x12, 0x20, 0x65, 0x01,
+    0x00, 0xE0, 0x12, 0x60, 0x65, 0x02, 0x00, 0xE0, 0x60, 0x00, 0x61, 0x00,
+    0x62, 0x1F, 0xA3, 0x4C, 0xD0, 0x11, 0xD0, 0x21, 0x70, 0x08, 0x40, 0x40,
+    0x12, 0x4C, 0x12, 0x40, 0x60, 0x01, 0x61, 0x00, 0x62, 0x3F, 0xA3, 0x70,
+    0xD1, 0x0A, 0xD2, 0x0A, 0x70, 0x0A, 0x40, 0x1F, 0x12, 0x60, 0x12, 0x54,
+    0xA3, 0x70, 0x6C, 0x20, 0x6B, 0x0F, 0x6A, 0x1F, 0x6D, 0x0F, 0x66, 0xFF,
+    0x67, 0x00, 0x68, 0x01, 0x69, 0x00, 0xDA, 0xB1, 0xDC, 0xD1, 0x60, 0x00,
+    0xE0, 0x9E, 0x12, 0x78, 0x60, 0x0A, 0xF0, 0x18, 0x60, 0x01, 0xE0, 0xA1,
+    0x22, 0xFC, 0x70, 0x03, 0xE0, 0xA1, 0x23, 0x06, 0x70, 0x03, 0xE0, 0xA1,
+    0x23, 0x10, 0x70, 0x03, 0xE0, 0xA1, 0x23, 0x1A, 0x60, 0x03, 0xE0, 0xA1,
+    0x23, 0x24, 0x70, 0x09, 0xE0, 0xA1, 0x23, 0x2E, 0x70, 0xFD, 0xE0, 0xA1,
+    0x23, 0x38, 0x70, 0x05, 0xE0, 0xA1, 0x23, 0x42, 0x8A, 0x64, 0x8C, 0x84,
+    0x8B, 0x74, 0x8D, 0x94, 0xDA, 0xB1, 0x4F, 0x01, 0x12, 0xD0, 0xDC, 0xD1,
+    0x4F, 0x01, 0x12, 0xDA, 0x60, 0x02, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00,
+    0x12, 0xC8, 0x12, 0x80, 0x00, 0xE0, 0x74, 0x01, 0x44, 0x0A, 0x64, 0x00,
+    0x12, 0xE2, 0x00, 0xE0, 0x73, 0x01, 0x43, 0x0A, 0x63, 0x00, 0x60, 0x0A,
+    0xF0, 0x18, 0xF3, 0x29, 0x60, 0x19, 0x61, 0x0D, 0xD0, 0x15, 0xA3, 0x7A,
+    0x70, 0x06, 0xD0, 0x14, 0xF4, 0x29, 0x70, 0x05, 0xD0, 0x15, 0x12, 0x20,
+    0x47, 0x01, 0x00, 0xEE, 0x66, 0x00, 0x67, 0xFF, 0x00, 0xEE, 0x47, 0xFF,
+    0x00, 0xEE, 0x66, 0x00, 0x67, 0x01, 0x00, 0xEE, 0x49, 0x01, 0x00, 0xEE,
+    0x68, 0x00, 0x69, 0xFF, 0x00, 0xEE, 0x49, 0xFF, 0x00, 0xEE, 0x68, 0x00,
+    0x69, 0x01, 0x00, 0xEE, 0x46, 0x01, 0x00, 0xEE, 0x66, 0xFF, 0x67, 0x00,
+    0x00, 0xEE, 0x46, 0xFF, 0x00, 0xEE, 0x66, 0x01, 0x67, 0x00, 0x00, 0xEE,
+    0x48, 0x01, 0x00, 0xEE, 0x68, 0xFF, 0x69, 0x00, 0x00, 0xEE, 0x48, 0xFF,
+    0x00, 0xEE, 0x68, 0x01, 0x69, 0x00, 0x00, 0xEE, 0xFF, 0x80, 0xBE, 0x88,
+    0x88, 0x88, 0x88, 0x80, 0xFF, 0xFF, 0x00, 0xFB, 0x8A, 0xFA, 0x92, 0x8B,
+    0x00, 0xFF, 0xFF, 0x00, 0xE8, 0x2C, 0x2A, 0x29, 0xE8, 0x00, 0xFF, 0xE0,
+    0x20, 0xA0, 0xA0, 0xA0, 0xA0, 0xA0, 0x20, 0xE0, 0x80, 0x80, 0x80, 0x80,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x40, 0x00, 0x40,
+};
+const size_t aot_rom_size = 382;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000003F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+        case 0x2FE: goto L2FE;
+        case 0x300: goto L300;
+        case 0x302: goto L302;
+        case 0x304: goto L304;
+        case 0x306: goto L306;
+        case 0x308: goto L308;
+        case 0x30A: goto L30A;
+        case 0x30C: goto L30C;
+        case 0x30E: goto L30E;
+        case 0x310: goto L310;
+        case 0x312: goto L312;
+        case 0x314: goto L314;
+        case 0x316: goto L316;
+        case 0x318: goto L318;
+        case 0x31A: goto L31A;
+        case 0x31C: goto L31C;
+        case 0x31E: goto L31E;
+        case 0x320: goto L320;
+        case 0x322: goto L322;
+        case 0x324: goto L324;
+        case 0x326: goto L326;
+        case 0x328: goto L328;
+        case 0x32A: goto L32A;
+        case 0x32C: goto L32C;
+        case 0x32E: goto L32E;
+        case 0x330: goto L330;
+        case 0x332: goto L332;
+        case 0x334: goto L334;
+        case 0x336: goto L336;
+        case 0x338: goto L338;
+        case 0x33A: goto L33A;
+        case 0x33C: goto L33C;
+        case 0x33E: goto L33E;
+        case 0x340: goto L340;
+        case 0x342: goto L342;
+        case 0x344: goto L344;
+        case 0x346: goto L346;
+        case 0x348: goto L348;
+        case 0x34A: goto L34A;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 00E0 CLS
+    STEP(0x200, 0x00E0);
+    c->pc = 0x200;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x202) goto dispatch;
+L202: // A34C LD I, 0x34C
+    STEP(0x202, 0xA34C);
+    c->I = 0x34C;
+L204: // 6312 LD V3, 0x12
+    STEP(0x204, 0x6312);
+    V[3] = 0x12;
+L206: // 640B LD V4, 0x0B
+    STEP(0x206, 0x640B);
+    V[4] = 0x0B;
+L208: // D349 DRW V3, V4, 9
+    STEP(0x208, 0xD349);
+    c->pc = 0x208;
+    predecode(0xD349, &in);
+    execute(c, &in);
+    if (c->pc != 0x20A) goto dispatch;
+L20A: // 7308 ADD V3, 0x08
+    STEP(0x20A, 0x7308);
+    V[3] += 0x08;
+L20C: // A355 LD I, 0x355
+    STEP(0x20C, 0xA355);
+    c->I = 0x355;
+L20E: // D349 DRW V3, V4, 9
+    STEP(0x20E, 0xD349);
+    c->pc = 0x20E;
+    predecode(0xD349, &in);
+    execute(c, &in);
+    if (c->pc != 0x210) goto dispatch;
+L210: // 7308 ADD V3, 0x08
+    STEP(0x210, 0x7308);
+    V[3] += 0x08;
+L212: // A35E LD I, 0x35E
+    STEP(0x212, 0xA35E);
+    c->I = 0x35E;
+L214: // D349 DRW V3, V4, 9
+    STEP(0x214, 0xD349);
+    c->pc = 0x214;
+    predecode(0xD349, &in);
+    execute(c, &in);
+    if (c->pc != 0x216) goto dispatch;
+L216: // 7308 ADD V3, 0x08
+    STEP(0x216, 0x7308);
+    V[3] += 0x08;
+L218: // A367 LD I, 0x367
+    STEP(0x218, 0xA367);
+    c->I = 0x367;
+L21A: // D349 DRW V3, V4, 9
+    STEP(0x21A, 0xD349);
+    c->pc = 0x21A;
+    predecode(0xD349, &in);
+    execute(c, &in);
+    if (c->pc != 0x21C) goto dispatch;
+L21C: // 6300 LD V3, 0x00
+    STEP(0x21C, 0x6300);
+    V[3] = 0x00;
+L21E: // 6400 LD V4, 0x00
+    STEP(0x21E, 0x6400);
+    V[4] = 0x00;
+L220: // 600F LD V0, 0x0F
+    STEP(0x220, 0x600F);
+    V[0] = 0x0F;
+L222: // E0A1 SKNP V0
+    STEP(0x222, 0xE0A1);
+    c->pc = 0x222;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x224) goto dispatch;
+L224: // 122E JP 0x22E
+    STEP(0x224, 0x122E);
+    goto L22E;
+L226: // 600B LD V0, 0x0B
+    STEP(0x226, 0x600B);
+    V[0] = 0x0B;
+L228: // E0A1 SKNP V0
+    STEP(0x228, 0xE0A1);
+    c->pc = 0x228;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x22A) goto dispatch;
+L22A: // 1234 JP 0x234
+    STEP(0x22A, 0x1234);
+    goto L234;
+L22C: // 1220 JP 0x220
+    STEP(0x22C, 0x1220);
+    goto L220;
+L22E: // 6501 LD V5, 0x01
+    STEP(0x22E, 0x6501);
+    V[5] = 0x01;
+L230: // 00E0 CLS
+    STEP(0x230, 0x00E0);
+    c->pc = 0x230;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x232) goto dispatch;
+L232: // 1260 JP 0x260
+    STEP(0x232, 0x1260);
+    goto L260;
+L234: // 6502 LD V5, 0x02
+    STEP(0x234, 0x6502);
+    V[5] = 0x02;
+L236: // 00E0 CLS
+    STEP(0x236, 0x00E0);
+    c->pc = 0x236;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x238) goto dispatch;
+L238: // 6000 LD V0, 0x00
+    STEP(0x238, 0x6000);
+    V[0] = 0x00;
+L23A: // 6100 LD V1, 0x00
+    STEP(0x23A, 0x6100);
+    V[1] = 0x00;
+L23C: // 621F LD V2, 0x1F
+    STEP(0x23C, 0x621F);
+    V[2] = 0x1F;
+L23E: // A34C LD I, 0x34C
+    STEP(0x23E, 0xA34C);
+    c->I = 0x34C;
+L240: // D011 DRW V0, V1, 1
+    STEP(0x240, 0xD011);
+    c->pc = 0x240;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x242) goto dispatch;
+L242: // D021 DRW V0, V2, 1
+    STEP(0x242, 0xD021);
+    c->pc = 0x242;
+    predecode(0xD021, &in);
+    execute(c, &in);
+    if (c->pc != 0x244) goto dispatch;
+L244: // 7008 ADD V0, 0x08
+    STEP(0x244, 0x7008);
+    V[0] += 0x08;
+L246: // 4040 SNE V0, 0x40
+    STEP(0x246, 0x4040);
+    if (V[0] != 0x40) goto L24A;
+L248: // 124C JP 0x24C
+    STEP(0x248, 0x124C);
+    goto L24C;
+L24A: // 1240 JP 0x240
+    STEP(0x24A, 0x1240);
+    goto L240;
+L24C: // 6001 LD V0, 0x01
+    STEP(0x24C, 0x6001);
+    V[0] = 0x01;
+L24E: // 6100 LD V1, 0x00
+    STEP(0x24E, 0x6100);
+    V[1] = 0x00;
+L250: // 623F LD V2, 0x3F
+    STEP(0x250, 0x623F);
+    V[2] = 0x3F;
+L252: // A370 LD I, 0x370
+    STEP(0x252, 0xA370);
+    c->I = 0x370;
+L254: // D10A DRW V1, V0, 10
+    STEP(0x254, 0xD10A);
+    c->pc = 0x254;
+    predecode(0xD10A, &in);
+    execute(c, &in);
+    if (c->pc != 0x256) goto dispatch;
+L256: // D20A DRW V2, V0, 10
+    STEP(0x256, 0xD20A);
+    c->pc = 0x256;
+    predecode(0xD20A, &in);
+    execute(c, &in);
+    if (c->pc != 0x258) goto dispatch;
+L258: // 700A ADD V0, 0x0A
+    STEP(0x258, 0x700A);
+    V[0] += 0x0A;
+L25A: // 401F SNE V0, 0x1F
+    STEP(0x25A, 0x401F);
+    if (V[0] != 0x1F) goto L25E;
+L25C: // 1260 JP 0x260
+    STEP(0x25C, 0x1260);
+    goto L260;
+L25E: // 1254 JP 0x254
+    STEP(0x25E, 0x1254);
+    goto L254;
+L260: // A370 LD I, 0x370
+    STEP(0x260, 0xA370);
+    c->I = 0x370;
+L262: // 6C20 LD VC, 0x20
+    STEP(0x262, 0x6C20);
+    V[12] = 0x20;
+L264: // 6B0F LD VB, 0x0F
+    STEP(0x264, 0x6B0F);
+    V[11] = 0x0F;
+L266: // 6A1F LD VA, 0x1F
+    STEP(0x266, 0x6A1F);
+    V[10] = 0x1F;
+L268: // 6D0F LD VD, 0x0F
+    STEP(0x268, 0x6D0F);
+    V[13] = 0x0F;
+L26A: // 66FF LD V6, 0xFF
+    STEP(0x26A, 0x66FF);
+    V[6] = 0xFF;
+L26C: // 6700 LD V7, 0x00
+    STEP(0x26C, 0x6700);
+    V[7] = 0x00;
+L26E: // 6801 LD V8, 0x01
+    STEP(0x26E, 0x6801);
+    V[8] = 0x01;
+L270: // 6900 LD V9, 0x00
+    STEP(0x270, 0x6900);
+    V[9] = 0x00;
+L272: // DAB1 DRW VA, VB, 1
+    STEP(0x272, 0xDAB1);
+    c->pc = 0x272;
+    predecode(0xDAB1, &in);
+    execute(c, &in);
+    if (c->pc != 0x274) goto dispatch;
+L274: // DCD1 DRW VC, VD, 1
+    STEP(0x274, 0xDCD1);
+    c->pc = 0x274;
+    predecode(0xDCD1, &in);
+    execute(c, &in);
+    if (c->pc != 0x276) goto dispatch;
+L276: // 6000 LD V0, 0x00
+    STEP(0x276, 0x6000);
+    V[0] = 0x00;
+L278: // E09E SKP V0
+    STEP(0x278, 0xE09E);
+    c->pc = 0x278;
+    predecode(0xE09E, &in);
+    execute(c, &in);
+    if (c->pc != 0x27A) goto dispatch;
+L27A: // 1278 JP 0x278
+    STEP(0x27A, 0x1278);
+    goto L278;
+L27C: // 600A LD V0, 0x0A
+    STEP(0x27C, 0x600A);
+    V[0] = 0x0A;
+L27E: // F018 LD ST, V0
+    STEP(0x27E, 0xF018);
+    c->st = V[0];
+L280: // 6001 LD V0, 0x01
+    STEP(0x280, 0x6001);
+    V[0] = 0x01;
+L282: // E0A1 SKNP V0
+    STEP(0x282, 0xE0A1);
+    c->pc = 0x282;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x284) goto dispatch;
+L284: // 22FC CALL 0x2FC
+    STEP(0x284, 0x22FC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x284;
+    goto L2FC;
+L286: // 7003 ADD V0, 0x03
+    STEP(0x286, 0x7003);
+    V[0] += 0x03;
+L288: // E0A1 SKNP V0
+    STEP(0x288, 0xE0A1);
+    c->pc = 0x288;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x28A) goto dispatch;
+L28A: // 2306 CALL 0x306
+    STEP(0x28A, 0x2306);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x28A;
+    goto L306;
+L28C: // 7003 ADD V0, 0x03
+    STEP(0x28C, 0x7003);
+    V[0] += 0x03;
+L28E: // E0A1 SKNP V0
+    STEP(0x28E, 0xE0A1);
+    c->pc = 0x28E;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x290) goto dispatch;
+L290: // 2310 CALL 0x310
+    STEP(0x290, 0x2310);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x290;
+    goto L310;
+L292: // 7003 ADD V0, 0x03
+    STEP(0x292, 0x7003);
+    V[0] += 0x03;
+L294: // E0A1 SKNP V0
+    STEP(0x294, 0xE0A1);
+    c->pc = 0x294;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x296) goto dispatch;
+L296: // 231A CALL 0x31A
+    STEP(0x296, 0x231A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x296;
+    goto L31A;
+L298: // 6003 LD V0, 0x03
+    STEP(0x298, 0x6003);
+    V[0] = 0x03;
+L29A: // E0A1 SKNP V0
+    STEP(0x29A, 0xE0A1);
+    c->pc = 0x29A;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x29C) goto dispatch;
+L29C: // 2324 CALL 0x324
+    STEP(0x29C, 0x2324);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x29C;
+    goto L324;
+L29E: // 7009 ADD V0, 0x09
+    STEP(0x29E, 0x7009);
+    V[0] += 0x09;
+L2A0: // E0A1 SKNP V0
+    STEP(0x2A0, 0xE0A1);
+    c->pc = 0x2A0;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A2) goto dispatch;
+L2A2: // 232E CALL 0x32E
+    STEP(0x2A2, 0x232E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2A2;
+    goto L32E;
+L2A4: // 70FD ADD V0, 0xFD
+    STEP(0x2A4, 0x70FD);
+    V[0] += 0xFD;
+L2A6: // E0A1 SKNP V0
+    STEP(0x2A6, 0xE0A1);
+    c->pc = 0x2A6;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A8) goto dispatch;
+L2A8: // 2338 CALL 0x338
+    STEP(0x2A8, 0x2338);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2A8;
+    goto L338;
+L2AA: // 7005 ADD V0, 0x05
+    STEP(0x2AA, 0x7005);
+    V[0] += 0x05;
+L2AC: // E0A1 SKNP V0
+    STEP(0x2AC, 0xE0A1);
+    c->pc = 0x2AC;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2AE) goto dispatch;
+L2AE: // 2342 CALL 0x342
+    STEP(0x2AE, 0x2342);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2AE;
+    goto L342;
+L2B0: // 8A64 ADD VA, V6
+    STEP(0x2B0, 0x8A64);
+    V[15] = V[10] + V[6] > 0xFF;
+    V[10] += V[6];
+L2B2: // 8C84 ADD VC, V8
+    STEP(0x2B2, 0x8C84);
+    V[15] = V[12] + V[8] > 0xFF;
+    V[12] += V[8];
+L2B4: // 8B74 ADD VB, V7
+    STEP(0x2B4, 0x8B74);
+    V[15] = V[11] + V[7] > 0xFF;
+    V[11] += V[7];
+L2B6: // 8D94 ADD VD, V9
+    STEP(0x2B6, 0x8D94);
+    V[15] = V[13] + V[9] > 0xFF;
+    V[13] += V[9];
+L2B8: // DAB1 DRW VA, VB, 1
+    STEP(0x2B8, 0xDAB1);
+    c->pc = 0x2B8;
+    predecode(0xDAB1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2BA) goto dispatch;
+L2BA: // 4F01 SNE VF, 0x01
+    STEP(0x2BA, 0x4F01);
+    if (V[15] != 0x01) goto L2BE;
+L2BC: // 12D0 JP 0x2D0
+    STEP(0x2BC, 0x12D0);
+    goto L2D0;
+L2BE: // DCD1 DRW VC, VD, 1
+    STEP(0x2BE, 0xDCD1);
+    c->pc = 0x2BE;
+    predecode(0xDCD1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C0) goto dispatch;
+L2C0: // 4F01 SNE VF, 0x01
+    STEP(0x2C0, 0x4F01);
+    if (V[15] != 0x01) goto L2C4;
+L2C2: // 12DA JP 0x2DA
+    STEP(0x2C2, 0x12DA);
+    goto L2DA;
+L2C4: // 6002 LD V0, 0x02
+    STEP(0x2C4, 0x6002);
+    V[0] = 0x02;
+L2C6: // F015 LD DT, V0
+    STEP(0x2C6, 0xF015);
+    c->dt = V[0];
+L2C8: // F007 LD V0, DT
+    STEP(0x2C8, 0xF007);
+    V[0] = c->dt;
+L2CA: // 3000 SE V0, 0x00
+    STEP(0x2CA, 0x3000);
+    if (V[0] == 0x00) goto L2CE;
+L2CC: // 12C8 JP 0x2C8
+    STEP(0x2CC, 0x12C8);
+    goto L2C8;
+L2CE: // 1280 JP 0x280
+    STEP(0x2CE, 0x1280);
+    goto L280;
+L2D0: // 00E0 CLS
+    STEP(0x2D0, 0x00E0);
+    c->pc = 0x2D0;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x2D2) goto dispatch;
+L2D2: // 7401 ADD V4, 0x01
+    STEP(0x2D2, 0x7401);
+    V[4] += 0x01;
+L2D4: // 440A SNE V4, 0x0A
+    STEP(0x2D4, 0x440A);
+    if (V[4] != 0x0A) goto L2D8;
+L2D6: // 6400 LD V4, 0x00
+    STEP(0x2D6, 0x6400);
+    V[4] = 0x00;
+L2D8: // 12E2 JP 0x2E2
+    STEP(0x2D8, 0x12E2);
+    goto L2E2;
+L2DA: // 00E0 CLS
+    STEP(0x2DA, 0x00E0);
+    c->pc = 0x2DA;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x2DC) goto dispatch;
+L2DC: // 7301 ADD V3, 0x01
+    STEP(0x2DC, 0x7301);
+    V[3] += 0x01;
+L2DE: // 430A SNE V3, 0x0A
+    STEP(0x2DE, 0x430A);
+    if (V[3] != 0x0A) goto L2E2;
+L2E0: // 6300 LD V3, 0x00
+    STEP(0x2E0, 0x6300);
+    V[3] = 0x00;
+L2E2: // 600A LD V0, 0x0A
+    STEP(0x2E2, 0x600A);
+    V[0] = 0x0A;
+L2E4: // F018 LD ST, V0
+    STEP(0x2E4, 0xF018);
+    c->st = V[0];
+L2E6: // F329 LD F, V3
+    STEP(0x2E6, 0xF329);
+    c->I = V[3] * 5;
+L2E8: // 6019 LD V0, 0x19
+    STEP(0x2E8, 0x6019);
+    V[0] = 0x19;
+L2EA: // 610D LD V1, 0x0D
+    STEP(0x2EA, 0x610D);
+    V[1] = 0x0D;
+L2EC: // D015 DRW V0, V1, 5
+    STEP(0x2EC, 0xD015);
+    c->pc = 0x2EC;
+    predecode(0xD015, &in);
+    execute(c, &in);
+    if (c->pc != 0x2EE) goto dispatch;
+L2EE: // A37A LD I, 0x37A
+    STEP(0x2EE, 0xA37A);
+    c->I = 0x37A;
+L2F0: // 7006 ADD V0, 0x06
+    STEP(0x2F0, 0x7006);
+    V[0] += 0x06;
+L2F2: // D014 DRW V0, V1, 4
+    STEP(0x2F2, 0xD014);
+    c->pc = 0x2F2;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x2F4) goto dispatch;
+L2F4: // F429 LD F, V4
+    STEP(0x2F4, 0xF429);
+    c->I = V[4] * 5;
+L2F6: // 7005 ADD V0, 0x05
+    STEP(0x2F6, 0x7005);
+    V[0] += 0x05;
+L2F8: // D015 DRW V0, V1, 5
+    STEP(0x2F8, 0xD015);
+    c->pc = 0x2F8;
+    predecode(0xD015, &in);
+    execute(c, &in);
+    if (c->pc != 0x2FA) goto dispatch;
+L2FA: // 1220 JP 0x220
+    STEP(0x2FA, 0x1220);
+    goto L220;
+L2FC: // 4701 SNE V7, 0x01
+    STEP(0x2FC, 0x4701);
+    if (V[7] != 0x01) goto L300;
+L2FE: // 00EE RET
+    STEP(0x2FE, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L300: // 6600 LD V6, 0x00
+    STEP(0x300, 0x6600);
+    V[6] = 0x00;
+L302: // 67FF LD V7, 0xFF
+    STEP(0x302, 0x67FF);
+    V[7] = 0xFF;
+L304: // 00EE RET
+    STEP(0x304, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L306: // 47FF SNE V7, 0xFF
+    STEP(0x306, 0x47FF);
+    if (V[7] != 0xFF) goto L30A;
+L308: // 00EE RET
+    STEP(0x308, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L30A: // 6600 LD V6, 0x00
+    STEP(0x30A, 0x6600);
+    V[6] = 0x00;
+L30C: // 6701 LD V7, 0x01
+    STEP(0x30C, 0x6701);
+    V[7] = 0x01;
+L30E: // 00EE RET
+    STEP(0x30E, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L310: // 4901 SNE V9, 0x01
+    STEP(0x310, 0x4901);
+    if (V[9] != 0x01) goto L314;
+L312: // 00EE RET
+    STEP(0x312, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L314: // 6800 LD V8, 0x00
+    STEP(0x314, 0x6800);
+    V[8] = 0x00;
+L316: // 69FF LD V9, 0xFF
+    STEP(0x316, 0x69FF);
+    V[9] = 0xFF;
+L318: // 00EE RET
+    STEP(0x318, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L31A: // 49FF SNE V9, 0xFF
+    STEP(0x31A, 0x49FF);
+    if (V[9] != 0xFF) goto L31E;
+L31C: // 00EE RET
+    STEP(0x31C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L31E: // 6800 LD V8, 0x00
+    STEP(0x31E, 0x6800);
+    V[8] = 0x00;
+L320: // 6901 LD V9, 0x01
+    STEP(0x320, 0x6901);
+    V[9] = 0x01;
+L322: // 00EE RET
+    STEP(0x322, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L324: // 4601 SNE V6, 0x01
+    STEP(0x324, 0x4601);
+    if (V[6] != 0x01) goto L328;
+L326: // 00EE RET
+    STEP(0x326, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L328: // 66FF LD V6, 0xFF
+    STEP(0x328, 0x66FF);
+    V[6] = 0xFF;
+L32A: // 6700 LD V7, 0x00
+    STEP(0x32A, 0x6700);
+    V[7] = 0x00;
+L32C: // 00EE RET
+    STEP(0x32C, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L32E: // 46FF SNE V6, 0xFF
+    STEP(0x32E, 0x46FF);
+    if (V[6] != 0xFF) goto L332;
+L330: // 00EE RET
+    STEP(0x330, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L332: // 6601 LD V6, 0x01
+    STEP(0x332, 0x6601);
+    V[6] = 0x01;
+L334: // 6700 LD V7, 0x00
+    STEP(0x334, 0x6700);
+    V[7] = 0x00;
+L336: // 00EE RET
+    STEP(0x336, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L338: // 4801 SNE V8, 0x01
+    STEP(0x338, 0x4801);
+    if (V[8] != 0x01) goto L33C;
+L33A: // 00EE RET
+    STEP(0x33A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L33C: // 68FF LD V8, 0xFF
+    STEP(0x33C, 0x68FF);
+    V[8] = 0xFF;
+L33E: // 6900 LD V9, 0x00
+    STEP(0x33E, 0x6900);
+    V[9] = 0x00;
+L340: // 00EE RET
+    STEP(0x340, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L342: // 48FF SNE V8, 0xFF
+    STEP(0x342, 0x48FF);
+    if (V[8] != 0xFF) goto L346;
+L344: // 00EE RET
+    STEP(0x344, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L346: // 6801 LD V8, 0x01
+    STEP(0x346, 0x6801);
+    V[8] = 0x01;
+L348: // 6900 LD V9, 0x00
+    STEP(0x348, 0x6900);
+    V[9] = 0x00;
+L34A: // 00EE RET
+    STEP(0x34A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
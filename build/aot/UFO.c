@@ -0,0 +1,587 @@
+// generated by chip8-aot from roms/UFO.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0xA2, 0xCD, 0x69, 0x38, 0x6A, 0x08, 0xD9, 0xA3, 0xA2, 0xD0, 0x6B, 0x00,
+    0x6C, 0x03, 0xDB, 0xC3, 0xA2, 0xD6, 0x64, 0x1D, 0x65, 0x1F, 0xD4, 0x51,
+    0x67, 0x00, 0x68, 0x0F, 0x22, 0xA2, 0x22, 0xAC, 0x48, 0x00, 0x12, 0x22,
+    0x64, 0x1E, 0x65, 0x1C, 0xA2, 0xD3, 0xD4, 0x53, 0x6E, 0x00, 0x66, 0x80,
+    0x6D, 0x04, 0xED, 0xA1, 0x66, 0xFF, 0x6D, 0x05, 0xED, 0xA1, 0x66, 0x00,
+    0x6D, 0x06, 0xED, 0xA1, 0x66, 0x01, 0x36, 0x80, 0x22, 0xD8, 0xA2, 0xD0,
+    0xDB, 0xC3, 0xCD, 0x01, 0x8B, 0xD4, 0xDB, 0xC3, 0x3F, 0x00, 0x12, 0x92,
+    0xA2, 0xCD, 0xD9, 0xA3, 0xCD, 0x01, 0x3D, 0x00, 0x6D, 0xFF, 0x79, 0xFE,
+    0xD9, 0xA3, 0x3F, 0x00, 0x12, 0x8C, 0x4E, 0x00, 0x12, 0x2E, 0xA2, 0xD3,
+    0xD4, 0x53, 0x45, 0x00, 0x12, 0x86, 0x75, 0xFF, 0x84, 0x64, 0xD4, 0x53,
+    0x3F, 0x01, 0x12, 0x46, 0x6D, 0x08, 0x8D, 0x52, 0x4D, 0x08, 0x12, 0x8C,
+    0x12, 0x92, 0x22, 0xAC, 0x78, 0xFF, 0x12, 0x1E, 0x22, 0xA2, 0x77, 0x05,
+    0x12, 0x96, 0x22, 0xA2, 0x77, 0x0F, 0x22, 0xA2, 0x6D, 0x03, 0xFD, 0x18,
+    0xA2, 0xD3, 0xD4, 0x53, 0x12, 0x86, 0xA2, 0xF8, 0xF7, 0x33, 0x63, 0x00,
+    0x22, 0xB6, 0x00, 0xEE, 0xA2, 0xF8, 0xF8, 0x33, 0x63, 0x32, 0x22, 0xB6,
+    0x00, 0xEE, 0x6D, 0x1B, 0xF2, 0x65, 0xF0, 0x29, 0xD3, 0xD5, 0x73, 0x05,
+    0xF1, 0x29, 0xD3, 0xD5, 0x73, 0x05, 0xF2, 0x29, 0xD3, 0xD5, 0x00, 0xEE,
+    0x01, 0x7C, 0xFE, 0x7C, 0x60, 0xF0, 0x60, 0x40, 0xE0, 0xA0, 0xF8, 0xD4,
+    0x6E, 0x01, 0x6D, 0x10, 0xFD, 0x18, 0x00, 0xEE,
+};
+const size_t aot_rom_size = 224;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // A2CD LD I, 0x2CD
+    STEP(0x200, 0xA2CD);
+    c->I = 0x2CD;
+L202: // 6938 LD V9, 0x38
+    STEP(0x202, 0x6938);
+    V[9] = 0x38;
+L204: // 6A08 LD VA, 0x08
+    STEP(0x204, 0x6A08);
+    V[10] = 0x08;
+L206: // D9A3 DRW V9, VA, 3
+    STEP(0x206, 0xD9A3);
+    c->pc = 0x206;
+    predecode(0xD9A3, &in);
+    execute(c, &in);
+    if (c->pc != 0x208) goto dispatch;
+L208: // A2D0 LD I, 0x2D0
+    STEP(0x208, 0xA2D0);
+    c->I = 0x2D0;
+L20A: // 6B00 LD VB, 0x00
+    STEP(0x20A, 0x6B00);
+    V[11] = 0x00;
+L20C: // 6C03 LD VC, 0x03
+    STEP(0x20C, 0x6C03);
+    V[12] = 0x03;
+L20E: // DBC3 DRW VB, VC, 3
+    STEP(0x20E, 0xDBC3);
+    c->pc = 0x20E;
+    predecode(0xDBC3, &in);
+    execute(c, &in);
+    if (c->pc != 0x210) goto dispatch;
+L210: // A2D6 LD I, 0x2D6
+    STEP(0x210, 0xA2D6);
+    c->I = 0x2D6;
+L212: // 641D LD V4, 0x1D
+    STEP(0x212, 0x641D);
+    V[4] = 0x1D;
+L214: // 651F LD V5, 0x1F
+    STEP(0x214, 0x651F);
+    V[5] = 0x1F;
+L216: // D451 DRW V4, V5, 1
+    STEP(0x216, 0xD451);
+    c->pc = 0x216;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x218) goto dispatch;
+L218: // 6700 LD V7, 0x00
+    STEP(0x218, 0x6700);
+    V[7] = 0x00;
+L21A: // 680F LD V8, 0x0F
+    STEP(0x21A, 0x680F);
+    V[8] = 0x0F;
+L21C: // 22A2 CALL 0x2A2
+    STEP(0x21C, 0x22A2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x21C;
+    goto L2A2;
+L21E: // 22AC CALL 0x2AC
+    STEP(0x21E, 0x22AC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x21E;
+    goto L2AC;
+L220: // 4800 SNE V8, 0x00
+    STEP(0x220, 0x4800);
+    if (V[8] != 0x00) goto L224;
+L222: // 1222 JP 0x222
+    STEP(0x222, 0x1222);
+    goto L222;
+L224: // 641E LD V4, 0x1E
+    STEP(0x224, 0x641E);
+    V[4] = 0x1E;
+L226: // 651C LD V5, 0x1C
+    STEP(0x226, 0x651C);
+    V[5] = 0x1C;
+L228: // A2D3 LD I, 0x2D3
+    STEP(0x228, 0xA2D3);
+    c->I = 0x2D3;
+L22A: // D453 DRW V4, V5, 3
+    STEP(0x22A, 0xD453);
+    c->pc = 0x22A;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x22C) goto dispatch;
+L22C: // 6E00 LD VE, 0x00
+    STEP(0x22C, 0x6E00);
+    V[14] = 0x00;
+L22E: // 6680 LD V6, 0x80
+    STEP(0x22E, 0x6680);
+    V[6] = 0x80;
+L230: // 6D04 LD VD, 0x04
+    STEP(0x230, 0x6D04);
+    V[13] = 0x04;
+L232: // EDA1 SKNP VD
+    STEP(0x232, 0xEDA1);
+    c->pc = 0x232;
+    predecode(0xEDA1, &in);
+    execute(c, &in);
+    if (c->pc != 0x234) goto dispatch;
+L234: // 66FF LD V6, 0xFF
+    STEP(0x234, 0x66FF);
+    V[6] = 0xFF;
+L236: // 6D05 LD VD, 0x05
+    STEP(0x236, 0x6D05);
+    V[13] = 0x05;
+L238: // EDA1 SKNP VD
+    STEP(0x238, 0xEDA1);
+    c->pc = 0x238;
+    predecode(0xEDA1, &in);
+    execute(c, &in);
+    if (c->pc != 0x23A) goto dispatch;
+L23A: // 6600 LD V6, 0x00
+    STEP(0x23A, 0x6600);
+    V[6] = 0x00;
+L23C: // 6D06 LD VD, 0x06
+    STEP(0x23C, 0x6D06);
+    V[13] = 0x06;
+L23E: // EDA1 SKNP VD
+    STEP(0x23E, 0xEDA1);
+    c->pc = 0x23E;
+    predecode(0xEDA1, &in);
+    execute(c, &in);
+    if (c->pc != 0x240) goto dispatch;
+L240: // 6601 LD V6, 0x01
+    STEP(0x240, 0x6601);
+    V[6] = 0x01;
+L242: // 3680 SE V6, 0x80
+    STEP(0x242, 0x3680);
+    if (V[6] == 0x80) goto L246;
+L244: // 22D8 CALL 0x2D8
+    STEP(0x244, 0x22D8);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x244;
+    goto L2D8;
+L246: // A2D0 LD I, 0x2D0
+    STEP(0x246, 0xA2D0);
+    c->I = 0x2D0;
+L248: // DBC3 DRW VB, VC, 3
+    STEP(0x248, 0xDBC3);
+    c->pc = 0x248;
+    predecode(0xDBC3, &in);
+    execute(c, &in);
+    if (c->pc != 0x24A) goto dispatch;
+L24A: // CD01 RND VD, 0x01
+    STEP(0x24A, 0xCD01);
+    c->pc = 0x24A;
+    predecode(0xCD01, &in);
+    execute(c, &in);
+    if (c->pc != 0x24C) goto dispatch;
+L24C: // 8BD4 ADD VB, VD
+    STEP(0x24C, 0x8BD4);
+    V[15] = V[11] + V[13] > 0xFF;
+    V[11] += V[13];
+L24E: // DBC3 DRW VB, VC, 3
+    STEP(0x24E, 0xDBC3);
+    c->pc = 0x24E;
+    predecode(0xDBC3, &in);
+    execute(c, &in);
+    if (c->pc != 0x250) goto dispatch;
+L250: // 3F00 SE VF, 0x00
+    STEP(0x250, 0x3F00);
+    if (V[15] == 0x00) goto L254;
+L252: // 1292 JP 0x292
+    STEP(0x252, 0x1292);
+    goto L292;
+L254: // A2CD LD I, 0x2CD
+    STEP(0x254, 0xA2CD);
+    c->I = 0x2CD;
+L256: // D9A3 DRW V9, VA, 3
+    STEP(0x256, 0xD9A3);
+    c->pc = 0x256;
+    predecode(0xD9A3, &in);
+    execute(c, &in);
+    if (c->pc != 0x258) goto dispatch;
+L258: // CD01 RND VD, 0x01
+    STEP(0x258, 0xCD01);
+    c->pc = 0x258;
+    predecode(0xCD01, &in);
+    execute(c, &in);
+    if (c->pc != 0x25A) goto dispatch;
+L25A: // 3D00 SE VD, 0x00
+    STEP(0x25A, 0x3D00);
+    if (V[13] == 0x00) goto L25E;
+L25C: // 6DFF LD VD, 0xFF
+    STEP(0x25C, 0x6DFF);
+    V[13] = 0xFF;
+L25E: // 79FE ADD V9, 0xFE
+    STEP(0x25E, 0x79FE);
+    V[9] += 0xFE;
+L260: // D9A3 DRW V9, VA, 3
+    STEP(0x260, 0xD9A3);
+    c->pc = 0x260;
+    predecode(0xD9A3, &in);
+    execute(c, &in);
+    if (c->pc != 0x262) goto dispatch;
+L262: // 3F00 SE VF, 0x00
+    STEP(0x262, 0x3F00);
+    if (V[15] == 0x00) goto L266;
+L264: // 128C JP 0x28C
+    STEP(0x264, 0x128C);
+    goto L28C;
+L266: // 4E00 SNE VE, 0x00
+    STEP(0x266, 0x4E00);
+    if (V[14] != 0x00) goto L26A;
+L268: // 122E JP 0x22E
+    STEP(0x268, 0x122E);
+    goto L22E;
+L26A: // A2D3 LD I, 0x2D3
+    STEP(0x26A, 0xA2D3);
+    c->I = 0x2D3;
+L26C: // D453 DRW V4, V5, 3
+    STEP(0x26C, 0xD453);
+    c->pc = 0x26C;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x26E) goto dispatch;
+L26E: // 4500 SNE V5, 0x00
+    STEP(0x26E, 0x4500);
+    if (V[5] != 0x00) goto L272;
+L270: // 1286 JP 0x286
+    STEP(0x270, 0x1286);
+    goto L286;
+L272: // 75FF ADD V5, 0xFF
+    STEP(0x272, 0x75FF);
+    V[5] += 0xFF;
+L274: // 8464 ADD V4, V6
+    STEP(0x274, 0x8464);
+    V[15] = V[4] + V[6] > 0xFF;
+    V[4] += V[6];
+L276: // D453 DRW V4, V5, 3
+    STEP(0x276, 0xD453);
+    c->pc = 0x276;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x278) goto dispatch;
+L278: // 3F01 SE VF, 0x01
+    STEP(0x278, 0x3F01);
+    if (V[15] == 0x01) goto L27C;
+L27A: // 1246 JP 0x246
+    STEP(0x27A, 0x1246);
+    goto L246;
+L27C: // 6D08 LD VD, 0x08
+    STEP(0x27C, 0x6D08);
+    V[13] = 0x08;
+L27E: // 8D52 AND VD, V5
+    STEP(0x27E, 0x8D52);
+    V[13] &= V[5];
+L280: // 4D08 SNE VD, 0x08
+    STEP(0x280, 0x4D08);
+    if (V[13] != 0x08) goto L284;
+L282: // 128C JP 0x28C
+    STEP(0x282, 0x128C);
+    goto L28C;
+L284: // 1292 JP 0x292
+    STEP(0x284, 0x1292);
+    goto L292;
+L286: // 22AC CALL 0x2AC
+    STEP(0x286, 0x22AC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x286;
+    goto L2AC;
+L288: // 78FF ADD V8, 0xFF
+    STEP(0x288, 0x78FF);
+    V[8] += 0xFF;
+L28A: // 121E JP 0x21E
+    STEP(0x28A, 0x121E);
+    goto L21E;
+L28C: // 22A2 CALL 0x2A2
+    STEP(0x28C, 0x22A2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x28C;
+    goto L2A2;
+L28E: // 7705 ADD V7, 0x05
+    STEP(0x28E, 0x7705);
+    V[7] += 0x05;
+L290: // 1296 JP 0x296
+    STEP(0x290, 0x1296);
+    goto L296;
+L292: // 22A2 CALL 0x2A2
+    STEP(0x292, 0x22A2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x292;
+    goto L2A2;
+L294: // 770F ADD V7, 0x0F
+    STEP(0x294, 0x770F);
+    V[7] += 0x0F;
+L296: // 22A2 CALL 0x2A2
+    STEP(0x296, 0x22A2);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x296;
+    goto L2A2;
+L298: // 6D03 LD VD, 0x03
+    STEP(0x298, 0x6D03);
+    V[13] = 0x03;
+L29A: // FD18 LD ST, VD
+    STEP(0x29A, 0xFD18);
+    c->st = V[13];
+L29C: // A2D3 LD I, 0x2D3
+    STEP(0x29C, 0xA2D3);
+    c->I = 0x2D3;
+L29E: // D453 DRW V4, V5, 3
+    STEP(0x29E, 0xD453);
+    c->pc = 0x29E;
+    predecode(0xD453, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A0) goto dispatch;
+L2A0: // 1286 JP 0x286
+    STEP(0x2A0, 0x1286);
+    goto L286;
+L2A2: // A2F8 LD I, 0x2F8
+    STEP(0x2A2, 0xA2F8);
+    c->I = 0x2F8;
+L2A4: // F733 LD B, V7
+    STEP(0x2A4, 0xF733);
+    c->pc = 0x2A4;
+    predecode(0xF733, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2A6) goto dispatch;
+L2A6: // 6300 LD V3, 0x00
+    STEP(0x2A6, 0x6300);
+    V[3] = 0x00;
+L2A8: // 22B6 CALL 0x2B6
+    STEP(0x2A8, 0x22B6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2A8;
+    goto L2B6;
+L2AA: // 00EE RET
+    STEP(0x2AA, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2AC: // A2F8 LD I, 0x2F8
+    STEP(0x2AC, 0xA2F8);
+    c->I = 0x2F8;
+L2AE: // F833 LD B, V8
+    STEP(0x2AE, 0xF833);
+    c->pc = 0x2AE;
+    predecode(0xF833, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2B0) goto dispatch;
+L2B0: // 6332 LD V3, 0x32
+    STEP(0x2B0, 0x6332);
+    V[3] = 0x32;
+L2B2: // 22B6 CALL 0x2B6
+    STEP(0x2B2, 0x22B6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2B2;
+    goto L2B6;
+L2B4: // 00EE RET
+    STEP(0x2B4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2B6: // 6D1B LD VD, 0x1B
+    STEP(0x2B6, 0x6D1B);
+    V[13] = 0x1B;
+L2B8: // F265 LD V2, [I]
+    STEP(0x2B8, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2BA: // F029 LD F, V0
+    STEP(0x2BA, 0xF029);
+    c->I = V[0] * 5;
+L2BC: // D3D5 DRW V3, VD, 5
+    STEP(0x2BC, 0xD3D5);
+    c->pc = 0x2BC;
+    predecode(0xD3D5, &in);
+    execute(c, &in);
+    if (c->pc != 0x2BE) goto dispatch;
+L2BE: // 7305 ADD V3, 0x05
+    STEP(0x2BE, 0x7305);
+    V[3] += 0x05;
+L2C0: // F129 LD F, V1
+    STEP(0x2C0, 0xF129);
+    c->I = V[1] * 5;
+L2C2: // D3D5 DRW V3, VD, 5
+    STEP(0x2C2, 0xD3D5);
+    c->pc = 0x2C2;
+    predecode(0xD3D5, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C4) goto dispatch;
+L2C4: // 7305 ADD V3, 0x05
+    STEP(0x2C4, 0x7305);
+    V[3] += 0x05;
+L2C6: // F229 LD F, V2
+    STEP(0x2C6, 0xF229);
+    c->I = V[2] * 5;
+L2C8: // D3D5 DRW V3, VD, 5
+    STEP(0x2C8, 0xD3D5);
+    c->pc = 0x2C8;
+    predecode(0xD3D5, &in);
+    execute(c, &in);
+    if (c->pc != 0x2CA) goto dispatch;
+L2CA: // 00EE RET
+    STEP(0x2CA, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2D8: // 6E01 LD VE, 0x01
+    STEP(0x2D8, 0x6E01);
+    V[14] = 0x01;
+L2DA: // 6D10 LD VD, 0x10
+    STEP(0x2DA, 0x6D10);
+    V[13] = 0x10;
+L2DC: // FD18 LD ST, VD
+    STEP(0x2DC, 0xFD18);
+    c->st = V[13];
+L2DE: // 00EE RET
+    STEP(0x2DE, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
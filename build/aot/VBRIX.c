@@ -0,0 +1,1129 @@
+// generated by chip8-aot from roms/VBRIX.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x00, 0xE0, 0x23, 0xB6, 0x60, 0x07, 0xE0, 0x9E, 0x12, 0x04, 0x68, 0x00,
+    0x67, 0x03, 0x23, 0x46, 0x22, 0x4A, 0x22, 0xC0, 0x23, 0x66, 0x23, 0x8A,
+    0x23, 0xAC, 0xF0, 0x0A, 0x22, 0x5A, 0x22, 0x5A, 0x22, 0xD0, 0x22, 0x88,
+    0x3A, 0x00, 0x12, 0x1C, 0x6C, 0x01, 0x23, 0xAC, 0x77, 0xFF, 0x23, 0xAC,
+    0x60, 0x78, 0xF0, 0x15, 0xF0, 0x07, 0x30, 0x00, 0x12, 0x34, 0x37, 0x00,
+    0x12, 0x1C, 0x23, 0xAC, 0x60, 0x07, 0xE0, 0x9E, 0x12, 0x42, 0x12, 0x0A,
+    0x00, 0xFD, 0x69, 0x10, 0x60, 0x02, 0xA2, 0x54, 0xD0, 0x95, 0x00, 0xEE,
+    0x80, 0x80, 0x80, 0x80, 0x80, 0x00, 0x60, 0x01, 0xE0, 0xA1, 0x12, 0x68,
+    0x60, 0x04, 0xE0, 0xA1, 0x12, 0x72, 0x00, 0xEE, 0x80, 0x90, 0x70, 0xFF,
+    0x40, 0x00, 0x00, 0xEE, 0x12, 0x7C, 0x80, 0x90, 0x70, 0x01, 0x40, 0x1B,
+    0x00, 0xEE, 0x12, 0x7C, 0x61, 0x02, 0xA2, 0x54, 0xD1, 0x95, 0xD1, 0x05,
+    0x89, 0x00, 0x00, 0xEE, 0x80, 0xA0, 0x70, 0xFE, 0x30, 0x00, 0x00, 0xEE,
+    0x80, 0xB0, 0x80, 0x95, 0x4F, 0x00, 0x00, 0xEE, 0x81, 0x00, 0x62, 0x05,
+    0x81, 0x25, 0x3F, 0x00, 0x00, 0xEE, 0xA2, 0xBA, 0xF0, 0x1E, 0xF0, 0x65,
+    0x8D, 0x00, 0x4B, 0x01, 0x6D, 0x01, 0x4B, 0x1E, 0x6D, 0xFF, 0x6C, 0x01,
+    0x60, 0x0A, 0xF0, 0x18, 0x00, 0xEE, 0xFF, 0xFF, 0x00, 0x01, 0x01, 0x00,
+    0xCB, 0x20, 0x7B, 0x01, 0x6A, 0x04, 0x6C, 0x01, 0x6D, 0x01, 0xA3, 0x64,
+    0xDA, 0xB1, 0x00, 0xEE, 0x80, 0xA0, 0x81, 0xB0, 0x8A, 0xC4, 0x8B, 0xD4,
+    0xA3, 0x64, 0x4B, 0x01, 0x6D, 0x01, 0x4B, 0x1E, 0x6D, 0xFF, 0x4A, 0x3E,
+    0x6C, 0xFF, 0x4A, 0x00, 0x6C, 0x01, 0xD0, 0x11, 0xDA, 0xB1, 0x4F, 0x00,
+    0x00, 0xEE, 0x80, 0xA0, 0x61, 0x21, 0x80, 0x15, 0x4F, 0x00, 0x00, 0xEE,
+    0x80, 0xA0, 0x81, 0xB0, 0x70, 0xDE, 0x71, 0xFF, 0x62, 0xFF, 0x63, 0xFF,
+    0x64, 0x03, 0x72, 0x01, 0x80, 0x45, 0x3F, 0x00, 0x13, 0x0A, 0x73, 0x01,
+    0x81, 0x45, 0x3F, 0x00, 0x13, 0x12, 0x80, 0x20, 0x81, 0x30, 0x80, 0x24,
+    0x80, 0x24, 0x81, 0x34, 0x81, 0x34, 0x70, 0x22, 0x71, 0x01, 0xA3, 0x86,
+    0xD0, 0x13, 0x7E, 0xFF, 0x60, 0x00, 0x8C, 0x07, 0x60, 0x02, 0xF0, 0x18,
+    0x23, 0x8A, 0x78, 0x01, 0x23, 0x8A, 0x3E, 0x00, 0x00, 0xEE, 0x23, 0x66,
+    0x00, 0xEE, 0x00, 0xE0, 0x60, 0x00, 0x61, 0x00, 0x62, 0x1F, 0xA3, 0x64,
+    0xD0, 0x11, 0xD0, 0x21, 0x70, 0x01, 0x30, 0x3F, 0x13, 0x50, 0xD0, 0x11,
+    0x71, 0x01, 0x31, 0x20, 0x13, 0x5A, 0x00, 0xEE, 0x80, 0x00, 0x61, 0x01,
+    0x63, 0x0A, 0xA3, 0x86, 0x60, 0x22, 0x62, 0x07, 0xD0, 0x13, 0x70, 0x03,
+    0x72, 0xFF, 0x32, 0x00, 0x13, 0x70, 0x71, 0x03, 0x73, 0xFF, 0x33, 0x00,
+    0x13, 0x6C, 0x6E, 0x46, 0x00, 0xEE, 0xE0, 0xA0, 0xE0, 0x00, 0xA3, 0xA6,
+    0xF8, 0x33, 0xF2, 0x65, 0x63, 0x03, 0x64, 0x02, 0xF0, 0x29, 0xD3, 0x45,
+    0x73, 0x05, 0xF1, 0x29, 0xD3, 0x45, 0x73, 0x05, 0xF2, 0x29, 0xD3, 0x45,
+    0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0x14, 0x61, 0x02,
+    0xF7, 0x29, 0xD0, 0x15, 0x00, 0xEE, 0x60, 0x0A, 0x61, 0x0C, 0x62, 0x09,
+    0x63, 0x05, 0xA3, 0xCE, 0xD0, 0x15, 0xF3, 0x1E, 0x70, 0x05, 0x72, 0xFF,
+    0x32, 0x00, 0x13, 0xC0, 0x00, 0xEE, 0x90, 0x90, 0x90, 0x90, 0x60, 0xE0,
+    0x90, 0xE0, 0x90, 0xE0, 0xE0, 0x90, 0xE0, 0x90, 0x90, 0x20, 0x20, 0x20,
+    0x20, 0x20, 0x90, 0x90, 0x60, 0x90, 0x90, 0x00, 0x00, 0x60, 0x00, 0x00,
+    0xF0, 0x90, 0xF0, 0x80, 0x80, 0xF0, 0x80, 0xF0, 0x10, 0xF0, 0xE0, 0x90,
+    0xE0, 0x90, 0x90,
+};
+const size_t aot_rom_size = 507;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x000000000000FF00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+        case 0x2E6: goto L2E6;
+        case 0x2E8: goto L2E8;
+        case 0x2EA: goto L2EA;
+        case 0x2EC: goto L2EC;
+        case 0x2EE: goto L2EE;
+        case 0x2F0: goto L2F0;
+        case 0x2F2: goto L2F2;
+        case 0x2F4: goto L2F4;
+        case 0x2F6: goto L2F6;
+        case 0x2F8: goto L2F8;
+        case 0x2FA: goto L2FA;
+        case 0x2FC: goto L2FC;
+        case 0x2FE: goto L2FE;
+        case 0x300: goto L300;
+        case 0x302: goto L302;
+        case 0x304: goto L304;
+        case 0x306: goto L306;
+        case 0x308: goto L308;
+        case 0x30A: goto L30A;
+        case 0x30C: goto L30C;
+        case 0x30E: goto L30E;
+        case 0x310: goto L310;
+        case 0x312: goto L312;
+        case 0x314: goto L314;
+        case 0x316: goto L316;
+        case 0x318: goto L318;
+        case 0x31A: goto L31A;
+        case 0x31C: goto L31C;
+        case 0x31E: goto L31E;
+        case 0x320: goto L320;
+        case 0x322: goto L322;
+        case 0x324: goto L324;
+        case 0x326: goto L326;
+        case 0x328: goto L328;
+        case 0x32A: goto L32A;
+        case 0x32C: goto L32C;
+        case 0x32E: goto L32E;
+        case 0x330: goto L330;
+        case 0x332: goto L332;
+        case 0x334: goto L334;
+        case 0x336: goto L336;
+        case 0x338: goto L338;
+        case 0x33A: goto L33A;
+        case 0x33C: goto L33C;
+        case 0x33E: goto L33E;
+        case 0x340: goto L340;
+        case 0x342: goto L342;
+        case 0x344: goto L344;
+        case 0x346: goto L346;
+        case 0x348: goto L348;
+        case 0x34A: goto L34A;
+        case 0x34C: goto L34C;
+        case 0x34E: goto L34E;
+        case 0x350: goto L350;
+        case 0x352: goto L352;
+        case 0x354: goto L354;
+        case 0x356: goto L356;
+        case 0x358: goto L358;
+        case 0x35A: goto L35A;
+        case 0x35C: goto L35C;
+        case 0x35E: goto L35E;
+        case 0x360: goto L360;
+        case 0x362: goto L362;
+        case 0x366: goto L366;
+        case 0x368: goto L368;
+        case 0x36A: goto L36A;
+        case 0x36C: goto L36C;
+        case 0x36E: goto L36E;
+        case 0x370: goto L370;
+        case 0x372: goto L372;
+        case 0x374: goto L374;
+        case 0x376: goto L376;
+        case 0x378: goto L378;
+        case 0x37A: goto L37A;
+        case 0x37C: goto L37C;
+        case 0x37E: goto L37E;
+        case 0x380: goto L380;
+        case 0x382: goto L382;
+        case 0x384: goto L384;
+        case 0x38A: goto L38A;
+        case 0x38C: goto L38C;
+        case 0x38E: goto L38E;
+        case 0x390: goto L390;
+        case 0x392: goto L392;
+        case 0x394: goto L394;
+        case 0x396: goto L396;
+        case 0x398: goto L398;
+        case 0x39A: goto L39A;
+        case 0x39C: goto L39C;
+        case 0x39E: goto L39E;
+        case 0x3A0: goto L3A0;
+        case 0x3A2: goto L3A2;
+        case 0x3A4: goto L3A4;
+        case 0x3AC: goto L3AC;
+        case 0x3AE: goto L3AE;
+        case 0x3B0: goto L3B0;
+        case 0x3B2: goto L3B2;
+        case 0x3B4: goto L3B4;
+        case 0x3B6: goto L3B6;
+        case 0x3B8: goto L3B8;
+        case 0x3BA: goto L3BA;
+        case 0x3BC: goto L3BC;
+        case 0x3BE: goto L3BE;
+        case 0x3C0: goto L3C0;
+        case 0x3C2: goto L3C2;
+        case 0x3C4: goto L3C4;
+        case 0x3C6: goto L3C6;
+        case 0x3C8: goto L3C8;
+        case 0x3CA: goto L3CA;
+        case 0x3CC: goto L3CC;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 00E0 CLS
+    STEP(0x200, 0x00E0);
+    c->pc = 0x200;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x202) goto dispatch;
+L202: // 23B6 CALL 0x3B6
+    STEP(0x202, 0x23B6);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x202;
+    goto L3B6;
+L204: // 6007 LD V0, 0x07
+    STEP(0x204, 0x6007);
+    V[0] = 0x07;
+L206: // E09E SKP V0
+    STEP(0x206, 0xE09E);
+    c->pc = 0x206;
+    predecode(0xE09E, &in);
+    execute(c, &in);
+    if (c->pc != 0x208) goto dispatch;
+L208: // 1204 JP 0x204
+    STEP(0x208, 0x1204);
+    goto L204;
+L20A: // 6800 LD V8, 0x00
+    STEP(0x20A, 0x6800);
+    V[8] = 0x00;
+L20C: // 6703 LD V7, 0x03
+    STEP(0x20C, 0x6703);
+    V[7] = 0x03;
+L20E: // 2346 CALL 0x346
+    STEP(0x20E, 0x2346);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x20E;
+    goto L346;
+L210: // 224A CALL 0x24A
+    STEP(0x210, 0x224A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x210;
+    goto L24A;
+L212: // 22C0 CALL 0x2C0
+    STEP(0x212, 0x22C0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x212;
+    goto L2C0;
+L214: // 2366 CALL 0x366
+    STEP(0x214, 0x2366);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x214;
+    goto L366;
+L216: // 238A CALL 0x38A
+    STEP(0x216, 0x238A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x216;
+    goto L38A;
+L218: // 23AC CALL 0x3AC
+    STEP(0x218, 0x23AC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x218;
+    goto L3AC;
+L21A: // F00A LD V0, K
+    STEP(0x21A, 0xF00A);
+    if (c->keypad == 0) {
+        c->pc = 0x21A;
+        return cycles - left;
+    }
+    V[0] = __builtin_ctz(c->keypad);
+L21C: // 225A CALL 0x25A
+    STEP(0x21C, 0x225A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x21C;
+    goto L25A;
+L21E: // 225A CALL 0x25A
+    STEP(0x21E, 0x225A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x21E;
+    goto L25A;
+L220: // 22D0 CALL 0x2D0
+    STEP(0x220, 0x22D0);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x220;
+    goto L2D0;
+L222: // 2288 CALL 0x288
+    STEP(0x222, 0x2288);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x222;
+    goto L288;
+L224: // 3A00 SE VA, 0x00
+    STEP(0x224, 0x3A00);
+    if (V[10] == 0x00) goto L228;
+L226: // 121C JP 0x21C
+    STEP(0x226, 0x121C);
+    goto L21C;
+L228: // 6C01 LD VC, 0x01
+    STEP(0x228, 0x6C01);
+    V[12] = 0x01;
+L22A: // 23AC CALL 0x3AC
+    STEP(0x22A, 0x23AC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x22A;
+    goto L3AC;
+L22C: // 77FF ADD V7, 0xFF
+    STEP(0x22C, 0x77FF);
+    V[7] += 0xFF;
+L22E: // 23AC CALL 0x3AC
+    STEP(0x22E, 0x23AC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x22E;
+    goto L3AC;
+L230: // 6078 LD V0, 0x78
+    STEP(0x230, 0x6078);
+    V[0] = 0x78;
+L232: // F015 LD DT, V0
+    STEP(0x232, 0xF015);
+    c->dt = V[0];
+L234: // F007 LD V0, DT
+    STEP(0x234, 0xF007);
+    V[0] = c->dt;
+L236: // 3000 SE V0, 0x00
+    STEP(0x236, 0x3000);
+    if (V[0] == 0x00) goto L23A;
+L238: // 1234 JP 0x234
+    STEP(0x238, 0x1234);
+    goto L234;
+L23A: // 3700 SE V7, 0x00
+    STEP(0x23A, 0x3700);
+    if (V[7] == 0x00) goto L23E;
+L23C: // 121C JP 0x21C
+    STEP(0x23C, 0x121C);
+    goto L21C;
+L23E: // 23AC CALL 0x3AC
+    STEP(0x23E, 0x23AC);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x23E;
+    goto L3AC;
+L240: // 6007 LD V0, 0x07
+    STEP(0x240, 0x6007);
+    V[0] = 0x07;
+L242: // E09E SKP V0
+    STEP(0x242, 0xE09E);
+    c->pc = 0x242;
+    predecode(0xE09E, &in);
+    execute(c, &in);
+    if (c->pc != 0x244) goto dispatch;
+L244: // 1242 JP 0x242
+    STEP(0x244, 0x1242);
+    goto L242;
+L246: // 120A JP 0x20A
+    STEP(0x246, 0x120A);
+    goto L20A;
+L24A: // 6910 LD V9, 0x10
+    STEP(0x24A, 0x6910);
+    V[9] = 0x10;
+L24C: // 6002 LD V0, 0x02
+    STEP(0x24C, 0x6002);
+    V[0] = 0x02;
+L24E: // A254 LD I, 0x254
+    STEP(0x24E, 0xA254);
+    c->I = 0x254;
+L250: // D095 DRW V0, V9, 5
+    STEP(0x250, 0xD095);
+    c->pc = 0x250;
+    predecode(0xD095, &in);
+    execute(c, &in);
+    if (c->pc != 0x252) goto dispatch;
+L252: // 00EE RET
+    STEP(0x252, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L25A: // 6001 LD V0, 0x01
+    STEP(0x25A, 0x6001);
+    V[0] = 0x01;
+L25C: // E0A1 SKNP V0
+    STEP(0x25C, 0xE0A1);
+    c->pc = 0x25C;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x25E) goto dispatch;
+L25E: // 1268 JP 0x268
+    STEP(0x25E, 0x1268);
+    goto L268;
+L260: // 6004 LD V0, 0x04
+    STEP(0x260, 0x6004);
+    V[0] = 0x04;
+L262: // E0A1 SKNP V0
+    STEP(0x262, 0xE0A1);
+    c->pc = 0x262;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x264) goto dispatch;
+L264: // 1272 JP 0x272
+    STEP(0x264, 0x1272);
+    goto L272;
+L266: // 00EE RET
+    STEP(0x266, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L268: // 8090 LD V0, V9
+    STEP(0x268, 0x8090);
+    V[0] = V[9];
+L26A: // 70FF ADD V0, 0xFF
+    STEP(0x26A, 0x70FF);
+    V[0] += 0xFF;
+L26C: // 4000 SNE V0, 0x00
+    STEP(0x26C, 0x4000);
+    if (V[0] != 0x00) goto L270;
+L26E: // 00EE RET
+    STEP(0x26E, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L270: // 127C JP 0x27C
+    STEP(0x270, 0x127C);
+    goto L27C;
+L272: // 8090 LD V0, V9
+    STEP(0x272, 0x8090);
+    V[0] = V[9];
+L274: // 7001 ADD V0, 0x01
+    STEP(0x274, 0x7001);
+    V[0] += 0x01;
+L276: // 401B SNE V0, 0x1B
+    STEP(0x276, 0x401B);
+    if (V[0] != 0x1B) goto L27A;
+L278: // 00EE RET
+    STEP(0x278, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L27A: // 127C JP 0x27C
+    STEP(0x27A, 0x127C);
+    goto L27C;
+L27C: // 6102 LD V1, 0x02
+    STEP(0x27C, 0x6102);
+    V[1] = 0x02;
+L27E: // A254 LD I, 0x254
+    STEP(0x27E, 0xA254);
+    c->I = 0x254;
+L280: // D195 DRW V1, V9, 5
+    STEP(0x280, 0xD195);
+    c->pc = 0x280;
+    predecode(0xD195, &in);
+    execute(c, &in);
+    if (c->pc != 0x282) goto dispatch;
+L282: // D105 DRW V1, V0, 5
+    STEP(0x282, 0xD105);
+    c->pc = 0x282;
+    predecode(0xD105, &in);
+    execute(c, &in);
+    if (c->pc != 0x284) goto dispatch;
+L284: // 8900 LD V9, V0
+    STEP(0x284, 0x8900);
+    V[9] = V[0];
+L286: // 00EE RET
+    STEP(0x286, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L288: // 80A0 LD V0, VA
+    STEP(0x288, 0x80A0);
+    V[0] = V[10];
+L28A: // 70FE ADD V0, 0xFE
+    STEP(0x28A, 0x70FE);
+    V[0] += 0xFE;
+L28C: // 3000 SE V0, 0x00
+    STEP(0x28C, 0x3000);
+    if (V[0] == 0x00) goto L290;
+L28E: // 00EE RET
+    STEP(0x28E, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L290: // 80B0 LD V0, VB
+    STEP(0x290, 0x80B0);
+    V[0] = V[11];
+L292: // 8095 SUB V0, V9
+    STEP(0x292, 0x8095);
+    V[15] = V[0] > V[9];
+    V[0] -= V[9];
+L294: // 4F00 SNE VF, 0x00
+    STEP(0x294, 0x4F00);
+    if (V[15] != 0x00) goto L298;
+L296: // 00EE RET
+    STEP(0x296, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L298: // 8100 LD V1, V0
+    STEP(0x298, 0x8100);
+    V[1] = V[0];
+L29A: // 6205 LD V2, 0x05
+    STEP(0x29A, 0x6205);
+    V[2] = 0x05;
+L29C: // 8125 SUB V1, V2
+    STEP(0x29C, 0x8125);
+    V[15] = V[1] > V[2];
+    V[1] -= V[2];
+L29E: // 3F00 SE VF, 0x00
+    STEP(0x29E, 0x3F00);
+    if (V[15] == 0x00) goto L2A2;
+L2A0: // 00EE RET
+    STEP(0x2A0, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2A2: // A2BA LD I, 0x2BA
+    STEP(0x2A2, 0xA2BA);
+    c->I = 0x2BA;
+L2A4: // F01E ADD I, V0
+    STEP(0x2A4, 0xF01E);
+    c->I += V[0];
+L2A6: // F065 LD V0, [I]
+    STEP(0x2A6, 0xF065);
+    for (int i = 0; i <= 0; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2A8: // 8D00 LD VD, V0
+    STEP(0x2A8, 0x8D00);
+    V[13] = V[0];
+L2AA: // 4B01 SNE VB, 0x01
+    STEP(0x2AA, 0x4B01);
+    if (V[11] != 0x01) goto L2AE;
+L2AC: // 6D01 LD VD, 0x01
+    STEP(0x2AC, 0x6D01);
+    V[13] = 0x01;
+L2AE: // 4B1E SNE VB, 0x1E
+    STEP(0x2AE, 0x4B1E);
+    if (V[11] != 0x1E) goto L2B2;
+L2B0: // 6DFF LD VD, 0xFF
+    STEP(0x2B0, 0x6DFF);
+    V[13] = 0xFF;
+L2B2: // 6C01 LD VC, 0x01
+    STEP(0x2B2, 0x6C01);
+    V[12] = 0x01;
+L2B4: // 600A LD V0, 0x0A
+    STEP(0x2B4, 0x600A);
+    V[0] = 0x0A;
+L2B6: // F018 LD ST, V0
+    STEP(0x2B6, 0xF018);
+    c->st = V[0];
+L2B8: // 00EE RET
+    STEP(0x2B8, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2C0: // CB20 RND VB, 0x20
+    STEP(0x2C0, 0xCB20);
+    c->pc = 0x2C0;
+    predecode(0xCB20, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C2) goto dispatch;
+L2C2: // 7B01 ADD VB, 0x01
+    STEP(0x2C2, 0x7B01);
+    V[11] += 0x01;
+L2C4: // 6A04 LD VA, 0x04
+    STEP(0x2C4, 0x6A04);
+    V[10] = 0x04;
+L2C6: // 6C01 LD VC, 0x01
+    STEP(0x2C6, 0x6C01);
+    V[12] = 0x01;
+L2C8: // 6D01 LD VD, 0x01
+    STEP(0x2C8, 0x6D01);
+    V[13] = 0x01;
+L2CA: // A364 LD I, 0x364
+    STEP(0x2CA, 0xA364);
+    c->I = 0x364;
+L2CC: // DAB1 DRW VA, VB, 1
+    STEP(0x2CC, 0xDAB1);
+    c->pc = 0x2CC;
+    predecode(0xDAB1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2CE) goto dispatch;
+L2CE: // 00EE RET
+    STEP(0x2CE, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2D0: // 80A0 LD V0, VA
+    STEP(0x2D0, 0x80A0);
+    V[0] = V[10];
+L2D2: // 81B0 LD V1, VB
+    STEP(0x2D2, 0x81B0);
+    V[1] = V[11];
+L2D4: // 8AC4 ADD VA, VC
+    STEP(0x2D4, 0x8AC4);
+    V[15] = V[10] + V[12] > 0xFF;
+    V[10] += V[12];
+L2D6: // 8BD4 ADD VB, VD
+    STEP(0x2D6, 0x8BD4);
+    V[15] = V[11] + V[13] > 0xFF;
+    V[11] += V[13];
+L2D8: // A364 LD I, 0x364
+    STEP(0x2D8, 0xA364);
+    c->I = 0x364;
+L2DA: // 4B01 SNE VB, 0x01
+    STEP(0x2DA, 0x4B01);
+    if (V[11] != 0x01) goto L2DE;
+L2DC: // 6D01 LD VD, 0x01
+    STEP(0x2DC, 0x6D01);
+    V[13] = 0x01;
+L2DE: // 4B1E SNE VB, 0x1E
+    STEP(0x2DE, 0x4B1E);
+    if (V[11] != 0x1E) goto L2E2;
+L2E0: // 6DFF LD VD, 0xFF
+    STEP(0x2E0, 0x6DFF);
+    V[13] = 0xFF;
+L2E2: // 4A3E SNE VA, 0x3E
+    STEP(0x2E2, 0x4A3E);
+    if (V[10] != 0x3E) goto L2E6;
+L2E4: // 6CFF LD VC, 0xFF
+    STEP(0x2E4, 0x6CFF);
+    V[12] = 0xFF;
+L2E6: // 4A00 SNE VA, 0x00
+    STEP(0x2E6, 0x4A00);
+    if (V[10] != 0x00) goto L2EA;
+L2E8: // 6C01 LD VC, 0x01
+    STEP(0x2E8, 0x6C01);
+    V[12] = 0x01;
+L2EA: // D011 DRW V0, V1, 1
+    STEP(0x2EA, 0xD011);
+    c->pc = 0x2EA;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x2EC) goto dispatch;
+L2EC: // DAB1 DRW VA, VB, 1
+    STEP(0x2EC, 0xDAB1);
+    c->pc = 0x2EC;
+    predecode(0xDAB1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2EE) goto dispatch;
+L2EE: // 4F00 SNE VF, 0x00
+    STEP(0x2EE, 0x4F00);
+    if (V[15] != 0x00) goto L2F2;
+L2F0: // 00EE RET
+    STEP(0x2F0, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2F2: // 80A0 LD V0, VA
+    STEP(0x2F2, 0x80A0);
+    V[0] = V[10];
+L2F4: // 6121 LD V1, 0x21
+    STEP(0x2F4, 0x6121);
+    V[1] = 0x21;
+L2F6: // 8015 SUB V0, V1
+    STEP(0x2F6, 0x8015);
+    V[15] = V[0] > V[1];
+    V[0] -= V[1];
+L2F8: // 4F00 SNE VF, 0x00
+    STEP(0x2F8, 0x4F00);
+    if (V[15] != 0x00) goto L2FC;
+L2FA: // 00EE RET
+    STEP(0x2FA, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L2FC: // 80A0 LD V0, VA
+    STEP(0x2FC, 0x80A0);
+    V[0] = V[10];
+L2FE: // 81B0 LD V1, VB
+    STEP(0x2FE, 0x81B0);
+    V[1] = V[11];
+L300: // 70DE ADD V0, 0xDE
+    STEP(0x300, 0x70DE);
+    V[0] += 0xDE;
+L302: // 71FF ADD V1, 0xFF
+    STEP(0x302, 0x71FF);
+    V[1] += 0xFF;
+L304: // 62FF LD V2, 0xFF
+    STEP(0x304, 0x62FF);
+    V[2] = 0xFF;
+L306: // 63FF LD V3, 0xFF
+    STEP(0x306, 0x63FF);
+    V[3] = 0xFF;
+L308: // 6403 LD V4, 0x03
+    STEP(0x308, 0x6403);
+    V[4] = 0x03;
+L30A: // 7201 ADD V2, 0x01
+    STEP(0x30A, 0x7201);
+    V[2] += 0x01;
+L30C: // 8045 SUB V0, V4
+    STEP(0x30C, 0x8045);
+    V[15] = V[0] > V[4];
+    V[0] -= V[4];
+L30E: // 3F00 SE VF, 0x00
+    STEP(0x30E, 0x3F00);
+    if (V[15] == 0x00) goto L312;
+L310: // 130A JP 0x30A
+    STEP(0x310, 0x130A);
+    goto L30A;
+L312: // 7301 ADD V3, 0x01
+    STEP(0x312, 0x7301);
+    V[3] += 0x01;
+L314: // 8145 SUB V1, V4
+    STEP(0x314, 0x8145);
+    V[15] = V[1] > V[4];
+    V[1] -= V[4];
+L316: // 3F00 SE VF, 0x00
+    STEP(0x316, 0x3F00);
+    if (V[15] == 0x00) goto L31A;
+L318: // 1312 JP 0x312
+    STEP(0x318, 0x1312);
+    goto L312;
+L31A: // 8020 LD V0, V2
+    STEP(0x31A, 0x8020);
+    V[0] = V[2];
+L31C: // 8130 LD V1, V3
+    STEP(0x31C, 0x8130);
+    V[1] = V[3];
+L31E: // 8024 ADD V0, V2
+    STEP(0x31E, 0x8024);
+    V[15] = V[0] + V[2] > 0xFF;
+    V[0] += V[2];
+L320: // 8024 ADD V0, V2
+    STEP(0x320, 0x8024);
+    V[15] = V[0] + V[2] > 0xFF;
+    V[0] += V[2];
+L322: // 8134 ADD V1, V3
+    STEP(0x322, 0x8134);
+    V[15] = V[1] + V[3] > 0xFF;
+    V[1] += V[3];
+L324: // 8134 ADD V1, V3
+    STEP(0x324, 0x8134);
+    V[15] = V[1] + V[3] > 0xFF;
+    V[1] += V[3];
+L326: // 7022 ADD V0, 0x22
+    STEP(0x326, 0x7022);
+    V[0] += 0x22;
+L328: // 7101 ADD V1, 0x01
+    STEP(0x328, 0x7101);
+    V[1] += 0x01;
+L32A: // A386 LD I, 0x386
+    STEP(0x32A, 0xA386);
+    c->I = 0x386;
+L32C: // D013 DRW V0, V1, 3
+    STEP(0x32C, 0xD013);
+    c->pc = 0x32C;
+    predecode(0xD013, &in);
+    execute(c, &in);
+    if (c->pc != 0x32E) goto dispatch;
+L32E: // 7EFF ADD VE, 0xFF
+    STEP(0x32E, 0x7EFF);
+    V[14] += 0xFF;
+L330: // 6000 LD V0, 0x00
+    STEP(0x330, 0x6000);
+    V[0] = 0x00;
+L332: // 8C07 SUBN VC, V0
+    STEP(0x332, 0x8C07);
+    V[15] = V[0] > V[12];
+    V[12] = V[0] - V[12];
+L334: // 6002 LD V0, 0x02
+    STEP(0x334, 0x6002);
+    V[0] = 0x02;
+L336: // F018 LD ST, V0
+    STEP(0x336, 0xF018);
+    c->st = V[0];
+L338: // 238A CALL 0x38A
+    STEP(0x338, 0x238A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x338;
+    goto L38A;
+L33A: // 7801 ADD V8, 0x01
+    STEP(0x33A, 0x7801);
+    V[8] += 0x01;
+L33C: // 238A CALL 0x38A
+    STEP(0x33C, 0x238A);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x33C;
+    goto L38A;
+L33E: // 3E00 SE VE, 0x00
+    STEP(0x33E, 0x3E00);
+    if (V[14] == 0x00) goto L342;
+L340: // 00EE RET
+    STEP(0x340, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L342: // 2366 CALL 0x366
+    STEP(0x342, 0x2366);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x342;
+    goto L366;
+L344: // 00EE RET
+    STEP(0x344, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L346: // 00E0 CLS
+    STEP(0x346, 0x00E0);
+    c->pc = 0x346;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x348) goto dispatch;
+L348: // 6000 LD V0, 0x00
+    STEP(0x348, 0x6000);
+    V[0] = 0x00;
+L34A: // 6100 LD V1, 0x00
+    STEP(0x34A, 0x6100);
+    V[1] = 0x00;
+L34C: // 621F LD V2, 0x1F
+    STEP(0x34C, 0x621F);
+    V[2] = 0x1F;
+L34E: // A364 LD I, 0x364
+    STEP(0x34E, 0xA364);
+    c->I = 0x364;
+L350: // D011 DRW V0, V1, 1
+    STEP(0x350, 0xD011);
+    c->pc = 0x350;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x352) goto dispatch;
+L352: // D021 DRW V0, V2, 1
+    STEP(0x352, 0xD021);
+    c->pc = 0x352;
+    predecode(0xD021, &in);
+    execute(c, &in);
+    if (c->pc != 0x354) goto dispatch;
+L354: // 7001 ADD V0, 0x01
+    STEP(0x354, 0x7001);
+    V[0] += 0x01;
+L356: // 303F SE V0, 0x3F
+    STEP(0x356, 0x303F);
+    if (V[0] == 0x3F) goto L35A;
+L358: // 1350 JP 0x350
+    STEP(0x358, 0x1350);
+    goto L350;
+L35A: // D011 DRW V0, V1, 1
+    STEP(0x35A, 0xD011);
+    c->pc = 0x35A;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x35C) goto dispatch;
+L35C: // 7101 ADD V1, 0x01
+    STEP(0x35C, 0x7101);
+    V[1] += 0x01;
+L35E: // 3120 SE V1, 0x20
+    STEP(0x35E, 0x3120);
+    if (V[1] == 0x20) goto L362;
+L360: // 135A JP 0x35A
+    STEP(0x360, 0x135A);
+    goto L35A;
+L362: // 00EE RET
+    STEP(0x362, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L366: // 6101 LD V1, 0x01
+    STEP(0x366, 0x6101);
+    V[1] = 0x01;
+L368: // 630A LD V3, 0x0A
+    STEP(0x368, 0x630A);
+    V[3] = 0x0A;
+L36A: // A386 LD I, 0x386
+    STEP(0x36A, 0xA386);
+    c->I = 0x386;
+L36C: // 6022 LD V0, 0x22
+    STEP(0x36C, 0x6022);
+    V[0] = 0x22;
+L36E: // 6207 LD V2, 0x07
+    STEP(0x36E, 0x6207);
+    V[2] = 0x07;
+L370: // D013 DRW V0, V1, 3
+    STEP(0x370, 0xD013);
+    c->pc = 0x370;
+    predecode(0xD013, &in);
+    execute(c, &in);
+    if (c->pc != 0x372) goto dispatch;
+L372: // 7003 ADD V0, 0x03
+    STEP(0x372, 0x7003);
+    V[0] += 0x03;
+L374: // 72FF ADD V2, 0xFF
+    STEP(0x374, 0x72FF);
+    V[2] += 0xFF;
+L376: // 3200 SE V2, 0x00
+    STEP(0x376, 0x3200);
+    if (V[2] == 0x00) goto L37A;
+L378: // 1370 JP 0x370
+    STEP(0x378, 0x1370);
+    goto L370;
+L37A: // 7103 ADD V1, 0x03
+    STEP(0x37A, 0x7103);
+    V[1] += 0x03;
+L37C: // 73FF ADD V3, 0xFF
+    STEP(0x37C, 0x73FF);
+    V[3] += 0xFF;
+L37E: // 3300 SE V3, 0x00
+    STEP(0x37E, 0x3300);
+    if (V[3] == 0x00) goto L382;
+L380: // 136C JP 0x36C
+    STEP(0x380, 0x136C);
+    goto L36C;
+L382: // 6E46 LD VE, 0x46
+    STEP(0x382, 0x6E46);
+    V[14] = 0x46;
+L384: // 00EE RET
+    STEP(0x384, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L38A: // A3A6 LD I, 0x3A6
+    STEP(0x38A, 0xA3A6);
+    c->I = 0x3A6;
+L38C: // F833 LD B, V8
+    STEP(0x38C, 0xF833);
+    c->pc = 0x38C;
+    predecode(0xF833, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x38E) goto dispatch;
+L38E: // F265 LD V2, [I]
+    STEP(0x38E, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L390: // 6303 LD V3, 0x03
+    STEP(0x390, 0x6303);
+    V[3] = 0x03;
+L392: // 6402 LD V4, 0x02
+    STEP(0x392, 0x6402);
+    V[4] = 0x02;
+L394: // F029 LD F, V0
+    STEP(0x394, 0xF029);
+    c->I = V[0] * 5;
+L396: // D345 DRW V3, V4, 5
+    STEP(0x396, 0xD345);
+    c->pc = 0x396;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x398) goto dispatch;
+L398: // 7305 ADD V3, 0x05
+    STEP(0x398, 0x7305);
+    V[3] += 0x05;
+L39A: // F129 LD F, V1
+    STEP(0x39A, 0xF129);
+    c->I = V[1] * 5;
+L39C: // D345 DRW V3, V4, 5
+    STEP(0x39C, 0xD345);
+    c->pc = 0x39C;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x39E) goto dispatch;
+L39E: // 7305 ADD V3, 0x05
+    STEP(0x39E, 0x7305);
+    V[3] += 0x05;
+L3A0: // F229 LD F, V2
+    STEP(0x3A0, 0xF229);
+    c->I = V[2] * 5;
+L3A2: // D345 DRW V3, V4, 5
+    STEP(0x3A2, 0xD345);
+    c->pc = 0x3A2;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x3A4) goto dispatch;
+L3A4: // 00EE RET
+    STEP(0x3A4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3AC: // 6014 LD V0, 0x14
+    STEP(0x3AC, 0x6014);
+    V[0] = 0x14;
+L3AE: // 6102 LD V1, 0x02
+    STEP(0x3AE, 0x6102);
+    V[1] = 0x02;
+L3B0: // F729 LD F, V7
+    STEP(0x3B0, 0xF729);
+    c->I = V[7] * 5;
+L3B2: // D015 DRW V0, V1, 5
+    STEP(0x3B2, 0xD015);
+    c->pc = 0x3B2;
+    predecode(0xD015, &in);
+    execute(c, &in);
+    if (c->pc != 0x3B4) goto dispatch;
+L3B4: // 00EE RET
+    STEP(0x3B4, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L3B6: // 600A LD V0, 0x0A
+    STEP(0x3B6, 0x600A);
+    V[0] = 0x0A;
+L3B8: // 610C LD V1, 0x0C
+    STEP(0x3B8, 0x610C);
+    V[1] = 0x0C;
+L3BA: // 6209 LD V2, 0x09
+    STEP(0x3BA, 0x6209);
+    V[2] = 0x09;
+L3BC: // 6305 LD V3, 0x05
+    STEP(0x3BC, 0x6305);
+    V[3] = 0x05;
+L3BE: // A3CE LD I, 0x3CE
+    STEP(0x3BE, 0xA3CE);
+    c->I = 0x3CE;
+L3C0: // D015 DRW V0, V1, 5
+    STEP(0x3C0, 0xD015);
+    c->pc = 0x3C0;
+    predecode(0xD015, &in);
+    execute(c, &in);
+    if (c->pc != 0x3C2) goto dispatch;
+L3C2: // F31E ADD I, V3
+    STEP(0x3C2, 0xF31E);
+    c->I += V[3];
+L3C4: // 7005 ADD V0, 0x05
+    STEP(0x3C4, 0x7005);
+    V[0] += 0x05;
+L3C6: // 72FF ADD V2, 0xFF
+    STEP(0x3C6, 0x72FF);
+    V[2] += 0xFF;
+L3C8: // 3200 SE V2, 0x00
+    STEP(0x3C8, 0x3200);
+    if (V[2] == 0x00) goto L3CC;
+L3CA: // 13C0 JP 0x3C0
+    STEP(0x3CA, 0x13C0);
+    goto L3C0;
+L3CC: // 00EE RET
+    STEP(0x3CC, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
@@ -0,0 +1,541 @@
+// generated by chip8-aot from roms/VERS.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x12, 0x1A, 0x4A, 0x4D, 0x4E, 0x20, 0x31, 0x39, 0x39, 0x31, 0x20, 0x53,
+    0x4F, 0x46, 0x54, 0x57, 0x41, 0x52, 0x45, 0x53, 0x20, 0x80, 0x80, 0xFF,
+    0x00, 0x00, 0x63, 0x00, 0x67, 0x00, 0x00, 0xE0, 0xA2, 0x17, 0x60, 0x00,
+    0x61, 0x00, 0xD0, 0x11, 0x71, 0xFF, 0xD0, 0x11, 0x71, 0x01, 0x70, 0x08,
+    0x30, 0x40, 0x12, 0x26, 0x71, 0x01, 0xA2, 0x15, 0xD0, 0x12, 0x70, 0xFF,
+    0xD0, 0x12, 0x70, 0x01, 0x71, 0x02, 0x31, 0x1F, 0x12, 0x38, 0x60, 0x08,
+    0x61, 0x10, 0x62, 0x04, 0x64, 0x37, 0x65, 0x0F, 0x66, 0x02, 0xD0, 0x11,
+    0xD4, 0x51, 0x68, 0x01, 0xE8, 0xA1, 0x62, 0x02, 0x68, 0x02, 0xE8, 0xA1,
+    0x62, 0x04, 0x68, 0x07, 0xE8, 0xA1, 0x62, 0x01, 0x68, 0x0A, 0xE8, 0xA1,
+    0x62, 0x03, 0x68, 0x0B, 0xE8, 0xA1, 0x66, 0x02, 0x68, 0x0F, 0xE8, 0xA1,
+    0x66, 0x04, 0x68, 0x0C, 0xE8, 0xA1, 0x66, 0x01, 0x68, 0x0D, 0xE8, 0xA1,
+    0x66, 0x03, 0x42, 0x01, 0x71, 0xFF, 0x42, 0x02, 0x70, 0xFF, 0x42, 0x03,
+    0x71, 0x01, 0x42, 0x04, 0x70, 0x01, 0x46, 0x01, 0x75, 0xFF, 0x46, 0x02,
+    0x74, 0xFF, 0x46, 0x03, 0x75, 0x01, 0x46, 0x04, 0x74, 0x01, 0xD0, 0x11,
+    0x3F, 0x00, 0x12, 0xB4, 0xD4, 0x51, 0x3F, 0x00, 0x12, 0xB8, 0x12, 0x56,
+    0x77, 0x01, 0x12, 0xBA, 0x73, 0x01, 0x68, 0x00, 0x78, 0x01, 0x38, 0x00,
+    0x12, 0xBC, 0x00, 0xE0, 0x60, 0x08, 0x61, 0x04, 0xF3, 0x29, 0xD0, 0x15,
+    0x60, 0x34, 0xF7, 0x29, 0xD0, 0x15, 0x68, 0x00, 0x78, 0x01, 0x38, 0x00,
+    0x12, 0xD4, 0x43, 0x08, 0x12, 0xE4, 0x47, 0x08, 0x12, 0xE4, 0x12, 0x1E,
+    0x12, 0xE4,
+};
+const size_t aot_rom_size = 230;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+        case 0x2DA: goto L2DA;
+        case 0x2DC: goto L2DC;
+        case 0x2DE: goto L2DE;
+        case 0x2E0: goto L2E0;
+        case 0x2E2: goto L2E2;
+        case 0x2E4: goto L2E4;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 121A JP 0x21A
+    STEP(0x200, 0x121A);
+    goto L21A;
+L21A: // 6300 LD V3, 0x00
+    STEP(0x21A, 0x6300);
+    V[3] = 0x00;
+L21C: // 6700 LD V7, 0x00
+    STEP(0x21C, 0x6700);
+    V[7] = 0x00;
+L21E: // 00E0 CLS
+    STEP(0x21E, 0x00E0);
+    c->pc = 0x21E;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x220) goto dispatch;
+L220: // A217 LD I, 0x217
+    STEP(0x220, 0xA217);
+    c->I = 0x217;
+L222: // 6000 LD V0, 0x00
+    STEP(0x222, 0x6000);
+    V[0] = 0x00;
+L224: // 6100 LD V1, 0x00
+    STEP(0x224, 0x6100);
+    V[1] = 0x00;
+L226: // D011 DRW V0, V1, 1
+    STEP(0x226, 0xD011);
+    c->pc = 0x226;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x228) goto dispatch;
+L228: // 71FF ADD V1, 0xFF
+    STEP(0x228, 0x71FF);
+    V[1] += 0xFF;
+L22A: // D011 DRW V0, V1, 1
+    STEP(0x22A, 0xD011);
+    c->pc = 0x22A;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x22C) goto dispatch;
+L22C: // 7101 ADD V1, 0x01
+    STEP(0x22C, 0x7101);
+    V[1] += 0x01;
+L22E: // 7008 ADD V0, 0x08
+    STEP(0x22E, 0x7008);
+    V[0] += 0x08;
+L230: // 3040 SE V0, 0x40
+    STEP(0x230, 0x3040);
+    if (V[0] == 0x40) goto L234;
+L232: // 1226 JP 0x226
+    STEP(0x232, 0x1226);
+    goto L226;
+L234: // 7101 ADD V1, 0x01
+    STEP(0x234, 0x7101);
+    V[1] += 0x01;
+L236: // A215 LD I, 0x215
+    STEP(0x236, 0xA215);
+    c->I = 0x215;
+L238: // D012 DRW V0, V1, 2
+    STEP(0x238, 0xD012);
+    c->pc = 0x238;
+    predecode(0xD012, &in);
+    execute(c, &in);
+    if (c->pc != 0x23A) goto dispatch;
+L23A: // 70FF ADD V0, 0xFF
+    STEP(0x23A, 0x70FF);
+    V[0] += 0xFF;
+L23C: // D012 DRW V0, V1, 2
+    STEP(0x23C, 0xD012);
+    c->pc = 0x23C;
+    predecode(0xD012, &in);
+    execute(c, &in);
+    if (c->pc != 0x23E) goto dispatch;
+L23E: // 7001 ADD V0, 0x01
+    STEP(0x23E, 0x7001);
+    V[0] += 0x01;
+L240: // 7102 ADD V1, 0x02
+    STEP(0x240, 0x7102);
+    V[1] += 0x02;
+L242: // 311F SE V1, 0x1F
+    STEP(0x242, 0x311F);
+    if (V[1] == 0x1F) goto L246;
+L244: // 1238 JP 0x238
+    STEP(0x244, 0x1238);
+    goto L238;
+L246: // 6008 LD V0, 0x08
+    STEP(0x246, 0x6008);
+    V[0] = 0x08;
+L248: // 6110 LD V1, 0x10
+    STEP(0x248, 0x6110);
+    V[1] = 0x10;
+L24A: // 6204 LD V2, 0x04
+    STEP(0x24A, 0x6204);
+    V[2] = 0x04;
+L24C: // 6437 LD V4, 0x37
+    STEP(0x24C, 0x6437);
+    V[4] = 0x37;
+L24E: // 650F LD V5, 0x0F
+    STEP(0x24E, 0x650F);
+    V[5] = 0x0F;
+L250: // 6602 LD V6, 0x02
+    STEP(0x250, 0x6602);
+    V[6] = 0x02;
+L252: // D011 DRW V0, V1, 1
+    STEP(0x252, 0xD011);
+    c->pc = 0x252;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x254) goto dispatch;
+L254: // D451 DRW V4, V5, 1
+    STEP(0x254, 0xD451);
+    c->pc = 0x254;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x256) goto dispatch;
+L256: // 6801 LD V8, 0x01
+    STEP(0x256, 0x6801);
+    V[8] = 0x01;
+L258: // E8A1 SKNP V8
+    STEP(0x258, 0xE8A1);
+    c->pc = 0x258;
+    predecode(0xE8A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x25A) goto dispatch;
+L25A: // 6202 LD V2, 0x02
+    STEP(0x25A, 0x6202);
+    V[2] = 0x02;
+L25C: // 6802 LD V8, 0x02
+    STEP(0x25C, 0x6802);
+    V[8] = 0x02;
+L25E: // E8A1 SKNP V8
+    STEP(0x25E, 0xE8A1);
+    c->pc = 0x25E;
+    predecode(0xE8A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x260) goto dispatch;
+L260: // 6204 LD V2, 0x04
+    STEP(0x260, 0x6204);
+    V[2] = 0x04;
+L262: // 6807 LD V8, 0x07
+    STEP(0x262, 0x6807);
+    V[8] = 0x07;
+L264: // E8A1 SKNP V8
+    STEP(0x264, 0xE8A1);
+    c->pc = 0x264;
+    predecode(0xE8A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x266) goto dispatch;
+L266: // 6201 LD V2, 0x01
+    STEP(0x266, 0x6201);
+    V[2] = 0x01;
+L268: // 680A LD V8, 0x0A
+    STEP(0x268, 0x680A);
+    V[8] = 0x0A;
+L26A: // E8A1 SKNP V8
+    STEP(0x26A, 0xE8A1);
+    c->pc = 0x26A;
+    predecode(0xE8A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x26C) goto dispatch;
+L26C: // 6203 LD V2, 0x03
+    STEP(0x26C, 0x6203);
+    V[2] = 0x03;
+L26E: // 680B LD V8, 0x0B
+    STEP(0x26E, 0x680B);
+    V[8] = 0x0B;
+L270: // E8A1 SKNP V8
+    STEP(0x270, 0xE8A1);
+    c->pc = 0x270;
+    predecode(0xE8A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x272) goto dispatch;
+L272: // 6602 LD V6, 0x02
+    STEP(0x272, 0x6602);
+    V[6] = 0x02;
+L274: // 680F LD V8, 0x0F
+    STEP(0x274, 0x680F);
+    V[8] = 0x0F;
+L276: // E8A1 SKNP V8
+    STEP(0x276, 0xE8A1);
+    c->pc = 0x276;
+    predecode(0xE8A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x278) goto dispatch;
+L278: // 6604 LD V6, 0x04
+    STEP(0x278, 0x6604);
+    V[6] = 0x04;
+L27A: // 680C LD V8, 0x0C
+    STEP(0x27A, 0x680C);
+    V[8] = 0x0C;
+L27C: // E8A1 SKNP V8
+    STEP(0x27C, 0xE8A1);
+    c->pc = 0x27C;
+    predecode(0xE8A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x27E) goto dispatch;
+L27E: // 6601 LD V6, 0x01
+    STEP(0x27E, 0x6601);
+    V[6] = 0x01;
+L280: // 680D LD V8, 0x0D
+    STEP(0x280, 0x680D);
+    V[8] = 0x0D;
+L282: // E8A1 SKNP V8
+    STEP(0x282, 0xE8A1);
+    c->pc = 0x282;
+    predecode(0xE8A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x284) goto dispatch;
+L284: // 6603 LD V6, 0x03
+    STEP(0x284, 0x6603);
+    V[6] = 0x03;
+L286: // 4201 SNE V2, 0x01
+    STEP(0x286, 0x4201);
+    if (V[2] != 0x01) goto L28A;
+L288: // 71FF ADD V1, 0xFF
+    STEP(0x288, 0x71FF);
+    V[1] += 0xFF;
+L28A: // 4202 SNE V2, 0x02
+    STEP(0x28A, 0x4202);
+    if (V[2] != 0x02) goto L28E;
+L28C: // 70FF ADD V0, 0xFF
+    STEP(0x28C, 0x70FF);
+    V[0] += 0xFF;
+L28E: // 4203 SNE V2, 0x03
+    STEP(0x28E, 0x4203);
+    if (V[2] != 0x03) goto L292;
+L290: // 7101 ADD V1, 0x01
+    STEP(0x290, 0x7101);
+    V[1] += 0x01;
+L292: // 4204 SNE V2, 0x04
+    STEP(0x292, 0x4204);
+    if (V[2] != 0x04) goto L296;
+L294: // 7001 ADD V0, 0x01
+    STEP(0x294, 0x7001);
+    V[0] += 0x01;
+L296: // 4601 SNE V6, 0x01
+    STEP(0x296, 0x4601);
+    if (V[6] != 0x01) goto L29A;
+L298: // 75FF ADD V5, 0xFF
+    STEP(0x298, 0x75FF);
+    V[5] += 0xFF;
+L29A: // 4602 SNE V6, 0x02
+    STEP(0x29A, 0x4602);
+    if (V[6] != 0x02) goto L29E;
+L29C: // 74FF ADD V4, 0xFF
+    STEP(0x29C, 0x74FF);
+    V[4] += 0xFF;
+L29E: // 4603 SNE V6, 0x03
+    STEP(0x29E, 0x4603);
+    if (V[6] != 0x03) goto L2A2;
+L2A0: // 7501 ADD V5, 0x01
+    STEP(0x2A0, 0x7501);
+    V[5] += 0x01;
+L2A2: // 4604 SNE V6, 0x04
+    STEP(0x2A2, 0x4604);
+    if (V[6] != 0x04) goto L2A6;
+L2A4: // 7401 ADD V4, 0x01
+    STEP(0x2A4, 0x7401);
+    V[4] += 0x01;
+L2A6: // D011 DRW V0, V1, 1
+    STEP(0x2A6, 0xD011);
+    c->pc = 0x2A6;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A8) goto dispatch;
+L2A8: // 3F00 SE VF, 0x00
+    STEP(0x2A8, 0x3F00);
+    if (V[15] == 0x00) goto L2AC;
+L2AA: // 12B4 JP 0x2B4
+    STEP(0x2AA, 0x12B4);
+    goto L2B4;
+L2AC: // D451 DRW V4, V5, 1
+    STEP(0x2AC, 0xD451);
+    c->pc = 0x2AC;
+    predecode(0xD451, &in);
+    execute(c, &in);
+    if (c->pc != 0x2AE) goto dispatch;
+L2AE: // 3F00 SE VF, 0x00
+    STEP(0x2AE, 0x3F00);
+    if (V[15] == 0x00) goto L2B2;
+L2B0: // 12B8 JP 0x2B8
+    STEP(0x2B0, 0x12B8);
+    goto L2B8;
+L2B2: // 1256 JP 0x256
+    STEP(0x2B2, 0x1256);
+    goto L256;
+L2B4: // 7701 ADD V7, 0x01
+    STEP(0x2B4, 0x7701);
+    V[7] += 0x01;
+L2B6: // 12BA JP 0x2BA
+    STEP(0x2B6, 0x12BA);
+    goto L2BA;
+L2B8: // 7301 ADD V3, 0x01
+    STEP(0x2B8, 0x7301);
+    V[3] += 0x01;
+L2BA: // 6800 LD V8, 0x00
+    STEP(0x2BA, 0x6800);
+    V[8] = 0x00;
+L2BC: // 7801 ADD V8, 0x01
+    STEP(0x2BC, 0x7801);
+    V[8] += 0x01;
+L2BE: // 3800 SE V8, 0x00
+    STEP(0x2BE, 0x3800);
+    if (V[8] == 0x00) goto L2C2;
+L2C0: // 12BC JP 0x2BC
+    STEP(0x2C0, 0x12BC);
+    goto L2BC;
+L2C2: // 00E0 CLS
+    STEP(0x2C2, 0x00E0);
+    c->pc = 0x2C2;
+    predecode(0x00E0, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C4) goto dispatch;
+L2C4: // 6008 LD V0, 0x08
+    STEP(0x2C4, 0x6008);
+    V[0] = 0x08;
+L2C6: // 6104 LD V1, 0x04
+    STEP(0x2C6, 0x6104);
+    V[1] = 0x04;
+L2C8: // F329 LD F, V3
+    STEP(0x2C8, 0xF329);
+    c->I = V[3] * 5;
+L2CA: // D015 DRW V0, V1, 5
+    STEP(0x2CA, 0xD015);
+    c->pc = 0x2CA;
+    predecode(0xD015, &in);
+    execute(c, &in);
+    if (c->pc != 0x2CC) goto dispatch;
+L2CC: // 6034 LD V0, 0x34
+    STEP(0x2CC, 0x6034);
+    V[0] = 0x34;
+L2CE: // F729 LD F, V7
+    STEP(0x2CE, 0xF729);
+    c->I = V[7] * 5;
+L2D0: // D015 DRW V0, V1, 5
+    STEP(0x2D0, 0xD015);
+    c->pc = 0x2D0;
+    predecode(0xD015, &in);
+    execute(c, &in);
+    if (c->pc != 0x2D2) goto dispatch;
+L2D2: // 6800 LD V8, 0x00
+    STEP(0x2D2, 0x6800);
+    V[8] = 0x00;
+L2D4: // 7801 ADD V8, 0x01
+    STEP(0x2D4, 0x7801);
+    V[8] += 0x01;
+L2D6: // 3800 SE V8, 0x00
+    STEP(0x2D6, 0x3800);
+    if (V[8] == 0x00) goto L2DA;
+L2D8: // 12D4 JP 0x2D4
+    STEP(0x2D8, 0x12D4);
+    goto L2D4;
+L2DA: // 4308 SNE V3, 0x08
+    STEP(0x2DA, 0x4308);
+    if (V[3] != 0x08) goto L2DE;
+L2DC: // 12E4 JP 0x2E4
+    STEP(0x2DC, 0x12E4);
+    goto L2E4;
+L2DE: // 4708 SNE V7, 0x08
+    STEP(0x2DE, 0x4708);
+    if (V[7] != 0x08) goto L2E2;
+L2E0: // 12E4 JP 0x2E4
+    STEP(0x2E0, 0x12E4);
+    goto L2E4;
+L2E2: // 121E JP 0x21E
+    STEP(0x2E2, 0x121E);
+    goto L21E;
+L2E4: // 12E4 JP 0x2E4
+    STEP(0x2E4, 0x12E4);
+    goto L2E4;
+}
@@ -0,0 +1,537 @@
+// generated by chip8-aot from roms/WALL.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x12, 0x18, 0x20, 0x57, 0x41, 0x4C, 0x4C, 0x20, 0x62, 0x79, 0x20, 0x44,
+    0x61, 0x76, 0x69, 0x64, 0x20, 0x57, 0x49, 0x4E, 0x54, 0x45, 0x52, 0x20,
+    0xA2, 0xE4, 0x60, 0x00, 0x61, 0x00, 0x62, 0x1E, 0xD0, 0x11, 0xD0, 0x21,
+    0x70, 0x08, 0x30, 0x40, 0x12, 0x20, 0xA2, 0xDF, 0x60, 0x3E, 0x61, 0x01,
+    0xD0, 0x15, 0x71, 0x05, 0x31, 0x1A, 0x12, 0x30, 0xD0, 0x14, 0x63, 0x00,
+    0xC4, 0x0F, 0x74, 0x08, 0x65, 0x01, 0x84, 0x51, 0x65, 0x03, 0x66, 0x02,
+    0x67, 0x01, 0x88, 0x40, 0x78, 0x02, 0x69, 0x01, 0x6A, 0x04, 0x6B, 0x00,
+    0xA2, 0xDA, 0xD3, 0x45, 0xD7, 0x81, 0xFC, 0x0A, 0x22, 0xC4, 0x6C, 0x01,
+    0xFC, 0x15, 0xFC, 0x07, 0x3C, 0x00, 0x12, 0x62, 0xA2, 0xDA, 0x8C, 0x70,
+    0x8D, 0x80, 0xE9, 0x9E, 0x12, 0x7C, 0x44, 0x01, 0x12, 0x7C, 0xD3, 0x45,
+    0x74, 0xFE, 0xD3, 0x45, 0xEA, 0x9E, 0x12, 0x8A, 0x44, 0x19, 0x12, 0x8A,
+    0xD3, 0x45, 0x74, 0x02, 0xD3, 0x45, 0x87, 0x54, 0x88, 0x64, 0x47, 0x01,
+    0x65, 0x03, 0x47, 0x3D, 0x65, 0xFD, 0x48, 0x01, 0x66, 0x02, 0x48, 0x1D,
+    0x66, 0xFE, 0xDC, 0xD1, 0xD7, 0x81, 0x37, 0x01, 0x12, 0x5E, 0x8C, 0x80,
+    0x8C, 0x45, 0x6D, 0x00, 0x9C, 0xD0, 0x12, 0xBE, 0x7D, 0x01, 0x3D, 0x05,
+    0x12, 0xAC, 0xFC, 0x0A, 0x22, 0xC4, 0x6B, 0x00, 0x12, 0x5C, 0x22, 0xC4,
+    0x7B, 0x01, 0x12, 0x5C, 0xA2, 0xE5, 0xFB, 0x33, 0x6C, 0x34, 0x6D, 0x02,
+    0xF2, 0x65, 0xF1, 0x29, 0xDC, 0xD5, 0x7C, 0x05, 0xF2, 0x29, 0xDC, 0xD5,
+    0x00, 0xEE, 0x80, 0x80, 0x80, 0x80, 0x80, 0xE0, 0xE0, 0xE0, 0xE0, 0xE0,
+    0xFF,
+};
+const size_t aot_rom_size = 229;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+        case 0x2CA: goto L2CA;
+        case 0x2CC: goto L2CC;
+        case 0x2CE: goto L2CE;
+        case 0x2D0: goto L2D0;
+        case 0x2D2: goto L2D2;
+        case 0x2D4: goto L2D4;
+        case 0x2D6: goto L2D6;
+        case 0x2D8: goto L2D8;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 1218 JP 0x218
+    STEP(0x200, 0x1218);
+    goto L218;
+L218: // A2E4 LD I, 0x2E4
+    STEP(0x218, 0xA2E4);
+    c->I = 0x2E4;
+L21A: // 6000 LD V0, 0x00
+    STEP(0x21A, 0x6000);
+    V[0] = 0x00;
+L21C: // 6100 LD V1, 0x00
+    STEP(0x21C, 0x6100);
+    V[1] = 0x00;
+L21E: // 621E LD V2, 0x1E
+    STEP(0x21E, 0x621E);
+    V[2] = 0x1E;
+L220: // D011 DRW V0, V1, 1
+    STEP(0x220, 0xD011);
+    c->pc = 0x220;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x222) goto dispatch;
+L222: // D021 DRW V0, V2, 1
+    STEP(0x222, 0xD021);
+    c->pc = 0x222;
+    predecode(0xD021, &in);
+    execute(c, &in);
+    if (c->pc != 0x224) goto dispatch;
+L224: // 7008 ADD V0, 0x08
+    STEP(0x224, 0x7008);
+    V[0] += 0x08;
+L226: // 3040 SE V0, 0x40
+    STEP(0x226, 0x3040);
+    if (V[0] == 0x40) goto L22A;
+L228: // 1220 JP 0x220
+    STEP(0x228, 0x1220);
+    goto L220;
+L22A: // A2DF LD I, 0x2DF
+    STEP(0x22A, 0xA2DF);
+    c->I = 0x2DF;
+L22C: // 603E LD V0, 0x3E
+    STEP(0x22C, 0x603E);
+    V[0] = 0x3E;
+L22E: // 6101 LD V1, 0x01
+    STEP(0x22E, 0x6101);
+    V[1] = 0x01;
+L230: // D015 DRW V0, V1, 5
+    STEP(0x230, 0xD015);
+    c->pc = 0x230;
+    predecode(0xD015, &in);
+    execute(c, &in);
+    if (c->pc != 0x232) goto dispatch;
+L232: // 7105 ADD V1, 0x05
+    STEP(0x232, 0x7105);
+    V[1] += 0x05;
+L234: // 311A SE V1, 0x1A
+    STEP(0x234, 0x311A);
+    if (V[1] == 0x1A) goto L238;
+L236: // 1230 JP 0x230
+    STEP(0x236, 0x1230);
+    goto L230;
+L238: // D014 DRW V0, V1, 4
+    STEP(0x238, 0xD014);
+    c->pc = 0x238;
+    predecode(0xD014, &in);
+    execute(c, &in);
+    if (c->pc != 0x23A) goto dispatch;
+L23A: // 6300 LD V3, 0x00
+    STEP(0x23A, 0x6300);
+    V[3] = 0x00;
+L23C: // C40F RND V4, 0x0F
+    STEP(0x23C, 0xC40F);
+    c->pc = 0x23C;
+    predecode(0xC40F, &in);
+    execute(c, &in);
+    if (c->pc != 0x23E) goto dispatch;
+L23E: // 7408 ADD V4, 0x08
+    STEP(0x23E, 0x7408);
+    V[4] += 0x08;
+L240: // 6501 LD V5, 0x01
+    STEP(0x240, 0x6501);
+    V[5] = 0x01;
+L242: // 8451 OR V4, V5
+    STEP(0x242, 0x8451);
+    V[4] |= V[5];
+L244: // 6503 LD V5, 0x03
+    STEP(0x244, 0x6503);
+    V[5] = 0x03;
+L246: // 6602 LD V6, 0x02
+    STEP(0x246, 0x6602);
+    V[6] = 0x02;
+L248: // 6701 LD V7, 0x01
+    STEP(0x248, 0x6701);
+    V[7] = 0x01;
+L24A: // 8840 LD V8, V4
+    STEP(0x24A, 0x8840);
+    V[8] = V[4];
+L24C: // 7802 ADD V8, 0x02
+    STEP(0x24C, 0x7802);
+    V[8] += 0x02;
+L24E: // 6901 LD V9, 0x01
+    STEP(0x24E, 0x6901);
+    V[9] = 0x01;
+L250: // 6A04 LD VA, 0x04
+    STEP(0x250, 0x6A04);
+    V[10] = 0x04;
+L252: // 6B00 LD VB, 0x00
+    STEP(0x252, 0x6B00);
+    V[11] = 0x00;
+L254: // A2DA LD I, 0x2DA
+    STEP(0x254, 0xA2DA);
+    c->I = 0x2DA;
+L256: // D345 DRW V3, V4, 5
+    STEP(0x256, 0xD345);
+    c->pc = 0x256;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x258) goto dispatch;
+L258: // D781 DRW V7, V8, 1
+    STEP(0x258, 0xD781);
+    c->pc = 0x258;
+    predecode(0xD781, &in);
+    execute(c, &in);
+    if (c->pc != 0x25A) goto dispatch;
+L25A: // FC0A LD VC, K
+    STEP(0x25A, 0xFC0A);
+    if (c->keypad == 0) {
+        c->pc = 0x25A;
+        return cycles - left;
+    }
+    V[12] = __builtin_ctz(c->keypad);
+L25C: // 22C4 CALL 0x2C4
+    STEP(0x25C, 0x22C4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x25C;
+    goto L2C4;
+L25E: // 6C01 LD VC, 0x01
+    STEP(0x25E, 0x6C01);
+    V[12] = 0x01;
+L260: // FC15 LD DT, VC
+    STEP(0x260, 0xFC15);
+    c->dt = V[12];
+L262: // FC07 LD VC, DT
+    STEP(0x262, 0xFC07);
+    V[12] = c->dt;
+L264: // 3C00 SE VC, 0x00
+    STEP(0x264, 0x3C00);
+    if (V[12] == 0x00) goto L268;
+L266: // 1262 JP 0x262
+    STEP(0x266, 0x1262);
+    goto L262;
+L268: // A2DA LD I, 0x2DA
+    STEP(0x268, 0xA2DA);
+    c->I = 0x2DA;
+L26A: // 8C70 LD VC, V7
+    STEP(0x26A, 0x8C70);
+    V[12] = V[7];
+L26C: // 8D80 LD VD, V8
+    STEP(0x26C, 0x8D80);
+    V[13] = V[8];
+L26E: // E99E SKP V9
+    STEP(0x26E, 0xE99E);
+    c->pc = 0x26E;
+    predecode(0xE99E, &in);
+    execute(c, &in);
+    if (c->pc != 0x270) goto dispatch;
+L270: // 127C JP 0x27C
+    STEP(0x270, 0x127C);
+    goto L27C;
+L272: // 4401 SNE V4, 0x01
+    STEP(0x272, 0x4401);
+    if (V[4] != 0x01) goto L276;
+L274: // 127C JP 0x27C
+    STEP(0x274, 0x127C);
+    goto L27C;
+L276: // D345 DRW V3, V4, 5
+    STEP(0x276, 0xD345);
+    c->pc = 0x276;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x278) goto dispatch;
+L278: // 74FE ADD V4, 0xFE
+    STEP(0x278, 0x74FE);
+    V[4] += 0xFE;
+L27A: // D345 DRW V3, V4, 5
+    STEP(0x27A, 0xD345);
+    c->pc = 0x27A;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x27C) goto dispatch;
+L27C: // EA9E SKP VA
+    STEP(0x27C, 0xEA9E);
+    c->pc = 0x27C;
+    predecode(0xEA9E, &in);
+    execute(c, &in);
+    if (c->pc != 0x27E) goto dispatch;
+L27E: // 128A JP 0x28A
+    STEP(0x27E, 0x128A);
+    goto L28A;
+L280: // 4419 SNE V4, 0x19
+    STEP(0x280, 0x4419);
+    if (V[4] != 0x19) goto L284;
+L282: // 128A JP 0x28A
+    STEP(0x282, 0x128A);
+    goto L28A;
+L284: // D345 DRW V3, V4, 5
+    STEP(0x284, 0xD345);
+    c->pc = 0x284;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x286) goto dispatch;
+L286: // 7402 ADD V4, 0x02
+    STEP(0x286, 0x7402);
+    V[4] += 0x02;
+L288: // D345 DRW V3, V4, 5
+    STEP(0x288, 0xD345);
+    c->pc = 0x288;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x28A) goto dispatch;
+L28A: // 8754 ADD V7, V5
+    STEP(0x28A, 0x8754);
+    V[15] = V[7] + V[5] > 0xFF;
+    V[7] += V[5];
+L28C: // 8864 ADD V8, V6
+    STEP(0x28C, 0x8864);
+    V[15] = V[8] + V[6] > 0xFF;
+    V[8] += V[6];
+L28E: // 4701 SNE V7, 0x01
+    STEP(0x28E, 0x4701);
+    if (V[7] != 0x01) goto L292;
+L290: // 6503 LD V5, 0x03
+    STEP(0x290, 0x6503);
+    V[5] = 0x03;
+L292: // 473D SNE V7, 0x3D
+    STEP(0x292, 0x473D);
+    if (V[7] != 0x3D) goto L296;
+L294: // 65FD LD V5, 0xFD
+    STEP(0x294, 0x65FD);
+    V[5] = 0xFD;
+L296: // 4801 SNE V8, 0x01
+    STEP(0x296, 0x4801);
+    if (V[8] != 0x01) goto L29A;
+L298: // 6602 LD V6, 0x02
+    STEP(0x298, 0x6602);
+    V[6] = 0x02;
+L29A: // 481D SNE V8, 0x1D
+    STEP(0x29A, 0x481D);
+    if (V[8] != 0x1D) goto L29E;
+L29C: // 66FE LD V6, 0xFE
+    STEP(0x29C, 0x66FE);
+    V[6] = 0xFE;
+L29E: // DCD1 DRW VC, VD, 1
+    STEP(0x29E, 0xDCD1);
+    c->pc = 0x29E;
+    predecode(0xDCD1, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A0) goto dispatch;
+L2A0: // D781 DRW V7, V8, 1
+    STEP(0x2A0, 0xD781);
+    c->pc = 0x2A0;
+    predecode(0xD781, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A2) goto dispatch;
+L2A2: // 3701 SE V7, 0x01
+    STEP(0x2A2, 0x3701);
+    if (V[7] == 0x01) goto L2A6;
+L2A4: // 125E JP 0x25E
+    STEP(0x2A4, 0x125E);
+    goto L25E;
+L2A6: // 8C80 LD VC, V8
+    STEP(0x2A6, 0x8C80);
+    V[12] = V[8];
+L2A8: // 8C45 SUB VC, V4
+    STEP(0x2A8, 0x8C45);
+    V[15] = V[12] > V[4];
+    V[12] -= V[4];
+L2AA: // 6D00 LD VD, 0x00
+    STEP(0x2AA, 0x6D00);
+    V[13] = 0x00;
+L2AC: // 9CD0 SNE VC, VD
+    STEP(0x2AC, 0x9CD0);
+    if (V[12] != V[13]) goto L2B0;
+L2AE: // 12BE JP 0x2BE
+    STEP(0x2AE, 0x12BE);
+    goto L2BE;
+L2B0: // 7D01 ADD VD, 0x01
+    STEP(0x2B0, 0x7D01);
+    V[13] += 0x01;
+L2B2: // 3D05 SE VD, 0x05
+    STEP(0x2B2, 0x3D05);
+    if (V[13] == 0x05) goto L2B6;
+L2B4: // 12AC JP 0x2AC
+    STEP(0x2B4, 0x12AC);
+    goto L2AC;
+L2B6: // FC0A LD VC, K
+    STEP(0x2B6, 0xFC0A);
+    if (c->keypad == 0) {
+        c->pc = 0x2B6;
+        return cycles - left;
+    }
+    V[12] = __builtin_ctz(c->keypad);
+L2B8: // 22C4 CALL 0x2C4
+    STEP(0x2B8, 0x22C4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2B8;
+    goto L2C4;
+L2BA: // 6B00 LD VB, 0x00
+    STEP(0x2BA, 0x6B00);
+    V[11] = 0x00;
+L2BC: // 125C JP 0x25C
+    STEP(0x2BC, 0x125C);
+    goto L25C;
+L2BE: // 22C4 CALL 0x2C4
+    STEP(0x2BE, 0x22C4);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x2BE;
+    goto L2C4;
+L2C0: // 7B01 ADD VB, 0x01
+    STEP(0x2C0, 0x7B01);
+    V[11] += 0x01;
+L2C2: // 125C JP 0x25C
+    STEP(0x2C2, 0x125C);
+    goto L25C;
+L2C4: // A2E5 LD I, 0x2E5
+    STEP(0x2C4, 0xA2E5);
+    c->I = 0x2E5;
+L2C6: // FB33 LD B, VB
+    STEP(0x2C6, 0xFB33);
+    c->pc = 0x2C6;
+    predecode(0xFB33, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2C8) goto dispatch;
+L2C8: // 6C34 LD VC, 0x34
+    STEP(0x2C8, 0x6C34);
+    V[12] = 0x34;
+L2CA: // 6D02 LD VD, 0x02
+    STEP(0x2CA, 0x6D02);
+    V[13] = 0x02;
+L2CC: // F265 LD V2, [I]
+    STEP(0x2CC, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2CE: // F129 LD F, V1
+    STEP(0x2CE, 0xF129);
+    c->I = V[1] * 5;
+L2D0: // DCD5 DRW VC, VD, 5
+    STEP(0x2D0, 0xDCD5);
+    c->pc = 0x2D0;
+    predecode(0xDCD5, &in);
+    execute(c, &in);
+    if (c->pc != 0x2D2) goto dispatch;
+L2D2: // 7C05 ADD VC, 0x05
+    STEP(0x2D2, 0x7C05);
+    V[12] += 0x05;
+L2D4: // F229 LD F, V2
+    STEP(0x2D4, 0xF229);
+    c->I = V[2] * 5;
+L2D6: // DCD5 DRW VC, VD, 5
+    STEP(0x2D6, 0xDCD5);
+    c->pc = 0x2D6;
+    predecode(0xDCD5, &in);
+    execute(c, &in);
+    if (c->pc != 0x2D8) goto dispatch;
+L2D8: // 00EE RET
+    STEP(0x2D8, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
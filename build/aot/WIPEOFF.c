@@ -0,0 +1,541 @@
+// generated by chip8-aot from roms/WIPEOFF.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0xA2, 0xCC, 0x6A, 0x07, 0x61, 0x00, 0x6B, 0x08, 0x60, 0x00, 0xD0, 0x11,
+    0x70, 0x08, 0x7B, 0xFF, 0x3B, 0x00, 0x12, 0x0A, 0x71, 0x04, 0x7A, 0xFF,
+    0x3A, 0x00, 0x12, 0x06, 0x66, 0x00, 0x67, 0x10, 0xA2, 0xCD, 0x60, 0x20,
+    0x61, 0x1E, 0xD0, 0x11, 0x63, 0x1D, 0x62, 0x3F, 0x82, 0x02, 0x77, 0xFF,
+    0x47, 0x00, 0x12, 0xAA, 0xFF, 0x0A, 0xA2, 0xCB, 0xD2, 0x31, 0x65, 0xFF,
+    0xC4, 0x01, 0x34, 0x01, 0x64, 0xFF, 0xA2, 0xCD, 0x6C, 0x00, 0x6E, 0x04,
+    0xEE, 0xA1, 0x6C, 0xFF, 0x6E, 0x06, 0xEE, 0xA1, 0x6C, 0x01, 0xD0, 0x11,
+    0x80, 0xC4, 0xD0, 0x11, 0x4F, 0x01, 0x12, 0x98, 0x42, 0x00, 0x64, 0x01,
+    0x42, 0x3F, 0x64, 0xFF, 0x43, 0x00, 0x65, 0x01, 0x43, 0x1F, 0x12, 0xA4,
+    0xA2, 0xCB, 0xD2, 0x31, 0x82, 0x44, 0x83, 0x54, 0xD2, 0x31, 0x3F, 0x01,
+    0x12, 0x42, 0x43, 0x1E, 0x12, 0x98, 0x6A, 0x02, 0xFA, 0x18, 0x76, 0x01,
+    0x46, 0x70, 0x12, 0xAA, 0xD2, 0x31, 0xC4, 0x01, 0x34, 0x01, 0x64, 0xFF,
+    0xC5, 0x01, 0x35, 0x01, 0x65, 0xFF, 0x12, 0x42, 0x6A, 0x03, 0xFA, 0x18,
+    0xA2, 0xCB, 0xD2, 0x31, 0x73, 0xFF, 0x12, 0x36, 0xA2, 0xCB, 0xD2, 0x31,
+    0x12, 0x28, 0xA2, 0xCD, 0xD0, 0x11, 0xA2, 0xF0, 0xF6, 0x33, 0xF2, 0x65,
+    0x63, 0x18, 0x64, 0x1B, 0xF0, 0x29, 0xD3, 0x45, 0x73, 0x05, 0xF1, 0x29,
+    0xD3, 0x45, 0x73, 0x05, 0xF2, 0x29, 0xD3, 0x45, 0x12, 0xC8, 0x01, 0x80,
+    0x44, 0xFF,
+};
+const size_t aot_rom_size = 206;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000F00ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+        case 0x268: goto L268;
+        case 0x26A: goto L26A;
+        case 0x26C: goto L26C;
+        case 0x26E: goto L26E;
+        case 0x270: goto L270;
+        case 0x272: goto L272;
+        case 0x274: goto L274;
+        case 0x276: goto L276;
+        case 0x278: goto L278;
+        case 0x27A: goto L27A;
+        case 0x27C: goto L27C;
+        case 0x27E: goto L27E;
+        case 0x280: goto L280;
+        case 0x282: goto L282;
+        case 0x284: goto L284;
+        case 0x286: goto L286;
+        case 0x288: goto L288;
+        case 0x28A: goto L28A;
+        case 0x28C: goto L28C;
+        case 0x28E: goto L28E;
+        case 0x290: goto L290;
+        case 0x292: goto L292;
+        case 0x294: goto L294;
+        case 0x296: goto L296;
+        case 0x298: goto L298;
+        case 0x29A: goto L29A;
+        case 0x29C: goto L29C;
+        case 0x29E: goto L29E;
+        case 0x2A0: goto L2A0;
+        case 0x2A2: goto L2A2;
+        case 0x2A4: goto L2A4;
+        case 0x2A6: goto L2A6;
+        case 0x2A8: goto L2A8;
+        case 0x2AA: goto L2AA;
+        case 0x2AC: goto L2AC;
+        case 0x2AE: goto L2AE;
+        case 0x2B0: goto L2B0;
+        case 0x2B2: goto L2B2;
+        case 0x2B4: goto L2B4;
+        case 0x2B6: goto L2B6;
+        case 0x2B8: goto L2B8;
+        case 0x2BA: goto L2BA;
+        case 0x2BC: goto L2BC;
+        case 0x2BE: goto L2BE;
+        case 0x2C0: goto L2C0;
+        case 0x2C2: goto L2C2;
+        case 0x2C4: goto L2C4;
+        case 0x2C6: goto L2C6;
+        case 0x2C8: goto L2C8;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // A2CC LD I, 0x2CC
+    STEP(0x200, 0xA2CC);
+    c->I = 0x2CC;
+L202: // 6A07 LD VA, 0x07
+    STEP(0x202, 0x6A07);
+    V[10] = 0x07;
+L204: // 6100 LD V1, 0x00
+    STEP(0x204, 0x6100);
+    V[1] = 0x00;
+L206: // 6B08 LD VB, 0x08
+    STEP(0x206, 0x6B08);
+    V[11] = 0x08;
+L208: // 6000 LD V0, 0x00
+    STEP(0x208, 0x6000);
+    V[0] = 0x00;
+L20A: // D011 DRW V0, V1, 1
+    STEP(0x20A, 0xD011);
+    c->pc = 0x20A;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x20C) goto dispatch;
+L20C: // 7008 ADD V0, 0x08
+    STEP(0x20C, 0x7008);
+    V[0] += 0x08;
+L20E: // 7BFF ADD VB, 0xFF
+    STEP(0x20E, 0x7BFF);
+    V[11] += 0xFF;
+L210: // 3B00 SE VB, 0x00
+    STEP(0x210, 0x3B00);
+    if (V[11] == 0x00) goto L214;
+L212: // 120A JP 0x20A
+    STEP(0x212, 0x120A);
+    goto L20A;
+L214: // 7104 ADD V1, 0x04
+    STEP(0x214, 0x7104);
+    V[1] += 0x04;
+L216: // 7AFF ADD VA, 0xFF
+    STEP(0x216, 0x7AFF);
+    V[10] += 0xFF;
+L218: // 3A00 SE VA, 0x00
+    STEP(0x218, 0x3A00);
+    if (V[10] == 0x00) goto L21C;
+L21A: // 1206 JP 0x206
+    STEP(0x21A, 0x1206);
+    goto L206;
+L21C: // 6600 LD V6, 0x00
+    STEP(0x21C, 0x6600);
+    V[6] = 0x00;
+L21E: // 6710 LD V7, 0x10
+    STEP(0x21E, 0x6710);
+    V[7] = 0x10;
+L220: // A2CD LD I, 0x2CD
+    STEP(0x220, 0xA2CD);
+    c->I = 0x2CD;
+L222: // 6020 LD V0, 0x20
+    STEP(0x222, 0x6020);
+    V[0] = 0x20;
+L224: // 611E LD V1, 0x1E
+    STEP(0x224, 0x611E);
+    V[1] = 0x1E;
+L226: // D011 DRW V0, V1, 1
+    STEP(0x226, 0xD011);
+    c->pc = 0x226;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x228) goto dispatch;
+L228: // 631D LD V3, 0x1D
+    STEP(0x228, 0x631D);
+    V[3] = 0x1D;
+L22A: // 623F LD V2, 0x3F
+    STEP(0x22A, 0x623F);
+    V[2] = 0x3F;
+L22C: // 8202 AND V2, V0
+    STEP(0x22C, 0x8202);
+    V[2] &= V[0];
+L22E: // 77FF ADD V7, 0xFF
+    STEP(0x22E, 0x77FF);
+    V[7] += 0xFF;
+L230: // 4700 SNE V7, 0x00
+    STEP(0x230, 0x4700);
+    if (V[7] != 0x00) goto L234;
+L232: // 12AA JP 0x2AA
+    STEP(0x232, 0x12AA);
+    goto L2AA;
+L234: // FF0A LD VF, K
+    STEP(0x234, 0xFF0A);
+    if (c->keypad == 0) {
+        c->pc = 0x234;
+        return cycles - left;
+    }
+    V[15] = __builtin_ctz(c->keypad);
+L236: // A2CB LD I, 0x2CB
+    STEP(0x236, 0xA2CB);
+    c->I = 0x2CB;
+L238: // D231 DRW V2, V3, 1
+    STEP(0x238, 0xD231);
+    c->pc = 0x238;
+    predecode(0xD231, &in);
+    execute(c, &in);
+    if (c->pc != 0x23A) goto dispatch;
+L23A: // 65FF LD V5, 0xFF
+    STEP(0x23A, 0x65FF);
+    V[5] = 0xFF;
+L23C: // C401 RND V4, 0x01
+    STEP(0x23C, 0xC401);
+    c->pc = 0x23C;
+    predecode(0xC401, &in);
+    execute(c, &in);
+    if (c->pc != 0x23E) goto dispatch;
+L23E: // 3401 SE V4, 0x01
+    STEP(0x23E, 0x3401);
+    if (V[4] == 0x01) goto L242;
+L240: // 64FF LD V4, 0xFF
+    STEP(0x240, 0x64FF);
+    V[4] = 0xFF;
+L242: // A2CD LD I, 0x2CD
+    STEP(0x242, 0xA2CD);
+    c->I = 0x2CD;
+L244: // 6C00 LD VC, 0x00
+    STEP(0x244, 0x6C00);
+    V[12] = 0x00;
+L246: // 6E04 LD VE, 0x04
+    STEP(0x246, 0x6E04);
+    V[14] = 0x04;
+L248: // EEA1 SKNP VE
+    STEP(0x248, 0xEEA1);
+    c->pc = 0x248;
+    predecode(0xEEA1, &in);
+    execute(c, &in);
+    if (c->pc != 0x24A) goto dispatch;
+L24A: // 6CFF LD VC, 0xFF
+    STEP(0x24A, 0x6CFF);
+    V[12] = 0xFF;
+L24C: // 6E06 LD VE, 0x06
+    STEP(0x24C, 0x6E06);
+    V[14] = 0x06;
+L24E: // EEA1 SKNP VE
+    STEP(0x24E, 0xEEA1);
+    c->pc = 0x24E;
+    predecode(0xEEA1, &in);
+    execute(c, &in);
+    if (c->pc != 0x250) goto dispatch;
+L250: // 6C01 LD VC, 0x01
+    STEP(0x250, 0x6C01);
+    V[12] = 0x01;
+L252: // D011 DRW V0, V1, 1
+    STEP(0x252, 0xD011);
+    c->pc = 0x252;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x254) goto dispatch;
+L254: // 80C4 ADD V0, VC
+    STEP(0x254, 0x80C4);
+    V[15] = V[0] + V[12] > 0xFF;
+    V[0] += V[12];
+L256: // D011 DRW V0, V1, 1
+    STEP(0x256, 0xD011);
+    c->pc = 0x256;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x258) goto dispatch;
+L258: // 4F01 SNE VF, 0x01
+    STEP(0x258, 0x4F01);
+    if (V[15] != 0x01) goto L25C;
+L25A: // 1298 JP 0x298
+    STEP(0x25A, 0x1298);
+    goto L298;
+L25C: // 4200 SNE V2, 0x00
+    STEP(0x25C, 0x4200);
+    if (V[2] != 0x00) goto L260;
+L25E: // 6401 LD V4, 0x01
+    STEP(0x25E, 0x6401);
+    V[4] = 0x01;
+L260: // 423F SNE V2, 0x3F
+    STEP(0x260, 0x423F);
+    if (V[2] != 0x3F) goto L264;
+L262: // 64FF LD V4, 0xFF
+    STEP(0x262, 0x64FF);
+    V[4] = 0xFF;
+L264: // 4300 SNE V3, 0x00
+    STEP(0x264, 0x4300);
+    if (V[3] != 0x00) goto L268;
+L266: // 6501 LD V5, 0x01
+    STEP(0x266, 0x6501);
+    V[5] = 0x01;
+L268: // 431F SNE V3, 0x1F
+    STEP(0x268, 0x431F);
+    if (V[3] != 0x1F) goto L26C;
+L26A: // 12A4 JP 0x2A4
+    STEP(0x26A, 0x12A4);
+    goto L2A4;
+L26C: // A2CB LD I, 0x2CB
+    STEP(0x26C, 0xA2CB);
+    c->I = 0x2CB;
+L26E: // D231 DRW V2, V3, 1
+    STEP(0x26E, 0xD231);
+    c->pc = 0x26E;
+    predecode(0xD231, &in);
+    execute(c, &in);
+    if (c->pc != 0x270) goto dispatch;
+L270: // 8244 ADD V2, V4
+    STEP(0x270, 0x8244);
+    V[15] = V[2] + V[4] > 0xFF;
+    V[2] += V[4];
+L272: // 8354 ADD V3, V5
+    STEP(0x272, 0x8354);
+    V[15] = V[3] + V[5] > 0xFF;
+    V[3] += V[5];
+L274: // D231 DRW V2, V3, 1
+    STEP(0x274, 0xD231);
+    c->pc = 0x274;
+    predecode(0xD231, &in);
+    execute(c, &in);
+    if (c->pc != 0x276) goto dispatch;
+L276: // 3F01 SE VF, 0x01
+    STEP(0x276, 0x3F01);
+    if (V[15] == 0x01) goto L27A;
+L278: // 1242 JP 0x242
+    STEP(0x278, 0x1242);
+    goto L242;
+L27A: // 431E SNE V3, 0x1E
+    STEP(0x27A, 0x431E);
+    if (V[3] != 0x1E) goto L27E;
+L27C: // 1298 JP 0x298
+    STEP(0x27C, 0x1298);
+    goto L298;
+L27E: // 6A02 LD VA, 0x02
+    STEP(0x27E, 0x6A02);
+    V[10] = 0x02;
+L280: // FA18 LD ST, VA
+    STEP(0x280, 0xFA18);
+    c->st = V[10];
+L282: // 7601 ADD V6, 0x01
+    STEP(0x282, 0x7601);
+    V[6] += 0x01;
+L284: // 4670 SNE V6, 0x70
+    STEP(0x284, 0x4670);
+    if (V[6] != 0x70) goto L288;
+L286: // 12AA JP 0x2AA
+    STEP(0x286, 0x12AA);
+    goto L2AA;
+L288: // D231 DRW V2, V3, 1
+    STEP(0x288, 0xD231);
+    c->pc = 0x288;
+    predecode(0xD231, &in);
+    execute(c, &in);
+    if (c->pc != 0x28A) goto dispatch;
+L28A: // C401 RND V4, 0x01
+    STEP(0x28A, 0xC401);
+    c->pc = 0x28A;
+    predecode(0xC401, &in);
+    execute(c, &in);
+    if (c->pc != 0x28C) goto dispatch;
+L28C: // 3401 SE V4, 0x01
+    STEP(0x28C, 0x3401);
+    if (V[4] == 0x01) goto L290;
+L28E: // 64FF LD V4, 0xFF
+    STEP(0x28E, 0x64FF);
+    V[4] = 0xFF;
+L290: // C501 RND V5, 0x01
+    STEP(0x290, 0xC501);
+    c->pc = 0x290;
+    predecode(0xC501, &in);
+    execute(c, &in);
+    if (c->pc != 0x292) goto dispatch;
+L292: // 3501 SE V5, 0x01
+    STEP(0x292, 0x3501);
+    if (V[5] == 0x01) goto L296;
+L294: // 65FF LD V5, 0xFF
+    STEP(0x294, 0x65FF);
+    V[5] = 0xFF;
+L296: // 1242 JP 0x242
+    STEP(0x296, 0x1242);
+    goto L242;
+L298: // 6A03 LD VA, 0x03
+    STEP(0x298, 0x6A03);
+    V[10] = 0x03;
+L29A: // FA18 LD ST, VA
+    STEP(0x29A, 0xFA18);
+    c->st = V[10];
+L29C: // A2CB LD I, 0x2CB
+    STEP(0x29C, 0xA2CB);
+    c->I = 0x2CB;
+L29E: // D231 DRW V2, V3, 1
+    STEP(0x29E, 0xD231);
+    c->pc = 0x29E;
+    predecode(0xD231, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A0) goto dispatch;
+L2A0: // 73FF ADD V3, 0xFF
+    STEP(0x2A0, 0x73FF);
+    V[3] += 0xFF;
+L2A2: // 1236 JP 0x236
+    STEP(0x2A2, 0x1236);
+    goto L236;
+L2A4: // A2CB LD I, 0x2CB
+    STEP(0x2A4, 0xA2CB);
+    c->I = 0x2CB;
+L2A6: // D231 DRW V2, V3, 1
+    STEP(0x2A6, 0xD231);
+    c->pc = 0x2A6;
+    predecode(0xD231, &in);
+    execute(c, &in);
+    if (c->pc != 0x2A8) goto dispatch;
+L2A8: // 1228 JP 0x228
+    STEP(0x2A8, 0x1228);
+    goto L228;
+L2AA: // A2CD LD I, 0x2CD
+    STEP(0x2AA, 0xA2CD);
+    c->I = 0x2CD;
+L2AC: // D011 DRW V0, V1, 1
+    STEP(0x2AC, 0xD011);
+    c->pc = 0x2AC;
+    predecode(0xD011, &in);
+    execute(c, &in);
+    if (c->pc != 0x2AE) goto dispatch;
+L2AE: // A2F0 LD I, 0x2F0
+    STEP(0x2AE, 0xA2F0);
+    c->I = 0x2F0;
+L2B0: // F633 LD B, V6
+    STEP(0x2B0, 0xF633);
+    c->pc = 0x2B0;
+    predecode(0xF633, &in);
+    execute(c, &in);
+    tainted = TAINTED();
+    if (c->pc != 0x2B2) goto dispatch;
+L2B2: // F265 LD V2, [I]
+    STEP(0x2B2, 0xF265);
+    for (int i = 0; i <= 2; i++) {
+        V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+L2B4: // 6318 LD V3, 0x18
+    STEP(0x2B4, 0x6318);
+    V[3] = 0x18;
+L2B6: // 641B LD V4, 0x1B
+    STEP(0x2B6, 0x641B);
+    V[4] = 0x1B;
+L2B8: // F029 LD F, V0
+    STEP(0x2B8, 0xF029);
+    c->I = V[0] * 5;
+L2BA: // D345 DRW V3, V4, 5
+    STEP(0x2BA, 0xD345);
+    c->pc = 0x2BA;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2BC) goto dispatch;
+L2BC: // 7305 ADD V3, 0x05
+    STEP(0x2BC, 0x7305);
+    V[3] += 0x05;
+L2BE: // F129 LD F, V1
+    STEP(0x2BE, 0xF129);
+    c->I = V[1] * 5;
+L2C0: // D345 DRW V3, V4, 5
+    STEP(0x2C0, 0xD345);
+    c->pc = 0x2C0;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C2) goto dispatch;
+L2C2: // 7305 ADD V3, 0x05
+    STEP(0x2C2, 0x7305);
+    V[3] += 0x05;
+L2C4: // F229 LD F, V2
+    STEP(0x2C4, 0xF229);
+    c->I = V[2] * 5;
+L2C6: // D345 DRW V3, V4, 5
+    STEP(0x2C6, 0xD345);
+    c->pc = 0x2C6;
+    predecode(0xD345, &in);
+    execute(c, &in);
+    if (c->pc != 0x2C8) goto dispatch;
+L2C8: // 12C8 JP 0x2C8
+    STEP(0x2C8, 0x12C8);
+    goto L2C8;
+}
@@ -0,0 +1,318 @@
+// generated by chip8-aot from roms/TEST/X-MIRROR.ch8, do not edit
+
+#include "aot.h"
+
+const unsigned char aot_rom[] = {
+    0x66, 0x1E, 0x67, 0x0F, 0x68, 0x1F, 0x69, 0x0F, 0x6A, 0x1E, 0x6B, 0x10,
+    0x6C, 0x1F, 0x6D, 0x10, 0xA2, 0x68, 0x22, 0x2E, 0x60, 0x02, 0xE0, 0xA1,
+    0x22, 0x44, 0x60, 0x08, 0xE0, 0xA1, 0x22, 0x38, 0x60, 0x04, 0xE0, 0xA1,
+    0x22, 0x50, 0x60, 0x06, 0xE0, 0xA1, 0x22, 0x5C, 0x12, 0x14, 0xD6, 0x71,
+    0xD8, 0x91, 0xDA, 0xB1, 0xDC, 0xD1, 0x00, 0xEE, 0x77, 0xFF, 0x79, 0xFF,
+    0x7B, 0x01, 0x7D, 0x01, 0x22, 0x2E, 0x00, 0xEE, 0x77, 0x01, 0x79, 0x01,
+    0x7B, 0xFF, 0x7D, 0xFF, 0x22, 0x2E, 0x00, 0xEE, 0x76, 0xFF, 0x78, 0x01,
+    0x7A, 0xFF, 0x7C, 0x01, 0x22, 0x2E, 0x00, 0xEE, 0x76, 0x01, 0x78, 0xFF,
+    0x7A, 0x01, 0x7C, 0xFF, 0x22, 0x2E, 0x00, 0xEE, 0x80, 0x00,
+};
+const size_t aot_rom_size = 106;
+
+// the 64-byte blocks holding compiled instructions
+#define CODE_BLOCKS 0x0000000000000300ULL
+#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)
+#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])
+
+// takes an instruction from the budget, unless it ran out or the
+// instruction changed in memory
+#define STEP(a, op) \
+    do { \
+        if (left == 0 || (tainted && OPCODE(a) != (op))) { \
+            c->pc = (a); \
+            goto leave; \
+        } \
+        left--; \
+    } while (0)
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles) {
+    unsigned char* V = c->V;
+    unsigned long left = cycles;
+    int tainted = TAINTED();
+    insn_t in;
+
+    if (c->mode == MODE_XOCHIP) {
+        for (; left; left--) emulate_cycle(c);
+        return cycles;
+    }
+
+dispatch:
+    if (left == 0) return cycles;
+    switch (c->pc) {
+        case 0x200: goto L200;
+        case 0x202: goto L202;
+        case 0x204: goto L204;
+        case 0x206: goto L206;
+        case 0x208: goto L208;
+        case 0x20A: goto L20A;
+        case 0x20C: goto L20C;
+        case 0x20E: goto L20E;
+        case 0x210: goto L210;
+        case 0x212: goto L212;
+        case 0x214: goto L214;
+        case 0x216: goto L216;
+        case 0x218: goto L218;
+        case 0x21A: goto L21A;
+        case 0x21C: goto L21C;
+        case 0x21E: goto L21E;
+        case 0x220: goto L220;
+        case 0x222: goto L222;
+        case 0x224: goto L224;
+        case 0x226: goto L226;
+        case 0x228: goto L228;
+        case 0x22A: goto L22A;
+        case 0x22C: goto L22C;
+        case 0x22E: goto L22E;
+        case 0x230: goto L230;
+        case 0x232: goto L232;
+        case 0x234: goto L234;
+        case 0x236: goto L236;
+        case 0x238: goto L238;
+        case 0x23A: goto L23A;
+        case 0x23C: goto L23C;
+        case 0x23E: goto L23E;
+        case 0x240: goto L240;
+        case 0x242: goto L242;
+        case 0x244: goto L244;
+        case 0x246: goto L246;
+        case 0x248: goto L248;
+        case 0x24A: goto L24A;
+        case 0x24C: goto L24C;
+        case 0x24E: goto L24E;
+        case 0x250: goto L250;
+        case 0x252: goto L252;
+        case 0x254: goto L254;
+        case 0x256: goto L256;
+        case 0x258: goto L258;
+        case 0x25A: goto L25A;
+        case 0x25C: goto L25C;
+        case 0x25E: goto L25E;
+        case 0x260: goto L260;
+        case 0x262: goto L262;
+        case 0x264: goto L264;
+        case 0x266: goto L266;
+    }
+
+    // no label there, or the code changed
+leave:
+    if (left == 0) return cycles;
+    emulate_cycle(c);
+    left--;
+    tainted = TAINTED();
+    goto dispatch;
+
+L200: // 661E LD V6, 0x1E
+    STEP(0x200, 0x661E);
+    V[6] = 0x1E;
+L202: // 670F LD V7, 0x0F
+    STEP(0x202, 0x670F);
+    V[7] = 0x0F;
+L204: // 681F LD V8, 0x1F
+    STEP(0x204, 0x681F);
+    V[8] = 0x1F;
+L206: // 690F LD V9, 0x0F
+    STEP(0x206, 0x690F);
+    V[9] = 0x0F;
+L208: // 6A1E LD VA, 0x1E
+    STEP(0x208, 0x6A1E);
+    V[10] = 0x1E;
+L20A: // 6B10 LD VB, 0x10
+    STEP(0x20A, 0x6B10);
+    V[11] = 0x10;
+L20C: // 6C1F LD VC, 0x1F
+    STEP(0x20C, 0x6C1F);
+    V[12] = 0x1F;
+L20E: // 6D10 LD VD, 0x10
+    STEP(0x20E, 0x6D10);
+    V[13] = 0x10;
+L210: // A268 LD I, 0x268
+    STEP(0x210, 0xA268);
+    c->I = 0x268;
+L212: // 222E CALL 0x22E
+    STEP(0x212, 0x222E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x212;
+    goto L22E;
+L214: // 6002 LD V0, 0x02
+    STEP(0x214, 0x6002);
+    V[0] = 0x02;
+L216: // E0A1 SKNP V0
+    STEP(0x216, 0xE0A1);
+    c->pc = 0x216;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x218) goto dispatch;
+L218: // 2244 CALL 0x244
+    STEP(0x218, 0x2244);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x218;
+    goto L244;
+L21A: // 6008 LD V0, 0x08
+    STEP(0x21A, 0x6008);
+    V[0] = 0x08;
+L21C: // E0A1 SKNP V0
+    STEP(0x21C, 0xE0A1);
+    c->pc = 0x21C;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x21E) goto dispatch;
+L21E: // 2238 CALL 0x238
+    STEP(0x21E, 0x2238);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x21E;
+    goto L238;
+L220: // 6004 LD V0, 0x04
+    STEP(0x220, 0x6004);
+    V[0] = 0x04;
+L222: // E0A1 SKNP V0
+    STEP(0x222, 0xE0A1);
+    c->pc = 0x222;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x224) goto dispatch;
+L224: // 2250 CALL 0x250
+    STEP(0x224, 0x2250);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x224;
+    goto L250;
+L226: // 6006 LD V0, 0x06
+    STEP(0x226, 0x6006);
+    V[0] = 0x06;
+L228: // E0A1 SKNP V0
+    STEP(0x228, 0xE0A1);
+    c->pc = 0x228;
+    predecode(0xE0A1, &in);
+    execute(c, &in);
+    if (c->pc != 0x22A) goto dispatch;
+L22A: // 225C CALL 0x25C
+    STEP(0x22A, 0x225C);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x22A;
+    goto L25C;
+L22C: // 1214 JP 0x214
+    STEP(0x22C, 0x1214);
+    goto L214;
+L22E: // D671 DRW V6, V7, 1
+    STEP(0x22E, 0xD671);
+    c->pc = 0x22E;
+    predecode(0xD671, &in);
+    execute(c, &in);
+    if (c->pc != 0x230) goto dispatch;
+L230: // D891 DRW V8, V9, 1
+    STEP(0x230, 0xD891);
+    c->pc = 0x230;
+    predecode(0xD891, &in);
+    execute(c, &in);
+    if (c->pc != 0x232) goto dispatch;
+L232: // DAB1 DRW VA, VB, 1
+    STEP(0x232, 0xDAB1);
+    c->pc = 0x232;
+    predecode(0xDAB1, &in);
+    execute(c, &in);
+    if (c->pc != 0x234) goto dispatch;
+L234: // DCD1 DRW VC, VD, 1
+    STEP(0x234, 0xDCD1);
+    c->pc = 0x234;
+    predecode(0xDCD1, &in);
+    execute(c, &in);
+    if (c->pc != 0x236) goto dispatch;
+L236: // 00EE RET
+    STEP(0x236, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L238: // 77FF ADD V7, 0xFF
+    STEP(0x238, 0x77FF);
+    V[7] += 0xFF;
+L23A: // 79FF ADD V9, 0xFF
+    STEP(0x23A, 0x79FF);
+    V[9] += 0xFF;
+L23C: // 7B01 ADD VB, 0x01
+    STEP(0x23C, 0x7B01);
+    V[11] += 0x01;
+L23E: // 7D01 ADD VD, 0x01
+    STEP(0x23E, 0x7D01);
+    V[13] += 0x01;
+L240: // 222E CALL 0x22E
+    STEP(0x240, 0x222E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x240;
+    goto L22E;
+L242: // 00EE RET
+    STEP(0x242, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L244: // 7701 ADD V7, 0x01
+    STEP(0x244, 0x7701);
+    V[7] += 0x01;
+L246: // 7901 ADD V9, 0x01
+    STEP(0x246, 0x7901);
+    V[9] += 0x01;
+L248: // 7BFF ADD VB, 0xFF
+    STEP(0x248, 0x7BFF);
+    V[11] += 0xFF;
+L24A: // 7DFF ADD VD, 0xFF
+    STEP(0x24A, 0x7DFF);
+    V[13] += 0xFF;
+L24C: // 222E CALL 0x22E
+    STEP(0x24C, 0x222E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x24C;
+    goto L22E;
+L24E: // 00EE RET
+    STEP(0x24E, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L250: // 76FF ADD V6, 0xFF
+    STEP(0x250, 0x76FF);
+    V[6] += 0xFF;
+L252: // 7801 ADD V8, 0x01
+    STEP(0x252, 0x7801);
+    V[8] += 0x01;
+L254: // 7AFF ADD VA, 0xFF
+    STEP(0x254, 0x7AFF);
+    V[10] += 0xFF;
+L256: // 7C01 ADD VC, 0x01
+    STEP(0x256, 0x7C01);
+    V[12] += 0x01;
+L258: // 222E CALL 0x22E
+    STEP(0x258, 0x222E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x258;
+    goto L22E;
+L25A: // 00EE RET
+    STEP(0x25A, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+L25C: // 7601 ADD V6, 0x01
+    STEP(0x25C, 0x7601);
+    V[6] += 0x01;
+L25E: // 78FF ADD V8, 0xFF
+    STEP(0x25E, 0x78FF);
+    V[8] += 0xFF;
+L260: // 7A01 ADD VA, 0x01
+    STEP(0x260, 0x7A01);
+    V[10] += 0x01;
+L262: // 7CFF ADD VC, 0xFF
+    STEP(0x262, 0x7CFF);
+    V[12] += 0xFF;
+L264: // 222E CALL 0x22E
+    STEP(0x264, 0x222E);
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = 0x264;
+    goto L22E;
+L266: // 00EE RET
+    STEP(0x266, 0x00EE);
+    c->pc = c->stack[c->sp] + 2;
+    c->sp = (c->sp - 1) & 0xF;
+    goto dispatch;
+}
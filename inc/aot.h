@@ -0,0 +1,43 @@
+#ifndef CHIP8_AOT_H_
+#define CHIP8_AOT_H_
+
+#include <stddef.h>
+
+#include "chip8.h"
+
+/*
+ * Ahead-of-time recompiler:
+ *
+ * chip8-aot turns a rom into a C translation unit defining the symbols
+ * below, to be linked against the core. Starting from 0x200, it follows
+ * jumps, calls, returns and skips to find every instruction reachable
+ * without a computed jump (the entries of BNNN jump tables made of 1NNN
+ * included) and gives each one a label: register arithmetic, loads, jumps,
+ * calls and skips become straight C, falling through from one instruction
+ * to the next; everything else (draws, keys, random numbers, stores...)
+ * calls the core's handler for it.
+ *
+ * aot_run() runs up to cycles instructions and returns how many it ran:
+ * fewer when it reaches FX0A with no key down, where the interpreter would
+ * spin for the rest of the budget without changing the machine.
+ *
+ * It enters the code at the label of c->pc through a switch, and
+ * goes back to it after returns, computed jumps and handlers that moved
+ * pc elsewhere. Whatever has no label is interpreted one instruction at a
+ * time until pc lands on a label again.
+ *
+ * Self-modifying code: while none of the 64-byte blocks holding compiled
+ * instructions is marked in mem_dirty, every instruction runs as compiled;
+ * once one is, every compiled instruction first checks its opcode in
+ * memory and is interpreted if it changed. Instruction tracing and the
+ * profiler don't see compiled instructions, and XO-CHIP machines are
+ * simply interpreted.
+ * */
+
+// the rom the code was compiled from
+extern const unsigned char aot_rom[];
+extern const size_t aot_rom_size;
+
+unsigned long aot_run(chip8_t* c, unsigned long cycles);
+
+#endif
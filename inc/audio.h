@@ -0,0 +1,70 @@
+#ifndef CHIP8_AUDIO_H_
+#define CHIP8_AUDIO_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+/*
+ * Audio:
+ *
+ * The buzzer is a square wave, generated one 60hz frame at a time from
+ * sound_flag (see tick_timers) and handed to a sink. An XO-CHIP rom may
+ * load a pattern of 128 1-bit samples instead, looped at 4000 samples per
+ * second shifted by the pitch (64 is no shift, 48 is an octave).
+ *
+ *
+ * - AUDIO_NULL drops the samples, nothing to set up (headless runs),
+ * - AUDIO_WAV appends them to a WAV file,
+ * - AUDIO_RING pushes them into a single-producer single-consumer ring that
+ *   the SDL audio callback drains (see init_audio in peripherals.c).
+ *
+ * The ring is lock-free: the emulation thread only ever moves the head and
+ * the audio thread only the tail, so neither waits for the other. A full
+ * ring drops the newest samples (fast-forward), an empty one plays silence.
+ *
+ * Mono, signed 16-bit, AUDIO_RATE samples per second.
+ * */
+#define AUDIO_RATE 44100
+#define AUDIO_TONE 440
+#define AUDIO_VOLUME 3000
+
+// about 93ms at 44.1khz, a power of two
+#define AUDIO_RING_SIZE 4096
+
+// samples per 60hz frame
+#define AUDIO_FRAME (AUDIO_RATE / 60)
+
+enum audio_sink { AUDIO_NULL, AUDIO_WAV, AUDIO_RING };
+
+struct audio_ring {
+    int16_t samples[AUDIO_RING_SIZE];
+    // free-running counters, written by the producer and consumer only
+    uint32_t head;
+    uint32_t tail;
+};
+
+struct audio {
+    enum audio_sink sink;
+    struct audio_ring ring;
+    FILE* wav;
+    // square wave phase, 32-bit fixed point fraction of a period
+    uint32_t phase;
+    // position in the pattern, 7.25 fixed point so it wraps at 128 bits
+    uint32_t pattern_pos;
+    // samples generated so far
+    uint64_t samples;
+    // samples the ring had no room for
+    uint64_t dropped;
+};
+
+void audio_init(struct audio* a, enum audio_sink sink);
+int audio_open_wav(struct audio* a, const char* filename);
+void audio_frame(struct audio* a, int sound, const unsigned char* pattern,
+                 int pitch);
+int audio_close(struct audio* a);
+
+uint32_t ring_push(struct audio_ring* ring, const int16_t* samples,
+                   uint32_t n);
+uint32_t ring_pop(struct audio_ring* ring, int16_t* samples, uint32_t n);
+
+#endif
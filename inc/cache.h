@@ -0,0 +1,38 @@
+#ifndef CHIP8_CACHE_H_
+#define CHIP8_CACHE_H_
+
+#include "chip8.h"
+
+/*
+ * Basic-block cache:
+ *
+ * Roms are tiny and mostly static, so instead of fetching and decoding the
+ * instruction at pc on every cycle, straight-line runs of code are decoded
+ * once into basic blocks (ending at jumps, skips, calls, returns, draws and
+ * key waits) and then replayed from the cache.
+ *
+ * Writes into memory that holds cached code (FX33, FX55, a new rom) drop
+ * the cache, so self-modifying roms keep working.
+ * */
+struct block_cache {
+    // decoded instruction at each address
+    insn_t code[4096];
+
+    // number of instructions of the block starting at each address, 0 if
+    // no block has been built there yet
+    unsigned char len[4096];
+
+    // one bit per memory byte covered by a decoded instruction
+    unsigned long long cached[4096 / 64];
+
+    // bumped on every flush, lets a running block notice it went stale
+    unsigned int generation;
+};
+
+int cache_attach(chip8_t* c);
+void cache_detach(chip8_t* c);
+void cache_invalidate(struct block_cache* cache, unsigned short addr,
+                      unsigned short len);
+unsigned long run_blocks(chip8_t* c, unsigned long cycles);
+
+#endif
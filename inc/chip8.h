@@ -1,24 +1,157 @@
 #ifndef CHIP8_H_
 #define CHIP8_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
 extern unsigned char fontset[80];
-extern unsigned char memory[4096];
-extern unsigned char V[16];
-extern unsigned short I;
-extern unsigned short pc;
-extern unsigned char sp;
-extern unsigned short stack[16];
-extern unsigned char keypad[16];
-extern unsigned char display[64 * 32];
-extern unsigned char dt;
-extern unsigned char st;
-extern unsigned char draw_flag;
-extern unsigned char sound_flag;
-
-void init_cpu(void);
-int load_rom(char* filename);
-void emulate_cycle(void);
-
-#define error(...) fprintf(stderr, __VA_ARGS__) 
+extern unsigned char bigfontset[160];
+
+struct block_cache;
+struct jit;
+struct trace;
+struct profile;
+
+/*
+ * Modes:
+ *
+ * MODE_CHIP8 is the original instruction set on a 64x32 display. MODE_SCHIP
+ * adds SUPER-CHIP 1.1: the 128x64 hires display, scrolling, 16x16 sprites,
+ * the big font and the flag registers. MODE_XOCHIP adds XO-CHIP on top: 64K
+ * of memory, two bitplanes, 4-byte long loads, register ranges and audio
+ * patterns. Opcodes a mode doesn't know behave exactly as they always did.
+ * */
+#define MODE_CHIP8 0
+#define MODE_SCHIP 1
+#define MODE_XOCHIP 2
+
+#define DISPLAY_PLANES 2
+#define DISPLAY_WORDS 128
+
+// memory is tracked for changes in blocks of this many bytes
+#define DIRTY_BLOCK 64
+#define DIRTY_WORDS (65536 / DIRTY_BLOCK / 64)
+
+/*
+ * chip8_t: the whole state of one CHIP-8 machine.
+ *
+ * Nothing lives in globals, so any number of machines can be created and
+ * stepped independently (even from different threads).
+ *
+ * The registers touched by every single instruction (pc, I, sp, V and the
+ * memory mask) are kept at the front of the struct, which is aligned to a
+ * 64-byte cache line, so they all share one line; the bulky memory and
+ * display come last.
+ * */
+typedef struct chip8 {
+    unsigned short pc;
+    unsigned short I;
+    unsigned char sp;
+    unsigned char dt;
+    unsigned char st;
+    unsigned char draw_flag;
+    unsigned char V[16];
+    unsigned char sound_flag;
+
+    // addresses wrap around memory: 0xFFF, 0xFFFF for XO-CHIP
+    unsigned short mem_mask;
+    // MODE_CHIP8, MODE_SCHIP or MODE_XOCHIP, see set_mode()
+    unsigned char mode;
+    // 128x64 instead of 64x32 (00FF / 00FE)
+    unsigned char hires;
+    // bit n set when DXYN, 00E0 and scrolling act on plane n (FN01)
+    unsigned char planes;
+
+    unsigned short stack[16];
+    // bit n set while key n is down
+    uint16_t keypad;
+
+    // xorshift32 state behind CXNN, never 0
+    uint32_t rng;
+
+    // SCHIP flag registers (FX75 / FX85)
+    unsigned char flags[16];
+
+    // XO-CHIP audio: 128 1-bit samples (F002), played at a rate set by
+    // the pitch (FX3A), instead of the plain buzzer once loaded
+    unsigned char pattern[16];
+    unsigned char pitch;
+    unsigned char has_pattern;
+
+    // what changed since whoever watches it last cleared these (reset
+    // does): bit b % 64 of mem_dirty[b / 64] for block b of memory (see
+    // dirty_memory), bit y of fb_dirty for row y of the display, all of
+    // them when it is cleared, scrolled or changes resolution
+    uint64_t mem_dirty[DIRTY_WORDS];
+    uint64_t fb_dirty;
+
+    // 4K, all 64K of it in XO-CHIP mode only
+    unsigned char memory[65536];
+
+    // bitplanes of 64-bit words, column 0 in the most significant bit:
+    // row y is word y in lores (64x32), words 2y and 2y+1 in hires (128x64)
+    uint64_t display[DISPLAY_PLANES][DISPLAY_WORDS];
+
+    // optional decoded-instruction cache, see cache.h (NULL when unused)
+    struct block_cache* cache;
+
+    // optional native code translator, see jit.h (NULL when unused)
+    struct jit* jit;
+
+    // optional instruction trace ring, see trace.h (NULL when unused)
+    struct trace* trace;
+
+    // optional per-opcode and per-address counters, see profile.h (NULL
+    // when unused)
+    struct profile* profile;
+} __attribute__((aligned(64))) chip8_t;
+
+/*
+ * insn_t: a decoded instruction.
+ *
+ * The operands are extracted once, and fn is the handler implementing the
+ * opcode, so executing a decoded instruction skips fetch and decode.
+ * */
+typedef struct insn insn_t;
+typedef void (*handler_t)(chip8_t* c, const insn_t* in);
+
+struct insn {
+    handler_t fn;
+    unsigned short op;
+    unsigned short nnn;
+    unsigned char x;
+    unsigned char y;
+    unsigned char n;
+    unsigned char nn;
+};
+
+void init_cpu(chip8_t* c);
+int load_rom(chip8_t* c, char* filename);
+void boot_image(chip8_t* c, const unsigned char* image);
+void make_image(unsigned char* image, const unsigned char* rom, size_t size);
+void set_mode(chip8_t* c, int mode);
+int parse_mode(const char* name);
+void emulate_cycle(chip8_t* c);
+void tick_timers(chip8_t* c);
+void seed_random(chip8_t* c, uint32_t seed);
+int is_idle(const chip8_t* c);
+unsigned long skip_idle(chip8_t* c, unsigned long cycles);
+
+// the timers always tick at 60hz, the cpu runs this many instructions in
+// between by default (600hz)
+#define DEFAULT_IPF 10
+
+// the two dispatch engines behind emulate_cycle, exposed for benchmarking
+void emulate_cycle_switch(chip8_t* c);
+void emulate_cycle_table(chip8_t* c);
+
+void dirty_memory(chip8_t* c, size_t addr, size_t len);
+
+void predecode(unsigned short op, insn_t* in);
+void execute(chip8_t* c, const insn_t* in);
+
+unsigned long long hash_display(const chip8_t* c);
+
+#define error(...) fprintf(stderr, __VA_ARGS__)
 
 #endif
@@ -0,0 +1,16 @@
+#ifndef CHIP8_DISASM_H_
+#define CHIP8_DISASM_H_
+
+#include <stddef.h>
+
+/*
+ * Disassembler:
+ *
+ * Mnemonics in the style of Cowgod's reference, shared by the trace decoder
+ * and the recompiler, with the SCHIP and XO-CHIP additions named the way
+ * their references do (SCD, HIGH, PLANE...). Opcodes are read the way the
+ * interpreter decodes them, anything it doesn't run is "???".
+ * */
+void disasm(unsigned short op, char* buf, size_t size);
+
+#endif
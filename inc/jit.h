@@ -0,0 +1,27 @@
+#ifndef CHIP8_JIT_H_
+#define CHIP8_JIT_H_
+
+#include "chip8.h"
+
+/*
+ * x86-64 JIT:
+ *
+ * Hot runs of pure register arithmetic (6XNN, 7XNN, 8XYn, ANNN, FX07,
+ * FX1E, FX29), optionally closed by a jump or a skip, are translated into
+ * native code in an mmap'd buffer and called directly. The buffer is
+ * never writable and executable at once: the pages a block goes to are
+ * made writable while it is emitted, then executable again.
+ * Everything else (draws, key waits, timer writes, memory stores, calls...)
+ * is left to the interpreter.
+ *
+ * Writes into translated code (FX33, FX55, a new rom) throw every
+ * translation away. On other architectures jit_attach() fails and callers
+ * are expected to stick to the interpreter.
+ * */
+
+int jit_attach(chip8_t* c);
+void jit_detach(chip8_t* c);
+void jit_invalidate(struct jit* jit, unsigned short addr, unsigned short len);
+unsigned long run_jit(chip8_t* c, unsigned long cycles);
+
+#endif
@@ -0,0 +1,77 @@
+#ifndef CHIP8_LOCKSTEP_H_
+#define CHIP8_LOCKSTEP_H_
+
+#include "chip8.h"
+
+/*
+ * Lockstep engine:
+ *
+ * Steps up to LOCKSTEP_LANES copies of the same rom at once (e.g. the same
+ * game fed different key sequences). The registers of every lane are kept
+ * in structure-of-arrays form, one vector of lanes per V register and one
+ * each for I and pc, so register arithmetic, loads, jumps and skips run on
+ * all the lanes with a single vector operation (SSE2 on x86-64, AVX2 when
+ * built with -mavx2).
+ *
+ * Every round each lane runs one instruction. The lanes sitting at the same
+ * pc (with the same instruction there) form a group that runs together,
+ * under a mask, so identical lanes cost one decode and one vector operation.
+ * When most lanes have gone separate ways for a while, the engine parts
+ * them: each lane then runs as a plain machine on the switch engine, and
+ * every REGROUP_ROUNDS rounds their pcs are checked to see whether they
+ * met again. lockstep_run_frames() runs whole frames, so lanes apart can
+ * run several in a row each.
+ *
+ * Everything else (draws, calls, timers, keys, memory) runs per lane on the
+ * lane's own machine, with just the registers the instruction uses copied
+ * in and out. Every lane ends up exactly as if it had been run by
+ * emulate_cycle().
+ * */
+#define LOCKSTEP_LANES 16
+#define SPREAD_ROUNDS 16
+#define REGROUP_ROUNDS 256
+
+typedef unsigned char lanes8_t __attribute__((vector_size(LOCKSTEP_LANES)));
+typedef unsigned short lanes16_t
+    __attribute__((vector_size(2 * LOCKSTEP_LANES)));
+
+struct lockstep {
+    chip8_t* lane[LOCKSTEP_LANES];
+    int lanes;
+    // all ones in the lanes in use
+    lanes8_t active;
+
+    // the registers of every lane while together, the machines only get
+    // them back from lockstep_sync()
+    lanes8_t V[16];
+    lanes16_t I;
+    lanes16_t pc;
+
+    // one bit per memory byte some lane may have written, where the
+    // instruction has to be checked in every lane of a group
+    unsigned long long written[4096 / 64];
+
+    // whether the lanes run apart, on their machines' own registers
+    int apart;
+    // rounds in a row with the lanes spread out, or since the last check
+    // for meeting again while apart
+    unsigned int spread;
+
+    // groups run together, lane-instructions run apart
+    unsigned long long groups;
+    unsigned long long alone;
+};
+
+// called before every frame of a lane by lockstep_run_frames()
+typedef void (*lockstep_frame_fn)(chip8_t* c, int lane, unsigned long frame,
+                                  void* arg);
+
+struct lockstep* lockstep_create(chip8_t** machines, int lanes);
+void lockstep_destroy(struct lockstep* ls);
+unsigned long lockstep_run(struct lockstep* ls, unsigned long cycles);
+unsigned long lockstep_run_frames(struct lockstep* ls, unsigned long frames,
+                                  unsigned long ipf, lockstep_frame_fn before,
+                                  void* arg);
+void lockstep_sync(struct lockstep* ls);
+
+#endif
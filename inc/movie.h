@@ -0,0 +1,57 @@
+#ifndef CHIP8_MOVIE_H_
+#define CHIP8_MOVIE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chip8.h"
+
+/*
+ * Movies:
+ *
+ * A run is fully determined by the rom, the mode, the rng seed, the
+ * instructions per frame and the keypad state of every frame. A movie records the last one
+ * as runs of identical frames (players hold keys for many frames), next to
+ * the rest, so playing it back reproduces the run exactly, with or without
+ * a window.
+ *
+ * File: a header followed by the runs, each a LEB128 frame count and the
+ * 16-bit keypad mask (bit n set when key n is down), little-endian.
+ * */
+#define MOVIE_MAGIC "C8MV"
+#define MOVIE_VERSION 2
+
+struct movie_run {
+    uint32_t frames;
+    uint16_t keys;
+};
+
+struct movie {
+    uint32_t seed;
+    uint32_t ipf;
+    // MODE_CHIP8, MODE_SCHIP or MODE_XOCHIP
+    uint32_t mode;
+    // fingerprint of the memory the rom was loaded into
+    uint64_t rom_hash;
+    uint64_t frames;
+
+    struct movie_run* runs;
+    size_t nruns;
+    size_t capacity;
+
+    // playback position
+    size_t run;
+    uint32_t played;
+};
+
+uint64_t hash_memory(const chip8_t* c);
+
+void movie_init(struct movie* m, const chip8_t* c, uint32_t seed,
+                uint32_t ipf);
+int movie_record(struct movie* m, uint16_t keys);
+int movie_play(struct movie* m, uint16_t* keypad);
+int movie_save(const struct movie* m, const char* filename);
+int movie_load(struct movie* m, const char* filename);
+void movie_free(struct movie* m);
+
+#endif
@@ -1,9 +1,17 @@
 #ifndef CHIPEE_PERIPHERALS_H_
 #define CHIPEE_PERIPHERALS_H_
 
-void init_display();
-void draw(unsigned char* display);
-void sdl_ehandler(unsigned char* keypad);
+#include <stdint.h>
+
+#include "audio.h"
+
+int init_display(void);
+int run_display(int (*run)(void*), void* arg);
+void draw(const uint64_t* display, int hires, uint64_t rows);
+int set_keymap(const char* spec);
+void sdl_ehandler(uint16_t* keypad);
+void sdl_wait(uint16_t* keypad);
+int init_audio(struct audio_ring* ring);
 void stop_display();
 
 #endif
@@ -0,0 +1,43 @@
+#ifndef CHIP8_PROFILE_H_
+#define CHIP8_PROFILE_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "chip8.h"
+
+/*
+ * Profiler:
+ *
+ * Built with -DCHIP8_PROFILE, emulate_cycle() on a machine with a profile
+ * attached counts every instruction and the host time it took, both per
+ * opcode class (DXYN, FX0A...) and per address. The time is measured in
+ * ticks: the cpu timestamp counter on x86-64, nanoseconds elsewhere.
+ *
+ * profile_report() prints the classes sorted by time, the hottest
+ * addresses and a heatmap of the whole 4K. Profiled machines never run
+ * through the block cache or the jit, every instruction is interpreted.
+ *
+ * Without CHIP8_PROFILE nothing is instrumented.
+ * */
+#define PROFILE_CLASSES 51
+
+struct profile {
+    uint64_t class_count[PROFILE_CLASSES];
+    uint64_t class_ticks[PROFILE_CLASSES];
+    uint64_t addr_count[4096];
+    uint64_t addr_ticks[4096];
+};
+
+int profile_attach(chip8_t* c);
+void profile_detach(chip8_t* c);
+void profile_cycle(chip8_t* c);
+void profile_report(const chip8_t* c, FILE* fp);
+
+#ifdef CHIP8_PROFILE
+#define PROFILING(c) ((c)->profile != NULL)
+#else
+#define PROFILING(c) 0
+#endif
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef CHIP8_RECORDER_H_
+#define CHIP8_RECORDER_H_
+
+#include <stdint.h>
+
+#include "chip8.h"
+
+/*
+ * Frame recorder:
+ *
+ * Writes every presented frame of a run to a compact stream, for looking
+ * at a headless run afterwards (chip8-frames turns it into PNG files).
+ *
+ * The emulation thread only copies the rows of the display marked in
+ * fb_dirty into a bounded queue (recorder_push); an encoder thread of its
+ * own does everything else, so a frame costs the emulation loop a copy of
+ * at most 2K, nothing for rows that didn't change. A full queue makes the
+ * push wait instead of dropping the frame.
+ *
+ * A frame is the display as bytes: plane 0 then plane 1, the words of the
+ * current resolution only (64 rows of 16 bytes in hires, 32 of 8 in lores),
+ * each word most significant byte first so the bits read left to right.
+ * Every RECORDER_KEYFRAME frames, and whenever the resolution changes, it
+ * is a keyframe, stored as it is; any other frame is stored as its XOR with
+ * the previous one. Either way the bytes are run-length encoded as pairs of
+ * LEB128 counts, zero bytes skipped then bytes copied, followed by the
+ * copied bytes, until the rest of the frame is zero.
+ *
+ * File, little-endian: the magic and version (4 bytes each), then one
+ * record per frame:
+ *
+ * - flags (1 byte, RECORD_KEYFRAME and RECORD_HIRES),
+ * - the emulated frame it was presented at (LEB128),
+ * - the length of the run-length encoded bytes (LEB128) and the bytes.
+ *
+ * On close, an index of the keyframes (count, then frame and file offset of
+ * each, 8 bytes apiece) follows, and a trailer: the offset of the index (8
+ * bytes) and RECORDER_TRAILER. A stream cut short has no trailer; a reader
+ * can still walk the records from the start.
+ * */
+#define RECORDER_MAGIC "C8FS"
+#define RECORDER_VERSION 1
+#define RECORDER_TRAILER "C8FI"
+
+#define RECORD_KEYFRAME 1
+#define RECORD_HIRES 2
+
+// frames between two keyframes, a few seconds of play
+#define RECORDER_KEYFRAME 256
+// frames waiting for the encoder
+#define RECORDER_QUEUE 64
+// frames waiting before the encoder is woken up
+#define RECORDER_BATCH (RECORDER_QUEUE / 2)
+
+// the bytes of a frame, see above
+#define FRAME_BYTES(hires) (DISPLAY_PLANES * ((hires) ? 128 : 32) * 8)
+
+struct recorder;
+
+struct recorder* recorder_open(const char* filename);
+int recorder_push(struct recorder* r, const chip8_t* c, uint64_t frame);
+int recorder_close(struct recorder* r);
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef CHIP8_ROMLIB_H_
+#define CHIP8_ROMLIB_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chip8.h"
+
+/*
+ * Rom library:
+ *
+ * Loads a whole set of roms at once, from a directory (its .ch8 files) or
+ * from a single pack file, by memory-mapping them. Every rom is turned into
+ * the 4K memory image it boots from (fonts included), so starting a machine
+ * on it is a single copy (see boot_image), and is indexed by the FNV-1a
+ * hash of its content.
+ *
+ * Pack file: "C8PK", then the number of roms (32 bits) and for each rom
+ * the length of its name and its size (16 bits each), the name and the
+ * rom itself. Everything is little-endian.
+ * */
+#define PACK_MAGIC "C8PK"
+
+// roms are loaded at 0x200 and can't go past the end of the 4K image, so
+// XO-CHIP roms that need more memory are refused with a message saying so
+#define ROM_MAX (4096 - 0x200)
+
+struct rom {
+    char* name;
+    uint64_t hash;
+    size_t size;
+    // 4K, 64-byte aligned
+    unsigned char* image;
+};
+
+struct rom_library {
+    struct rom* roms;
+    size_t count;
+    // indices of roms sorted by hash
+    size_t* by_hash;
+};
+
+int romlib_add(struct rom_library* lib, const char* path);
+void romlib_index(struct rom_library* lib);
+const struct rom* romlib_find(const struct rom_library* lib, uint64_t hash);
+int romlib_write_pack(const struct rom_library* lib, const char* filename);
+void romlib_free(struct rom_library* lib);
+
+#endif
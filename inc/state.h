@@ -0,0 +1,84 @@
+#ifndef CHIP8_STATE_H_
+#define CHIP8_STATE_H_
+
+#include <stddef.h>
+
+#include "chip8.h"
+
+/*
+ * Save states:
+ *
+ * A snapshot is the whole machine (registers, stack, timers, rng, memory
+ * and display) serialized field by field, little-endian, behind a magic and
+ * a version number, so it doesn't depend on the struct layout nor on the
+ * host. The keypad is input, not state, and isn't saved.
+ *
+ * The size of a snapshot only depends on the mode of the machine (see
+ * set_mode), STATE_SIZE(4096) bytes (about 6.3K) except in XO-CHIP mode,
+ * which has 64K of memory. A snapshot only loads into a machine of the
+ * same mode.
+ * */
+#define STATE_MAGIC "C8ST"
+#define STATE_VERSION 2
+
+#define STATE_SIZE(memory)                                              \
+    (4 + 2 + 4 + /* magic, version, size */                             \
+     2 + 2 + 1 + 1 + 1 + 1 + 1 + /* pc, I, sp, dt, st, draw, sound */ \
+     1 + 1 + 1 + /* mode, hires, planes */                              \
+     16 + 16 * 2 + 4 + 16 + /* V, stack, rng, flags */                  \
+     16 + 1 + 1 + /* audio pattern, pitch, has_pattern */               \
+     (memory) + DISPLAY_PLANES * DISPLAY_WORDS * 8 /* memory, display */)
+
+size_t state_size(const chip8_t* c);
+size_t save_state(const chip8_t* c, unsigned char* buf);
+int load_state(chip8_t* c, const unsigned char* buf);
+int save_state_file(const chip8_t* c, const char* filename);
+int load_state_file(chip8_t* c, const char* filename);
+
+/*
+ * Rewind:
+ *
+ * Keeps the last frames snapshots (one per frame) in memory allocated once
+ * up front. Every KEYFRAME_INTERVAL-th snapshot is stored whole; the ones in
+ * between are stored as the XOR against their keyframe with the zero runs
+ * squeezed out, which for a typical frame is a few dozen bytes.
+ *
+ * Records live back to back in a circular arena; when it is full, the
+ * oldest keyframe is dropped together with all of its deltas.
+ * */
+#define KEYFRAME_INTERVAL 60
+
+struct rewind_entry {
+    size_t offset;
+    size_t len;
+    // sequence number of the keyframe this entry is a delta against, its
+    // own one for keyframes
+    unsigned long key;
+};
+
+struct rewind_ring {
+    // of every snapshot, see state_size()
+    size_t size;
+
+    unsigned char* arena;
+    size_t arena_size;
+    // where the next record goes
+    size_t top;
+
+    struct rewind_entry* entries;
+    unsigned long frames;
+    // sequence numbers of the oldest and one past the newest entry
+    unsigned long first;
+    unsigned long last;
+
+    // scratch space for encoding and decoding, size bytes each
+    unsigned char* state;
+    unsigned char* delta;
+};
+
+struct rewind_ring* rewind_create(unsigned long frames, size_t size);
+void rewind_destroy(struct rewind_ring* r);
+void rewind_push(struct rewind_ring* r, const chip8_t* c);
+int rewind_pop(struct rewind_ring* r, chip8_t* c);
+
+#endif
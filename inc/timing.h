@@ -0,0 +1,23 @@
+#ifndef CHIP8_TIMING_H_
+#define CHIP8_TIMING_H_
+
+#include <time.h>
+
+/*
+ * Frame clock:
+ *
+ * Paces the main loop at 60 frames per second by sleeping until an absolute
+ * deadline, so oversleeping one frame is made up on the next one instead
+ * of accumulating drift.
+ * */
+struct frame_clock {
+    struct timespec deadline;
+};
+
+#define FRAME_NS (1000000000L / 60)
+
+void frame_clock_start(struct frame_clock* clock);
+void frame_clock_wait(struct frame_clock* clock);
+int frame_clock_due(const struct frame_clock* clock);
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef CHIP8_TRACE_H_
+#define CHIP8_TRACE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "chip8.h"
+
+/*
+ * Instruction tracing:
+ *
+ * Built with -DCHIP8_TRACE, every instruction about to run on a machine
+ * with a trace attached is appended to a ring buffer as a fixed-size
+ * binary entry, overwriting the oldest ones once the ring is full. Nothing
+ * is formatted while the machine runs: trace_dump() writes the ring to a
+ * file and chip8-trace decodes it offline.
+ *
+ * The ring has a single writer (the thread stepping the machine) and is
+ * lock-free: the writer fills a slot, then publishes it by bumping head,
+ * so a dump may run from another thread while the machine keeps going.
+ *
+ * Without CHIP8_TRACE the hooks compile to nothing.
+ * */
+struct trace_entry {
+    uint64_t cycle;
+    uint16_t pc;
+    uint16_t op;
+    uint16_t I;
+    uint8_t sp;
+    uint8_t dt;
+    uint8_t V[16];
+};
+
+struct trace {
+    // number of entries ever written, the next one goes to head & mask
+    uint64_t head;
+    uint64_t mask;
+    struct trace_entry ring[];
+};
+
+/*
+ * Dump file: this header followed by count entries, oldest first, in host
+ * byte order.
+ * */
+struct trace_header {
+    char magic[4];
+    uint32_t version;
+    uint32_t entry_size;
+    uint32_t reserved;
+    uint64_t count;
+};
+
+#define TRACE_MAGIC "C8TR"
+#define TRACE_VERSION 1
+#define TRACE_DEFAULT_ENTRIES (1UL << 16)
+
+int trace_attach(chip8_t* c, unsigned long entries);
+void trace_detach(chip8_t* c);
+void trace_record(chip8_t* c, unsigned short op);
+int trace_dump(const struct trace* trace, const char* filename);
+
+#ifdef CHIP8_TRACE
+#define TRACE(c, op)                             \
+    do {                                         \
+        if ((c)->trace) trace_record((c), (op)); \
+    } while (0)
+#define TRACING(c) ((c)->trace != NULL)
+#else
+#define TRACE(c, op) \
+    do {             \
+    } while (0)
+#define TRACING(c) 0
+#endif
+
+#endif
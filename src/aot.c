@@ -0,0 +1,449 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "chip8.h"
+#include "disasm.h"
+#include "romlib.h"
+
+/*
+ * Static recompiler:
+ *
+ * Reads a rom, recovers the instructions reachable from 0x200 and writes
+ * them out as a C translation unit defining aot_run() (see aot.h for what
+ * the generated code does at run time).
+ *
+ * Every reachable instruction gets a label named after its address and
+ * the labels are written in address order, so a straight run of code
+ * falls through from one to the next. Instructions at odd addresses are
+ * fine: they just get labels of their own.
+ * */
+
+static unsigned char rom[ROM_MAX];
+static size_t rom_size;
+
+// instructions found, with the addresses still to explore
+static unsigned char reached[4096];
+static unsigned short work[4096];
+static int top;
+
+/**
+ * opcode_at: the opcode at an address of the rom
+ * @param a the address, see compilable
+ * @return the opcode
+ * */
+static unsigned short opcode_at(unsigned int a) {
+    return rom[a - 0x200] << 8 | rom[a + 1 - 0x200];
+}
+
+// both bytes of an instruction have to be rom
+static int compilable(unsigned int a) {
+    return a >= 0x200 && a + 1 < 0x200 + rom_size;
+}
+
+static void reach(unsigned int a) {
+    if (!compilable(a) || reached[a]) return;
+
+    reached[a] = 1;
+    work[top++] = a;
+}
+
+/**
+ * explore: find every instruction reachable from 0x200
+ * @param void
+ * @return void
+ *
+ * Skips may land on both the next instruction and the one after it, calls
+ * come back to the next one; returns and computed jumps go wherever the
+ * stack or V0 says, which only shows at run time. BNNN is usually followed
+ * by a table of jumps though, so the jumps from NNN on are entries as well.
+ * */
+static void explore(void) {
+    reach(0x200);
+
+    while (top > 0) {
+        unsigned int a = work[--top];
+        unsigned short op = opcode_at(a);
+        unsigned int nnn = op & 0x0FFF;
+
+        switch (op & 0xF000) {
+            case 0x1000:
+                reach(nnn);
+                break;
+            case 0x2000:
+                reach(nnn);
+                reach(a + 2);
+                break;
+            case 0x3000:
+            case 0x4000:
+            case 0x5000:
+            case 0x9000:
+            case 0xE000:
+                reach(a + 2);
+                reach(a + 4);
+                break;
+            case 0xB000:
+                for (unsigned int t = nnn; t < nnn + 256 && compilable(t) &&
+                                           (opcode_at(t) & 0xF000) == 0x1000;
+                     t += 2) {
+                    reach(t);
+                }
+                break;
+            default:
+                if (op != 0x00EE) reach(a + 2);
+        }
+    }
+}
+
+/**
+ * inlined: whether an instruction is written as straight C
+ * @param op the opcode
+ * @return 1 if so, 0 if it calls its handler
+ *
+ * Only instructions that behave the same in every mode but XO-CHIP (which
+ * compiled code doesn't run) are inlined.
+ * */
+static int inlined(unsigned short op) {
+    switch (op & 0xF000) {
+        case 0x0000:
+            return op == 0x00EE;
+        case 0x5000:
+        case 0x9000:
+            return (op & 0xF) == 0;
+        case 0x8000:
+            return (op & 0xF) <= 7 || (op & 0xF) == 0xE;
+        case 0xC000:
+        case 0xD000:
+        case 0xE000:
+            return 0;
+        case 0xF000:
+            switch (op & 0xFF) {
+                case 0x07:
+                case 0x0A:
+                case 0x15:
+                case 0x18:
+                case 0x1E:
+                case 0x29:
+                case 0x65:
+                    return 1;
+            }
+            return 0;
+    }
+
+    return 1;
+}
+
+// instructions that may write memory, compiled code included
+static int stores(unsigned short op) {
+    return (op & 0xF0FF) == 0xF033 || (op & 0xF0FF) == 0xF055 ||
+           (op & 0xF00F) == 0x5002;
+}
+
+/**
+ * go: the statement continuing at an address
+ * @param a the address
+ * @return a goto to its label, or through the dispatch if it has none
+ * */
+static const char* go(unsigned int a) {
+    static char buf[64];
+
+    if (a < 4096 && reached[a]) {
+        snprintf(buf, sizeof(buf), "goto L%03X;", a);
+    } else {
+        snprintf(buf, sizeof(buf), "{ c->pc = 0x%03X; goto dispatch; }", a);
+    }
+    return buf;
+}
+
+/**
+ * emit: write out the code of an instruction
+ * @param out the output
+ * @param a its address
+ * @return void
+ * */
+static void emit(FILE* out, unsigned int a) {
+    unsigned short op = opcode_at(a);
+    unsigned int x = (op >> 8) & 0xF;
+    unsigned int y = (op >> 4) & 0xF;
+    unsigned int nn = op & 0xFF;
+    unsigned int nnn = op & 0x0FFF;
+    char text[32];
+
+    disasm(op, text, sizeof(text));
+    fprintf(out, "L%03X: // %04X %s\n", a, op, text);
+    fprintf(out, "    STEP(0x%03X, 0x%04X);\n", a, op);
+
+    if (!inlined(op)) {
+        fprintf(out, "    c->pc = 0x%03X;\n", a);
+        fprintf(out, "    predecode(0x%04X, &in);\n", op);
+        fprintf(out, "    execute(c, &in);\n");
+        if (stores(op)) fprintf(out, "    tainted = TAINTED();\n");
+        fprintf(out, "    if (c->pc != 0x%03X) goto dispatch;\n", a + 2);
+    } else {
+        switch (op & 0xF000) {
+            case 0x0000:
+                // 00EE
+                fprintf(out, "    c->pc = c->stack[c->sp] + 2;\n");
+                fprintf(out, "    c->sp = (c->sp - 1) & 0xF;\n");
+                fprintf(out, "    goto dispatch;\n");
+                return;
+            case 0x2000:
+                fprintf(out, "    c->sp = (c->sp + 1) & 0xF;\n");
+                fprintf(out, "    c->stack[c->sp] = 0x%03X;\n", a);
+                // fall through
+            case 0x1000:
+                fprintf(out, "    %s\n", go(nnn));
+                return;
+            case 0x3000:
+                fprintf(out, "    if (V[%u] == 0x%02X) %s\n", x, nn, go(a + 4));
+                break;
+            case 0x4000:
+                fprintf(out, "    if (V[%u] != 0x%02X) %s\n", x, nn, go(a + 4));
+                break;
+            case 0x5000:
+                fprintf(out, "    if (V[%u] == V[%u]) %s\n", x, y, go(a + 4));
+                break;
+            case 0x9000:
+                fprintf(out, "    if (V[%u] != V[%u]) %s\n", x, y, go(a + 4));
+                break;
+            case 0x6000:
+                fprintf(out, "    V[%u] = 0x%02X;\n", x, nn);
+                break;
+            case 0x7000:
+                fprintf(out, "    V[%u] += 0x%02X;\n", x, nn);
+                break;
+            case 0x8000:
+                // VF first, as the handlers do, it may be Vx or Vy
+                switch (op & 0xF) {
+                    case 0x0:
+                        fprintf(out, "    V[%u] = V[%u];\n", x, y);
+                        break;
+                    case 0x1:
+                        fprintf(out, "    V[%u] |= V[%u];\n", x, y);
+                        break;
+                    case 0x2:
+                        fprintf(out, "    V[%u] &= V[%u];\n", x, y);
+                        break;
+                    case 0x3:
+                        fprintf(out, "    V[%u] ^= V[%u];\n", x, y);
+                        break;
+                    case 0x4:
+                        fprintf(out, "    V[15] = V[%u] + V[%u] > 0xFF;\n", x, y);
+                        fprintf(out, "    V[%u] += V[%u];\n", x, y);
+                        break;
+                    case 0x5:
+                        fprintf(out, "    V[15] = V[%u] > V[%u];\n", x, y);
+                        fprintf(out, "    V[%u] -= V[%u];\n", x, y);
+                        break;
+                    case 0x6:
+                        fprintf(out, "    V[15] = V[%u] & 1;\n", x);
+                        fprintf(out, "    V[%u] >>= 1;\n", x);
+                        break;
+                    case 0x7:
+                        fprintf(out, "    V[15] = V[%u] > V[%u];\n", y, x);
+                        fprintf(out, "    V[%u] = V[%u] - V[%u];\n", x, y, x);
+                        break;
+                    case 0xE:
+                        fprintf(out, "    V[15] = V[%u] >> 7;\n", x);
+                        fprintf(out, "    V[%u] <<= 1;\n", x);
+                        break;
+                }
+                break;
+            case 0xA000:
+                fprintf(out, "    c->I = 0x%03X;\n", nnn);
+                break;
+            case 0xB000:
+                fprintf(out, "    c->pc = 0x%03X + V[0];\n", nnn);
+                fprintf(out, "    goto dispatch;\n");
+                return;
+            case 0xF000:
+                switch (nn) {
+                    case 0x07:
+                        fprintf(out, "    V[%u] = c->dt;\n", x);
+                        break;
+                    case 0x0A:
+                        // nothing can press a key before aot_run returns:
+                        // the interpreter would spin here for the rest of
+                        // the budget, which is left unused instead
+                        fprintf(out, "    if (c->keypad == 0) {\n");
+                        fprintf(out, "        c->pc = 0x%03X;\n", a);
+                        fprintf(out, "        return cycles - left;\n");
+                        fprintf(out, "    }\n");
+                        fprintf(out, "    V[%u] = __builtin_ctz(c->keypad);\n",
+                                x);
+                        break;
+                    case 0x15:
+                        fprintf(out, "    c->dt = V[%u];\n", x);
+                        break;
+                    case 0x18:
+                        fprintf(out, "    c->st = V[%u];\n", x);
+                        break;
+                    case 0x1E:
+                        fprintf(out, "    c->I += V[%u];\n", x);
+                        break;
+                    case 0x29:
+                        fprintf(out, "    c->I = V[%u] * 5;\n", x);
+                        break;
+                    case 0x65:
+                        fprintf(out, "    for (int i = 0; i <= %u; i++) {\n", x);
+                        fprintf(out, "        V[i] = c->memory[(c->I + i) & "
+                                     "c->mem_mask];\n");
+                        fprintf(out, "    }\n");
+                        break;
+                }
+                break;
+        }
+    }
+
+    // on to the next instruction, falling through if it is the next label
+    unsigned int next = a + 1;
+    while (next < 4096 && !reached[next]) next++;
+
+    if (next != a + 2 || !reached[a + 2]) fprintf(out, "    %s\n", go(a + 2));
+}
+
+/**
+ * write_code: write out the translation unit
+ * @param out the output
+ * @param name the rom, for the header comment
+ * @return void
+ * */
+static void write_code(FILE* out, const char* name) {
+    unsigned long long blocks = 0;
+    int handlers = 0;
+
+    for (unsigned int a = 0; a < 4096; a++) {
+        if (!reached[a]) continue;
+
+        blocks |= 1ULL << (a / DIRTY_BLOCK);
+        blocks |= 1ULL << ((a + 1) / DIRTY_BLOCK);
+        if (!inlined(opcode_at(a))) handlers = 1;
+    }
+
+    fprintf(out, "// generated by chip8-aot from %s, do not edit\n\n", name);
+    fprintf(out, "#include \"aot.h\"\n\n");
+
+    fprintf(out, "const unsigned char aot_rom[] = {");
+    for (size_t i = 0; i < rom_size; i++) {
+        fprintf(out, "%s0x%02X,", i % 12 ? " " : "\n    ", rom[i]);
+    }
+    fprintf(out, "\n};\nconst size_t aot_rom_size = %lu;\n\n",
+            (unsigned long)rom_size);
+
+    fprintf(out,
+            "// the 64-byte blocks holding compiled instructions\n"
+            "#define CODE_BLOCKS 0x%016llXULL\n"
+            "#define TAINTED() ((c->mem_dirty[0] & CODE_BLOCKS) != 0)\n"
+            "#define OPCODE(a) (c->memory[a] << 8 | c->memory[(a) + 1])\n\n"
+            "// takes an instruction from the budget, unless it ran out or "
+            "the\n// instruction changed in memory\n"
+            "#define STEP(a, op) \\\n"
+            "    do { \\\n"
+            "        if (left == 0 || (tainted && OPCODE(a) != (op))) { \\\n"
+            "            c->pc = (a); \\\n"
+            "            goto leave; \\\n"
+            "        } \\\n"
+            "        left--; \\\n"
+            "    } while (0)\n\n",
+            blocks);
+
+    fprintf(out, "unsigned long aot_run(chip8_t* c, unsigned long cycles) {\n");
+    fprintf(out, "    unsigned char* V = c->V;\n");
+    fprintf(out, "    unsigned long left = cycles;\n");
+    fprintf(out, "    int tainted = TAINTED();\n");
+    if (handlers) fprintf(out, "    insn_t in;\n");
+    fprintf(out, "\n    if (c->mode == MODE_XOCHIP) {\n");
+    fprintf(out, "        for (; left; left--) emulate_cycle(c);\n");
+    fprintf(out, "        return cycles;\n");
+    fprintf(out, "    }\n\n");
+
+    fprintf(out, "dispatch:\n");
+    fprintf(out, "    if (left == 0) return cycles;\n");
+    fprintf(out, "    switch (c->pc) {\n");
+    for (unsigned int a = 0; a < 4096; a++) {
+        if (reached[a]) fprintf(out, "        case 0x%03X: goto L%03X;\n", a, a);
+    }
+    fprintf(out, "    }\n\n");
+
+    fprintf(out, "    // no label there, or the code changed\n");
+    fprintf(out, "leave:\n");
+    fprintf(out, "    if (left == 0) return cycles;\n");
+    fprintf(out, "    emulate_cycle(c);\n");
+    fprintf(out, "    left--;\n");
+    fprintf(out, "    tainted = TAINTED();\n");
+    fprintf(out, "    goto dispatch;\n\n");
+
+    for (unsigned int a = 0; a < 4096; a++) {
+        if (reached[a]) emit(out, a);
+    }
+
+    fprintf(out, "}\n");
+}
+
+static void usage(void) {
+    error("usage: chip8-aot [-o output.c] rom.ch8\n");
+}
+
+int main(int argc, char** argv) {
+    const char* output = NULL;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "o:")) != -1) {
+        switch (opt) {
+            case 'o':
+                output = optarg;
+                break;
+            default:
+                usage();
+                return 1;
+        }
+    }
+
+    if (optind != argc - 1) {
+        usage();
+        return 1;
+    }
+
+    FILE* fp = fopen(argv[optind], "rb");
+    if (fp == NULL) {
+        perror("Error while opening rom");
+        return 1;
+    }
+
+    rom_size = fread(rom, 1, sizeof(rom), fp);
+    if (fgetc(fp) != EOF) {
+        error("[FAILED] %s doesn't fit in memory\n", argv[optind]);
+        fclose(fp);
+        return 1;
+    }
+    fclose(fp);
+
+    explore();
+
+    FILE* out = output ? fopen(output, "w") : stdout;
+    if (out == NULL) {
+        perror("Error while opening output");
+        return 1;
+    }
+
+    write_code(out, argv[optind]);
+
+    if (out != stdout && fclose(out)) {
+        perror("Error while writing output");
+        return 1;
+    }
+
+    unsigned long found = 0, handled = 0;
+    for (unsigned int a = 0; a < 4096; a++) {
+        if (!reached[a]) continue;
+        found++;
+        if (!inlined(opcode_at(a))) handled++;
+    }
+    error("[OK] %s: %lu instructions, %lu through their handler\n",
+          argv[optind], found, handled);
+
+    return 0;
+}
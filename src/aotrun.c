@@ -0,0 +1,139 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "aot.h"
+
+/*
+ * Recompiled rom runner:
+ *
+ * Linked with the output of chip8-aot, boots the rom it was compiled from
+ * on two machines and runs it for the same number of cycles, frame by
+ * frame with the timers ticking in between, once through emulate_cycle()
+ * and once through the compiled code. Prints the display hash and the
+ * instructions per second of both; the machines have to end up exactly
+ * the same, or the run fails.
+ *
+ * Waiting for a key isn't running code: frames starting on FX0A with no
+ * key down are skipped on both sides (the keypad stays released, so the
+ * wait never ends), and each side is rated on the instructions it ran.
+ * */
+
+#define DEFAULT_CYCLES 2000000
+
+static unsigned long cycles = DEFAULT_CYCLES;
+static unsigned long ipf = DEFAULT_IPF;
+static uint32_t seed = 1;
+static int mode = MODE_CHIP8;
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static unsigned long interpret(chip8_t* c, unsigned long n) {
+    for (unsigned long i = 0; i < n; i++) emulate_cycle(c);
+    return n;
+}
+
+/**
+ * waiting: whether a machine sits on FX0A with no key down
+ * @param c the machine
+ * @return 1 if so, 0 otherwise
+ * */
+static int waiting(const chip8_t* c) {
+    unsigned short pc = c->pc & c->mem_mask;
+    unsigned short op = c->memory[pc] << 8 | c->memory[(pc + 1) & c->mem_mask];
+
+    return (op & 0xF0FF) == 0xF00A && c->keypad == 0;
+}
+
+/**
+ * run: boot the rom and run it
+ * @param c the machine
+ * @param step how to run instructions, returns how many it ran
+ * @return instructions per second
+ * */
+static double run(chip8_t* c, unsigned long (*step)(chip8_t*, unsigned long)) {
+    static unsigned char image[4096];
+    unsigned long ran = 0;
+
+    make_image(image, aot_rom, aot_rom_size);
+    boot_image(c, image);
+    set_mode(c, mode);
+    seed_random(c, seed);
+
+    double start = now_s();
+
+    for (unsigned long done = 0; done < cycles; done += ipf) {
+        unsigned long n = cycles - done < ipf ? cycles - done : ipf;
+
+        if (!waiting(c)) ran += step(c, n);
+        if (n < ipf) break;
+        tick_timers(c);
+    }
+
+    return ran / (now_s() - start);
+}
+
+static void usage(void) {
+    error("usage: [-c cycles] [-i ipf] [-s seed] [-m mode] [name]\n");
+}
+
+int main(int argc, char** argv) {
+    chip8_t* machines[2];
+    int opt;
+
+    while ((opt = getopt(argc, argv, "c:i:s:m:")) != -1) {
+        switch (opt) {
+            case 'c':
+                cycles = strtoul(optarg, NULL, 10);
+                break;
+            case 'i':
+                ipf = strtoul(optarg, NULL, 10);
+                if (ipf == 0) ipf = 1;
+                break;
+            case 's':
+                seed = strtoul(optarg, NULL, 10);
+                break;
+            case 'm':
+                mode = parse_mode(optarg);
+                if (mode < 0) {
+                    error("[FAILED] A mode is chip8, schip or xochip\n");
+                    return 1;
+                }
+                break;
+            default:
+                usage();
+                return 1;
+        }
+    }
+
+    for (int i = 0; i < 2; i++) {
+        if (posix_memalign((void**)&machines[i], 64, sizeof(chip8_t))) {
+            perror("posix_memalign");
+            return 1;
+        }
+        machines[i]->cache = NULL;
+        machines[i]->jit = NULL;
+        machines[i]->trace = NULL;
+        machines[i]->profile = NULL;
+    }
+
+    double slow = run(machines[0], interpret);
+    double fast = run(machines[1], aot_run);
+    int same = !memcmp(machines[0], machines[1], offsetof(chip8_t, cache));
+
+    printf("%-32s %016llx %12.0f %12.0f %6.1fx%s\n",
+           optind < argc ? argv[optind] : "rom", hash_display(machines[1]),
+           slow, fast, fast / slow, same ? "" : "  MISMATCH");
+
+    free(machines[0]);
+    free(machines[1]);
+    return same ? 0 : 1;
+}
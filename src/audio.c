@@ -0,0 +1,189 @@
+#include "audio.h"
+
+#include <math.h>
+#include <string.h>
+
+/*
+==========================================================
+# Sample ring
+==========================================================
+*/
+
+/**
+ * ring_push: append samples, as many as there is room for
+ * @param ring the ring, only ever pushed to by one thread
+ * @param samples the samples
+ * @param n how many
+ * @return the number of samples pushed
+ */
+uint32_t ring_push(struct audio_ring* ring, const int16_t* samples,
+                   uint32_t n) {
+    uint32_t head = ring->head;
+    uint32_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    uint32_t room = AUDIO_RING_SIZE - (head - tail);
+
+    if (n > room) n = room;
+    for (uint32_t i = 0; i < n; i++) {
+        ring->samples[(head + i) & (AUDIO_RING_SIZE - 1)] = samples[i];
+    }
+
+    // publish the samples only once they are written
+    __atomic_store_n(&ring->head, head + n, __ATOMIC_RELEASE);
+    return n;
+}
+
+/**
+ * ring_pop: take samples out, as many as are available
+ * @param ring the ring, only ever popped from by one thread
+ * @param samples filled with the samples
+ * @param n how many are wanted
+ * @return the number of samples popped
+ */
+uint32_t ring_pop(struct audio_ring* ring, int16_t* samples, uint32_t n) {
+    uint32_t tail = ring->tail;
+    uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+
+    if (n > head - tail) n = head - tail;
+    for (uint32_t i = 0; i < n; i++) {
+        samples[i] = ring->samples[(tail + i) & (AUDIO_RING_SIZE - 1)];
+    }
+
+    // hand the slots back only once they are read
+    __atomic_store_n(&ring->tail, tail + n, __ATOMIC_RELEASE);
+    return n;
+}
+
+/*
+==========================================================
+# Buzzer
+==========================================================
+*/
+
+static void put_le(unsigned char* p, uint32_t v, int bytes) {
+    for (int i = 0; i < bytes; i++) p[i] = (v >> (8 * i)) & 0xFF;
+}
+
+// RIFF header of a mono 16-bit pcm file holding the given number of samples
+static void wav_header(unsigned char* h, uint32_t samples) {
+    memcpy(h, "RIFF", 4);
+    put_le(h + 4, 36 + 2 * samples, 4);
+    memcpy(h + 8, "WAVEfmt ", 8);
+    put_le(h + 16, 16, 4);
+    put_le(h + 20, 1, 2);
+    put_le(h + 22, 1, 2);
+    put_le(h + 24, AUDIO_RATE, 4);
+    put_le(h + 28, AUDIO_RATE * 2, 4);
+    put_le(h + 32, 2, 2);
+    put_le(h + 34, 16, 2);
+    memcpy(h + 36, "data", 4);
+    put_le(h + 40, 2 * samples, 4);
+}
+
+/**
+ * audio_init: set up the buzzer
+ * @param a the audio state
+ * @param sink where the samples go, see audio_open_wav for AUDIO_WAV
+ * @return void
+ */
+void audio_init(struct audio* a, enum audio_sink sink) {
+    memset(a, 0, sizeof(*a));
+    a->sink = sink;
+}
+
+/**
+ * audio_open_wav: send the samples to a WAV file
+ * @param a the audio state
+ * @param filename the WAV file
+ * @return 0 if success, -1 otherwise
+ */
+int audio_open_wav(struct audio* a, const char* filename) {
+    unsigned char header[44];
+
+    audio_init(a, AUDIO_WAV);
+    a->wav = fopen(filename, "wb");
+    if (a->wav == NULL) return -1;
+
+    // the sizes are filled in by audio_close
+    wav_header(header, 0);
+    if (fwrite(header, sizeof(header), 1, a->wav) != 1) {
+        fclose(a->wav);
+        a->wav = NULL;
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * audio_frame: generate the samples of one 60hz frame
+ * @param a the audio state
+ * @param sound whether the buzzer sounds during the frame (sound_flag)
+ * @param pattern the 16 bytes of the XO-CHIP pattern, NULL for the buzzer
+ * @param pitch the XO-CHIP pitch, unused without a pattern
+ * @return void
+ */
+void audio_frame(struct audio* a, int sound, const unsigned char* pattern,
+                 int pitch) {
+    const uint32_t step = (uint32_t)(((uint64_t)AUDIO_TONE << 32) / AUDIO_RATE);
+    int16_t samples[AUDIO_FRAME];
+
+    if (a->sink == AUDIO_NULL) {
+        a->samples += AUDIO_FRAME;
+        return;
+    }
+
+    if (pattern) {
+        // the pitch only changes between frames, one pow() per frame
+        double rate = 4000 * pow(2, (pitch - 64) / 48.0);
+        uint32_t advance = (uint32_t)(rate / AUDIO_RATE * (1 << 25));
+
+        for (int i = 0; i < AUDIO_FRAME; i++) {
+            int bit = a->pattern_pos >> 25;
+            int on = (pattern[bit >> 3] >> (7 - (bit & 7))) & 1;
+
+            samples[i] = sound ? (on ? AUDIO_VOLUME : -AUDIO_VOLUME) : 0;
+            a->pattern_pos += advance;
+        }
+    } else {
+        // the phase keeps running through silence, so beeps don't click in
+        for (int i = 0; i < AUDIO_FRAME; i++) {
+            int16_t level = a->phase >> 31 ? AUDIO_VOLUME : -AUDIO_VOLUME;
+
+            samples[i] = sound ? level : 0;
+            a->phase += step;
+        }
+    }
+    a->samples += AUDIO_FRAME;
+
+    if (a->sink == AUDIO_RING) {
+        a->dropped += AUDIO_FRAME - ring_push(&a->ring, samples, AUDIO_FRAME);
+    } else if (a->wav) {
+        unsigned char bytes[2 * AUDIO_FRAME];
+
+        for (int i = 0; i < AUDIO_FRAME; i++) {
+            put_le(bytes + 2 * i, (uint16_t)samples[i], 2);
+        }
+        fwrite(bytes, sizeof(bytes), 1, a->wav);
+    }
+}
+
+/**
+ * audio_close: finish the WAV file, if any
+ * @param a the audio state
+ * @return 0 if success, -1 otherwise
+ */
+int audio_close(struct audio* a) {
+    unsigned char header[44];
+    int error = 0;
+
+    if (a->wav == NULL) return 0;
+
+    wav_header(header, (uint32_t)a->samples);
+    error |= fseek(a->wav, 0, SEEK_SET) != 0;
+    error |= !error && fwrite(header, sizeof(header), 1, a->wav) != 1;
+    error |= ferror(a->wav) != 0;
+    error |= fclose(a->wav) != 0;
+    a->wav = NULL;
+
+    return error ? -1 : 0;
+}
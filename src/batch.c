@@ -0,0 +1,571 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <errno.h>
+#include <pthread.h>
+
+#include "chip8.h"
+#include "cache.h"
+#include "jit.h"
+#include "romlib.h"
+#include "recorder.h"
+
+/*
+ * Headless batch runner:
+ *
+ * Runs every rom of a list for a fixed number of cycles, spreading the roms
+ * over a pool of worker threads, then prints the final display hash, the
+ * number of cycles executed and the wall time of each rom.
+ *
+ * Roms may be given one by one, as directories or as pack files (see
+ * romlib.h): they are all mapped and turned into boot images up front, so
+ * starting a rom is a single copy, and roms with identical content only
+ * run once. -p saves everything that was loaded as one pack file.
+ *
+ * No SDL is involved and nothing sleeps: the workers run flat out.
+ *
+ * Scheduling is work-stealing: every worker owns a deque of rom indices,
+ * pops work from its own tail and, once that is empty, steals from the head
+ * of the other workers' deques. Short roms therefore never leave a core
+ * idle while another one still has a backlog.
+ *
+ * With -b the roms run through the basic-block cache (see cache.h), with -J
+ * through the jit (see jit.h).
+ *
+ * With -g the hashes are checked against a golden file (see roms/golden.txt,
+ * written by -w), any difference fails the run.
+ *
+ * With -v dir the frames every rom presents are recorded to dir/name.c8fs
+ * (see recorder.h), name being the file name of the rom without .ch8.
+ * */
+
+#define DEFAULT_CYCLES 100000
+
+struct result {
+    unsigned long long hash;
+    unsigned long cycles;
+    double wall_ms;
+    // 0 if no worker got to it
+    int ran;
+};
+
+struct golden {
+    char* rom;
+    unsigned long long hash;
+};
+
+struct deque {
+    pthread_mutex_t lock;
+    int* items;
+    int head;
+    int tail;
+};
+
+struct worker {
+    pthread_t thread;
+    int id;
+};
+
+static char** roms;
+static int nroms;
+static struct rom_library lib;
+// the rom whose run stands for each rom, itself unless a copy of another
+static size_t* twin;
+static unsigned long budget = DEFAULT_CYCLES;
+static unsigned long ipf = DEFAULT_IPF;
+// every rom draws the same random numbers, run after run
+static uint32_t seed = 1;
+static int use_blocks = 0;
+static int use_jit = 0;
+// every rom runs in the same mode, see set_mode()
+static int mode = MODE_CHIP8;
+static const char* golden_file;
+static const char* write_file;
+static const char* pack_file;
+static const char* frames_dir;
+static struct result* results;
+static struct deque* deques;
+static struct worker* workers;
+static int nworkers;
+static struct golden* golden;
+static int ngolden;
+
+/**
+ * now_ms: monotonic clock in milliseconds
+ * @param void
+ * @return the current time
+ */
+static double now_ms(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e3 + ts.tv_nsec / 1e6;
+}
+
+/**
+ * pop: take work from the tail of the worker's own deque
+ * @param d the deque
+ * @return a rom index or -1 if the deque is empty
+ */
+static int pop(struct deque* d) {
+    int item = -1;
+
+    pthread_mutex_lock(&d->lock);
+    if (d->tail > d->head) item = d->items[--d->tail];
+    pthread_mutex_unlock(&d->lock);
+
+    return item;
+}
+
+/**
+ * steal: take work from the head of another worker's deque
+ * @param d the victim deque
+ * @return a rom index or -1 if the deque is empty
+ */
+static int steal(struct deque* d) {
+    int item = -1;
+
+    pthread_mutex_lock(&d->lock);
+    if (d->tail > d->head) item = d->items[d->head++];
+    pthread_mutex_unlock(&d->lock);
+
+    return item;
+}
+
+/**
+ * next_rom: find the next rom to run, stealing if needed
+ * @param id the worker id
+ * @return a rom index or -1 once there is no work left anywhere
+ */
+static int next_rom(int id) {
+    int item = pop(&deques[id]);
+
+    // roms are never added once workers start, so one full sweep over the
+    // victims without finding anything means we are done
+    for (int i = 1; item < 0 && i < nworkers; i++) {
+        item = steal(&deques[(id + i) % nworkers]);
+    }
+
+    return item;
+}
+
+/**
+ * run: run some instructions on the selected engine
+ * @param c the machine
+ * @param cycles how many instructions to run
+ * @return void
+ */
+static void run(chip8_t* c, unsigned long cycles) {
+    if (use_jit) {
+        run_jit(c, cycles);
+    } else if (use_blocks) {
+        run_blocks(c, cycles);
+    } else {
+        for (unsigned long i = 0; i < cycles; i++) emulate_cycle(c);
+    }
+}
+
+/**
+ * open_frames: start recording the frames of a rom into frames_dir
+ * @param name the name of the rom
+ * @return the recorder, NULL otherwise
+ */
+static struct recorder* open_frames(const char* name) {
+    char filename[4096];
+    const char* base = strrchr(name, '/');
+    base = base ? base + 1 : name;
+
+    int len = (int)strlen(base);
+    if (len > 4 && (!strcmp(base + len - 4, ".ch8") ||
+                    !strcmp(base + len - 4, ".CH8"))) {
+        len -= 4;
+    }
+
+    snprintf(filename, sizeof(filename), "%s/%.*s.c8fs", frames_dir, len,
+             base);
+
+    struct recorder* r = recorder_open(filename);
+    if (r == NULL) error("[FAILED] Can't record frames to %s\n", filename);
+    return r;
+}
+
+/**
+ * run_rom: run a single rom on the given machine
+ * @param c the machine to use
+ * @param index the rom to run
+ * @return void
+ */
+static void run_rom(chip8_t* c, int index) {
+    struct result* r = &results[index];
+    struct recorder* frames = frames_dir ? open_frames(lib.roms[index].name)
+                                         : NULL;
+
+    boot_image(c, lib.roms[index].image);
+    set_mode(c, mode);
+    seed_random(c, seed);
+
+    double start = now_ms();
+
+    // frames of ipf instructions, timers tick in between
+    for (r->cycles = 0; r->cycles < budget; r->cycles += ipf) {
+        if (budget - r->cycles < ipf) {
+            run(c, budget - r->cycles);
+            r->cycles = budget;
+            break;
+        }
+
+        // waits for a key or for dt are skipped, not spun
+        if (!skip_idle(c, ipf)) run(c, ipf);
+        tick_timers(c);
+
+        if (frames && c->draw_flag) {
+            recorder_push(frames, c, r->cycles / ipf + 1);
+            c->draw_flag = 0;
+            c->fb_dirty = 0;
+        }
+    }
+
+    r->hash = hash_display(c);
+    r->wall_ms = now_ms() - start;
+    r->ran = 1;
+
+    if (frames && recorder_close(frames)) {
+        error("[FAILED] Could not write the frames of %s\n",
+              lib.roms[index].name);
+    }
+}
+
+/**
+ * work: worker thread body
+ * @param arg the worker
+ * @return NULL
+ */
+static void* work(void* arg) {
+    struct worker* w = arg;
+    chip8_t* c;
+    int index;
+
+    // the others steal its roms, any left over are reported as failed
+    int err = posix_memalign((void**)&c, 64, sizeof(*c));
+
+    if (err) {
+        errno = err;
+        perror("posix_memalign");
+        return NULL;
+    }
+    c->cache = NULL;
+    c->jit = NULL;
+    c->trace = NULL;
+    c->profile = NULL;
+    if (use_blocks && cache_attach(c)) {
+        perror("cache_attach");
+        free(c);
+        return NULL;
+    }
+    // without a jit run_jit() simply interprets
+    if (use_jit) jit_attach(c);
+
+    while ((index = next_rom(w->id)) >= 0) {
+        run_rom(c, index);
+    }
+
+    cache_detach(c);
+    jit_detach(c);
+    free(c);
+    return NULL;
+}
+
+/**
+ * read_list: append the roms listed in a file (one path per line)
+ * @param filename the list file
+ * @return 0 if success, -1 otherwise
+ */
+static int read_list(const char* filename) {
+    FILE* fp = fopen(filename, "r");
+    char line[4096];
+
+    if (fp == NULL) return -1;
+
+    while (fgets(line, sizeof(line), fp)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        if (line[0] == '\0') continue;
+
+        char** more = realloc(roms, (nroms + 1) * sizeof(*roms));
+        if (more == NULL) break;
+        roms = more;
+
+        roms[nroms] = strdup(line);
+        if (roms[nroms] == NULL) break;
+        nroms++;
+    }
+
+    // stopped short of the end: out of memory or a read error
+    int error = !feof(fp);
+
+    fclose(fp);
+    return error ? -1 : 0;
+}
+
+/**
+ * read_golden: load the expected hashes
+ * @param filename the golden file, "rom hash" lines and # comments
+ * @return 0 if success, -1 otherwise (already reported)
+ */
+static int read_golden(const char* filename) {
+    FILE* fp = fopen(filename, "r");
+    char line[4096];
+
+    if (fp == NULL) {
+        perror("Error while reading golden file");
+        return -1;
+    }
+
+    while (fgets(line, sizeof(line), fp)) {
+        unsigned long c, i, s;
+
+        line[strcspn(line, "\r\n")] = '\0';
+
+        // hashes only hold for the parameters they were made with
+        if (sscanf(line, "# cycles %lu ipf %lu seed %lu", &c, &i, &s) == 3 &&
+            (c != budget || i != ipf || s != seed)) {
+            error("[FAILED] %s was made with -c %lu -i %lu -s %lu\n",
+                  filename, c, i, s);
+            fclose(fp);
+            return -1;
+        }
+
+        char* space = strrchr(line, ' ');
+        if (line[0] == '#' || space == NULL) continue;
+
+        *space = '\0';
+        golden = realloc(golden, (ngolden + 1) * sizeof(*golden));
+        golden[ngolden].rom = strdup(line);
+        golden[ngolden].hash = strtoull(space + 1, NULL, 16);
+        ngolden++;
+    }
+
+    fclose(fp);
+    return 0;
+}
+
+/**
+ * find_golden: look up the expected hash of a rom
+ * @param rom the rom filename
+ * @return the golden entry, NULL if the rom has none
+ */
+static const struct golden* find_golden(const char* rom) {
+    for (int i = 0; i < ngolden; i++) {
+        if (!strcmp(golden[i].rom, rom)) return &golden[i];
+    }
+
+    return NULL;
+}
+
+/**
+ * write_golden: save the hashes of this run as the expected ones
+ * @param filename the golden file
+ * @return 0 if success, -1 otherwise
+ */
+static int write_golden(const char* filename) {
+    FILE* fp = fopen(filename, "w");
+
+    if (fp == NULL) return -1;
+
+    fprintf(fp, "# chip8-batch golden display hashes, keypad released\n");
+    fprintf(fp, "# cycles %lu ipf %lu seed %lu\n", budget, ipf,
+            (unsigned long)seed);
+    for (size_t i = 0; i < lib.count; i++) {
+        fprintf(fp, "%s %016llx\n", lib.roms[i].name, results[i].hash);
+    }
+
+    return fclose(fp) ? -1 : 0;
+}
+
+static void usage(void) {
+    error("usage: chip8-batch [-j threads] [-c cycles] [-i ipf] [-s seed] [-l list] [-b] [-J] "
+          "[-g golden | -w golden] [-p pack] [-m mode] [-v frames_dir] "
+          "[rom.ch8 | dir | pack...]\n");
+}
+
+int main(int argc, char** argv) {
+    int opt;
+
+    nworkers = (int)sysconf(_SC_NPROCESSORS_ONLN);
+
+    while ((opt = getopt(argc, argv, "j:c:i:s:l:bJg:w:p:m:v:")) != -1) {
+        switch (opt) {
+            case 'j':
+                nworkers = atoi(optarg);
+                break;
+            case 'c':
+                budget = strtoul(optarg, NULL, 10);
+                break;
+            case 'i':
+                ipf = strtoul(optarg, NULL, 10);
+                if (ipf == 0) ipf = 1;
+                break;
+            case 's':
+                seed = strtoul(optarg, NULL, 10);
+                break;
+            case 'b':
+                use_blocks = 1;
+                break;
+            case 'J':
+                use_jit = 1;
+                break;
+            case 'g':
+                golden_file = optarg;
+                break;
+            case 'w':
+                write_file = optarg;
+                break;
+            case 'p':
+                pack_file = optarg;
+                break;
+            case 'v':
+                frames_dir = optarg;
+                break;
+            case 'm':
+                mode = parse_mode(optarg);
+                if (mode < 0) {
+                    error("[FAILED] A mode is chip8, schip or xochip\n");
+                    return 1;
+                }
+                break;
+            case 'l':
+                if (read_list(optarg)) {
+                    perror("Error while reading rom list");
+                    return 1;
+                }
+                break;
+            default:
+                usage();
+                return 1;
+        }
+    }
+
+    for (int i = optind; i < argc; i++) {
+        char** more = realloc(roms, (nroms + 1) * sizeof(*roms));
+
+        if (more == NULL) {
+            perror("realloc");
+            return 1;
+        }
+        roms = more;
+        roms[nroms++] = argv[i];
+    }
+
+    if (nroms == 0) {
+        usage();
+        return 1;
+    }
+
+    if (golden_file && read_golden(golden_file)) return 1;
+
+    int failed = 0;
+
+    for (int i = 0; i < nroms; i++) {
+        if (romlib_add(&lib, roms[i])) {
+            printf("%-32s %-16s\n", roms[i], "FAILED");
+            failed++;
+        }
+    }
+    romlib_index(&lib);
+
+    if (pack_file && romlib_write_pack(&lib, pack_file)) {
+        perror("Error while writing pack file");
+        return 1;
+    }
+
+    // identical roms give identical results, only the first one runs
+    int unique = 0;
+
+    twin = malloc((lib.count ? lib.count : 1) * sizeof(*twin));
+    for (size_t i = 0; i < lib.count; i++) {
+        const struct rom* first = romlib_find(&lib, lib.roms[i].hash);
+
+        twin[i] = i;
+        if (first && !memcmp(first->image, lib.roms[i].image, 4096)) {
+            twin[i] = first - lib.roms;
+        }
+        if (twin[i] == i) unique++;
+    }
+
+    if (nworkers < 1) nworkers = 1;
+    if (nworkers > unique) nworkers = unique ? unique : 1;
+
+    results = calloc(lib.count ? lib.count : 1, sizeof(*results));
+    deques = calloc(nworkers, sizeof(*deques));
+    workers = calloc(nworkers, sizeof(*workers));
+
+    // deal the roms out round-robin, stealing evens out the rest
+    for (int i = 0; i < nworkers; i++) {
+        pthread_mutex_init(&deques[i].lock, NULL);
+        deques[i].items = malloc((unique ? unique : 1) * sizeof(int));
+    }
+    for (size_t i = 0, n = 0; i < lib.count; i++) {
+        if (twin[i] != i) continue;
+
+        struct deque* d = &deques[n++ % nworkers];
+        d->items[d->tail++] = (int)i;
+    }
+
+    double start = now_ms();
+
+    for (int i = 0; i < nworkers; i++) {
+        workers[i].id = i;
+        pthread_create(&workers[i].thread, NULL, work, &workers[i]);
+    }
+    for (int i = 0; i < nworkers; i++) {
+        pthread_join(workers[i].thread, NULL);
+    }
+
+    double total = now_ms() - start;
+
+    for (size_t i = 0; i < lib.count; i++) results[i] = results[twin[i]];
+
+    printf("%-32s %-16s %10s %10s %8s %10s\n", "rom", "hash", "cycles", "ms",
+           "ns/insn", "Minsn/s");
+    for (size_t i = 0; i < lib.count; i++) {
+        struct result* r = &results[i];
+        const char* name = lib.roms[i].name;
+        double ns = r->cycles ? r->wall_ms * 1e6 / r->cycles : 0;
+
+        if (!r->ran) {
+            printf("%-32s %-16s\n", name, "FAILED");
+            failed++;
+            continue;
+        }
+
+        printf("%-32s %016llx %10lu %10.3f %8.2f %10.2f", name, r->hash,
+               r->cycles, r->wall_ms, ns, ns > 0 ? 1e3 / ns : 0);
+
+        if (golden_file) {
+            const struct golden* g = find_golden(name);
+
+            if (g == NULL) {
+                printf("  NO GOLDEN");
+                failed++;
+            } else if (g->hash != r->hash) {
+                printf("  MISMATCH (expected %016llx)", g->hash);
+                failed++;
+            }
+        }
+
+        printf("\n");
+    }
+
+    if (write_file && write_golden(write_file)) {
+        perror("Error while writing golden file");
+        failed++;
+    }
+
+    printf("%s %zu roms (%d unique), %d failed, %d threads, %.3f ms\n",
+           failed ? "[FAILED]" : "[OK]", lib.count, unique, failed, nworkers,
+           total);
+
+    return failed ? 1 : 0;
+}
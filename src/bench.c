@@ -0,0 +1,318 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <stddef.h>
+#include <unistd.h>
+
+#include "chip8.h"
+#include "cache.h"
+#include "jit.h"
+#include "lockstep.h"
+
+/*
+ * Dispatch benchmark:
+ *
+ * Runs every rom with each dispatch engine for the same number of cycles,
+ * from the same rng seed, and reports instructions per second. Each engine
+ * runs ENGINE_LANES key sequences, the first with every key up, so the key
+ * skips and waits are covered too; the final machines of each sequence are
+ * compared byte for byte, so a mismatch between engines is reported as a
+ * failure.
+ *
+ * The lockstep column runs LOCKSTEP_LANES copies at once, from the same
+ * seed but each fed its own key sequence (the first one none), and reports
+ * the instructions per second of all the lanes together, how many lanes
+ * ran each instruction on average and the gain over running the same
+ * lanes one after the other on the switch engine. Every lane is checked
+ * against that run.
+ * */
+
+#define DEFAULT_CYCLES 2000000
+// frames a key of a lane's sequence stays down (or every key up)
+#define KEY_FRAMES 30
+// key sequences every engine runs, lanes 0 to ENGINE_LANES - 1 of keys_of()
+#define ENGINE_LANES 4
+
+struct engine {
+    const char* name;
+    unsigned long (*run)(chip8_t* c, unsigned long cycles);
+};
+
+static unsigned long run_switch(chip8_t* c, unsigned long cycles) {
+    for (unsigned long i = 0; i < cycles; i++) emulate_cycle_switch(c);
+    return cycles;
+}
+
+static unsigned long run_table(chip8_t* c, unsigned long cycles) {
+    for (unsigned long i = 0; i < cycles; i++) emulate_cycle_table(c);
+    return cycles;
+}
+
+static const struct engine engines[] = {
+    {"switch", run_switch},
+    {"table", run_table},
+    {"block", run_blocks},
+    {"jit", run_jit},
+};
+
+#define NENGINES (sizeof(engines) / sizeof(engines[0]))
+
+static unsigned long ipf = DEFAULT_IPF;
+
+/**
+ * keys_of: the keypad of a lane during a frame
+ * @param lane the lane
+ * @param frame the frame
+ * @return the keypad, one key down or none, none at all for lane 0
+ */
+static uint16_t keys_of(int lane, unsigned long frame) {
+    uint32_t x = lane * 0x9E3779B9u ^ (uint32_t)(frame / KEY_FRAMES) * 0x85EBCA6Bu;
+
+    if (lane == 0) return 0;
+
+    x ^= x >> 15;
+    x *= 0x2C1B3C6Du;
+    x ^= x >> 12;
+    x %= 17;
+    return x == 16 ? 0 : 1u << x;
+}
+
+/**
+ * now_s: monotonic clock in seconds
+ * @param void
+ * @return the current time
+ */
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/**
+ * run: run a rom on one engine
+ * @param c the machine to use
+ * @param e the engine
+ * @param rom the rom filename
+ * @param cycles how many instructions to run
+ * @param lane whose keys to press, see keys_of()
+ * @return instructions per second, or a negative value if the rom failed
+ */
+static double run(chip8_t* c, const struct engine* e, char* rom,
+                  unsigned long cycles, int lane) {
+    init_cpu(c);
+    if (load_rom(c, rom)) return -1;
+
+    // CXNN must draw the same numbers on every engine
+    seed_random(c, 1);
+
+    double start = now_s();
+
+    // ipf instructions, then a timer tick, like a 60hz frame
+    for (unsigned long done = 0; done < cycles; done += ipf) {
+        c->keypad = keys_of(lane, done / ipf);
+        if (cycles - done < ipf) {
+            e->run(c, cycles - done);
+            break;
+        }
+
+        e->run(c, ipf);
+        tick_timers(c);
+    }
+
+    return cycles / (now_s() - start);
+}
+
+static void press(chip8_t* c, int lane, unsigned long frame, void* arg) {
+    (void)arg;
+    c->keypad = keys_of(lane, frame);
+}
+
+/**
+ * run_lockstep: run a rom on every lane of the lockstep engine
+ * @param lanes the machines, LOCKSTEP_LANES of them
+ * @param rom the rom filename
+ * @param cycles how many instructions each lane runs
+ * @param width where to store the average number of lanes per instruction
+ * @return instructions per second over all the lanes, or a negative value
+ * if the rom failed
+ */
+static double run_lockstep(chip8_t** lanes, char* rom, unsigned long cycles,
+                           double* width) {
+    for (int l = 0; l < LOCKSTEP_LANES; l++) {
+        init_cpu(lanes[l]);
+        if (load_rom(lanes[l], rom)) return -1;
+        seed_random(lanes[l], 1);
+    }
+
+    struct lockstep* ls = lockstep_create(lanes, LOCKSTEP_LANES);
+    if (ls == NULL) return -1;
+
+    double start = now_s();
+    unsigned long frames = cycles / ipf;
+
+    // the same frames as run(), the last one cut short without a tick
+    lockstep_run_frames(ls, frames, ipf, press, NULL);
+    if (cycles % ipf) {
+        for (int l = 0; l < LOCKSTEP_LANES; l++) press(lanes[l], l, frames, NULL);
+        lockstep_run(ls, cycles % ipf);
+    }
+
+    double ips = (double)cycles * LOCKSTEP_LANES / (now_s() - start);
+
+    // lanes run apart count as groups of one
+    *width = (double)cycles * LOCKSTEP_LANES / (ls->groups + ls->alone);
+    lockstep_destroy(ls);
+    return ips;
+}
+
+int main(int argc, char** argv) {
+    unsigned long cycles = DEFAULT_CYCLES;
+    int opt;
+    int failed = 0;
+
+    while ((opt = getopt(argc, argv, "c:i:")) != -1) {
+        switch (opt) {
+            case 'c':
+                cycles = strtoul(optarg, NULL, 10);
+                break;
+            case 'i':
+                ipf = strtoul(optarg, NULL, 10);
+                if (ipf == 0) ipf = 1;
+                break;
+            default:
+                error("usage: chip8-bench [-c cycles] [-i ipf] rom.ch8...\n");
+                return 1;
+        }
+    }
+
+    if (optind == argc) {
+        error("usage: chip8-bench [-c cycles] [-i ipf] rom.ch8...\n");
+        return 1;
+    }
+
+    // the engines, the lockstep lanes, and one more for checking the last
+    // lane
+    chip8_t* machines[NENGINES + LOCKSTEP_LANES + 1];
+    chip8_t** lanes = machines + NENGINES;
+    chip8_t* check;
+    double total[NENGINES + 1] = {0};
+    // roms each mean is over, those that failed aren't
+    int counted[NENGINES + 1] = {0};
+
+    for (unsigned int e = 0; e < NENGINES + LOCKSTEP_LANES + 1; e++) {
+        if (posix_memalign((void**)&machines[e], 64, sizeof(chip8_t))) {
+            perror("posix_memalign");
+            return 1;
+        }
+        machines[e]->cache = NULL;
+        machines[e]->jit = NULL;
+        machines[e]->trace = NULL;
+        machines[e]->profile = NULL;
+    }
+    check = machines[NENGINES + LOCKSTEP_LANES];
+
+    if (cache_attach(machines[2])) {
+        perror("cache_attach");
+        return 1;
+    }
+
+    // without a jit (not x86-64, no executable memory) run_jit just
+    // interprets, which still checks the rest of the harness
+    if (jit_attach(machines[3])) {
+        error("[FAILED] jit unavailable, the jit column is interpreted\n");
+    }
+
+    printf("%-32s", "rom");
+    for (unsigned int e = 0; e < NENGINES; e++) {
+        printf(" %12s", engines[e].name);
+    }
+    printf(" %12s %9s %7s  (instructions/s)\n", "lockstep", "lanes", "gain");
+
+    for (int i = optind; i < argc; i++) {
+        printf("%-32s", argv[i]);
+
+        double time[NENGINES] = {0};
+        int broken[NENGINES] = {0};
+        int differs[NENGINES] = {0};
+
+        for (int l = 0; l < ENGINE_LANES; l++) {
+            for (unsigned int e = 0; e < NENGINES; e++) {
+                double ips = run(machines[e], &engines[e], argv[i], cycles, l);
+
+                if (ips < 0) {
+                    broken[e] = 1;
+                } else {
+                    time[e] += cycles / ips;
+                }
+            }
+
+            // every engine must leave the machine in exactly the same state
+            for (unsigned int e = 1; e < NENGINES; e++) {
+                differs[e] |= !broken[0] && !broken[e] &&
+                              memcmp(machines[0], machines[e],
+                                     offsetof(chip8_t, cache));
+            }
+        }
+
+        for (unsigned int e = 0; e < NENGINES; e++) {
+            if (broken[e]) {
+                printf(" %12s", "FAILED");
+                continue;
+            }
+
+            double ips = cycles * ENGINE_LANES / time[e];
+
+            printf(" %12.0f", ips);
+            total[e] += ips;
+            counted[e]++;
+        }
+
+        double width = 0;
+        double ips = run_lockstep(lanes, argv[i], cycles, &width);
+
+        if (ips < 0) {
+            printf(" %12s %9s", "FAILED", "");
+        } else {
+            printf(" %12.0f %9.1f", ips, width);
+            total[NENGINES] += ips;
+            counted[NENGINES]++;
+        }
+
+        for (unsigned int e = 1; e < NENGINES; e++) {
+            if (differs[e]) {
+                printf("  MISMATCH(%s)", engines[e].name);
+                failed++;
+            }
+        }
+
+        // and so must every lane, against its keys run on the switch engine
+        if (ips >= 0) {
+            double time = 0;
+            int same = 1;
+
+            for (int l = 0; l < LOCKSTEP_LANES; l++) {
+                time += 1 / run(check, &engines[0], argv[i], cycles, l);
+                same &= !memcmp(check, lanes[l], offsetof(chip8_t, cache));
+            }
+
+            printf(" %6.2fx", ips * time / LOCKSTEP_LANES);
+            if (!same) {
+                printf("  MISMATCH(lockstep)");
+                failed++;
+            }
+        }
+
+        printf("\n");
+    }
+
+    printf("%-32s", "mean");
+    for (unsigned int e = 0; e < NENGINES + 1; e++) {
+        printf(" %12.0f", counted[e] ? total[e] / counted[e] : 0.0);
+    }
+    printf("\n");
+
+    return failed ? 1 : 0;
+}
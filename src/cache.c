@@ -0,0 +1,181 @@
+#include "cache.h"
+#include "profile.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// long blocks are split, the length has to fit len[]
+#define MAX_BLOCK 255
+
+/**
+ * cache_attach: give a machine its own block cache
+ * @param c the machine
+ * @return 0 if success, -1 if out of memory
+ * */
+int cache_attach(chip8_t* c) {
+    if (c->cache) return 0;
+
+    c->cache = calloc(1, sizeof(*c->cache));
+
+    return c->cache ? 0 : -1;
+}
+
+/**
+ * cache_detach: free the block cache of a machine
+ * @param c the machine
+ * @return void
+ * */
+void cache_detach(chip8_t* c) {
+    free(c->cache);
+    c->cache = NULL;
+}
+
+/**
+ * flush: forget every block
+ * @param cache the cache
+ * @return void
+ * */
+static void flush(struct block_cache* cache) {
+    memset(cache->len, 0, sizeof(cache->len));
+    memset(cache->cached, 0, sizeof(cache->cached));
+    cache->generation++;
+}
+
+/**
+ * cache_invalidate: notify the cache that memory has been written
+ * @param cache the cache
+ * @param addr first byte written
+ * @param len number of bytes written
+ * @return void
+ *
+ * Self-modifying code is rare, so rather than tracking which blocks overlap
+ * the write we just drop everything as soon as a cached byte is touched.
+ * */
+void cache_invalidate(struct block_cache* cache, unsigned short addr,
+                      unsigned short len) {
+    for (unsigned int i = 0; i < len; i++) {
+        unsigned int a = (addr + i) & 0xFFF;
+
+        if (cache->cached[a / 64] & (1ULL << (a % 64))) {
+            flush(cache);
+            return;
+        }
+    }
+}
+
+/**
+ * ends_block: tell whether an instruction is the last one of a block
+ * @param op the opcode
+ * @return 1 if op may do anything but fall through to pc + 2
+ * */
+static int ends_block(unsigned short op) {
+    switch (op & 0xF000) {
+        case 0x0000:
+            // 00E0 is the only one falling through, 00EE and unknown
+            // opcodes don't
+            return op != 0x00E0;
+
+        case 0x1000:  // jump
+        case 0x2000:  // call
+        case 0x3000:  // skips
+        case 0x4000:
+        case 0x5000:
+        case 0x9000:
+        case 0xB000:  // computed jump
+        case 0xD000:  // draw
+        case 0xE000:  // key skips
+            return 1;
+
+        case 0x8000:
+            // unknown 8XYn opcodes don't advance pc
+            return (op & 0x000F) > 0x7 && (op & 0x000F) != 0xE;
+
+        case 0xF000:
+            switch (op & 0x00FF) {
+                case 0x0007:
+                case 0x0015:
+                case 0x0018:
+                case 0x001E:
+                case 0x0029:
+                case 0x0033:
+                case 0x0055:
+                case 0x0065:
+                    return 0;
+                default:
+                    // FX0A waits for a key by not advancing pc
+                    return 1;
+            }
+    }
+
+    return 0;
+}
+
+/**
+ * build: decode the block starting at addr
+ * @param c the machine
+ * @param addr the (masked) block address
+ * @return void
+ * */
+static void build(chip8_t* c, unsigned short addr) {
+    struct block_cache* cache = c->cache;
+    unsigned int n = 0;
+    unsigned short a = addr;
+
+    for (;;) {
+        unsigned short op =
+            c->memory[a] << 8 | c->memory[(a + 1) & 0xFFF];
+
+        predecode(op, &cache->code[a]);
+        cache->cached[a / 64] |= 1ULL << (a % 64);
+        cache->cached[((a + 1) & 0xFFF) / 64] |= 1ULL << ((a + 1) % 64);
+        n++;
+
+        if (ends_block(op) || n == MAX_BLOCK) break;
+
+        a = (a + 2) & 0xFFF;
+    }
+
+    cache->len[addr] = n;
+}
+
+/**
+ * run_blocks: run a machine through its block cache
+ * @param c the machine, with a cache attached
+ * @param cycles how many instructions to run
+ * @return the number of instructions actually run (always cycles)
+ *
+ * Runs exactly the same instructions, in the same order, as calling
+ * emulate_cycle() cycles times.
+ * */
+unsigned long run_blocks(chip8_t* c, unsigned long cycles) {
+    struct block_cache* cache = c->cache;
+    unsigned long done = 0;
+
+    // the profiler sits in emulate_cycle(), and the cache only covers 4K
+    // of 2-byte instructions
+    if (PROFILING(c) || c->mode == MODE_XOCHIP) {
+        for (; done < cycles; done++) emulate_cycle(c);
+        return done;
+    }
+
+    while (done < cycles) {
+        unsigned short addr = c->pc & 0xFFF;
+
+        if (!cache->len[addr]) build(c, addr);
+
+        unsigned long n = cache->len[addr];
+        unsigned int generation = cache->generation;
+
+        if (n > cycles - done) n = cycles - done;
+
+        for (unsigned long i = 0; i < n; i++) {
+            execute(c, &cache->code[(addr + 2 * i) & 0xFFF]);
+            done++;
+
+            // the block just rewrote cached code, the rest of it is stale
+            if (cache->generation != generation) break;
+        }
+    }
+
+    return done;
+}
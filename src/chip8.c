@@ -1,27 +1,33 @@
+#define _POSIX_C_SOURCE 200809L
+
 #include "chip8.h"
+#include "cache.h"
+#include "jit.h"
+#include "trace.h"
+#include "profile.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
 #include <errno.h>
+#include <stddef.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 
-#define debug_print(fmt, ...)                         \
-    do {                                              \
-        if (DEBUG) fprintf(stderr, fmt, __VA_ARGS__); \
-    } while (0)
-
-int DEBUG = 1;
 extern int errno;
 
 /*
  * Memory map:
  *
- * Total: 4096 bytes (4K)
+ * Total: 4096 bytes (4K), 65536 (64K) in XO-CHIP mode
  *
  * 0x000 - 0x1FF     INTERPRETER
- * 0x200 - 0xFFF     Program/Data space
+ *   0x000 - 0x04F   font
+ *   0x050 - 0x0EF   big font (SCHIP and XO-CHIP modes)
+ * 0x200 - 0xFFF     Program/Data space (up to 0xFFFF in XO-CHIP mode)
  *
  * NOTE:
  * opcodes are stored big-endian!
@@ -54,588 +60,1305 @@ unsigned char fontset[80] = {
     0xF0, 0x80, 0xF0, 0x80, 0x80   // F
 };
 
-// Memory
-unsigned char memory[4096] = {0};
+// Big font set, 8x10 (FX30)
+#define BIGFONT_ADDR 0x50
+
+unsigned char bigfontset[160] = {
+    0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C,  // 0
+    0x18, 0x38, 0x58, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C,  // 1
+    0x3E, 0x7F, 0xC3, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xFF, 0xFF,  // 2
+    0x3C, 0x7E, 0xC3, 0x03, 0x0E, 0x0E, 0x03, 0xC3, 0x7E, 0x3C,  // 3
+    0x06, 0x0E, 0x1E, 0x36, 0x66, 0xC6, 0xFF, 0xFF, 0x06, 0x06,  // 4
+    0xFF, 0xFF, 0xC0, 0xC0, 0xFC, 0xFE, 0x03, 0xC3, 0x7E, 0x3C,  // 5
+    0x3E, 0x7C, 0xE0, 0xC0, 0xFC, 0xFE, 0xC3, 0xC3, 0x7E, 0x3C,  // 6
+    0xFF, 0xFF, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x60, 0x60,  // 7
+    0x3C, 0x7E, 0xC3, 0xC3, 0x7E, 0x7E, 0xC3, 0xC3, 0x7E, 0x3C,  // 8
+    0x3C, 0x7E, 0xC3, 0xC3, 0x7F, 0x3F, 0x03, 0x03, 0x3E, 0x7C,  // 9
+    0x3C, 0x7E, 0xC3, 0xC3, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3,  // A
+    0xFC, 0xFE, 0xC3, 0xC3, 0xFE, 0xFE, 0xC3, 0xC3, 0xFE, 0xFC,  // B
+    0x3C, 0x7E, 0xC3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0x7E, 0x3C,  // C
+    0xFC, 0xFE, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFE, 0xFC,  // D
+    0xFF, 0xFF, 0xC0, 0xC0, 0xFC, 0xFC, 0xC0, 0xC0, 0xFF, 0xFF,  // E
+    0xFF, 0xFF, 0xC0, 0xC0, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0   // F
+};
 
 /*
+ * Memory:
+ * 4096 bytes, see the memory map above.
+ *
  * Registers:
  * 16 general purpose 8-bit registers, usually referred to as Vx
  * where x is a hexadecimal digit.
  *
- * a char is 8-bits, so we store 16 of them
- * */
-unsigned char V[16] = {0};
-
-/*
  * Special 16-bit register called I
  * It is used to store memory addresses.
  *
- * a short is 16-bits
- * */
-unsigned short I = 0;
-
-/*
  * Pseudo-register: PC
  * The program counter is a 16-bit pseudo register used to
  * store the currectly executing address
- * */
-unsigned short pc = 0x200;
-
-/*
+ *
  * Pseudo-register: SP
  * The stack pointer register is used to point to the topmost level of the stack
  *
- * It is a 8-bit register
- * */
-unsigned char sp = 0;
-
-/*
  * The Stack:
  * Array of 16 16-bit values, used to store the address that the interpreter
  * should return to when finished with a subroutine
+ *
+ * The Display:
+ * A 64x32 px monochrome display, stored as one 64-bit word per row with
+ * column 0 in the most significant bit. SCHIP and XO-CHIP switch it to
+ * 128x64 (two words per row) and XO-CHIP draws on two such bitplanes,
+ * for four colors.
+ *
+ * Delay and sound timers count down to zero.
+ *
+ * All of the above lives in a chip8_t (see chip8.h), one per machine.
  * */
-unsigned short stack[16] = {0};
-
-// Keypad
-unsigned char keypad[16] = {0};
 
 /*
- * The Display:
- * A 64x32 px monochrome display
+==========================================================
+# CHIP-8 logic
+==========================================================
+*/
+
+/**
+ * reset: clear everything but the memory
+ * @param c the machine to reset
+ * @return void
  * */
-unsigned char display[64 * 32] = {0};
+static void reset(chip8_t* c) {
+    // registers, stack, keypad and rng sit in front of the memory
+    memset(c, 0, offsetof(chip8_t, memory));
+    memset(c->display, 0, sizeof(c->display));
+    c->pc = 0x200;
+    c->mem_mask = 0xFFF;
+    c->planes = 1;
+    c->pitch = 64;
+
+    // the block cache, jit, trace and profile outlive resets, the first two
+    // just have to forget everything (they only ever cover 4K)
+    if (c->cache) cache_invalidate(c->cache, 0, 4096);
+    if (c->jit) jit_invalidate(c->jit, 0, 4096);
+
+    seed_random(c, (uint32_t)time(NULL));
+}
 
-// Delay Timer
-unsigned char dt = 0;
+/**
+ * init_cpu: Initialize CPU by resetting the machine and loading fontset into mem
+ * @param c the machine to initialize
+ * @return void
+ * */
+void init_cpu(chip8_t* c) {
+    reset(c);
 
-// Sound Timer
-unsigned char st = 0;
+    // load fonts into memory, past 4K is cleared by set_mode() if the mode
+    // can reach it at all
+    memset(c->memory, 0, 4096);
+    memcpy(c->memory, fontset, sizeof(fontset));
+}
 
-// Update display flag
-unsigned char draw_flag = 0;
+/**
+ * boot_image: reset a machine straight into a prebuilt memory image
+ * @param c the machine to boot
+ * @param image 4K of memory, fonts and rom included (see make_image)
+ * @return void
+ *
+ * Same as init_cpu() followed by load_rom(), in a single copy.
+ * */
+void boot_image(chip8_t* c, const unsigned char* image) {
+    reset(c);
+    memcpy(c->memory, image, 4096);
+}
 
-// Play a sound flag
-unsigned char sound_flag = 0;
+/**
+ * make_image: build the memory image a rom boots from
+ * @param image 4K to fill
+ * @param rom the rom
+ * @param size the size of the rom, at most 0xE00 bytes
+ * @return void
+ * */
+void make_image(unsigned char* image, const unsigned char* rom, size_t size) {
+    memset(image, 0, 4096);
+    memcpy(image, fontset, sizeof(fontset));
+    memcpy(image + 0x200, rom, size);
+}
 
-/*
-==========================================================
-# CHIP-8 logic
-==========================================================
-*/
+/**
+ * set_mode: switch a freshly reset machine to an instruction set
+ * @param c the machine, before its rom is loaded
+ * @param mode MODE_CHIP8, MODE_SCHIP or MODE_XOCHIP
+ * @return void
+ * */
+void set_mode(chip8_t* c, int mode) {
+    c->mode = mode;
+    c->mem_mask = mode == MODE_XOCHIP ? 0xFFFF : 0xFFF;
+
+    // past 4K memory is only ever reachable in XO-CHIP mode
+    memset(c->memory + 4096, 0, sizeof(c->memory) - 4096);
+
+    if (mode != MODE_CHIP8) {
+        memcpy(c->memory + BIGFONT_ADDR, bigfontset, sizeof(bigfontset));
+        if (c->cache) {
+            cache_invalidate(c->cache, BIGFONT_ADDR, sizeof(bigfontset));
+        }
+        if (c->jit) jit_invalidate(c->jit, BIGFONT_ADDR, sizeof(bigfontset));
+    }
+}
 
 /**
- * init_cpu: Initialize CPU by loading fontset into mem
- * @param void
+ * parse_mode: read the name of a mode
+ * @param name "chip8", "schip" or "xochip"
+ * @return the mode, -1 if the name is unknown
+ * */
+int parse_mode(const char* name) {
+    if (!strcmp(name, "chip8")) return MODE_CHIP8;
+    if (!strcmp(name, "schip")) return MODE_SCHIP;
+    if (!strcmp(name, "xochip")) return MODE_XOCHIP;
+    return -1;
+}
+
+/**
+ * dirty_memory: mark the blocks covering some bytes of memory as changed
+ * @param c the machine
+ * @param addr the first byte, wrapping around memory like addresses do
+ * @param len the number of bytes
  * @return void
  * */
-void init_cpu(void) {
-    srand((unsigned int)time(NULL));
+void dirty_memory(chip8_t* c, size_t addr, size_t len) {
+    if (len == 0) return;
+
+    // every block in between has a byte at some multiple of DIRTY_BLOCK
+    for (size_t i = 0; i < len; i += DIRTY_BLOCK) {
+        size_t b = ((addr + i) & c->mem_mask) / DIRTY_BLOCK;
+        c->mem_dirty[b / 64] |= 1ULL << (b % 64);
+    }
 
-    // load fonts into memory
-    memcpy(memory, fontset, sizeof(fontset));
+    size_t b = ((addr + len - 1) & c->mem_mask) / DIRTY_BLOCK;
+    c->mem_dirty[b / 64] |= 1ULL << (b % 64);
+}
+
+/**
+ * seed_random: restart the random number generator of a machine
+ * @param c the machine
+ * @param seed any value, the same seed draws the same numbers
+ * @return void
+ * */
+void seed_random(chip8_t* c, uint32_t seed) {
+    // xorshift gets stuck on 0
+    c->rng = seed ? seed : 0x9E3779B9;
 }
 
 /**
  * load_rom: load the provided rom to memory
+ * @param c the machine to load the rom into
  * @param filename The rom filename
- * @return 0 if success, -1 if fread failure, errno if failure
+ * @return 0 if success, -1 if the rom doesn't fit in memory, errno if failure
+ *
+ * In XO-CHIP mode (see set_mode) roms may fill all of 64K.
  * */
-int load_rom(char* filename) {
-    FILE* fp = fopen(filename, "rb");
+int load_rom(chip8_t* c, char* filename) {
+    int fd = open(filename, O_RDONLY);
 
-    if (fp == NULL) return errno;
+    if (fd < 0) return errno;
 
+    // the size of the file we opened, not of whatever the path points to by
+    // now
     struct stat st;
-    stat(filename, &st);
+    if (fstat(fd, &st)) {
+        int error = errno;
+        close(fd);
+        return error;
+    }
+
     size_t fsize = st.st_size;
+    size_t room = c->mem_mask + 1 - 0x200;
+    size_t len = fsize < room ? fsize : room;
 
-    size_t bytes_read = fread(memory + 0x200, 1, sizeof(memory) - 0x200, fp);
-    
-    fclose(fp);
+    if (len) {
+        void* rom = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
 
-    if (bytes_read != fsize) {
-        return -1;
+        if (rom == MAP_FAILED) {
+            int error = errno;
+            close(fd);
+            return error;
+        }
+
+        memcpy(c->memory + 0x200, rom, len);
+        munmap(rom, len);
     }
 
-    return 0;
+    close(fd);
+
+    if (c->cache) cache_invalidate(c->cache, 0x200, len);
+    if (c->jit) jit_invalidate(c->jit, 0x200, len);
+
+    return fsize > room ? -1 : 0;
 }
 
+/*
+==========================================================
+# Instruction handlers
+==========================================================
+*/
+
+/*
+ * Every instruction is implemented by a handler taking the machine and the
+ * decoded instruction (see insn_t in chip8.h). Every dispatch engine (the
+ * nested switch, the 64K lookup table and the block cache) ends up calling
+ * one of these handlers, so they can't drift apart.
+ * */
+
 /**
- * emulate_cycle: run chip-8 instructions
- * @param void
+ * opcode_at: read the opcode at an address
+ * @param c the machine
+ * @param addr the address
+ * @return the opcode
+ * */
+static inline unsigned short opcode_at(const chip8_t* c, unsigned short addr) {
+    // addresses wrap around memory so a rogue rom can't reach outside of
+    // its own machine
+    return c->memory[addr & c->mem_mask] << 8 |
+           c->memory[(addr + 1) & c->mem_mask];
+}
+
+/**
+ * skip: step pc over the next instruction
+ * @param c the machine, pc at the skipping instruction
  * @return void
- *
- * 1) Fetch the operation code
- *      - fetch one opcode from the memory at the location specified by the
- * program counter. Each array address contains one byte, an opcode is 2 bytes
- * long so we need to fetch 2 consecutive bytes and merge them to get the actual
- * opcode.
- *          - for example:
- *              0xA2F0 --> pc = 0xA2, pc + 1 = 0xF0
- *              opcode = pc << 8 | pc + 1
- *                  - shifting A0 left by 8 bits, which adds 8 zeros (0xA200)
- *                  - bitwise OR to merge them
- *
- * 2) Decode the operation code
- *      - look up to the optable to see what the op means
- *          - for example:
- *              0xA2F0 --> ANNN: sets I to the address NNN (0x2F0)
- * 3) Execute the operation code
- *      - execute the parsed op
- *          - for example:
- *              0xA2F0 --> store 0x2F0 into the I register, as only 12-bits are
- * containing the value we need to store, we use a bitwise AND (with the value
- * 0x0FFF) to get rid of the first four bits.
- *                  - I =  opcode & 0x0FFF
- *                    pc += 2 --> every instruction is 2 bytes long
- * 4) Update timers
- *      - count to zero at 60hz if they are set to a number greater than 0
  * */
-void emulate_cycle(void) {
-    draw_flag = 0;
-    sound_flag = 0;
+static inline void skip(chip8_t* c) {
+    c->pc += 2;
 
-    unsigned short op = memory[pc] << 8 | memory[pc + 1];
+    // F000 NNNN is the only 4-byte instruction
+    if (c->mode == MODE_XOCHIP && opcode_at(c, c->pc) == 0xF000) c->pc += 2;
+}
 
-    // Vx register, we are basically "grabbing" the x present in some
-    // instructions like 3XNN
-    unsigned short x = (op & 0x0F00) >> 8;
+// opcodes the mode of the machine doesn't have behave as they always did:
+// they do nothing, pc included
+#define REQUIRE(c, m)            \
+    do {                         \
+        if ((c)->mode < (m)) {   \
+            return;              \
+        }                        \
+    } while (0)
 
-    // Vy register, we are basically "grabbing" the y present in some
-    // instructions like 5XY0
-    unsigned short y = (op & 0x00F0) >> 4;
+// rows of the display, and words per row
+#define ROWS(c) ((c)->hires ? 64 : 32)
+#define ROW_WORDS(c) ((c)->hires ? 2 : 1)
+// one fb_dirty bit per row
+#define ALL_ROWS(c) ((c)->hires ? ~0ULL : 0xFFFFFFFFULL)
+
+// 00E0: Clears the screen (the selected planes of it)
+static void op_00e0(chip8_t* c, const insn_t* in) {
+    (void)in;
+    for (int p = 0; p < DISPLAY_PLANES; p++) {
+        if ((c->planes >> p) & 1) {
+            memset(c->display[p], 0, ROWS(c) * ROW_WORDS(c) * 8);
+        }
+    }
+    c->fb_dirty = ALL_ROWS(c);
+    c->draw_flag = 1;
+    c->pc += 2;
+}
 
-    switch (op & 0xF000) {
-        // we need extra checking
-        case 0x0000:
-            switch (op & 0x00FF) {
-                // 00E0: Clears the screen
-                case 0x00E0:
-                    debug_print("[OK] 0x%X: 00E0\n", op);
-                    for (int i = 0; i < 64 * 32; i++) {
-                        display[i] = 0;
-                    }
-                    pc += 2;
-                    break;
-                // 00EE: Returns from a subroutine
-                case 0x00EE:
-                    debug_print("[OK] 0x%X: 00EE\n", op);
-                    pc = stack[sp];
-                    sp--;
-                    pc += 2;
-                    break;
-                default:
-                    debug_print("[FAILED] Unknown opcode: 0x%X\n", op);
-                    break;
-            }
-            break;
-
-        // 1NNN: Jumps to address NNN
-        case 0x1000:
-            debug_print("[OK] 0x%X: 1NNN\n", op);
-            pc = op & 0x0FFF;
-            break;
-
-        // 2NNN: Calls subroutine at NNN
-        case 0x2000:
-            debug_print("[OK] 0x%X: 2NNN\n", op);
-
-            /*
-             * We need to jump to NNN so we should store the current
-             * address of the program counter in the stack. But before storing
-             * we increment the stack pointer to prevent overwriting the current
-             * stack. After correctly storing the address we can set the pc to
-             * the address NNN. Since we are calling a subroutine at a specific
-             * address we don't have to increase the program counter by two.
-             * */
-            sp += 1;
-            stack[sp] = pc;
-            pc = op & 0x0FFF;  // getting the NNN
-            break;
-
-        // 3XNN: Skips the next instruction if Vx equals NN
-        case 0x3000:
-            debug_print("[OK] 0x%X: 3XNN\n", op);
-
-            // (big-endian) a right shift by 8 increases the byte addr by 1
-            if (V[x] == (op & 0x00FF)) {
-                pc += 2;
-            }
+/*
+ * Scrolling moves whole words: a row is one or two of them, so scrolling
+ * vertically is a memmove of the plane and horizontally a shift per row
+ * (carrying across the two words of a hires row). Nothing wraps around.
+ * */
 
-            pc += 2;
-            break;
+/**
+ * scroll_down: scroll the selected planes down, negative to go up
+ * @param c the machine
+ * @param n rows
+ * @return void
+ * */
+static void scroll_down(chip8_t* c, int n) {
+    int rows = ROWS(c), words = ROW_WORDS(c);
+    int keep = rows - (n < 0 ? -n : n);
+
+    if (keep < 0) keep = 0;
+
+    for (int p = 0; p < DISPLAY_PLANES; p++) {
+        if (!((c->planes >> p) & 1)) continue;
+
+        uint64_t* plane = c->display[p];
+        if (n > 0) {
+            memmove(plane + (rows - keep) * words, plane, keep * words * 8);
+            memset(plane, 0, (rows - keep) * words * 8);
+        } else {
+            memmove(plane, plane + (rows - keep) * words, keep * words * 8);
+            memset(plane + keep * words, 0, (rows - keep) * words * 8);
+        }
+    }
 
-        // 4XNN: Skips the next instruction if Vx !equal NN
-        case 0x4000:
-            debug_print("[OK] 0x%X: 4XNN\n", op);
+    c->fb_dirty = ALL_ROWS(c);
+    c->draw_flag = 1;
+}
 
-            if (V[x] != (op & 0x00FF)) {
-                pc += 2;
+/**
+ * scroll_right: scroll the selected planes right, negative to go left
+ * @param c the machine
+ * @param n columns, less than 64
+ * @return void
+ * */
+static void scroll_right(chip8_t* c, int n) {
+    for (int p = 0; p < DISPLAY_PLANES; p++) {
+        if (!((c->planes >> p) & 1)) continue;
+
+        uint64_t* w = c->display[p];
+        for (int y = 0; y < ROWS(c); y++, w += ROW_WORDS(c)) {
+            if (!c->hires) {
+                w[0] = n > 0 ? w[0] >> n : w[0] << -n;
+            } else if (n > 0) {
+                w[1] = (w[1] >> n) | (w[0] << (64 - n));
+                w[0] >>= n;
+            } else {
+                w[0] = (w[0] << -n) | (w[1] >> (64 + n));
+                w[1] <<= -n;
             }
+        }
+    }
 
-            pc += 2;
-            break;
+    c->fb_dirty = ALL_ROWS(c);
+    c->draw_flag = 1;
+}
 
-        // 5XY0: Skips the next instruction if Vx equals Vy
-        case 0x5000:
-            debug_print("[OK] 0x%X: 5XY0\n", op);
+// 00CN: Scrolls the display down by N rows (SCHIP)
+static void op_00cn(chip8_t* c, const insn_t* in) {
+    REQUIRE(c, MODE_SCHIP);
+    scroll_down(c, in->n);
+    c->pc += 2;
+}
 
-            if (V[x] == V[y]) {
-                pc += 2;
-            }
+// 00DN: Scrolls the display up by N rows (XO-CHIP)
+static void op_00dn(chip8_t* c, const insn_t* in) {
+    REQUIRE(c, MODE_XOCHIP);
+    scroll_down(c, -in->n);
+    c->pc += 2;
+}
 
-            pc += 2;
-            break;
+// 00FB: Scrolls the display right by 4 columns (SCHIP)
+static void op_00fb(chip8_t* c, const insn_t* in) {
+    (void)in;
+    REQUIRE(c, MODE_SCHIP);
+    scroll_right(c, 4);
+    c->pc += 2;
+}
 
-        // 6XNN: Sets Vx to NN
-        case 0x6000:
-            debug_print("[OK] 0x%X: 6XNN\n", op);
+// 00FC: Scrolls the display left by 4 columns (SCHIP)
+static void op_00fc(chip8_t* c, const insn_t* in) {
+    (void)in;
+    REQUIRE(c, MODE_SCHIP);
+    scroll_right(c, -4);
+    c->pc += 2;
+}
 
-            V[x] = (op & 0x00FF);
-            pc += 2;
-            break;
+// 00FD: Exits the interpreter (SCHIP), the machine stays on it for good
+static void op_00fd(chip8_t* c, const insn_t* in) {
+    (void)c;
+    (void)in;
+}
 
-        // 7XNN: Adds NN to Vx
-        case 0x7000:
-            debug_print("[OK] 0x%X: 7XNN\n", op);
+// 00FE / 00FF: Switches to lores / hires (SCHIP), clearing the display
+static void op_00fe(chip8_t* c, const insn_t* in) {
+    REQUIRE(c, MODE_SCHIP);
+    c->hires = in->n == 0xF;
+    memset(c->display, 0, sizeof(c->display));
+    c->fb_dirty = ALL_ROWS(c);
+    c->draw_flag = 1;
+    c->pc += 2;
+}
 
-            V[x] += op & 0x00FF;
-            pc += 2;
-            break;
+// 00EE: Returns from a subroutine
+static void op_00ee(chip8_t* c, const insn_t* in) {
+    (void)in;
+    c->pc = c->stack[c->sp];
+    c->sp = (c->sp - 1) & 0xF;
+    c->pc += 2;
+}
 
-        // 8XYn: Multiple instructions where n is a number 0-7 or E
-        case 0x8000:
-            switch (op & 0x000F) {
-                // 8XY0: Sets Vx to the value of Vy
-                case 0x0000:
-                    debug_print("[OK] 0x%X: 8XY0\n", op);
+// 1NNN: Jumps to address NNN
+static void op_1nnn(chip8_t* c, const insn_t* in) {
+    c->pc = in->nnn;
+}
 
-                    V[x] = V[y];
-                    pc += 2;
-                    break;
+// 2NNN: Calls subroutine at NNN
+static void op_2nnn(chip8_t* c, const insn_t* in) {
+    /*
+     * We need to jump to NNN so we should store the current
+     * address of the program counter in the stack. But before storing
+     * we increment the stack pointer to prevent overwriting the current
+     * stack. After correctly storing the address we can set the pc to
+     * the address NNN. Since we are calling a subroutine at a specific
+     * address we don't have to increase the program counter by two.
+     * */
+    c->sp = (c->sp + 1) & 0xF;
+    c->stack[c->sp] = c->pc;
+    c->pc = in->nnn;  // getting the NNN
+}
 
-                // 8XY1: Sets Vx to Vx | Vy
-                case 0x0001:
-                    debug_print("[OK] 0x%X: 8XY1\n", op);
+// 3XNN: Skips the next instruction if Vx equals NN
+static void op_3xnn(chip8_t* c, const insn_t* in) {
+    // (big-endian) a right shift by 8 increases the byte addr by 1
+    if (c->V[in->x] == in->nn) {
+        skip(c);
+    }
 
-                    V[x] = (V[x] | V[y]);
-                    pc += 2;
-                    break;
+    c->pc += 2;
+}
 
-                // 8XY2: Sets Vx to Vx & Vy
-                case 0x0002:
-                    debug_print("[OK] 0x%X: 8XY2\n", op);
+// 4XNN: Skips the next instruction if Vx !equal NN
+static void op_4xnn(chip8_t* c, const insn_t* in) {
+    if (c->V[in->x] != in->nn) {
+        skip(c);
+    }
 
-                    V[x] = (V[x] & V[y]);
-                    pc += 2;
-                    break;
+    c->pc += 2;
+}
 
-                // 8XY3: Sets vx to Vx
-                case 0x0003:
-                    debug_print("[OK] 0x%X: 8XY3\n", op);
+// 5XY0: Skips the next instruction if Vx equals Vy
+static void op_5xy0(chip8_t* c, const insn_t* in) {
+    if (c->V[in->x] == c->V[in->y]) {
+        skip(c);
+    }
 
-                    V[x] = (V[x] ^ V[y]);
-                    pc += 2;
-                    break;
+    c->pc += 2;
+}
 
-                // 8XY4: Adds Vy to Vx. Vf is set to 1 when there's a carry
-                case 0x0004:
-                    debug_print("[OK] 0x%X: 8XY4\n", op);
+// 6XNN: Sets Vx to NN
+static void op_6xnn(chip8_t* c, const insn_t* in) {
+    c->V[in->x] = in->nn;
+    c->pc += 2;
+}
 
-                    V[0xF] = (V[x] + V[y] > 0xFF) ? 1 : 0;
-                    V[x] += V[y];
+// 7XNN: Adds NN to Vx
+static void op_7xnn(chip8_t* c, const insn_t* in) {
+    c->V[in->x] += in->nn;
+    c->pc += 2;
+}
 
-                    pc += 2;
-                    break;
+// 8XY0: Sets Vx to the value of Vy
+static void op_8xy0(chip8_t* c, const insn_t* in) {
+    c->V[in->x] = c->V[in->y];
+    c->pc += 2;
+}
 
-                // 8XY5: Vy is substracted from Vx. Vf is set to 0 when there's
-                // a borrow
-                case 0x0005:
-                    debug_print("[OK] 0x%X: 8XY5\n", op);
+// 8XY1: Sets Vx to Vx | Vy
+static void op_8xy1(chip8_t* c, const insn_t* in) {
+    c->V[in->x] = (c->V[in->x] | c->V[in->y]);
+    c->pc += 2;
+}
 
-                    V[0xF] = (V[x] > V[y]) ? 1 : 0;
-                    V[x] -= V[y];
+// 8XY2: Sets Vx to Vx & Vy
+static void op_8xy2(chip8_t* c, const insn_t* in) {
+    c->V[in->x] = (c->V[in->x] & c->V[in->y]);
+    c->pc += 2;
+}
 
-                    pc += 2;
-                    break;
+// 8XY3: Sets vx to Vx
+static void op_8xy3(chip8_t* c, const insn_t* in) {
+    c->V[in->x] = (c->V[in->x] ^ c->V[in->y]);
+    c->pc += 2;
+}
+
+// 8XY4: Adds Vy to Vx. Vf is set to 1 when there's a carry
+static void op_8xy4(chip8_t* c, const insn_t* in) {
+    c->V[0xF] = (c->V[in->x] + c->V[in->y] > 0xFF) ? 1 : 0;
+    c->V[in->x] += c->V[in->y];
+
+    c->pc += 2;
+}
+
+// 8XY5: Vy is substracted from Vx. Vf is set to 0 when there's a borrow
+static void op_8xy5(chip8_t* c, const insn_t* in) {
+    c->V[0xF] = (c->V[in->x] > c->V[in->y]) ? 1 : 0;
+    c->V[in->x] -= c->V[in->y];
+
+    c->pc += 2;
+}
+
+// 8XY6: Stores the least significant bit of Vx in Vf and then shifts Vx to
+// the right by 1
+static void op_8xy6(chip8_t* c, const insn_t* in) {
+    c->V[0xF] = c->V[in->x] & 0x1;
+    c->V[in->x] = (c->V[in->x] >> 1);
+
+    c->pc += 2;
+}
+
+// 8XY7: Sets Vx to Vy minus Vx. Vf is set to 0 when there's a borrow.
+static void op_8xy7(chip8_t* c, const insn_t* in) {
+    c->V[0xF] = (c->V[in->y] > c->V[in->x]) ? 1 : 0;
+    c->V[in->x] = c->V[in->y] - c->V[in->x];
+
+    c->pc += 2;
+}
+
+// 8XYE: Stores the most significant bit of Vx in Vf and shifts Vx to the
+// left by 1
+static void op_8xye(chip8_t* c, const insn_t* in) {
+    c->V[0xF] = (c->V[in->x] >> 7) & 0x1;
+    c->V[in->x] = (c->V[in->x] << 1);
+
+    c->pc += 2;
+}
+
+// 9XY0: SKips the next instruction if Vx !equal Vy
+static void op_9xy0(chip8_t* c, const insn_t* in) {
+    if (c->V[in->x] != c->V[in->y]) {
+        skip(c);
+    }
+
+    c->pc += 2;
+}
+
+// ANNN: Sets I to the address NNN
+static void op_annn(chip8_t* c, const insn_t* in) {
+    c->I = in->nnn;
+    c->pc += 2;
+}
+
+// BNNN: Jumps to the address NNN plus V0
+static void op_bnnn(chip8_t* c, const insn_t* in) {
+    c->pc = in->nnn + c->V[0];
+}
+
+// CXNN: Sets Vx to the result of a bitwise and operation on a random number
+// and NN
+static void op_cxnn(chip8_t* c, const insn_t* in) {
+    // xorshift32, the state lives in the machine so runs can be replayed
+    uint32_t x = c->rng;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    c->rng = x;
+
+    c->V[in->x] = (x >> 24) & in->nn;
+    c->pc += 2;
+}
 
-                // 8XY6: Stores the least significant bit of Vx in Vf and then
-                // shifts Vx to the right by 1
-                case 0x0006:
-                    debug_print("[OK] 0x%X: 8XY6\n", op);
+/*
+ * DXYN:
+ *
+ * Draws a 8px * (N+1)px sprite at (V[x], Vy)
+ * Each row of 8 pixels is read as bit-coded starting
+ * from memory location I; I value doesn't change
+ * after the execution of this instruction.
+ * As described above, V[F] is set to 1
+ * if any screen pixels are flipped from set
+ * to unset when the sprite is
+ * drawn, and to 0 if that doesn't happen.
+ *
+ * SCHIP and XO-CHIP draw on the hires display too, DXY0 draws a 16x16
+ * sprite (two bytes per row) and XO-CHIP draws on every selected plane,
+ * the sprite of each plane following the one of the previous plane.
+ */
+static void draw_sprite(chip8_t* c, const insn_t* in);
+
+static void op_dxyn(chip8_t* c, const insn_t* in) {
+    if (c->mode != MODE_CHIP8) {
+        draw_sprite(c, in);
+        return;
+    }
 
-                    V[0xF] = V[x] & 0x1;
-                    V[x] = (V[x] >> 1);
+    c->draw_flag = 1;
 
-                    pc += 2;
-                    break;
+    // coordinates are latched before VF is reset, they may live in VF
+    unsigned short x = c->V[in->x] & 63;
+    unsigned short y = c->V[in->y];
+    unsigned short height = in->n;
+    uint64_t collision = 0;
 
-                // 8XY7: Sets Vx to Vy minus Vx. Vf is set to 0 when there's a
-                // borrow.
-                case 0x0007:
-                    debug_print("[OK] 0x%X: 8XY7\n", op);
+    // loop over each row
+    for (int yline = 0; yline < height; yline++) {
+        // fetch the pixel value from the memory starting at location I and
+        // line it up with column 0 (the most significant bit of a row)
+        uint64_t px = (uint64_t)c->memory[(c->I + yline) & 0xFFF] << 56;
 
-                    V[0xF] = (V[y] > V[x]) ? 1 : 0;
-                    V[x] = V[y] - V[x];
+        // move it to column x, pixels falling off the right edge wrap
+        // around to the left one
+        uint64_t sprite = x ? (px >> x) | (px << (64 - x)) : px;
 
-                    pc += 2;
-                    break;
+        // rows wrap around too
+        uint64_t* row = &c->display[0][(y + yline) & 31];
+        c->fb_dirty |= 1ULL << ((y + yline) & 31);
 
-                // 8XYE: Stores the most significant bit of Vx in Vf and shifts
-                // Vx to the left by 1
-                case 0x000E:
-                    debug_print("[OK] 0x%X: 8XYE\n", op);
+        // drawing erases a pixel wherever sprite and row overlap, then the
+        // sprite is XORed in, a whole row at a time
+        collision |= *row & sprite;
+        *row ^= sprite;
+    }
+
+    // V[F] is set to 1 if drawing caused any pixel to be erased
+    c->V[0xF] = collision != 0;
 
-                    V[0xF] = (V[x] >> 7) & 0x1;
-                    V[x] = (V[x] << 1);
+    c->pc += 2;
+}
+
+/**
+ * rotate128: rotate a 128-bit row right
+ * @param w the two words of the row, column 0 in the top bit of w[0]
+ * @param n columns, 0 to 127
+ * @return void
+ * */
+static inline void rotate128(uint64_t* w, unsigned int n) {
+    uint64_t a = w[0], b = w[1];
+
+    if (n & 64) {
+        a = w[1];
+        b = w[0];
+    }
 
-                    pc += 2;
-                    break;
+    n &= 63;
+    w[0] = n ? (a >> n) | (b << (64 - n)) : a;
+    w[1] = n ? (b >> n) | (a << (64 - n)) : b;
+}
 
-                default:
-                    printf("[FAILED] Unknown op: 0x%X\n", op);
-                    break;
+/**
+ * draw_sprite: DXYN of the SCHIP and XO-CHIP modes
+ * @param c the machine
+ * @param in the instruction
+ * @return void
+ * */
+static void draw_sprite(chip8_t* c, const insn_t* in) {
+    unsigned int rows = ROWS(c), cols = c->hires ? 128 : 64;
+    unsigned int x = c->V[in->x] & (cols - 1);
+    unsigned int y = c->V[in->y] & (rows - 1);
+    unsigned int height = in->n ? in->n : 16;
+    int wide = in->n == 0;
+    unsigned short addr = c->I;
+    uint64_t collision = 0;
+
+    c->draw_flag = 1;
+
+    for (int p = 0; p < DISPLAY_PLANES; p++) {
+        if (!((c->planes >> p) & 1)) continue;
+
+        for (unsigned int yline = 0; yline < height; yline++) {
+            // line the sprite row up with column 0
+            uint64_t px = (uint64_t)c->memory[addr++ & c->mem_mask] << 56;
+            if (wide) px |= (uint64_t)c->memory[addr++ & c->mem_mask] << 48;
+
+            // then move it to column x, wrapping around like rows do
+            unsigned int r = (y + yline) & (rows - 1);
+            c->fb_dirty |= 1ULL << r;
+
+            if (c->hires) {
+                uint64_t sprite[2] = {px, 0};
+                uint64_t* row = &c->display[p][2 * r];
+
+                rotate128(sprite, x);
+                collision |= (row[0] & sprite[0]) | (row[1] & sprite[1]);
+                row[0] ^= sprite[0];
+                row[1] ^= sprite[1];
+            } else {
+                uint64_t sprite = x ? (px >> x) | (px << (64 - x)) : px;
+                uint64_t* row = &c->display[p][r];
+
+                collision |= *row & sprite;
+                *row ^= sprite;
             }
-            break;
+        }
+    }
+
+    c->V[0xF] = collision != 0;
+    c->pc += 2;
+}
+
+// EX9E: Skips the next instruction if the key store in Vx is pressed
+static void op_ex9e(chip8_t* c, const insn_t* in) {
+    if ((c->keypad >> (c->V[in->x] & 0xF)) & 1) {
+        skip(c);
+    }
+
+    c->pc += 2;
+}
+
+// EXA1: Skips the next instruction if the key store in Vx isn't pressed
+static void op_exa1(chip8_t* c, const insn_t* in) {
+    if (!((c->keypad >> (c->V[in->x] & 0xF)) & 1)) {
+        skip(c);
+    }
 
-        // 9XY0: SKips the next instruction if Vx !equal Vy
-        case 0x9000:
-            debug_print("[OK] 0x%X: 9XY0", op);
+    c->pc += 2;
+}
+
+// FX07: Sets Vx to the value of the delay timer
+static void op_fx07(chip8_t* c, const insn_t* in) {
+    c->V[in->x] = c->dt;
+
+    c->pc += 2;
+}
+
+// FX0A: A key press is awaited and then stored in Vx (blocking)
+static void op_fx0a(chip8_t* c, const insn_t* in) {
+    // the lowest key down wins
+    if (c->keypad) {
+        c->V[in->x] = __builtin_ctz(c->keypad);
+        c->pc += 2;
+    }
+}
+
+// FX15: Sets the delay timer to Vx
+static void op_fx15(chip8_t* c, const insn_t* in) {
+    c->dt = c->V[in->x];
+    c->pc += 2;
+}
+
+// FX18: Sets the sound timer to Vx
+static void op_fx18(chip8_t* c, const insn_t* in) {
+    c->st = c->V[in->x];
+    c->pc += 2;
+}
+
+// FX1E: Adds Vx to I
+static void op_fx1e(chip8_t* c, const insn_t* in) {
+    c->I += c->V[in->x];
+    c->pc += 2;
+}
+
+// FX29: Sets I to the location of the sprite for the character in Vx
+static void op_fx29(chip8_t* c, const insn_t* in) {
+    // each digit is 5 bytes long
+    c->I = c->V[in->x] * 5;
+    c->pc += 2;
+}
+
+// FX30: Sets I to the location of the big sprite for the digit in Vx (SCHIP)
+static void op_fx30(chip8_t* c, const insn_t* in) {
+    REQUIRE(c, MODE_SCHIP);
+    c->I = BIGFONT_ADDR + (c->V[in->x] & 0xF) * 10;
+    c->pc += 2;
+}
+
+// FX75: Stores V0 through Vx in the flag registers (SCHIP)
+static void op_fx75(chip8_t* c, const insn_t* in) {
+    REQUIRE(c, MODE_SCHIP);
+    memcpy(c->flags, c->V, in->x + 1);
+    c->pc += 2;
+}
+
+// FX85: Fills V0 through Vx from the flag registers (SCHIP)
+static void op_fx85(chip8_t* c, const insn_t* in) {
+    REQUIRE(c, MODE_SCHIP);
+    memcpy(c->V, c->flags, in->x + 1);
+    c->pc += 2;
+}
+
+// F000 NNNN: Sets I to the 16-bit address NNNN that follows (XO-CHIP)
+static void op_f000(chip8_t* c, const insn_t* in) {
+    (void)in;
+    REQUIRE(c, MODE_XOCHIP);
+    c->I = opcode_at(c, c->pc + 2);
+    c->pc += 4;
+}
+
+// FN01: Selects the planes N that drawing and scrolling act on (XO-CHIP)
+static void op_fn01(chip8_t* c, const insn_t* in) {
+    REQUIRE(c, MODE_XOCHIP);
+    c->planes = in->x & 3;
+    c->pc += 2;
+}
+
+// F002: Loads the 16-byte audio pattern at I (XO-CHIP)
+static void op_f002(chip8_t* c, const insn_t* in) {
+    (void)in;
+    REQUIRE(c, MODE_XOCHIP);
+    for (int i = 0; i < 16; i++) {
+        c->pattern[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+    c->has_pattern = 1;
+    c->pc += 2;
+}
+
+// FX3A: Sets the pitch of the audio pattern to Vx (XO-CHIP)
+static void op_fx3a(chip8_t* c, const insn_t* in) {
+    REQUIRE(c, MODE_XOCHIP);
+    c->pitch = c->V[in->x];
+    c->pc += 2;
+}
+
+/**
+ * wrote_memory: mark memory dirty, and let the block cache and the jit know
+ * the rom may have modified itself
+ * @param c the machine
+ * @param addr first byte written
+ * @param len number of bytes written
+ * @return void
+ * */
+static inline void wrote_memory(chip8_t* c, unsigned short addr,
+                                unsigned short len) {
+    dirty_memory(c, addr, len);
+    if (c->cache) cache_invalidate(c->cache, addr & 0xFFF, len);
+    if (c->jit) jit_invalidate(c->jit, addr & 0xFFF, len);
+}
+
+// 5XY2: Stores Vx through Vy (either way round) in memory starting at addr
+// I (XO-CHIP)
+static void op_5xy2(chip8_t* c, const insn_t* in) {
+    int step = in->x <= in->y ? 1 : -1;
+    int n = (in->y - in->x) * step + 1;
+
+    if (c->mode < MODE_XOCHIP) {
+        op_5xy0(c, in);
+        return;
+    }
+
+    for (int i = 0; i < n; i++) {
+        c->memory[(c->I + i) & c->mem_mask] = c->V[in->x + i * step];
+    }
+    wrote_memory(c, c->I, n);
+
+    c->pc += 2;
+}
+
+// 5XY3: Fills Vx through Vy (either way round) with values from memory
+// starting at addr I (XO-CHIP)
+static void op_5xy3(chip8_t* c, const insn_t* in) {
+    int step = in->x <= in->y ? 1 : -1;
+    int n = (in->y - in->x) * step + 1;
+
+    if (c->mode < MODE_XOCHIP) {
+        op_5xy0(c, in);
+        return;
+    }
+
+    for (int i = 0; i < n; i++) {
+        c->V[in->x + i * step] = c->memory[(c->I + i) & c->mem_mask];
+    }
+
+    c->pc += 2;
+}
+
+/*
+ * FX33:
+ *
+ * Stores the binary-coded decimal representation
+ * of VX, with the most significant of three digits
+ * at the address in I, the middle digit at I plus
+ * 1, and the least significant digit at I plus 2.
+ * (In other words, take the decimal representation
+ * of VX, place the hundreds digit in memory
+ * at location in I, the tens digit at
+ * location I+1, and the ones digit at
+ * location I+2.)
+ * */
+static void op_fx33(chip8_t* c, const insn_t* in) {
+    unsigned char vx = c->V[in->x];
 
-            if (V[x] != V[y]) {
-                pc += 2;
+    c->memory[c->I & c->mem_mask] = (vx % 1000) / 100;
+    c->memory[(c->I + 1) & c->mem_mask] = (vx % 100) / 10;
+    c->memory[(c->I + 2) & c->mem_mask] = (vx % 10);
+    wrote_memory(c, c->I, 3);
+
+    c->pc += 2;
+}
+
+// FX55: Stores V0 through Vx (Vx included) in memory starting at addr I.
+static void op_fx55(chip8_t* c, const insn_t* in) {
+    for (int i = 0; i <= in->x; i++) {
+        c->memory[(c->I + i) & c->mem_mask] = c->V[i];
+    }
+    wrote_memory(c, c->I, in->x + 1);
+
+    c->pc += 2;
+}
+
+// FX65: Fills V0 through Vx (Vx included) with values from memory starting
+// at addr I.
+static void op_fx65(chip8_t* c, const insn_t* in) {
+    for (int i = 0; i <= in->x; i++) {
+        c->V[i] = c->memory[(c->I + i) & c->mem_mask];
+    }
+
+    c->pc += 2;
+}
+
+static void op_unknown(chip8_t* c, const insn_t* in) {
+    (void)c;
+    (void)in;
+}
+
+/*
+==========================================================
+# Dispatch
+==========================================================
+*/
+
+/**
+ * decode: find the handler of an opcode
+ * @param op the opcode
+ * @return the handler implementing op
+ * */
+static inline handler_t decode(unsigned short op) {
+    switch (op & 0xF000) {
+        // we need extra checking
+        case 0x0000:
+            switch (op & 0x00FF) {
+                case 0x00E0: return op_00e0;
+                case 0x00EE: return op_00ee;
+                case 0x00FB: return op_00fb;
+                case 0x00FC: return op_00fc;
+                case 0x00FD: return op_00fd;
+                case 0x00FE: return op_00fe;
+                case 0x00FF: return op_00fe;
+            }
+            if ((op & 0xFFF0) == 0x00C0) return op_00cn;
+            if ((op & 0xFFF0) == 0x00D0) return op_00dn;
+            return op_unknown;
+
+        case 0x1000: return op_1nnn;
+        case 0x2000: return op_2nnn;
+        case 0x3000: return op_3xnn;
+        case 0x4000: return op_4xnn;
+        case 0x5000:
+            switch (op & 0x000F) {
+                case 0x0002: return op_5xy2;
+                case 0x0003: return op_5xy3;
+                default: return op_5xy0;
             }
+        case 0x6000: return op_6xnn;
+        case 0x7000: return op_7xnn;
 
-            pc += 2;
-            break;
-
-        // ANNN: Sets I to the address NNN
-        case 0xA000:
-            debug_print("[OK] 0x%X: ANNN\n", op);
-
-            I = op & 0x0FFF;
-            pc += 2;
-            break;
-
-        // BNNN: Jumps to the address NNN plus V0
-        case 0xB000:
-            debug_print("[OK] 0x%X: BNNN\n", op);
-
-            pc = (op & 0x0FFF) + V[0];
-            break;
-
-        // CXNN: Sets Vx to the result of a bitwise and operation on a random
-        // number and NN
-        case 0xC000:
-            debug_print("[OK] 0x%X: CXNN\n", op);
-
-            V[x] = (rand() % 256) & (op & 0x00FF);
-            pc += 2;
-            break;
-
-        /*
-         * DXYN:
-         *
-         * Draws a 8px * (N+1)px sprite at (V[x], Vy)
-         * Each row of 8 pixels is read as bit-coded starting
-         * from memory location I; I value doesn't change
-         * after the execution of this instruction.
-         * As described above, V[F] is set to 1
-         * if any screen pixels are flipped from set
-         * to unset when the sprite is
-         * drawn, and to 0 if that doesn't happen.
-         */
-        case 0xD000:
-            debug_print("[OK] 0x%X: DXYN\n", op);
-            draw_flag = 1;
-
-            unsigned short height = op & 0x000F;
-            unsigned short px;
-
-            // set collision flag to 0
-            V[0xF] = 0;
-
-            // loop over each row
-            for (int yline = 0; yline < height; yline++) {
-                // fetch the pixel value from the memory starting at location I
-                px = memory[I + yline];
-
-                // loop over 8 bits of one row
-                for (int xline = 0; xline < 8; xline++) {
-                    // check if current evaluated pixel is set to 1 (0x80 >>
-                    // xline scnas throught the byte, one bit at the time)
-                    if ((px & (0x80 >> xline)) != 0) {
-                        // if drawing causes any pixel to be erased set the
-                        // collision flag to 1
-                        if (display[(V[x] + xline + ((V[y] + yline) * 64))] ==
-                            1) {
-                            V[0xF] = 1;
-                        }
-
-                        // set pixel value by using XOR
-                        display[V[x] + xline + ((V[y] + yline) * 64)] ^= 1;
-                    }
-                }
+        // 8XYn: Multiple instructions where n is a number 0-7 or E
+        case 0x8000:
+            switch (op & 0x000F) {
+                case 0x0000: return op_8xy0;
+                case 0x0001: return op_8xy1;
+                case 0x0002: return op_8xy2;
+                case 0x0003: return op_8xy3;
+                case 0x0004: return op_8xy4;
+                case 0x0005: return op_8xy5;
+                case 0x0006: return op_8xy6;
+                case 0x0007: return op_8xy7;
+                case 0x000E: return op_8xye;
+                default: return op_unknown;
             }
 
-            pc += 2;
-            break;
+        case 0x9000: return op_9xy0;
+        case 0xA000: return op_annn;
+        case 0xB000: return op_bnnn;
+        case 0xC000: return op_cxnn;
+        case 0xD000: return op_dxyn;
 
         // 2 instructions: 9E and A1
         case 0xE000:
             switch (op & 0x00FF) {
-                // EX9E: Skips the next instruction if the key store in Vx is
-                // pressed
-                case 0x009E:
-                    debug_print("[OK] 0x%X: EX9E\n", op);
-                    if (keypad[V[x]]) {
-                        pc += 2;
-                    }
-
-                    pc += 2;
-                    break;
-
-                // EXA1: Skips the next instruction if the key store in Vx isn't
-                // pressed
-                case 0x00A1:
-                    debug_print("[OK] 0x%X: EXA1\n", op);
-                    if (!keypad[V[x]]) {
-                        pc += 2;
-                    }
-
-                    pc += 2;
-                    break;
-
-                default:
-                    printf("[FAILED] Unknown op: 0x%X", op);
+                case 0x009E: return op_ex9e;
+                case 0x00A1: return op_exa1;
+                default: return op_unknown;
             }
-            break;
 
-        // Set of 7 instructions starting with FX
+        // Set of 9 instructions starting with FX, and the SCHIP and XO-CHIP
+        // ones
         case 0xF000:
+            if (op == 0xF000) return op_f000;
+            if (op == 0xF002) return op_f002;
+
             switch (op & 0x00FF) {
-                // FX07: Sets Vx to the value of the delay timer
-                case 0x0007:
-                    debug_print("[OK] 0x%X: FX07\n", op);
-                    V[x] = dt;
-
-                    pc += 2;
-                    break;
-
-                // FX0A: A key press is awaited and then stored in Vx (blocking)
-                case 0x000A:
-                    debug_print("[OK] 0x%X: FX0A\n", op);
-
-                    for (int i = 0; i < 16; i++) {
-                        if (keypad[i]) {
-                            V[x] = i;
-                            pc += 2;
-                            break;
-                        }
-                    }
-                    break;
-
-                // FX15: Sets the delay timer to Vx
-                case 0x0015:
-                    debug_print("[OK] 0x%X: FX15\n", op);
-
-                    dt = V[x];
-                    pc += 2;
-                    break;
-
-                // FX18: Sets the sound timer to Vx
-                case 0x0018:
-                    debug_print("[OK] 0x%X: FX18\n", op);
-
-                    st = V[x];
-                    pc += 2;
-                    break;
-
-                // FX1E: Adds Vx to I
-                case 0x001E:
-                    debug_print("[OK] 0x%X: FX1E\n", op);
-
-                    I += V[x];
-                    pc += 2;
-                    break;
-
-                // FX29: Sets I to the location of the sprite for the character
-                // in Vx
-                case 0x0029:
-                    debug_print("[OK] 0x%X: FX29\n", op);
-
-                    // each digit is 5 bytes long
-                    I = V[x] * 5;
-                    pc += 2;
-                    break;
-
-                /*
-                 * FX33:
-                 *
-                 * Stores the binary-coded decimal representation
-                 * of VX, with the most significant of three digits
-                 * at the address in I, the middle digit at I plus
-                 * 1, and the least significant digit at I plus 2.
-                 * (In other words, take the decimal representation
-                 * of VX, place the hundreds digit in memory
-                 * at location in I, the tens digit at
-                 * location I+1, and the ones digit at
-                 * location I+2.)
-                 * */
-                case 0x0033:
-                    debug_print("[OK] 0x%X: FX33\n", op);
-
-                    memory[I] = (V[x] % 1000) / 100;
-                    memory[I + 1] = (V[x] % 100) / 10;
-                    memory[I + 2] = (V[x] % 10);
-
-                    pc += 2;
-                    break;
-
-                // FX55: Stores V0 through Vx (Vx included) in memory starting
-                // at addr I.
-                case 0x0055:
-                    debug_print("[OK] 0x%X: FX55\n", op);
-
-                    for (int i = 0; i <= x; i++) {
-                        memory[I + i] = V[i];
-                    }
-
-                    pc += 2;
-                    break;
-
-                // Fills V0 through Vx (Vx included) with values from memory
-                // starting at addr I.
-                case 0x0065:
-                    debug_print("[OK] 0x%X: FX65\n", op);
-
-                    for (int i = 0; i <= x; i++) {
-                        V[i] = memory[I + i];
-                    }
-
-                    pc += 2;
-                    break;
-
-                default:
-                    printf("[FAILED] Unknown op: 0x%X\n", op);
-                    break;
+                case 0x0007: return op_fx07;
+                case 0x000A: return op_fx0a;
+                case 0x0015: return op_fx15;
+                case 0x0018: return op_fx18;
+                case 0x001E: return op_fx1e;
+                case 0x0001: return op_fn01;
+                case 0x0029: return op_fx29;
+                case 0x0030: return op_fx30;
+                case 0x003A: return op_fx3a;
+                case 0x0033: return op_fx33;
+                case 0x0055: return op_fx55;
+                case 0x0065: return op_fx65;
+                case 0x0075: return op_fx75;
+                case 0x0085: return op_fx85;
+                default: return op_unknown;
             }
-            break;
+    }
+
+    return op_unknown;
+}
 
-        default:
-            debug_print("[FAILED] Unknown opcode: 0x%X\n", op);
-            break;
+/*
+ * Pre-decoded dispatch table: one handler per possible opcode, so decoding
+ * becomes a single indexed load. It is filled from decode() before main()
+ * runs, which keeps it read-only (and thread safe) afterwards.
+ * */
+static handler_t dispatch_table[0x10000];
+
+__attribute__((constructor)) static void build_dispatch_table(void) {
+    for (unsigned int op = 0; op < 0x10000; op++) {
+        dispatch_table[op] = decode((unsigned short)op);
     }
+}
 
-    /*
-     * Update timers:
-     *
-     * Decrement timers if they are > 0
-     * */
-    if (dt > 0) dt -= 1;
-    if (st > 0) {
-        sound_flag = 1;
-        puts("BEEP");
-        st -= 1;
+/**
+ * split: extract the operands of an opcode
+ * @param op the opcode
+ * @param in the instruction to fill (everything but the handler)
+ * @return void
+ * */
+static inline void split(unsigned short op, insn_t* in) {
+    in->op = op;
+    in->nnn = op & 0x0FFF;
+    in->x = (op & 0x0F00) >> 8;
+    in->y = (op & 0x00F0) >> 4;
+    in->n = op & 0x000F;
+    in->nn = op & 0x00FF;
+}
+
+/**
+ * predecode: decode an opcode once, so it can be executed many times
+ * @param op the opcode
+ * @param in the decoded instruction
+ * @return void
+ * */
+void predecode(unsigned short op, insn_t* in) {
+    split(op, in);
+    in->fn = dispatch_table[op];
+}
+
+/**
+ * fetch: read the opcode pointed by pc
+ * @param c the machine
+ * @return the opcode
+ * */
+static inline unsigned short fetch(const chip8_t* c) {
+    return opcode_at(c, c->pc);
+}
+
+
+/**
+ * emulate_cycle_switch: run one instruction, decoded by the nested switch
+ * @param c the machine to step
+ * @return void
+ * */
+void emulate_cycle_switch(chip8_t* c) {
+    insn_t in;
+    unsigned short op = fetch(c);
+
+    TRACE(c, op);
+    split(op, &in);
+    decode(op)(c, &in);
+}
+
+/**
+ * emulate_cycle_table: run one instruction, decoded by the dispatch table
+ * @param c the machine to step
+ * @return void
+ * */
+void emulate_cycle_table(chip8_t* c) {
+    insn_t in;
+    unsigned short op = fetch(c);
+
+    TRACE(c, op);
+    split(op, &in);
+    dispatch_table[op](c, &in);
+}
+
+/**
+ * execute: run one cycle of an already decoded instruction
+ * @param c the machine to step
+ * @param in the instruction at pc
+ * @return void
+ * */
+void execute(chip8_t* c, const insn_t* in) {
+    TRACE(c, in->op);
+    in->fn(c, in);
+}
+
+/**
+ * emulate_cycle: run chip-8 instructions
+ * @param c the machine to step
+ * @return void
+ *
+ * 1) Fetch the operation code
+ *      - fetch one opcode from the memory at the location specified by the
+ * program counter. Each array address contains one byte, an opcode is 2 bytes
+ * long so we need to fetch 2 consecutive bytes and merge them to get the actual
+ * opcode.
+ *          - for example:
+ *              0xA2F0 --> pc = 0xA2, pc + 1 = 0xF0
+ *              opcode = pc << 8 | pc + 1
+ *                  - shifting A0 left by 8 bits, which adds 8 zeros (0xA200)
+ *                  - bitwise OR to merge them
+ *
+ * 2) Decode the operation code
+ *      - look up to the optable to see what the op means
+ *          - for example:
+ *              0xA2F0 --> ANNN: sets I to the address NNN (0x2F0)
+ *      - the lookup is either the nested switch in decode() or the
+ * precomputed dispatch_table, selected at build time with
+ * -DCHIP8_DISPATCH_TABLE
+ * 3) Execute the operation code
+ *      - execute the parsed op
+ *          - for example:
+ *              0xA2F0 --> store 0x2F0 into the I register, as only 12-bits are
+ * containing the value we need to store, we use a bitwise AND (with the value
+ * 0x0FFF) to get rid of the first four bits.
+ *                  - I =  opcode & 0x0FFF
+ *                    pc += 2 --> every instruction is 2 bytes long
+ *
+ * Timers are not touched here: they count at 60hz whatever the cpu speed,
+ * see tick_timers().
+ *
+ * draw_flag is set by every instruction changing the display (DXYN, 00E0,
+ * scrolls, resolution switches) and stays set until whoever presents the
+ * display clears it, so any number of cycles can run between two frames.
+ * */
+void emulate_cycle(chip8_t* c) {
+#ifdef CHIP8_PROFILE
+    if (c->profile) {
+        profile_cycle(c);
+        return;
     }
+#endif
+
+#ifdef CHIP8_DISPATCH_TABLE
+    emulate_cycle_table(c);
+#else
+    emulate_cycle_switch(c);
+#endif
+}
+
+/**
+ * tick_timers: count the timers down, to be called at 60hz
+ * @param c the machine
+ * @return void
+ *
+ * Decrement timers if they are > 0, sound_flag tells whether the buzzer
+ * sounds during the coming frame.
+ * */
+void tick_timers(chip8_t* c) {
+    c->sound_flag = 0;
+
+    if (c->dt > 0) c->dt -= 1;
+    if (c->st > 0) {
+        c->sound_flag = 1;
+        c->st -= 1;
+    }
+}
+
+/*
+==========================================================
+# Idle detection
+==========================================================
+*/
+
+/*
+ * Two kinds of waits are recognised, both only end with a key press or a
+ * timer tick, which never happen in the middle of a burst of instructions:
+ *
+ *  - FX0A with no key down: pc doesn't move, the machine never changes.
+ *
+ *  - the delay loop  A: FX07  A+2: 3X00  A+4: 1A  with dt != 0: apart
+ * from pc, the only thing it changes is Vx, which is set to dt once the
+ * first FX07 runs and stays there.
+ * */
+
+/**
+ * delay_loop: find the delay loop the machine is spinning in
+ * @param c the machine
+ * @param phase set to the instruction of the loop pc is at, 0 to 2
+ * @return the address of the loop, -1 if pc isn't in one or dt is 0
+ * */
+static long delay_loop(const chip8_t* c, unsigned int* phase) {
+    unsigned short op = opcode_at(c, c->pc);
+
+    if (c->dt == 0) return -1;
+
+    // pc may be anywhere in the loop, its opcode tells where
+    if ((op & 0xF0FF) == 0xF007) {
+        *phase = 0;
+    } else if ((op & 0xF0FF) == 0x3000) {
+        *phase = 1;
+    } else if ((op & 0xF000) == 0x1000) {
+        *phase = 2;
+    } else {
+        return -1;
+    }
+
+    unsigned short a = (c->pc - 2 * *phase) & c->mem_mask;
+    unsigned short x = (opcode_at(c, a) & 0x0F00) >> 8;
+
+    if ((opcode_at(c, a) & 0xF0FF) != 0xF007 ||
+        opcode_at(c, a + 2) != (0x3000 | x << 8) ||
+        opcode_at(c, a + 4) != (0x1000 | a)) {
+        return -1;
+    }
+
+    // a stale Vx of 0 would make the 3X00 skip out of the loop
+    if (*phase == 1 && c->V[x] == 0) return -1;
+
+    return a;
+}
+
+/**
+ * is_idle: whether the machine sits in a wait it can't leave by itself,
+ * without touching it
+ * @param c the machine
+ * @return 1 if so, 0 otherwise
+ * */
+int is_idle(const chip8_t* c) {
+    unsigned int phase;
+
+    // the profiler wants to see the busy-waiting
+    if (PROFILING(c)) return 0;
+
+    if ((opcode_at(c, c->pc) & 0xF0FF) == 0xF00A) return c->keypad == 0;
+
+    return delay_loop(c, &phase) >= 0;
+}
+
+/**
+ * skip_idle: fast-forward through a wait the machine can't leave by itself
+ * @param c the machine
+ * @param cycles how many instructions may be skipped
+ * @return how many were skipped, 0 if the machine isn't idle (see is_idle())
+ *
+ * The machine is left exactly as running the skipped instructions would
+ * leave it, so skipping is invisible to the rom (and to golden hashes).
+ * */
+unsigned long skip_idle(chip8_t* c, unsigned long cycles) {
+    unsigned int phase;
+
+    if (!is_idle(c)) return 0;
+
+    // FX0A: nothing to do
+    long a = delay_loop(c, &phase);
+    if (a < 0) return cycles;
+
+    unsigned short x = (opcode_at(c, a) & 0x0F00) >> 8;
+
+    // instructions until the first FX07 has run
+    unsigned long first = phase == 0 ? 1 : 4 - phase;
+    if (cycles >= first) c->V[x] = c->dt;
+
+    c->pc = (a + 2 * ((phase + cycles) % 3)) & c->mem_mask;
+    return cycles;
+}
+
+/**
+ * hash_display: fingerprint the current frame
+ * @param c the machine whose display is hashed
+ * @return 64-bit FNV-1a hash of the display
+ *
+ * Only what the mode can show is hashed: the first plane at 64x32 for
+ * the original CHIP-8.
+ * */
+unsigned long long hash_display(const chip8_t* c) {
+    unsigned long long hash = 0xcbf29ce484222325ULL;
+    int planes = c->mode == MODE_XOCHIP ? 2 : 1;
+    int words = ROWS(c) * ROW_WORDS(c);
+
+    // byte by byte, left to right, so the hash doesn't depend on endianness
+    for (int p = 0; p < planes; p++) {
+        for (int w = 0; w < words; w++) {
+            for (int shift = 56; shift >= 0; shift -= 8) {
+                hash ^= (c->display[p][w] >> shift) & 0xFF;
+                hash *= 0x100000001b3ULL;
+            }
+        }
+    }
+
+    return hash;
 }
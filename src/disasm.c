@@ -0,0 +1,110 @@
+#include <stdio.h>
+
+#include "disasm.h"
+
+/**
+ * disasm: write the mnemonic of an opcode
+ * @param op the opcode
+ * @param buf the output buffer
+ * @param size the size of buf
+ * @return void
+ * */
+void disasm(unsigned short op, char* buf, size_t size) {
+    unsigned int nnn = op & 0x0FFF;
+    unsigned int x = (op & 0x0F00) >> 8;
+    unsigned int y = (op & 0x00F0) >> 4;
+    unsigned int n = op & 0x000F;
+    unsigned int nn = op & 0x00FF;
+
+    switch (op & 0xF000) {
+        // decoded on the low byte, as the interpreter does
+        case 0x0000:
+            switch (nn) {
+                case 0xE0: snprintf(buf, size, "CLS"); return;
+                case 0xEE: snprintf(buf, size, "RET"); return;
+                case 0xFB: snprintf(buf, size, "SCR"); return;
+                case 0xFC: snprintf(buf, size, "SCL"); return;
+                case 0xFD: snprintf(buf, size, "EXIT"); return;
+                case 0xFE: snprintf(buf, size, "LOW"); return;
+                case 0xFF: snprintf(buf, size, "HIGH"); return;
+            }
+            if ((op & 0xFFF0) == 0x00C0) {
+                snprintf(buf, size, "SCD %u", n);
+            } else if ((op & 0xFFF0) == 0x00D0) {
+                snprintf(buf, size, "SCU %u", n);
+            } else {
+                snprintf(buf, size, "???");
+            }
+            return;
+        case 0x1000: snprintf(buf, size, "JP 0x%03X", nnn); return;
+        case 0x2000: snprintf(buf, size, "CALL 0x%03X", nnn); return;
+        case 0x3000: snprintf(buf, size, "SE V%X, 0x%02X", x, nn); return;
+        case 0x4000: snprintf(buf, size, "SNE V%X, 0x%02X", x, nn); return;
+        case 0x5000:
+            if (n == 0x2) {
+                snprintf(buf, size, "LD [I], V%X-V%X", x, y);
+            } else if (n == 0x3) {
+                snprintf(buf, size, "LD V%X-V%X, [I]", x, y);
+            } else {
+                snprintf(buf, size, "SE V%X, V%X", x, y);
+            }
+            return;
+        case 0x6000: snprintf(buf, size, "LD V%X, 0x%02X", x, nn); return;
+        case 0x7000: snprintf(buf, size, "ADD V%X, 0x%02X", x, nn); return;
+        case 0x8000: {
+            static const char* const alu[16] = {
+                "LD", "OR", "AND", "XOR", "ADD", "SUB", "SHR", "SUBN",
+                NULL, NULL, NULL, NULL, NULL, NULL, "SHL", NULL};
+
+            if (alu[n]) {
+                snprintf(buf, size, "%s V%X, V%X", alu[n], x, y);
+            } else {
+                snprintf(buf, size, "???");
+            }
+            return;
+        }
+        case 0x9000: snprintf(buf, size, "SNE V%X, V%X", x, y); return;
+        case 0xA000: snprintf(buf, size, "LD I, 0x%03X", nnn); return;
+        case 0xB000: snprintf(buf, size, "JP V0, 0x%03X", nnn); return;
+        case 0xC000: snprintf(buf, size, "RND V%X, 0x%02X", x, nn); return;
+        case 0xD000: snprintf(buf, size, "DRW V%X, V%X, %u", x, y, n); return;
+        case 0xE000:
+            if (nn == 0x9E) {
+                snprintf(buf, size, "SKP V%X", x);
+            } else if (nn == 0xA1) {
+                snprintf(buf, size, "SKNP V%X", x);
+            } else {
+                snprintf(buf, size, "???");
+            }
+            return;
+        case 0xF000:
+            if (op == 0xF000) {
+                // the address is the next word
+                snprintf(buf, size, "LD I, LONG");
+                return;
+            }
+            if (op == 0xF002) {
+                snprintf(buf, size, "LD AUDIO, [I]");
+                return;
+            }
+
+            switch (nn) {
+                case 0x01: snprintf(buf, size, "PLANE %u", x); return;
+                case 0x07: snprintf(buf, size, "LD V%X, DT", x); return;
+                case 0x0A: snprintf(buf, size, "LD V%X, K", x); return;
+                case 0x15: snprintf(buf, size, "LD DT, V%X", x); return;
+                case 0x18: snprintf(buf, size, "LD ST, V%X", x); return;
+                case 0x1E: snprintf(buf, size, "ADD I, V%X", x); return;
+                case 0x29: snprintf(buf, size, "LD F, V%X", x); return;
+                case 0x33: snprintf(buf, size, "LD B, V%X", x); return;
+                case 0x55: snprintf(buf, size, "LD [I], V%X", x); return;
+                case 0x65: snprintf(buf, size, "LD V%X, [I]", x); return;
+                case 0x30: snprintf(buf, size, "LD HF, V%X", x); return;
+                case 0x3A: snprintf(buf, size, "PITCH V%X", x); return;
+                case 0x75: snprintf(buf, size, "LD R, V%X", x); return;
+                case 0x85: snprintf(buf, size, "LD V%X, R", x); return;
+            }
+            snprintf(buf, size, "???");
+            return;
+    }
+}
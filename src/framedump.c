@@ -0,0 +1,396 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "recorder.h"
+
+/*
+ * Offline frame stream decoder:
+ *
+ * Reads a stream written by the recorder (emulator -v, chip8-batch -v) and
+ * writes its frames as numbered PNG files, prefix000000.png onwards, or
+ * with -l lists them. -f starts at an emulated frame, seeking to the
+ * keyframe before it through the index, -n stops after so many frames.
+ *
+ * Every image is 128x64 pixels times the scale, lores frames have their
+ * pixels doubled, so a run switching resolutions still makes a sequence of
+ * same-sized images. Colors are those of the window. The PNG files are
+ * written without compression (stored deflate blocks) to need no zlib:
+ * with 2 bits per pixel a frame at the default scale is about 33K.
+ * */
+
+#define DEFAULT_SCALE 4
+
+static const unsigned char palette[4][3] = {
+    {0x00, 0x00, 0x00}, {0xFF, 0xFF, 0xFF}, {0xAA, 0xAA, 0xAA},
+    {0x55, 0x55, 0x55}};
+
+static uint32_t crc_table[256];
+
+static void put_be(unsigned char* p, uint32_t v) {
+    for (int i = 0; i < 4; i++) p[i] = v >> (24 - 8 * i);
+}
+
+static uint64_t get_le(const unsigned char* p, int bytes) {
+    uint64_t v = 0;
+
+    for (int i = 0; i < bytes; i++) v |= (uint64_t)p[i] << (8 * i);
+    return v;
+}
+
+static void make_crc_table(void) {
+    for (uint32_t n = 0; n < 256; n++) {
+        uint32_t c = n;
+
+        for (int k = 0; k < 8; k++) c = c & 1 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+        crc_table[n] = c;
+    }
+}
+
+static uint32_t crc32(uint32_t crc, const unsigned char* p, size_t n) {
+    crc = ~crc;
+    for (size_t i = 0; i < n; i++) crc = crc_table[(crc ^ p[i]) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+/**
+ * put_chunk: write a PNG chunk
+ * @param fp the file
+ * @param type the chunk type
+ * @param data the chunk data
+ * @param size its size
+ * @return 0 if success, -1 otherwise
+ * */
+static int put_chunk(FILE* fp, const char* type, const unsigned char* data,
+                     size_t size) {
+    unsigned char buf[8];
+
+    put_be(buf, size);
+    memcpy(buf + 4, type, 4);
+
+    uint32_t crc = crc32(crc32(0, buf + 4, 4), data, size);
+    int error = fwrite(buf, 8, 1, fp) != 1;
+
+    error |= size && fwrite(data, size, 1, fp) != 1;
+    put_be(buf, crc);
+    error |= fwrite(buf, 4, 1, fp) != 1;
+
+    return error ? -1 : 0;
+}
+
+/**
+ * write_png: write a frame as a PNG file
+ * @param filename the file
+ * @param frame the frame, see recorder.h
+ * @param hires the resolution of the frame
+ * @param scale pixels per hires pixel
+ * @return 0 if success, -1 otherwise
+ * */
+static int write_png(const char* filename, const unsigned char* frame,
+                     int hires, int scale) {
+    int width = 128 * scale, height = 64 * scale;
+    // a filter byte then 4 pixels per byte
+    size_t stride = 1 + width / 4;
+    size_t raw_size = height * stride;
+    // zlib header, stored blocks of up to 65535 bytes, adler32
+    size_t blocks = (raw_size + 65534) / 65535;
+    unsigned char* raw = calloc(raw_size, 1);
+    unsigned char* idat = malloc(2 + blocks * 5 + raw_size + 4);
+
+    if (raw == NULL || idat == NULL) {
+        free(raw);
+        free(idat);
+        return -1;
+    }
+
+    // lores pixels are twice as big, in both directions
+    int cell = hires ? scale : 2 * scale;
+    size_t row_bytes = hires ? 16 : 8;
+    size_t plane = row_bytes * (hires ? 64 : 32);
+
+    for (int y = 0; y < height; y++) {
+        const unsigned char* row = frame + (y / cell) * row_bytes;
+        unsigned char* out = raw + y * stride + 1;
+
+        for (int x = 0; x < width; x++) {
+            int px = x / cell;
+            int bit = 7 - px % 8;
+            int color = ((row[px / 8] >> bit) & 1) |
+                        ((row[plane + px / 8] >> bit) & 1) << 1;
+
+            out[x / 4] |= color << (6 - 2 * (x % 4));
+        }
+    }
+
+    size_t n = 0;
+    uint32_t a = 1, b = 0;
+
+    idat[n++] = 0x78;
+    idat[n++] = 0x01;
+    for (size_t at = 0; at < raw_size; at += 65535) {
+        size_t len = raw_size - at < 65535 ? raw_size - at : 65535;
+
+        idat[n++] = at + len == raw_size;
+        idat[n++] = len & 0xFF;
+        idat[n++] = len >> 8;
+        idat[n++] = ~len & 0xFF;
+        idat[n++] = (~len >> 8) & 0xFF;
+        memcpy(idat + n, raw + at, len);
+        n += len;
+    }
+    for (size_t i = 0; i < raw_size; i++) {
+        a = (a + raw[i]) % 65521;
+        b = (b + a) % 65521;
+    }
+    put_be(idat + n, b << 16 | a);
+    n += 4;
+
+    unsigned char ihdr[13] = {0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 0, 0, 0};
+    put_be(ihdr, width);
+    put_be(ihdr + 4, height);
+
+    FILE* fp = fopen(filename, "wb");
+    int error = fp == NULL;
+
+    if (!error) {
+        error |= fwrite("\x89PNG\r\n\x1a\n", 8, 1, fp) != 1;
+        error |= put_chunk(fp, "IHDR", ihdr, sizeof(ihdr));
+        error |= put_chunk(fp, "PLTE", &palette[0][0], sizeof(palette));
+        error |= put_chunk(fp, "IDAT", idat, n);
+        error |= put_chunk(fp, "IEND", NULL, 0);
+        error |= fclose(fp) != 0;
+    }
+
+    free(raw);
+    free(idat);
+    return error ? -1 : 0;
+}
+
+/**
+ * get_leb: read a LEB128 number
+ * @param fp the file
+ * @param v the number
+ * @return 0 if success, -1 otherwise
+ * */
+static int get_leb(FILE* fp, uint64_t* v) {
+    int c, shift = 0;
+
+    *v = 0;
+    do {
+        c = fgetc(fp);
+        if (c == EOF || shift > 63) return -1;
+        *v |= (uint64_t)(c & 0x7F) << shift;
+        shift += 7;
+    } while (c & 0x80);
+
+    return 0;
+}
+
+/**
+ * run_length: decode run-length encoded bytes, see recorder.h
+ * @param out the bytes, zeroed
+ * @param size how many
+ * @param in the encoded bytes
+ * @param len their length
+ * @return 0 if success, -1 if they don't make a frame
+ * */
+static int run_length(unsigned char* out, size_t size, const unsigned char* in,
+                      size_t len) {
+    size_t i = 0, at = 0;
+
+    while (i < len) {
+        uint64_t counts[2];
+
+        for (int k = 0; k < 2; k++) {
+            int shift = 0;
+
+            counts[k] = 0;
+            do {
+                if (i == len || shift > 63) return -1;
+                counts[k] |= (uint64_t)(in[i] & 0x7F) << shift;
+                shift += 7;
+            } while (in[i++] & 0x80);
+        }
+
+        if (counts[0] > size - at || counts[1] > size - at - counts[0] ||
+            counts[1] > len - i) {
+            return -1;
+        }
+
+        at += counts[0];
+        memcpy(out + at, in + i, counts[1]);
+        at += counts[1];
+        i += counts[1];
+    }
+
+    return 0;
+}
+
+/**
+ * find_start: where to start reading for a given frame
+ * @param fp the stream
+ * @param first the first frame wanted
+ * @param end set to where the records end
+ * @return the offset of the last keyframe up to first, or of the first
+ * record without an index
+ * */
+static long find_start(FILE* fp, uint64_t first, long* end) {
+    unsigned char buf[16];
+    long start = 8;
+
+    *end = -1;
+    if (fseek(fp, -12, SEEK_END) || fread(buf, 12, 1, fp) != 1 ||
+        memcmp(buf + 8, RECORDER_TRAILER, 4)) {
+        return start;
+    }
+
+    long index = (long)get_le(buf, 8);
+    if (fseek(fp, index, SEEK_SET) || fread(buf, 8, 1, fp) != 1) return start;
+
+    *end = index;
+    for (uint64_t keys = get_le(buf, 8); keys; keys--) {
+        if (fread(buf, 16, 1, fp) != 1) break;
+        if (get_le(buf, 8) > first) break;
+        start = (long)get_le(buf + 8, 8);
+    }
+
+    return start;
+}
+
+static void usage(void) {
+    error("usage: chip8-frames [-s scale] [-f first_frame] [-n count] [-l] "
+          "stream [out_prefix]\n");
+}
+
+int main(int argc, char** argv) {
+    unsigned long scale = DEFAULT_SCALE;
+    uint64_t first = 0;
+    unsigned long count = 0;
+    int list = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "s:f:n:l")) != -1) {
+        switch (opt) {
+            case 's':
+                scale = strtoul(optarg, NULL, 10);
+                if (scale == 0 || scale > 64) scale = DEFAULT_SCALE;
+                break;
+            case 'f':
+                first = strtoull(optarg, NULL, 10);
+                break;
+            case 'n':
+                count = strtoul(optarg, NULL, 10);
+                break;
+            case 'l':
+                list = 1;
+                break;
+            default:
+                usage();
+                return 1;
+        }
+    }
+
+    if (optind != argc - (list ? 1 : 2)) {
+        usage();
+        return 1;
+    }
+
+    FILE* fp = fopen(argv[optind], "rb");
+    if (fp == NULL) {
+        perror("Error while opening frame stream");
+        return 1;
+    }
+
+    unsigned char header[8];
+    if (fread(header, sizeof(header), 1, fp) != 1 ||
+        memcmp(header, RECORDER_MAGIC, 4) ||
+        get_le(header + 4, 4) != RECORDER_VERSION) {
+        error("[FAILED] %s is not a frame stream\n", argv[optind]);
+        fclose(fp);
+        return 1;
+    }
+
+    long end;
+    if (fseek(fp, find_start(fp, first, &end), SEEK_SET)) {
+        perror("fseek");
+        fclose(fp);
+        return 1;
+    }
+
+    make_crc_table();
+
+    static unsigned char in[FRAME_BYTES(1) * 2 + 32];
+    unsigned char frame[FRAME_BYTES(1)];
+    unsigned char delta[FRAME_BYTES(1)];
+    int hires = -1;
+    unsigned long written = 0;
+    int failed = 0;
+
+    while ((end < 0 || ftell(fp) < end) && (count == 0 || written < count)) {
+        int flags = fgetc(fp);
+        uint64_t number, len;
+
+        // a stream cut short ends anywhere
+        if (flags == EOF || get_leb(fp, &number) || get_leb(fp, &len)) break;
+
+        int key = flags & RECORD_KEYFRAME;
+        int record_hires = (flags & RECORD_HIRES) != 0;
+        size_t size = FRAME_BYTES(record_hires);
+
+        if (len > sizeof(in) || (len && fread(in, len, 1, fp) != 1)) break;
+
+        // deltas only make sense on top of a frame of the same resolution
+        if (!key && hires != record_hires) {
+            error("[FAILED] Frame %llu has nothing to apply to\n",
+                  (unsigned long long)number);
+            failed = 1;
+            break;
+        }
+
+        memset(delta, 0, size);
+        if (run_length(delta, size, in, len)) {
+            error("[FAILED] Frame %llu is corrupted\n",
+                  (unsigned long long)number);
+            failed = 1;
+            break;
+        }
+
+        if (key) {
+            memcpy(frame, delta, size);
+        } else {
+            for (size_t i = 0; i < size; i++) frame[i] ^= delta[i];
+        }
+        hires = record_hires;
+
+        if (number < first) continue;
+
+        if (list) {
+            printf("%10llu  %-5s %s %6llu bytes\n", (unsigned long long)number,
+                   hires ? "hires" : "lores", key ? "key  " : "delta",
+                   (unsigned long long)len);
+        } else {
+            char filename[4096];
+
+            snprintf(filename, sizeof(filename), "%s%06lu.png",
+                     argv[optind + 1], written);
+            if (write_png(filename, frame, hires, (int)scale)) {
+                perror("Error while writing image");
+                failed = 1;
+                break;
+            }
+        }
+        written++;
+    }
+
+    fclose(fp);
+
+    if (!list && !failed) {
+        printf("[OK] %lu frames written to %s*.png\n", written,
+               argv[optind + 1]);
+    }
+
+    return failed;
+}
@@ -0,0 +1,346 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <fcntl.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "chip8.h"
+#include "romlib.h"
+
+/*
+ * Fuzzing harness:
+ *
+ * Runs a stream of generated roms through the interpreter in-process, a
+ * short run per case, looking for crashes (build with sanitizers to catch
+ * bad memory accesses where they happen) and, with -d, for any difference
+ * between the switch and the table engines.
+ *
+ * Resetting a machine costs more than a short run: memory alone is 64K.
+ * Instead, every case starts from a pristine machine (init_cpu, set_mode)
+ * and afterwards only what it dirtied is copied back from that one: the
+ * 64-byte blocks of memory set in mem_dirty, the display rows set in
+ * fb_dirty and the few hundred bytes of registers in front of the memory.
+ * -f resets the whole machine instead, for comparison.
+ *
+ * A case is one of the seed roms (files, directories or packs, as for
+ * chip8-batch) with a few bytes overwritten or bits flipped, or random
+ * bytes without seeds. It runs with seed 1 and the keypad released; if the
+ * process dies on a signal the case is written to crash.ch8 first.
+ *
+ * Built with -DCHIP8_LIBFUZZER the case runner is the entry point of a
+ * libFuzzer binary instead of having a main().
+ * */
+
+#define DEFAULT_CYCLES 200
+#define DEFAULT_CASES 1000000
+
+static chip8_t* pristine;
+// the machines running the cases, the second one for -d only
+static chip8_t* machine[2];
+
+static unsigned long cycles = DEFAULT_CYCLES;
+static unsigned long ipf = DEFAULT_IPF;
+static int mode = MODE_CHIP8;
+static int full_reset = 0;
+static int differential = 0;
+
+// blocks and rows reset so far, for the stats
+static unsigned long long blocks;
+static unsigned long long rows;
+
+/**
+ * new_machine: allocate a machine without any engine attached
+ * @param void
+ * @return the machine, NULL if out of memory
+ * */
+static chip8_t* new_machine(void) {
+    chip8_t* c;
+
+    if (posix_memalign((void**)&c, 64, sizeof(*c))) return NULL;
+    c->cache = NULL;
+    c->jit = NULL;
+    c->trace = NULL;
+    c->profile = NULL;
+
+    init_cpu(c);
+    set_mode(c, mode);
+    seed_random(c, 1);
+    // fonts are part of the pristine memory, not something a case wrote
+    memset(c->mem_dirty, 0, sizeof(c->mem_dirty));
+    c->fb_dirty = 0;
+
+    return c;
+}
+
+/**
+ * setup: create the pristine machine and the ones the cases run on
+ * @param void
+ * @return 0 if success, -1 if out of memory
+ * */
+static int setup(void) {
+    pristine = new_machine();
+    machine[0] = new_machine();
+    machine[1] = new_machine();
+
+    return pristine && machine[0] && machine[1] ? 0 : -1;
+}
+
+/**
+ * restore: bring a machine back to the pristine one after a case
+ * @param c the machine
+ * @return void
+ * */
+static void restore(chip8_t* c) {
+    if (full_reset) {
+        memcpy(c, pristine, offsetof(chip8_t, cache));
+        return;
+    }
+
+    for (int w = 0; w < DIRTY_WORDS; w++) {
+        for (uint64_t d = c->mem_dirty[w]; d; d &= d - 1) {
+            size_t at = (w * 64 + __builtin_ctzll(d)) * DIRTY_BLOCK;
+
+            memcpy(c->memory + at, pristine->memory + at, DIRTY_BLOCK);
+            blocks++;
+        }
+    }
+
+    // a row is one word in lores and two in hires; switching resolution
+    // clears the whole display, so the final one says where the rows are
+    int words = c->hires ? 2 : 1;
+    for (uint64_t d = c->fb_dirty; d; d &= d - 1) {
+        int y = __builtin_ctzll(d);
+
+        for (int p = 0; p < DISPLAY_PLANES; p++) {
+            memcpy(&c->display[p][y * words], &pristine->display[p][y * words],
+                   words * 8);
+        }
+        rows++;
+    }
+
+    // registers, stack, timers, rng and the dirty marks themselves
+    memcpy(c, pristine, offsetof(chip8_t, memory));
+}
+
+/**
+ * run_case: load a case into a machine and run it
+ * @param c the machine, pristine
+ * @param step the engine
+ * @param data the rom
+ * @param size its size, cut to ROM_MAX
+ * @return void
+ * */
+static void run_case(chip8_t* c, void (*step)(chip8_t*),
+                     const unsigned char* data, size_t size) {
+    if (size > ROM_MAX) size = ROM_MAX;
+    memcpy(c->memory + 0x200, data, size);
+    dirty_memory(c, 0x200, size);
+
+    for (unsigned long done = 0; done < cycles; done++) {
+        step(c);
+        if (done % ipf == ipf - 1) tick_timers(c);
+    }
+}
+
+/**
+ * fuzz_one: run a case, on both engines with -d
+ * @param data the rom
+ * @param size its size
+ * @return 0 if fine, -1 if the engines disagree
+ * */
+static int fuzz_one(const unsigned char* data, size_t size) {
+    int same = 1;
+
+    run_case(machine[0], emulate_cycle_switch, data, size);
+
+    if (differential) {
+        run_case(machine[1], emulate_cycle_table, data, size);
+        same = !memcmp(machine[0], machine[1], offsetof(chip8_t, cache));
+        restore(machine[1]);
+    }
+
+    restore(machine[0]);
+    return same ? 0 : -1;
+}
+
+#ifdef CHIP8_LIBFUZZER
+
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+    if (pristine == NULL) {
+        if (setup()) abort();
+        differential = 1;
+    }
+
+    if (fuzz_one(data, size)) abort();
+    return 0;
+}
+
+#else
+
+static struct rom_library lib;
+// xorshift32 state of the case generator
+static uint32_t state = 1;
+
+// the case being run, written out if it brings the process down
+static unsigned char current[ROM_MAX];
+static size_t current_size;
+
+static uint32_t next(void) {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    return state;
+}
+
+/**
+ * make_case: generate the next case
+ * @param buf ROM_MAX bytes to fill
+ * @return the size of the case
+ * */
+static size_t make_case(unsigned char* buf) {
+    size_t size;
+
+    if (lib.count == 0) {
+        size = 2 + next() % 512;
+        for (size_t i = 0; i < size; i++) buf[i] = next();
+        return size;
+    }
+
+    const struct rom* r = &lib.roms[next() % lib.count];
+    size = r->size ? r->size : 1;
+    memcpy(buf, r->image + 0x200, size);
+
+    for (unsigned int n = 1 + next() % 8; n; n--) {
+        size_t at = next() % size;
+
+        if (next() & 1) {
+            buf[at] = next();
+        } else {
+            buf[at] ^= 1 << (next() % 8);
+        }
+    }
+
+    return size;
+}
+
+/**
+ * dump: write a case to a file
+ * @param filename the file
+ * @return void
+ *
+ * Only async-signal-safe calls, it also runs from the signal handler.
+ * */
+static void dump(const char* filename) {
+    int fd = open(filename, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+    if (fd < 0) return;
+    ssize_t written = write(fd, current, current_size);
+    (void)written;
+    close(fd);
+}
+
+static void crashed(int sig) {
+    dump("crash.ch8");
+    signal(sig, SIG_DFL);
+    raise(sig);
+}
+
+static double now_s(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void usage(void) {
+    error("usage: chip8-fuzz [-n cases] [-c cycles] [-i ipf] [-s seed] [-m mode] [-d] [-f] "
+          "[rom.ch8 | dir | pack...]\n");
+}
+
+int main(int argc, char** argv) {
+    unsigned long cases = DEFAULT_CASES;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:c:i:s:m:df")) != -1) {
+        switch (opt) {
+            case 'n':
+                cases = strtoul(optarg, NULL, 10);
+                break;
+            case 'c':
+                cycles = strtoul(optarg, NULL, 10);
+                break;
+            case 'i':
+                ipf = strtoul(optarg, NULL, 10);
+                if (ipf == 0) ipf = 1;
+                break;
+            case 's':
+                state = strtoul(optarg, NULL, 10);
+                if (state == 0) state = 1;
+                break;
+            case 'm':
+                mode = parse_mode(optarg);
+                if (mode < 0) {
+                    error("[FAILED] A mode is chip8, schip or xochip\n");
+                    return 1;
+                }
+                break;
+            case 'd':
+                differential = 1;
+                break;
+            case 'f':
+                full_reset = 1;
+                break;
+            default:
+                usage();
+                return 1;
+        }
+    }
+
+    for (int i = optind; i < argc; i++) {
+        if (romlib_add(&lib, argv[i])) {
+            error("[FAILED] Can't load %s\n", argv[i]);
+            return 1;
+        }
+    }
+
+    if (setup()) {
+        perror("posix_memalign");
+        return 1;
+    }
+
+    signal(SIGSEGV, crashed);
+    signal(SIGBUS, crashed);
+    signal(SIGFPE, crashed);
+    signal(SIGILL, crashed);
+    signal(SIGABRT, crashed);
+
+    double start = now_s();
+
+    for (unsigned long n = 0; n < cases; n++) {
+        current_size = make_case(current);
+
+        if (fuzz_one(current, current_size)) {
+            dump("mismatch.ch8");
+            printf("[FAILED] case %lu: the engines disagree, written to "
+                   "mismatch.ch8\n", n);
+            return 1;
+        }
+    }
+
+    double wall = now_s() - start;
+    // both machines count with -d
+    double per = cases ? 1.0 / cases / (differential ? 2 : 1) : 0;
+
+    printf("[OK] %lu cases, %.0f cases/s, %.1f blocks and %.1f rows reset "
+           "per case%s\n",
+           cases, cases / wall, blocks * per, rows * per,
+           full_reset ? " (full resets)" : "");
+
+    romlib_free(&lib);
+    return 0;
+}
+
+#endif
@@ -0,0 +1,641 @@
+#define _DEFAULT_SOURCE
+
+#include "jit.h"
+#include "trace.h"
+#include "profile.h"
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__x86_64__) && !defined(_WIN32)
+
+#include <sys/mman.h>
+
+// interpreted executions of an address before we try to translate from it
+#define HOT_THRESHOLD 16
+
+// a lone jump is worth translating, it saves a fetch and a dispatch
+#define MIN_BLOCK 1
+
+// long runs are split, the length has to fit len[]
+#define MAX_BLOCK 255
+
+#define CODE_SIZE (1 << 20)
+
+// mprotect() granularity, x86-64 pages
+#define CODE_PAGE 4096
+
+// hits[] value for addresses where translation was tried and failed
+#define NOT_TRANSLATABLE 0xFFFF
+
+// returns how many instructions it ran, skips make that vary
+typedef unsigned int (*block_t)(chip8_t* c);
+
+struct jit {
+    unsigned char* code;
+    size_t used;
+
+    // native entry point and (longest) instruction count of the block at
+    // each address
+    block_t block[4096];
+    unsigned char len[4096];
+
+    unsigned short hits[4096];
+
+    // one bit per memory byte covered by a translated instruction
+    unsigned long long translated[4096 / 64];
+};
+
+/*
+==========================================================
+# x86-64 encoding
+==========================================================
+*/
+
+/*
+ * The generated code is a function unsigned int block(chip8_t* c): c
+ * arrives in rdi (System V ABI), every register access is a [rdi + disp32]
+ * operand and the number of instructions run is returned in eax. Only rax
+ * is clobbered, which is caller-saved.
+ * */
+
+#define V_OFF(r) ((int)offsetof(chip8_t, V) + (r))
+#define I_OFF ((int)offsetof(chip8_t, I))
+#define PC_OFF ((int)offsetof(chip8_t, pc))
+#define DT_OFF ((int)offsetof(chip8_t, dt))
+
+// register numbers for the ModRM reg field
+#define AL 0
+
+struct emitter {
+    unsigned char* p;
+};
+
+static void byte(struct emitter* e, unsigned char b) { *e->p++ = b; }
+
+static void word(struct emitter* e, unsigned short w) {
+    byte(e, w & 0xFF);
+    byte(e, w >> 8);
+}
+
+/**
+ * mem: emit a ModRM + disp32 addressing [rdi + disp]
+ * @param e the emitter
+ * @param reg the ModRM reg field (register or opcode extension)
+ * @param disp offset into chip8_t
+ * @return void
+ * */
+static void mem(struct emitter* e, int reg, int disp) {
+    byte(e, 0x80 | (reg << 3) | 7);
+    byte(e, disp & 0xFF);
+    byte(e, (disp >> 8) & 0xFF);
+    byte(e, (disp >> 16) & 0xFF);
+    byte(e, (disp >> 24) & 0xFF);
+}
+
+// op al, [rdi + disp] and op [rdi + disp], al
+static void op_rm(struct emitter* e, unsigned char opcode, int disp) {
+    byte(e, opcode);
+    mem(e, AL, disp);
+}
+
+#define MOV_AL_M 0x8A
+#define MOV_M_AL 0x88
+#define ADD_AL_M 0x02
+#define SUB_AL_M 0x2A
+#define CMP_AL_M 0x3A
+#define OR_M_AL 0x08
+#define AND_M_AL 0x20
+#define XOR_M_AL 0x30
+
+// setcc al
+static void setcc(struct emitter* e, unsigned char cc) {
+    byte(e, 0x0F);
+    byte(e, cc);
+    byte(e, 0xC0);
+}
+
+#define SETC 0x92
+#define SETA 0x97
+
+/**
+ * emit_insn: translate one straight-line instruction
+ * @param e the emitter
+ * @param op the opcode
+ * @return 0 if op was translated, -1 if it must stay interpreted
+ *
+ * Every sequence reproduces the handler in chip8.c step by step, including
+ * the order in which VF and Vx are written (it matters when x or y is F).
+ * */
+static int emit_insn(struct emitter* e, unsigned short op) {
+    int x = (op & 0x0F00) >> 8;
+    int y = (op & 0x00F0) >> 4;
+    unsigned char nn = op & 0x00FF;
+
+    switch (op & 0xF000) {
+        // 6XNN: mov byte [Vx], nn
+        case 0x6000:
+            byte(e, 0xC6);
+            mem(e, 0, V_OFF(x));
+            byte(e, nn);
+            return 0;
+
+        // 7XNN: add byte [Vx], nn
+        case 0x7000:
+            byte(e, 0x80);
+            mem(e, 0, V_OFF(x));
+            byte(e, nn);
+            return 0;
+
+        case 0x8000:
+            switch (op & 0x000F) {
+                // 8XY0: mov al, [Vy]; mov [Vx], al
+                case 0x0:
+                    op_rm(e, MOV_AL_M, V_OFF(y));
+                    op_rm(e, MOV_M_AL, V_OFF(x));
+                    return 0;
+
+                // 8XY1..3: mov al, [Vy]; or/and/xor [Vx], al
+                case 0x1:
+                    op_rm(e, MOV_AL_M, V_OFF(y));
+                    op_rm(e, OR_M_AL, V_OFF(x));
+                    return 0;
+                case 0x2:
+                    op_rm(e, MOV_AL_M, V_OFF(y));
+                    op_rm(e, AND_M_AL, V_OFF(x));
+                    return 0;
+                case 0x3:
+                    op_rm(e, MOV_AL_M, V_OFF(y));
+                    op_rm(e, XOR_M_AL, V_OFF(x));
+                    return 0;
+
+                // 8XY4: VF = carry of Vx + Vy, then Vx += Vy
+                case 0x4:
+                    op_rm(e, MOV_AL_M, V_OFF(x));
+                    op_rm(e, ADD_AL_M, V_OFF(y));
+                    setcc(e, SETC);
+                    op_rm(e, MOV_M_AL, V_OFF(0xF));
+                    op_rm(e, MOV_AL_M, V_OFF(x));
+                    op_rm(e, ADD_AL_M, V_OFF(y));
+                    op_rm(e, MOV_M_AL, V_OFF(x));
+                    return 0;
+
+                // 8XY5: VF = Vx > Vy, then Vx -= Vy
+                case 0x5:
+                    op_rm(e, MOV_AL_M, V_OFF(x));
+                    op_rm(e, CMP_AL_M, V_OFF(y));
+                    setcc(e, SETA);
+                    op_rm(e, MOV_M_AL, V_OFF(0xF));
+                    op_rm(e, MOV_AL_M, V_OFF(x));
+                    op_rm(e, SUB_AL_M, V_OFF(y));
+                    op_rm(e, MOV_M_AL, V_OFF(x));
+                    return 0;
+
+                // 8XY6: VF = Vx & 1, then shr byte [Vx], 1
+                case 0x6:
+                    op_rm(e, MOV_AL_M, V_OFF(x));
+                    byte(e, 0x24);
+                    byte(e, 0x01);
+                    op_rm(e, MOV_M_AL, V_OFF(0xF));
+                    byte(e, 0xD0);
+                    mem(e, 5, V_OFF(x));
+                    return 0;
+
+                // 8XY7: VF = Vy > Vx, then Vx = Vy - Vx
+                case 0x7:
+                    op_rm(e, MOV_AL_M, V_OFF(y));
+                    op_rm(e, CMP_AL_M, V_OFF(x));
+                    setcc(e, SETA);
+                    op_rm(e, MOV_M_AL, V_OFF(0xF));
+                    op_rm(e, MOV_AL_M, V_OFF(y));
+                    op_rm(e, SUB_AL_M, V_OFF(x));
+                    op_rm(e, MOV_M_AL, V_OFF(x));
+                    return 0;
+
+                // 8XYE: VF = Vx >> 7, then shl byte [Vx], 1
+                case 0xE:
+                    op_rm(e, MOV_AL_M, V_OFF(x));
+                    byte(e, 0xC0);
+                    byte(e, 0xE8);
+                    byte(e, 0x07);
+                    op_rm(e, MOV_M_AL, V_OFF(0xF));
+                    byte(e, 0xD0);
+                    mem(e, 4, V_OFF(x));
+                    return 0;
+            }
+            return -1;
+
+        // ANNN: mov word [I], nnn
+        case 0xA000:
+            byte(e, 0x66);
+            byte(e, 0xC7);
+            mem(e, 0, I_OFF);
+            word(e, op & 0x0FFF);
+            return 0;
+
+        case 0xF000:
+            switch (op & 0x00FF) {
+                // FX07: mov al, [dt]; mov [Vx], al
+                case 0x07:
+                    op_rm(e, MOV_AL_M, DT_OFF);
+                    op_rm(e, MOV_M_AL, V_OFF(x));
+                    return 0;
+
+                // FX1E: movzx eax, byte [Vx]; add [I], ax
+                case 0x1E:
+                    byte(e, 0x0F);
+                    byte(e, 0xB6);
+                    mem(e, 0, V_OFF(x));
+                    byte(e, 0x66);
+                    byte(e, 0x01);
+                    mem(e, 0, I_OFF);
+                    return 0;
+
+                // FX29: movzx eax, byte [Vx]; lea eax, [rax + rax * 4];
+                // mov [I], ax
+                case 0x29:
+                    byte(e, 0x0F);
+                    byte(e, 0xB6);
+                    mem(e, 0, V_OFF(x));
+                    byte(e, 0x8D);
+                    byte(e, 0x04);
+                    byte(e, 0x80);
+                    byte(e, 0x66);
+                    byte(e, 0x89);
+                    mem(e, 0, I_OFF);
+                    return 0;
+            }
+            return -1;
+    }
+
+    return -1;
+}
+
+/**
+ * add_pc: emit add word [pc], delta
+ * @param e the emitter
+ * @param delta what to add
+ * @return void
+ * */
+static void add_pc(struct emitter* e, unsigned short delta) {
+    byte(e, 0x66);
+    byte(e, 0x81);
+    mem(e, 0, PC_OFF);
+    word(e, delta);
+}
+
+#define ADD_PC_BYTES 9
+
+/**
+ * set_pc: emit mov word [pc], addr
+ * @param e the emitter
+ * @param addr the new pc
+ * @return void
+ * */
+static void set_pc(struct emitter* e, unsigned short addr) {
+    byte(e, 0x66);
+    byte(e, 0xC7);
+    mem(e, 0, PC_OFF);
+    word(e, addr);
+}
+
+/**
+ * ret: emit mov eax, n; ret
+ * @param e the emitter
+ * @param n the instruction count to return
+ * @return void
+ * */
+static void ret(struct emitter* e, unsigned int n) {
+    byte(e, 0xB8);
+    word(e, n & 0xFFFF);
+    word(e, 0);
+    byte(e, 0xC3);
+}
+
+#define RET_BYTES 6
+
+#define JE 0x74
+#define JNE 0x75
+
+/**
+ * emit_skip_test: compare the operands of a skip
+ * @param e the emitter
+ * @param op a 3XNN, 4XNN, 5XY0 or 9XY0 opcode
+ * @return the short jcc opcode taken when the skip does NOT happen
+ * */
+static unsigned char emit_skip_test(struct emitter* e, unsigned short op) {
+    int x = (op & 0x0F00) >> 8;
+    int y = (op & 0x00F0) >> 4;
+
+    switch (op & 0xF000) {
+        // cmp byte [Vx], nn
+        case 0x3000:
+        case 0x4000:
+            byte(e, 0x80);
+            mem(e, 7, V_OFF(x));
+            byte(e, op & 0x00FF);
+            break;
+
+        // mov al, [Vx]; cmp al, [Vy]
+        default:
+            op_rm(e, MOV_AL_M, V_OFF(x));
+            op_rm(e, CMP_AL_M, V_OFF(y));
+            break;
+    }
+
+    // 3XNN and 5XY0 skip on equal, 4XNN and 9XY0 on not equal
+    return ((op & 0xF000) == 0x3000 || (op & 0xF000) == 0x5000) ? JNE : JE;
+}
+
+static int is_skip(unsigned short op) {
+    switch (op & 0xF000) {
+        case 0x3000:
+        case 0x4000:
+            return 1;
+        case 0x5000:
+        case 0x9000:
+            return (op & 0x000F) == 0;
+    }
+    return 0;
+}
+
+static int is_jump(unsigned short op) { return (op & 0xF000) == 0x1000; }
+
+// longest sequence emitted for one instruction
+#define MAX_INSN_BYTES 48
+
+// longest block exit
+#define MAX_EXIT_BYTES 64
+
+/*
+==========================================================
+# Translation
+==========================================================
+*/
+
+/**
+ * flush: throw every translation away
+ * @param jit the jit
+ * @return void
+ * */
+static void flush(struct jit* jit) {
+    jit->used = 0;
+    memset(jit->block, 0, sizeof(jit->block));
+    memset(jit->len, 0, sizeof(jit->len));
+    memset(jit->hits, 0, sizeof(jit->hits));
+    memset(jit->translated, 0, sizeof(jit->translated));
+}
+
+/**
+ * mark: remember that a memory byte feeds translated code
+ * @param jit the jit
+ * @param a the address
+ * @return void
+ * */
+static void mark(struct jit* jit, unsigned int a) {
+    a &= 0xFFF;
+    jit->translated[a / 64] |= 1ULL << (a % 64);
+}
+
+/**
+ * protect: make part of the code buffer writable or executable, never both
+ * @param jit the jit
+ * @param from first byte
+ * @param to byte past the last one
+ * @param prot PROT_READ | PROT_WRITE or PROT_READ | PROT_EXEC
+ * @return 0 if success, -1 otherwise
+ * */
+static int protect(struct jit* jit, size_t from, size_t to, int prot) {
+    from &= ~(size_t)(CODE_PAGE - 1);
+    to = (to + CODE_PAGE - 1) & ~(size_t)(CODE_PAGE - 1);
+
+    return mprotect(jit->code + from, to - from, prot) ? -1 : 0;
+}
+
+/**
+ * translate: compile the run of translatable instructions at addr
+ * @param c the machine
+ * @param addr the (masked) address to start from
+ * @return void
+ *
+ * A block is a run of straight-line instructions, optionally closed by a
+ * jump, a skip, or a skip over a jump (the usual shape of a wait loop).
+ * The pages it goes to are only writable while it is emitted.
+ * */
+static void translate(chip8_t* c, unsigned short addr) {
+    struct jit* jit = c->jit;
+    size_t room = MAX_BLOCK * MAX_INSN_BYTES + MAX_EXIT_BYTES;
+
+    if (CODE_SIZE - jit->used < room) flush(jit);
+
+    size_t from = jit->used;
+
+    if (protect(jit, from, from + room, PROT_READ | PROT_WRITE)) {
+        jit->hits[addr] = NOT_TRANSLATABLE;
+        return;
+    }
+
+    struct emitter e = {jit->code + jit->used};
+    unsigned char* start = e.p;
+    unsigned int n = 0;
+    unsigned int longest;
+    unsigned short a = addr;
+    unsigned short op;
+
+    for (;;) {
+        op = c->memory[a] << 8 | c->memory[(a + 1) & 0xFFF];
+        unsigned char* before = e.p;
+
+        // keep room for a skip and a jump at the end
+        if (n == MAX_BLOCK - 2 || emit_insn(&e, op)) {
+            e.p = before;
+            break;
+        }
+
+        n++;
+        a = (a + 2) & 0xFFF;
+    }
+
+    if (is_jump(op)) {
+        set_pc(&e, op & 0x0FFF);
+        ret(&e, n + 1);
+        longest = n + 1;
+    } else if (is_skip(op)) {
+        unsigned short next =
+            c->memory[(a + 2) & 0xFFF] << 8 | c->memory[(a + 3) & 0xFFF];
+
+        if (is_jump(next)) {
+            // skipped: pc lands past the jump; not skipped: the jump runs
+            byte(&e, emit_skip_test(&e, op));
+            byte(&e, ADD_PC_BYTES + RET_BYTES);
+            add_pc(&e, 2 * n + 4);
+            ret(&e, n + 1);
+            set_pc(&e, next & 0x0FFF);
+            ret(&e, n + 2);
+            longest = n + 2;
+        } else {
+            add_pc(&e, 2 * n + 2);
+            byte(&e, emit_skip_test(&e, op));
+            byte(&e, ADD_PC_BYTES);
+            add_pc(&e, 2);
+            ret(&e, n + 1);
+            longest = n + 1;
+        }
+    } else {
+        add_pc(&e, 2 * n);
+        ret(&e, n);
+        longest = n;
+    }
+
+    // the blocks sharing these pages can't run while they aren't
+    // executable, nor can this one: give up on all of them
+    if (protect(jit, from, from + room, PROT_READ | PROT_EXEC)) {
+        flush(jit);
+        jit->hits[addr] = NOT_TRANSLATABLE;
+        return;
+    }
+
+    if (longest < MIN_BLOCK) {
+        jit->hits[addr] = NOT_TRANSLATABLE;
+        return;
+    }
+
+    // ISO C has no object to function pointer cast, memcpy does the trick
+    memcpy(&jit->block[addr], &start, sizeof(start));
+    jit->len[addr] = longest;
+    jit->used += e.p - start;
+
+    for (unsigned int i = 0; i < 2 * longest; i++) mark(jit, addr + i);
+}
+
+/*
+==========================================================
+# Public interface
+==========================================================
+*/
+
+/**
+ * jit_attach: give a machine its own jit
+ * @param c the machine
+ * @return 0 if success, -1 if memory can't be allocated or made executable
+ * */
+int jit_attach(chip8_t* c) {
+    if (c->jit) return 0;
+
+    struct jit* jit = calloc(1, sizeof(*jit));
+    if (jit == NULL) return -1;
+
+    // never writable and executable at once (W^X): executable right away,
+    // translate() opens up the pages it writes to for a while; a system
+    // that won't make it executable at all gets no jit
+    jit->code = mmap(NULL, CODE_SIZE, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (jit->code == MAP_FAILED) {
+        free(jit);
+        return -1;
+    }
+    if (protect(jit, 0, CODE_SIZE, PROT_READ | PROT_EXEC)) {
+        munmap(jit->code, CODE_SIZE);
+        free(jit);
+        return -1;
+    }
+
+    c->jit = jit;
+    return 0;
+}
+
+/**
+ * jit_detach: free the jit of a machine
+ * @param c the machine
+ * @return void
+ * */
+void jit_detach(chip8_t* c) {
+    if (c->jit == NULL) return;
+
+    munmap(c->jit->code, CODE_SIZE);
+    free(c->jit);
+    c->jit = NULL;
+}
+
+/**
+ * jit_invalidate: notify the jit that memory has been written
+ * @param jit the jit
+ * @param addr first byte written
+ * @param len number of bytes written
+ * @return void
+ * */
+void jit_invalidate(struct jit* jit, unsigned short addr, unsigned short len) {
+    for (unsigned int i = 0; i < len; i++) {
+        unsigned int a = (addr + i) & 0xFFF;
+
+        if (jit->translated[a / 64] & (1ULL << (a % 64))) {
+            flush(jit);
+            return;
+        }
+    }
+}
+
+/**
+ * run_jit: run a machine, executing hot code natively
+ * @param c the machine, with a jit attached
+ * @param cycles how many instructions to run
+ * @return the number of instructions actually run (always cycles)
+ *
+ * Leaves the machine exactly as calling emulate_cycle() cycles times would.
+ * */
+unsigned long run_jit(chip8_t* c, unsigned long cycles) {
+    struct jit* jit = c->jit;
+    unsigned long done = 0;
+
+    // translations only cover 4K of 2-byte instructions
+    if (c->mode == MODE_XOCHIP) {
+        for (; done < cycles; done++) emulate_cycle(c);
+        return done;
+    }
+
+    while (done < cycles) {
+        unsigned short addr = c->pc & 0xFFF;
+
+        // native blocks don't leave a trace nor a profile, traced and
+        // profiled machines interpret
+        if (jit->block[addr] && jit->len[addr] <= cycles - done &&
+            !TRACING(c) && !PROFILING(c)) {
+            done += jit->block[addr](c);
+            continue;
+        }
+
+        emulate_cycle(c);
+        done++;
+
+        if (jit->hits[addr] < HOT_THRESHOLD) {
+            jit->hits[addr]++;
+        } else if (jit->hits[addr] == HOT_THRESHOLD && !jit->block[addr]) {
+            translate(c, addr);
+        }
+    }
+
+    return done;
+}
+
+#else
+
+int jit_attach(chip8_t* c) {
+    (void)c;
+    return -1;
+}
+
+void jit_detach(chip8_t* c) { (void)c; }
+
+void jit_invalidate(struct jit* jit, unsigned short addr, unsigned short len) {
+    (void)jit;
+    (void)addr;
+    (void)len;
+}
+
+unsigned long run_jit(chip8_t* c, unsigned long cycles) {
+    for (unsigned long i = 0; i < cycles; i++) emulate_cycle(c);
+    return cycles;
+}
+
+#endif
@@ -0,0 +1,560 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "lockstep.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+typedef signed char mask8_t __attribute__((vector_size(LOCKSTEP_LANES)));
+typedef short mask16_t __attribute__((vector_size(2 * LOCKSTEP_LANES)));
+
+#define LANE_WORDS (LOCKSTEP_LANES / 8)
+
+/*
+==========================================================
+# Lane masks
+==========================================================
+*/
+
+// masks are all ones in their lanes, so blending is and / or; macros,
+// 32-byte vectors can't be passed around without AVX
+#define WIDEN(m) ((lanes16_t)__builtin_convertvector((mask8_t)(m), mask16_t))
+#define NARROW(m) ((lanes8_t)__builtin_convertvector((m), mask8_t))
+
+static int any(lanes8_t m) {
+    unsigned long long w[LANE_WORDS];
+    unsigned long long all = 0;
+
+    memcpy(w, &m, sizeof(w));
+    for (int i = 0; i < LANE_WORDS; i++) all |= w[i];
+    return all != 0;
+}
+
+static int first(lanes8_t m) {
+    unsigned long long w[LANE_WORDS];
+
+    memcpy(w, &m, sizeof(w));
+    for (int i = 0; i < LANE_WORDS; i++) {
+        if (w[i]) return i * 8 + __builtin_ctzll(w[i]) / 8;
+    }
+    return -1;
+}
+
+/*
+==========================================================
+# Memory writes
+==========================================================
+*/
+
+/**
+ * stored: how many bytes an instruction stores at I
+ * @param op the opcode
+ * @return the number of bytes, 0 for everything but FX33 and FX55
+ * */
+static unsigned int stored(unsigned short op) {
+    if ((op & 0xF0FF) == 0xF033) return 3;
+    if ((op & 0xF0FF) == 0xF055) return ((op >> 8) & 0xF) + 1;
+    return 0;
+}
+
+/**
+ * mark: remember that the lanes may disagree on some memory bytes
+ * @param ls the engine
+ * @param addr the first byte
+ * @param len the number of bytes
+ * @return void
+ * */
+static void mark(struct lockstep* ls, unsigned int addr, unsigned int len) {
+    for (unsigned int i = 0; i < len; i++) {
+        unsigned int a = (addr + i) & 0xFFF;
+        ls->written[a / 64] |= 1ULL << (a % 64);
+    }
+}
+
+static int was_written(const struct lockstep* ls, unsigned int a) {
+    a &= 0xFFF;
+    return (ls->written[a / 64] >> (a % 64)) & 1;
+}
+
+static unsigned short opcode_at(const chip8_t* c, unsigned short pc) {
+    return c->memory[pc & 0xFFF] << 8 | c->memory[(pc + 1) & 0xFFF];
+}
+
+/*
+==========================================================
+# Running a group
+==========================================================
+*/
+
+/**
+ * registers_of: the V registers an instruction may read or write
+ * @param op the opcode
+ * @return bit r set for Vr
+ *
+ * A handler only ever touches Vx, Vy and VF, V0 for BNNN, or V0 to Vx for
+ * the FX loads and stores, so only those go through the machines.
+ * */
+static unsigned int registers_of(unsigned short op) {
+    unsigned int x = (op >> 8) & 0xF;
+    unsigned int y = (op >> 4) & 0xF;
+
+    switch (op & 0xF000) {
+        case 0x0000:
+        case 0x1000:
+        case 0x2000:
+        case 0xA000:
+            return 0;
+        case 0xB000:
+            return 1;
+        case 0xF000:
+            switch (op & 0xFF) {
+                case 0x55:
+                case 0x65:
+                case 0x75:
+                case 0x85:
+                    return (2u << x) - 1;
+            }
+            break;
+    }
+
+    return 1u << x | 1u << y | 1u << 0xF;
+}
+
+/**
+ * per_lane: run an instruction on the machine of every lane of a group
+ * @param ls the engine
+ * @param m the group
+ * @param op the opcode at the pc of the group
+ * @return void
+ * */
+static void per_lane(struct lockstep* ls, lanes8_t m, unsigned short op) {
+    unsigned int regs = registers_of(op);
+    unsigned int len = stored(op);
+    insn_t in;
+
+    predecode(op, &in);
+
+    for (int l = 0; l < ls->lanes; l++) {
+        chip8_t* c = ls->lane[l];
+
+        if (!m[l]) continue;
+
+        for (unsigned int r = regs; r; r &= r - 1) {
+            c->V[__builtin_ctz(r)] = ls->V[__builtin_ctz(r)][l];
+        }
+        c->I = ls->I[l];
+        c->pc = ls->pc[l];
+
+        if (len) mark(ls, c->I, len);
+        execute(c, &in);
+
+        for (unsigned int r = regs; r; r &= r - 1) {
+            ls->V[__builtin_ctz(r)][l] = c->V[__builtin_ctz(r)];
+        }
+        ls->I[l] = c->I;
+        ls->pc[l] = c->pc;
+    }
+}
+
+/**
+ * run_group: run the instruction at their pc on a group of lanes
+ * @param ls the engine
+ * @param m the group, all ones in its lanes
+ * @param op the opcode at the pc of the group
+ * @return void
+ *
+ * Every kernel computes the new registers for all the lanes and keeps them
+ * in the lanes of the group only, reading and writing in the same order as
+ * the handlers, so VF comes out the same even as Vx or Vy.
+ * */
+static void run_group(struct lockstep* ls, lanes8_t m, unsigned short op) {
+    lanes8_t* V = ls->V;
+    lanes8_t zero = {0};
+    lanes16_t zero16 = {0};
+    lanes16_t m16 = WIDEN(m);
+    lanes16_t two = (zero16 + 2) & m16;
+    lanes8_t skip;
+    unsigned int x = (op >> 8) & 0xF;
+    unsigned int y = (op >> 4) & 0xF;
+    unsigned char nn = op & 0xFF;
+
+// replaces the lanes of the group, keeps the others
+#define SET(dst, v) ((dst) = ((v) & m) | ((dst) & ~m))
+
+    switch (op & 0xF000) {
+        case 0x1000:
+            ls->pc = ((zero16 + (op & 0x0FFF)) & m16) | (ls->pc & ~m16);
+            return;
+        case 0x3000:
+            skip = (lanes8_t)(V[x] == zero + nn);
+            break;
+        case 0x4000:
+            skip = (lanes8_t)(V[x] != zero + nn);
+            break;
+        case 0x5000:
+            if ((op & 0xF) != 0) {
+                per_lane(ls, m, op);
+                return;
+            }
+            skip = (lanes8_t)(V[x] == V[y]);
+            break;
+        case 0x9000:
+            if ((op & 0xF) != 0) {
+                per_lane(ls, m, op);
+                return;
+            }
+            skip = (lanes8_t)(V[x] != V[y]);
+            break;
+        case 0x6000:
+            SET(V[x], zero + nn);
+            ls->pc += two;
+            return;
+        case 0x7000:
+            V[x] += (zero + nn) & m;
+            ls->pc += two;
+            return;
+        case 0x8000:
+            switch (op & 0xF) {
+                case 0x0: SET(V[x], V[y]); break;
+                case 0x1: SET(V[x], V[x] | V[y]); break;
+                case 0x2: SET(V[x], V[x] & V[y]); break;
+                case 0x3: SET(V[x], V[x] ^ V[y]); break;
+                case 0x4:
+                    SET(V[0xF], (lanes8_t)(V[x] + V[y] < V[x]) & 1);
+                    SET(V[x], V[x] + V[y]);
+                    break;
+                case 0x5:
+                    SET(V[0xF], (lanes8_t)(V[x] > V[y]) & 1);
+                    SET(V[x], V[x] - V[y]);
+                    break;
+                case 0x6:
+                    SET(V[0xF], V[x] & 1);
+                    SET(V[x], V[x] >> 1);
+                    break;
+                case 0x7:
+                    SET(V[0xF], (lanes8_t)(V[y] > V[x]) & 1);
+                    SET(V[x], V[y] - V[x]);
+                    break;
+                case 0xE:
+                    SET(V[0xF], V[x] >> 7);
+                    SET(V[x], V[x] << 1);
+                    break;
+                default:
+                    per_lane(ls, m, op);
+                    return;
+            }
+            ls->pc += two;
+            return;
+        case 0xA000:
+            ls->I = ((zero16 + (op & 0x0FFF)) & m16) | (ls->I & ~m16);
+            ls->pc += two;
+            return;
+        case 0xF000:
+            if (nn != 0x1E) {
+                per_lane(ls, m, op);
+                return;
+            }
+            ls->I += __builtin_convertvector(V[x], lanes16_t) & m16;
+            ls->pc += two;
+            return;
+        default:
+            per_lane(ls, m, op);
+            return;
+    }
+
+#undef SET
+
+    // skips: 2 more where the test holds
+    ls->pc += two + (two & WIDEN(skip));
+}
+
+/*
+==========================================================
+# Engine
+==========================================================
+*/
+
+/**
+ * run_round: run one instruction on every lane, group by group
+ * @param ls the engine, together
+ * @return the number of groups
+ * */
+static unsigned int run_round(struct lockstep* ls) {
+    lanes16_t zero16 = {0};
+    lanes8_t left = ls->active;
+    unsigned int groups = 0;
+
+    while (any(left)) {
+        int l = first(left);
+        unsigned short pc = ls->pc[l];
+        unsigned short op = opcode_at(ls->lane[l], pc);
+        lanes8_t m = NARROW(ls->pc == zero16 + pc) & left;
+
+        // a lane that wrote its code may run something else there
+        if (was_written(ls, pc) || was_written(ls, pc + 1)) {
+            for (int k = l + 1; k < ls->lanes; k++) {
+                if (m[k] && opcode_at(ls->lane[k], pc) != op) m[k] = 0;
+            }
+        }
+
+        run_group(ls, m, op);
+        left &= ~m;
+        groups++;
+    }
+
+    return groups;
+}
+
+/**
+ * run_apart: run instructions on every lane on its own machine
+ * @param ls the engine, apart
+ * @param cycles how many instructions each lane runs
+ * @return void
+ *
+ * Lanes apart don't depend on each other, so each runs all of its
+ * instructions in a row while its machine is in the cache, straight on the
+ * switch engine: what they store is only collected when they regroup.
+ * */
+static void run_apart(struct lockstep* ls, unsigned long cycles) {
+    for (int l = 0; l < ls->lanes; l++) {
+        chip8_t* c = ls->lane[l];
+
+        for (unsigned long done = 0; done < cycles; done++) {
+            emulate_cycle_switch(c);
+        }
+    }
+}
+
+/**
+ * collect_writes: mark what the lanes may have stored while apart
+ * @param ls the engine, apart
+ * @return void
+ *
+ * The machines mark the 64-byte blocks they store to in mem_dirty, the
+ * first word covers the 4K of CHIP-8 and SCHIP memory. Those marks are
+ * never cleared, so this marks more than was stored apart, never less.
+ * */
+static void collect_writes(struct lockstep* ls) {
+    for (int l = 0; l < ls->lanes; l++) {
+        for (uint64_t d = ls->lane[l]->mem_dirty[0]; d; d &= d - 1) {
+            mark(ls, __builtin_ctzll(d) * DIRTY_BLOCK, DIRTY_BLOCK);
+        }
+    }
+}
+
+/**
+ * meeting: how many groups the lanes would make, from their machines' pcs
+ * @param ls the engine, apart
+ * @return the number of groups
+ * */
+static unsigned int meeting(const struct lockstep* ls) {
+    lanes16_t pcs = {0};
+    lanes16_t zero16 = {0};
+    lanes8_t left = ls->active;
+    unsigned int groups = 0;
+
+    for (int l = 0; l < ls->lanes; l++) pcs[l] = ls->lane[l]->pc;
+
+    while (any(left)) {
+        left &= ~NARROW(pcs == zero16 + pcs[first(left)]);
+        groups++;
+    }
+
+    return groups;
+}
+
+/**
+ * gather: take the registers of every machine into the vectors
+ * @param ls the engine
+ * @return void
+ * */
+static void gather(struct lockstep* ls) {
+    for (int l = 0; l < ls->lanes; l++) {
+        chip8_t* c = ls->lane[l];
+
+        for (int r = 0; r < 16; r++) ls->V[r][l] = c->V[r];
+        ls->I[l] = c->I;
+        ls->pc[l] = c->pc;
+    }
+}
+
+/**
+ * lockstep_create: set up an engine over some machines
+ * @param machines the lanes, booted and seeded, CHIP-8 or SCHIP mode
+ * @param lanes how many, 1 to LOCKSTEP_LANES
+ * @return the engine, NULL if the lanes don't fit or out of memory
+ *
+ * The machines belong to the engine until lockstep_destroy(): between two
+ * lockstep_run() only their timers and keypads may be touched, and their
+ * registers are only up to date after lockstep_sync().
+ * */
+struct lockstep* lockstep_create(chip8_t** machines, int lanes) {
+    struct lockstep* ls;
+
+    if (lanes < 1 || lanes > LOCKSTEP_LANES) return NULL;
+
+    // XO-CHIP has 64K of memory and 4-byte instructions
+    for (int l = 0; l < lanes; l++) {
+        if (machines[l]->mode == MODE_XOCHIP) return NULL;
+    }
+
+    // malloc doesn't align to whole vectors
+    if (posix_memalign((void**)&ls, sizeof(lanes16_t), sizeof(*ls))) {
+        return NULL;
+    }
+    memset(ls, 0, sizeof(*ls));
+
+    ls->lanes = lanes;
+    for (int l = 0; l < lanes; l++) {
+        chip8_t* c = machines[l];
+
+        ls->lane[l] = c;
+        ls->active[l] = 0xFF;
+
+        // lanes may even have been booted from different roms
+        for (unsigned int a = 0; l > 0 && a < 4096; a++) {
+            if (c->memory[a] != machines[0]->memory[a]) mark(ls, a, 1);
+        }
+    }
+    gather(ls);
+
+    return ls;
+}
+
+/**
+ * lockstep_destroy: free an engine, syncing its machines first
+ * @param ls the engine, may be NULL
+ * @return void
+ * */
+void lockstep_destroy(struct lockstep* ls) {
+    if (ls == NULL) return;
+
+    lockstep_sync(ls);
+    free(ls);
+}
+
+/**
+ * regroup: once in a while, bring lanes that met again back together
+ * @param ls the engine, apart
+ * @param n instructions every lane ran since the last call
+ * @return void
+ * */
+static void regroup(struct lockstep* ls, unsigned long n) {
+    ls->spread += n;
+    if (ls->spread < REGROUP_ROUNDS) return;
+
+    ls->spread = 0;
+    if (8 * meeting(ls) <= (unsigned int)ls->lanes) {
+        collect_writes(ls);
+        gather(ls);
+        ls->apart = 0;
+    }
+}
+
+/**
+ * lockstep_run: run instructions on every lane
+ * @param ls the engine
+ * @param cycles how many instructions each lane runs
+ * @return cycles
+ * */
+unsigned long lockstep_run(struct lockstep* ls, unsigned long cycles) {
+    unsigned long done = 0;
+
+    while (done < cycles) {
+        if (!ls->apart) {
+            unsigned int groups = run_round(ls);
+
+            ls->groups += groups;
+            done++;
+
+            // lanes that went their own ways run faster as plain machines:
+            // a group costs about as much as six plain instructions, so
+            // below 8 lanes a group on average it doesn't pay
+            ls->spread = 8 * groups > (unsigned int)ls->lanes
+                             ? ls->spread + 1
+                             : 0;
+            if (ls->spread == SPREAD_ROUNDS) {
+                lockstep_sync(ls);
+                ls->apart = 1;
+                ls->spread = 0;
+            }
+        } else {
+            unsigned long n = REGROUP_ROUNDS - ls->spread;
+
+            if (n > cycles - done) n = cycles - done;
+            run_apart(ls, n);
+            ls->alone += n * ls->lanes;
+            done += n;
+            regroup(ls, n);
+        }
+    }
+
+    return cycles;
+}
+
+/**
+ * lockstep_run_frames: run 60hz frames on every lane, timers included
+ * @param ls the engine
+ * @param frames how many frames each lane runs
+ * @param ipf instructions per frame
+ * @param before called before every frame of every lane, e.g. to set its
+ * keypad
+ * @param arg passed along to before
+ * @return frames
+ *
+ * The same as setting every keypad, lockstep_run(ls, ipf) and ticking
+ * every timer, frame after frame, except that lanes apart run on their own
+ * for as many frames as fit before the next check for meeting again, while
+ * their machine is in the cache.
+ * */
+unsigned long lockstep_run_frames(struct lockstep* ls, unsigned long frames,
+                                  unsigned long ipf, lockstep_frame_fn before,
+                                  void* arg) {
+    unsigned long f = 0;
+
+    while (f < frames) {
+        if (!ls->apart) {
+            for (int l = 0; l < ls->lanes; l++) before(ls->lane[l], l, f, arg);
+            lockstep_run(ls, ipf);
+            for (int l = 0; l < ls->lanes; l++) tick_timers(ls->lane[l]);
+            f++;
+            continue;
+        }
+
+        unsigned long n = (REGROUP_ROUNDS - ls->spread + ipf - 1) / ipf;
+        if (n > frames - f) n = frames - f;
+
+        for (int l = 0; l < ls->lanes; l++) {
+            chip8_t* c = ls->lane[l];
+
+            for (unsigned long k = 0; k < n; k++) {
+                before(c, l, f + k, arg);
+                for (unsigned long i = 0; i < ipf; i++) emulate_cycle_switch(c);
+                tick_timers(c);
+            }
+        }
+
+        ls->alone += n * ipf * ls->lanes;
+        f += n;
+        regroup(ls, n * ipf);
+    }
+
+    return frames;
+}
+
+/**
+ * lockstep_sync: bring the registers of the machines up to date
+ * @param ls the engine
+ * @return void
+ * */
+void lockstep_sync(struct lockstep* ls) {
+    if (ls->apart) return;
+
+    for (int l = 0; l < ls->lanes; l++) {
+        chip8_t* c = ls->lane[l];
+
+        for (int r = 0; r < 16; r++) c->V[r] = ls->V[r][l];
+        c->I = ls->I[l];
+        c->pc = ls->pc[l];
+    }
+}
@@ -1,30 +1,474 @@
-#define _XOPEN_SOURCE 500
+#define _POSIX_C_SOURCE 200809L
 
 #include <stdio.h>
+#include <stdlib.h>
 #include <unistd.h>
 #include <errno.h>
+#include <time.h>
 
 #include "chip8.h"
 #include "peripherals.h"
+#include "timing.h"
+#include "trace.h"
+#include "state.h"
+#include "movie.h"
+#include "profile.h"
+#include "audio.h"
+#include "recorder.h"
 extern int should_quit;
+extern int fast_forward;
+extern int save_requested;
+extern int load_requested;
+extern int rewinding;
+
+// emulated frames between two clock reads when running unthrottled
+#define TURBO_BATCH 16
+
+// seconds of history kept for rewinding
+#define DEFAULT_REWIND 10
+
+static void usage(void) {
+    error("usage: emulator [-i instructions_per_frame] [-f speed] "
+          "[-H frames] [-T trace_file] [-S state_file] [-R rewind_seconds] "
+          "[-s seed] [-r movie | -p movie] [-P profile_report] [-a sound.wav] "
+          "[-k keymap] [-m mode] [-v frames_file] rom.ch8\n");
+}
+
+// the movie being recorded (-r) or played back (-p), if any
+static struct movie movie;
+static int recording = 0;
+static int playing = 0;
+
+// the buzzer: the speakers, a WAV file (-a) or nowhere when headless
+static struct audio audio;
+
+// the stream of presented frames being recorded (-v), if any
+static struct recorder* frames_out;
+static const char* frames_file;
+static unsigned long presented;
+// frames emulated so far, what the recorded frames are numbered by
+static uint64_t emulated;
+
+/**
+ * save_trace: dump the trace ring of a machine, if it has one
+ * @param c the machine
+ * @param filename the dump file
+ * @return void
+ */
+static void save_trace(chip8_t* c, const char* filename) {
+    if (c->trace == NULL) return;
+
+    if (trace_dump(c->trace, filename)) {
+        perror("Error while writing trace");
+    } else {
+        printf("[OK] Trace written to %s\n", filename);
+    }
+
+    trace_detach(c);
+}
+
+/**
+ * save_profile: write the profile report of a machine, if it has one
+ * @param c the machine
+ * @param filename the report file
+ * @return void
+ */
+static void save_profile(chip8_t* c, const char* filename) {
+    if (c->profile == NULL) return;
+
+    FILE* fp = fopen(filename, "w");
+    if (fp == NULL) {
+        perror("Error while writing profile");
+    } else {
+        profile_report(c, fp);
+        fclose(fp);
+        printf("[OK] Profile written to %s\n", filename);
+    }
+
+    profile_detach(c);
+}
+
+/**
+ * record_frame: hand the display over to the frame recorder, if any
+ * @param c the machine
+ * @return void
+ */
+static void record_frame(const chip8_t* c) {
+    if (frames_out == NULL) return;
+
+    if (recorder_push(frames_out, c, emulated)) {
+        error("[FAILED] Could not write %s, recording stopped\n",
+              frames_file);
+        recorder_close(frames_out);
+        frames_out = NULL;
+        return;
+    }
+
+    presented++;
+}
+
+/**
+ * finish: write out the trace, the profile, the sound, the movie and the
+ * frames being recorded, if any
+ * @param c the machine
+ * @param trace_file the trace dump file
+ * @param profile_file the profile report file
+ * @param movie_file the movie file
+ * @return void
+ */
+static void finish(chip8_t* c, const char* trace_file,
+                   const char* profile_file, const char* movie_file) {
+    save_trace(c, trace_file);
+    save_profile(c, profile_file);
+
+    if (audio.sink == AUDIO_WAV) {
+        if (audio_close(&audio)) {
+            perror("Error while writing sound");
+        } else {
+            printf("[OK] Sound written, %.1f s\n",
+                   audio.samples / (double)AUDIO_RATE);
+        }
+    }
+
+    if (recording) {
+        if (movie_save(&movie, movie_file)) {
+            perror("Error while writing movie");
+        } else {
+            printf("[OK] Movie written to %s, %llu frames\n", movie_file,
+                   (unsigned long long)movie.frames);
+        }
+    }
+
+    movie_free(&movie);
+
+    if (frames_out) {
+        if (recorder_close(frames_out)) {
+            perror("Error while writing frames");
+        } else {
+            printf("[OK] Frames written to %s, %lu frames\n", frames_file,
+                   presented);
+        }
+        frames_out = NULL;
+    }
+}
+
+/**
+ * run_frame: emulate one 60hz frame
+ * @param c the machine
+ * @param ipf instructions per frame
+ * @return void
+ */
+static void run_frame(chip8_t* c, unsigned long ipf) {
+    if (playing && movie_play(&movie, &c->keypad)) {
+        playing = 0;
+        puts("[OK] End of the movie, the keyboard is back");
+    }
+
+    if (recording && movie_record(&movie, c->keypad)) {
+        recording = 0;
+        error("[FAILED] Out of memory, recording stopped\n");
+    }
+
+    // a rom waiting for a key or for dt to run out has nothing to compute
+    if (!skip_idle(c, ipf)) {
+        for (unsigned long i = 0; i < ipf; i++) {
+            emulate_cycle(c);
+        }
+    }
+
+    tick_timers(c);
+
+    // an XO-CHIP rom plays its own pattern once it has loaded one
+    int pattern = c->mode == MODE_XOCHIP && c->has_pattern;
+    audio_frame(&audio, c->sound_flag, pattern ? c->pattern : NULL, c->pitch);
+    emulated++;
+}
+
+/**
+ * run_frames: emulate the frames due for one presented frame
+ * @param c the machine
+ * @param ipf instructions per frame
+ * @param speed frames per presented frame when fast-forwarding, 0 for as
+ * many as fit before the frame deadline
+ * @param clock the frame clock
+ * @return void
+ */
+static void run_frames(chip8_t* c, unsigned long ipf, unsigned long speed,
+                       const struct frame_clock* clock) {
+    if (!fast_forward) {
+        run_frame(c, ipf);
+    } else if (speed) {
+        for (unsigned long f = 0; f < speed; f++) {
+            run_frame(c, ipf);
+        }
+    } else {
+        do {
+            for (int f = 0; f < TURBO_BATCH; f++) {
+                run_frame(c, ipf);
+            }
+        } while (!frame_clock_due(clock));
+    }
+}
+
+/**
+ * run_headless: run a number of frames flat out, without a window
+ * @param c the machine
+ * @param ipf instructions per frame
+ * @param frames how many frames to run, 0 for the whole movie being played
+ * @return void
+ */
+static void run_headless(chip8_t* c, unsigned long ipf, unsigned long frames) {
+    struct timespec start, end;
+
+    if (frames == 0 && playing) frames = movie.frames;
+
+    clock_gettime(CLOCK_MONOTONIC, &start);
+    for (unsigned long f = 0; f < frames; f++) {
+        run_frame(c, ipf);
+
+        // nothing is drawn, but a frame stream still sees what would be
+        if (c->draw_flag) {
+            record_frame(c);
+            c->draw_flag = 0;
+            c->fb_dirty = 0;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &end);
+
+    double secs = (end.tv_sec - start.tv_sec) +
+                  (end.tv_nsec - start.tv_nsec) / 1e9;
+
+    printf("[OK] %lu frames in %.3f s (%.1fx realtime), display %016llx\n",
+           frames, secs, secs > 0 ? frames / 60.0 / secs : 0.0,
+           hash_display(c));
+}
+
+// what the emulation thread of a windowed run works with
+struct session {
+    chip8_t* c;
+    unsigned long ipf;
+    unsigned long speed;
+    const char* state_file;
+    struct rewind_ring* history;
+};
+
+/**
+ * emulate: run the machine in the window until quitting, on the emulation
+ * thread (see run_display())
+ * @param arg the session
+ * @return 0
+ */
+static int emulate(void* arg) {
+    struct session* s = arg;
+    chip8_t* c = s->c;
+    struct frame_clock clock;
+
+    frame_clock_start(&clock);
+
+    /*
+     * One iteration per 60hz frame: one input snapshot, a burst of ipf
+     * instructions, one timer tick, at most one frame handed over to the
+     * render thread, the main one (which presents it on its own time, see
+     * peripherals.c) and a single sleep until the next frame.
+     *
+     * Fast-forwarding (-f or tab) emulates several frames per iteration,
+     * speed of them or, unthrottled, as many as fit before the deadline.
+     * Either way the display is still presented at most once per frame.
+     *
+     * While backspace is held frames are taken back out of the rewind
+     * history instead, one per iteration.
+     * */
+    while (!should_quit) {
+        sdl_ehandler(&c->keypad);
+
+        if (save_requested) {
+            save_requested = 0;
+            if (save_state_file(c, s->state_file)) {
+                perror("Error while saving state");
+            } else {
+                printf("[OK] State saved to %s\n", s->state_file);
+            }
+        }
+
+        if (load_requested) {
+            load_requested = 0;
+            if (recording || playing) {
+                error("[FAILED] No state loading during a movie\n");
+            } else if (load_state_file(c, s->state_file)) {
+                error("[FAILED] Could not load state from %s\n",
+                      s->state_file);
+            } else {
+                c->draw_flag = 1;
+                printf("[OK] State loaded from %s\n", s->state_file);
+            }
+        }
+
+        if (rewinding && s->history) {
+            // back to the start of the previous frame
+            if (rewind_pop(s->history, c) == 0) c->draw_flag = 1;
+        } else {
+            if (s->history) rewind_push(s->history, c);
+            run_frames(c, s->ipf, s->speed, &clock);
+        }
+
+        if (c->draw_flag) {
+            draw(&c->display[0][0], c->hires, c->fb_dirty);
+            record_frame(c);
+            c->draw_flag = 0;
+            c->fb_dirty = 0;
+        }
+
+        /*
+         * Waiting for a key with both timers stopped, nothing at all can
+         * happen before the next event: sleep until then instead of waking
+         * up every frame. (A movie being played brings its keys itself.)
+         * */
+        if (!playing && !rewinding && c->dt == 0 && c->st == 0 &&
+            is_idle(c)) {
+            sdl_wait(&c->keypad);
+            frame_clock_start(&clock);
+            continue;
+        }
+
+        frame_clock_wait(&clock);
+    }
+
+    return 0;
+}
 
 int main(int argc, char** argv) {
-    if (argc != 2) {
-        error("usage: emulator rom.ch8");
+    static chip8_t chip8;
+    unsigned long ipf = DEFAULT_IPF;
+    // frames emulated per presented frame while fast-forwarding, 0 means
+    // as many as fit in a frame
+    unsigned long speed = 0;
+    int headless = 0;
+    unsigned long frames = 0;
+    uint32_t seed = (uint32_t)time(NULL);
+    char* movie_file = NULL;
+    char* trace_file = NULL;
+    char* profile_file = NULL;
+    char* state_file = NULL;
+    char* audio_file = NULL;
+    unsigned long rewind_seconds = DEFAULT_REWIND;
+    int mode = MODE_CHIP8;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "i:f:H:T:S:R:s:r:p:P:a:k:m:v:")) != -1) {
+        switch (opt) {
+            case 'i':
+                ipf = strtoul(optarg, NULL, 10);
+                if (ipf == 0) ipf = 1;
+                break;
+            case 'f':
+                speed = strtoul(optarg, NULL, 10);
+                fast_forward = 1;
+                break;
+            case 'H':
+                headless = 1;
+                frames = strtoul(optarg, NULL, 10);
+                break;
+            case 'T':
+                trace_file = optarg;
+                break;
+            case 'P':
+                profile_file = optarg;
+                break;
+            case 'S':
+                state_file = optarg;
+                break;
+            case 'R':
+                rewind_seconds = strtoul(optarg, NULL, 10);
+                break;
+            case 's':
+                seed = strtoul(optarg, NULL, 10);
+                break;
+            case 'r':
+                movie_file = optarg;
+                recording = 1;
+                break;
+            case 'p':
+                movie_file = optarg;
+                playing = 1;
+                break;
+            case 'a':
+                audio_file = optarg;
+                break;
+            case 'k':
+                if (set_keymap(optarg)) {
+                    error("[FAILED] A keymap is \"default\", \"cosmac\" "
+                          "or 16 key names, keys 0 to F\n");
+                    return 1;
+                }
+                break;
+            case 'm':
+                mode = parse_mode(optarg);
+                if (mode < 0) {
+                    error("[FAILED] A mode is chip8, schip or xochip\n");
+                    return 1;
+                }
+                break;
+            case 'v':
+                frames_file = optarg;
+                break;
+            default:
+                usage();
+                return 1;
+        }
+    }
+
+    if (optind != argc - 1 || (recording && playing)) {
+        usage();
+        return 1;
+    }
+
+    if (trace_file) {
+#ifndef CHIP8_TRACE
+        error("[FAILED] -T needs a build with CPPFLAGS=-DCHIP8_TRACE\n");
+        return 1;
+#endif
+        if (trace_attach(&chip8, TRACE_DEFAULT_ENTRIES)) {
+            perror("trace_attach");
+            return 1;
+        }
+    }
+
+    if (profile_file) {
+#ifndef CHIP8_PROFILE
+        error("[FAILED] -P needs a build with CPPFLAGS=-DCHIP8_PROFILE\n");
         return 1;
+#endif
+        if (profile_attach(&chip8)) {
+            perror("profile_attach");
+            return 1;
+        }
+    }
+
+    // a movie brings its own mode, seed and speed along, it only replays on
+    // the very same rom
+    if (playing) {
+        if (movie_load(&movie, movie_file)) {
+            error("[FAILED] %s is not a valid movie\n", movie_file);
+            return 1;
+        }
+
+        mode = movie.mode;
+        seed = movie.seed;
+        ipf = movie.ipf;
     }
 
     puts("[PENDING] Initializing CHIP-8 arch...");
-    init_cpu();
+    init_cpu(&chip8);
+    set_mode(&chip8, mode);
     puts("[OK] Done!");
 
-    char* rom_filename = argv[1];
+    char* rom_filename = argv[optind];
     printf("[PENDING] Loading rom %s...\n", rom_filename);
 
-    int error = load_rom(rom_filename);
+    int error = load_rom(&chip8, rom_filename);
     if(error) {
         if (error == -1) {
-            error("[FAILED] fread() failure: the return value was not equal to the rom file size.");
+            error("[FAILED] The rom doesn't fit in memory.\n");
         } else {
             perror("Error while loading rom");
         }
@@ -33,21 +477,76 @@ int main(int argc, char** argv) {
 
     puts("[OK] Rom loaded successfully!");
 
-    init_display();
-    puts("[OK] Display successfully initialized.");
+    if (playing) {
+        if (movie.rom_hash != hash_memory(&chip8)) {
+            error("[FAILED] %s was recorded on another rom\n", movie_file);
+            return 1;
+        }
 
-    while (!should_quit) {
-        emulate_cycle();
-        sdl_ehandler(keypad);
+        printf("[OK] Playing %s, %llu frames\n", movie_file,
+               (unsigned long long)movie.frames);
+    }
+
+    if (recording) movie_init(&movie, &chip8, seed, ipf);
+
+    if (audio_file && audio_open_wav(&audio, audio_file)) {
+        perror("Error while opening sound file");
+        return 1;
+    }
 
-        if (draw_flag) {
-            draw(display);
+    if (frames_file) {
+        frames_out = recorder_open(frames_file);
+        if (frames_out == NULL) {
+            perror("Error while opening frames file");
+            return 1;
         }
+    }
+
+    seed_random(&chip8, seed);
+    printf("[OK] Seed %lu, %lu instructions per frame\n", (unsigned long)seed,
+           ipf);
+
+    if (headless) {
+        run_headless(&chip8, ipf, frames);
+        finish(&chip8, trace_file, profile_file, movie_file);
+        return 0;
+    }
 
-        //delay to emulate chip-8's clock speed.
-        usleep(1500);
+    // F5 / F9 save and load next to the rom unless told otherwise
+    static char default_state[4096];
+    if (state_file == NULL) {
+        snprintf(default_state, sizeof(default_state), "%s.state",
+                 rom_filename);
+        state_file = default_state;
     }
 
+    // -R 0 turns rewinding off, and so does a movie: frames taken back would
+    // have to be taken out of the movie too
+    struct rewind_ring* history = NULL;
+    if (rewind_seconds && !recording && !playing) {
+        history = rewind_create(rewind_seconds * 60, state_size(&chip8));
+        if (history == NULL) error("[FAILED] Rewinding disabled\n");
+    }
+
+    if (init_display()) {
+        rewind_destroy(history);
+        return 1;
+    }
+    puts("[OK] Display successfully initialized.");
+
+    if (audio_file == NULL) {
+        audio_init(&audio, AUDIO_RING);
+        if (init_audio(&audio.ring)) {
+            error("[FAILED] No audio device, the buzzer stays silent\n");
+            audio.sink = AUDIO_NULL;
+        }
+    }
+
+    struct session session = {&chip8, ipf, speed, state_file, history};
+    int failed = run_display(emulate, &session);
+
     stop_display();
-    return 0;
+    rewind_destroy(history);
+    finish(&chip8, trace_file, profile_file, movie_file);
+    return failed ? 1 : 0;
 }
@@ -0,0 +1,239 @@
+#include "movie.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * hash_memory: fingerprint the memory of a machine
+ * @param c the machine
+ * @return 64-bit FNV-1a hash of the whole 4K (64K in XO-CHIP mode)
+ * */
+uint64_t hash_memory(const chip8_t* c) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    for (long i = 0; i <= c->mem_mask; i++) {
+        hash ^= c->memory[i];
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+/**
+ * movie_init: start an empty movie
+ * @param m the movie
+ * @param c the machine, in its mode and with the rom just loaded
+ * @param seed the rng seed of the run
+ * @param ipf instructions per frame of the run
+ * @return void
+ * */
+void movie_init(struct movie* m, const chip8_t* c, uint32_t seed,
+                uint32_t ipf) {
+    memset(m, 0, sizeof(*m));
+    m->seed = seed;
+    m->ipf = ipf;
+    m->mode = c->mode;
+    m->rom_hash = hash_memory(c);
+}
+
+/**
+ * movie_record: append a frame
+ * @param m the movie
+ * @param keys the keypad during the frame
+ * @return 0 if success, -1 if out of memory
+ * */
+int movie_record(struct movie* m, uint16_t keys) {
+    struct movie_run* last = m->nruns ? &m->runs[m->nruns - 1] : NULL;
+
+    if (last && last->keys == keys && last->frames < UINT32_MAX) {
+        last->frames++;
+    } else {
+        if (m->nruns == m->capacity) {
+            size_t capacity = m->capacity ? 2 * m->capacity : 256;
+            struct movie_run* runs =
+                realloc(m->runs, capacity * sizeof(*runs));
+
+            if (runs == NULL) return -1;
+            m->runs = runs;
+            m->capacity = capacity;
+        }
+
+        m->runs[m->nruns].frames = 1;
+        m->runs[m->nruns].keys = keys;
+        m->nruns++;
+    }
+
+    m->frames++;
+    return 0;
+}
+
+/**
+ * movie_play: get the keypad of the next frame
+ * @param m the movie
+ * @param keypad set to the recorded keypad
+ * @return 0 if success, -1 once the movie is over
+ * */
+int movie_play(struct movie* m, uint16_t* keypad) {
+    while (m->run < m->nruns && m->played == m->runs[m->run].frames) {
+        m->run++;
+        m->played = 0;
+    }
+
+    if (m->run == m->nruns) return -1;
+
+    *keypad = m->runs[m->run].keys;
+    m->played++;
+    return 0;
+}
+
+static void put_le(unsigned char* p, uint64_t v, int bytes) {
+    for (int i = 0; i < bytes; i++) p[i] = (v >> (8 * i)) & 0xFF;
+}
+
+static uint64_t get_le(const unsigned char* p, int bytes) {
+    uint64_t v = 0;
+
+    for (int i = 0; i < bytes; i++) v |= (uint64_t)p[i] << (8 * i);
+    return v;
+}
+
+// magic, version, seed, ipf, mode, rom hash, frames, runs
+#define HEADER_SIZE (4 + 4 + 4 + 4 + 4 + 8 + 8 + 8)
+// the shortest run: a 1-byte frame count and the keypad
+#define MIN_RUN_SIZE (1 + 2)
+
+/**
+ * movie_save: write a movie to a file
+ * @param m the movie
+ * @param filename the movie file
+ * @return 0 if success, -1 otherwise
+ * */
+int movie_save(const struct movie* m, const char* filename) {
+    unsigned char header[HEADER_SIZE];
+    FILE* fp = fopen(filename, "wb");
+
+    if (fp == NULL) return -1;
+
+    memcpy(header, MOVIE_MAGIC, 4);
+    put_le(header + 4, MOVIE_VERSION, 4);
+    put_le(header + 8, m->seed, 4);
+    put_le(header + 12, m->ipf, 4);
+    put_le(header + 16, m->mode, 4);
+    put_le(header + 20, m->rom_hash, 8);
+    put_le(header + 28, m->frames, 8);
+    put_le(header + 36, m->nruns, 8);
+
+    int error = fwrite(header, sizeof(header), 1, fp) != 1;
+
+    for (size_t i = 0; i < m->nruns && !error; i++) {
+        unsigned char buf[5 + 2];
+        uint32_t frames = m->runs[i].frames;
+        int n = 0;
+
+        // LEB128: 7 bits at a time, high bit set while more follow
+        do {
+            buf[n] = frames & 0x7F;
+            frames >>= 7;
+            if (frames) buf[n] |= 0x80;
+            n++;
+        } while (frames);
+
+        put_le(buf + n, m->runs[i].keys, 2);
+        error |= fwrite(buf, n + 2, 1, fp) != 1;
+    }
+
+    error |= fclose(fp) != 0;
+    return error ? -1 : 0;
+}
+
+/**
+ * movie_load: read a movie from a file, ready to be played
+ * @param m the movie
+ * @param filename the movie file
+ * @return 0 if success, -1 otherwise
+ * */
+int movie_load(struct movie* m, const char* filename) {
+    unsigned char header[HEADER_SIZE];
+    FILE* fp = fopen(filename, "rb");
+
+    memset(m, 0, sizeof(*m));
+    if (fp == NULL) return -1;
+
+    // the runs can't outnumber the bytes left for them
+    long size = -1;
+    if (fseek(fp, 0, SEEK_END) == 0) size = ftell(fp);
+
+    if (size < HEADER_SIZE || fseek(fp, 0, SEEK_SET) ||
+        fread(header, sizeof(header), 1, fp) != 1 ||
+        memcmp(header, MOVIE_MAGIC, 4) ||
+        get_le(header + 4, 4) != MOVIE_VERSION) {
+        fclose(fp);
+        return -1;
+    }
+
+    m->seed = get_le(header + 8, 4);
+    m->ipf = get_le(header + 12, 4);
+    m->mode = get_le(header + 16, 4);
+    m->rom_hash = get_le(header + 20, 8);
+    m->frames = get_le(header + 28, 8);
+
+    uint64_t nruns = get_le(header + 36, 8);
+    uint64_t total = 0;
+    // every run is at least one frame long, and every frame runs at least
+    // one instruction (-i 0 is recorded as 1)
+    int error = nruns > m->frames || m->ipf == 0 || m->mode > MODE_XOCHIP ||
+                nruns > (uint64_t)(size - HEADER_SIZE) / MIN_RUN_SIZE ||
+                nruns > SIZE_MAX / sizeof(*m->runs);
+
+    if (!error) {
+        m->runs = malloc((nruns ? nruns : 1) * sizeof(*m->runs));
+        if (m->runs == NULL) error = 1;
+    }
+
+    for (uint64_t i = 0; i < nruns && !error; i++) {
+        uint32_t frames = 0;
+        int c, shift = 0;
+
+        do {
+            c = fgetc(fp);
+            if (c == EOF || shift > 28) {
+                error = 1;
+                break;
+            }
+            frames |= (uint32_t)(c & 0x7F) << shift;
+            shift += 7;
+        } while (c & 0x80);
+
+        unsigned char keys[2];
+        if (error || fread(keys, sizeof(keys), 1, fp) != 1) {
+            error = 1;
+            break;
+        }
+
+        m->runs[i].frames = frames;
+        m->runs[i].keys = get_le(keys, 2);
+        total += frames;
+    }
+
+    fclose(fp);
+
+    m->nruns = m->capacity = nruns;
+    if (error || total != m->frames) {
+        movie_free(m);
+        return -1;
+    }
+
+    return 0;
+}
+
+/**
+ * movie_free: free the frames of a movie
+ * @param m the movie
+ * @return void
+ * */
+void movie_free(struct movie* m) {
+    free(m->runs);
+    m->runs = NULL;
+    m->nruns = m->capacity = 0;
+}
@@ -1,21 +1,67 @@
 #include "peripherals.h"
+#include "chip8.h"
+
+#include <string.h>
 
 #include <SDL2/SDL.h>
 
+/*
+ * Threads:
+ *
+ * The window, the renderer and the event queue all belong to the main
+ * thread, the render thread below (SDL supports video and events nowhere
+ * else on some platforms, macOS among them). The emulation runs on a
+ * thread of its own, so a present blocked on vsync or on the compositor
+ * never holds it up.
+ *
+ * Frames go from the emulation to the render thread through a triple
+ * buffer: the emulation fills its back buffer and swaps it with the middle
+ * one, the render thread swaps its front buffer with the middle one when
+ * that holds a fresh frame. Neither side ever waits for the other, frames
+ * the render thread had no time for are simply skipped.
+ *
+ * Input goes the other way as a single atomic word (keypad bits, held
+ * hotkeys) plus a word of pending key presses, which sdl_ehandler()
+ * snapshots into the keypad and the globals below once per frame.
+ * */
+
 SDL_Window* screen;
 
 // struct that handles all rendering
 SDL_Renderer* renderer;
 
+// the framebuffer, 64x32 or 128x64, only its rows that changed are
+// streamed to the GPU, from the pixels kept in texels
+SDL_Texture* texture;
+static int texture_width;
+static Uint32 texels[128 * 64];
+
+// the buzzer, 0 when there is no audio device
+SDL_AudioDeviceID audio_device;
+
+// what the emulation thread runs, see run_display()
+static int (*emulation)(void*);
+static void* emulation_arg;
+
+// pixel colors (ARGB8888), indexed by the bit of plane 0 plus twice the
+// bit of plane 1, only the first two ever show up outside XO-CHIP mode
+static const Uint32 palette[4] = {0xFF000000, 0xFFFFFFFF, 0xFFAAAAAA,
+                                  0xFF555555};
+
+// longest the render thread sleeps waiting for events, in ms
+#define RENDER_POLL 4
+
 /**
  * Mapping Keyboard Keys
  *
- * A new layout is being used, not the original one:
+ * A new layout is being used by default, not the original one:
  *
  * 1    2   3   4
  * q    w   e   r
  * a    s   d   f
  * z    x   c   v
+ *
+ * set_keymap() switches to the original layout or to any other one.
  */
 SDL_Scancode keymappings[16] = {
     SDL_SCANCODE_1, SDL_SCANCODE_2, SDL_SCANCODE_3, SDL_SCANCODE_4,
@@ -23,92 +69,475 @@ SDL_Scancode keymappings[16] = {
     SDL_SCANCODE_A, SDL_SCANCODE_S, SDL_SCANCODE_D, SDL_SCANCODE_F,
     SDL_SCANCODE_Z, SDL_SCANCODE_X, SDL_SCANCODE_C, SDL_SCANCODE_V};
 
+/**
+ * The original COSMAC VIP keypad, on the same keys:
+ *
+ * 1    2   3   C
+ * 4    5   6   D
+ * 7    8   9   E
+ * A    0   B   F
+ */
+static const char* cosmac_keymap = "x 1 2 3 q w e a s d z c 4 r f v";
+
+/*
+ * Everything below is only touched by the emulation thread, sdl_ehandler()
+ * updates it from the input words.
+ * */
 int should_quit = 0;
 
+// toggled with tab, see main.c
+int fast_forward = 0;
+
+// F5 / F9 ask for a save / load of the state, cleared by main.c
+int save_requested = 0;
+int load_requested = 0;
+
+// set while backspace is held down
+int rewinding = 0;
+
+/*
+==========================================================
+# Shared between the threads
+==========================================================
+*/
+
+// state of the keyboard: keypad bits, then held hotkeys
+#define INPUT_REWIND (1u << 16)
+#define INPUT_QUIT (1u << 17)
+static uint32_t input;
+
+// bit of the input word driven by each key, 0 for keys that drive nothing
+static uint32_t key_bits[SDL_NUM_SCANCODES];
+
+// keys pressed since the last sdl_ehandler()
+#define PRESSED_TAB (1u << 0)
+#define PRESSED_SAVE (1u << 1)
+#define PRESSED_LOAD (1u << 2)
+static uint32_t pressed;
+
+// bumped on every input event, sdl_wait() sleeps until it moves past what
+// the last snapshot saw
+static uint32_t events;
+static uint32_t seen;
+static SDL_sem* input_sem;
+
+// the triple buffer, see above: index of the middle buffer, plus FRESH
+// while it holds a frame the render thread hasn't taken yet
+#define FRESH 4
+struct frame {
+    uint64_t display[DISPLAY_PLANES][DISPLAY_WORDS];
+    int hires;
+    // the rows that changed since the last frame the render thread took
+    uint64_t rows;
+};
+static struct frame frames[3];
+static int middle = 0;
+static int back = 1;
+
+// emulation side only: rows each buffer misses since it was last filled,
+// and the rows of the last frame handed over
+static uint64_t stale[3];
+static uint64_t last_rows;
+
+// set once the emulation is over
+static int render_quit;
+
+/*
+==========================================================
+# Render thread
+==========================================================
+*/
+
+/**
+ * present: upload the rows of a frame that changed and present it
+ * @param f the frame
+ * @return void
+ */
+static void present(const struct frame* f) {
+    int width = f->hires ? 128 : 64;
+    int height = width / 2;
+    int words = width / 64;
+    uint64_t rows = f->rows;
+
+    // the texture follows the resolution, the window keeps its size; a new
+    // texture holds nothing yet
+    if (width != texture_width) {
+        if (texture) SDL_DestroyTexture(texture);
+        texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888,
+                                    SDL_TEXTUREACCESS_STREAMING, width, height);
+        texture_width = texture ? width : 0;
+        rows = ~0ULL;
+    }
+    if (texture == NULL) return;
+
+    // one upload per run of changed rows
+    for (int y = 0; y < height;) {
+        if (!((rows >> y) & 1)) {
+            y++;
+            continue;
+        }
+
+        int first = y;
+        for (; y < height && ((rows >> y) & 1); y++) {
+            Uint32* line = texels + y * width;
+
+            // unpack one bit per plane and pixel into one ARGB word per pixel
+            for (int x = 0; x < width; x++) {
+                int w = y * words + x / 64;
+                int shift = 63 - x % 64;
+
+                line[x] = palette[((f->display[0][w] >> shift) & 1) |
+                                  ((f->display[1][w] >> shift) & 1) << 1];
+            }
+        }
+
+        SDL_Rect rect = {0, first, width, y - first};
+        SDL_UpdateTexture(texture, &rect, texels + first * width,
+                          width * sizeof(Uint32));
+    }
+
+    // the texture covers the whole window, no need to clear it first
+    SDL_RenderCopy(renderer, texture, NULL, NULL);
+
+    // update the screen
+    SDL_RenderPresent(renderer);
+}
+
+/**
+ * handle_event: apply an event to the keyboard state and the key presses
+ * @param event the event
+ * @param keys the keyboard state, see input
+ * @param hotkeys the key presses, see pressed
+ * @return void
+ */
+static void handle_event(const SDL_Event* event, uint32_t* keys,
+                         uint32_t* hotkeys) {
+    SDL_Scancode code;
+
+    switch (event->type) {
+        case SDL_QUIT:
+            *keys |= INPUT_QUIT;
+            break;
+        case SDL_KEYDOWN:
+            code = event->key.keysym.scancode;
+            if (code < 0 || code >= SDL_NUM_SCANCODES) break;
+
+            *keys |= key_bits[code];
+            if (event->key.repeat) break;
+
+            if (code == SDL_SCANCODE_TAB) *hotkeys |= PRESSED_TAB;
+            if (code == SDL_SCANCODE_F5) *hotkeys |= PRESSED_SAVE;
+            if (code == SDL_SCANCODE_F9) *hotkeys |= PRESSED_LOAD;
+            break;
+        case SDL_KEYUP:
+            code = event->key.keysym.scancode;
+            if (code < 0 || code >= SDL_NUM_SCANCODES) break;
+
+            // quitting sticks
+            *keys &= ~(key_bits[code] & ~INPUT_QUIT);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * pump_events: handle every pending event, then publish the input once
+ * @param first an event already taken out of the queue
+ * @return void
+ */
+static void pump_events(const SDL_Event* first) {
+    // only this thread writes input
+    uint32_t keys = __atomic_load_n(&input, __ATOMIC_RELAXED);
+    uint32_t hotkeys = 0;
+    SDL_Event event = *first;
+
+    do {
+        handle_event(&event, &keys, &hotkeys);
+    } while (SDL_PollEvent(&event));
+
+    __atomic_store_n(&input, keys, __ATOMIC_RELAXED);
+    if (hotkeys) __atomic_fetch_or(&pressed, hotkeys, __ATOMIC_RELAXED);
+
+    __atomic_fetch_add(&events, 1, __ATOMIC_RELEASE);
+    SDL_SemPost(input_sem);
+}
+
 /**
- * init_display: initialize SDL display
+ * render_loop: present frames and pump events until the emulation is over
  * @param void
  * @return void
  */
-void init_display(void) {
-    SDL_Init(SDL_INIT_VIDEO);
+static void render_loop(void) {
+    SDL_Event event;
+    int front = 2;
+
+    while (!__atomic_load_n(&render_quit, __ATOMIC_ACQUIRE)) {
+        if (__atomic_load_n(&middle, __ATOMIC_ACQUIRE) & FRESH) {
+            front = __atomic_exchange_n(&middle, front, __ATOMIC_ACQ_REL) & 3;
+
+            // may block until vsync, only this thread waits
+            present(&frames[front]);
+        }
+
+        // sleep until an event or, at the latest, the next look for a frame
+        if (SDL_WaitEventTimeout(&event, RENDER_POLL)) pump_events(&event);
+    }
+}
+
+/**
+ * emulation_thread: body of the emulation thread
+ * @param data unused
+ * @return what the emulation returned
+ */
+static int emulation_thread(void* data) {
+    (void)data;
+
+    int result = emulation(emulation_arg);
+
+    __atomic_store_n(&render_quit, 1, __ATOMIC_RELEASE);
+    return result;
+}
+
+/*
+==========================================================
+# Emulation side
+==========================================================
+*/
+
+/**
+ * set_keymap: choose the keys of the keypad, before init_display()
+ * @param spec "default", "cosmac" or the 16 SDL key names of keys 0 to F,
+ * separated by spaces or commas (e.g. "x 1 2 3 q w e a s d z c 4 r f v")
+ * @return 0 if success, -1 if a key name is unknown
+ */
+int set_keymap(const char* spec) {
+    SDL_Scancode map[16];
+    char name[32];
+    int n = 0;
+
+    if (!strcmp(spec, "default")) return 0;
+    if (!strcmp(spec, "cosmac")) spec = cosmac_keymap;
+
+    while (*spec) {
+        size_t len = strcspn(spec, " ,");
+
+        if (len > 0) {
+            if (n == 16 || len >= sizeof(name)) return -1;
+
+            memcpy(name, spec, len);
+            name[len] = '\0';
+            map[n] = SDL_GetScancodeFromName(name);
+            if (map[n] == SDL_SCANCODE_UNKNOWN) return -1;
+            n++;
+        }
+
+        spec += len;
+        if (*spec) spec++;
+    }
+
+    if (n != 16) return -1;
+
+    memcpy(keymappings, map, sizeof(map));
+    return 0;
+}
+
+/**
+ * init_display: open the window, on the main thread
+ * @param void
+ * @return 0 if success, -1 otherwise
+ */
+int init_display(void) {
+    // one lookup per key event instead of a rescan of the whole keyboard
+    for (int keycode = 0; keycode < 16; keycode++) {
+        key_bits[keymappings[keycode]] |= 1u << keycode;
+    }
+    key_bits[SDL_SCANCODE_BACKSPACE] |= INPUT_REWIND;
+    key_bits[SDL_SCANCODE_ESCAPE] |= INPUT_QUIT;
+
+    if (SDL_Init(SDL_INIT_VIDEO)) {
+        error("[FAILED] SDL_Init: %s\n", SDL_GetError());
+        return -1;
+    }
 
     screen = SDL_CreateWindow("CHIP-8", SDL_WINDOWPOS_CENTERED,
                               SDL_WINDOWPOS_CENTERED, 64 * 8, 32 * 8, 0);
-    renderer = SDL_CreateRenderer(screen, -1, SDL_RENDERER_ACCELERATED);
+    if (screen) {
+        renderer = SDL_CreateRenderer(
+            screen, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC);
+    }
+    if (renderer) input_sem = SDL_CreateSemaphore(0);
+
+    if (input_sem == NULL) {
+        error("[FAILED] Could not open the window: %s\n", SDL_GetError());
+        if (renderer) SDL_DestroyRenderer(renderer);
+        if (screen) SDL_DestroyWindow(screen);
+        SDL_Quit();
+        return -1;
+    }
+
+    // the framebuffer is uploaded as a 64x32 (or 128x64) texture and scaled
+    // up by the GPU in a single copy, present() creates it for the first
+    // frame
+    return 0;
 }
 
 /**
- * draw: draw SDL rectangle to screen
- * @param display a pointer to the display
- * @return void
+ * run_display: run the emulation on a thread of its own and the window on
+ * this one, the main thread, until the emulation returns
+ * @param run the emulation, calls draw(), sdl_ehandler() and sdl_wait()
+ * @param arg its argument
+ * @return what run returned, -1 if it couldn't be started
  */
-void draw(unsigned char* display) {
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
+int run_display(int (*run)(void*), void* arg) {
+    int result = -1;
 
-    // clear the current rendering target with the drawing color
-    SDL_RenderClear(renderer);
+    emulation = run;
+    emulation_arg = arg;
+
+    SDL_Thread* thread = SDL_CreateThread(emulation_thread, "emulation", NULL);
+    if (thread == NULL) {
+        error("[FAILED] SDL_CreateThread: %s\n", SDL_GetError());
+        return -1;
+    }
+
+    render_loop();
+    SDL_WaitThread(thread, &result);
+    return result;
+}
 
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255);
+/**
+ * draw: hand the display over to the render thread, never waits
+ * @param display a pointer to the display, DISPLAY_PLANES planes of
+ * DISPLAY_WORDS 64-bit words (see chip8_t)
+ * @param hires whether the display is 128x64 rather than 64x32
+ * @param rows the rows that changed since the last draw, bit y for row y
+ * (see fb_dirty)
+ * @return void
+ */
+void draw(const uint64_t* display, int hires, uint64_t rows) {
+    int words = hires ? 2 : 1;
+    struct frame* f = &frames[back];
 
-    // iterating thru the display (64*32)
-    for (int y = 0; y < 32; y++) {
-        for (int x = 0; x < 64; x++) {
-            if (display[x + (y * 64)]) {
-                SDL_Rect rect;
+    for (int i = 0; i < 3; i++) stale[i] |= rows;
+    if (f->hires != hires) stale[back] = ~0ULL;
 
-                rect.x = x * 8;
-                rect.y = y * 8;
-                rect.w = 8;
-                rect.h = 8;
+    // the back buffer was last filled a couple of frames ago, it only
+    // misses the rows changed since
+    for (uint64_t d = stale[back]; d; d &= d - 1) {
+        int y = __builtin_ctzll(d);
 
-                SDL_RenderFillRect(renderer, &rect);
-            }
+        if (y >= (hires ? 64 : 32)) break;
+        for (int p = 0; p < DISPLAY_PLANES; p++) {
+            memcpy(&f->display[p][y * words],
+                   display + p * DISPLAY_WORDS + y * words, words * 8);
         }
     }
+    stale[back] = 0;
+    f->hires = hires;
 
-    // update the screen
-    SDL_RenderPresent(renderer);
+    // the previous frame may never be taken if it is still in the middle
+    // (if the render thread took it since, uploading its rows again is
+    // merely redundant)
+    if (__atomic_load_n(&middle, __ATOMIC_ACQUIRE) & FRESH) rows |= last_rows;
+    f->rows = rows;
+    last_rows = rows;
+
+    // the render thread takes it from the middle whenever it gets there
+    back = __atomic_exchange_n(&middle, back | FRESH, __ATOMIC_ACQ_REL) & 3;
 }
 
 /**
- * sdl_handler: SDL Event Handler for keypress
+ * sdl_ehandler: snapshot the input of the render thread, once per frame
  * @param keypad pointer to the keypad
  * @return void
  */
-void sdl_ehandler(unsigned char* keypad) {
-    SDL_Event event;
+void sdl_ehandler(uint16_t* keypad) {
+    seen = __atomic_load_n(&events, __ATOMIC_ACQUIRE);
 
-    // check for event
-    if (SDL_PollEvent(&event)) {
-        // get snapshot of current state of the keyboard
-        const Uint8* state = SDL_GetKeyboardState(NULL);
-
-        switch (event.type) {
-            case SDL_QUIT:
-                should_quit = 1;
-                break;
-            default:
-                if (state[SDL_SCANCODE_ESCAPE]) {
-                    should_quit = 1;
-                }
-
-                // updating the keypad with the current state
-                for (int keycode = 0; keycode < 16; keycode++) {
-                    keypad[keycode] = state[keymappings[keycode]];
-                }
-
-                break;
-        }
+    uint32_t keys = __atomic_load_n(&input, __ATOMIC_RELAXED);
+    uint32_t hotkeys = __atomic_exchange_n(&pressed, 0, __ATOMIC_RELAXED);
+
+    *keypad = keys & 0xFFFF;
+
+    if (keys & INPUT_QUIT) should_quit = 1;
+    rewinding = (keys & INPUT_REWIND) != 0;
+
+    if (hotkeys & PRESSED_TAB) fast_forward = !fast_forward;
+    if (hotkeys & PRESSED_SAVE) save_requested = 1;
+    if (hotkeys & PRESSED_LOAD) load_requested = 1;
+}
+
+/**
+ * sdl_wait: sleep until the next input event, then snapshot the input
+ * @param keypad pointer to the keypad
+ * @return void
+ */
+void sdl_wait(uint16_t* keypad) {
+    // posts left over from events already snapshotted just loop once more
+    while (__atomic_load_n(&events, __ATOMIC_ACQUIRE) == seen) {
+        SDL_SemWait(input_sem);
     }
+
+    sdl_ehandler(keypad);
+}
+
+/**
+ * audio_callback: feed the audio device from the sample ring
+ * @param userdata the ring
+ * @param stream the buffer to fill
+ * @param len its size in bytes
+ * @return void
+ *
+ * Runs on the SDL audio thread, it never waits on the emulation: whatever
+ * the ring doesn't have yet is played as silence.
+ */
+static void audio_callback(void* userdata, Uint8* stream, int len) {
+    Sint16* samples = (Sint16*)stream;
+    uint32_t wanted = len / sizeof(Sint16);
+    uint32_t got = ring_pop(userdata, samples, wanted);
+
+    memset(samples + got, 0, (wanted - got) * sizeof(Sint16));
+}
+
+/**
+ * init_audio: open the audio device and start draining the ring
+ * @param ring the ring the emulation pushes samples into
+ * @return 0 if success, -1 otherwise
+ */
+int init_audio(struct audio_ring* ring) {
+    SDL_AudioSpec want, have;
+
+    if (SDL_InitSubSystem(SDL_INIT_AUDIO)) return -1;
+
+    memset(&want, 0, sizeof(want));
+    want.freq = AUDIO_RATE;
+    want.format = AUDIO_S16SYS;
+    want.channels = 1;
+    // 1024 samples, about 23ms, well under what the ring holds
+    want.samples = 1024;
+    want.callback = audio_callback;
+    want.userdata = ring;
+
+    audio_device = SDL_OpenAudioDevice(NULL, 0, &want, &have, 0);
+    if (audio_device == 0) return -1;
+
+    SDL_PauseAudioDevice(audio_device, 0);
+    return 0;
 }
 
 /**
- * stop_display: destroy SDL window and quit
+ * stop_display: destroy SDL window and quit, once run_display() returned
  * @param void
  * @return void
  */
 void stop_display(void) {
+    if (audio_device) SDL_CloseAudioDevice(audio_device);
+
+    if (texture) SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(screen);
+
+    SDL_DestroySemaphore(input_sem);
     SDL_Quit();
 }
@@ -0,0 +1,258 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "profile.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+static const char* const class_names[PROFILE_CLASSES] = {
+    "00E0", "00EE", "1NNN", "2NNN", "3XNN", "4XNN", "5XY0", "6XNN", "7XNN",
+    "8XY0", "8XY1", "8XY2", "8XY3", "8XY4", "8XY5", "8XY6", "8XY7", "8XYE",
+    "9XY0", "ANNN", "BNNN", "CXNN", "DXYN", "EX9E", "EXA1", "FX07", "FX0A",
+    "FX15", "FX18", "FX1E", "FX29", "FX33", "FX55", "FX65",
+    // SCHIP and XO-CHIP
+    "00CN", "00DN", "00FB", "00FC", "00FD", "00FE", "00FF", "5XY2", "5XY3",
+    "F000", "FN01", "F002", "FX30", "FX3A", "FX75", "FX85", "????"};
+
+#define UNKNOWN (PROFILE_CLASSES - 1)
+
+/**
+ * classify: find the opcode class of an opcode
+ * @param op the opcode
+ * @return an index into class_names
+ */
+static int classify(unsigned short op) {
+    switch (op & 0xF000) {
+        // as decode() does it, the class is the handler that runs
+        case 0x0000:
+            switch (op & 0x00FF) {
+                case 0xE0: return 0;
+                case 0xEE: return 1;
+                case 0xFB: return 36;
+                case 0xFC: return 37;
+                case 0xFD: return 38;
+                case 0xFE: return 39;
+                case 0xFF: return 40;
+            }
+            if ((op & 0xFFF0) == 0x00C0) return 34;
+            if ((op & 0xFFF0) == 0x00D0) return 35;
+            return UNKNOWN;
+        case 0x8000:
+            switch (op & 0x000F) {
+                case 0x0: case 0x1: case 0x2: case 0x3:
+                case 0x4: case 0x5: case 0x6: case 0x7:
+                    return 9 + (op & 0x000F);
+                case 0xE: return 17;
+            }
+            return UNKNOWN;
+        case 0xE000:
+            if ((op & 0x00FF) == 0x9E) return 23;
+            if ((op & 0x00FF) == 0xA1) return 24;
+            return UNKNOWN;
+        case 0xF000:
+            if (op == 0xF000) return 43;
+            if (op == 0xF002) return 45;
+
+            switch (op & 0x00FF) {
+                case 0x01: return 44;
+                case 0x07: return 25;
+                case 0x0A: return 26;
+                case 0x15: return 27;
+                case 0x18: return 28;
+                case 0x1E: return 29;
+                case 0x29: return 30;
+                case 0x33: return 31;
+                case 0x55: return 32;
+                case 0x65: return 33;
+                case 0x30: return 46;
+                case 0x3A: return 47;
+                case 0x75: return 48;
+                case 0x85: return 49;
+            }
+            return UNKNOWN;
+        case 0x5000:
+            if ((op & 0x000F) == 0x2) return 41;
+            if ((op & 0x000F) == 0x3) return 42;
+            return 6;
+        case 0x9000:
+            return 18;
+    }
+
+    // 1NNN-4XNN, 6XNN, 7XNN and ANNN-DXYN are one class per first nibble
+    static const int simple[16] = {0, 2, 3, 4, 5, 0, 7, 8,
+                                   0, 0, 19, 20, 21, 22, 0, 0};
+    return simple[op >> 12];
+}
+
+/**
+ * ticks: read the host clock
+ * @param void
+ * @return the timestamp counter on x86-64, nanoseconds elsewhere
+ */
+static inline uint64_t ticks(void) {
+#if defined(__x86_64__)
+    return __builtin_ia32_rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+#endif
+}
+
+/**
+ * profile_attach: start profiling a machine
+ * @param c the machine
+ * @return 0 if success, -1 otherwise
+ */
+int profile_attach(chip8_t* c) {
+    c->profile = calloc(1, sizeof(struct profile));
+    return c->profile ? 0 : -1;
+}
+
+/**
+ * profile_detach: stop profiling a machine and free its counters
+ * @param c the machine
+ * @return void
+ */
+void profile_detach(chip8_t* c) {
+    free(c->profile);
+    c->profile = NULL;
+}
+
+/**
+ * profile_cycle: run and account for one instruction
+ * @param c the machine, with a profile attached
+ * @return void
+ */
+void profile_cycle(chip8_t* c) {
+    struct profile* p = c->profile;
+    // XO-CHIP addresses past 4K share the counters of their first 4K
+    unsigned short pc = c->pc & 0xFFF;
+    unsigned short op = c->memory[c->pc & c->mem_mask] << 8 |
+                        c->memory[(c->pc + 1) & c->mem_mask];
+    int class = classify(op);
+
+    uint64_t start = ticks();
+#ifdef CHIP8_DISPATCH_TABLE
+    emulate_cycle_table(c);
+#else
+    emulate_cycle_switch(c);
+#endif
+    uint64_t spent = ticks() - start;
+
+    p->class_count[class]++;
+    p->class_ticks[class] += spent;
+    p->addr_count[pc]++;
+    p->addr_ticks[pc] += spent;
+}
+
+static const struct profile* sorting;
+
+static int by_class_ticks(const void* a, const void* b) {
+    uint64_t ta = sorting->class_ticks[*(const int*)a];
+    uint64_t tb = sorting->class_ticks[*(const int*)b];
+    return (ta < tb) - (ta > tb);
+}
+
+static int by_addr_ticks(const void* a, const void* b) {
+    uint64_t ta = sorting->addr_ticks[*(const int*)a];
+    uint64_t tb = sorting->addr_ticks[*(const int*)b];
+    return (ta < tb) - (ta > tb);
+}
+
+// addresses listed in the report
+#define HOT_ADDRESSES 32
+
+/**
+ * profile_report: print what the machine spent its time on
+ * @param c the machine, with a profile attached
+ * @param fp where to print
+ * @return void
+ */
+void profile_report(const chip8_t* c, FILE* fp) {
+    const struct profile* p = c->profile;
+    uint64_t count = 0, spent = 0, hottest = 0;
+    static int order[4096];
+
+    for (int i = 0; i < PROFILE_CLASSES; i++) {
+        count += p->class_count[i];
+        spent += p->class_ticks[i];
+    }
+    if (count == 0 || spent == 0) {
+        fprintf(fp, "no instruction profiled\n");
+        return;
+    }
+
+    // qsort has no context argument, reports are one at a time anyway
+    sorting = p;
+
+    fprintf(fp, "%-6s %14s %7s %16s %7s %10s\n", "class", "count", "%",
+            "ticks", "%", "ticks/op");
+    for (int i = 0; i < PROFILE_CLASSES; i++) order[i] = i;
+    qsort(order, PROFILE_CLASSES, sizeof(*order), by_class_ticks);
+
+    for (int i = 0; i < PROFILE_CLASSES; i++) {
+        int k = order[i];
+
+        if (p->class_count[k] == 0) break;
+        fprintf(fp, "%-6s %14llu %6.2f%% %16llu %6.2f%% %10.1f\n",
+                class_names[k], (unsigned long long)p->class_count[k],
+                100.0 * p->class_count[k] / count,
+                (unsigned long long)p->class_ticks[k],
+                100.0 * p->class_ticks[k] / spent,
+                (double)p->class_ticks[k] / p->class_count[k]);
+    }
+
+    fprintf(fp, "\n%-6s %-6s %14s %7s %16s %7s\n", "addr", "op", "count", "%",
+            "ticks", "%");
+    for (int i = 0; i < 4096; i++) order[i] = i;
+    qsort(order, 4096, sizeof(*order), by_addr_ticks);
+
+    for (int i = 0; i < HOT_ADDRESSES; i++) {
+        int a = order[i];
+
+        if (p->addr_count[a] == 0) break;
+        fprintf(fp, "0x%03X  %02X%02X   %14llu %6.2f%% %16llu %6.2f%%\n", a,
+                c->memory[a], c->memory[(a + 1) & 0xFFF],
+                (unsigned long long)p->addr_count[a],
+                100.0 * p->addr_count[a] / count,
+                (unsigned long long)p->addr_ticks[a],
+                100.0 * p->addr_ticks[a] / spent);
+    }
+
+    /*
+     * Heatmap: one character per address, 64 per line, darker for more
+     * time spent there (on a log scale, loops are orders of magnitude
+     * hotter than the rest).
+     * */
+    static const char shades[] = " .:-=+*#%@";
+    int levels = sizeof(shades) - 2;
+
+    for (int a = 0; a < 4096; a++) {
+        if (p->addr_ticks[a] > hottest) hottest = p->addr_ticks[a];
+    }
+
+    fprintf(fp, "\nheatmap (ticks per address, log scale)\n");
+    for (int row = 0; row < 4096; row += 64) {
+        fprintf(fp, "0x%03X |", row);
+
+        for (int a = row; a < row + 64; a++) {
+            int level = 0;
+
+            // shade = how many powers of 4 below the hottest address
+            if (p->addr_ticks[a]) {
+                uint64_t t = p->addr_ticks[a];
+                level = levels;
+                while (level > 1 && t * 4 <= hottest) {
+                    t *= 4;
+                    level--;
+                }
+            }
+
+            fputc(shades[level], fp);
+        }
+
+        fprintf(fp, "|\n");
+    }
+}
@@ -0,0 +1,330 @@
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "recorder.h"
+
+struct slot {
+    uint64_t frame;
+    int hires;
+    // the rows that changed since the previous frame (fb_dirty), the only
+    // ones copied: the rest of the slot is left over from older frames
+    uint64_t rows;
+    uint64_t display[DISPLAY_PLANES][DISPLAY_WORDS];
+};
+
+struct recorder {
+    FILE* fp;
+    pthread_t thread;
+
+    /*
+     * The queue: the emulation thread fills the slot at head, the encoder
+     * empties the one at tail, neither touches the other's slot, so the
+     * lock only guards the counters (free-running, the slot is n % size).
+     * The encoder is woken up once RECORDER_BATCH frames are waiting, not
+     * for every frame, and then encodes all of them in a row.
+     * */
+    pthread_mutex_t lock;
+    pthread_cond_t not_empty;
+    pthread_cond_t not_full;
+    struct slot queue[RECORDER_QUEUE];
+    unsigned long head;
+    unsigned long tail;
+    // frames pushed, the first one has every row copied
+    unsigned long pushed;
+    int closing;
+    // a write failed, everything after it is thrown away
+    int failed;
+
+    // encoder side: the previous frame, whole, and where the keyframes are
+    uint64_t last[DISPLAY_PLANES * DISPLAY_WORDS];
+    int last_hires;
+    unsigned long since_key;
+    uint64_t offset;
+    uint64_t* index;
+    size_t keys;
+    size_t capacity;
+    // room for the worst case, a lone byte every other byte
+    unsigned char out[FRAME_BYTES(1) * 2 + 32];
+};
+
+static void put_le(unsigned char* p, uint64_t v, int bytes) {
+    for (int i = 0; i < bytes; i++) p[i] = (v >> (8 * i)) & 0xFF;
+}
+
+// LEB128: 7 bits at a time, high bit set while more follow
+static int put_leb(unsigned char* p, uint64_t v) {
+    int n = 0;
+
+    do {
+        p[n] = v & 0x7F;
+        v >>= 7;
+        if (v) p[n] |= 0x80;
+        n++;
+    } while (v);
+
+    return n;
+}
+
+// byte i of a frame held as words, see recorder.h
+#define BYTE(words, i) ((unsigned char)((words)[(i) / 8] >> (56 - (i) % 8 * 8)))
+
+/**
+ * run_length: encode the bytes of a frame as runs of zeros and runs of
+ * anything else
+ * @param out the encoded bytes
+ * @param words the frame, as words
+ * @param size its size in bytes
+ * @return the length of the encoded bytes
+ * */
+static size_t run_length(unsigned char* out, const uint64_t* words,
+                         size_t size) {
+    size_t n = 0;
+    size_t i = 0;
+
+    for (;;) {
+        size_t zeros = i;
+
+        // most of a frame, and almost all of a delta, is zero words
+        while (i < size) {
+            if (i % 8 == 0 && words[i / 8] == 0) {
+                i += 8;
+            } else if (BYTE(words, i) == 0) {
+                i++;
+            } else {
+                break;
+            }
+        }
+        if (i == size) break;
+        zeros = i - zeros;
+
+        // a single zero between two literals costs more as a run than
+        // copied along, two or more are worth a pair
+        size_t first = i;
+        while (i < size && (BYTE(words, i) ||
+                            (i + 1 < size && BYTE(words, i + 1)))) {
+            i++;
+        }
+
+        n += put_leb(out + n, zeros);
+        n += put_leb(out + n, i - first);
+        for (size_t k = first; k < i; k++) out[n++] = BYTE(words, k);
+    }
+
+    return n;
+}
+
+/**
+ * encode: write one frame to the stream
+ * @param r the recorder
+ * @param s the frame
+ * @return 0 if success, -1 otherwise
+ * */
+static int encode(struct recorder* r, const struct slot* s) {
+    uint64_t delta[DISPLAY_PLANES * DISPLAY_WORDS];
+    size_t words = s->hires ? 128 : 32;
+    int row_words = s->hires ? 2 : 1;
+    int key = r->since_key == 0 || r->since_key >= RECORDER_KEYFRAME ||
+              s->hires != r->last_hires;
+
+    // plane after plane, the words of the resolution in use only; rows
+    // that didn't change are a zero delta (switching resolution marks
+    // every row, so last never mixes the two layouts)
+    memset(delta, 0, sizeof(delta));
+    for (int p = 0; p < DISPLAY_PLANES; p++) {
+        uint64_t* last = r->last + p * words;
+
+        for (uint64_t d = s->rows; d; d &= d - 1) {
+            size_t w = __builtin_ctzll(d) * row_words;
+
+            for (size_t k = w; k < w + row_words; k++) {
+                delta[p * words + k] = s->display[p][k] ^ last[k];
+                last[k] = s->display[p][k];
+            }
+        }
+    }
+
+    if (key) memcpy(delta, r->last, DISPLAY_PLANES * words * sizeof(*delta));
+
+    unsigned char header[1 + 10 + 10];
+    size_t payload = run_length(r->out, delta, FRAME_BYTES(s->hires));
+    int n = 0;
+
+    r->last_hires = s->hires;
+    r->since_key = key ? 1 : r->since_key + 1;
+
+    header[n++] = (key ? RECORD_KEYFRAME : 0) | (s->hires ? RECORD_HIRES : 0);
+    n += put_leb(header + n, s->frame);
+    n += put_leb(header + n, payload);
+
+    if (key) {
+        if (r->keys == r->capacity) {
+            size_t capacity = r->capacity ? r->capacity * 2 : 64;
+            uint64_t* index = realloc(r->index, capacity * 2 * sizeof(*index));
+
+            if (index == NULL) return -1;
+            r->index = index;
+            r->capacity = capacity;
+        }
+
+        r->index[r->keys * 2] = s->frame;
+        r->index[r->keys * 2 + 1] = r->offset;
+        r->keys++;
+    }
+
+    if (fwrite(header, n, 1, r->fp) != 1) return -1;
+    if (payload && fwrite(r->out, payload, 1, r->fp) != 1) return -1;
+
+    r->offset += n + payload;
+    return 0;
+}
+
+/**
+ * encoder: encoder thread body, drains the queue until closed
+ * @param arg the recorder
+ * @return NULL
+ * */
+static void* encoder(void* arg) {
+    struct recorder* r = arg;
+
+    pthread_mutex_lock(&r->lock);
+    for (;;) {
+        while (r->head - r->tail < RECORDER_BATCH && !r->closing) {
+            pthread_cond_wait(&r->not_empty, &r->lock);
+        }
+        if (r->head == r->tail) break;
+
+        unsigned long head = r->head;
+        int failed = r->failed;
+        pthread_mutex_unlock(&r->lock);
+
+        for (unsigned long n = r->tail; n != head && !failed; n++) {
+            failed = encode(r, &r->queue[n % RECORDER_QUEUE]);
+        }
+
+        pthread_mutex_lock(&r->lock);
+        r->failed = failed;
+        r->tail = head;
+        pthread_cond_signal(&r->not_full);
+    }
+    pthread_mutex_unlock(&r->lock);
+
+    return NULL;
+}
+
+/**
+ * recorder_open: create a stream and start its encoder
+ * @param filename the stream file
+ * @return the recorder, NULL otherwise
+ * */
+struct recorder* recorder_open(const char* filename) {
+    struct recorder* r = calloc(1, sizeof(*r));
+    unsigned char header[8];
+
+    if (r == NULL) return NULL;
+
+    r->fp = fopen(filename, "wb");
+    if (r->fp == NULL) {
+        free(r);
+        return NULL;
+    }
+
+    memcpy(header, RECORDER_MAGIC, 4);
+    put_le(header + 4, RECORDER_VERSION, 4);
+    r->offset = sizeof(header);
+
+    pthread_mutex_init(&r->lock, NULL);
+    pthread_cond_init(&r->not_empty, NULL);
+    pthread_cond_init(&r->not_full, NULL);
+
+    if (fwrite(header, sizeof(header), 1, r->fp) != 1 ||
+        pthread_create(&r->thread, NULL, encoder, r)) {
+        fclose(r->fp);
+        free(r);
+        return NULL;
+    }
+
+    return r;
+}
+
+/**
+ * recorder_push: queue the display of a machine, waiting for room if the
+ * encoder is behind
+ * @param r the recorder
+ * @param c the machine, fb_dirty marking the rows changed since the last
+ * push (the caller clears it afterwards)
+ * @param frame the emulated frame it is presented at
+ * @return 0 if success, -1 if the stream can't be written anymore
+ * */
+int recorder_push(struct recorder* r, const chip8_t* c, uint64_t frame) {
+    pthread_mutex_lock(&r->lock);
+    while (r->head - r->tail == RECORDER_QUEUE) {
+        pthread_cond_wait(&r->not_full, &r->lock);
+    }
+    int failed = r->failed;
+    pthread_mutex_unlock(&r->lock);
+
+    if (failed) return -1;
+
+    struct slot* s = &r->queue[r->head % RECORDER_QUEUE];
+    uint64_t rows = r->pushed++ ? c->fb_dirty : ~0ULL;
+    int row_words = c->hires ? 2 : 1;
+
+    s->frame = frame;
+    s->hires = c->hires;
+    s->rows = rows & (c->hires ? ~0ULL : 0xFFFFFFFFULL);
+    for (uint64_t d = s->rows; d; d &= d - 1) {
+        size_t w = __builtin_ctzll(d) * row_words;
+
+        for (int p = 0; p < DISPLAY_PLANES; p++) {
+            memcpy(&s->display[p][w], &c->display[p][w],
+                   row_words * sizeof(uint64_t));
+        }
+    }
+
+    pthread_mutex_lock(&r->lock);
+    r->head++;
+    if (r->head - r->tail == RECORDER_BATCH) pthread_cond_signal(&r->not_empty);
+    pthread_mutex_unlock(&r->lock);
+
+    return 0;
+}
+
+/**
+ * recorder_close: encode what is left in the queue, write the keyframe
+ * index and close the stream
+ * @param r the recorder
+ * @return 0 if every frame was written, -1 otherwise
+ * */
+int recorder_close(struct recorder* r) {
+    pthread_mutex_lock(&r->lock);
+    r->closing = 1;
+    pthread_cond_signal(&r->not_empty);
+    pthread_mutex_unlock(&r->lock);
+    pthread_join(r->thread, NULL);
+
+    int error = r->failed;
+    unsigned char buf[16];
+
+    put_le(buf, r->keys, 8);
+    error = error || fwrite(buf, 8, 1, r->fp) != 1;
+
+    for (size_t i = 0; i < r->keys * 2 && !error; i++) {
+        put_le(buf, r->index[i], 8);
+        error = fwrite(buf, 8, 1, r->fp) != 1;
+    }
+
+    put_le(buf, r->offset, 8);
+    memcpy(buf + 8, RECORDER_TRAILER, 4);
+    error = error || fwrite(buf, 12, 1, r->fp) != 1;
+    error |= fclose(r->fp) != 0;
+
+    pthread_mutex_destroy(&r->lock);
+    pthread_cond_destroy(&r->not_empty);
+    pthread_cond_destroy(&r->not_full);
+    free(r->index);
+    free(r);
+
+    return error ? -1 : 0;
+}
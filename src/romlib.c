@@ -0,0 +1,364 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "romlib.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/**
+ * hash_rom: fingerprint the content of a rom
+ * @param data the rom
+ * @param size its size
+ * @return 64-bit FNV-1a hash
+ */
+static uint64_t hash_rom(const unsigned char* data, size_t size) {
+    uint64_t hash = 0xcbf29ce484222325ULL;
+
+    for (size_t i = 0; i < size; i++) {
+        hash ^= data[i];
+        hash *= 0x100000001b3ULL;
+    }
+
+    return hash;
+}
+
+/**
+ * add_rom: append a rom to the library
+ * @param lib the library
+ * @param name the name of the rom
+ * @param name_len its length
+ * @param data the rom
+ * @param size its size, at most ROM_MAX
+ * @return 0 if success, -1 if out of memory
+ */
+static int add_rom(struct rom_library* lib, const char* name,
+                   size_t name_len, const unsigned char* data, size_t size) {
+    struct rom* roms = realloc(lib->roms, (lib->count + 1) * sizeof(*roms));
+    if (roms == NULL) return -1;
+    lib->roms = roms;
+
+    struct rom* r = &lib->roms[lib->count];
+    void* image;
+
+    if (posix_memalign(&image, 64, 4096)) return -1;
+    r->name = strndup(name, name_len);
+    if (r->name == NULL) {
+        free(image);
+        return -1;
+    }
+
+    r->image = image;
+    r->size = size;
+    r->hash = hash_rom(data, size);
+    make_image(r->image, data, size);
+
+    lib->count++;
+    return 0;
+}
+
+/**
+ * too_big: report a rom the library can't hold
+ * @param name the rom
+ * @param name_len the length of its name
+ * @param size its size, more than ROM_MAX
+ * @return void
+ */
+static void too_big(const char* name, size_t name_len, size_t size) {
+    error("[FAILED] %.*s is %zu bytes, roms in a library are at most %d "
+          "(4K images: bigger XO-CHIP roms only load in the emulator)\n",
+          (int)name_len, name, size, ROM_MAX);
+}
+
+/**
+ * map_file: map a whole file read-only
+ * @param path the file
+ * @param size set to the size of the file
+ * @return the mapping, NULL on failure (errno is set)
+ */
+static unsigned char* map_file(const char* path, size_t* size) {
+    int fd = open(path, O_RDONLY);
+    struct stat st;
+    void* data = MAP_FAILED;
+
+    if (fd < 0) return NULL;
+
+    if (fstat(fd, &st) == 0) {
+        *size = st.st_size;
+
+        if (!S_ISREG(st.st_mode)) {
+            errno = EINVAL;
+        } else if (*size == 0) {
+            // mmap refuses empty mappings, an empty rom is still a rom
+            static unsigned char empty;
+            data = &empty;
+        } else {
+            data = mmap(NULL, *size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+    }
+
+    close(fd);
+    return data == MAP_FAILED ? NULL : data;
+}
+
+static void unmap_file(unsigned char* data, size_t size) {
+    if (size) munmap(data, size);
+}
+
+/**
+ * add_pack: append every rom of a pack file
+ * @param lib the library
+ * @param path the pack file, for error messages
+ * @param data the mapped pack
+ * @param size its size
+ * @return 0 if success, -1 otherwise
+ */
+static int add_pack(struct rom_library* lib, const char* path,
+                    const unsigned char* data, size_t size) {
+    const unsigned char* p = data + 8;
+    const unsigned char* end = data + size;
+    uint32_t count;
+
+    if (size < 8) goto corrupt;
+    count = data[4] | data[5] << 8 | data[6] << 16 | (uint32_t)data[7] << 24;
+
+    for (uint32_t i = 0; i < count; i++) {
+        if (end - p < 4) goto corrupt;
+
+        size_t name_len = p[0] | p[1] << 8;
+        size_t rom_size = p[2] | p[3] << 8;
+        p += 4;
+
+        if ((size_t)(end - p) < name_len + rom_size) goto corrupt;
+
+        if (rom_size > ROM_MAX) {
+            too_big((const char*)p, name_len, rom_size);
+            return -1;
+        }
+
+        // names go from the mapping straight to the heap, they can be up
+        // to 64K long
+        if (add_rom(lib, (const char*)p, name_len, p + name_len, rom_size)) {
+            return -1;
+        }
+        p += name_len + rom_size;
+    }
+
+    return 0;
+
+corrupt:
+    error("[FAILED] %s: corrupt pack\n", path);
+    return -1;
+}
+
+// directories hold notes and listings next to the roms
+static int is_rom(const char* name) {
+    size_t len = strlen(name);
+
+    return len > 4 && (!strcmp(name + len - 4, ".ch8") ||
+                       !strcmp(name + len - 4, ".CH8"));
+}
+
+static int by_name(const void* a, const void* b) {
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+/**
+ * add_dir: append every .ch8 rom of a directory, in name order
+ * @param lib the library
+ * @param path the directory
+ * @return 0 if success, -1 otherwise
+ */
+static int add_dir(struct rom_library* lib, const char* path) {
+    DIR* dir = opendir(path);
+    struct dirent* entry;
+    char** names = NULL;
+    size_t count = 0;
+    int status = 0;
+
+    if (dir == NULL) return -1;
+
+    while ((entry = readdir(dir)) != NULL) {
+        if (entry->d_name[0] == '.' || !is_rom(entry->d_name)) continue;
+
+        char** grown = realloc(names, (count + 1) * sizeof(*names));
+        if (grown == NULL) {
+            status = -1;
+            break;
+        }
+        names = grown;
+        names[count++] = strdup(entry->d_name);
+    }
+    closedir(dir);
+
+    // readdir order depends on the file system, runs shouldn't
+    qsort(names, count, sizeof(*names), by_name);
+
+    for (size_t i = 0; i < count && status == 0; i++) {
+        char file[4096];
+        size_t size;
+
+        size_t len = strlen(path);
+
+        // "roms/" and "roms" name their roms the same way
+        while (len > 1 && path[len - 1] == '/') len--;
+        snprintf(file, sizeof(file), "%.*s/%s", (int)len, path, names[i]);
+        unsigned char* data = map_file(file, &size);
+
+        // subdirectories and such are not roms
+        if (data == NULL) continue;
+
+        if (size > ROM_MAX) {
+            too_big(file, strlen(file), size);
+        } else {
+            status = add_rom(lib, file, strlen(file), data, size);
+        }
+
+        unmap_file(data, size);
+    }
+
+    for (size_t i = 0; i < count; i++) free(names[i]);
+    free(names);
+
+    return status;
+}
+
+/**
+ * romlib_add: add a rom, a pack of roms or a directory of roms
+ * @param lib the library, zeroed before the first call
+ * @param path the rom, pack or directory
+ * @return 0 if success, -1 otherwise
+ */
+int romlib_add(struct rom_library* lib, const char* path) {
+    struct stat st;
+
+    if (stat(path, &st)) return -1;
+    if (S_ISDIR(st.st_mode)) return add_dir(lib, path);
+
+    size_t size;
+    unsigned char* data = map_file(path, &size);
+    int status;
+
+    if (data == NULL) return -1;
+
+    if (size >= 4 && !memcmp(data, PACK_MAGIC, 4)) {
+        status = add_pack(lib, path, data, size);
+    } else if (size > ROM_MAX) {
+        too_big(path, strlen(path), size);
+        status = -1;
+    } else {
+        status = add_rom(lib, path, strlen(path), data, size);
+    }
+
+    unmap_file(data, size);
+    return status;
+}
+
+static const struct rom_library* sorting;
+
+static int by_hash(const void* a, const void* b) {
+    size_t ia = *(const size_t*)a, ib = *(const size_t*)b;
+    uint64_t ha = sorting->roms[ia].hash, hb = sorting->roms[ib].hash;
+
+    // ties in load order, so lookups find the first copy of a rom
+    if (ha == hb) return (ia > ib) - (ia < ib);
+    return (ha > hb) - (ha < hb);
+}
+
+/**
+ * romlib_index: index the roms by hash, after the last romlib_add()
+ * @param lib the library
+ * @return void
+ */
+void romlib_index(struct rom_library* lib) {
+    free(lib->by_hash);
+    lib->by_hash = malloc((lib->count ? lib->count : 1) * sizeof(size_t));
+    if (lib->by_hash == NULL) return;
+
+    for (size_t i = 0; i < lib->count; i++) lib->by_hash[i] = i;
+
+    // qsort has no context argument, indexing happens once at startup
+    sorting = lib;
+    qsort(lib->by_hash, lib->count, sizeof(size_t), by_hash);
+}
+
+/**
+ * romlib_find: look a rom up by content
+ * @param lib the indexed library
+ * @param hash the hash of the rom
+ * @return the first rom with that content, NULL if there is none
+ */
+const struct rom* romlib_find(const struct rom_library* lib, uint64_t hash) {
+    size_t lo = 0, hi = lib->by_hash ? lib->count : 0;
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+
+        if (lib->roms[lib->by_hash[mid]].hash < hash) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    if (lo < lib->count && lib->by_hash &&
+        lib->roms[lib->by_hash[lo]].hash == hash) {
+        return &lib->roms[lib->by_hash[lo]];
+    }
+
+    return NULL;
+}
+
+/**
+ * romlib_write_pack: save the whole library as a single pack file
+ * @param lib the library
+ * @param filename the pack file
+ * @return 0 if success, -1 otherwise
+ */
+int romlib_write_pack(const struct rom_library* lib, const char* filename) {
+    FILE* fp = fopen(filename, "wb");
+    unsigned char header[8] = {'C', '8', 'P', 'K'};
+    int error = 0;
+
+    if (fp == NULL) return -1;
+
+    for (int i = 0; i < 4; i++) header[4 + i] = (lib->count >> (8 * i)) & 0xFF;
+    error |= fwrite(header, sizeof(header), 1, fp) != 1;
+
+    for (size_t i = 0; i < lib->count && !error; i++) {
+        const struct rom* r = &lib->roms[i];
+        size_t name_len = strlen(r->name);
+        unsigned char sizes[4] = {name_len & 0xFF, (name_len >> 8) & 0xFF,
+                                  r->size & 0xFF, (r->size >> 8) & 0xFF};
+
+        error |= name_len > 0xFFFF;
+        error |= fwrite(sizes, sizeof(sizes), 1, fp) != 1;
+        error |= fwrite(r->name, 1, name_len, fp) != name_len;
+        error |= fwrite(r->image + 0x200, 1, r->size, fp) != r->size;
+    }
+
+    error |= fclose(fp) != 0;
+    return error ? -1 : 0;
+}
+
+/**
+ * romlib_free: free every rom of a library
+ * @param lib the library
+ * @return void
+ */
+void romlib_free(struct rom_library* lib) {
+    for (size_t i = 0; i < lib->count; i++) {
+        free(lib->roms[i].name);
+        free(lib->roms[i].image);
+    }
+
+    free(lib->roms);
+    free(lib->by_hash);
+    memset(lib, 0, sizeof(*lib));
+}
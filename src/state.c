@@ -0,0 +1,465 @@
+#include "state.h"
+#include "cache.h"
+#include "jit.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+==========================================================
+# Snapshots
+==========================================================
+*/
+
+static unsigned char* put16(unsigned char* p, unsigned int v) {
+    p[0] = v & 0xFF;
+    p[1] = (v >> 8) & 0xFF;
+    return p + 2;
+}
+
+static unsigned char* put32(unsigned char* p, uint32_t v) {
+    p = put16(p, v & 0xFFFF);
+    return put16(p, v >> 16);
+}
+
+static unsigned char* put64(unsigned char* p, uint64_t v) {
+    p = put32(p, (uint32_t)v);
+    return put32(p, (uint32_t)(v >> 32));
+}
+
+static unsigned int get16(const unsigned char** p) {
+    unsigned int v = (*p)[0] | (*p)[1] << 8;
+    *p += 2;
+    return v;
+}
+
+static uint32_t get32(const unsigned char** p) {
+    uint32_t lo = get16(p);
+    return lo | (uint32_t)get16(p) << 16;
+}
+
+static uint64_t get64(const unsigned char** p) {
+    uint64_t lo = get32(p);
+    return lo | (uint64_t)get32(p) << 32;
+}
+
+/**
+ * state_size: size of the snapshots of a machine
+ * @param c the machine
+ * @return the size in bytes
+ * */
+size_t state_size(const chip8_t* c) {
+    return STATE_SIZE((size_t)c->mem_mask + 1);
+}
+
+/**
+ * save_state: serialize a machine
+ * @param c the machine
+ * @param buf where to write the snapshot, state_size(c) bytes
+ * @return the size of the snapshot
+ * */
+size_t save_state(const chip8_t* c, unsigned char* buf) {
+    unsigned char* p = buf;
+    size_t memory = (size_t)c->mem_mask + 1;
+
+    memcpy(p, STATE_MAGIC, 4);
+    p = put16(p + 4, STATE_VERSION);
+    p = put32(p, STATE_SIZE(memory));
+
+    p = put16(p, c->pc);
+    p = put16(p, c->I);
+    *p++ = c->sp;
+    *p++ = c->dt;
+    *p++ = c->st;
+    *p++ = c->draw_flag;
+    *p++ = c->sound_flag;
+    *p++ = c->mode;
+    *p++ = c->hires;
+    *p++ = c->planes;
+
+    memcpy(p, c->V, 16);
+    p += 16;
+    for (int i = 0; i < 16; i++) p = put16(p, c->stack[i]);
+    p = put32(p, c->rng);
+    memcpy(p, c->flags, 16);
+    p += 16;
+
+    memcpy(p, c->pattern, 16);
+    p += 16;
+    *p++ = c->pitch;
+    *p++ = c->has_pattern;
+
+    memcpy(p, c->memory, memory);
+    p += memory;
+    for (int i = 0; i < DISPLAY_PLANES; i++) {
+        for (int w = 0; w < DISPLAY_WORDS; w++) p = put64(p, c->display[i][w]);
+    }
+
+    return p - buf;
+}
+
+/**
+ * load_state: restore a machine from a snapshot
+ * @param c the machine
+ * @param buf the snapshot, state_size(c) bytes
+ * @return 0 if success, -1 if buf isn't a snapshot of this version and of
+ * the mode of the machine
+ * */
+int load_state(chip8_t* c, const unsigned char* buf) {
+    const unsigned char* p = buf + 4;
+    size_t memory = (size_t)c->mem_mask + 1;
+
+    if (memcmp(buf, STATE_MAGIC, 4)) return -1;
+    if (get16(&p) != STATE_VERSION) return -1;
+    if (get32(&p) != STATE_SIZE(memory)) return -1;
+    // checked before touching anything, the mode is set once at boot
+    if (p[9] != c->mode) return -1;
+
+    c->pc = get16(&p);
+    c->I = get16(&p);
+    c->sp = *p++;
+    c->dt = *p++;
+    c->st = *p++;
+    c->draw_flag = *p++;
+    c->sound_flag = *p++;
+    p++;
+    c->hires = *p++;
+    c->planes = *p++;
+
+    memcpy(c->V, p, 16);
+    p += 16;
+    for (int i = 0; i < 16; i++) c->stack[i] = get16(&p);
+    c->rng = get32(&p);
+    memcpy(c->flags, p, 16);
+    p += 16;
+
+    memcpy(c->pattern, p, 16);
+    p += 16;
+    c->pitch = *p++;
+    c->has_pattern = *p++;
+
+    // only the bytes that really change have to be dropped from the block
+    // cache and the jit, rewinding usually touches a handful of them
+    size_t lo = 0, hi = memory;
+    while (lo < hi && c->memory[lo] == p[lo]) lo++;
+    while (hi > lo && c->memory[hi - 1] == p[hi - 1]) hi--;
+
+    if (lo < hi) {
+        memcpy(c->memory + lo, p + lo, hi - lo);
+        dirty_memory(c, lo, hi - lo);
+        // both only ever cover the first 4K, XO-CHIP mode interprets
+        if (lo < 4096) {
+            size_t end = hi < 4096 ? hi : 4096;
+            if (c->cache) cache_invalidate(c->cache, lo, end - lo);
+            if (c->jit) jit_invalidate(c->jit, lo, end - lo);
+        }
+    }
+    p += memory;
+
+    for (int i = 0; i < DISPLAY_PLANES; i++) {
+        for (int w = 0; w < DISPLAY_WORDS; w++) c->display[i][w] = get64(&p);
+    }
+    c->fb_dirty = ~0ULL;
+
+    return 0;
+}
+
+/**
+ * save_state_file: write a snapshot of a machine to a file
+ * @param c the machine
+ * @param filename the state file
+ * @return 0 if success, -1 otherwise
+ * */
+int save_state_file(const chip8_t* c, const char* filename) {
+    unsigned char* buf = malloc(state_size(c));
+    FILE* fp = fopen(filename, "wb");
+    int error = 1;
+
+    if (buf != NULL && fp != NULL) {
+        size_t size = save_state(c, buf);
+        error = fwrite(buf, size, 1, fp) != 1;
+    }
+    if (fp != NULL) error |= fclose(fp) != 0;
+
+    free(buf);
+    return error ? -1 : 0;
+}
+
+/**
+ * load_state_file: restore a machine from a state file
+ * @param c the machine
+ * @param filename the state file
+ * @return 0 if success, -1 otherwise
+ * */
+int load_state_file(chip8_t* c, const char* filename) {
+    size_t size = state_size(c);
+    unsigned char* buf = malloc(size);
+    FILE* fp = fopen(filename, "rb");
+    int error = 1;
+
+    // a snapshot of another mode has another size, load_state refuses it
+    if (buf != NULL && fp != NULL) {
+        error = fread(buf, size, 1, fp) != 1 || load_state(c, buf) != 0;
+    }
+    if (fp != NULL) fclose(fp);
+
+    free(buf);
+    return error ? -1 : 0;
+}
+
+/*
+==========================================================
+# Rewind
+==========================================================
+*/
+
+// bytes of arena budgeted per delta, on top of room for the keyframes
+#define DELTA_BUDGET 256
+
+// equal bytes it takes to end a run of a delta, shorter gaps are cheaper
+// to store inside the run than to start a new one
+#define MIN_GAP 4
+
+/**
+ * rewind_create: allocate a rewind ring
+ * @param frames how many snapshots to keep at most
+ * @param size the size of the snapshots, state_size() of the machine
+ * @return the ring, NULL on failure
+ * */
+struct rewind_ring* rewind_create(unsigned long frames, size_t size) {
+    struct rewind_ring* r = calloc(1, sizeof(*r));
+
+    if (r == NULL || frames == 0) {
+        free(r);
+        return NULL;
+    }
+
+    r->size = size;
+    r->frames = frames;
+    r->arena_size = (frames / KEYFRAME_INTERVAL + 2) * size +
+                    frames * DELTA_BUDGET;
+    r->arena = malloc(r->arena_size);
+    r->entries = malloc(frames * sizeof(*r->entries));
+    r->state = malloc(size);
+    r->delta = malloc(size);
+
+    if (r->arena == NULL || r->entries == NULL || r->state == NULL ||
+        r->delta == NULL) {
+        rewind_destroy(r);
+        return NULL;
+    }
+
+    return r;
+}
+
+/**
+ * rewind_destroy: free a rewind ring
+ * @param r the ring, may be NULL
+ * @return void
+ * */
+void rewind_destroy(struct rewind_ring* r) {
+    if (r == NULL) return;
+
+    free(r->arena);
+    free(r->entries);
+    free(r->state);
+    free(r->delta);
+    free(r);
+}
+
+static struct rewind_entry* entry(struct rewind_ring* r, unsigned long seq) {
+    return &r->entries[seq % r->frames];
+}
+
+/**
+ * drop_oldest: forget the oldest keyframe and every delta against it
+ * @param r the ring, not empty
+ * @return void
+ * */
+static void drop_oldest(struct rewind_ring* r) {
+    unsigned long key = r->first;
+
+    do {
+        r->first++;
+    } while (r->first < r->last && entry(r, r->first)->key == key);
+
+    if (r->first == r->last) r->top = 0;
+}
+
+/**
+ * reserve: find room for a record, dropping old ones if needed
+ * @param r the ring
+ * @param len the size of the record
+ * @return the offset of the record in the arena
+ * */
+static size_t reserve(struct rewind_ring* r, size_t len) {
+    for (;;) {
+        if (r->first == r->last) {
+            r->top = 0;
+            return 0;
+        }
+
+        size_t oldest = entry(r, r->first)->offset;
+
+        if (r->last - r->first < r->frames) {
+            if (r->top > oldest) {
+                // live records in [oldest, top), free space on both sides
+                if (r->top + len <= r->arena_size) return r->top;
+                if (len <= oldest) return 0;
+            } else if (r->top + len <= oldest) {
+                // wrapped: free space in [top, oldest)
+                return r->top;
+            }
+        }
+
+        drop_oldest(r);
+    }
+}
+
+/**
+ * encode: xor a snapshot against its keyframe, keeping the non-zero runs
+ * @param r the ring, the snapshot in r->state and the delta goes to r->delta
+ * @param key the keyframe
+ * @return the size of the delta, 0 if it isn't worth it
+ * */
+static size_t encode(struct rewind_ring* r, const unsigned char* key) {
+    const unsigned char* s = r->state;
+    unsigned char* out = r->delta;
+    size_t n = 0;
+    size_t i = 0;
+
+    while (i < r->size) {
+        size_t start = i;
+
+        // skip the unchanged bytes, a word at a time while possible
+        while (i + 8 <= r->size && !memcmp(s + i, key + i, 8)) i += 8;
+        while (i < r->size && s[i] == key[i]) i++;
+        if (i == r->size) break;
+
+        size_t skip = i - start;
+        size_t run = i;
+
+        for (size_t gap = 0; i < r->size && gap < MIN_GAP; i++) {
+            gap = s[i] == key[i] ? gap + 1 : 0;
+        }
+        while (i > run && s[i - 1] == key[i - 1]) i--;
+
+        size_t len = i - run;
+        if (n + 8 + len >= r->size) return 0;
+
+        put32(out + n, skip);
+        put32(out + n + 4, len);
+        for (size_t j = 0; j < len; j++) {
+            out[n + 8 + j] = s[run + j] ^ key[run + j];
+        }
+        n += 8 + len;
+    }
+
+    // identical to the keyframe still needs a record
+    if (n == 0) {
+        put32(out, 0);
+        put32(out + 4, 0);
+        n = 8;
+    }
+
+    return n;
+}
+
+/**
+ * decode: rebuild a snapshot from its keyframe and delta
+ * @param r the ring, the snapshot is rebuilt in r->state
+ * @param key the keyframe
+ * @param delta the delta
+ * @param len the size of the delta
+ * @return void
+ * */
+static void decode(struct rewind_ring* r, const unsigned char* key,
+                   const unsigned char* delta, size_t len) {
+    const unsigned char* p = delta;
+    size_t pos = 0;
+
+    memcpy(r->state, key, r->size);
+
+    while (p < delta + len) {
+        pos += get32(&p);
+        size_t run = get32(&p);
+
+        for (size_t j = 0; j < run; j++) r->state[pos + j] ^= p[j];
+        pos += run;
+        p += run;
+    }
+}
+
+/**
+ * rewind_push: record the current frame
+ * @param r the ring
+ * @param c the machine
+ * @return void
+ * */
+void rewind_push(struct rewind_ring* r, const chip8_t* c) {
+    unsigned long seq = r->last;
+    unsigned long key = seq;
+    const unsigned char* data = r->state;
+    size_t len = r->size;
+
+    save_state(c, r->state);
+
+    if (r->first < r->last) {
+        key = entry(r, seq - 1)->key;
+
+        if (seq - key < KEYFRAME_INTERVAL) {
+            len = encode(r, r->arena + entry(r, key)->offset);
+            data = r->delta;
+        }
+
+        if (len == 0 || seq - key >= KEYFRAME_INTERVAL) {
+            key = seq;
+            data = r->state;
+            len = r->size;
+        }
+    }
+
+    size_t offset = reserve(r, len);
+
+    // making room may have dropped the keyframe of this delta
+    if (key < r->first) {
+        key = seq;
+        data = r->state;
+        len = r->size;
+        offset = reserve(r, len);
+    }
+
+    memcpy(r->arena + offset, data, len);
+    r->top = offset + len;
+
+    struct rewind_entry* e = entry(r, seq);
+    e->offset = offset;
+    e->len = len;
+    e->key = key;
+    r->last++;
+}
+
+/**
+ * rewind_pop: go back one frame, forgetting it
+ * @param r the ring
+ * @param c the machine to restore
+ * @return 0 if success, -1 once there is nothing left to rewind
+ * */
+int rewind_pop(struct rewind_ring* r, chip8_t* c) {
+    if (r->first == r->last) return -1;
+
+    unsigned long seq = --r->last;
+    struct rewind_entry* e = entry(r, seq);
+    const unsigned char* data = r->arena + e->offset;
+
+    if (e->key != seq) {
+        decode(r, r->arena + entry(r, e->key)->offset, data, e->len);
+        data = r->state;
+    }
+
+    r->top = e->offset;
+    if (r->first == r->last) r->top = 0;
+
+    return load_state(c, data);
+}
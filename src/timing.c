@@ -0,0 +1,62 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include "timing.h"
+
+#include <errno.h>
+
+// past this many frames late we stop trying to catch up
+#define MAX_LAG 5
+
+/**
+ * frame_clock_start: start counting frames from now
+ * @param clock the clock
+ * @return void
+ */
+void frame_clock_start(struct frame_clock* clock) {
+    clock_gettime(CLOCK_MONOTONIC, &clock->deadline);
+}
+
+/**
+ * frame_clock_wait: sleep until the end of the current frame
+ * @param clock the clock
+ * @return void
+ */
+void frame_clock_wait(struct frame_clock* clock) {
+    struct timespec now;
+
+    clock->deadline.tv_nsec += FRAME_NS;
+    if (clock->deadline.tv_nsec >= 1000000000L) {
+        clock->deadline.tv_nsec -= 1000000000L;
+        clock->deadline.tv_sec++;
+    }
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    // after a long stall (window dragged, process stopped...) resync
+    // instead of running a burst of frames to catch up
+    long long late = (now.tv_sec - clock->deadline.tv_sec) * 1000000000LL +
+                     (now.tv_nsec - clock->deadline.tv_nsec);
+    if (late > MAX_LAG * FRAME_NS) {
+        clock->deadline = now;
+        return;
+    }
+
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &clock->deadline,
+                           NULL) == EINTR) {
+    }
+}
+
+/**
+ * frame_clock_due: check whether the current frame is over, without sleeping
+ * @param clock the clock
+ * @return 1 once the end of the current frame has passed, 0 otherwise
+ */
+int frame_clock_due(const struct frame_clock* clock) {
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    long long left = (clock->deadline.tv_sec - now.tv_sec) * 1000000000LL +
+                     (clock->deadline.tv_nsec - now.tv_nsec) + FRAME_NS;
+    return left <= 0;
+}
@@ -0,0 +1,106 @@
+#include "trace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+ * trace_attach: give a machine a trace ring
+ * @param c the machine
+ * @param entries ring capacity, rounded up to a power of two
+ * @return 0 if success, -1 otherwise
+ */
+int trace_attach(chip8_t* c, unsigned long entries) {
+    unsigned long size = 1;
+
+    while (size < entries) size <<= 1;
+
+    struct trace* trace =
+        malloc(sizeof(*trace) + size * sizeof(struct trace_entry));
+    if (trace == NULL) return -1;
+
+    trace->head = 0;
+    trace->mask = size - 1;
+
+    c->trace = trace;
+    return 0;
+}
+
+/**
+ * trace_detach: free the trace ring of a machine, if any
+ * @param c the machine
+ * @return void
+ */
+void trace_detach(chip8_t* c) {
+    free(c->trace);
+    c->trace = NULL;
+}
+
+/**
+ * trace_record: append the instruction about to run to the ring
+ * @param c the machine, with a trace attached
+ * @param op the opcode at pc
+ * @return void
+ */
+void trace_record(chip8_t* c, unsigned short op) {
+    struct trace* trace = c->trace;
+    uint64_t head = trace->head;
+    struct trace_entry* e = &trace->ring[head & trace->mask];
+
+    e->cycle = head;
+    e->pc = c->pc;
+    e->op = op;
+    e->I = c->I;
+    e->sp = c->sp;
+    e->dt = c->dt;
+    memcpy(e->V, c->V, sizeof(e->V));
+
+    // publish the entry only once it is complete
+    __atomic_store_n(&trace->head, head + 1, __ATOMIC_RELEASE);
+}
+
+/**
+ * trace_dump: write the entries still in the ring to a file
+ * @param trace the ring
+ * @param filename the dump file
+ * @return 0 if success, -1 otherwise
+ *
+ * Safe to call while the machine is running: entries the writer may have
+ * overwritten during the copy are dropped rather than dumped torn.
+ */
+int trace_dump(const struct trace* trace, const char* filename) {
+    uint64_t size = trace->mask + 1;
+    uint64_t end = __atomic_load_n(&trace->head, __ATOMIC_ACQUIRE);
+    uint64_t start = end > size ? end - size : 0;
+
+    struct trace_entry* copy = malloc(size * sizeof(*copy));
+    if (copy == NULL) return -1;
+
+    for (uint64_t i = start; i < end; i++) {
+        copy[i - start] = trace->ring[i & trace->mask];
+    }
+
+    // while head was below now + 1 the slots of entries past now + 1 - size
+    // were left alone
+    __atomic_thread_fence(__ATOMIC_ACQUIRE);
+    uint64_t now = __atomic_load_n(&trace->head, __ATOMIC_RELAXED);
+    uint64_t first = start;
+    if (now + 1 > size && now + 1 - size > first) first = now + 1 - size;
+    if (first > end) first = end;
+
+    struct trace_header header = {TRACE_MAGIC, TRACE_VERSION,
+                                  sizeof(struct trace_entry), 0, end - first};
+
+    FILE* fp = fopen(filename, "wb");
+    int error = fp == NULL;
+
+    if (!error) {
+        error |= fwrite(&header, sizeof(header), 1, fp) != 1;
+        error |= fwrite(copy + (first - start), sizeof(*copy), end - first,
+                        fp) != end - first;
+        error |= fclose(fp) != 0;
+    }
+
+    free(copy);
+    return error ? -1 : 0;
+}
@@ -0,0 +1,84 @@
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include "disasm.h"
+#include "trace.h"
+
+/*
+ * Offline trace decoder:
+ *
+ * Reads a dump written by trace_dump() (emulator -T) and prints one line
+ * per instruction: the cycle, pc, opcode, its disassembly and the registers
+ * as they were right before it ran.
+ * */
+
+static void usage(void) {
+    error("usage: chip8-trace [-n last] trace_file\n");
+}
+
+int main(int argc, char** argv) {
+    unsigned long last = 0;
+    int opt;
+
+    while ((opt = getopt(argc, argv, "n:")) != -1) {
+        switch (opt) {
+            case 'n':
+                last = strtoul(optarg, NULL, 10);
+                break;
+            default:
+                usage();
+                return 1;
+        }
+    }
+
+    if (optind != argc - 1) {
+        usage();
+        return 1;
+    }
+
+    FILE* fp = fopen(argv[optind], "rb");
+    if (fp == NULL) {
+        perror("Error while opening trace");
+        return 1;
+    }
+
+    struct trace_header header;
+
+    if (fread(&header, sizeof(header), 1, fp) != 1 ||
+        memcmp(header.magic, TRACE_MAGIC, sizeof(header.magic)) ||
+        header.version != TRACE_VERSION ||
+        header.entry_size != sizeof(struct trace_entry)) {
+        error("[FAILED] %s is not a trace from this build\n", argv[optind]);
+        fclose(fp);
+        return 1;
+    }
+
+    // only the newest entries are wanted, skip the others
+    if (last && last < header.count) {
+        if (fseek(fp, (long)((header.count - last) * sizeof(struct trace_entry)),
+                  SEEK_CUR)) {
+            perror("fseek");
+            fclose(fp);
+            return 1;
+        }
+    }
+
+    struct trace_entry e;
+    char text[32];
+
+    while (fread(&e, sizeof(e), 1, fp) == 1) {
+        disasm(e.op, text, sizeof(text));
+
+        printf("%10llu  %03X  %04X  %-16s I=%03X SP=%X DT=%02X V=",
+               (unsigned long long)e.cycle, e.pc, e.op, text, e.I, e.sp, e.dt);
+        for (int i = 0; i < 16; i++) printf("%02X", e.V[i]);
+        printf("\n");
+    }
+
+    fclose(fp);
+    return 0;
+}